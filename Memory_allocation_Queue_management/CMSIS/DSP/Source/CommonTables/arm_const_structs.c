@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * @file    arm_const_structs.c
+  * @brief   Instances of the floating point complex FFT (arm_const_structs.h)
+  * 		 for each length from 16 to 4096, given to arm_cfft_f32().  The
+  * 		 kernel's output is in plain bit reversed order, so each instance
+  * 		 uses the fixed point bit reversal tables.
+  ******************************************************************************
+*/
+
+#include "arm_const_structs.h"
+
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len16 =
+{
+	16, twiddleCoef_16, armBitRevIndexTable_fixed_16, ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len32 =
+{
+	32, twiddleCoef_32, armBitRevIndexTable_fixed_32, ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len64 =
+{
+	64, twiddleCoef_64, armBitRevIndexTable_fixed_64, ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len128 =
+{
+	128, twiddleCoef_128, armBitRevIndexTable_fixed_128, ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len256 =
+{
+	256, twiddleCoef_256, armBitRevIndexTable_fixed_256, ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len512 =
+{
+	512, twiddleCoef_512, armBitRevIndexTable_fixed_512, ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len1024 =
+{
+	1024, twiddleCoef_1024, armBitRevIndexTable_fixed_1024, ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len2048 =
+{
+	2048, twiddleCoef_2048, armBitRevIndexTable_fixed_2048, ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
+};
+
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len4096 =
+{
+	4096, twiddleCoef_4096, armBitRevIndexTable_fixed_4096, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
+};
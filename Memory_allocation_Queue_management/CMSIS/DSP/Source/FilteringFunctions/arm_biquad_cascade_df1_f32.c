@@ -0,0 +1,100 @@
+/**
+  ******************************************************************************
+  * @file    arm_biquad_cascade_df1_f32.c
+  * @brief   Floating point biquad cascade in direct form I (arm_math.h).  Each
+  * 		 section keeps x[n-1], x[n-2], y[n-1] and y[n-2] in its state and
+  * 		 filters the whole block before the next section runs on it.
+  ******************************************************************************
+*/
+
+#include "arm_math.h"
+
+/**
+  * @brief  Filter a block of samples.  pSrc and pDst may be the same, as
+  * 		each input is read before its output is written
+  *
+  * @param  S -> an instance set up by arm_biquad_cascade_df1_init_f32()
+  * @param  pSrc -> blockSize input samples
+  * @param  pDst -> blockSize output samples
+  * @param  blockSize -> samples to filter
+  *
+  * @retval None
+  */
+void arm_biquad_cascade_df1_f32(const arm_biquad_casd_df1_inst_f32 *S, float32_t *pSrc, float32_t *pDst,
+		uint32_t blockSize)
+{
+	const float32_t *pCoeffs = S->pCoeffs;
+	float32_t *pState = S->pState;
+	float32_t *pIn = pSrc;
+
+	for (uint32_t stage = S->numStages; stage > 0U; stage--)
+	{
+		float32_t b0 = pCoeffs[0], b1 = pCoeffs[1], b2 = pCoeffs[2], a1 = pCoeffs[3], a2 = pCoeffs[4];
+		float32_t Xn1 = pState[0], Xn2 = pState[1], Yn1 = pState[2], Yn2 = pState[3];
+		float32_t *pOut = pDst;
+		float32_t Xn, acc;
+		uint32_t sample;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+		// Four samples at a time, rotating the roles of the state variables
+		// rather than moving them
+		for (sample = blockSize >> 2U; sample > 0U; sample--)
+		{
+			Xn = pIn[0];
+			Yn2 = (b0 * Xn) + (b1 * Xn1) + (b2 * Xn2) + (a1 * Yn1) + (a2 * Yn2);
+			pOut[0] = Yn2;
+
+			Xn2 = pIn[1];
+			Yn1 = (b0 * Xn2) + (b1 * Xn) + (b2 * Xn1) + (a1 * Yn2) + (a2 * Yn1);
+			pOut[1] = Yn1;
+
+			Xn1 = pIn[2];
+			Yn2 = (b0 * Xn1) + (b1 * Xn2) + (b2 * Xn) + (a1 * Yn1) + (a2 * Yn2);
+			pOut[2] = Yn2;
+
+			Xn = pIn[3];
+			Yn1 = (b0 * Xn) + (b1 * Xn1) + (b2 * Xn2) + (a1 * Yn2) + (a2 * Yn1);
+			pOut[3] = Yn1;
+
+			// Yn1 and Yn2 are y[n-1] and y[n-2] again, but the inputs have
+			// moved round by one
+			Xn2 = Xn1;
+			Xn1 = Xn;
+
+			pIn += 4U;
+			pOut += 4U;
+		}
+
+		sample = blockSize & 3U;
+
+#else
+
+		sample = blockSize;
+
+#endif /* ARM_MATH_CM0_FAMILY */
+
+		for (; sample > 0U; sample--)
+		{
+			Xn = *pIn++;
+			acc = (b0 * Xn) + (b1 * Xn1) + (b2 * Xn2) + (a1 * Yn1) + (a2 * Yn2);
+
+			Xn2 = Xn1;
+			Xn1 = Xn;
+			Yn2 = Yn1;
+			Yn1 = acc;
+
+			*pOut++ = acc;
+		}
+
+		pState[0] = Xn1;
+		pState[1] = Xn2;
+		pState[2] = Yn1;
+		pState[3] = Yn2;
+
+		// The next section filters the output of this one
+		pIn = pDst;
+		pCoeffs += 5U;
+		pState += 4U;
+	}
+}
@@ -0,0 +1,33 @@
+/**
+  ******************************************************************************
+  * @file    arm_biquad_cascade_df1_init_f32.c
+  * @brief   Initialisation of the floating point biquad cascade (arm_math.h).
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "arm_math.h"
+
+/**
+  * @brief  Set up a floating point biquad cascade in direct form I, clearing
+  * 		its state
+  *
+  * @param  S -> the instance
+  * @param  numStages -> second order sections
+  * @param  pCoeffs -> {b0, b1, b2, a1, a2} of each section, where the
+  * 		feedback coefficients are the negated denominator, so
+  * 		y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2]
+  * @param  pState -> 4 * numStages samples
+  *
+  * @retval None
+  */
+void arm_biquad_cascade_df1_init_f32(arm_biquad_casd_df1_inst_f32 *S, uint8_t numStages, float32_t *pCoeffs,
+		float32_t *pState)
+{
+	S->numStages = numStages;
+	S->pCoeffs = pCoeffs;
+	S->pState = pState;
+
+	memset(pState, 0, 4U * numStages * sizeof(float32_t));
+}
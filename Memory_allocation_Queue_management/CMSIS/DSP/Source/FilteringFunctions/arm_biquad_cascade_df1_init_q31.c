@@ -0,0 +1,35 @@
+/**
+  ******************************************************************************
+  * @file    arm_biquad_cascade_df1_init_q31.c
+  * @brief   Initialisation of the Q31 biquad cascade (arm_math.h).
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "arm_math.h"
+
+/**
+  * @brief  Set up a Q31 biquad cascade in direct form I, clearing its state
+  *
+  * @param  S -> the instance
+  * @param  numStages -> second order sections
+  * @param  pCoeffs -> {b0, b1, b2, a1, a2} of each section in 1.31, with
+  * 		the feedback coefficients negated as for the floating point
+  * 		cascade, each divided by 2^postShift to fit
+  * @param  pState -> 4 * numStages samples
+  * @param  postShift -> left shift of each section's output, undoing the
+  * 		scaling of its coefficients
+  *
+  * @retval None
+  */
+void arm_biquad_cascade_df1_init_q31(arm_biquad_casd_df1_inst_q31 *S, uint8_t numStages, q31_t *pCoeffs,
+		q31_t *pState, int8_t postShift)
+{
+	S->numStages = numStages;
+	S->pCoeffs = pCoeffs;
+	S->pState = pState;
+	S->postShift = (uint8_t) postShift;
+
+	memset(pState, 0, 4U * numStages * sizeof(q31_t));
+}
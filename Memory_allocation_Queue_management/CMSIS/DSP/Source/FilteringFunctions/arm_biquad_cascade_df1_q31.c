@@ -0,0 +1,105 @@
+/**
+  ******************************************************************************
+  * @file    arm_biquad_cascade_df1_q31.c
+  * @brief   Q31 biquad cascade in direct form I (arm_math.h).  The products
+  * 		 of each output are summed in a 2.62 accumulator with no saturation,
+  * 		 which the Cortex-M4 does with SMLAL, then shifted back to 1.31 by
+  * 		 31 - postShift, truncating.  The result is the same on any core.
+  ******************************************************************************
+*/
+
+#include "arm_math.h"
+
+/**
+  * @brief  Filter a block of samples.  pSrc and pDst may be the same, as
+  * 		each input is read before its output is written
+  *
+  * @param  S -> an instance set up by arm_biquad_cascade_df1_init_q31()
+  * @param  pSrc -> blockSize input samples
+  * @param  pDst -> blockSize output samples
+  * @param  blockSize -> samples to filter
+  *
+  * @retval None
+  */
+void arm_biquad_cascade_df1_q31(const arm_biquad_casd_df1_inst_q31 *S, q31_t *pSrc, q31_t *pDst,
+		uint32_t blockSize)
+{
+	const q31_t *pCoeffs = S->pCoeffs;
+	q31_t *pState = S->pState;
+	q31_t *pIn = pSrc;
+	uint32_t shift = 31U - S->postShift;
+
+	for (uint32_t stage = S->numStages; stage > 0U; stage--)
+	{
+		q31_t b0 = pCoeffs[0], b1 = pCoeffs[1], b2 = pCoeffs[2], a1 = pCoeffs[3], a2 = pCoeffs[4];
+		q31_t Xn1 = pState[0], Xn2 = pState[1], Yn1 = pState[2], Yn2 = pState[3];
+		q31_t *pOut = pDst;
+		q31_t Xn;
+		q63_t acc;
+		uint32_t sample;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+		// Four samples at a time, rotating the roles of the state variables
+		// as the floating point cascade does
+		for (sample = blockSize >> 2U; sample > 0U; sample--)
+		{
+			Xn = pIn[0];
+			acc = ((q63_t) b0 * Xn) + ((q63_t) b1 * Xn1) + ((q63_t) b2 * Xn2) + ((q63_t) a1 * Yn1) + ((q63_t) a2 * Yn2);
+			Yn2 = (q31_t) (acc >> shift);
+			pOut[0] = Yn2;
+
+			Xn2 = pIn[1];
+			acc = ((q63_t) b0 * Xn2) + ((q63_t) b1 * Xn) + ((q63_t) b2 * Xn1) + ((q63_t) a1 * Yn2) + ((q63_t) a2 * Yn1);
+			Yn1 = (q31_t) (acc >> shift);
+			pOut[1] = Yn1;
+
+			Xn1 = pIn[2];
+			acc = ((q63_t) b0 * Xn1) + ((q63_t) b1 * Xn2) + ((q63_t) b2 * Xn) + ((q63_t) a1 * Yn1) + ((q63_t) a2 * Yn2);
+			Yn2 = (q31_t) (acc >> shift);
+			pOut[2] = Yn2;
+
+			Xn = pIn[3];
+			acc = ((q63_t) b0 * Xn) + ((q63_t) b1 * Xn1) + ((q63_t) b2 * Xn2) + ((q63_t) a1 * Yn2) + ((q63_t) a2 * Yn1);
+			Yn1 = (q31_t) (acc >> shift);
+			pOut[3] = Yn1;
+
+			Xn2 = Xn1;
+			Xn1 = Xn;
+
+			pIn += 4U;
+			pOut += 4U;
+		}
+
+		sample = blockSize & 3U;
+
+#else
+
+		sample = blockSize;
+
+#endif /* ARM_MATH_CM0_FAMILY */
+
+		for (; sample > 0U; sample--)
+		{
+			Xn = *pIn++;
+			acc = ((q63_t) b0 * Xn) + ((q63_t) b1 * Xn1) + ((q63_t) b2 * Xn2) + ((q63_t) a1 * Yn1) + ((q63_t) a2 * Yn2);
+
+			Xn2 = Xn1;
+			Xn1 = Xn;
+			Yn2 = Yn1;
+			Yn1 = (q31_t) (acc >> shift);
+
+			*pOut++ = Yn1;
+		}
+
+		pState[0] = Xn1;
+		pState[1] = Xn2;
+		pState[2] = Yn1;
+		pState[3] = Yn2;
+
+		// The next section filters the output of this one
+		pIn = pDst;
+		pCoeffs += 5U;
+		pState += 4U;
+	}
+}
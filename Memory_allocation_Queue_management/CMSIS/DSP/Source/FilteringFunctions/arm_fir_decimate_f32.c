@@ -0,0 +1,78 @@
+/**
+  ******************************************************************************
+  * @file    arm_fir_decimate_f32.c
+  * @brief   Floating point FIR decimator (arm_math.h).  Only every Mth output
+  * 		 of the filter is computed: each takes M new samples into the state
+  * 		 and the window moves on by M.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "arm_math.h"
+
+/**
+  * @brief  Filter and decimate a block of samples
+  *
+  * @param  S -> an instance set up by arm_fir_decimate_init_f32()
+  * @param  pSrc -> blockSize input samples
+  * @param  pDst -> blockSize / M output samples
+  * @param  blockSize -> samples to filter, a multiple of M and at most the
+  * 		block size the instance was set up with
+  *
+  * @retval None
+  */
+void arm_fir_decimate_f32(const arm_fir_decimate_instance_f32 *S, float32_t *pSrc, float32_t *pDst,
+		uint32_t blockSize)
+{
+	float32_t *pState = S->pState;
+	float32_t *pStateCurnt = &S->pState[S->numTaps - 1U];
+	const float32_t *pCoeffs = S->pCoeffs;
+	uint32_t numTaps = S->numTaps;
+	uint32_t M = S->M;
+
+	for (uint32_t blkCnt = blockSize / M; blkCnt > 0U; blkCnt--)
+	{
+		const float32_t *px = pState;
+		const float32_t *pb = pCoeffs;
+		float32_t acc = 0.0f;
+		uint32_t tapCnt;
+
+		for (uint32_t i = 0U; i < M; i++)
+		{
+			*pStateCurnt++ = *pSrc++;
+		}
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+		// Four taps at a time, adding in tap order
+		for (tapCnt = numTaps >> 2U; tapCnt > 0U; tapCnt--)
+		{
+			acc += px[0] * pb[0];
+			acc += px[1] * pb[1];
+			acc += px[2] * pb[2];
+			acc += px[3] * pb[3];
+			px += 4U;
+			pb += 4U;
+		}
+
+		tapCnt = numTaps & 3U;
+
+#else
+
+		tapCnt = numTaps;
+
+#endif /* ARM_MATH_CM0_FAMILY */
+
+		for (; tapCnt > 0U; tapCnt--)
+		{
+			acc += *px++ * *pb++;
+		}
+
+		*pDst++ = acc;
+		pState += M;
+	}
+
+	// Keep the last numTaps - 1 samples for the next block
+	memmove(S->pState, pState, (numTaps - 1U) * sizeof(float32_t));
+}
@@ -0,0 +1,42 @@
+/**
+  ******************************************************************************
+  * @file    arm_fir_decimate_init_f32.c
+  * @brief   Initialisation of the floating point FIR decimator (arm_math.h).
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "arm_math.h"
+
+/**
+  * @brief  Set up a floating point FIR decimator, clearing its state
+  *
+  * @param  S -> the instance
+  * @param  numTaps -> number of coefficients
+  * @param  M -> decimation factor
+  * @param  pCoeffs -> numTaps coefficients in time reversed order
+  * @param  pState -> numTaps + blockSize - 1 samples
+  * @param  blockSize -> input samples given to each call of
+  * 		arm_fir_decimate_f32()
+  *
+  * @retval ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR if M does not divide
+  * 		blockSize
+  */
+arm_status arm_fir_decimate_init_f32(arm_fir_decimate_instance_f32 *S, uint16_t numTaps, uint8_t M,
+		float32_t *pCoeffs, float32_t *pState, uint32_t blockSize)
+{
+	if ((M == 0U) || ((blockSize % M) != 0U))
+	{
+		return ARM_MATH_LENGTH_ERROR;
+	}
+
+	S->numTaps = numTaps;
+	S->M = M;
+	S->pCoeffs = pCoeffs;
+	S->pState = pState;
+
+	memset(pState, 0, (numTaps + (blockSize - 1U)) * sizeof(float32_t));
+
+	return ARM_MATH_SUCCESS;
+}
@@ -0,0 +1,105 @@
+/**
+  ******************************************************************************
+  * @file    arm_fir_f32.c
+  * @brief   Floating point FIR filter (arm_math.h).  The state holds the last
+  * 		 numTaps - 1 samples of the previous block followed by the new
+  * 		 ones, so each output is a dot product of the coefficients with a
+  * 		 window of the state.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "arm_math.h"
+
+/**
+  * @brief  Filter a block of samples
+  *
+  * @param  S -> an instance set up by arm_fir_init_f32()
+  * @param  pSrc -> blockSize input samples
+  * @param  pDst -> blockSize output samples
+  * @param  blockSize -> samples to filter, at most the block size the
+  * 		instance was set up with
+  *
+  * @retval None
+  */
+void arm_fir_f32(const arm_fir_instance_f32 *S, float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+{
+	float32_t *pState = S->pState;
+	float32_t *pStateCurnt = &S->pState[S->numTaps - 1U];
+	const float32_t *pCoeffs = S->pCoeffs;
+	uint32_t numTaps = S->numTaps;
+	uint32_t blkCnt;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+	// Four outputs at a time, so each coefficient is loaded once for four
+	// multiplies and each sample of the window only once.  Every output still
+	// sums its products in tap order.
+	for (blkCnt = blockSize >> 2U; blkCnt > 0U; blkCnt--)
+	{
+		float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+		float32_t x0, x1, x2, x3, c0;
+		const float32_t *px = pState;
+
+		pStateCurnt[0] = pSrc[0];
+		pStateCurnt[1] = pSrc[1];
+		pStateCurnt[2] = pSrc[2];
+		pStateCurnt[3] = pSrc[3];
+		pStateCurnt += 4U;
+		pSrc += 4U;
+
+		x0 = px[0];
+		x1 = px[1];
+		x2 = px[2];
+		px += 3U;
+
+		for (uint32_t tap = 0U; tap < numTaps; tap++)
+		{
+			c0 = pCoeffs[tap];
+			x3 = *px++;
+
+			acc0 += x0 * c0;
+			acc1 += x1 * c0;
+			acc2 += x2 * c0;
+			acc3 += x3 * c0;
+
+			x0 = x1;
+			x1 = x2;
+			x2 = x3;
+		}
+
+		pDst[0] = acc0;
+		pDst[1] = acc1;
+		pDst[2] = acc2;
+		pDst[3] = acc3;
+		pDst += 4U;
+		pState += 4U;
+	}
+
+	blkCnt = blockSize & 3U;
+
+#else
+
+	blkCnt = blockSize;
+
+#endif /* ARM_MATH_CM0_FAMILY */
+
+	for (; blkCnt > 0U; blkCnt--)
+	{
+		float32_t acc = 0.0f;
+
+		*pStateCurnt++ = *pSrc++;
+
+		for (uint32_t tap = 0U; tap < numTaps; tap++)
+		{
+			acc += pState[tap] * pCoeffs[tap];
+		}
+
+		*pDst++ = acc;
+		pState++;
+	}
+
+	// Keep the last numTaps - 1 samples for the next block
+	memmove(S->pState, pState, (numTaps - 1U) * sizeof(float32_t));
+}
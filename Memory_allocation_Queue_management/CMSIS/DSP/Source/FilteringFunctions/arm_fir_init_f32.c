@@ -0,0 +1,32 @@
+/**
+  ******************************************************************************
+  * @file    arm_fir_init_f32.c
+  * @brief   Initialisation of the floating point FIR filter (arm_math.h).
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "arm_math.h"
+
+/**
+  * @brief  Set up a floating point FIR filter, clearing its state
+  *
+  * @param  S -> the instance
+  * @param  numTaps -> number of coefficients
+  * @param  pCoeffs -> numTaps coefficients in time reversed order,
+  * 		{b[numTaps - 1], ..., b[1], b[0]}
+  * @param  pState -> numTaps + blockSize - 1 samples
+  * @param  blockSize -> most samples given to each call of arm_fir_f32()
+  *
+  * @retval None
+  */
+void arm_fir_init_f32(arm_fir_instance_f32 *S, uint16_t numTaps, float32_t *pCoeffs, float32_t *pState,
+		uint32_t blockSize)
+{
+	S->numTaps = numTaps;
+	S->pCoeffs = pCoeffs;
+	S->pState = pState;
+
+	memset(pState, 0, (numTaps + (blockSize - 1U)) * sizeof(float32_t));
+}
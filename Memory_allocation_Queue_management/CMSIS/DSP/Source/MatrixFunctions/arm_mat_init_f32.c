@@ -0,0 +1,25 @@
+/**
+  ******************************************************************************
+  * @file    arm_mat_init_f32.c
+  * @brief   Initialisation of a floating point matrix (arm_math.h).
+  ******************************************************************************
+*/
+
+#include "arm_math.h"
+
+/**
+  * @brief  Set up a floating point matrix over its data
+  *
+  * @param  S -> the matrix
+  * @param  nRows -> rows
+  * @param  nColumns -> columns
+  * @param  pData -> nRows * nColumns elements, row by row
+  *
+  * @retval None
+  */
+void arm_mat_init_f32(arm_matrix_instance_f32 *S, uint16_t nRows, uint16_t nColumns, float32_t *pData)
+{
+	S->numRows = nRows;
+	S->numCols = nColumns;
+	S->pData = pData;
+}
@@ -0,0 +1,121 @@
+/**
+  ******************************************************************************
+  * @file    arm_mat_inverse_f32.c
+  * @brief   Inverse of a floating point matrix (arm_math.h) by Gauss-Jordan
+  * 		 elimination with partial pivoting.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "arm_math.h"
+
+/**
+  * @brief  Swap two rows of a matrix
+  *
+  * @param  pData -> the elements
+  * @param  numCols -> columns
+  * @param  a -> a row
+  * @param  b -> another row
+  *
+  * @retval None
+  */
+static void arm_mat_swap_rows_f32(float32_t *pData, uint32_t numCols, uint32_t a, uint32_t b)
+{
+	float32_t *pA = &pData[a * numCols];
+	float32_t *pB = &pData[b * numCols];
+
+	for (uint32_t col = 0U; col < numCols; col++)
+	{
+		float32_t tmp = pA[col];
+
+		pA[col] = pB[col];
+		pB[col] = tmp;
+	}
+}
+
+/**
+  * @brief  Invert a square matrix.  The source is reduced to the identity
+  * 		as the same row operations turn the destination from the identity
+  * 		into the inverse, so the source is overwritten, as in CMSIS-DSP
+  *
+  * @param  pSrc -> the matrix, N by N
+  * @param  pDst -> the inverse, N by N, which must not be the source
+  *
+  * @retval ARM_MATH_SUCCESS, ARM_MATH_SINGULAR if a column has no non-zero
+  * 		pivot, or ARM_MATH_SIZE_MISMATCH if the sizes do not match and
+  * 		ARM_MATH_MATRIX_CHECK is defined
+  */
+arm_status arm_mat_inverse_f32(const arm_matrix_instance_f32 *pSrc, arm_matrix_instance_f32 *pDst)
+{
+	float32_t *pIn = pSrc->pData;
+	float32_t *pOut = pDst->pData;
+	uint32_t n = pSrc->numRows;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+	if ((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols) || (pSrc->numRows != pDst->numRows))
+	{
+		return ARM_MATH_SIZE_MISMATCH;
+	}
+#endif /* ARM_MATH_MATRIX_CHECK */
+
+	memset(pOut, 0, n * n * sizeof(float32_t));
+	for (uint32_t i = 0U; i < n; i++)
+	{
+		pOut[(i * n) + i] = 1.0f;
+	}
+
+	for (uint32_t col = 0U; col < n; col++)
+	{
+		uint32_t pivot = col;
+		float32_t largest = fabsf(pIn[(col * n) + col]);
+		float32_t scale;
+
+		// The largest pivot left in the column keeps the rounding small
+		for (uint32_t row = col + 1U; row < n; row++)
+		{
+			if (fabsf(pIn[(row * n) + col]) > largest)
+			{
+				largest = fabsf(pIn[(row * n) + col]);
+				pivot = row;
+			}
+		}
+
+		if (largest == 0.0f)
+		{
+			return ARM_MATH_SINGULAR;
+		}
+
+		if (pivot != col)
+		{
+			arm_mat_swap_rows_f32(pIn, n, pivot, col);
+			arm_mat_swap_rows_f32(pOut, n, pivot, col);
+		}
+
+		scale = 1.0f / pIn[(col * n) + col];
+		for (uint32_t i = 0U; i < n; i++)
+		{
+			pIn[(col * n) + i] *= scale;
+			pOut[(col * n) + i] *= scale;
+		}
+
+		// Clear the column from every other row
+		for (uint32_t row = 0U; row < n; row++)
+		{
+			float32_t factor = pIn[(row * n) + col];
+
+			if ((row == col) || (factor == 0.0f))
+			{
+				continue;
+			}
+
+			for (uint32_t i = 0U; i < n; i++)
+			{
+				pIn[(row * n) + i] -= factor * pIn[(col * n) + i];
+				pOut[(row * n) + i] -= factor * pOut[(col * n) + i];
+			}
+		}
+	}
+
+	return ARM_MATH_SUCCESS;
+}
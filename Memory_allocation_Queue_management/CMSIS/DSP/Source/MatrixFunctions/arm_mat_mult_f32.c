@@ -0,0 +1,77 @@
+/**
+  ******************************************************************************
+  * @file    arm_mat_mult_f32.c
+  * @brief   Multiplication of floating point matrices (arm_math.h).
+  ******************************************************************************
+*/
+
+#include "arm_math.h"
+
+/**
+  * @brief  Multiply two matrices.  Each element of the result sums its
+  * 		products in order along the row of A and the column of B
+  *
+  * @param  pSrcA -> the first matrix, M by N
+  * @param  pSrcB -> the second matrix, N by P
+  * @param  pDst -> the result, M by P, which must not be either source
+  *
+  * @retval ARM_MATH_SUCCESS, or ARM_MATH_SIZE_MISMATCH if the sizes do not
+  * 		match and ARM_MATH_MATRIX_CHECK is defined
+  */
+arm_status arm_mat_mult_f32(const arm_matrix_instance_f32 *pSrcA, const arm_matrix_instance_f32 *pSrcB,
+		arm_matrix_instance_f32 *pDst)
+{
+	const float32_t *pInA = pSrcA->pData;
+	float32_t *pOut = pDst->pData;
+	uint32_t numRowsA = pSrcA->numRows, numColsA = pSrcA->numCols, numColsB = pSrcB->numCols;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+	if ((numColsA != pSrcB->numRows) || (numRowsA != pDst->numRows) || (numColsB != pDst->numCols))
+	{
+		return ARM_MATH_SIZE_MISMATCH;
+	}
+#endif /* ARM_MATH_MATRIX_CHECK */
+
+	for (uint32_t row = 0U; row < numRowsA; row++)
+	{
+		for (uint32_t col = 0U; col < numColsB; col++)
+		{
+			const float32_t *pA = pInA;
+			const float32_t *pB = &pSrcB->pData[col];
+			float32_t sum = 0.0f;
+			uint32_t colCnt;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+			for (colCnt = numColsA >> 2U; colCnt > 0U; colCnt--)
+			{
+				sum += pA[0] * pB[0];
+				sum += pA[1] * pB[numColsB];
+				sum += pA[2] * pB[2U * numColsB];
+				sum += pA[3] * pB[3U * numColsB];
+				pA += 4U;
+				pB += 4U * numColsB;
+			}
+
+			colCnt = numColsA & 3U;
+
+#else
+
+			colCnt = numColsA;
+
+#endif /* ARM_MATH_CM0_FAMILY */
+
+			for (; colCnt > 0U; colCnt--)
+			{
+				sum += *pA++ * *pB;
+				pB += numColsB;
+			}
+
+			*pOut++ = sum;
+		}
+
+		pInA += numColsA;
+	}
+
+	return ARM_MATH_SUCCESS;
+}
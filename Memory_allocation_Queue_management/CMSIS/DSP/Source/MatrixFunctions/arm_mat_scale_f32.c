@@ -0,0 +1,59 @@
+/**
+  ******************************************************************************
+  * @file    arm_mat_scale_f32.c
+  * @brief   Scaling of a floating point matrix (arm_math.h).
+  ******************************************************************************
+*/
+
+#include "arm_math.h"
+
+/**
+  * @brief  Multiply each element of a matrix by a scale
+  *
+  * @param  pSrc -> the matrix
+  * @param  scale -> the scale
+  * @param  pDst -> the result, the same size, which may be the source
+  *
+  * @retval ARM_MATH_SUCCESS, or ARM_MATH_SIZE_MISMATCH if the sizes differ
+  * 		and ARM_MATH_MATRIX_CHECK is defined
+  */
+arm_status arm_mat_scale_f32(const arm_matrix_instance_f32 *pSrc, float32_t scale, arm_matrix_instance_f32 *pDst)
+{
+	const float32_t *pIn = pSrc->pData;
+	float32_t *pOut = pDst->pData;
+	uint32_t blkCnt, numSamples = (uint32_t) pSrc->numRows * pSrc->numCols;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+	if ((pSrc->numRows != pDst->numRows) || (pSrc->numCols != pDst->numCols))
+	{
+		return ARM_MATH_SIZE_MISMATCH;
+	}
+#endif /* ARM_MATH_MATRIX_CHECK */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+	for (blkCnt = numSamples >> 2U; blkCnt > 0U; blkCnt--)
+	{
+		pOut[0] = pIn[0] * scale;
+		pOut[1] = pIn[1] * scale;
+		pOut[2] = pIn[2] * scale;
+		pOut[3] = pIn[3] * scale;
+		pIn += 4U;
+		pOut += 4U;
+	}
+
+	blkCnt = numSamples & 3U;
+
+#else
+
+	blkCnt = numSamples;
+
+#endif /* ARM_MATH_CM0_FAMILY */
+
+	for (; blkCnt > 0U; blkCnt--)
+	{
+		*pOut++ = *pIn++ * scale;
+	}
+
+	return ARM_MATH_SUCCESS;
+}
@@ -0,0 +1,63 @@
+/**
+  ******************************************************************************
+  * @file    arm_mat_sub_f32.c
+  * @brief   Subtraction of floating point matrices (arm_math.h).
+  ******************************************************************************
+*/
+
+#include "arm_math.h"
+
+/**
+  * @brief  Subtract the second matrix from the first element by element
+  *
+  * @param  pSrcA -> the first matrix
+  * @param  pSrcB -> the second matrix, the same size
+  * @param  pDst -> the result, the same size, which may be either source
+  *
+  * @retval ARM_MATH_SUCCESS, or ARM_MATH_SIZE_MISMATCH if the sizes differ
+  * 		and ARM_MATH_MATRIX_CHECK is defined
+  */
+arm_status arm_mat_sub_f32(const arm_matrix_instance_f32 *pSrcA, const arm_matrix_instance_f32 *pSrcB,
+		arm_matrix_instance_f32 *pDst)
+{
+	const float32_t *pInA = pSrcA->pData;
+	const float32_t *pInB = pSrcB->pData;
+	float32_t *pOut = pDst->pData;
+	uint32_t blkCnt, numSamples = (uint32_t) pSrcA->numRows * pSrcA->numCols;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+	if ((pSrcA->numRows != pSrcB->numRows) || (pSrcA->numCols != pSrcB->numCols) ||
+			(pSrcA->numRows != pDst->numRows) || (pSrcA->numCols != pDst->numCols))
+	{
+		return ARM_MATH_SIZE_MISMATCH;
+	}
+#endif /* ARM_MATH_MATRIX_CHECK */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+	for (blkCnt = numSamples >> 2U; blkCnt > 0U; blkCnt--)
+	{
+		pOut[0] = pInA[0] - pInB[0];
+		pOut[1] = pInA[1] - pInB[1];
+		pOut[2] = pInA[2] - pInB[2];
+		pOut[3] = pInA[3] - pInB[3];
+		pInA += 4U;
+		pInB += 4U;
+		pOut += 4U;
+	}
+
+	blkCnt = numSamples & 3U;
+
+#else
+
+	blkCnt = numSamples;
+
+#endif /* ARM_MATH_CM0_FAMILY */
+
+	for (; blkCnt > 0U; blkCnt--)
+	{
+		*pOut++ = *pInA++ - *pInB++;
+	}
+
+	return ARM_MATH_SUCCESS;
+}
@@ -0,0 +1,45 @@
+/**
+  ******************************************************************************
+  * @file    arm_mat_trans_f32.c
+  * @brief   Transpose of a floating point matrix (arm_math.h).
+  ******************************************************************************
+*/
+
+#include "arm_math.h"
+
+/**
+  * @brief  Transpose a matrix
+  *
+  * @param  pSrc -> the matrix
+  * @param  pDst -> the result, with the rows and columns swapped, which must
+  * 		not be the source
+  *
+  * @retval ARM_MATH_SUCCESS, or ARM_MATH_SIZE_MISMATCH if the sizes do not
+  * 		match and ARM_MATH_MATRIX_CHECK is defined
+  */
+arm_status arm_mat_trans_f32(const arm_matrix_instance_f32 *pSrc, arm_matrix_instance_f32 *pDst)
+{
+	const float32_t *pIn = pSrc->pData;
+	uint32_t nRows = pSrc->numRows, nCols = pSrc->numCols;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+	if ((nRows != pDst->numCols) || (nCols != pDst->numRows))
+	{
+		return ARM_MATH_SIZE_MISMATCH;
+	}
+#endif /* ARM_MATH_MATRIX_CHECK */
+
+	// Each row of the source is read in order and written down a column
+	for (uint32_t row = 0U; row < nRows; row++)
+	{
+		float32_t *pOut = &pDst->pData[row];
+
+		for (uint32_t col = 0U; col < nCols; col++)
+		{
+			*pOut = *pIn++;
+			pOut += nRows;
+		}
+	}
+
+	return ARM_MATH_SUCCESS;
+}
@@ -0,0 +1,166 @@
+/**
+  ******************************************************************************
+  * @file    arm_cfft_f32.c
+  * @brief   Floating point complex FFT (arm_math.h) of 16 to 4096 points, in
+  * 		 place on interleaved real and imaginary parts.  Decimation in
+  * 		 frequency runs radix 4 stages, each two radix 2 stages in one pass
+  * 		 over the data, with a last radix 2 stage when the length is an odd
+  * 		 power of 2.  The outputs of each radix 4 butterfly are stored so
+  * 		 the result is in plain bit reversed order, which the instance's
+  * 		 table then puts right.
+  ******************************************************************************
+*/
+
+#include "arm_math.h"
+
+/**
+  * @brief  Run the butterflies of every stage
+  *
+  * @param  p1 -> fftLen complex samples
+  * @param  fftLen -> points, a power of 2
+  * @param  pTwiddle -> cos and sin of 2 * pi * i / fftLen for each i
+  *
+  * @retval None
+  */
+static void arm_cfft_dif_f32(float32_t *p1, uint32_t fftLen, const float32_t *pTwiddle)
+{
+	uint32_t span, quarter, step, group, j;
+
+	// Each radix 4 stage splits groups of span points into four.  The
+	// twiddles of a group of span points are every (fftLen / span)th one.
+	for (span = fftLen, step = 1U; span >= 4U; span >>= 2U, step <<= 2U)
+	{
+		quarter = span >> 2U;
+
+		for (j = 0U; j < quarter; j++)
+		{
+			float32_t co1 = pTwiddle[2U * j * step], si1 = pTwiddle[(2U * j * step) + 1U];
+			float32_t co2 = pTwiddle[4U * j * step], si2 = pTwiddle[(4U * j * step) + 1U];
+			float32_t co3 = pTwiddle[6U * j * step], si3 = pTwiddle[(6U * j * step) + 1U];
+
+			for (group = j; group < fftLen; group += span)
+			{
+				float32_t *x0 = &p1[2U * group];
+				float32_t *x1 = x0 + (2U * quarter);
+				float32_t *x2 = x1 + (2U * quarter);
+				float32_t *x3 = x2 + (2U * quarter);
+				float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i, ur, ui;
+
+				t0r = x0[0] + x2[0];
+				t0i = x0[1] + x2[1];
+				t1r = x0[0] - x2[0];
+				t1i = x0[1] - x2[1];
+				t2r = x1[0] + x3[0];
+				t2i = x1[1] + x3[1];
+				t3r = x1[0] - x3[0];
+				t3i = x1[1] - x3[1];
+
+				// X0 = t0 + t2
+				x0[0] = t0r + t2r;
+				x0[1] = t0i + t2i;
+
+				// X2, second in bit reversed order: (t0 - t2) W^2j
+				ur = t0r - t2r;
+				ui = t0i - t2i;
+				x1[0] = (ur * co2) + (ui * si2);
+				x1[1] = (ui * co2) - (ur * si2);
+
+				// X1: (t1 - i t3) W^j
+				ur = t1r + t3i;
+				ui = t1i - t3r;
+				x2[0] = (ur * co1) + (ui * si1);
+				x2[1] = (ui * co1) - (ur * si1);
+
+				// X3: (t1 + i t3) W^3j
+				ur = t1r - t3i;
+				ui = t1i + t3r;
+				x3[0] = (ur * co3) + (ui * si3);
+				x3[1] = (ui * co3) - (ur * si3);
+			}
+		}
+	}
+
+	// An odd power of 2 leaves pairs, whose twiddle is 1
+	if (span == 2U)
+	{
+		for (group = 0U; group < fftLen; group += 2U)
+		{
+			float32_t *x0 = &p1[2U * group];
+			float32_t ar = x0[0], ai = x0[1];
+
+			x0[0] = ar + x0[2];
+			x0[1] = ai + x0[3];
+			x0[2] = ar - x0[2];
+			x0[3] = ai - x0[3];
+		}
+	}
+}
+
+/**
+  * @brief  Swap each pair of complex samples in a bit reversal table
+  *
+  * @param  pSrc -> the complex samples, each as two words
+  * @param  bitRevLen -> entries in the table
+  * @param  pBitRevTab -> pairs of byte offsets of the samples to swap
+  *
+  * @retval None
+  */
+static void arm_bitreversal_32(uint32_t *pSrc, uint16_t bitRevLen, const uint16_t *pBitRevTab)
+{
+	for (uint32_t i = 0U; i < bitRevLen; i += 2U)
+	{
+		uint32_t a = pBitRevTab[i] >> 2U;
+		uint32_t b = pBitRevTab[i + 1U] >> 2U;
+		uint32_t tmp;
+
+		tmp = pSrc[a];
+		pSrc[a] = pSrc[b];
+		pSrc[b] = tmp;
+
+		tmp = pSrc[a + 1U];
+		pSrc[a + 1U] = pSrc[b + 1U];
+		pSrc[b + 1U] = tmp;
+	}
+}
+
+/**
+  * @brief  Transform complex samples in place.  The inverse is the forward
+  * 		transform of the conjugate, conjugated and divided by fftLen
+  *
+  * @param  S -> arm_cfft_sR_f32_len16 to arm_cfft_sR_f32_len4096
+  * @param  p1 -> fftLen complex samples, real then imaginary
+  * @param  ifftFlag -> 1 for the inverse transform
+  * @param  bitReverseFlag -> 0 to leave the output in bit reversed order
+  *
+  * @retval None
+  */
+void arm_cfft_f32(const arm_cfft_instance_f32 *S, float32_t *p1, uint8_t ifftFlag, uint8_t bitReverseFlag)
+{
+	uint32_t fftLen = S->fftLen;
+
+	if (ifftFlag == 1U)
+	{
+		for (uint32_t i = 0U; i < fftLen; i++)
+		{
+			p1[(2U * i) + 1U] = -p1[(2U * i) + 1U];
+		}
+	}
+
+	arm_cfft_dif_f32(p1, fftLen, S->pTwiddle);
+
+	if (bitReverseFlag == 1U)
+	{
+		arm_bitreversal_32((uint32_t *) p1, S->bitRevLength, S->pBitRevTable);
+	}
+
+	if (ifftFlag == 1U)
+	{
+		float32_t invL = 1.0f / (float32_t) fftLen;
+
+		for (uint32_t i = 0U; i < fftLen; i++)
+		{
+			p1[2U * i] *= invL;
+			p1[(2U * i) + 1U] *= -invL;
+		}
+	}
+}
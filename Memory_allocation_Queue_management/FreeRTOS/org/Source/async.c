@@ -0,0 +1,692 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "multi_wait.h"
+#include "async.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+for the header files above, but not in this file, in order to generate the
+correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+to include async functionality.  This #if is closed at the very bottom of this
+file.  If you want to include the async executor then ensure configUSE_ASYNC is
+set to 1 in FreeRTOSConfig.h. */
+#if( configUSE_ASYNC == 1 )
+
+typedef struct AsyncExecutorDefinition
+{
+	List_t xReadyContexts;					/*< Contexts that run the next time the executor runs its contexts. */
+	List_t xWaitingContexts;				/*< Contexts that are waiting for an object, a notification or a delay. */
+	AsyncContext_t *pxNotifiedContexts;		/*< Contexts started or notified since the executor last checked.  Protected by critical sections. */
+	QueueHandle_t xDoorbell;				/*< Given to wake the executor when a context is started or notified. */
+	TaskHandle_t xTask;						/*< The task that runs the contexts. */
+	TickType_t xLastScanTime;				/*< The tick count when the waiting contexts were last checked. */
+	MultiWaitObject_t *pxWaitObjects;		/*< Storage for the objects the executor blocks on, the doorbell first. */
+	UBaseType_t uxMaxWaitObjects;
+} AsyncExecutor_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The function implemented by each executor task.
+ */
+static portTASK_FUNCTION_PROTO( prvExecutorTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Link pxContext into the list of contexts its executor must check.  Returns
+ * pdTRUE if the context was not already linked.  Must be called from a
+ * critical section.
+ */
+static BaseType_t prvQueueForExecutor( AsyncContext_t *pxContext ) PRIVILEGED_FUNCTION;
+
+/*
+ * Make the contexts that were started, and those that were notified while
+ * waiting for a notification, ready to run.  Notifications are therefore
+ * handled without checking every waiting context.
+ */
+static void prvProcessNotifiedContexts( AsyncExecutor_t *pxExecutor ) PRIVILEGED_FUNCTION;
+
+/*
+ * Make each waiting context whose wait is satisfied, or has timed out, ready
+ * to run.  Contexts that poll are only made ready if xNewTick is pdTRUE.
+ * Returns the number of ticks until the next waiting context times out, or
+ * portMAX_DELAY if none of them can time out.
+ */
+static TickType_t prvScanWaitingContexts( AsyncExecutor_t *pxExecutor, TickType_t xTimeNow, BaseType_t xNewTick ) PRIVILEGED_FUNCTION;
+
+/*
+ * Run each context that is ready once.
+ */
+static void prvRunReadyContexts( AsyncExecutor_t *pxExecutor ) PRIVILEGED_FUNCTION;
+
+/*
+ * Block the executor task on its doorbell and on the objects its contexts are
+ * waiting for, for at most xTicksToWait ticks.
+ */
+static void prvBlockExecutor( AsyncExecutor_t *pxExecutor, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the number of ticks left before the wait of pxContext times out.
+ */
+static TickType_t prvTicksRemaining( const AsyncContext_t *pxContext, TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+AsyncExecutorHandle_t xAsyncExecutorCreate( UBaseType_t uxMaxWaitObjects, configSTACK_DEPTH_TYPE usStackDepth, UBaseType_t uxPriority )
+{
+AsyncExecutor_t *pxExecutor;
+
+	/* The objects the executor blocks on follow the executor structure in the
+	same allocation.  One extra object is needed for the doorbell. */
+	pxExecutor = ( AsyncExecutor_t * ) pvPortMalloc( sizeof( AsyncExecutor_t ) + ( ( uxMaxWaitObjects + 1U ) * sizeof( MultiWaitObject_t ) ) ); /*lint !e9079 !e9087 Storage is cast to the structure it holds. */
+
+	if( pxExecutor != NULL )
+	{
+		vListInitialise( &( pxExecutor->xReadyContexts ) );
+		vListInitialise( &( pxExecutor->xWaitingContexts ) );
+		pxExecutor->pxNotifiedContexts = NULL;
+		pxExecutor->xTask = NULL;
+		pxExecutor->xLastScanTime = ( TickType_t ) 0U;
+		pxExecutor->pxWaitObjects = ( MultiWaitObject_t * ) &( pxExecutor[ 1 ] ); /*lint !e9087 The objects follow the executor in the same allocation. */
+		pxExecutor->uxMaxWaitObjects = uxMaxWaitObjects;
+		pxExecutor->xDoorbell = xSemaphoreCreateBinary();
+
+		if( pxExecutor->xDoorbell != NULL )
+		{
+			if( xTaskCreate( prvExecutorTask, "Async", usStackDepth, ( void * ) pxExecutor, uxPriority, &( pxExecutor->xTask ) ) != pdPASS )
+			{
+				vSemaphoreDelete( pxExecutor->xDoorbell );
+				vPortFree( pxExecutor );
+				pxExecutor = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			vPortFree( pxExecutor );
+			pxExecutor = NULL;
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxExecutor;
+}
+/*-----------------------------------------------------------*/
+
+void vAsyncContextStart( AsyncExecutorHandle_t xExecutor, AsyncContext_t *pxContext, AsyncFunction_t pxFunction, void *pvParameters )
+{
+AsyncExecutor_t * const pxExecutor = xExecutor;
+
+	configASSERT( pxExecutor );
+	configASSERT( pxContext );
+	configASSERT( pxFunction );
+
+	vListInitialiseItem( &( pxContext->xStateListItem ) );
+	listSET_LIST_ITEM_OWNER( &( pxContext->xStateListItem ), pxContext );
+	pxContext->pxFunction = pxFunction;
+	pxContext->pvParameters = pvParameters;
+	pxContext->pxExecutor = pxExecutor;
+	pxContext->pxNextNotified = NULL;
+	pxContext->pvWaitObject = NULL;
+	pxContext->ulNotifiedValue = 0UL;
+	pxContext->usResumePoint = ( uint16_t ) 0U;
+	pxContext->ucNotified = ( uint8_t ) pdFALSE;
+	pxContext->ucQueuedForExecutor = ( uint8_t ) pdFALSE;
+
+	/* The executor makes a context that is not in any of its lists, and has
+	not finished, ready to run. */
+	taskENTER_CRITICAL();
+	{
+		pxContext->ucWaitType = asyncWAIT_YIELD;
+		( void ) prvQueueForExecutor( pxContext );
+	}
+	taskEXIT_CRITICAL();
+
+	if( xTaskGetCurrentTaskHandle() != pxExecutor->xTask )
+	{
+		( void ) xSemaphoreGive( pxExecutor->xDoorbell );
+	}
+	else
+	{
+		/* The executor checks for new contexts each time it has run its ready
+		contexts. */
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAsyncContextIsFinished( const AsyncContext_t *pxContext )
+{
+BaseType_t xReturn;
+
+	configASSERT( pxContext );
+
+	taskENTER_CRITICAL();
+	{
+		if( ( pxContext->ucWaitType == asyncWAIT_FINISHED ) && ( pxContext->ucQueuedForExecutor == ( uint8_t ) pdFALSE ) )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vAsyncNotify( AsyncContext_t *pxContext, uint32_t ulBitsToSet )
+{
+BaseType_t xWakeExecutor = pdFALSE;
+
+	configASSERT( pxContext );
+	configASSERT( pxContext->pxExecutor );
+
+	taskENTER_CRITICAL();
+	{
+		if( pxContext->ucWaitType != asyncWAIT_FINISHED )
+		{
+			pxContext->ulNotifiedValue |= ulBitsToSet;
+			pxContext->ucNotified = ( uint8_t ) pdTRUE;
+			xWakeExecutor = prvQueueForExecutor( pxContext );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if( ( xWakeExecutor != pdFALSE ) && ( xTaskGetCurrentTaskHandle() != pxContext->pxExecutor->xTask ) )
+	{
+		( void ) xSemaphoreGive( pxContext->pxExecutor->xDoorbell );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vAsyncNotifyFromISR( AsyncContext_t *pxContext, uint32_t ulBitsToSet, BaseType_t *pxHigherPriorityTaskWoken )
+{
+BaseType_t xWakeExecutor = pdFALSE;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxContext );
+	configASSERT( pxContext->pxExecutor );
+
+	/* See the comments in xQueueGenericSendFromISR(). */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+	{
+		if( pxContext->ucWaitType != asyncWAIT_FINISHED )
+		{
+			pxContext->ulNotifiedValue |= ulBitsToSet;
+			pxContext->ucNotified = ( uint8_t ) pdTRUE;
+			xWakeExecutor = prvQueueForExecutor( pxContext );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+	if( xWakeExecutor != pdFALSE )
+	{
+		( void ) xSemaphoreGiveFromISR( pxContext->pxExecutor->xDoorbell, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vAsyncStartWait( AsyncContext_t *pxContext, TickType_t xTicksToWait )
+{
+	pxContext->xWaitStart = xTaskGetTickCount();
+	pxContext->xWaitTicks = xTicksToWait;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAsyncSuspend( AsyncContext_t *pxContext, uint8_t ucWaitType, void *pvWaitObject, EventBits_t uxWaitBits, BaseType_t xWaitForAllBits )
+{
+BaseType_t xReturn;
+
+	if( prvTicksRemaining( pxContext, xTaskGetTickCount() ) == ( TickType_t ) 0U )
+	{
+		/* The wait has timed out, or was not allowed to block.  The context
+		continues from the macro. */
+		xReturn = pdFALSE;
+	}
+	else
+	{
+		/* The context function returns to the executor, which places the
+		context in its waiting list. */
+		pxContext->ucWaitType = ucWaitType;
+		pxContext->pvWaitObject = pvWaitObject;
+		pxContext->uxWaitBits = uxWaitBits;
+		pxContext->ucWaitForAllBits = ( uint8_t ) xWaitForAllBits;
+		xReturn = pdTRUE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAsyncNotifyTake( AsyncContext_t *pxContext, uint32_t *pulNotifiedValue )
+{
+BaseType_t xReturn = pdFAIL;
+
+	taskENTER_CRITICAL();
+	{
+		if( pxContext->ucNotified != ( uint8_t ) pdFALSE )
+		{
+			if( pulNotifiedValue != NULL )
+			{
+				*pulNotifiedValue = pxContext->ulNotifiedValue;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxContext->ulNotifiedValue = 0UL;
+			pxContext->ucNotified = ( uint8_t ) pdFALSE;
+			xReturn = pdPASS;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAsyncEventBitsMatch( EventBits_t uxBits, EventBits_t uxBitsToWaitFor, BaseType_t xWaitForAllBits )
+{
+BaseType_t xReturn;
+
+	if( xWaitForAllBits == pdFALSE )
+	{
+		xReturn = ( ( uxBits & uxBitsToWaitFor ) != ( EventBits_t ) 0 ) ? pdTRUE : pdFALSE;
+	}
+	else
+	{
+		xReturn = ( ( uxBits & uxBitsToWaitFor ) == uxBitsToWaitFor ) ? pdTRUE : pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static portTASK_FUNCTION( prvExecutorTask, pvParameters )
+{
+AsyncExecutor_t * const pxExecutor = ( AsyncExecutor_t * ) pvParameters;
+TickType_t xTimeNow, xTicksToWait = portMAX_DELAY;
+BaseType_t xNewTick;
+
+	pxExecutor->xLastScanTime = xTaskGetTickCount();
+
+	for( ;; )
+	{
+		/* The doorbell is only a wake up, so is cleared before the notified
+		contexts are checked rather than after. */
+		( void ) xSemaphoreTake( pxExecutor->xDoorbell, 0 );
+		prvProcessNotifiedContexts( pxExecutor );
+
+		/* Checking every waiting context is O(n), so is only done once per
+		tick while there are contexts ready to run, and before blocking. */
+		xTimeNow = xTaskGetTickCount();
+		xNewTick = ( xTimeNow != pxExecutor->xLastScanTime ) ? pdTRUE : pdFALSE;
+
+		if( ( xNewTick != pdFALSE ) || ( listLIST_IS_EMPTY( &( pxExecutor->xReadyContexts ) ) != pdFALSE ) )
+		{
+			xTicksToWait = prvScanWaitingContexts( pxExecutor, xTimeNow, xNewTick );
+			pxExecutor->xLastScanTime = xTimeNow;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( listLIST_IS_EMPTY( &( pxExecutor->xReadyContexts ) ) == pdFALSE )
+		{
+			prvRunReadyContexts( pxExecutor );
+		}
+		else if( xTicksToWait != ( TickType_t ) 0U )
+		{
+			prvBlockExecutor( pxExecutor, xTicksToWait );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvQueueForExecutor( AsyncContext_t *pxContext )
+{
+AsyncExecutor_t * const pxExecutor = pxContext->pxExecutor;
+BaseType_t xReturn;
+
+	if( pxContext->ucQueuedForExecutor == ( uint8_t ) pdFALSE )
+	{
+		pxContext->pxNextNotified = pxExecutor->pxNotifiedContexts;
+		pxExecutor->pxNotifiedContexts = pxContext;
+		pxContext->ucQueuedForExecutor = ( uint8_t ) pdTRUE;
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessNotifiedContexts( AsyncExecutor_t *pxExecutor )
+{
+AsyncContext_t *pxContext, *pxNext;
+List_t const *pxContainer;
+
+	taskENTER_CRITICAL();
+	{
+		pxContext = pxExecutor->pxNotifiedContexts;
+		pxExecutor->pxNotifiedContexts = NULL;
+	}
+	taskEXIT_CRITICAL();
+
+	while( pxContext != NULL )
+	{
+		/* Once the flag is clear the context can be linked into the list
+		again, which changes pxNextNotified. */
+		taskENTER_CRITICAL();
+		{
+			pxNext = pxContext->pxNextNotified;
+			pxContext->ucQueuedForExecutor = ( uint8_t ) pdFALSE;
+		}
+		taskEXIT_CRITICAL();
+
+		pxContainer = listLIST_ITEM_CONTAINER( &( pxContext->xStateListItem ) );
+
+		if( ( pxContainer == NULL ) && ( pxContext->ucWaitType != asyncWAIT_FINISHED ) )
+		{
+			/* A context that has just been started. */
+			vListInsertEnd( &( pxExecutor->xReadyContexts ), &( pxContext->xStateListItem ) );
+		}
+		else if( ( pxContainer == &( pxExecutor->xWaitingContexts ) ) && ( pxContext->ucWaitType == asyncWAIT_NOTIFICATION ) )
+		{
+			( void ) uxListRemove( &( pxContext->xStateListItem ) );
+			vListInsertEnd( &( pxExecutor->xReadyContexts ), &( pxContext->xStateListItem ) );
+		}
+		else
+		{
+			/* The notification is kept until the context waits for it. */
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxContext = pxNext;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvScanWaitingContexts( AsyncExecutor_t *pxExecutor, TickType_t xTimeNow, BaseType_t xNewTick )
+{
+ListItem_t const *pxEnd = listGET_END_MARKER( &( pxExecutor->xWaitingContexts ) );
+ListItem_t *pxItem = listGET_HEAD_ENTRY( &( pxExecutor->xWaitingContexts ) );
+AsyncContext_t *pxContext;
+TickType_t xTicksToWait = portMAX_DELAY, xRemaining;
+BaseType_t xReady;
+
+	while( pxItem != pxEnd )
+	{
+		pxContext = ( AsyncContext_t * ) listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9087 The owner is always a context. */
+		pxItem = listGET_NEXT( pxItem );
+		xRemaining = prvTicksRemaining( pxContext, xTimeNow );
+
+		if( xRemaining == ( TickType_t ) 0U )
+		{
+			xReady = pdTRUE;
+		}
+		else
+		{
+			switch( pxContext->ucWaitType )
+			{
+				case asyncWAIT_QUEUE :
+					xReady = ( uxQueueMessagesWaiting( ( QueueHandle_t ) pxContext->pvWaitObject ) != ( UBaseType_t ) 0U ) ? pdTRUE : pdFALSE;
+					break;
+
+				case asyncWAIT_EVENT_GROUP :
+					xReady = xAsyncEventBitsMatch( xEventGroupGetBits( ( EventGroupHandle_t ) pxContext->pvWaitObject ), pxContext->uxWaitBits, ( BaseType_t ) pxContext->ucWaitForAllBits );
+					break;
+
+				case asyncWAIT_NOTIFICATION :
+					xReady = ( pxContext->ucNotified != ( uint8_t ) pdFALSE ) ? pdTRUE : pdFALSE;
+					break;
+
+				case asyncWAIT_POLL :
+					/* Retried once per tick. */
+					xReady = xNewTick;
+					xRemaining = ( TickType_t ) 1U;
+					break;
+
+				default :
+					/* A delay, which only ends when it times out. */
+					xReady = pdFALSE;
+					break;
+			}
+		}
+
+		if( xReady != pdFALSE )
+		{
+			( void ) uxListRemove( &( pxContext->xStateListItem ) );
+			vListInsertEnd( &( pxExecutor->xReadyContexts ), &( pxContext->xStateListItem ) );
+		}
+		else if( xRemaining < xTicksToWait )
+		{
+			xTicksToWait = xRemaining;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return xTicksToWait;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRunReadyContexts( AsyncExecutor_t *pxExecutor )
+{
+UBaseType_t uxContextsToRun = listCURRENT_LIST_LENGTH( &( pxExecutor->xReadyContexts ) );
+AsyncContext_t *pxContext;
+
+	/* Contexts that yield are placed at the end of the list, and are not run
+	again until the executor has checked for notifications. */
+	while( uxContextsToRun > ( UBaseType_t ) 0U )
+	{
+		uxContextsToRun--;
+		pxContext = ( AsyncContext_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( pxExecutor->xReadyContexts ) ); /*lint !e9087 The owner is always a context. */
+		( void ) uxListRemove( &( pxContext->xStateListItem ) );
+
+		/* The context sets the wait type if it returns from one of the async
+		macros.  If it returns any other way it has finished. */
+		pxContext->ucWaitType = asyncWAIT_RUNNING;
+		pxContext->pxFunction( pxContext );
+
+		if( pxContext->ucWaitType == asyncWAIT_RUNNING )
+		{
+			/* Marked in a critical section so notifications sent to the
+			context from now on are discarded. */
+			taskENTER_CRITICAL();
+			{
+				pxContext->ucWaitType = asyncWAIT_FINISHED;
+			}
+			taskEXIT_CRITICAL();
+		}
+		else if( pxContext->ucWaitType == asyncWAIT_YIELD )
+		{
+			vListInsertEnd( &( pxExecutor->xReadyContexts ), &( pxContext->xStateListItem ) );
+		}
+		else
+		{
+			vListInsertEnd( &( pxExecutor->xWaitingContexts ), &( pxContext->xStateListItem ) );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBlockExecutor( AsyncExecutor_t *pxExecutor, TickType_t xTicksToWait )
+{
+ListItem_t const *pxEnd = listGET_END_MARKER( &( pxExecutor->xWaitingContexts ) );
+ListItem_t *pxItem;
+MultiWaitObject_t * const pxObjects = pxExecutor->pxWaitObjects;
+AsyncContext_t *pxContext;
+UBaseType_t uxObjectCount = ( UBaseType_t ) 1U, ux;
+
+	vMultiWaitSetSemaphore( &( pxObjects[ 0 ] ), pxExecutor->xDoorbell );
+
+	for( pxItem = listGET_HEAD_ENTRY( &( pxExecutor->xWaitingContexts ) ); pxItem != pxEnd; pxItem = listGET_NEXT( pxItem ) )
+	{
+		pxContext = ( AsyncContext_t * ) listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9087 The owner is always a context. */
+
+		if( ( pxContext->ucWaitType == asyncWAIT_QUEUE ) || ( pxContext->ucWaitType == asyncWAIT_EVENT_GROUP ) )
+		{
+			/* Each object is only added once.  Where several contexts wait
+			for different bits in the same event group the executor wakes when
+			any of the bits are set, and checks the contexts itself. */
+			for( ux = ( UBaseType_t ) 1U; ux < uxObjectCount; ux++ )
+			{
+				if( pxObjects[ ux ].pvObject == pxContext->pvWaitObject )
+				{
+					pxObjects[ ux ].uxBitsToWaitFor |= pxContext->uxWaitBits;
+					pxObjects[ ux ].xWaitForAllBits = pdFALSE;
+					break;
+				}
+			}
+
+			if( ux < uxObjectCount )
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+			else if( uxObjectCount <= pxExecutor->uxMaxWaitObjects )
+			{
+				if( pxContext->ucWaitType == asyncWAIT_QUEUE )
+				{
+					vMultiWaitSetQueue( &( pxObjects[ uxObjectCount ] ), pxContext->pvWaitObject );
+				}
+				else
+				{
+					vMultiWaitSetEventGroup( &( pxObjects[ uxObjectCount ] ), pxContext->pvWaitObject, pxContext->uxWaitBits, ( BaseType_t ) pxContext->ucWaitForAllBits );
+				}
+
+				uxObjectCount++;
+			}
+			else
+			{
+				/* Too many objects to block on, so poll them instead. */
+				xTicksToWait = ( TickType_t ) 1U;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	/* Which object became available does not matter, as the waiting contexts
+	are checked again when the executor wakes. */
+	( void ) xMultiWaitForAny( pxObjects, uxObjectCount, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvTicksRemaining( const AsyncContext_t *pxContext, TickType_t xTimeNow )
+{
+TickType_t xElapsed, xReturn;
+
+	if( pxContext->xWaitTicks == portMAX_DELAY )
+	{
+		xReturn = portMAX_DELAY;
+	}
+	else
+	{
+		/* Unsigned arithmetic handles the tick count overflowing. */
+		xElapsed = xTimeNow - pxContext->xWaitStart;
+
+		if( xElapsed >= pxContext->xWaitTicks )
+		{
+			xReturn = ( TickType_t ) 0U;
+		}
+		else
+		{
+			xReturn = pxContext->xWaitTicks - xElapsed;
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include async functionality.  If you want to include the async executor then
+ensure configUSE_ASYNC is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_ASYNC == 1 */
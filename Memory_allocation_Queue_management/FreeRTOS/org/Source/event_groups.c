@@ -506,11 +506,11 @@ UBaseType_t uxSavedInterruptStatus;
 EventGroup_t const * const pxEventBits = xEventGroup;
 EventBits_t uxReturn;
 
-	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
 	{
 		uxReturn = pxEventBits->uxEventBits;
 	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
 	return uxReturn;
 } /*lint !e818 EventGroupHandle_t is a typedef used in other functions to so can't be pointer to const. */
@@ -668,6 +668,52 @@ void vEventGroupClearBitsCallback( void *pvEventGroup, const uint32_t ulBitsToCl
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_MULTI_WAIT == 1 )
+
+	BaseType_t xEventGroupMultiWaitArm( EventGroupHandle_t xEventGroup, ListItem_t * const pxWaitListItem, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits )
+	{
+	EventGroup_t *pxEventBits = xEventGroup;
+	EventBits_t uxControlBits = 0;
+	BaseType_t xReturn;
+
+		configASSERT( xEventGroup );
+		configASSERT( pxWaitListItem );
+		configASSERT( ( uxBitsToWaitFor & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+		configASSERT( uxBitsToWaitFor != 0 );
+
+		/* This function should not be called by application code.  It is
+		called by xMultiWaitForAny() with the scheduler suspended, which is all
+		that is needed to access the list of tasks waiting for bits. */
+		if( prvTestWaitCondition( pxEventBits->uxEventBits, uxBitsToWaitFor, xWaitForAllBits ) != pdFALSE )
+		{
+			/* The wait condition is already met. */
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			if( xWaitForAllBits != pdFALSE )
+			{
+				uxControlBits |= eventWAIT_FOR_ALL_BITS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* eventCLEAR_EVENTS_ON_EXIT_BIT is never set as the bits must
+			not be cleared on behalf of a task that may already have been
+			unblocked by a different object. */
+			listSET_LIST_ITEM_VALUE( pxWaitListItem, uxBitsToWaitFor | uxControlBits );
+			vListInsertEnd( &( pxEventBits->xTasksWaitingForBits ), pxWaitListItem );
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTI_WAIT */
+/*-----------------------------------------------------------*/
+
 static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits )
 {
 BaseType_t xWaitConditionMet = pdFALSE;
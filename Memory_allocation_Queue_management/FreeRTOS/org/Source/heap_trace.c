@@ -0,0 +1,460 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "heap_trace.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+for the header files above, but not in this file, in order to generate the
+correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+to include heap tracing.  This #if is closed at the very bottom of this file.
+If you want to include heap tracing then ensure configUSE_HEAP_TRACE is set to
+1 in FreeRTOSConfig.h. */
+#if( configUSE_HEAP_TRACE == 1 )
+
+#ifndef configHEAP_TRACE_SLOTS
+	#define configHEAP_TRACE_SLOTS			128
+#endif
+
+#ifndef configHEAP_TRACE_HISTORY
+	#define configHEAP_TRACE_HISTORY		64
+#endif
+
+#ifndef configHEAP_TRACE_SAMPLE_PERIOD
+	#define configHEAP_TRACE_SAMPLE_PERIOD	16
+#endif
+
+#if( ( configHEAP_TRACE_SLOTS & ( configHEAP_TRACE_SLOTS - 1 ) ) != 0 )
+	#error configHEAP_TRACE_SLOTS must be a power of two
+#endif
+
+/* The table is open addressed, so one slot is always left empty to end a
+search. */
+#define heaptraceMAX_RECORDS	( ( uint32_t ) configHEAP_TRACE_SLOTS - 1UL )
+#define heaptraceSLOT_MASK		( ( UBaseType_t ) configHEAP_TRACE_SLOTS - ( UBaseType_t ) 1 )
+
+/* The home slot of an allocation.  Blocks are at least 8 bytes apart, so the
+low bits of the address are dropped. */
+#define heaptraceHOME_SLOT( pv )	( ( UBaseType_t ) ( ( ( portPOINTER_SIZE_TYPE ) ( pv ) ) >> 3 ) & heaptraceSLOT_MASK )
+
+/* Pointers are stored in the image as their low 32 bits. */
+#define heaptraceTO_32( pv )		( ( uint32_t ) ( portPOINTER_SIZE_TYPE ) ( pv ) )
+
+/* A live allocation.  A slot is empty when pvAddress is NULL. */
+typedef struct xHEAP_TRACE_ENTRY
+{
+	void *pvAddress;
+	void *pvCaller;
+	TaskHandle_t xOwner;
+	uint32_t ulSize;				/*< Can have heaptraceFLAG_ORPHANED set. */
+	TickType_t xTimestamp;
+} HeapTraceEntry_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Return the slot holding pvAddress, or configHEAP_TRACE_SLOTS if it is not
+ * in the table.
+ */
+static UBaseType_t prvFindSlot( const void *pvAddress ) PRIVILEGED_FUNCTION;
+
+/*
+ * Sample the free blocks of the heap into the history.  Called with the heap
+ * lock held.
+ */
+static void prvSample( void ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+static HeapTraceEntry_t xEntries[ configHEAP_TRACE_SLOTS ];
+static HeapTraceSample_t xSamples[ configHEAP_TRACE_HISTORY ];
+
+/* The free blocks found by the last sample, which provide the histogram in the
+image. */
+static HeapTraceFreeBlocks_t xLastFreeBlocks;
+
+static uint32_t ulRecordCount = 0;
+static uint32_t ulSamplesWritten = 0;
+static uint32_t ulAllocations = 0;
+static uint32_t ulFrees = 0;
+static uint32_t ulDropped = 0;
+static size_t xTotalHeapSize = 0;
+
+/*-----------------------------------------------------------*/
+
+void vHeapTraceInit( size_t xHeapSize )
+{
+	xTotalHeapSize = xHeapSize;
+}
+/*-----------------------------------------------------------*/
+
+void vHeapTraceAlloc( void *pvAddress, size_t xBlockSize, void *pvCaller )
+{
+UBaseType_t uxSlot;
+HeapTraceEntry_t *pxEntry;
+
+	ulAllocations++;
+
+	if( ulRecordCount < heaptraceMAX_RECORDS )
+	{
+		/* Linear probing from the home slot.  An empty slot always exists. */
+		uxSlot = heaptraceHOME_SLOT( pvAddress );
+
+		while( xEntries[ uxSlot ].pvAddress != NULL )
+		{
+			uxSlot = ( uxSlot + ( UBaseType_t ) 1 ) & heaptraceSLOT_MASK;
+		}
+
+		pxEntry = &( xEntries[ uxSlot ] );
+		pxEntry->pvAddress = pvAddress;
+		pxEntry->pvCaller = pvCaller;
+		pxEntry->ulSize = ( uint32_t ) xBlockSize & ~heaptraceFLAG_ORPHANED;
+		/* The interrupt safe version does not enter a critical section, which
+		must not be done with the heap locked by masking interrupts. */
+		pxEntry->xTimestamp = xTaskGetTickCountFromISR();
+
+		/* Allocations made before the scheduler starts belong to no task. */
+		if( xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED )
+		{
+			pxEntry->xOwner = xTaskGetCurrentTaskHandle();
+		}
+		else
+		{
+			pxEntry->xOwner = NULL;
+		}
+
+		ulRecordCount++;
+	}
+	else
+	{
+		ulDropped++;
+	}
+
+	#if( configHEAP_TRACE_SAMPLE_PERIOD > 0 )
+	{
+		if( ( ulAllocations % ( uint32_t ) configHEAP_TRACE_SAMPLE_PERIOD ) == 0UL )
+		{
+			prvSample();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+void vHeapTraceFree( void *pvAddress )
+{
+UBaseType_t uxEmpty, uxSlot, uxHome;
+
+	ulFrees++;
+	uxEmpty = prvFindSlot( pvAddress );
+
+	/* The allocation is not in the table if it was dropped. */
+	if( uxEmpty < ( UBaseType_t ) configHEAP_TRACE_SLOTS )
+	{
+		xEntries[ uxEmpty ].pvAddress = NULL;
+		ulRecordCount--;
+
+		/* Move later entries of the same probe sequence back into the slot just
+		emptied, so no search stops early at it. */
+		uxSlot = uxEmpty;
+
+		for( ;; )
+		{
+			uxSlot = ( uxSlot + ( UBaseType_t ) 1 ) & heaptraceSLOT_MASK;
+
+			if( xEntries[ uxSlot ].pvAddress == NULL )
+			{
+				break;
+			}
+
+			/* The entry can only move if its home slot is not cyclically
+			within ( uxEmpty, uxSlot ]. */
+			uxHome = heaptraceHOME_SLOT( xEntries[ uxSlot ].pvAddress );
+
+			if( ( ( uxSlot - uxHome ) & heaptraceSLOT_MASK ) >= ( ( uxSlot - uxEmpty ) & heaptraceSLOT_MASK ) )
+			{
+				xEntries[ uxEmpty ] = xEntries[ uxSlot ];
+				xEntries[ uxSlot ].pvAddress = NULL;
+				uxEmpty = uxSlot;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindSlot( const void *pvAddress )
+{
+UBaseType_t uxSlot = heaptraceHOME_SLOT( pvAddress );
+
+	while( xEntries[ uxSlot ].pvAddress != NULL )
+	{
+		if( xEntries[ uxSlot ].pvAddress == pvAddress )
+		{
+			return uxSlot;
+		}
+
+		uxSlot = ( uxSlot + ( UBaseType_t ) 1 ) & heaptraceSLOT_MASK;
+	}
+
+	return ( UBaseType_t ) configHEAP_TRACE_SLOTS;
+}
+/*-----------------------------------------------------------*/
+
+void vHeapTraceTaskDeleted( TaskHandle_t xTask )
+{
+UBaseType_t uxSlot, uxSavedInterruptStatus;
+
+	heapLOCK( uxSavedInterruptStatus );
+	{
+		for( uxSlot = 0; uxSlot < ( UBaseType_t ) configHEAP_TRACE_SLOTS; uxSlot++ )
+		{
+			if( ( xEntries[ uxSlot ].pvAddress != NULL ) && ( xEntries[ uxSlot ].xOwner == xTask ) )
+			{
+				xEntries[ uxSlot ].ulSize |= heaptraceFLAG_ORPHANED;
+			}
+		}
+	}
+	heapUNLOCK( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vHeapTraceAddFreeBlock( HeapTraceFreeBlocks_t *pxFreeBlocks, size_t xBlockSize )
+{
+size_t xBucket = 0;
+
+	pxFreeBlocks->xFreeBlocks++;
+
+	if( xBlockSize > pxFreeBlocks->xLargestFreeBlock )
+	{
+		pxFreeBlocks->xLargestFreeBlock = xBlockSize;
+	}
+
+	/* The bucket is the position of the top bit, less the shift. */
+	xBlockSize >>= heaptraceHISTOGRAM_SHIFT + 1U;
+
+	while( ( xBlockSize != 0 ) && ( xBucket < ( heaptraceHISTOGRAM_BUCKETS - 1U ) ) )
+	{
+		xBlockSize >>= 1;
+		xBucket++;
+	}
+
+	pxFreeBlocks->ulHistogram[ xBucket ]++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSample( void )
+{
+HeapTraceSample_t *pxSample;
+
+	( void ) memset( &xLastFreeBlocks, 0x00, sizeof( xLastFreeBlocks ) );
+	vPortHeapTraceGetFreeBlocks( &xLastFreeBlocks );
+
+	pxSample = &( xSamples[ ulSamplesWritten % ( uint32_t ) configHEAP_TRACE_HISTORY ] );
+	pxSample->ulTimestamp = ( uint32_t ) xTaskGetTickCountFromISR();
+	pxSample->ulFreeBytes = ( uint32_t ) xPortGetFreeHeapSize();
+	pxSample->ulLargestFreeBlock = ( uint32_t ) xLastFreeBlocks.xLargestFreeBlock;
+	pxSample->ulFreeBlocks = ( uint32_t ) xLastFreeBlocks.xFreeBlocks;
+	ulSamplesWritten++;
+}
+/*-----------------------------------------------------------*/
+
+void vHeapTraceSample( void )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	heapLOCK( uxSavedInterruptStatus );
+	{
+		prvSample();
+	}
+	heapUNLOCK( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxHeapTraceGetOrphans( size_t *pxOrphanedBytes )
+{
+UBaseType_t uxSlot, uxOrphans = 0, uxSavedInterruptStatus;
+size_t xBytes = 0;
+
+	heapLOCK( uxSavedInterruptStatus );
+	{
+		for( uxSlot = 0; uxSlot < ( UBaseType_t ) configHEAP_TRACE_SLOTS; uxSlot++ )
+		{
+			if( ( xEntries[ uxSlot ].pvAddress != NULL ) && ( ( xEntries[ uxSlot ].ulSize & heaptraceFLAG_ORPHANED ) != 0UL ) )
+			{
+				uxOrphans++;
+				xBytes += ( size_t ) ( xEntries[ uxSlot ].ulSize & ~heaptraceFLAG_ORPHANED );
+			}
+		}
+	}
+	heapUNLOCK( uxSavedInterruptStatus );
+
+	*pxOrphanedBytes = xBytes;
+	return uxOrphans;
+}
+/*-----------------------------------------------------------*/
+
+/* Returns pdTRUE if the live owner of the entry in uxSlot is also the live
+owner of an entry in an earlier slot, so is already named. */
+static BaseType_t prvOwnerNamed( UBaseType_t uxSlot )
+{
+UBaseType_t uxEarlier;
+
+	for( uxEarlier = 0; uxEarlier < uxSlot; uxEarlier++ )
+	{
+		if( ( xEntries[ uxEarlier ].pvAddress != NULL ) &&
+			( ( xEntries[ uxEarlier ].ulSize & heaptraceFLAG_ORPHANED ) == 0UL ) &&
+			( xEntries[ uxEarlier ].xOwner == xEntries[ uxSlot ].xOwner ) )
+		{
+			return pdTRUE;
+		}
+	}
+
+	return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+/* Returns pdTRUE if the entry in uxSlot has a live owner that is not already
+named by an earlier entry. */
+static BaseType_t prvNeedsName( UBaseType_t uxSlot )
+{
+	return ( ( xEntries[ uxSlot ].pvAddress != NULL ) &&
+			 ( xEntries[ uxSlot ].xOwner != NULL ) &&
+			 ( ( xEntries[ uxSlot ].ulSize & heaptraceFLAG_ORPHANED ) == 0UL ) &&
+			 ( prvOwnerNamed( uxSlot ) == pdFALSE ) ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vHeapTraceDump( void ( *pxWrite )( const void *pvData, size_t xLength ) )
+{
+HeapTraceHeader_t xHeader;
+HeapTraceRecord_t xRecord;
+HeapTraceName_t xName;
+UBaseType_t uxSlot, uxChar, uxSavedInterruptStatus;
+const char *pcName;
+uint32_t ulSample, ulFirstSample;
+
+	heapLOCK( uxSavedInterruptStatus );
+	{
+		prvSample();
+
+		( void ) memset( &xHeader, 0x00, sizeof( xHeader ) );
+		xHeader.ulMagic = heaptraceMAGIC;
+		xHeader.usVersion = ( uint16_t ) heaptraceVERSION;
+		xHeader.usRecordSize = ( uint16_t ) sizeof( HeapTraceRecord_t );
+		xHeader.ulRecordCount = ulRecordCount;
+		xHeader.ulSampleCount = ( ulSamplesWritten < ( uint32_t ) configHEAP_TRACE_HISTORY ) ? ulSamplesWritten : ( uint32_t ) configHEAP_TRACE_HISTORY;
+		xHeader.ulTickRateHz = ( uint32_t ) configTICK_RATE_HZ;
+		xHeader.ulTotalHeapSize = ( uint32_t ) xTotalHeapSize;
+		xHeader.ulFreeBytes = ( uint32_t ) xPortGetFreeHeapSize();
+		xHeader.ulMinimumEverFreeBytes = ( uint32_t ) xPortGetMinimumEverFreeHeapSize();
+		xHeader.ulAllocations = ulAllocations;
+		xHeader.ulFrees = ulFrees;
+		xHeader.ulDropped = ulDropped;
+
+		for( uxSlot = 0; uxSlot < ( UBaseType_t ) configHEAP_TRACE_SLOTS; uxSlot++ )
+		{
+			if( prvNeedsName( uxSlot ) != pdFALSE )
+			{
+				xHeader.ulNameCount++;
+			}
+		}
+
+		pxWrite( &xHeader, sizeof( xHeader ) );
+
+		for( uxSlot = 0; uxSlot < ( UBaseType_t ) configHEAP_TRACE_SLOTS; uxSlot++ )
+		{
+			if( xEntries[ uxSlot ].pvAddress != NULL )
+			{
+				xRecord.ulAddress = heaptraceTO_32( xEntries[ uxSlot ].pvAddress );
+				xRecord.ulSize = xEntries[ uxSlot ].ulSize;
+				xRecord.ulCaller = heaptraceTO_32( xEntries[ uxSlot ].pvCaller );
+				xRecord.ulOwner = heaptraceTO_32( xEntries[ uxSlot ].xOwner );
+				xRecord.ulTimestamp = ( uint32_t ) xEntries[ uxSlot ].xTimestamp;
+				pxWrite( &xRecord, sizeof( xRecord ) );
+			}
+		}
+
+		/* The samples are written oldest first. */
+		ulFirstSample = ulSamplesWritten - xHeader.ulSampleCount;
+
+		for( ulSample = 0; ulSample < xHeader.ulSampleCount; ulSample++ )
+		{
+			pxWrite( &( xSamples[ ( ulFirstSample + ulSample ) % ( uint32_t ) configHEAP_TRACE_HISTORY ] ), sizeof( HeapTraceSample_t ) );
+		}
+
+		pxWrite( xLastFreeBlocks.ulHistogram, sizeof( xLastFreeBlocks.ulHistogram ) );
+
+		for( uxSlot = 0; uxSlot < ( UBaseType_t ) configHEAP_TRACE_SLOTS; uxSlot++ )
+		{
+			if( prvNeedsName( uxSlot ) != pdFALSE )
+			{
+				( void ) memset( &xName, 0x00, sizeof( xName ) );
+				xName.ulOwner = heaptraceTO_32( xEntries[ uxSlot ].xOwner );
+				pcName = pcTaskGetName( xEntries[ uxSlot ].xOwner );
+
+				for( uxChar = 0; ( uxChar < ( UBaseType_t ) heaptraceNAME_LENGTH ) && ( pcName[ uxChar ] != 0x00 ); uxChar++ )
+				{
+					xName.cName[ uxChar ] = pcName[ uxChar ];
+				}
+
+				pxWrite( &xName, sizeof( xName ) );
+			}
+		}
+	}
+	heapUNLOCK( uxSavedInterruptStatus );
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include heap tracing.  If you want to include heap tracing then ensure
+configUSE_HEAP_TRACE is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_HEAP_TRACE == 1 */
@@ -298,6 +298,20 @@ hold explicit before calling the code. */
 	#define portSETUP_TCB( pxTCB ) ( void ) pxTCB
 #endif
 
+/* Called with the lowest address of a task's stack each time the task is
+selected to run.  A port that can trap a write to the end of the stack when it
+happens (rather than when the task is next switched out) defines it, and
+traps when configSTACK_OVERFLOW_WATCHPOINT or configSTACK_OVERFLOW_MPU_GUARD is
+1.  The guard calls vApplicationStackOverflowHook() whatever
+configCHECK_FOR_STACK_OVERFLOW is set to, so the two can be used separately. */
+#if( ( ( configSTACK_OVERFLOW_WATCHPOINT == 1 ) || ( configSTACK_OVERFLOW_MPU_GUARD == 1 ) ) && !defined( portSET_STACK_GUARD ) )
+	#error configSTACK_OVERFLOW_WATCHPOINT or configSTACK_OVERFLOW_MPU_GUARD is set to 1 but the port does not define portSET_STACK_GUARD()
+#endif
+
+#ifndef portSET_STACK_GUARD
+	#define portSET_STACK_GUARD( pxStack ) ( void ) pxStack
+#endif
+
 #ifndef configQUEUE_REGISTRY_SIZE
 	#define configQUEUE_REGISTRY_SIZE 0U
 #endif
@@ -312,6 +326,16 @@ hold explicit before calling the code. */
 	#define portPOINTER_SIZE_TYPE uint32_t
 #endif
 
+#ifndef configUSE_TRACE_RECORDER
+	#define configUSE_TRACE_RECORDER 0
+#endif
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+	/* The trace recorder defines the trace macros, so must be included before
+	the unused trace macros are removed below. */
+	#include "trace_recorder.h"
+#endif
+
 /* Remove any unused trace macros. */
 #ifndef traceSTART
 	/* Used to perform any necessary initialisation - for example, open a file
@@ -778,6 +802,142 @@ hold explicit before calling the code. */
 	#define configUSE_QUEUE_SETS 0
 #endif
 
+#ifndef configUSE_MULTI_WAIT
+	#define configUSE_MULTI_WAIT 0
+#endif
+
+#ifndef configUSE_JOB_POOL
+	#define configUSE_JOB_POOL 0
+#endif
+
+#ifndef configUSE_ASYNC
+	#define configUSE_ASYNC 0
+#endif
+
+#ifndef configUSE_HEAP_REGIONS
+	#define configUSE_HEAP_REGIONS 0
+#endif
+
+#ifndef configUSE_TASK_ARENA
+	#define configUSE_TASK_ARENA 0
+#endif
+
+#ifndef configUSE_HEAP_TRACE
+	#define configUSE_HEAP_TRACE 0
+#endif
+
+#ifndef configUSE_OBJECT_SLABS
+	#define configUSE_OBJECT_SLABS 0
+#endif
+
+#ifndef configUSE_STACK_PROFILER
+	#define configUSE_STACK_PROFILER 0
+#endif
+
+#ifndef configSTACK_OVERFLOW_WATCHPOINT
+	#define configSTACK_OVERFLOW_WATCHPOINT 0
+#endif
+
+#ifndef configSTACK_OVERFLOW_MPU_GUARD
+	#define configSTACK_OVERFLOW_MPU_GUARD 0
+#endif
+
+#ifndef configUSE_FPU_CONTEXT_STATS
+	#define configUSE_FPU_CONTEXT_STATS 0
+#endif
+
+#ifndef configUSE_MONOTONIC_CLOCK
+	#define configUSE_MONOTONIC_CLOCK 0
+#endif
+
+#ifndef configDELAY_US_MAX_SPIN_US
+	/* vTaskDelayUntilUs() never busy waits by default. */
+	#define configDELAY_US_MAX_SPIN_US 0
+#endif
+
+#ifndef configUSE_MEM_OPS
+	#define configUSE_MEM_OPS 0
+#endif
+
+/* Queue items and stream buffer data are copied with configMEMCPY(), which is
+pvMemCopy() (mem_ops.h) when configUSE_MEM_OPS is 1 and memcpy() otherwise.
+FreeRTOSConfig.h can define it to use a copy of its own. */
+#if( configUSE_MEM_OPS == 1 )
+	#include "mem_ops.h"
+
+	#ifndef configMEMCPY
+		#define configMEMCPY( pvDest, pvSource, xLength ) pvMemCopy( ( pvDest ), ( pvSource ), ( xLength ) )
+	#endif
+#endif
+
+#ifndef configMEMCPY
+	#define configMEMCPY( pvDest, pvSource, xLength ) memcpy( ( pvDest ), ( pvSource ), ( xLength ) )
+#endif
+
+/* Values for configHEAP_LOCKING, which selects how heap_4.c and heap_regions.c
+are protected.  Suspending the scheduler leaves interrupts enabled, but a task
+made ready during an allocation cannot run until xTaskResumeAll() has processed
+the pending ready list.  Masking interrupts (raising BASEPRI on Cortex-M) for
+the duration of the allocation instead lets such a task run as soon as the
+allocation completes.  Multiple core ports also take a dedicated heap spinlock. */
+#define heapLOCKING_SUSPEND_SCHEDULER	0
+#define heapLOCKING_MASK_INTERRUPTS		1
+
+#ifndef configHEAP_LOCKING
+	#define configHEAP_LOCKING heapLOCKING_SUSPEND_SCHEDULER
+#endif
+
+/* configHEAP_ISR_BLOCK_COUNT blocks of configHEAP_ISR_BLOCK_SIZE bytes are
+reserved for pvPortMallocFromISR().  Set the count to 0 to leave them out. */
+#ifndef configHEAP_ISR_BLOCK_COUNT
+	#define configHEAP_ISR_BLOCK_COUNT 0
+#endif
+
+#ifndef configHEAP_ISR_BLOCK_SIZE
+	#define configHEAP_ISR_BLOCK_SIZE 64
+#endif
+
+/* Task control blocks, stacks, queues and timers are taken from the object
+slabs (object_slab.h) when configUSE_OBJECT_SLABS is 1.  Otherwise task control
+blocks and stacks are allocated with a placement hint when the heap is built
+from heap_regions.c, so they can be kept in the memory that suits them best. */
+#if( configUSE_OBJECT_SLABS == 1 )
+	#define pvPortMallocTCB( xSize ) pvSlabAlloc( eSlabTask, ( xSize ) )
+	#define pvPortMallocStack( xSize ) pvSlabAlloc( eSlabSmallStack, ( xSize ) )
+	#define pvPortMallocQueue( xSize ) pvSlabAlloc( eSlabQueue, ( xSize ) )
+	#define pvPortMallocTimer( xSize ) pvSlabAlloc( eSlabTimer, ( xSize ) )
+	#define vPortFreeObject( pv ) vSlabFree( pv )
+#endif
+
+#ifndef pvPortMallocTCB
+	#if( configUSE_HEAP_REGIONS == 1 )
+		#define pvPortMallocTCB( xSize ) pvPortMallocHint( ( xSize ), eHeapHintTCB )
+	#else
+		#define pvPortMallocTCB( xSize ) pvPortMalloc( xSize )
+	#endif
+#endif
+
+#ifndef pvPortMallocStack
+	#if( configUSE_HEAP_REGIONS == 1 )
+		#define pvPortMallocStack( xSize ) pvPortMallocHint( ( xSize ), eHeapHintStack )
+	#else
+		#define pvPortMallocStack( xSize ) pvPortMalloc( xSize )
+	#endif
+#endif
+
+#ifndef pvPortMallocQueue
+	#define pvPortMallocQueue( xSize ) pvPortMalloc( xSize )
+#endif
+
+#ifndef pvPortMallocTimer
+	#define pvPortMallocTimer( xSize ) pvPortMalloc( xSize )
+#endif
+
+/* Frees memory from any of the above. */
+#ifndef vPortFreeObject
+	#define vPortFreeObject( pv ) vPortFree( pv )
+#endif
+
 #ifndef portTASK_USES_FLOATING_POINT
 	#define portTASK_USES_FLOATING_POINT()
 #endif
@@ -826,6 +986,68 @@ hold explicit before calling the code. */
 	#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
 #endif
 
+#ifndef configNUMBER_OF_CORES
+	#define configNUMBER_OF_CORES 1
+#endif
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+	/* The port must provide the core number, a way of interrupting another
+	core, the per core critical nesting count, and the two recursive kernel
+	spinlocks. */
+	#ifndef portGET_CORE_ID
+		#error configNUMBER_OF_CORES is greater than 1 but the port does not define portGET_CORE_ID()
+	#endif
+
+	#ifndef portYIELD_CORE
+		#error configNUMBER_OF_CORES is greater than 1 but the port does not define portYIELD_CORE()
+	#endif
+
+	#ifndef portGET_CRITICAL_NESTING_COUNT
+		#error configNUMBER_OF_CORES is greater than 1 but the port does not define portGET_CRITICAL_NESTING_COUNT(), portINCREMENT_CRITICAL_NESTING_COUNT() and portDECREMENT_CRITICAL_NESTING_COUNT()
+	#endif
+
+	#if !defined( portGET_TASK_LOCK ) || !defined( portRELEASE_TASK_LOCK ) || !defined( portGET_ISR_LOCK ) || !defined( portRELEASE_ISR_LOCK )
+		#error configNUMBER_OF_CORES is greater than 1 but the port does not define the kernel spinlock macros
+	#endif
+
+	#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+		#error configUSE_PORT_OPTIMISED_TASK_SELECTION must be 0 when configNUMBER_OF_CORES is greater than 1
+	#endif
+
+	#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+		#error portCRITICAL_NESTING_IN_TCB cannot be used when configNUMBER_OF_CORES is greater than 1
+	#endif
+
+	#if ( configNUMBER_OF_CORES > 10 )
+		#error configNUMBER_OF_CORES cannot be greater than 10 as the core number is appended to the idle task name as a single digit
+	#endif
+
+#endif /* configNUMBER_OF_CORES */
+
+#ifndef portGET_HEAP_LOCK
+	#if( ( configNUMBER_OF_CORES > 1 ) && ( ( configHEAP_LOCKING == heapLOCKING_MASK_INTERRUPTS ) || ( configHEAP_ISR_BLOCK_COUNT > 0 ) ) )
+		#error The port does not define portGET_HEAP_LOCK(), so configHEAP_LOCKING and configHEAP_ISR_BLOCK_COUNT cannot be used when configNUMBER_OF_CORES is greater than 1
+	#endif
+
+	#define portGET_HEAP_LOCK()
+	#define portRELEASE_HEAP_LOCK()
+#endif
+
+/* Used by the heap implementations and heap_trace.c around any access to the
+heap structures.  heapLOCK_FROM_ISR() protects the blocks reserved for
+interrupts whichever configHEAP_LOCKING is used. */
+#define heapLOCK_FROM_ISR( uxSavedInterruptStatus )		{ ( uxSavedInterruptStatus ) = portSET_INTERRUPT_MASK_FROM_ISR(); portGET_HEAP_LOCK(); }
+#define heapUNLOCK_FROM_ISR( uxSavedInterruptStatus )	{ portRELEASE_HEAP_LOCK(); portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus ); }
+
+#if( configHEAP_LOCKING == heapLOCKING_MASK_INTERRUPTS )
+	#define heapLOCK( uxSavedInterruptStatus )		heapLOCK_FROM_ISR( uxSavedInterruptStatus )
+	#define heapUNLOCK( uxSavedInterruptStatus )	heapUNLOCK_FROM_ISR( uxSavedInterruptStatus )
+#else
+	#define heapLOCK( uxSavedInterruptStatus )		{ ( uxSavedInterruptStatus ) = 0; vTaskSuspendAll(); }
+	#define heapUNLOCK( uxSavedInterruptStatus )	{ ( void ) ( uxSavedInterruptStatus ); ( void ) xTaskResumeAll(); }
+#endif
+
 #ifndef configAPPLICATION_ALLOCATED_HEAP
 	#define configAPPLICATION_ALLOCATED_HEAP 0
 #endif
@@ -876,6 +1098,98 @@ hold explicit before calling the code. */
 	#error configSUPPORT_STATIC_ALLOCATION and configSUPPORT_DYNAMIC_ALLOCATION cannot both be 0, but can both be 1.
 #endif
 
+#if( configUSE_JOB_POOL == 1 )
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+		#error configUSE_JOB_POOL requires configSUPPORT_DYNAMIC_ALLOCATION to be set to 1 in FreeRTOSConfig.h
+	#endif
+
+	#if( configUSE_TASK_NOTIFICATIONS == 0 )
+		#error configUSE_JOB_POOL requires configUSE_TASK_NOTIFICATIONS to be set to 1 in FreeRTOSConfig.h
+	#endif
+
+	#if( ( INCLUDE_xTaskGetCurrentTaskHandle == 0 ) && ( configUSE_MUTEXES == 0 ) && ( configNUMBER_OF_CORES == 1 ) )
+		#error configUSE_JOB_POOL requires INCLUDE_xTaskGetCurrentTaskHandle to be set to 1 in FreeRTOSConfig.h
+	#endif
+#endif
+
+#if( configUSE_ASYNC == 1 )
+	#if( configUSE_MULTI_WAIT == 0 )
+		#error configUSE_ASYNC requires configUSE_MULTI_WAIT to be set to 1 in FreeRTOSConfig.h
+	#endif
+
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+		#error configUSE_ASYNC requires configSUPPORT_DYNAMIC_ALLOCATION to be set to 1 in FreeRTOSConfig.h
+	#endif
+
+	#if( ( INCLUDE_xTaskGetCurrentTaskHandle == 0 ) && ( configUSE_MUTEXES == 0 ) && ( configNUMBER_OF_CORES == 1 ) )
+		#error configUSE_ASYNC requires INCLUDE_xTaskGetCurrentTaskHandle to be set to 1 in FreeRTOSConfig.h
+	#endif
+#endif
+
+#if( ( configUSE_HEAP_REGIONS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) )
+	#error configUSE_HEAP_REGIONS requires configSUPPORT_DYNAMIC_ALLOCATION to be set to 1 in FreeRTOSConfig.h
+#endif
+
+#if( ( configUSE_OBJECT_SLABS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) )
+	#error configUSE_OBJECT_SLABS requires configSUPPORT_DYNAMIC_ALLOCATION to be set to 1 in FreeRTOSConfig.h
+#endif
+
+#if( configUSE_HEAP_TRACE == 1 )
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+		#error configUSE_HEAP_TRACE requires configSUPPORT_DYNAMIC_ALLOCATION to be set to 1 in FreeRTOSConfig.h
+	#endif
+
+	#if( ( INCLUDE_xTaskGetCurrentTaskHandle == 0 ) && ( configUSE_MUTEXES == 0 ) && ( configNUMBER_OF_CORES == 1 ) )
+		#error configUSE_HEAP_TRACE requires INCLUDE_xTaskGetCurrentTaskHandle to be set to 1 in FreeRTOSConfig.h
+	#endif
+
+	#if( ( INCLUDE_xTaskGetSchedulerState == 0 ) && ( configUSE_TIMERS == 0 ) )
+		#error configUSE_HEAP_TRACE requires INCLUDE_xTaskGetSchedulerState to be set to 1 in FreeRTOSConfig.h
+	#endif
+#endif
+
+#if( configUSE_STACK_PROFILER == 1 )
+	#if( configUSE_TRACE_FACILITY == 0 )
+		#error configUSE_STACK_PROFILER requires configUSE_TRACE_FACILITY to be set to 1 in FreeRTOSConfig.h
+	#endif
+
+	#if( configUSE_TIMERS == 0 )
+		#error configUSE_STACK_PROFILER requires configUSE_TIMERS to be set to 1 in FreeRTOSConfig.h
+	#endif
+
+	#if( ( portSTACK_GROWTH < 0 ) && ( configRECORD_STACK_HIGH_ADDRESS == 0 ) )
+		#error configUSE_STACK_PROFILER requires configRECORD_STACK_HIGH_ADDRESS to be set to 1 in FreeRTOSConfig.h
+	#endif
+#endif
+
+#if( configUSE_FPU_CONTEXT_STATS == 1 )
+	#ifndef portFPU_CONTEXT_SAVED
+		#error configUSE_FPU_CONTEXT_STATS is set to 1 but the port does not define portFPU_CONTEXT_SAVED()
+	#endif
+
+	#ifndef portCLEAR_FPU_CONTEXT
+		#error configUSE_FPU_CONTEXT_STATS is set to 1 but the port does not define portCLEAR_FPU_CONTEXT()
+	#endif
+#endif
+
+#if( configUSE_MONOTONIC_CLOCK == 1 )
+	#ifndef portGET_TICK_FRACTION
+		#error configUSE_MONOTONIC_CLOCK is set to 1 but the port does not define portGET_TICK_FRACTION()
+	#endif
+
+	#ifndef portTICK_FRACTION_HZ
+		#error configUSE_MONOTONIC_CLOCK is set to 1 but the port does not define portTICK_FRACTION_HZ
+	#endif
+
+	#if( INCLUDE_vTaskDelay != 1 )
+		#error INCLUDE_vTaskDelay must be set to 1 when configUSE_MONOTONIC_CLOCK is set to 1
+	#endif
+#endif
+
+#if( ( configSTACK_OVERFLOW_WATCHPOINT == 1 ) && ( configSTACK_OVERFLOW_MPU_GUARD == 1 ) )
+	#error configSTACK_OVERFLOW_WATCHPOINT and configSTACK_OVERFLOW_MPU_GUARD cannot both be set to 1 in FreeRTOSConfig.h
+#endif
+
 #if( ( configUSE_RECURSIVE_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
 	#error configUSE_MUTEXES must be set to 1 to use recursive mutexes
 #endif
@@ -1157,6 +1471,23 @@ typedef struct xSTATIC_TCB
 	#if ( configUSE_POSIX_ERRNO == 1 )
 		int				iDummy22;
 	#endif
+	#if ( configUSE_MULTI_WAIT == 1 )
+		void			*pvDummy23;
+		UBaseType_t		uxDummy24;
+		BaseType_t		xDummy25;
+	#endif
+	#if ( configNUMBER_OF_CORES > 1 )
+		BaseType_t		xDummy26;
+		UBaseType_t		uxDummy27;
+		BaseType_t		xDummy28;
+	#endif
+	#if ( configUSE_TASK_ARENA == 1 )
+		void			*pvDummy29;
+	#endif
+	#if ( configUSE_FPU_CONTEXT_STATS == 1 )
+		uint32_t		ulDummy30[ 2 ];
+		BaseType_t		xDummy31;
+	#endif
 } StaticTask_t;
 
 /*
@@ -0,0 +1,397 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef ASYNC_H
+#define ASYNC_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include async.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "list.h"
+#include "queue.h"
+#include "event_groups.h"
+#include "stream_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * An async executor is an ordinary task that runs many lightweight, stackless
+ * contexts.  Each context is a function written in the same style as a
+ * co-routine - the function returns each time the context waits, and the
+ * asyncBEGIN() switch statement resumes it at the line it returned from when
+ * the wait completes.  Contexts therefore share the stack of the executor
+ * task, and each context only needs its AsyncContext_t, which is allocated by
+ * the application.
+ *
+ * Unlike co-routines, contexts can wait on the normal queue, semaphore, event
+ * group and stream buffer API, can be notified from tasks and interrupts, and
+ * run at the priority of their executor task, so there can be several
+ * executors at different priorities.
+ *
+ * While it has no context ready to run the executor blocks in
+ * xMultiWaitForAny() on the objects its contexts are waiting for, so a queue
+ * send or semaphore give from anywhere wakes it directly.  Waits on stream
+ * buffers, and on space in a queue, are polled once per tick.
+ *
+ * As with co-routines, local variables are not preserved across a wait and
+ * should be held in a structure passed as the context parameter, or declared
+ * static.  Two async macros must not be used on the same source line, and the
+ * macros cannot be used within a switch statement of the context's own.
+ *
+ * configUSE_ASYNC must be set to 1 in FreeRTOSConfig.h for the async executor
+ * to be available.  It also requires configUSE_MULTI_WAIT.
+ *
+ * \defgroup Async
+ */
+
+/**
+ * Type by which async executors are referenced.
+ */
+struct AsyncExecutorDefinition;
+typedef struct AsyncExecutorDefinition * AsyncExecutorHandle_t;
+
+struct xASYNC_CONTEXT;
+
+/* The prototype to which context functions must conform. */
+typedef void (*AsyncFunction_t)( struct xASYNC_CONTEXT * );
+
+/* What a context is waiting for.  For internal use only. */
+#define asyncWAIT_FINISHED			( ( uint8_t ) 0U )
+#define asyncWAIT_YIELD				( ( uint8_t ) 1U )
+#define asyncWAIT_DELAY				( ( uint8_t ) 2U )
+#define asyncWAIT_QUEUE				( ( uint8_t ) 3U )
+#define asyncWAIT_EVENT_GROUP		( ( uint8_t ) 4U )
+#define asyncWAIT_NOTIFICATION		( ( uint8_t ) 5U )
+#define asyncWAIT_POLL				( ( uint8_t ) 6U )
+#define asyncWAIT_RUNNING			( ( uint8_t ) 7U )
+
+/*
+ * A lightweight context.  The structure is allocated by the application and
+ * started using vAsyncContextStart().  Its members are not intended to be
+ * accessed directly.
+ */
+typedef struct xASYNC_CONTEXT
+{
+	ListItem_t xStateListItem;					/*< Places the context in the ready or waiting list of its executor. */
+	AsyncFunction_t pxFunction;
+	void *pvParameters;
+	struct AsyncExecutorDefinition *pxExecutor;
+	struct xASYNC_CONTEXT *pxNextNotified;		/*< Links contexts notified since the executor last ran. */
+	void *pvWaitObject;							/*< The queue or event group the context is waiting for. */
+	EventBits_t uxWaitBits;						/*< Event groups only - the bits the context is waiting for. */
+	TickType_t xWaitStart;						/*< The tick count when the current wait started. */
+	TickType_t xWaitTicks;						/*< The maximum length of the current wait. */
+	volatile uint32_t ulNotifiedValue;
+	uint16_t usResumePoint;						/*< The line the context function resumes from. */
+	uint8_t ucWaitType;							/*< One of the asyncWAIT_ constants. */
+	uint8_t ucWaitForAllBits;
+	volatile uint8_t ucNotified;				/*< pdTRUE if ulNotifiedValue has not been taken. */
+	volatile uint8_t ucQueuedForExecutor;		/*< pdTRUE while the context is linked through pxNextNotified. */
+} AsyncContext_t;
+
+/**
+ * async.h
+ *<pre>
+ asyncBEGIN( AsyncContext_t *pxContext );
+ asyncEND( AsyncContext_t *pxContext );
+ </pre>
+ *
+ * Every context function must start with asyncBEGIN() and end with
+ * asyncEND().  The context finishes when the function returns, either by
+ * reaching asyncEND() or through a return statement.
+ *
+ * Example usage:
+ <pre>
+ typedef struct
+ {
+	 QueueHandle_t xCommands;
+	 uint8_t ucCommand;
+ } CommandHandler_t;
+
+ void vCommandContext( AsyncContext_t *pxContext )
+ {
+ CommandHandler_t *pxHandler = ( CommandHandler_t * ) pvAsyncGetParameters( pxContext );
+ BaseType_t xResult;
+
+	 asyncBEGIN( pxContext );
+
+	 for( ;; )
+	 {
+		 // Wait for a command without blocking the other contexts that run
+		 // in the same executor.
+		 asyncQUEUE_RECEIVE( pxContext, pxHandler->xCommands, &( pxHandler->ucCommand ), portMAX_DELAY, &xResult );
+
+		 if( xResult == pdPASS )
+		 {
+			 vProcessCommand( pxHandler->ucCommand );
+		 }
+
+		 asyncDELAY( pxContext, pdMS_TO_TICKS( 10 ) );
+	 }
+
+	 asyncEND( pxContext );
+ }
+ </pre>
+ * \defgroup asyncBEGIN asyncBEGIN
+ * \ingroup Async
+ */
+#define asyncBEGIN( pxContext )		switch( ( pxContext )->usResumePoint ) { case 0:
+#define asyncEND( pxContext )		} ( pxContext )->usResumePoint = ( uint16_t ) 0U
+
+/* Returns the pvParameters value passed to vAsyncContextStart(). */
+#define pvAsyncGetParameters( pxContext )	( ( pxContext )->pvParameters )
+
+/* Marks the fall through into a resume point, as a comment inside a macro is
+removed before the compiler can see it. */
+#if defined( __GNUC__ ) && ( __GNUC__ >= 7 )
+	#define asyncFALL_THROUGH	__attribute__( ( fallthrough ) )
+#else
+	#define asyncFALL_THROUGH
+#endif
+
+/* Used by the macros below.  The wait is retried each time the context
+resumes, so the resume point is placed before the attempt. */
+#define asyncRESUME_HERE( pxContext )	( pxContext )->usResumePoint = ( uint16_t ) __LINE__; asyncFALL_THROUGH; case __LINE__:
+
+/**
+ * async.h
+ *<pre>
+ asyncYIELD( AsyncContext_t *pxContext );
+ </pre>
+ *
+ * Let the other ready contexts in the executor run before continuing.
+ *
+ * \defgroup asyncYIELD asyncYIELD
+ * \ingroup Async
+ */
+#define asyncYIELD( pxContext )																		\
+	( pxContext )->ucWaitType = asyncWAIT_YIELD;													\
+	( pxContext )->usResumePoint = ( uint16_t ) __LINE__; return; case __LINE__:
+
+/**
+ * async.h
+ *<pre>
+ asyncDELAY( AsyncContext_t *pxContext, TickType_t xTicksToDelay );
+ </pre>
+ *
+ * Suspend the context for xTicksToDelay ticks.
+ *
+ * \defgroup asyncDELAY asyncDELAY
+ * \ingroup Async
+ */
+#define asyncDELAY( pxContext, xTicksToDelay )														\
+	vAsyncStartWait( ( pxContext ), ( xTicksToDelay ) );											\
+	asyncRESUME_HERE( pxContext )																	\
+	if( xAsyncSuspend( ( pxContext ), asyncWAIT_DELAY, NULL, 0, pdFALSE ) != pdFALSE ) { return; }
+
+/**
+ * async.h
+ *<pre>
+ asyncQUEUE_RECEIVE( AsyncContext_t *pxContext, QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait, BaseType_t *pxResult );
+ asyncSEMAPHORE_TAKE( AsyncContext_t *pxContext, SemaphoreHandle_t xSemaphore, TickType_t xTicksToWait, BaseType_t *pxResult );
+ </pre>
+ *
+ * The equivalents of xQueueReceive() and xSemaphoreTake().  *pxResult is set
+ * to pdPASS if an item was received, or the semaphore taken, otherwise to
+ * pdFAIL.  pvBuffer must not point to a local variable of the context
+ * function.  Mutexes must not be taken from a context, as the mutex would be
+ * held by the executor task.
+ *
+ * \defgroup asyncQUEUE_RECEIVE asyncQUEUE_RECEIVE
+ * \ingroup Async
+ */
+#define asyncQUEUE_RECEIVE( pxContext, xQueue, pvBuffer, xTicksToWait, pxResult )					\
+	vAsyncStartWait( ( pxContext ), ( xTicksToWait ) );											\
+	asyncRESUME_HERE( pxContext )																	\
+	*( pxResult ) = xQueueReceive( ( xQueue ), ( pvBuffer ), 0 );									\
+	if( ( *( pxResult ) != pdPASS ) && ( xAsyncSuspend( ( pxContext ), asyncWAIT_QUEUE, ( void * ) ( xQueue ), 0, pdFALSE ) != pdFALSE ) ) { return; }
+
+#define asyncSEMAPHORE_TAKE( pxContext, xSemaphore, xTicksToWait, pxResult )						\
+	asyncQUEUE_RECEIVE( ( pxContext ), ( xSemaphore ), NULL, ( xTicksToWait ), ( pxResult ) )
+
+/**
+ * async.h
+ *<pre>
+ asyncQUEUE_SEND( AsyncContext_t *pxContext, QueueHandle_t xQueue, const void *pvItemToQueue, TickType_t xTicksToWait, BaseType_t *pxResult );
+ </pre>
+ *
+ * The equivalent of xQueueSend().  *pxResult is set to pdPASS if the item was
+ * sent, otherwise to errQUEUE_FULL.  Waiting for space is polled once per
+ * tick.
+ *
+ * \defgroup asyncQUEUE_SEND asyncQUEUE_SEND
+ * \ingroup Async
+ */
+#define asyncQUEUE_SEND( pxContext, xQueue, pvItemToQueue, xTicksToWait, pxResult )				\
+	vAsyncStartWait( ( pxContext ), ( xTicksToWait ) );											\
+	asyncRESUME_HERE( pxContext )																	\
+	*( pxResult ) = xQueueSend( ( xQueue ), ( pvItemToQueue ), 0 );								\
+	if( ( *( pxResult ) != pdPASS ) && ( xAsyncSuspend( ( pxContext ), asyncWAIT_POLL, NULL, 0, pdFALSE ) != pdFALSE ) ) { return; }
+
+/**
+ * async.h
+ *<pre>
+ asyncEVENT_GROUP_WAIT_BITS( AsyncContext_t *pxContext, EventGroupHandle_t xEventGroup, EventBits_t uxBitsToWaitFor, BaseType_t xClearOnExit, BaseType_t xWaitForAllBits, TickType_t xTicksToWait, EventBits_t *puxBits );
+ </pre>
+ *
+ * The equivalent of xEventGroupWaitBits().  *puxBits is set to the value that
+ * xEventGroupWaitBits() would have returned.
+ *
+ * \defgroup asyncEVENT_GROUP_WAIT_BITS asyncEVENT_GROUP_WAIT_BITS
+ * \ingroup Async
+ */
+#define asyncEVENT_GROUP_WAIT_BITS( pxContext, xEventGroup, uxBitsToWaitFor, xClearOnExit, xWaitForAllBits, xTicksToWait, puxBits )	\
+	vAsyncStartWait( ( pxContext ), ( xTicksToWait ) );											\
+	asyncRESUME_HERE( pxContext )																	\
+	*( puxBits ) = xEventGroupWaitBits( ( xEventGroup ), ( uxBitsToWaitFor ), ( xClearOnExit ), ( xWaitForAllBits ), 0 );	\
+	if( ( xAsyncEventBitsMatch( *( puxBits ), ( uxBitsToWaitFor ), ( xWaitForAllBits ) ) == pdFALSE ) &&						\
+		( xAsyncSuspend( ( pxContext ), asyncWAIT_EVENT_GROUP, ( void * ) ( xEventGroup ), ( uxBitsToWaitFor ), ( xWaitForAllBits ) ) != pdFALSE ) ) { return; }
+
+/**
+ * async.h
+ *<pre>
+ asyncSTREAM_BUFFER_RECEIVE( AsyncContext_t *pxContext, StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait, size_t *pxReceivedBytes );
+ </pre>
+ *
+ * The equivalent of xStreamBufferReceive() (or xMessageBufferReceive()).
+ * Waiting for data is polled once per tick.
+ *
+ * \defgroup asyncSTREAM_BUFFER_RECEIVE asyncSTREAM_BUFFER_RECEIVE
+ * \ingroup Async
+ */
+#define asyncSTREAM_BUFFER_RECEIVE( pxContext, xStreamBuffer, pvRxData, xBufferLengthBytes, xTicksToWait, pxReceivedBytes )	\
+	vAsyncStartWait( ( pxContext ), ( xTicksToWait ) );											\
+	asyncRESUME_HERE( pxContext )																	\
+	*( pxReceivedBytes ) = xStreamBufferReceive( ( xStreamBuffer ), ( pvRxData ), ( xBufferLengthBytes ), 0 );				\
+	if( ( *( pxReceivedBytes ) == ( size_t ) 0 ) && ( xAsyncSuspend( ( pxContext ), asyncWAIT_POLL, NULL, 0, pdFALSE ) != pdFALSE ) ) { return; }
+
+/**
+ * async.h
+ *<pre>
+ asyncNOTIFY_WAIT( AsyncContext_t *pxContext, TickType_t xTicksToWait, uint32_t *pulNotifiedValue, BaseType_t *pxResult );
+ </pre>
+ *
+ * Wait for the context to be notified using vAsyncNotify() or
+ * vAsyncNotifyFromISR().  The bits sent since the context last took its
+ * notification are written to *pulNotifiedValue and then cleared.  *pxResult is
+ * set to pdPASS if the context was notified, otherwise to pdFAIL.
+ *
+ * \defgroup asyncNOTIFY_WAIT asyncNOTIFY_WAIT
+ * \ingroup Async
+ */
+#define asyncNOTIFY_WAIT( pxContext, xTicksToWait, pulNotifiedValue, pxResult )					\
+	vAsyncStartWait( ( pxContext ), ( xTicksToWait ) );											\
+	asyncRESUME_HERE( pxContext )																	\
+	*( pxResult ) = xAsyncNotifyTake( ( pxContext ), ( pulNotifiedValue ) );						\
+	if( ( *( pxResult ) != pdPASS ) && ( xAsyncSuspend( ( pxContext ), asyncWAIT_NOTIFICATION, NULL, 0, pdFALSE ) != pdFALSE ) ) { return; }
+
+/**
+ * async.h
+ *<pre>
+ AsyncExecutorHandle_t xAsyncExecutorCreate( UBaseType_t uxMaxWaitObjects, configSTACK_DEPTH_TYPE usStackDepth, UBaseType_t uxPriority );
+ </pre>
+ *
+ * Create an executor and the task that runs its contexts.
+ *
+ * @param uxMaxWaitObjects The number of different queues, semaphores and event
+ * groups the executor can block on at once.  If the contexts wait on more
+ * objects than this the executor polls them once per tick instead.
+ *
+ * @param usStackDepth The stack size of the executor task, in words.  All the
+ * contexts run on this stack.
+ *
+ * @param uxPriority The priority of the executor task.
+ *
+ * @return The handle of the executor, or NULL if there was not enough heap
+ * memory.
+ *
+ * \defgroup xAsyncExecutorCreate xAsyncExecutorCreate
+ * \ingroup Async
+ */
+AsyncExecutorHandle_t xAsyncExecutorCreate( UBaseType_t uxMaxWaitObjects, configSTACK_DEPTH_TYPE usStackDepth, UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/**
+ * async.h
+ *<pre>
+ void vAsyncContextStart( AsyncExecutorHandle_t xExecutor, AsyncContext_t *pxContext, AsyncFunction_t pxFunction, void *pvParameters );
+ </pre>
+ *
+ * Start running pxFunction as a context of xExecutor.  Can be called from a
+ * task, including from a context, but not from an interrupt.  pxContext must
+ * not already be running, and must remain valid until the context finishes.
+ *
+ * \defgroup vAsyncContextStart vAsyncContextStart
+ * \ingroup Async
+ */
+void vAsyncContextStart( AsyncExecutorHandle_t xExecutor, AsyncContext_t *pxContext, AsyncFunction_t pxFunction, void *pvParameters ) PRIVILEGED_FUNCTION;
+
+/**
+ * async.h
+ *<pre>
+ BaseType_t xAsyncContextIsFinished( const AsyncContext_t *pxContext );
+ </pre>
+ *
+ * @return pdTRUE once the context function has returned for the last time.
+ *
+ * \defgroup xAsyncContextIsFinished xAsyncContextIsFinished
+ * \ingroup Async
+ */
+BaseType_t xAsyncContextIsFinished( const AsyncContext_t *pxContext ) PRIVILEGED_FUNCTION;
+
+/**
+ * async.h
+ *<pre>
+ void vAsyncNotify( AsyncContext_t *pxContext, uint32_t ulBitsToSet );
+ void vAsyncNotifyFromISR( AsyncContext_t *pxContext, uint32_t ulBitsToSet, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * Set bits in the notification value of a context, and wake it if it is
+ * waiting in asyncNOTIFY_WAIT().  Can be called from a software timer callback
+ * to drive a context from a timer.
+ *
+ * \defgroup vAsyncNotify vAsyncNotify
+ * \ingroup Async
+ */
+void vAsyncNotify( AsyncContext_t *pxContext, uint32_t ulBitsToSet ) PRIVILEGED_FUNCTION;
+void vAsyncNotifyFromISR( AsyncContext_t *pxContext, uint32_t ulBitsToSet, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/* Functions used by the macros above.  For internal use only. */
+void vAsyncStartWait( AsyncContext_t *pxContext, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xAsyncSuspend( AsyncContext_t *pxContext, uint8_t ucWaitType, void *pvWaitObject, EventBits_t uxWaitBits, BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
+BaseType_t xAsyncNotifyTake( AsyncContext_t *pxContext, uint32_t *pulNotifiedValue ) PRIVILEGED_FUNCTION;
+BaseType_t xAsyncEventBitsMatch( EventBits_t uxBits, EventBits_t uxBitsToWaitFor, BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ASYNC_H */
+
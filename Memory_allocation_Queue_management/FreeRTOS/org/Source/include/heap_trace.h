@@ -0,0 +1,221 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef HEAP_TRACE_H
+#define HEAP_TRACE_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include heap_trace.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Heap tracing records every live allocation made by pvPortMalloc() in a side
+ * table - its address, size, the address of the code that requested it, the
+ * task that owned the request and when it was made.  It is supported by
+ * heap_4.c and heap_regions.c when configUSE_HEAP_TRACE is set to 1 in
+ * FreeRTOSConfig.h.  The blocks reserved for pvPortMallocFromISR() are not
+ * traced.
+ *
+ * When a task is deleted the allocations it made that are still live are
+ * marked as orphaned - memory still owned by a task that no longer exists is
+ * almost always a leak.  The free blocks of the heap are also sampled at
+ * regular intervals, recording the free space, the largest free block and the
+ * number of free blocks, so fragmentation can be followed over time.
+ *
+ * vHeapTraceDump() writes all of this out as a compact binary image, described
+ * below.  tools/heap_trace_report.c decodes the image on the host and prints a
+ * leak report, the live allocations grouped by caller, a histogram of free
+ * block sizes, the largest free block over time, and the peak heap usage,
+ * which is what configTOTAL_HEAP_SIZE should be sized from.
+ *
+ * Configuration (all optional):
+ *
+ * configHEAP_TRACE_SLOTS - the number of live allocations that can be
+ * recorded, which must be a power of two.  Each slot is five pointers or
+ * 32-bit words.  Allocations made when the table is full are counted in
+ * ulDropped but not recorded.
+ *
+ * configHEAP_TRACE_HISTORY - the number of free block samples kept.  When full
+ * the oldest sample is overwritten.
+ *
+ * configHEAP_TRACE_SAMPLE_PERIOD - the free blocks are sampled after every
+ * configHEAP_TRACE_SAMPLE_PERIOD allocations, or only when vHeapTraceSample()
+ * is called if set to 0.
+ *
+ * \defgroup HeapTrace
+ */
+
+/* Image layout.  The image starts with a HeapTraceHeader_t, followed by
+ulRecordCount HeapTraceRecord_t records, ulSampleCount HeapTraceSample_t records
+(oldest first), heaptraceHISTOGRAM_BUCKETS 32-bit free block counts, and
+ulNameCount HeapTraceName_t records naming the tasks that own live allocations.
+Pointers are stored as their low 32 bits.  All fields are little endian on the
+supported targets. */
+#define heaptraceMAGIC					( 0x54485246UL ) /* "FRHT" */
+#define heaptraceVERSION				( 1U )
+#define heaptraceNAME_LENGTH			( 16U )
+
+/* Bucket N of the histogram counts the free blocks of at least
+( 1 << ( N + heaptraceHISTOGRAM_SHIFT ) ) bytes and less than twice that.
+Bucket 0 also counts smaller blocks, and the last bucket larger blocks. */
+#define heaptraceHISTOGRAM_BUCKETS		( 16U )
+#define heaptraceHISTOGRAM_SHIFT		( 4U )
+
+/* Set in the ulSize field of a record if the task that made the allocation has
+been deleted. */
+#define heaptraceFLAG_ORPHANED			( 0x80000000UL )
+
+typedef struct xHEAP_TRACE_HEADER
+{
+	uint32_t ulMagic;
+	uint16_t usVersion;
+	uint16_t usRecordSize;				/*< sizeof( HeapTraceRecord_t ). */
+	uint32_t ulRecordCount;				/*< The number of live allocations recorded. */
+	uint32_t ulSampleCount;
+	uint32_t ulNameCount;
+	uint32_t ulTickRateHz;				/*< configTICK_RATE_HZ - the unit of the timestamps. */
+	uint32_t ulTotalHeapSize;			/*< The bytes available for allocation when the heap was initialised. */
+	uint32_t ulFreeBytes;				/*< xPortGetFreeHeapSize() when the image was written. */
+	uint32_t ulMinimumEverFreeBytes;	/*< xPortGetMinimumEverFreeHeapSize() when the image was written. */
+	uint32_t ulAllocations;				/*< The number of successful allocations traced. */
+	uint32_t ulFrees;					/*< The number of frees traced. */
+	uint32_t ulDropped;					/*< Allocations not recorded because the table was full. */
+} HeapTraceHeader_t;
+
+typedef struct xHEAP_TRACE_RECORD
+{
+	uint32_t ulAddress;					/*< As returned by pvPortMalloc(). */
+	uint32_t ulSize;					/*< The bytes taken from the heap, including the block header.  Can have heaptraceFLAG_ORPHANED set. */
+	uint32_t ulCaller;					/*< The return address of the call to pvPortMalloc(). */
+	uint32_t ulOwner;					/*< The handle of the task that made the call, or 0 if the scheduler had not been started. */
+	uint32_t ulTimestamp;				/*< The tick count when the call was made. */
+} HeapTraceRecord_t;
+
+typedef struct xHEAP_TRACE_SAMPLE
+{
+	uint32_t ulTimestamp;				/*< The tick count when the sample was taken. */
+	uint32_t ulFreeBytes;
+	uint32_t ulLargestFreeBlock;
+	uint32_t ulFreeBlocks;
+} HeapTraceSample_t;
+
+typedef struct xHEAP_TRACE_NAME
+{
+	uint32_t ulOwner;
+	char cName[ heaptraceNAME_LENGTH ];	/*< Not NUL terminated if the name fills the array. */
+} HeapTraceName_t;
+
+/* Filled by the heap implementation for the heap trace module. */
+typedef struct xHEAP_TRACE_FREE_BLOCKS
+{
+	size_t xLargestFreeBlock;
+	size_t xFreeBlocks;
+	uint32_t ulHistogram[ heaptraceHISTOGRAM_BUCKETS ];
+} HeapTraceFreeBlocks_t;
+
+/* The return address of the function that calls heapTRACE_CALLER(), recorded
+as the caller of each allocation. */
+#ifndef heapTRACE_CALLER
+	#if defined( __GNUC__ )
+		#define heapTRACE_CALLER() __builtin_return_address( 0 )
+	#else
+		#define heapTRACE_CALLER() NULL
+	#endif
+#endif
+
+/**
+ * heap_trace.h
+ *<pre>
+ void vHeapTraceSample( void );
+ </pre>
+ *
+ * Sample the free blocks of the heap now, in addition to the samples taken
+ * every configHEAP_TRACE_SAMPLE_PERIOD allocations.  For example, call from a
+ * periodic timer to follow fragmentation over time rather than allocations.
+ *
+ * \defgroup vHeapTraceSample vHeapTraceSample
+ * \ingroup HeapTrace
+ */
+void vHeapTraceSample( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * heap_trace.h
+ *<pre>
+ UBaseType_t uxHeapTraceGetOrphans( size_t *pxOrphanedBytes );
+ </pre>
+ *
+ * Returns the number of live allocations made by tasks that have since been
+ * deleted, and sets *pxOrphanedBytes to the bytes they hold.  Use
+ * vHeapTraceDump() to find where they were made.
+ *
+ * \defgroup uxHeapTraceGetOrphans uxHeapTraceGetOrphans
+ * \ingroup HeapTrace
+ */
+UBaseType_t uxHeapTraceGetOrphans( size_t *pxOrphanedBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * heap_trace.h
+ *<pre>
+ void vHeapTraceDump( void ( *pxWrite )( const void *pvData, size_t xLength ) );
+ </pre>
+ *
+ * Write the heap trace image through pxWrite, which is called several times.
+ * A sample of the free blocks is taken first.  The heap is locked while the
+ * image is written (see configHEAP_LOCKING), so pxWrite must not block.
+ *
+ * \defgroup vHeapTraceDump vHeapTraceDump
+ * \ingroup HeapTrace
+ */
+void vHeapTraceDump( void ( *pxWrite )( const void *pvData, size_t xLength ) ) PRIVILEGED_FUNCTION;
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  vHeapTraceInit(),
+ * vHeapTraceAlloc() and vHeapTraceFree() are called by the heap with its lock
+ * held.  vHeapTraceTaskDeleted() is called by the scheduler when a task is
+ * deleted.  vPortHeapTraceGetFreeBlocks() is provided by the heap, must be
+ * called with its lock held, and calls vHeapTraceAddFreeBlock() for each free
+ * block.
+ */
+void vHeapTraceInit( size_t xTotalHeapSize ) PRIVILEGED_FUNCTION;
+void vHeapTraceAlloc( void *pvAddress, size_t xBlockSize, void *pvCaller ) PRIVILEGED_FUNCTION;
+void vHeapTraceFree( void *pvAddress ) PRIVILEGED_FUNCTION;
+void vHeapTraceTaskDeleted( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+void vHeapTraceAddFreeBlock( HeapTraceFreeBlocks_t *pxFreeBlocks, size_t xBlockSize ) PRIVILEGED_FUNCTION;
+void vPortHeapTraceGetFreeBlocks( HeapTraceFreeBlocks_t *pxFreeBlocks ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEAP_TRACE_H */
@@ -0,0 +1,270 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef JOB_POOL_H
+#define JOB_POOL_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include job_pool.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A job pool runs many short jobs on a fixed set of worker tasks, avoiding the
+ * cost of creating a task per job, and the serialisation of sending every job
+ * to a single worker through a queue.  A job is a function and a parameter.
+ *
+ * Each worker owns a deque of jobs.  A worker takes jobs from the back of its
+ * own deque (most recently submitted first, while their data is still likely
+ * to be in cache) and, when its own deque is empty, steals from the front of
+ * the other workers' deques.  Jobs submitted by a worker are placed in that
+ * worker's own deque, other jobs are spread across the deques in turn.  Idle
+ * workers block on their direct to task notification and are woken one at a
+ * time as jobs are submitted.
+ *
+ * A job can be added to a JobGroup_t, then xJobGroupWait() waits for all the
+ * jobs in the group to complete (join).  xJobPoolFence() waits for all the
+ * jobs submitted to the pool to complete.  When a worker waits it runs other
+ * jobs from the pool in the meantime, so jobs can submit and wait for their
+ * own sub-jobs without the pool deadlocking.
+ *
+ * The waiting functions use the direct to task notification of the calling
+ * task, so must not be used by a task that uses its notification value for
+ * another purpose at the same time.
+ *
+ * configUSE_JOB_POOL must be set to 1 in FreeRTOSConfig.h for the job pool
+ * functionality to be available.
+ *
+ * \defgroup JobPool
+ */
+
+/**
+ * Type by which job pools are referenced.  For example, a call to
+ * xJobPoolCreate() returns a JobPoolHandle_t variable that can then be used as
+ * a parameter to xJobPoolSubmit(), xJobPoolFence(), etc.
+ */
+struct JobPoolDefinition;
+typedef struct JobPoolDefinition * JobPoolHandle_t;
+
+/* The prototype to which job functions must conform. */
+typedef void (*JobFunction_t)( void * );
+
+/* A job, as passed to uxJobPoolSubmitBatch(). */
+typedef struct xJOB
+{
+	JobFunction_t pxFunction;
+	void *pvParameter;
+} Job_t;
+
+/*
+ * A group of jobs that can be waited for.  The structure is allocated by the
+ * application and initialised using vJobGroupInitialise().  Its members are
+ * not intended to be accessed directly.
+ */
+typedef struct xJOB_GROUP
+{
+	volatile UBaseType_t uxPendingJobs;	/*< Jobs submitted to the group that have not completed. */
+	TaskHandle_t xWaitingTask;			/*< The task, if any, waiting for uxPendingJobs to reach zero. */
+} JobGroup_t;
+
+/**
+ * job_pool.h
+ *<pre>
+ JobPoolHandle_t xJobPoolCreate( UBaseType_t uxWorkerCount, UBaseType_t uxDequeLength, configSTACK_DEPTH_TYPE usStackDepth, UBaseType_t uxPriority );
+ </pre>
+ *
+ * Create a job pool and its worker tasks.  The pool and the worker stacks are
+ * allocated from the FreeRTOS heap.
+ *
+ * @param uxWorkerCount The number of worker tasks, from 1 to the number of
+ * bits in a UBaseType_t.  On a multi-core part this is normally the number of
+ * cores the jobs may run on.
+ *
+ * @param uxDequeLength The number of jobs each worker's deque can hold, so the
+ * pool can hold up to uxWorkerCount * uxDequeLength jobs that have not yet
+ * started.
+ *
+ * @param usStackDepth The stack size of each worker, in words, which must be
+ * large enough for the jobs it runs.
+ *
+ * @param uxPriority The priority of the worker tasks.
+ *
+ * @return The handle of the pool, or NULL if there was not enough heap
+ * memory.
+ *
+ * \defgroup xJobPoolCreate xJobPoolCreate
+ * \ingroup JobPool
+ */
+JobPoolHandle_t xJobPoolCreate( UBaseType_t uxWorkerCount, UBaseType_t uxDequeLength, configSTACK_DEPTH_TYPE usStackDepth, UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/**
+ * job_pool.h
+ *<pre>
+ void vJobGroupInitialise( JobGroup_t *pxGroup );
+ </pre>
+ *
+ * Initialise a job group before it is first used.  A group can be reused once
+ * xJobGroupWait() has returned pdPASS for it.
+ *
+ * \defgroup vJobGroupInitialise vJobGroupInitialise
+ * \ingroup JobPool
+ */
+void vJobGroupInitialise( JobGroup_t *pxGroup ) PRIVILEGED_FUNCTION;
+
+/**
+ * job_pool.h
+ *<pre>
+ BaseType_t xJobPoolSubmit( JobPoolHandle_t xPool, JobFunction_t pxFunction, void *pvParameter, JobGroup_t *pxGroup );
+ </pre>
+ *
+ * Submit a job to the pool.  The function does not block.
+ *
+ * @param xPool The pool to submit to.
+ *
+ * @param pxFunction The function that implements the job.
+ *
+ * @param pvParameter The value passed to pxFunction.
+ *
+ * @param pxGroup The group the job belongs to, or NULL if the job does not
+ * belong to a group.
+ *
+ * @return pdPASS if the job was submitted, or errQUEUE_FULL if all the deques
+ * in the pool were full.
+ *
+ * Example usage:
+ <pre>
+ void vScaleBlock( void *pvParameter )
+ {
+	 // Process the block of samples pointed to by pvParameter.
+ }
+
+ void vScaleAll( JobPoolHandle_t xPool, int16_t psBlocks[ 8 ][ 64 ] )
+ {
+ JobGroup_t xGroup;
+ BaseType_t x;
+
+	vJobGroupInitialise( &xGroup );
+
+	for( x = 0; x < 8; x++ )
+	{
+		xJobPoolSubmit( xPool, vScaleBlock, psBlocks[ x ], &xGroup );
+	}
+
+	// Wait for all eight blocks to be processed.
+	xJobGroupWait( xPool, &xGroup, portMAX_DELAY );
+ }
+ </pre>
+ * \defgroup xJobPoolSubmit xJobPoolSubmit
+ * \ingroup JobPool
+ */
+BaseType_t xJobPoolSubmit( JobPoolHandle_t xPool, JobFunction_t pxFunction, void *pvParameter, JobGroup_t *pxGroup ) PRIVILEGED_FUNCTION;
+
+/**
+ * job_pool.h
+ *<pre>
+ BaseType_t xJobPoolSubmitFromISR( JobPoolHandle_t xPool, JobFunction_t pxFunction, void *pvParameter, JobGroup_t *pxGroup, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * A version of xJobPoolSubmit() that can be called from an interrupt service
+ * routine.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if submitting the job woke a
+ * worker that has a priority above the task that was interrupted, in which
+ * case a context switch should be requested before the interrupt is exited.
+ *
+ * \defgroup xJobPoolSubmitFromISR xJobPoolSubmitFromISR
+ * \ingroup JobPool
+ */
+BaseType_t xJobPoolSubmitFromISR( JobPoolHandle_t xPool, JobFunction_t pxFunction, void *pvParameter, JobGroup_t *pxGroup, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * job_pool.h
+ *<pre>
+ UBaseType_t uxJobPoolSubmitBatch( JobPoolHandle_t xPool, const Job_t *pxJobs, UBaseType_t uxJobCount, JobGroup_t *pxGroup );
+ </pre>
+ *
+ * Submit uxJobCount jobs, all belonging to pxGroup, spreading them across the
+ * deques of the pool, then wake as many idle workers as are needed.  This is
+ * cheaper than calling xJobPoolSubmit() for each job.  The function does not
+ * block.
+ *
+ * @return The number of jobs submitted, counting from the start of pxJobs,
+ * which is less than uxJobCount if the deques became full.
+ *
+ * \defgroup uxJobPoolSubmitBatch uxJobPoolSubmitBatch
+ * \ingroup JobPool
+ */
+UBaseType_t uxJobPoolSubmitBatch( JobPoolHandle_t xPool, const Job_t *pxJobs, UBaseType_t uxJobCount, JobGroup_t *pxGroup ) PRIVILEGED_FUNCTION;
+
+/**
+ * job_pool.h
+ *<pre>
+ BaseType_t xJobGroupWait( JobPoolHandle_t xPool, JobGroup_t *pxGroup, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Wait for all the jobs in pxGroup to complete.  Only one task can wait for a
+ * given group at a time.  If the calling task is a worker of xPool it runs
+ * other jobs while it waits.
+ *
+ * @return pdPASS if all the jobs in the group completed, or pdFAIL if
+ * xTicksToWait ticks passed first.
+ *
+ * \defgroup xJobGroupWait xJobGroupWait
+ * \ingroup JobPool
+ */
+BaseType_t xJobGroupWait( JobPoolHandle_t xPool, JobGroup_t *pxGroup, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * job_pool.h
+ *<pre>
+ BaseType_t xJobPoolFence( JobPoolHandle_t xPool, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Wait until every job submitted to the pool, whether or not it belongs to a
+ * group, has completed.  Only one task can wait on the fence of a given pool at
+ * a time, and a job must not wait on the fence of the pool running it.
+ *
+ * @return pdPASS if the pool has no jobs left, or pdFAIL if xTicksToWait ticks
+ * passed first.
+ *
+ * \defgroup xJobPoolFence xJobPoolFence
+ * \ingroup JobPool
+ */
+BaseType_t xJobPoolFence( JobPoolHandle_t xPool, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JOB_POOL_H */
+
@@ -0,0 +1,129 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef MEM_OPS_H
+#define MEM_OPS_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include mem_ops.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Memory operations that move whole words, used in place of the C library's
+ * byte oriented memcpy() and memset().  Once the destination is word aligned
+ * the data is moved a word at a time, and on Cortex-M3/M4 in bursts of LDM and
+ * STM instructions, which transfer several words for each instruction fetched.
+ * A source that is not aligned with the destination is read with unaligned
+ * word loads, which the Cortex-M3/M4 perform in hardware.  On other processors
+ * the same algorithm is written in C, which is also what the host simulation
+ * checks.
+ *
+ * When configUSE_MEM_OPS is set to 1 in FreeRTOSConfig.h the kernel copies
+ * queue items and stream buffer data with pvMemCopy() (see configMEMCPY() in
+ * FreeRTOS.h).  The functions can be called from any task or interrupt, as
+ * they only touch the memory they are given.
+ *
+ * \defgroup MemOps
+ */
+
+/**
+ * mem_ops.h
+ *<pre>
+ void *pvMemCopy( void *pvDest, const void *pvSource, size_t xLength );
+ </pre>
+ *
+ * Copy xLength bytes from pvSource to pvDest, as memcpy().  The two must not
+ * overlap.
+ *
+ * @return pvDest.
+ *
+ * \defgroup pvMemCopy pvMemCopy
+ * \ingroup MemOps
+ */
+void *pvMemCopy( void *pvDest, const void *pvSource, size_t xLength );
+
+/**
+ * mem_ops.h
+ *<pre>
+ void *pvMemSet( void *pvDest, int iValue, size_t xLength );
+ </pre>
+ *
+ * Set xLength bytes at pvDest to the low byte of iValue, as memset().
+ *
+ * @return pvDest.
+ *
+ * \defgroup pvMemSet pvMemSet
+ * \ingroup MemOps
+ */
+void *pvMemSet( void *pvDest, int iValue, size_t xLength );
+
+/**
+ * mem_ops.h
+ *<pre>
+ BaseType_t xMemCompare( const void *pv1, const void *pv2, size_t xLength );
+ </pre>
+ *
+ * Compare xLength bytes of pv1 and pv2 as unsigned bytes, as memcmp().
+ *
+ * @return 0 if they are equal, otherwise the first byte of pv1 that differs
+ * minus the byte of pv2 at the same offset.
+ *
+ * \defgroup xMemCompare xMemCompare
+ * \ingroup MemOps
+ */
+BaseType_t xMemCompare( const void *pv1, const void *pv2, size_t xLength );
+
+/**
+ * mem_ops.h
+ *<pre>
+ uint16_t usMemChecksum( const void *pvData, size_t xLength, uint16_t usInitial );
+ </pre>
+ *
+ * Add xLength bytes at pvData, taken as big endian 16-bit words, to usInitial
+ * in ones' complement arithmetic, as the checksums of IP, UDP and TCP do (RFC
+ * 1071).  An odd last byte is padded with a zero.  Data in several parts can
+ * be summed by passing the result of one part as usInitial of the next, as
+ * long as every part but the last has an even length.  Start from 0, and
+ * store the complement of the final sum in the header, high byte first.
+ *
+ * @return The ones' complement sum, which is 0xFFFF (or 0 if every byte
+ * and usInitial are 0) over data that holds its own correct checksum.
+ *
+ * \defgroup usMemChecksum usMemChecksum
+ * \ingroup MemOps
+ */
+uint16_t usMemChecksum( const void *pvData, size_t xLength, uint16_t usInitial );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEM_OPS_H */
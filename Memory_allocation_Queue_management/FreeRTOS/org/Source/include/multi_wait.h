@@ -0,0 +1,192 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef MULTI_WAIT_H
+#define MULTI_WAIT_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include multi_wait.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "queue.h"
+#include "event_groups.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A multi-wait allows a task to block on several queues, semaphores and event
+ * groups at once without the extra queue and the additional copy on every send
+ * that a queue set requires.  The calling task provides an array of
+ * MultiWaitObject_t structures, one per object, and each structure contains the
+ * list item that is placed in the object's waiting list while the task is
+ * blocked.  The same task control block is therefore referenced from several
+ * event lists at once, and the first object to become available unblocks the
+ * task and removes it from all the others.
+ *
+ * Setting up a wait is O(N) in the number of objects.  Unblocking the task is
+ * O(1) for the object that fires - the list items left in the other objects'
+ * lists are removed by the unblocked task itself, not by the ISR or task that
+ * caused the unblock.
+ *
+ * As with queue sets, xMultiWaitForAny() only reports which object became
+ * available.  The data (or semaphore, or event bits) must then be obtained
+ * using the normal API with a block time of zero.
+ *
+ * configUSE_MULTI_WAIT must be set to 1 in FreeRTOSConfig.h for the multi-wait
+ * functionality to be available.
+ *
+ * \defgroup MultiWait
+ */
+
+/* Object types that can be placed in a MultiWaitObject_t. */
+#define multiwaitTYPE_QUEUE				( ( uint8_t ) 0U )
+#define multiwaitTYPE_EVENT_GROUP		( ( uint8_t ) 1U )
+
+/* Returned by xMultiWaitForAny() when no object became available before the
+block time expired. */
+#define multiwaitTIMEOUT				( ( BaseType_t ) -1 )
+
+/*
+ * Describes one object within a multi-wait.  The structure members are
+ * obtained and set using the vMultiWaitSet...() macros below and are not
+ * intended to be accessed directly by the application.  xWaitListItem MUST
+ * remain the first member as the scheduler converts from the list item to the
+ * object description.
+ */
+typedef struct xMULTI_WAIT_OBJECT
+{
+	ListItem_t xWaitListItem;		/*< Referenced from the object's waiting list while the calling task is blocked. */
+	void *pvObject;					/*< The queue, semaphore or event group handle. */
+	EventBits_t uxBitsToWaitFor;	/*< Event groups only - the bits to wait for. */
+	BaseType_t xWaitForAllBits;		/*< Event groups only - pdTRUE to wait for all of uxBitsToWaitFor. */
+	uint8_t ucObjectType;			/*< One of the multiwaitTYPE_ constants. */
+} MultiWaitObject_t;
+
+/**
+ * multi_wait.h
+ *<pre>
+ void vMultiWaitSetQueue( MultiWaitObject_t *pxObject, QueueHandle_t xQueue );
+ void vMultiWaitSetSemaphore( MultiWaitObject_t *pxObject, SemaphoreHandle_t xSemaphore );
+ void vMultiWaitSetEventGroup( MultiWaitObject_t *pxObject, EventGroupHandle_t xEventGroup, EventBits_t uxBitsToWaitFor, BaseType_t xWaitForAllBits );
+ </pre>
+ *
+ * Describe the object that pxObject refers to.  A queue is available when it
+ * contains at least one item.  A binary or counting semaphore is available
+ * when it can be taken.  Mutexes cannot be used as the priority inheritance
+ * mechanism requires the task to be blocked on the mutex alone.  An event
+ * group is available when the bits in uxBitsToWaitFor are set, using the same
+ * rules as xEventGroupWaitBits(), but the bits are never cleared on exit.
+ *
+ * \defgroup vMultiWaitSetQueue vMultiWaitSetQueue
+ * \ingroup MultiWait
+ */
+#define vMultiWaitSetQueue( pxObject, xQueue )										\
+{																					\
+	( pxObject )->pvObject = ( void * ) ( xQueue );									\
+	( pxObject )->uxBitsToWaitFor = ( EventBits_t ) 0;								\
+	( pxObject )->xWaitForAllBits = pdFALSE;										\
+	( pxObject )->ucObjectType = multiwaitTYPE_QUEUE;								\
+}
+
+#define vMultiWaitSetSemaphore( pxObject, xSemaphore ) vMultiWaitSetQueue( ( pxObject ), ( xSemaphore ) )
+
+#define vMultiWaitSetEventGroup( pxObject, xEventGroup, uxBits, xWaitForAll )		\
+{																					\
+	( pxObject )->pvObject = ( void * ) ( xEventGroup );							\
+	( pxObject )->uxBitsToWaitFor = ( uxBits );										\
+	( pxObject )->xWaitForAllBits = ( xWaitForAll );								\
+	( pxObject )->ucObjectType = multiwaitTYPE_EVENT_GROUP;							\
+}
+
+/**
+ * multi_wait.h
+ *<pre>
+ BaseType_t xMultiWaitForAny( MultiWaitObject_t *pxObjects, UBaseType_t uxObjectCount, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Block the calling task until one of the objects described by pxObjects
+ * becomes available, or xTicksToWait ticks pass.
+ *
+ * The array must remain valid until the function returns, and must not be
+ * shared with any other task.  A stack allocated array is fine.
+ *
+ * @param pxObjects An array of uxObjectCount object descriptions, each
+ * initialised using one of the vMultiWaitSet...() macros.
+ *
+ * @param uxObjectCount The number of objects in the pxObjects array.
+ *
+ * @param xTicksToWait The maximum time to wait for an object to become
+ * available.  Set to portMAX_DELAY to wait indefinitely (INCLUDE_vTaskSuspend
+ * must be 1), or 0 to only poll the objects.
+ *
+ * @return The index into pxObjects of the object that became available, or
+ * multiwaitTIMEOUT if no object became available within xTicksToWait.  If more
+ * than one object is already available when the function is called then the
+ * lowest index is returned.
+ *
+ * Example usage:
+ <pre>
+ void vAFunction( QueueHandle_t xRxQueue, SemaphoreHandle_t xButton, EventGroupHandle_t xLinkEvents )
+ {
+ MultiWaitObject_t xObjects[ 3 ];
+ uint32_t ulReceived;
+
+	vMultiWaitSetQueue( &( xObjects[ 0 ] ), xRxQueue );
+	vMultiWaitSetSemaphore( &( xObjects[ 1 ] ), xButton );
+	vMultiWaitSetEventGroup( &( xObjects[ 2 ] ), xLinkEvents, LINK_UP_BIT | LINK_DOWN_BIT, pdFALSE );
+
+	for( ;; )
+	{
+		switch( xMultiWaitForAny( xObjects, 3, portMAX_DELAY ) )
+		{
+			case 0 :	( void ) xQueueReceive( xRxQueue, &ulReceived, 0 );
+						break;
+
+			case 1 :	( void ) xSemaphoreTake( xButton, 0 );
+						break;
+
+			case 2 :	( void ) xEventGroupClearBits( xLinkEvents, LINK_UP_BIT | LINK_DOWN_BIT );
+						break;
+
+			default :	break;
+		}
+	}
+ }
+ </pre>
+ * \defgroup xMultiWaitForAny xMultiWaitForAny
+ * \ingroup MultiWait
+ */
+BaseType_t xMultiWaitForAny( MultiWaitObject_t *pxObjects, UBaseType_t uxObjectCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MULTI_WAIT_H */
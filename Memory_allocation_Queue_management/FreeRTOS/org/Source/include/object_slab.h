@@ -0,0 +1,132 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef OBJECT_SLAB_H
+#define OBJECT_SLAB_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include object_slab.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Object slabs are fixed pools of task control blocks, task stacks, queues and
+ * timers, reserved when the application is linked.  When configUSE_OBJECT_SLABS
+ * is set to 1 in FreeRTOSConfig.h, xTaskCreate(), xQueueGenericCreate() and
+ * xTimerCreate() take their memory from the slabs, and the delete functions
+ * return it, in constant time and without walking the heap.  Startup time and
+ * heap fragmentation therefore no longer depend on the order objects are
+ * created and deleted in.
+ *
+ * Each slab is a free list of equal sized blocks.  A request that is larger
+ * than the blocks of its slab, or made when the slab is empty, falls back to the
+ * heap and is counted, so the slabs can be sized from vSlabGetStats().  Task
+ * stacks have a small and a large slab, and are taken from the smallest that
+ * fits.  A queue block holds the queue and up to configSLAB_QUEUE_STORAGE_SIZE
+ * bytes of items.
+ *
+ * When configSUPPORT_STATIC_ALLOCATION is also 1, the idle and timer tasks are
+ * given statically allocated memory by this file, so the application must not
+ * define vApplicationGetIdleTaskMemory() or vApplicationGetTimerTaskMemory().
+ *
+ * Configuration (all optional):
+ *
+ * configSLAB_TASK_COUNT - the number of task control blocks.
+ *
+ * configSLAB_SMALL_STACK_DEPTH, configSLAB_SMALL_STACK_COUNT - the depth in
+ * words and number of the small task stacks.
+ *
+ * configSLAB_LARGE_STACK_DEPTH, configSLAB_LARGE_STACK_COUNT - the same for
+ * the large task stacks.
+ *
+ * configSLAB_QUEUE_COUNT, configSLAB_QUEUE_STORAGE_SIZE - the number of
+ * queues, and the bytes of item storage each one can have.
+ *
+ * configSLAB_TIMER_COUNT - the number of timers.
+ *
+ * Every count must be at least 1.
+ *
+ * \defgroup ObjectSlab
+ */
+
+/* The slabs.  vSlabGetStats() reports on each one. */
+typedef enum
+{
+	eSlabTask = 0,			/* StaticTask_t sized task control blocks. */
+	eSlabSmallStack,		/* configSLAB_SMALL_STACK_DEPTH word stacks. */
+	eSlabLargeStack,		/* configSLAB_LARGE_STACK_DEPTH word stacks. */
+	eSlabQueue,				/* StaticQueue_t sized queues with configSLAB_QUEUE_STORAGE_SIZE bytes of storage. */
+	eSlabTimer,				/* StaticTimer_t sized timers. */
+	eSlabNumberOfSlabs
+} eSlab;
+
+/* Used to pass information about a slab out of vSlabGetStats(). */
+typedef struct xSLAB_STATS
+{
+	size_t xBlockSizeInBytes;			/* The size of each block in the slab. */
+	UBaseType_t uxNumberOfBlocks;		/* The number of blocks in the slab. */
+	UBaseType_t uxBlocksInUse;			/* The number of blocks allocated now. */
+	UBaseType_t uxMaximumBlocksInUse;	/* The most blocks that have been allocated at once. */
+	UBaseType_t uxHeapFallbacks;		/* The number of requests given to the heap because the slab was full or the request too large. */
+} SlabStats_t;
+
+/**
+ * object_slab.h
+ *<pre>
+ void vSlabGetStats( eSlab eSlabToQuery, SlabStats_t *pxSlabStats );
+ </pre>
+ *
+ * Fill a SlabStats_t structure with the occupancy of one slab.  If
+ * uxMaximumBlocksInUse stays well below uxNumberOfBlocks the slab can be made
+ * smaller, and if uxHeapFallbacks is not 0 it is too small (or, for the stack
+ * slabs, a task needs a larger stack than the slab provides).
+ *
+ * \defgroup vSlabGetStats vSlabGetStats
+ * \ingroup ObjectSlab
+ */
+void vSlabGetStats( eSlab eSlabToQuery, SlabStats_t *pxSlabStats ) PRIVILEGED_FUNCTION;
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  They are used by the
+ * kernel through pvPortMallocTCB(), pvPortMallocStack(), pvPortMallocQueue(),
+ * pvPortMallocTimer() and vPortFreeObject() (see FreeRTOS.h) when
+ * configUSE_OBJECT_SLABS is 1.  pvSlabAlloc() takes a block of at least
+ * xWantedSize bytes from eSlabToUse, or from the heap if it cannot.
+ * eSlabSmallStack selects whichever stack slab fits best.  vSlabFree() returns
+ * a block to its slab, or to the heap if it did not come from a slab.
+ */
+void *pvSlabAlloc( eSlab eSlabToUse, size_t xWantedSize ) PRIVILEGED_FUNCTION;
+void vSlabFree( void *pv ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OBJECT_SLAB_H */
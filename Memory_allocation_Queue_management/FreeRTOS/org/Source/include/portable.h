@@ -157,6 +157,73 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEG
  */
 void vPortGetHeapStats( HeapStats_t *pxHeapStats );
 
+/* Placement hints for pvPortMallocHint(), used by heap_regions.c.  A hint says
+what an allocation will be used for.  Each region of the heap lists the hints
+it is preferred for and the hints it accepts when no preferred region has
+space. */
+typedef enum
+{
+	eHeapHintGeneral = 0,	/* Anything without a better hint - used by pvPortMalloc(). */
+	eHeapHintTCB,			/* Task control blocks, read on every context switch. */
+	eHeapHintStack,			/* Task stacks. */
+	eHeapHintDMA,			/* Buffers read or written by a DMA controller. */
+	eHeapHintRarelyUsed,	/* Data used rarely enough to be placed in slower memory. */
+	eHeapNumberOfHints		/* Must be last. */
+} eHeapHint;
+
+/* Build the hint masks of a HeapRegionWithHints_t structure. */
+#define heapHINT_BIT( eHint )	( ( UBaseType_t ) 1U << ( eHint ) )
+#define heapHINT_ALL			( heapHINT_BIT( eHeapNumberOfHints ) - ( UBaseType_t ) 1U )
+
+/* Used by heap_regions.c to define a region of the heap and the placement hints
+it is used for. */
+typedef struct HeapRegionWithHints
+{
+	uint8_t *pucStartAddress;
+	size_t xSizeInBytes;
+	const char *pcName;				/* Reported by xPortGetHeapRegionStats().  Can be NULL. */
+	UBaseType_t uxPreferredHints;	/* heapHINT_BIT() of each hint the region is tried first for. */
+	UBaseType_t uxAcceptedHints;	/* heapHINT_BIT() of each hint the region is tried for when no preferred region has space. */
+} HeapRegionWithHints_t;
+
+/* Used to pass information about one region of the heap out of
+xPortGetHeapRegionStats(). */
+typedef struct xHeapRegionStats
+{
+	const char *pcName;				/* The name given to the region when it was defined. */
+	uint8_t *pucStartAddress;		/* The first usable byte of the region. */
+	size_t xTotalHeapSpaceInBytes;	/* The space in the region available for allocation when it was defined. */
+	HeapStats_t xStats;				/* As returned by vPortGetHeapStats(), but for this region only. */
+} HeapRegionStats_t;
+
+/*
+ * Used to define the regions of the heap for use by heap_regions.c.  This
+ * function must be called before any calls to pvPortMalloc().
+ *
+ * pxHeapRegions passes in an array of HeapRegionWithHints_t structures
+ * terminated by a structure that has a size of 0.  The regions can be in any
+ * address order.  An allocation is made from the first region in the array
+ * that prefers its hint and has space, then from the first that accepts its
+ * hint and has space.  The array index of a region is the uxRegion parameter of
+ * xPortGetHeapRegionStats().  vPortDefineHeapRegions() can be used instead, in
+ * which case every region is preferred for every hint.
+ */
+void vPortDefineHeapRegionsWithHints( const HeapRegionWithHints_t * const pxHeapRegions ) PRIVILEGED_FUNCTION;
+
+/*
+ * Allocate memory from the regions of the heap suited to eHint.  Only
+ * heap_regions.c implements this function - see pvPortMallocTCB() and
+ * pvPortMallocStack() in FreeRTOS.h for how the kernel uses it.
+ */
+void *pvPortMallocHint( size_t xWantedSize, eHeapHint eHint ) PRIVILEGED_FUNCTION;
+
+/*
+ * Fill a HeapRegionStats_t structure with information about the region at
+ * index uxRegion of the array passed to vPortDefineHeapRegionsWithHints().
+ * Returns pdFAIL if there is no such region.
+ */
+BaseType_t xPortGetHeapRegionStats( UBaseType_t uxRegion, HeapRegionStats_t *pxRegionStats ) PRIVILEGED_FUNCTION;
+
 /*
  * Map to the memory management routines required for the port.
  */
@@ -166,6 +233,18 @@ void vPortInitialiseBlocks( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Allocate one of the configHEAP_ISR_BLOCK_COUNT blocks reserved for
+ * interrupts, in constant time.  Returns NULL if xSize is greater than
+ * configHEAP_ISR_BLOCK_SIZE or all the blocks are in use.  The block can be
+ * freed by vPortFreeFromISR() or vPortFree().  Provided by heap_4.c and
+ * heap_regions.c when configHEAP_ISR_BLOCK_COUNT is greater than 0.
+ */
+void *pvPortMallocFromISR( size_t xSize ) PRIVILEGED_FUNCTION;
+void vPortFreeFromISR( void *pv ) PRIVILEGED_FUNCTION;
+size_t xPortGetFreeIsrBlockCount( void ) PRIVILEGED_FUNCTION;
+size_t xPortGetMinimumEverFreeIsrBlockCount( void ) PRIVILEGED_FUNCTION;
+
 /*
  * Setup the hardware ready for the scheduler to take control.  This generally
  * sets up a tick interrupt and sets timers for the correct tick frequency.
@@ -1645,6 +1645,7 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue, BaseType_t xNewQueue ) PRIV
 void vQueueSetQueueNumber( QueueHandle_t xQueue, UBaseType_t uxQueueNumber ) PRIVILEGED_FUNCTION;
 UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 uint8_t ucQueueGetQueueType( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+BaseType_t xQueueMultiWaitArm( QueueHandle_t xQueue, ListItem_t * const pxWaitListItem ) PRIVILEGED_FUNCTION;
 
 
 #ifdef __cplusplus
@@ -0,0 +1,161 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef STACK_PROFILER_H
+#define STACK_PROFILER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include stack_profiler.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The stack profiler records the most stack each task has used, and from it
+ * recommends the depth to give the task in xTaskCreate().  When
+ * configUSE_STACK_PROFILER is set to 1 in FreeRTOSConfig.h, a software timer
+ * started by xStackProfilerStart() samples the high water mark of every task
+ * with uxTaskGetSystemState() - the value uxTaskGetStackHighWaterMark2()
+ * returns.  The record of a task is kept after the task is deleted, so tasks
+ * that only run for a short time are also sized.
+ *
+ * A stack must hold the most the task uses, plus an exception frame when an
+ * interrupt arrives at that moment, which the high water mark may not have
+ * seen.  The recommended depth is therefore the most used, plus
+ * configSTACK_PROFILER_MARGIN_PERCENT percent, plus
+ * configSTACK_PROFILER_MARGIN_WORDS words, rounded up to a multiple of eight
+ * words.
+ *
+ * The profiler only reports on how close a task came to the end of its stack.
+ * Set configCHECK_FOR_STACK_OVERFLOW, and configSTACK_OVERFLOW_WATCHPOINT on
+ * ports that provide it, to catch a stack that overflows.
+ *
+ * Configuration (all optional):
+ *
+ * configSTACK_PROFILER_MAX_TASKS - the number of tasks recorded, including
+ * tasks that have been deleted.  It must be at least the number of tasks that
+ * exist at once, otherwise uxTaskGetSystemState() cannot report them and the
+ * sample is skipped.
+ *
+ * configSTACK_PROFILER_MARGIN_PERCENT, configSTACK_PROFILER_MARGIN_WORDS - the
+ * margin added to the most used stack.
+ *
+ * configUSE_TRACE_FACILITY and configUSE_TIMERS must be 1, and when the stack
+ * grows down so must configRECORD_STACK_HIGH_ADDRESS, so the depth of each
+ * stack is known.
+ *
+ * \defgroup StackProfiler
+ */
+
+/* Used to pass the record of one task out of uxStackProfilerGetReport().
+Depths are in words, as passed to xTaskCreate(). */
+typedef struct xSTACK_PROFILE
+{
+	char pcTaskName[ configMAX_TASK_NAME_LEN ];	/* A copy of the task's name, so it is valid after the task is deleted. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	UBaseType_t xTaskNumber;					/* The number unique to the task, as in TaskStatus_t. */
+	configSTACK_DEPTH_TYPE uxStackDepth;		/* The depth of the task's stack. */
+	configSTACK_DEPTH_TYPE uxMaximumUsed;		/* The most of the stack the task has been seen to use. */
+	configSTACK_DEPTH_TYPE uxRecommendedDepth;	/* The depth recommended for the task. */
+	BaseType_t xDeleted;						/* pdTRUE if the task no longer exists. */
+} StackProfile_t;
+
+/**
+ * stack_profiler.h
+ *<pre>
+ BaseType_t xStackProfilerStart( TickType_t xSamplePeriod );
+ </pre>
+ *
+ * Start the timer that samples every task each xSamplePeriod ticks.  Can be
+ * called before the scheduler is started.  Sampling scans the stack of every
+ * task with the scheduler suspended, so the period is normally hundreds of
+ * milliseconds.
+ *
+ * @param xSamplePeriod The time between samples, in ticks.
+ *
+ * @return pdPASS if the timer was started, otherwise pdFAIL.
+ *
+ * \defgroup xStackProfilerStart xStackProfilerStart
+ * \ingroup StackProfiler
+ */
+BaseType_t xStackProfilerStart( TickType_t xSamplePeriod ) PRIVILEGED_FUNCTION;
+
+/**
+ * stack_profiler.h
+ *<pre>
+ void vStackProfilerSample( void );
+ </pre>
+ *
+ * Sample the high water mark of every task now, for example just before a
+ * report is taken.  Must not be called from an interrupt.
+ *
+ * \defgroup vStackProfilerSample vStackProfilerSample
+ * \ingroup StackProfiler
+ */
+void vStackProfilerSample( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * stack_profiler.h
+ *<pre>
+ UBaseType_t uxStackProfilerGetReport( StackProfile_t *pxReport, UBaseType_t uxReportLength );
+ </pre>
+ *
+ * Copy the record of each task into pxReport, in the order the tasks were
+ * first seen.  Give each task the uxRecommendedDepth of its record in
+ * xTaskCreate() once the application has been through all of its paths.
+ *
+ * @param pxReport The array the records are copied to.
+ *
+ * @param uxReportLength The number of records pxReport can hold.
+ *
+ * @return The number of records copied.
+ *
+ * \defgroup uxStackProfilerGetReport uxStackProfilerGetReport
+ * \ingroup StackProfiler
+ */
+UBaseType_t uxStackProfilerGetReport( StackProfile_t *pxReport, UBaseType_t uxReportLength ) PRIVILEGED_FUNCTION;
+
+/**
+ * stack_profiler.h
+ *<pre>
+ UBaseType_t uxStackProfilerGetSkippedSamples( void );
+ </pre>
+ *
+ * @return The number of samples skipped because more tasks existed than
+ * configSTACK_PROFILER_MAX_TASKS.
+ *
+ * \defgroup uxStackProfilerGetSkippedSamples uxStackProfilerGetSkippedSamples
+ * \ingroup StackProfiler
+ */
+UBaseType_t uxStackProfilerGetSkippedSamples( void ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STACK_PROFILER_H */
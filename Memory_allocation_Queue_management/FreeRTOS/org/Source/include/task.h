@@ -144,6 +144,14 @@ typedef struct xTASK_STATUS
 	UBaseType_t uxBasePriority;		/* The priority to which the task will return if the task's current priority has been inherited to avoid unbounded priority inversion when obtaining a mutex.  Only valid if configUSE_MUTEXES is defined as 1 in FreeRTOSConfig.h. */
 	uint32_t ulRunTimeCounter;		/* The total run time allocated to the task so far, as defined by the run time stats clock.  See http://www.freertos.org/rtos-run-time-stats.html.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
 	StackType_t *pxStackBase;		/* Points to the lowest address of the task's stack area. */
+	#if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+		StackType_t *pxEndOfStack;	/* Points to the end of the task's stack area - the highest address when the stack grows down. */
+	#endif
+	#if ( configUSE_FPU_CONTEXT_STATS == 1 )
+		uint32_t ulContextSwitches;	/* The number of times the task's context has been saved. */
+		uint32_t ulFPUContextSaves;	/* The number of those saves that included the floating point registers. */
+		BaseType_t xFPUFree;		/* pdTRUE if the task was set free of the floating point unit by vTaskSetFPUFree() and has not used it since. */
+	#endif
 	configSTACK_DEPTH_TYPE usStackHighWaterMark;	/* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
 } TaskStatus_t;
 
@@ -162,6 +170,14 @@ typedef enum
  */
 #define tskIDLE_PRIORITY			( ( UBaseType_t ) 0U )
 
+/**
+ * Core affinity mask that allows a task to run on any core.  This is the
+ * affinity given to every task when it is created.
+ *
+ * \ingroup TaskUtils
+ */
+#define tskNO_AFFINITY				( ( UBaseType_t ) -1 )
+
 /**
  * task. h
  *
@@ -185,7 +201,11 @@ typedef enum
  * \ingroup SchedulerControl
  */
 #define taskENTER_CRITICAL()		portENTER_CRITICAL()
-#define taskENTER_CRITICAL_FROM_ISR() portSET_INTERRUPT_MASK_FROM_ISR()
+#if( configNUMBER_OF_CORES == 1 )
+	#define taskENTER_CRITICAL_FROM_ISR() portSET_INTERRUPT_MASK_FROM_ISR()
+#else
+	#define taskENTER_CRITICAL_FROM_ISR() uxTaskEnterCriticalFromISR()
+#endif
 
 /**
  * task. h
@@ -200,7 +220,11 @@ typedef enum
  * \ingroup SchedulerControl
  */
 #define taskEXIT_CRITICAL()			portEXIT_CRITICAL()
-#define taskEXIT_CRITICAL_FROM_ISR( x ) portCLEAR_INTERRUPT_MASK_FROM_ISR( x )
+#if( configNUMBER_OF_CORES == 1 )
+	#define taskEXIT_CRITICAL_FROM_ISR( x ) portCLEAR_INTERRUPT_MASK_FROM_ISR( x )
+#else
+	#define taskEXIT_CRITICAL_FROM_ISR( x ) vTaskExitCriticalFromISR( x )
+#endif
 /**
  * task. h
  *
@@ -1017,6 +1041,63 @@ void vTaskGetInfo( TaskHandle_t xTask, TaskStatus_t *pxTaskStatus, BaseType_t xG
  */
 void vTaskPrioritySet( TaskHandle_t xTask, UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <pre>void vTaskCoreAffinitySet( const TaskHandle_t xTask, UBaseType_t uxCoreAffinityMask );</pre>
+ *
+ * Only available when configNUMBER_OF_CORES is greater than 1.
+ *
+ * Set the cores a task is allowed to run on.  Bit N of uxCoreAffinityMask is
+ * set if the task is allowed to run on core N.  Tasks are created with an
+ * affinity of tskNO_AFFINITY, which allows them to run on any core.
+ *
+ * If the task is running on a core that is no longer in its affinity mask
+ * then that core is made to switch to another task.
+ *
+ * @param xTask Handle to the task for which the affinity is being set.
+ * Passing a NULL handle results in the affinity of the calling task being set.
+ *
+ * @param uxCoreAffinityMask The cores the task is allowed to run on.  At
+ * least one core that exists must be included.
+ *
+ * Example usage:
+   <pre>
+ void vAFunction( void )
+ {
+ TaskHandle_t xHandle;
+
+	 // Create a task, storing the handle.
+	 xTaskCreate( vTaskCode, "NAME", STACK_SIZE, NULL, tskIDLE_PRIORITY, &xHandle );
+
+	 // Only allow the created task to run on core 1.
+	 vTaskCoreAffinitySet( xHandle, ( 1 << 1 ) );
+ }
+   </pre>
+ * \defgroup vTaskCoreAffinitySet vTaskCoreAffinitySet
+ * \ingroup TaskCtrl
+ */
+#if( configNUMBER_OF_CORES > 1 )
+	void vTaskCoreAffinitySet( const TaskHandle_t xTask, UBaseType_t uxCoreAffinityMask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * <pre>UBaseType_t uxTaskCoreAffinityGet( const TaskHandle_t xTask );</pre>
+ *
+ * Only available when configNUMBER_OF_CORES is greater than 1.
+ *
+ * @param xTask Handle of the task being queried.  Passing a NULL handle
+ * results in the affinity of the calling task being returned.
+ *
+ * @return The core affinity mask of xTask, as set by vTaskCoreAffinitySet().
+ *
+ * \defgroup uxTaskCoreAffinityGet uxTaskCoreAffinityGet
+ * \ingroup TaskCtrl
+ */
+#if( configNUMBER_OF_CORES > 1 )
+	UBaseType_t uxTaskCoreAffinityGet( const TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * <pre>void vTaskSuspend( TaskHandle_t xTaskToSuspend );</pre>
@@ -1371,6 +1452,51 @@ TickType_t xTaskGetTickCount( void ) PRIVILEGED_FUNCTION;
  */
 TickType_t xTaskGetTickCountFromISR( void ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <PRE>uint64_t ullTaskGetMonotonicTimeNs( void );</PRE>
+ *
+ * configUSE_MONOTONIC_CLOCK must be defined as 1, and the port must support
+ * it, for this function to be available.
+ *
+ * @return The time since vTaskStartScheduler was called in nanoseconds.  The
+ * time is made from the tick count, extended to 64 bits, and the count of the
+ * timer that generates the tick interrupt (SysTick on a Cortex-M), so has the
+ * resolution of that timer whatever configTICK_RATE_HZ is set to, and does not
+ * wrap.
+ *
+ * \defgroup ullTaskGetMonotonicTimeNs ullTaskGetMonotonicTimeNs
+ * \ingroup TaskUtils
+ */
+uint64_t ullTaskGetMonotonicTimeNs( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>uint64_t ullTaskGetMonotonicTimeUs( void );</PRE>
+ *
+ * configUSE_MONOTONIC_CLOCK must be defined as 1, and the port must support
+ * it, for this function to be available.
+ *
+ * @return The time since vTaskStartScheduler was called in microseconds.  See
+ * ullTaskGetMonotonicTimeNs().
+ *
+ * \defgroup ullTaskGetMonotonicTimeUs ullTaskGetMonotonicTimeUs
+ * \ingroup TaskUtils
+ */
+uint64_t ullTaskGetMonotonicTimeUs( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>uint64_t ullTaskGetMonotonicTimeUsFromISR( void );</PRE>
+ *
+ * A version of ullTaskGetMonotonicTimeUs() that can be called from an
+ * interrupt service routine.
+ *
+ * \defgroup ullTaskGetMonotonicTimeUsFromISR ullTaskGetMonotonicTimeUsFromISR
+ * \ingroup TaskUtils
+ */
+uint64_t ullTaskGetMonotonicTimeUsFromISR( void ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <PRE>uint16_t uxTaskGetNumberOfTasks( void );</PRE>
@@ -1771,6 +1897,60 @@ void vTaskGetRunTimeStats( char *pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e9
 */
 uint32_t ulTaskGetIdleRunTimeCounter( void ) PRIVILEGED_FUNCTION;
 
+/**
+* task. h
+* <PRE>void vTaskGetFPUContextStats( uint32_t *pulContextSwitches, uint32_t *pulFPUContextSaves );</PRE>
+*
+* configUSE_FPU_CONTEXT_STATS must be defined as 1, and the port must support
+* it, for this function to be available.
+*
+* Obtain the number of times a task's context has been saved since the
+* scheduler started, and how many of those saves also included the floating
+* point registers (s16 to s31 on a Cortex-M4F).  The same counts for each task
+* are in the TaskStatus_t structures filled by uxTaskGetSystemState(), and show
+* which tasks use the floating point unit.
+*
+* @param pulContextSwitches Set to the number of context saves.
+*
+* @param pulFPUContextSaves Set to the number of context saves that included
+* the floating point registers.
+*
+* \defgroup vTaskGetFPUContextStats vTaskGetFPUContextStats
+* \ingroup TaskUtils
+*/
+void vTaskGetFPUContextStats( uint32_t *pulContextSwitches, uint32_t *pulFPUContextSaves ) PRIVILEGED_FUNCTION;
+
+/**
+* task. h
+* <PRE>void vTaskSetFPUFree( void );</PRE>
+*
+* configUSE_FPU_CONTEXT_STATS must be defined as 1, and the port must support
+* it, for this function to be available.
+*
+* Once a task has used the floating point unit, the floating point registers
+* are saved and restored with the rest of its context at every context switch.
+* vTaskSetFPUFree() discards the floating point context of the calling task,
+* so its context switches take the integer only path again until it next uses
+* the floating point unit - for example after a task that only uses floating
+* point while it initialises.
+*
+* The task is free of the floating point unit only until its next floating
+* point instruction, which makes the floating point context live again.  The
+* xFPUFree member of the task's TaskStatus_t reports whether that has happened
+* yet, as it is cleared the first time a context switch saves the floating
+* point registers again.
+*
+* No floating point values may be live when vTaskSetFPUFree() is called,
+* including in the functions that called it, so it is normally called from
+* the outermost loop of the task's implementing function.  Values held in
+* s16 to s31 at the call are not saved at the task's next context switch, and
+* are lost if another task uses the floating point unit.
+*
+* \defgroup vTaskSetFPUFree vTaskSetFPUFree
+* \ingroup TaskUtils
+*/
+void vTaskSetFPUFree( void ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <PRE>BaseType_t xTaskNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction );</PRE>
@@ -2321,6 +2501,93 @@ void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut ) PRIVILEGED_FUNCTION;
  */
 BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut, TickType_t * const pxTicksToWait ) PRIVILEGED_FUNCTION;
 
+/**
+ * task.h
+ * <pre>BaseType_t xTaskCheckForTimeOutUs( const uint64_t ullDeadlineUs, TickType_t * const pxTicksToWait );</pre>
+ *
+ * configUSE_MONOTONIC_CLOCK must be defined as 1 for this function to be
+ * available.
+ *
+ * A version of xTaskCheckForTimeOut() for a deadline given as a time of the
+ * monotonic clock (see ullTaskGetMonotonicTimeUs()).  If the deadline has not
+ * passed, pxTicksToWait is set to the block time to pass to an API function so
+ * the task unblocks at the first tick at or after the deadline.
+ *
+ * @param ullDeadlineUs The time, in microseconds, at which the timeout occurs.
+ *
+ * @param pxTicksToWait Set to the number of ticks to block for.
+ *
+ * @return If the deadline has passed pdTRUE is returned, otherwise pdFALSE.
+ *
+ * Example Usage:
+ * <pre>
+	// Receive from a queue, giving up 1.5ms after the call.
+	BaseType_t xReceiveWithin1500Us( QueueHandle_t xQueue, void *pvItem )
+	{
+	const uint64_t ullDeadlineUs = ullTaskGetMonotonicTimeUs() + 1500;
+	TickType_t xTicksToWait;
+
+		while( xTaskCheckForTimeOutUs( ullDeadlineUs, &xTicksToWait ) == pdFALSE )
+		{
+			if( xQueueReceive( xQueue, pvItem, xTicksToWait ) == pdPASS )
+			{
+				return pdPASS;
+			}
+		}
+
+		return pdFAIL;
+	}
+   </pre>
+ * \defgroup xTaskCheckForTimeOutUs xTaskCheckForTimeOutUs
+ * \ingroup TaskCtrl
+ */
+BaseType_t xTaskCheckForTimeOutUs( const uint64_t ullDeadlineUs, TickType_t * const pxTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * task.h
+ * <pre>void vTaskDelayUntilUs( uint64_t * const pullPreviousWakeTimeUs, const uint64_t ullTimeIncrementUs );</pre>
+ *
+ * configUSE_MONOTONIC_CLOCK must be defined as 1 for this function to be
+ * available.
+ *
+ * A version of vTaskDelayUntil() with times in microseconds of the monotonic
+ * clock, so a periodic task is not limited to a whole number of tick periods.
+ * The task is blocked until the first tick interrupt at or after the wake time,
+ * so it wakes up to one tick period late.  The wake times do not drift, as each
+ * is the previous wake time plus ullTimeIncrementUs.
+ *
+ * If the wake time is no more than configDELAY_US_MAX_SPIN_US after a tick
+ * interrupt, the task is instead blocked until that tick interrupt and then
+ * waits for the rest of the time without blocking, during which tasks of equal
+ * and lower priority do not run.  configDELAY_US_MAX_SPIN_US defaults to 0, so
+ * the task never waits without blocking, and must be less than half a tick
+ * period.
+ *
+ * @param pullPreviousWakeTimeUs The time at which the task was last unblocked,
+ * initialised from ullTaskGetMonotonicTimeUs() before the first call and
+ * updated by vTaskDelayUntilUs().
+ *
+ * @param ullTimeIncrementUs The period of the task in microseconds.
+ *
+ * \defgroup vTaskDelayUntilUs vTaskDelayUntilUs
+ * \ingroup TaskCtrl
+ */
+void vTaskDelayUntilUs( uint64_t * const pullPreviousWakeTimeUs, const uint64_t ullTimeIncrementUs ) PRIVILEGED_FUNCTION;
+
+/**
+ * task.h
+ * <pre>void vTaskDelayUs( const uint32_t ulMicroseconds );</pre>
+ *
+ * configUSE_MONOTONIC_CLOCK must be defined as 1 for this function to be
+ * available.
+ *
+ * Delay the calling task for ulMicroseconds, as vTaskDelayUntilUs().
+ *
+ * \defgroup vTaskDelayUs vTaskDelayUs
+ * \ingroup TaskCtrl
+ */
+void vTaskDelayUs( const uint32_t ulMicroseconds ) PRIVILEGED_FUNCTION;
+
 /*-----------------------------------------------------------
  * SCHEDULER INTERNALS AVAILABLE FOR PORTING PURPOSES
  *----------------------------------------------------------*/
@@ -2533,6 +2800,55 @@ TaskHandle_t pvTaskIncrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
  */
 void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut ) PRIVILEGED_FUNCTION;
 
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
+ * THE MULTI-WAIT MODULE, AND MUST BE CALLED WITH THE SCHEDULER SUSPENDED.
+ *
+ * vTaskMultiWaitEnter() makes the list item within each of the uxObjectCount
+ * MultiWaitObject_t structures in pxObjects reference the calling task.
+ * xTaskMultiWaitBlock() then places the calling task in the Blocked state if
+ * none of the objects have unblocked it already, returning pdTRUE if it did so.
+ * xTaskMultiWaitExit() removes any list items still referenced from an event
+ * list and returns the index of the object that unblocked the task, or
+ * multiwaitTIMEOUT.  The structure is only forward declared here so task.h
+ * does not depend on multi_wait.h.
+ */
+#if( configUSE_MULTI_WAIT == 1 )
+	struct xMULTI_WAIT_OBJECT;
+	void vTaskMultiWaitEnter( struct xMULTI_WAIT_OBJECT * const pxObjects, const UBaseType_t uxObjectCount ) PRIVILEGED_FUNCTION;
+	BaseType_t xTaskMultiWaitBlock( const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+	BaseType_t xTaskMultiWaitExit( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
+ * THE TASK ARENA MODULE TO GET AND SET THE ARENA OF THE CALLING TASK.  The
+ * structure is only forward declared here so task.h does not depend on
+ * task_arena.h.
+ */
+#if( configUSE_TASK_ARENA == 1 )
+	struct xTASK_ARENA;
+	struct xTASK_ARENA *pxTaskGetArena( void ) PRIVILEGED_FUNCTION;
+	void vTaskSetArena( struct xTASK_ARENA *pxArena ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE ONLY
+ * AVAILABLE WHEN configNUMBER_OF_CORES IS GREATER THAN 1, AND ARE USED BY THE
+ * PORT LAYER TO IMPLEMENT portENTER_CRITICAL()/portEXIT_CRITICAL(), AND BY
+ * taskENTER_CRITICAL_FROM_ISR()/taskEXIT_CRITICAL_FROM_ISR().
+ *
+ * As well as masking interrupts on the calling core these take the kernel
+ * spinlocks provided by the port, so the kernel data is also protected from
+ * the other cores.
+ */
+#if( configNUMBER_OF_CORES > 1 )
+	void vTaskEnterCritical( void ) PRIVILEGED_FUNCTION;
+	void vTaskExitCritical( void ) PRIVILEGED_FUNCTION;
+	UBaseType_t uxTaskEnterCriticalFromISR( void ) PRIVILEGED_FUNCTION;
+	void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus ) PRIVILEGED_FUNCTION;
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,227 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef TASK_ARENA_H
+#define TASK_ARENA_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include task_arena.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A task arena is a block of memory owned by one task, from which that task
+ * allocates by moving a pointer forward (bump allocation).  Individual
+ * allocations are never freed.  Instead the task records a mark, builds its
+ * transient data structures, then rewinds to the mark (or resets the arena)
+ * to release everything allocated since in one step.
+ *
+ * Only the task that owns an arena can allocate from it, so allocating does
+ * not suspend the scheduler or enter a critical section, takes a constant
+ * time, and cannot fragment the FreeRTOS heap.  The arena itself is one heap
+ * allocation (or a buffer supplied by the application) that is referenced from
+ * the task's TCB, and is released automatically when the task is deleted.
+ *
+ * Memory obtained from an arena must not be used after the arena is rewound
+ * past it, reset, deleted, or after the owning task is deleted - so it must
+ * not be passed to a task that can outlive the allocation.  The arena
+ * functions must not be called from an interrupt.
+ *
+ * configUSE_TASK_ARENA must be set to 1 in FreeRTOSConfig.h for the task arena
+ * functionality to be available.
+ *
+ * \defgroup TaskArena
+ */
+
+/* A position within a task arena, returned by xTaskArenaMark(). */
+typedef size_t TaskArenaMark_t;
+
+/**
+ * task_arena.h
+ *<pre>
+ BaseType_t xTaskArenaCreate( size_t xSizeInBytes );
+ </pre>
+ *
+ * Allocate an arena of xSizeInBytes bytes from the FreeRTOS heap and give it to
+ * the calling task.  A few bytes of the allocation hold the arena's own state,
+ * so slightly less than xSizeInBytes is available to pvTaskArenaAlloc().
+ *
+ * configSUPPORT_DYNAMIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * xTaskArenaCreate() to be available.
+ *
+ * @param xSizeInBytes The size of the arena.
+ *
+ * @return pdPASS if the arena was created.  pdFAIL if the calling task already
+ * has an arena, or there was not enough heap to create it.
+ *
+ * \defgroup xTaskArenaCreate xTaskArenaCreate
+ * \ingroup TaskArena
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	BaseType_t xTaskArenaCreate( size_t xSizeInBytes ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task_arena.h
+ *<pre>
+ BaseType_t xTaskArenaCreateStatic( uint8_t *pucArenaBuffer, size_t xSizeInBytes );
+ </pre>
+ *
+ * As xTaskArenaCreate(), but the arena is the xSizeInBytes bytes at
+ * pucArenaBuffer, which must remain valid until the arena is deleted or the
+ * calling task is deleted.  The buffer is not freed when that happens.
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * xTaskArenaCreateStatic() to be available.
+ *
+ * @return pdPASS if the arena was created.  pdFAIL if the calling task already
+ * has an arena, or the buffer is too small.
+ *
+ * \defgroup xTaskArenaCreateStatic xTaskArenaCreateStatic
+ * \ingroup TaskArena
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	BaseType_t xTaskArenaCreateStatic( uint8_t *pucArenaBuffer, size_t xSizeInBytes ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task_arena.h
+ *<pre>
+ void vTaskArenaDelete( void );
+ </pre>
+ *
+ * Remove the calling task's arena, and return it to the heap if it was created
+ * by xTaskArenaCreate().  This is only needed to release the memory before the
+ * task is deleted, or to replace the arena with one of a different size.
+ *
+ * \defgroup vTaskArenaDelete vTaskArenaDelete
+ * \ingroup TaskArena
+ */
+void vTaskArenaDelete( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * task_arena.h
+ *<pre>
+ void *pvTaskArenaAlloc( size_t xWantedSize );
+ </pre>
+ *
+ * Allocate xWantedSize bytes from the calling task's arena.  The memory is
+ * aligned to portBYTE_ALIGNMENT.
+ *
+ * @return A pointer to the memory, or NULL if the calling task does not have an
+ * arena or there is not enough space left in it.
+ *
+ * Example usage:
+   <pre>
+ void vParseTask( void *pvParameters )
+ {
+ TaskArenaMark_t xMark;
+ Token_t *pxToken;
+
+	xTaskArenaCreate( 2048 );
+
+	for( ;; )
+	{
+		xMark = xTaskArenaMark();
+
+		// Build a temporary list of tokens from the next message.
+		while( xMoreTokens() != pdFALSE )
+		{
+			pxToken = ( Token_t * ) pvTaskArenaAlloc( sizeof( Token_t ) );
+			configASSERT( pxToken );
+			vAddToken( pxToken );
+		}
+
+		vProcessTokens();
+
+		// Release every token at once.
+		vTaskArenaRewind( xMark );
+	}
+ }
+   </pre>
+ * \defgroup pvTaskArenaAlloc pvTaskArenaAlloc
+ * \ingroup TaskArena
+ */
+void *pvTaskArenaAlloc( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * task_arena.h
+ *<pre>
+ TaskArenaMark_t xTaskArenaMark( void );
+ void vTaskArenaRewind( TaskArenaMark_t xMark );
+ void vTaskArenaReset( void );
+ </pre>
+ *
+ * xTaskArenaMark() returns the current position of the calling task's arena.
+ * vTaskArenaRewind() releases everything allocated since xMark was returned.
+ * Marks can be nested, but a mark must not be used after rewinding to an
+ * earlier one.  vTaskArenaReset() releases everything allocated from the
+ * arena.
+ *
+ * \defgroup xTaskArenaMark xTaskArenaMark
+ * \ingroup TaskArena
+ */
+TaskArenaMark_t xTaskArenaMark( void ) PRIVILEGED_FUNCTION;
+void vTaskArenaRewind( TaskArenaMark_t xMark ) PRIVILEGED_FUNCTION;
+void vTaskArenaReset( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * task_arena.h
+ *<pre>
+ size_t xTaskArenaGetFreeSize( void );
+ size_t xTaskArenaGetHighWaterMark( void );
+ </pre>
+ *
+ * xTaskArenaGetFreeSize() returns the number of bytes left in the calling
+ * task's arena.  xTaskArenaGetHighWaterMark() returns the largest number of
+ * bytes that have been in use at once, which can be used to size the arena.
+ * Both return 0 if the calling task does not have an arena.
+ *
+ * \defgroup xTaskArenaGetFreeSize xTaskArenaGetFreeSize
+ * \ingroup TaskArena
+ */
+size_t xTaskArenaGetFreeSize( void ) PRIVILEGED_FUNCTION;
+size_t xTaskArenaGetHighWaterMark( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  It is called by the
+ * scheduler to release the arena of a task that is being deleted.
+ */
+struct xTASK_ARENA;
+void vTaskArenaRelease( struct xTASK_ARENA *pxArena ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TASK_ARENA_H */
@@ -0,0 +1,409 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include trace_recorder.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The trace recorder logs kernel events into a ring of fixed size records in
+ * RAM.  It is included by FreeRTOS.h when configUSE_TRACE_RECORDER is set to 1
+ * in FreeRTOSConfig.h, and defines the trace macros that are otherwise left
+ * empty, so no kernel source file needs to be changed to use it.
+ *
+ * Each record is timestamped using portGET_TRACE_TIMESTAMP(), which on the
+ * Cortex-M4F port is the DWT cycle counter.  A slot in the ring is claimed with
+ * a single atomic increment, so events can be recorded from tasks, interrupts
+ * and (when configNUMBER_OF_CORES > 1) several cores at once without a
+ * critical section.  The record of the running task is implicit - the host
+ * converter tracks the task switched in on each core.
+ *
+ * When the ring is full the oldest events are overwritten, unless
+ * configTRACE_RECORDER_STOP_WHEN_FULL is set to 1, in which case recording
+ * stops.  The recorder is a single statically allocated image, described
+ * below, that can be saved from a debugger or written out by
+ * vTraceRecorderDump(), for example to a UART.  tools/trace_to_json.c
+ * converts the image to the Chrome trace event JSON format, which can be
+ * opened by Perfetto (ui.perfetto.dev) or chrome://tracing.
+ *
+ * Configuration (all optional):
+ *
+ * configTRACE_RECORDER_EVENT_SLOTS - the number of records in the ring, which
+ * must be a power of two.  Each record is 12 bytes.
+ *
+ * configTRACE_RECORDER_NAME_SLOTS - the number of task and object names that
+ * can be stored.  Each name uses traceRECORDER_NAME_LENGTH + 4 bytes.
+ *
+ * configTRACE_RECORDER_CYCLE_BUDGET - the maximum average cost of recording an
+ * event, in timestamp counts, accepted by xTraceRecorderMeasureOverhead().
+ *
+ * \defgroup TraceRecorder
+ */
+
+/* Image layout.  The image starts with a TraceRecorderHeader_t, followed by
+usNameSlots TraceName_t records, followed by ulEventSlots TraceEvent_t records.
+All fields are little endian on the supported targets. */
+#define traceRECORDER_MAGIC				( 0x52545246UL ) /* "FRTR" */
+#define traceRECORDER_VERSION			( 1U )
+#define traceRECORDER_NAME_LENGTH		( 16U )
+
+/* Set in ulFlags if configTRACE_RECORDER_STOP_WHEN_FULL is 1, in which case the
+ring holds the first ulEventSlots events rather than the last. */
+#define traceRECORDER_FLAG_STOP_WHEN_FULL	( 1UL )
+
+typedef struct xTRACE_RECORDER_HEADER
+{
+	uint32_t ulMagic;
+	uint16_t usVersion;
+	uint16_t usNameSlots;
+	uint32_t ulEventSlots;
+	uint32_t ulTimestampHz;				/*< Frequency of the timestamp counter. */
+	uint32_t ulOverhead;				/*< Average timestamp counts per event as measured by xTraceRecorderMeasureOverhead(), or 0. */
+	uint32_t ulCycleBudget;				/*< configTRACE_RECORDER_CYCLE_BUDGET. */
+	volatile uint32_t ulEventsWritten;	/*< Total number of event slots claimed.  The newest event is at ( ulEventsWritten - 1 ) modulo ulEventSlots. */
+	volatile uint32_t ulNamesWritten;
+	volatile uint32_t ulRecording;		/*< Non zero while events are recorded. */
+	uint32_t ulFlags;					/*< traceRECORDER_FLAG_ bits. */
+} TraceRecorderHeader_t;
+
+typedef struct xTRACE_NAME
+{
+	uint32_t ulObject;
+	char cName[ traceRECORDER_NAME_LENGTH ];	/*< Not NUL terminated if the name fills the array. */
+} TraceName_t;
+
+typedef struct xTRACE_EVENT
+{
+	uint32_t ulTimestamp;
+	uint32_t ulObject;					/*< Usually the address of the task or object the event relates to. */
+	uint16_t usParameter;				/*< Event specific, truncated to 16 bits. */
+	uint8_t ucCore;
+	volatile uint8_t ucEvent;			/*< Written last, traceEVENT_NONE while the record is incomplete. */
+} TraceEvent_t;
+
+/* Event codes.  Unless stated otherwise ulObject is the address of the task,
+queue, event group, stream buffer or timer, and the event relates to the task
+running on the core. */
+#define traceEVENT_NONE							( 0U )
+#define traceEVENT_TASK_SWITCHED_IN				( 1U )	/* Parameter is the priority. */
+#define traceEVENT_TASK_READY					( 2U )
+#define traceEVENT_TASK_CREATE					( 3U )	/* Parameter is the name slot, or 0xffff. */
+#define traceEVENT_TASK_DELETE					( 4U )
+#define traceEVENT_TASK_DELAY					( 5U )
+#define traceEVENT_TASK_DELAY_UNTIL				( 6U )	/* Object is the tick count to wake at. */
+#define traceEVENT_TASK_SUSPEND					( 7U )
+#define traceEVENT_TASK_RESUME					( 8U )
+#define traceEVENT_TASK_RESUME_FROM_ISR			( 9U )
+#define traceEVENT_TASK_PRIORITY_SET			( 10U )	/* Parameter is the new priority. */
+#define traceEVENT_TASK_PRIORITY_INHERIT		( 11U )	/* Parameter is the inherited priority. */
+#define traceEVENT_TASK_PRIORITY_DISINHERIT		( 12U )	/* Parameter is the base priority. */
+#define traceEVENT_TICK							( 13U )	/* Object is the tick count. */
+#define traceEVENT_QUEUE_CREATE					( 16U )	/* Parameter is the queue length. */
+#define traceEVENT_MUTEX_CREATE					( 17U )
+#define traceEVENT_QUEUE_SEND					( 18U )	/* Parameter is the number of items in the queue before the operation. */
+#define traceEVENT_QUEUE_SEND_FAILED			( 19U )
+#define traceEVENT_QUEUE_SEND_FROM_ISR			( 20U )
+#define traceEVENT_QUEUE_SEND_FROM_ISR_FAILED	( 21U )
+#define traceEVENT_QUEUE_RECEIVE				( 22U )
+#define traceEVENT_QUEUE_RECEIVE_FAILED			( 23U )
+#define traceEVENT_QUEUE_RECEIVE_FROM_ISR		( 24U )
+#define traceEVENT_QUEUE_RECEIVE_FROM_ISR_FAILED ( 25U )
+#define traceEVENT_QUEUE_PEEK					( 26U )
+#define traceEVENT_QUEUE_BLOCK_ON_SEND			( 27U )
+#define traceEVENT_QUEUE_BLOCK_ON_RECEIVE		( 28U )
+#define traceEVENT_QUEUE_BLOCK_ON_PEEK			( 29U )
+#define traceEVENT_QUEUE_DELETE					( 30U )
+#define traceEVENT_MUTEX_GIVE_RECURSIVE			( 31U )
+#define traceEVENT_MUTEX_TAKE_RECURSIVE			( 32U )
+#define traceEVENT_NOTIFY						( 40U )	/* Object is the notified task. */
+#define traceEVENT_NOTIFY_FROM_ISR				( 41U )
+#define traceEVENT_NOTIFY_GIVE_FROM_ISR			( 42U )
+#define traceEVENT_NOTIFY_TAKE_BLOCK			( 43U )
+#define traceEVENT_NOTIFY_TAKE					( 44U )
+#define traceEVENT_NOTIFY_WAIT_BLOCK			( 45U )
+#define traceEVENT_NOTIFY_WAIT					( 46U )
+#define traceEVENT_EVENT_GROUP_CREATE			( 48U )
+#define traceEVENT_EVENT_GROUP_SET_BITS			( 49U )	/* Parameter is the bits. */
+#define traceEVENT_EVENT_GROUP_SET_BITS_FROM_ISR ( 50U )
+#define traceEVENT_EVENT_GROUP_CLEAR_BITS		( 51U )
+#define traceEVENT_EVENT_GROUP_CLEAR_BITS_FROM_ISR ( 52U )
+#define traceEVENT_EVENT_GROUP_WAIT_BLOCK		( 53U )
+#define traceEVENT_EVENT_GROUP_WAIT_END			( 54U )	/* Parameter is pdTRUE if the wait timed out. */
+#define traceEVENT_EVENT_GROUP_SYNC_BLOCK		( 55U )
+#define traceEVENT_EVENT_GROUP_SYNC_END			( 56U )
+#define traceEVENT_EVENT_GROUP_DELETE			( 57U )
+#define traceEVENT_STREAM_BUFFER_CREATE			( 64U )	/* Parameter is pdTRUE for a message buffer. */
+#define traceEVENT_STREAM_BUFFER_SEND			( 65U )	/* Parameter is the number of bytes. */
+#define traceEVENT_STREAM_BUFFER_SEND_FROM_ISR	( 66U )
+#define traceEVENT_STREAM_BUFFER_RECEIVE		( 67U )
+#define traceEVENT_STREAM_BUFFER_RECEIVE_FROM_ISR ( 68U )
+#define traceEVENT_STREAM_BUFFER_BLOCK_ON_SEND	( 69U )
+#define traceEVENT_STREAM_BUFFER_BLOCK_ON_RECEIVE ( 70U )
+#define traceEVENT_STREAM_BUFFER_DELETE			( 71U )
+#define traceEVENT_TIMER_EXPIRED				( 80U )
+#define traceEVENT_ISR_BEGIN					( 88U )	/* Object is the interrupt ID. */
+#define traceEVENT_ISR_END						( 89U )
+#define traceEVENT_USER							( 90U )	/* Object is the value, parameter is the ID. */
+#define traceEVENT_OBJECT_NAME					( 91U )	/* Parameter is the name slot. */
+#define traceEVENT_CALIBRATION					( 92U )
+
+/* Converts a handle or TCB pointer to the 32-bit object identifier stored in a
+record. */
+#define traceRECORDER_OBJECT( pvObject ) ( ( uint32_t ) ( portPOINTER_SIZE_TYPE ) ( pvObject ) )
+
+/* The kernel trace macros.  Macros not defined here keep their empty default
+from FreeRTOS.h.  traceTASK_SWITCHED_OUT() is not recorded as the next switch
+in on the same core implies it. */
+#define traceTASK_SWITCHED_IN()						vTraceRecorderEvent( traceEVENT_TASK_SWITCHED_IN, traceRECORDER_OBJECT( pxCurrentTCB ), ( uint32_t ) pxCurrentTCB->uxPriority )
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )		vTraceRecorderEvent( traceEVENT_TASK_READY, traceRECORDER_OBJECT( pxTCB ), 0 )
+#define traceTASK_CREATE( pxNewTCB )				vTraceRecorderName( traceEVENT_TASK_CREATE, traceRECORDER_OBJECT( pxNewTCB ), pxNewTCB->pcTaskName )
+#define traceTASK_DELETE( pxTaskToDelete )			vTraceRecorderEvent( traceEVENT_TASK_DELETE, traceRECORDER_OBJECT( pxTaskToDelete ), 0 )
+#define traceTASK_DELAY()							vTraceRecorderEvent( traceEVENT_TASK_DELAY, 0, 0 )
+#define traceTASK_DELAY_UNTIL( xTimeToWake )		vTraceRecorderEvent( traceEVENT_TASK_DELAY_UNTIL, ( uint32_t ) ( xTimeToWake ), 0 )
+#define traceTASK_SUSPEND( pxTaskToSuspend )		vTraceRecorderEvent( traceEVENT_TASK_SUSPEND, traceRECORDER_OBJECT( pxTaskToSuspend ), 0 )
+#define traceTASK_RESUME( pxTaskToResume )			vTraceRecorderEvent( traceEVENT_TASK_RESUME, traceRECORDER_OBJECT( pxTaskToResume ), 0 )
+#define traceTASK_RESUME_FROM_ISR( pxTaskToResume )	vTraceRecorderEvent( traceEVENT_TASK_RESUME_FROM_ISR, traceRECORDER_OBJECT( pxTaskToResume ), 0 )
+#define traceTASK_PRIORITY_SET( pxTask, uxNewPriority )	vTraceRecorderEvent( traceEVENT_TASK_PRIORITY_SET, traceRECORDER_OBJECT( pxTask ), ( uint32_t ) ( uxNewPriority ) )
+#define traceTASK_PRIORITY_INHERIT( pxTCBOfMutexHolder, uxInheritedPriority )	vTraceRecorderEvent( traceEVENT_TASK_PRIORITY_INHERIT, traceRECORDER_OBJECT( pxTCBOfMutexHolder ), ( uint32_t ) ( uxInheritedPriority ) )
+#define traceTASK_PRIORITY_DISINHERIT( pxTCBOfMutexHolder, uxOriginalPriority )	vTraceRecorderEvent( traceEVENT_TASK_PRIORITY_DISINHERIT, traceRECORDER_OBJECT( pxTCBOfMutexHolder ), ( uint32_t ) ( uxOriginalPriority ) )
+#define traceTASK_INCREMENT_TICK( xTickCount )		vTraceRecorderEvent( traceEVENT_TICK, ( uint32_t ) ( xTickCount ), 0 )
+
+#define traceQUEUE_CREATE( pxNewQueue )				vTraceRecorderEvent( traceEVENT_QUEUE_CREATE, traceRECORDER_OBJECT( pxNewQueue ), ( uint32_t ) ( pxNewQueue )->uxLength )
+#define traceCREATE_MUTEX( pxNewQueue )				vTraceRecorderEvent( traceEVENT_MUTEX_CREATE, traceRECORDER_OBJECT( pxNewQueue ), 0 )
+#define traceQUEUE_SEND( pxQueue )					vTraceRecorderEvent( traceEVENT_QUEUE_SEND, traceRECORDER_OBJECT( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_SEND_FAILED( pxQueue )			vTraceRecorderEvent( traceEVENT_QUEUE_SEND_FAILED, traceRECORDER_OBJECT( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_SEND_FROM_ISR( pxQueue )			vTraceRecorderEvent( traceEVENT_QUEUE_SEND_FROM_ISR, traceRECORDER_OBJECT( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue )	vTraceRecorderEvent( traceEVENT_QUEUE_SEND_FROM_ISR_FAILED, traceRECORDER_OBJECT( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE( pxQueue )				vTraceRecorderEvent( traceEVENT_QUEUE_RECEIVE, traceRECORDER_OBJECT( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE_FAILED( pxQueue )		vTraceRecorderEvent( traceEVENT_QUEUE_RECEIVE_FAILED, traceRECORDER_OBJECT( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )		vTraceRecorderEvent( traceEVENT_QUEUE_RECEIVE_FROM_ISR, traceRECORDER_OBJECT( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue )	vTraceRecorderEvent( traceEVENT_QUEUE_RECEIVE_FROM_ISR_FAILED, traceRECORDER_OBJECT( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_PEEK( pxQueue )					vTraceRecorderEvent( traceEVENT_QUEUE_PEEK, traceRECORDER_OBJECT( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceBLOCKING_ON_QUEUE_SEND( pxQueue )		vTraceRecorderEvent( traceEVENT_QUEUE_BLOCK_ON_SEND, traceRECORDER_OBJECT( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )	vTraceRecorderEvent( traceEVENT_QUEUE_BLOCK_ON_RECEIVE, traceRECORDER_OBJECT( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceBLOCKING_ON_QUEUE_PEEK( pxQueue )		vTraceRecorderEvent( traceEVENT_QUEUE_BLOCK_ON_PEEK, traceRECORDER_OBJECT( pxQueue ), ( uint32_t ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_DELETE( pxQueue )				vTraceRecorderEvent( traceEVENT_QUEUE_DELETE, traceRECORDER_OBJECT( pxQueue ), 0 )
+#define traceGIVE_MUTEX_RECURSIVE( pxMutex )		vTraceRecorderEvent( traceEVENT_MUTEX_GIVE_RECURSIVE, traceRECORDER_OBJECT( pxMutex ), 0 )
+#define traceTAKE_MUTEX_RECURSIVE( pxMutex )		vTraceRecorderEvent( traceEVENT_MUTEX_TAKE_RECURSIVE, traceRECORDER_OBJECT( pxMutex ), 0 )
+#define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName )	vTraceRecorderName( traceEVENT_OBJECT_NAME, traceRECORDER_OBJECT( xQueue ), pcQueueName )
+
+/* The notify macros have no parameters.  pxTCB is the notified task in the
+functions that use the first three. */
+#define traceTASK_NOTIFY()							vTraceRecorderEvent( traceEVENT_NOTIFY, traceRECORDER_OBJECT( pxTCB ), 0 )
+#define traceTASK_NOTIFY_FROM_ISR()					vTraceRecorderEvent( traceEVENT_NOTIFY_FROM_ISR, traceRECORDER_OBJECT( pxTCB ), 0 )
+#define traceTASK_NOTIFY_GIVE_FROM_ISR()			vTraceRecorderEvent( traceEVENT_NOTIFY_GIVE_FROM_ISR, traceRECORDER_OBJECT( pxTCB ), 0 )
+#define traceTASK_NOTIFY_TAKE_BLOCK()				vTraceRecorderEvent( traceEVENT_NOTIFY_TAKE_BLOCK, 0, 0 )
+#define traceTASK_NOTIFY_TAKE()						vTraceRecorderEvent( traceEVENT_NOTIFY_TAKE, 0, 0 )
+#define traceTASK_NOTIFY_WAIT_BLOCK()				vTraceRecorderEvent( traceEVENT_NOTIFY_WAIT_BLOCK, 0, 0 )
+#define traceTASK_NOTIFY_WAIT()						vTraceRecorderEvent( traceEVENT_NOTIFY_WAIT, 0, 0 )
+
+#define traceEVENT_GROUP_CREATE( xEventGroup )		vTraceRecorderEvent( traceEVENT_EVENT_GROUP_CREATE, traceRECORDER_OBJECT( xEventGroup ), 0 )
+#define traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet )	vTraceRecorderEvent( traceEVENT_EVENT_GROUP_SET_BITS, traceRECORDER_OBJECT( xEventGroup ), ( uint32_t ) ( uxBitsToSet ) )
+#define traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet )	vTraceRecorderEvent( traceEVENT_EVENT_GROUP_SET_BITS_FROM_ISR, traceRECORDER_OBJECT( xEventGroup ), ( uint32_t ) ( uxBitsToSet ) )
+#define traceEVENT_GROUP_CLEAR_BITS( xEventGroup, uxBitsToClear )	vTraceRecorderEvent( traceEVENT_EVENT_GROUP_CLEAR_BITS, traceRECORDER_OBJECT( xEventGroup ), ( uint32_t ) ( uxBitsToClear ) )
+#define traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear )	vTraceRecorderEvent( traceEVENT_EVENT_GROUP_CLEAR_BITS_FROM_ISR, traceRECORDER_OBJECT( xEventGroup ), ( uint32_t ) ( uxBitsToClear ) )
+#define traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor )	vTraceRecorderEvent( traceEVENT_EVENT_GROUP_WAIT_BLOCK, traceRECORDER_OBJECT( xEventGroup ), ( uint32_t ) ( uxBitsToWaitFor ) )
+#define traceEVENT_GROUP_WAIT_BITS_END( xEventGroup, uxBitsToWaitFor, xTimeoutOccurred )	vTraceRecorderEvent( traceEVENT_EVENT_GROUP_WAIT_END, traceRECORDER_OBJECT( xEventGroup ), ( uint32_t ) ( xTimeoutOccurred ) )
+#define traceEVENT_GROUP_SYNC_BLOCK( xEventGroup, uxBitsToSet, uxBitsToWaitFor )	vTraceRecorderEvent( traceEVENT_EVENT_GROUP_SYNC_BLOCK, traceRECORDER_OBJECT( xEventGroup ), ( uint32_t ) ( uxBitsToWaitFor ) )
+#define traceEVENT_GROUP_SYNC_END( xEventGroup, uxBitsToSet, uxBitsToWaitFor, xTimeoutOccurred )	vTraceRecorderEvent( traceEVENT_EVENT_GROUP_SYNC_END, traceRECORDER_OBJECT( xEventGroup ), ( uint32_t ) ( xTimeoutOccurred ) )
+#define traceEVENT_GROUP_DELETE( xEventGroup )		vTraceRecorderEvent( traceEVENT_EVENT_GROUP_DELETE, traceRECORDER_OBJECT( xEventGroup ), 0 )
+
+#define traceSTREAM_BUFFER_CREATE( pxStreamBuffer, xIsMessageBuffer )	vTraceRecorderEvent( traceEVENT_STREAM_BUFFER_CREATE, traceRECORDER_OBJECT( pxStreamBuffer ), ( uint32_t ) ( xIsMessageBuffer ) )
+#define traceSTREAM_BUFFER_SEND( xStreamBuffer, xBytesSent )	vTraceRecorderEvent( traceEVENT_STREAM_BUFFER_SEND, traceRECORDER_OBJECT( xStreamBuffer ), ( uint32_t ) ( xBytesSent ) )
+#define traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xBytesSent )	vTraceRecorderEvent( traceEVENT_STREAM_BUFFER_SEND_FROM_ISR, traceRECORDER_OBJECT( xStreamBuffer ), ( uint32_t ) ( xBytesSent ) )
+#define traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength )	vTraceRecorderEvent( traceEVENT_STREAM_BUFFER_RECEIVE, traceRECORDER_OBJECT( xStreamBuffer ), ( uint32_t ) ( xReceivedLength ) )
+#define traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength )	vTraceRecorderEvent( traceEVENT_STREAM_BUFFER_RECEIVE_FROM_ISR, traceRECORDER_OBJECT( xStreamBuffer ), ( uint32_t ) ( xReceivedLength ) )
+#define traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer )	vTraceRecorderEvent( traceEVENT_STREAM_BUFFER_BLOCK_ON_SEND, traceRECORDER_OBJECT( xStreamBuffer ), 0 )
+#define traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer )	vTraceRecorderEvent( traceEVENT_STREAM_BUFFER_BLOCK_ON_RECEIVE, traceRECORDER_OBJECT( xStreamBuffer ), 0 )
+#define traceSTREAM_BUFFER_DELETE( xStreamBuffer )	vTraceRecorderEvent( traceEVENT_STREAM_BUFFER_DELETE, traceRECORDER_OBJECT( xStreamBuffer ), 0 )
+
+#define traceTIMER_EXPIRED( pxTimer )				vTraceRecorderEvent( traceEVENT_TIMER_EXPIRED, traceRECORDER_OBJECT( pxTimer ), 0 )
+
+/**
+ * trace_recorder.h
+ *<pre>
+ void vTraceRecorderStart( void );
+ </pre>
+ *
+ * Enable the timestamp counter and start recording.  Call before the tasks
+ * and objects to be traced are created so their names are recorded.  Any
+ * events already in the ring are kept.
+ *
+ * \defgroup vTraceRecorderStart vTraceRecorderStart
+ * \ingroup TraceRecorder
+ */
+void vTraceRecorderStart( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * trace_recorder.h
+ *<pre>
+ void vTraceRecorderStop( void );
+ </pre>
+ *
+ * Stop recording, leaving the contents of the ring unchanged.
+ *
+ * \defgroup vTraceRecorderStop vTraceRecorderStop
+ * \ingroup TraceRecorder
+ */
+void vTraceRecorderStop( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * trace_recorder.h
+ *<pre>
+ void vTraceRecorderClear( void );
+ </pre>
+ *
+ * Discard the recorded events.  Names are kept.
+ *
+ * \defgroup vTraceRecorderClear vTraceRecorderClear
+ * \ingroup TraceRecorder
+ */
+void vTraceRecorderClear( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * trace_recorder.h
+ *<pre>
+ void vTraceRecorderSetObjectName( const void *pvObject, const char *pcName );
+ </pre>
+ *
+ * Record a name for an object that is not named by the kernel, for example an
+ * event group, a stream buffer, or an interrupt ID passed to
+ * vTraceRecorderISRBegin().  Tasks and objects added to the queue registry are
+ * named automatically.
+ *
+ * \defgroup vTraceRecorderSetObjectName vTraceRecorderSetObjectName
+ * \ingroup TraceRecorder
+ */
+void vTraceRecorderSetObjectName( const void *pvObject, const char *pcName ) PRIVILEGED_FUNCTION;
+
+/**
+ * trace_recorder.h
+ *<pre>
+ void vTraceRecorderISRBegin( uint32_t ulISRID );
+ void vTraceRecorderISREnd( uint32_t ulISRID );
+ </pre>
+ *
+ * Mark the start and end of an interrupt handler so the time spent in it is
+ * shown separately from the task it interrupted.
+ *
+ * Example usage:
+ <pre>
+ void EXTI15_10_IRQHandler( void )
+ {
+	vTraceRecorderISRBegin( EXTI15_10_IRQn );
+	...
+	vTraceRecorderISREnd( EXTI15_10_IRQn );
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ }
+ </pre>
+ * \defgroup vTraceRecorderISRBegin vTraceRecorderISRBegin
+ * \ingroup TraceRecorder
+ */
+#define vTraceRecorderISRBegin( ulISRID )	vTraceRecorderEvent( traceEVENT_ISR_BEGIN, ( uint32_t ) ( ulISRID ), 0 )
+#define vTraceRecorderISREnd( ulISRID )		vTraceRecorderEvent( traceEVENT_ISR_END, ( uint32_t ) ( ulISRID ), 0 )
+
+/**
+ * trace_recorder.h
+ *<pre>
+ void vTraceRecorderUserEvent( uint16_t usID, uint32_t ulValue );
+ </pre>
+ *
+ * Record an application defined event.  Can be called from tasks and
+ * interrupts.
+ *
+ * \defgroup vTraceRecorderUserEvent vTraceRecorderUserEvent
+ * \ingroup TraceRecorder
+ */
+#define vTraceRecorderUserEvent( usID, ulValue )	vTraceRecorderEvent( traceEVENT_USER, ( ulValue ), ( usID ) )
+
+/**
+ * trace_recorder.h
+ *<pre>
+ const void *pvTraceRecorderGetImage( size_t *pxLength );
+ </pre>
+ *
+ * Return the address of the recorder image and set *pxLength to its size in
+ * bytes, for example to save the image from a debugger.  Recording should be
+ * stopped first.
+ *
+ * \defgroup pvTraceRecorderGetImage pvTraceRecorderGetImage
+ * \ingroup TraceRecorder
+ */
+const void *pvTraceRecorderGetImage( size_t *pxLength ) PRIVILEGED_FUNCTION;
+
+/**
+ * trace_recorder.h
+ *<pre>
+ void vTraceRecorderDump( void ( *pxWrite )( const void *pvData, size_t xLength ) );
+ </pre>
+ *
+ * Stop recording, then pass the recorder image to pxWrite, which could write
+ * it to a UART or a file.  pxWrite may be called more than once, each call
+ * continuing from where the last one ended.
+ *
+ * \defgroup vTraceRecorderDump vTraceRecorderDump
+ * \ingroup TraceRecorder
+ */
+void vTraceRecorderDump( void ( *pxWrite )( const void *pvData, size_t xLength ) ) PRIVILEGED_FUNCTION;
+
+/**
+ * trace_recorder.h
+ *<pre>
+ BaseType_t xTraceRecorderMeasureOverhead( uint32_t *pulOverhead );
+ </pre>
+ *
+ * Record a burst of calibration events with interrupts masked, and measure the
+ * average time taken to record each one in timestamp counts (CPU cycles on the
+ * Cortex-M4F port).  The result is stored in the image header.
+ *
+ * @param pulOverhead Set to the measured timestamp counts per event.
+ *
+ * @return pdPASS if the overhead is within configTRACE_RECORDER_CYCLE_BUDGET,
+ * otherwise pdFAIL.
+ *
+ * \defgroup xTraceRecorderMeasureOverhead xTraceRecorderMeasureOverhead
+ * \ingroup TraceRecorder
+ */
+BaseType_t xTraceRecorderMeasureOverhead( uint32_t *pulOverhead ) PRIVILEGED_FUNCTION;
+
+/* Record functions used by the trace macros.  Not intended to be called
+directly. */
+void vTraceRecorderEvent( uint32_t ulEvent, uint32_t ulObject, uint32_t ulParameter ) PRIVILEGED_FUNCTION;
+void vTraceRecorderName( uint32_t ulEvent, uint32_t ulObject, const char *pcName ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_RECORDER_H */
@@ -0,0 +1,726 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "job_pool.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+for the header files above, but not in this file, in order to generate the
+correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+to include job pool functionality.  This #if is closed at the very bottom of
+this file.  If you want to include job pools then ensure configUSE_JOB_POOL is
+set to 1 in FreeRTOSConfig.h. */
+#if( configUSE_JOB_POOL == 1 )
+
+/* A job waiting in a deque. */
+typedef struct JOB_POOL_ENTRY
+{
+	JobFunction_t pxFunction;
+	void *pvParameter;
+	JobGroup_t *pxGroup;
+} JobEntry_t;
+
+/* A worker task and its deque.  The deque is a ring buffer.  The owner takes
+jobs from the back, other workers steal jobs from the front. */
+typedef struct JOB_POOL_WORKER
+{
+	struct JobPoolDefinition *pxPool;
+	UBaseType_t uxIndex;			/*< Position of this worker in the pool. */
+	TaskHandle_t xTask;
+	JobEntry_t *pxJobs;				/*< Storage for uxDequeLength jobs. */
+	UBaseType_t uxFront;			/*< Index of the oldest job in the deque. */
+	UBaseType_t uxJobCount;			/*< The number of jobs in the deque. */
+} JobPoolWorker_t;
+
+typedef struct JobPoolDefinition
+{
+	JobPoolWorker_t *pxWorkers;
+	UBaseType_t uxWorkerCount;
+	UBaseType_t uxDequeLength;
+	UBaseType_t uxNextDeque;		/*< The deque that receives the next job submitted from outside the pool. */
+	UBaseType_t uxIdleWorkers;		/*< Bit n is set while worker n is waiting for a notification. */
+	JobGroup_t xAllJobs;			/*< Counts every job in the pool, for xJobPoolFence(). */
+} JobPool_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The function implemented by each worker task.
+ */
+static portTASK_FUNCTION_PROTO( prvWorkerTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the index of the calling task within the pool, or the number of
+ * workers in the pool if the calling task is not one of its workers.
+ */
+static UBaseType_t prvGetWorkerIndex( const JobPool_t *pxPool ) PRIVILEGED_FUNCTION;
+
+/*
+ * Place a job at the back of deque uxDeque, or of the next deque that is not
+ * full, and add it to its group.  Returns the index of the deque used, or the
+ * number of workers in the pool if every deque is full.  Must be called from a
+ * critical section.
+ */
+static UBaseType_t prvPushJob( JobPool_t *pxPool, UBaseType_t uxDeque, JobFunction_t pxFunction, void *pvParameter, JobGroup_t *pxGroup ) PRIVILEGED_FUNCTION;
+
+/*
+ * Take a job from the back of the deque of worker uxWorker, or if that deque is
+ * empty steal one from the front of another worker's deque.  Returns pdTRUE if
+ * a job was written to pxJob.  Must be called from a critical section.
+ */
+static BaseType_t prvTakeJob( JobPool_t *pxPool, UBaseType_t uxWorker, JobEntry_t *pxJob ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the deque that receives the next job submitted from outside the
+ * pool.  Must be called from a critical section.
+ */
+static UBaseType_t prvNextDeque( JobPool_t *pxPool ) PRIVILEGED_FUNCTION;
+
+/*
+ * Clear the idle bit of a worker that is waiting for a job and return its
+ * task, preferring worker uxPreferred.  Returns NULL if no workers are idle.
+ * Must be called from a critical section.
+ */
+static TaskHandle_t prvClaimIdleWorker( JobPool_t *pxPool, UBaseType_t uxPreferred ) PRIVILEGED_FUNCTION;
+
+/*
+ * Run a job then remove it from its group, and from the pool, waking any task
+ * that was waiting for the group or the pool to complete.
+ */
+static void prvRunJob( JobPool_t *pxPool, const JobEntry_t *pxJob ) PRIVILEGED_FUNCTION;
+
+/*
+ * Implements xJobGroupWait() and xJobPoolFence().
+ */
+static BaseType_t prvWaitForGroup( JobPool_t *pxPool, JobGroup_t *pxGroup, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+JobPoolHandle_t xJobPoolCreate( UBaseType_t uxWorkerCount, UBaseType_t uxDequeLength, configSTACK_DEPTH_TYPE usStackDepth, UBaseType_t uxPriority )
+{
+JobPool_t *pxPool;
+JobEntry_t *pxJobs;
+UBaseType_t x;
+BaseType_t xResult = pdPASS;
+char cName[ configMAX_TASK_NAME_LEN ];
+
+	configASSERT( uxWorkerCount > ( UBaseType_t ) 0U );
+	configASSERT( uxWorkerCount <= ( UBaseType_t ) ( sizeof( UBaseType_t ) * 8U ) );
+	configASSERT( uxDequeLength > ( UBaseType_t ) 0U );
+
+	/* The pool, the workers and the deque storage are allocated together.
+	All three contain pointers, so the workers and the deques that follow the
+	pool are correctly aligned. */
+	pxPool = ( JobPool_t * ) pvPortMalloc( sizeof( JobPool_t ) + ( uxWorkerCount * sizeof( JobPoolWorker_t ) ) + ( uxWorkerCount * uxDequeLength * sizeof( JobEntry_t ) ) ); /*lint !e9079 !e9087 Storage is cast to the structure it holds. */
+
+	if( pxPool != NULL )
+	{
+		( void ) memset( ( void * ) pxPool, 0x00, sizeof( JobPool_t ) );
+		pxPool->pxWorkers = ( JobPoolWorker_t * ) &( pxPool[ 1 ] ); /*lint !e9087 The workers follow the pool in the same allocation. */
+		pxPool->uxWorkerCount = uxWorkerCount;
+		pxPool->uxDequeLength = uxDequeLength;
+		vJobGroupInitialise( &( pxPool->xAllJobs ) );
+		pxJobs = ( JobEntry_t * ) &( pxPool->pxWorkers[ uxWorkerCount ] ); /*lint !e9087 The deques follow the workers in the same allocation. */
+
+		for( x = ( UBaseType_t ) 0U; x < uxWorkerCount; x++ )
+		{
+			pxPool->pxWorkers[ x ].pxPool = pxPool;
+			pxPool->pxWorkers[ x ].uxIndex = x;
+			pxPool->pxWorkers[ x ].xTask = NULL;
+			pxPool->pxWorkers[ x ].pxJobs = &( pxJobs[ x * uxDequeLength ] );
+			pxPool->pxWorkers[ x ].uxFront = ( UBaseType_t ) 0U;
+			pxPool->pxWorkers[ x ].uxJobCount = ( UBaseType_t ) 0U;
+		}
+
+		for( x = ( UBaseType_t ) 0U; ( x < uxWorkerCount ) && ( xResult == pdPASS ); x++ )
+		{
+			/* Name the workers "Job0", "Job1", etc. */
+			( void ) strncpy( cName, "Job", sizeof( cName ) );
+			cName[ configMAX_TASK_NAME_LEN - 1 ] = '\0';
+
+			if( configMAX_TASK_NAME_LEN > 6 )
+			{
+				if( x >= ( UBaseType_t ) 10U )
+				{
+					cName[ 3 ] = ( char ) ( '0' + ( x / 10U ) );
+					cName[ 4 ] = ( char ) ( '0' + ( x % 10U ) );
+					cName[ 5 ] = '\0';
+				}
+				else
+				{
+					cName[ 3 ] = ( char ) ( '0' + x );
+					cName[ 4 ] = '\0';
+				}
+			}
+
+			xResult = xTaskCreate( prvWorkerTask, cName, usStackDepth, ( void * ) &( pxPool->pxWorkers[ x ] ), uxPriority, &( pxPool->pxWorkers[ x ].xTask ) );
+		}
+
+		if( xResult != pdPASS )
+		{
+			/* Delete the workers that were created.  They can only be waiting
+			for a job. */
+			for( x = ( UBaseType_t ) 0U; x < uxWorkerCount; x++ )
+			{
+				if( pxPool->pxWorkers[ x ].xTask != NULL )
+				{
+					vTaskDelete( pxPool->pxWorkers[ x ].xTask );
+				}
+			}
+
+			vPortFree( pxPool );
+			pxPool = NULL;
+		}
+	}
+
+	return pxPool;
+}
+/*-----------------------------------------------------------*/
+
+void vJobGroupInitialise( JobGroup_t *pxGroup )
+{
+	configASSERT( pxGroup );
+
+	pxGroup->uxPendingJobs = ( UBaseType_t ) 0U;
+	pxGroup->xWaitingTask = NULL;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xJobPoolSubmit( JobPoolHandle_t xPool, JobFunction_t pxFunction, void *pvParameter, JobGroup_t *pxGroup )
+{
+JobPool_t * const pxPool = xPool;
+UBaseType_t uxWorker, uxDeque;
+TaskHandle_t xWorkerToWake = NULL;
+BaseType_t xReturn;
+
+	configASSERT( pxPool );
+	configASSERT( pxFunction );
+
+	uxWorker = prvGetWorkerIndex( pxPool );
+
+	taskENTER_CRITICAL();
+	{
+		/* A job submitted by a worker goes in the worker's own deque, where the
+		worker will find it next unless another worker steals it first. */
+		if( uxWorker < pxPool->uxWorkerCount )
+		{
+			uxDeque = uxWorker;
+		}
+		else
+		{
+			uxDeque = prvNextDeque( pxPool );
+		}
+
+		uxDeque = prvPushJob( pxPool, uxDeque, pxFunction, pvParameter, pxGroup );
+
+		if( uxDeque < pxPool->uxWorkerCount )
+		{
+			xWorkerToWake = prvClaimIdleWorker( pxPool, uxDeque );
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = errQUEUE_FULL;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if( xWorkerToWake != NULL )
+	{
+		( void ) xTaskNotifyGive( xWorkerToWake );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xJobPoolSubmitFromISR( JobPoolHandle_t xPool, JobFunction_t pxFunction, void *pvParameter, JobGroup_t *pxGroup, BaseType_t *pxHigherPriorityTaskWoken )
+{
+JobPool_t * const pxPool = xPool;
+UBaseType_t uxDeque, uxSavedInterruptStatus;
+TaskHandle_t xWorkerToWake = NULL;
+BaseType_t xReturn;
+
+	configASSERT( pxPool );
+	configASSERT( pxFunction );
+
+	/* See the comments in xQueueGenericSendFromISR(). */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+	{
+		uxDeque = prvPushJob( pxPool, prvNextDeque( pxPool ), pxFunction, pvParameter, pxGroup );
+
+		if( uxDeque < pxPool->uxWorkerCount )
+		{
+			xWorkerToWake = prvClaimIdleWorker( pxPool, uxDeque );
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = errQUEUE_FULL;
+		}
+	}
+	taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+	if( xWorkerToWake != NULL )
+	{
+		vTaskNotifyGiveFromISR( xWorkerToWake, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxJobPoolSubmitBatch( JobPoolHandle_t xPool, const Job_t *pxJobs, UBaseType_t uxJobCount, JobGroup_t *pxGroup )
+{
+JobPool_t * const pxPool = xPool;
+UBaseType_t uxSubmitted = ( UBaseType_t ) 0U, uxWorker, uxDeque;
+TaskHandle_t xWorkerToWake;
+
+	configASSERT( pxPool );
+	configASSERT( pxJobs );
+
+	uxWorker = prvGetWorkerIndex( pxPool );
+
+	/* The jobs are spread across the deques, starting with the calling
+	worker's own deque if the caller is a worker.  Each job is pushed in its
+	own critical section to keep the time interrupts are disabled short. */
+	while( uxSubmitted < uxJobCount )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( ( uxWorker < pxPool->uxWorkerCount ) && ( uxSubmitted == ( UBaseType_t ) 0U ) )
+			{
+				uxDeque = uxWorker;
+			}
+			else
+			{
+				uxDeque = prvNextDeque( pxPool );
+			}
+
+			uxDeque = prvPushJob( pxPool, uxDeque, pxJobs[ uxSubmitted ].pxFunction, pxJobs[ uxSubmitted ].pvParameter, pxGroup );
+		}
+		taskEXIT_CRITICAL();
+
+		if( uxDeque < pxPool->uxWorkerCount )
+		{
+			uxSubmitted++;
+		}
+		else
+		{
+			/* The pool is full. */
+			break;
+		}
+	}
+
+	/* Wake one idle worker per job submitted.  The workers steal the jobs that
+	are not in their own deques. */
+	for( uxDeque = ( UBaseType_t ) 0U; uxDeque < uxSubmitted; uxDeque++ )
+	{
+		taskENTER_CRITICAL();
+		{
+			xWorkerToWake = prvClaimIdleWorker( pxPool, uxDeque % pxPool->uxWorkerCount );
+		}
+		taskEXIT_CRITICAL();
+
+		if( xWorkerToWake != NULL )
+		{
+			( void ) xTaskNotifyGive( xWorkerToWake );
+		}
+		else
+		{
+			/* No more workers are idle. */
+			break;
+		}
+	}
+
+	return uxSubmitted;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xJobGroupWait( JobPoolHandle_t xPool, JobGroup_t *pxGroup, TickType_t xTicksToWait )
+{
+	configASSERT( xPool );
+	configASSERT( pxGroup );
+
+	return prvWaitForGroup( xPool, pxGroup, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xJobPoolFence( JobPoolHandle_t xPool, TickType_t xTicksToWait )
+{
+JobPool_t * const pxPool = xPool;
+
+	configASSERT( pxPool );
+
+	/* A worker waiting on the fence would wait for the job it is running. */
+	configASSERT( prvGetWorkerIndex( pxPool ) == pxPool->uxWorkerCount );
+
+	return prvWaitForGroup( pxPool, &( pxPool->xAllJobs ), xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+static portTASK_FUNCTION( prvWorkerTask, pvParameters )
+{
+JobPoolWorker_t * const pxWorker = ( JobPoolWorker_t * ) pvParameters;
+JobPool_t * const pxPool = pxWorker->pxPool;
+const UBaseType_t uxIdleBit = ( ( UBaseType_t ) 1U ) << pxWorker->uxIndex;
+JobEntry_t xJob;
+BaseType_t xHaveJob;
+
+	for( ;; )
+	{
+		/* Checking for a job and marking the worker as idle are performed in
+		the same critical section, so a job submitted after the check always
+		wakes a worker. */
+		taskENTER_CRITICAL();
+		{
+			xHaveJob = prvTakeJob( pxPool, pxWorker->uxIndex, &xJob );
+
+			if( xHaveJob == pdFALSE )
+			{
+				pxPool->uxIdleWorkers |= uxIdleBit;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xHaveJob != pdFALSE )
+		{
+			prvRunJob( pxPool, &xJob );
+		}
+		else
+		{
+			( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+			/* The bit is already clear if the worker was woken by a
+			submit. */
+			taskENTER_CRITICAL();
+			{
+				pxPool->uxIdleWorkers &= ~uxIdleBit;
+			}
+			taskEXIT_CRITICAL();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvGetWorkerIndex( const JobPool_t *pxPool )
+{
+TaskHandle_t xCurrentTask = xTaskGetCurrentTaskHandle();
+UBaseType_t x;
+
+	for( x = ( UBaseType_t ) 0U; x < pxPool->uxWorkerCount; x++ )
+	{
+		if( pxPool->pxWorkers[ x ].xTask == xCurrentTask )
+		{
+			break;
+		}
+	}
+
+	return x;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvPushJob( JobPool_t *pxPool, UBaseType_t uxDeque, JobFunction_t pxFunction, void *pvParameter, JobGroup_t *pxGroup )
+{
+JobPoolWorker_t *pxWorker;
+JobEntry_t *pxEntry;
+UBaseType_t x;
+
+	for( x = ( UBaseType_t ) 0U; x < pxPool->uxWorkerCount; x++ )
+	{
+		pxWorker = &( pxPool->pxWorkers[ uxDeque ] );
+
+		if( pxWorker->uxJobCount < pxPool->uxDequeLength )
+		{
+			pxEntry = &( pxWorker->pxJobs[ ( pxWorker->uxFront + pxWorker->uxJobCount ) % pxPool->uxDequeLength ] );
+			pxEntry->pxFunction = pxFunction;
+			pxEntry->pvParameter = pvParameter;
+			pxEntry->pxGroup = pxGroup;
+			( pxWorker->uxJobCount )++;
+
+			if( pxGroup != NULL )
+			{
+				( pxGroup->uxPendingJobs )++;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			( pxPool->xAllJobs.uxPendingJobs )++;
+			break;
+		}
+		else
+		{
+			uxDeque = ( uxDeque + 1U ) % pxPool->uxWorkerCount;
+		}
+	}
+
+	/* x is only equal to the number of workers if all the deques were
+	full. */
+	return ( x < pxPool->uxWorkerCount ) ? uxDeque : pxPool->uxWorkerCount;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvTakeJob( JobPool_t *pxPool, UBaseType_t uxWorker, JobEntry_t *pxJob )
+{
+JobPoolWorker_t *pxWorker = &( pxPool->pxWorkers[ uxWorker ] );
+BaseType_t xReturn = pdFALSE;
+UBaseType_t x;
+
+	if( pxWorker->uxJobCount > ( UBaseType_t ) 0U )
+	{
+		/* Take the most recently submitted job from the worker's own
+		deque. */
+		( pxWorker->uxJobCount )--;
+		*pxJob = pxWorker->pxJobs[ ( pxWorker->uxFront + pxWorker->uxJobCount ) % pxPool->uxDequeLength ];
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		/* Steal the oldest job from the next worker that has one. */
+		for( x = ( UBaseType_t ) 1U; x < pxPool->uxWorkerCount; x++ )
+		{
+			pxWorker = &( pxPool->pxWorkers[ ( uxWorker + x ) % pxPool->uxWorkerCount ] );
+
+			if( pxWorker->uxJobCount > ( UBaseType_t ) 0U )
+			{
+				*pxJob = pxWorker->pxJobs[ pxWorker->uxFront ];
+				pxWorker->uxFront = ( pxWorker->uxFront + 1U ) % pxPool->uxDequeLength;
+				( pxWorker->uxJobCount )--;
+				xReturn = pdTRUE;
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvNextDeque( JobPool_t *pxPool )
+{
+UBaseType_t uxDeque = pxPool->uxNextDeque;
+
+	pxPool->uxNextDeque = ( uxDeque + 1U ) % pxPool->uxWorkerCount;
+
+	return uxDeque;
+}
+/*-----------------------------------------------------------*/
+
+static TaskHandle_t prvClaimIdleWorker( JobPool_t *pxPool, UBaseType_t uxPreferred )
+{
+TaskHandle_t xReturn = NULL;
+UBaseType_t x;
+
+	if( pxPool->uxIdleWorkers != ( UBaseType_t ) 0U )
+	{
+		/* Waking the worker that owns the deque the job was placed in avoids
+		a steal. */
+		if( ( pxPool->uxIdleWorkers & ( ( ( UBaseType_t ) 1U ) << uxPreferred ) ) != ( UBaseType_t ) 0U )
+		{
+			x = uxPreferred;
+		}
+		else
+		{
+			for( x = ( UBaseType_t ) 0U; ( pxPool->uxIdleWorkers & ( ( ( UBaseType_t ) 1U ) << x ) ) == ( UBaseType_t ) 0U; x++ )
+			{
+				/* Find the first idle worker. */
+			}
+		}
+
+		pxPool->uxIdleWorkers &= ~( ( ( UBaseType_t ) 1U ) << x );
+		xReturn = pxPool->pxWorkers[ x ].xTask;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRunJob( JobPool_t *pxPool, const JobEntry_t *pxJob )
+{
+JobGroup_t *pxGroups[ 2 ];
+UBaseType_t x;
+
+	pxJob->pxFunction( pxJob->pvParameter );
+
+	pxGroups[ 0 ] = pxJob->pxGroup;
+	pxGroups[ 1 ] = &( pxPool->xAllJobs );
+
+	taskENTER_CRITICAL();
+	{
+		for( x = ( UBaseType_t ) 0U; x < ( UBaseType_t ) 2U; x++ )
+		{
+			if( pxGroups[ x ] != NULL )
+			{
+				configASSERT( pxGroups[ x ]->uxPendingJobs > ( UBaseType_t ) 0U );
+				( pxGroups[ x ]->uxPendingJobs )--;
+
+				if( ( pxGroups[ x ]->uxPendingJobs == ( UBaseType_t ) 0U ) && ( pxGroups[ x ]->xWaitingTask != NULL ) )
+				{
+					/* Any context switch is held pending until the critical
+					section is exited. */
+					( void ) xTaskNotifyGive( pxGroups[ x ]->xWaitingTask );
+					pxGroups[ x ]->xWaitingTask = NULL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvWaitForGroup( JobPool_t *pxPool, JobGroup_t *pxGroup, TickType_t xTicksToWait )
+{
+TaskHandle_t xCurrentTask = xTaskGetCurrentTaskHandle();
+const UBaseType_t uxWorker = prvGetWorkerIndex( pxPool );
+UBaseType_t uxIdleBit = ( UBaseType_t ) 0U;
+TimeOut_t xTimeOut;
+JobEntry_t xJob;
+BaseType_t xReturn = pdFAIL, xDone = pdFALSE, xHaveJob;
+
+	/* A worker is marked as idle while it waits, so it is also woken to run
+	jobs submitted while it is waiting. */
+	if( uxWorker < pxPool->uxWorkerCount )
+	{
+		uxIdleBit = ( ( UBaseType_t ) 1U ) << uxWorker;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	vTaskSetTimeOutState( &xTimeOut );
+
+	while( xDone == pdFALSE )
+	{
+		xHaveJob = pdFALSE;
+
+		taskENTER_CRITICAL();
+		{
+			if( pxGroup->uxPendingJobs == ( UBaseType_t ) 0U )
+			{
+				xReturn = pdPASS;
+				xDone = pdTRUE;
+			}
+			else if( ( uxIdleBit != ( UBaseType_t ) 0U ) && ( prvTakeJob( pxPool, uxWorker, &xJob ) != pdFALSE ) )
+			{
+				xHaveJob = pdTRUE;
+			}
+			else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+			{
+				xDone = pdTRUE;
+			}
+			else
+			{
+				pxGroup->xWaitingTask = xCurrentTask;
+				pxPool->uxIdleWorkers |= uxIdleBit;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xHaveJob != pdFALSE )
+		{
+			prvRunJob( pxPool, &xJob );
+		}
+		else if( xDone == pdFALSE )
+		{
+			( void ) ulTaskNotifyTake( pdTRUE, xTicksToWait );
+
+			taskENTER_CRITICAL();
+			{
+				if( pxGroup->xWaitingTask == xCurrentTask )
+				{
+					pxGroup->xWaitingTask = NULL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxPool->uxIdleWorkers &= ~uxIdleBit;
+			}
+			taskEXIT_CRITICAL();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include job pool functionality.  If you want to include job pools then
+ensure configUSE_JOB_POOL is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_JOB_POOL == 1 */
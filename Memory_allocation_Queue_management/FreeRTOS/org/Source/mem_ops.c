@@ -0,0 +1,481 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "mem_ops.h"
+
+/* This entire source file will be skipped if the application is not configured
+to include the memory operations.  This #if is closed at the very bottom of this
+file.  If you want to include them then ensure configUSE_MEM_OPS is set to 1 in
+FreeRTOSConfig.h. */
+#if( configUSE_MEM_OPS == 1 )
+
+/* GCC recognises the byte and word loops below as copies and fills, and would
+otherwise turn them back into calls to memcpy() and memset(). */
+#if defined( __GNUC__ ) && !defined( __clang__ )
+	#pragma GCC optimize ( "no-tree-loop-distribute-patterns" )
+#endif
+
+/* The word the data is moved in.  It may alias any other type, as the buffers
+passed in can be of any type. */
+#if defined( __GNUC__ )
+	typedef uint32_t __attribute__( ( may_alias ) ) MemWord_t;
+#else
+	typedef uint32_t MemWord_t;
+#endif
+
+#define memopsWORD_SIZE			( sizeof( MemWord_t ) )
+#define memopsWORD_MASK			( ( portPOINTER_SIZE_TYPE ) ( memopsWORD_SIZE - 1U ) )
+
+/* The words moved by each pass of the burst loops, two LDM or STM instructions
+of four registers each. */
+#define memopsBURST_WORDS		( 8U )
+#define memopsBURST_SIZE		( memopsBURST_WORDS * memopsWORD_SIZE )
+
+/* The Cortex-M3/M4 load and store words at any address in hardware, and have
+LDM and STM. */
+#if defined( __ARM_ARCH_7M__ ) || defined( __ARM_ARCH_7EM__ )
+	#define memopsARMV7M			1
+#else
+	#define memopsARMV7M			0
+#endif
+
+/*
+ * Load a word from any address.  A memcpy() of a constant word is compiled to
+ * a single load where the processor allows unaligned loads.
+ */
+static uint32_t prvLoadWord( const uint8_t *pucSource );
+
+/*
+ * Copy, set or add xBursts runs of memopsBURST_WORDS aligned words.  xBursts
+ * must not be 0.  prvSumBursts() returns ulSum plus the words, with each carry
+ * out of bit 31 added back in at bit 0.
+ */
+static void prvCopyBursts( MemWord_t *pulDest, const MemWord_t *pulSource, size_t xBursts );
+static void prvSetBursts( MemWord_t *pulDest, uint32_t ulWord, size_t xBursts );
+static uint32_t prvSumBursts( const MemWord_t *pulData, size_t xBursts, uint32_t ulSum );
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvLoadWord( const uint8_t *pucSource )
+{
+uint32_t ulWord;
+
+	( void ) memcpy( &ulWord, pucSource, sizeof( ulWord ) );
+
+	return ulWord;
+}
+/*-----------------------------------------------------------*/
+
+#if( memopsARMV7M == 1 )
+
+	static void prvCopyBursts( MemWord_t *pulDest, const MemWord_t *pulSource, size_t xBursts )
+	{
+		__asm volatile
+		(
+			"1:									\n"
+			"	ldmia %1!, {r3, r4, r5, r6}		\n"
+			"	stmia %0!, {r3, r4, r5, r6}		\n"
+			"	ldmia %1!, {r3, r4, r5, r6}		\n"
+			"	stmia %0!, {r3, r4, r5, r6}		\n"
+			"	subs %2, %2, #1					\n"
+			"	bne 1b							\n"
+			: "+r" ( pulDest ), "+r" ( pulSource ), "+r" ( xBursts )
+			:
+			: "r3", "r4", "r5", "r6", "cc", "memory"
+		);
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvSetBursts( MemWord_t *pulDest, uint32_t ulWord, size_t xBursts )
+	{
+		__asm volatile
+		(
+			"	mov r3, %2						\n"
+			"	mov r4, %2						\n"
+			"	mov r5, %2						\n"
+			"	mov r6, %2						\n"
+			"1:									\n"
+			"	stmia %0!, {r3, r4, r5, r6}		\n"
+			"	stmia %0!, {r3, r4, r5, r6}		\n"
+			"	subs %1, %1, #1					\n"
+			"	bne 1b							\n"
+			: "+r" ( pulDest ), "+r" ( xBursts )
+			: "r" ( ulWord )
+			: "r3", "r4", "r5", "r6", "cc", "memory"
+		);
+	}
+	/*-----------------------------------------------------------*/
+
+	static uint32_t prvSumBursts( const MemWord_t *pulData, size_t xBursts, uint32_t ulSum )
+	{
+		/* The carry of each ADCS is added by the next, so the loop count is
+		decremented with SUBW and tested with TEQ, which leave the carry as it
+		is.  The carry out of the last word is added once the loop ends. */
+		__asm volatile
+		(
+			"	adds %0, %0, #0					\n" /* Clear the carry. */
+			"1:									\n"
+			"	ldmia %1!, {r3, r4, r5, r6}		\n"
+			"	adcs %0, %0, r3					\n"
+			"	adcs %0, %0, r4					\n"
+			"	adcs %0, %0, r5					\n"
+			"	adcs %0, %0, r6					\n"
+			"	ldmia %1!, {r3, r4, r5, r6}		\n"
+			"	adcs %0, %0, r3					\n"
+			"	adcs %0, %0, r4					\n"
+			"	adcs %0, %0, r5					\n"
+			"	adcs %0, %0, r6					\n"
+			"	subw %2, %2, #1					\n"
+			"	teq %2, #0						\n"
+			"	bne 1b							\n"
+			"	adc %0, %0, #0					\n"
+			: "+r" ( ulSum ), "+r" ( pulData ), "+r" ( xBursts )
+			:
+			: "r3", "r4", "r5", "r6", "cc", "memory"
+		);
+
+		return ulSum;
+	}
+	/*-----------------------------------------------------------*/
+
+#else /* memopsARMV7M */
+
+	static void prvCopyBursts( MemWord_t *pulDest, const MemWord_t *pulSource, size_t xBursts )
+	{
+	size_t x;
+
+		do
+		{
+			for( x = 0; x < memopsBURST_WORDS; x++ )
+			{
+				pulDest[ x ] = pulSource[ x ];
+			}
+
+			pulDest += memopsBURST_WORDS;
+			pulSource += memopsBURST_WORDS;
+			xBursts--;
+		} while( xBursts != 0 );
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvSetBursts( MemWord_t *pulDest, uint32_t ulWord, size_t xBursts )
+	{
+	size_t x;
+
+		do
+		{
+			for( x = 0; x < memopsBURST_WORDS; x++ )
+			{
+				pulDest[ x ] = ulWord;
+			}
+
+			pulDest += memopsBURST_WORDS;
+			xBursts--;
+		} while( xBursts != 0 );
+	}
+	/*-----------------------------------------------------------*/
+
+	static uint32_t prvSumBursts( const MemWord_t *pulData, size_t xBursts, uint32_t ulSum )
+	{
+	uint64_t ullSum = ulSum;
+	size_t x;
+
+		/* The carries collect in the upper half, and cannot overflow it. */
+		do
+		{
+			for( x = 0; x < memopsBURST_WORDS; x++ )
+			{
+				ullSum += pulData[ x ];
+			}
+
+			pulData += memopsBURST_WORDS;
+			xBursts--;
+		} while( xBursts != 0 );
+
+		while( ( ullSum >> 32 ) != 0ULL )
+		{
+			ullSum = ( ullSum & 0xFFFFFFFFULL ) + ( ullSum >> 32 );
+		}
+
+		return ( uint32_t ) ullSum;
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* memopsARMV7M */
+
+void *pvMemCopy( void *pvDest, const void *pvSource, size_t xLength )
+{
+uint8_t *pucDest = ( uint8_t * ) pvDest;
+const uint8_t *pucSource = ( const uint8_t * ) pvSource;
+size_t xWords;
+
+	if( xLength >= memopsWORD_SIZE )
+	{
+		/* Bytes up to the first word boundary of the destination. */
+		while( ( ( portPOINTER_SIZE_TYPE ) pucDest & memopsWORD_MASK ) != 0U )
+		{
+			*pucDest++ = *pucSource++;
+			xLength--;
+		}
+
+		xWords = xLength / memopsWORD_SIZE;
+		xLength -= xWords * memopsWORD_SIZE;
+
+		if( ( ( portPOINTER_SIZE_TYPE ) pucSource & memopsWORD_MASK ) == 0U )
+		{
+			/* Both are aligned, so whole bursts can be moved. */
+			if( xWords >= memopsBURST_WORDS )
+			{
+				prvCopyBursts( ( MemWord_t * ) pucDest, ( const MemWord_t * ) pucSource, xWords / memopsBURST_WORDS );
+				pucDest += ( xWords / memopsBURST_WORDS ) * memopsBURST_SIZE;
+				pucSource += ( xWords / memopsBURST_WORDS ) * memopsBURST_SIZE;
+				xWords %= memopsBURST_WORDS;
+			}
+
+			while( xWords > 0U )
+			{
+				*( MemWord_t * ) pucDest = *( const MemWord_t * ) pucSource;
+				pucDest += memopsWORD_SIZE;
+				pucSource += memopsWORD_SIZE;
+				xWords--;
+			}
+		}
+		else
+		{
+			while( xWords > 0U )
+			{
+				*( MemWord_t * ) pucDest = prvLoadWord( pucSource );
+				pucDest += memopsWORD_SIZE;
+				pucSource += memopsWORD_SIZE;
+				xWords--;
+			}
+		}
+	}
+
+	while( xLength > 0U )
+	{
+		*pucDest++ = *pucSource++;
+		xLength--;
+	}
+
+	return pvDest;
+}
+/*-----------------------------------------------------------*/
+
+void *pvMemSet( void *pvDest, int iValue, size_t xLength )
+{
+uint8_t *pucDest = ( uint8_t * ) pvDest;
+const uint8_t ucValue = ( uint8_t ) iValue;
+const uint32_t ulWord = ( uint32_t ) ucValue * 0x01010101UL;
+size_t xWords;
+
+	if( xLength >= memopsWORD_SIZE )
+	{
+		while( ( ( portPOINTER_SIZE_TYPE ) pucDest & memopsWORD_MASK ) != 0U )
+		{
+			*pucDest++ = ucValue;
+			xLength--;
+		}
+
+		xWords = xLength / memopsWORD_SIZE;
+		xLength -= xWords * memopsWORD_SIZE;
+
+		if( xWords >= memopsBURST_WORDS )
+		{
+			prvSetBursts( ( MemWord_t * ) pucDest, ulWord, xWords / memopsBURST_WORDS );
+			pucDest += ( xWords / memopsBURST_WORDS ) * memopsBURST_SIZE;
+			xWords %= memopsBURST_WORDS;
+		}
+
+		while( xWords > 0U )
+		{
+			*( MemWord_t * ) pucDest = ulWord;
+			pucDest += memopsWORD_SIZE;
+			xWords--;
+		}
+	}
+
+	while( xLength > 0U )
+	{
+		*pucDest++ = ucValue;
+		xLength--;
+	}
+
+	return pvDest;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xMemCompare( const void *pv1, const void *pv2, size_t xLength )
+{
+const uint8_t *puc1 = ( const uint8_t * ) pv1;
+const uint8_t *puc2 = ( const uint8_t * ) pv2;
+
+	if( xLength >= memopsWORD_SIZE )
+	{
+		while( ( ( portPOINTER_SIZE_TYPE ) puc1 & memopsWORD_MASK ) != 0U )
+		{
+			if( *puc1 != *puc2 )
+			{
+				return ( BaseType_t ) *puc1 - ( BaseType_t ) *puc2;
+			}
+
+			puc1++;
+			puc2++;
+			xLength--;
+		}
+
+		/* Skip the words that are equal.  The bytes of the first word that
+		differs are compared one at a time below, which finds the first byte
+		that differs whatever the byte order. */
+		while( xLength >= memopsWORD_SIZE )
+		{
+			if( *( const MemWord_t * ) puc1 != prvLoadWord( puc2 ) )
+			{
+				break;
+			}
+
+			puc1 += memopsWORD_SIZE;
+			puc2 += memopsWORD_SIZE;
+			xLength -= memopsWORD_SIZE;
+		}
+	}
+
+	while( xLength > 0U )
+	{
+		if( *puc1 != *puc2 )
+		{
+			return ( BaseType_t ) *puc1 - ( BaseType_t ) *puc2;
+		}
+
+		puc1++;
+		puc2++;
+		xLength--;
+	}
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+uint16_t usMemChecksum( const void *pvData, size_t xLength, uint16_t usInitial )
+{
+const uint8_t *pucData = ( const uint8_t * ) pvData;
+uint8_t aucPadded[ 2 ];
+uint16_t usHalfWord;
+uint64_t ullSum = 0;
+uint32_t ulSum;
+size_t xWords;
+BaseType_t xSwap;
+
+	/* The data is added in native halfwords, read from aligned addresses, so
+	that whole words can be added at once.  Added in little endian order the
+	sum comes out byte swapped (RFC 1071).  Starting at an odd address pairs
+	each byte with the one before it rather than the one after it, which swaps
+	the sum once more. */
+	#if defined( __BYTE_ORDER__ ) && ( __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ )
+		xSwap = pdFALSE;
+	#else
+		xSwap = pdTRUE;
+	#endif
+
+	if( ( xLength > 0U ) && ( ( ( portPOINTER_SIZE_TYPE ) pucData & 1U ) != 0U ) )
+	{
+		aucPadded[ 0 ] = 0U;
+		aucPadded[ 1 ] = *pucData;
+		( void ) memcpy( &usHalfWord, aucPadded, sizeof( usHalfWord ) );
+		ullSum += usHalfWord;
+		pucData++;
+		xLength--;
+		xSwap = ( xSwap == pdFALSE ) ? pdTRUE : pdFALSE;
+	}
+
+	if( ( xLength >= 2U ) && ( ( ( portPOINTER_SIZE_TYPE ) pucData & 2U ) != 0U ) )
+	{
+		( void ) memcpy( &usHalfWord, pucData, sizeof( usHalfWord ) );
+		ullSum += usHalfWord;
+		pucData += 2;
+		xLength -= 2U;
+	}
+
+	xWords = xLength / memopsWORD_SIZE;
+	xLength -= xWords * memopsWORD_SIZE;
+
+	if( xWords >= memopsBURST_WORDS )
+	{
+		ullSum += prvSumBursts( ( const MemWord_t * ) pucData, xWords / memopsBURST_WORDS, 0U );
+		pucData += ( xWords / memopsBURST_WORDS ) * memopsBURST_SIZE;
+		xWords %= memopsBURST_WORDS;
+	}
+
+	while( xWords > 0U )
+	{
+		ullSum += *( const MemWord_t * ) pucData;
+		pucData += memopsWORD_SIZE;
+		xWords--;
+	}
+
+	if( xLength >= 2U )
+	{
+		( void ) memcpy( &usHalfWord, pucData, sizeof( usHalfWord ) );
+		ullSum += usHalfWord;
+		pucData += 2;
+		xLength -= 2U;
+	}
+
+	if( xLength > 0U )
+	{
+		aucPadded[ 0 ] = *pucData;
+		aucPadded[ 1 ] = 0U;
+		( void ) memcpy( &usHalfWord, aucPadded, sizeof( usHalfWord ) );
+		ullSum += usHalfWord;
+	}
+
+	/* Fold the carries back in until the sum fits in 16 bits. */
+	while( ( ullSum >> 16 ) != 0ULL )
+	{
+		ullSum = ( ullSum & 0xFFFFULL ) + ( ullSum >> 16 );
+	}
+
+	ulSum = ( uint32_t ) ullSum;
+
+	if( xSwap != pdFALSE )
+	{
+		ulSum = ( ( ulSum << 8 ) | ( ulSum >> 8 ) ) & 0xFFFFUL;
+	}
+
+	ulSum += usInitial;
+	ulSum = ( ulSum & 0xFFFFUL ) + ( ulSum >> 16 );
+
+	return ( uint16_t ) ulSum;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_MEM_OPS */
@@ -0,0 +1,193 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "event_groups.h"
+#include "multi_wait.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+for the header files above, but not in this file, in order to generate the
+correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+to include multi-wait functionality.  This #if is closed at the very bottom of
+this file.  If you want to include multi-waits then ensure
+configUSE_MULTI_WAIT is set to 1 in FreeRTOSConfig.h. */
+#if( configUSE_MULTI_WAIT == 1 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Place the list item within pxObject into the waiting list of the object it
+ * describes, unless the object is already available.  Returns pdTRUE if the
+ * object is already available (in which case the list item is not placed in
+ * the waiting list), otherwise pdFALSE.
+ */
+static BaseType_t prvArmObject( MultiWaitObject_t * const pxObject ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xMultiWaitForAny( MultiWaitObject_t *pxObjects, UBaseType_t uxObjectCount, TickType_t xTicksToWait )
+{
+BaseType_t xReturn = multiwaitTIMEOUT, xBlocked = pdFALSE, xUnblockedBy;
+UBaseType_t ux;
+
+	configASSERT( pxObjects );
+	configASSERT( uxObjectCount > ( UBaseType_t ) 0U );
+
+	/* Cannot block if the scheduler is suspended. */
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	vTaskSuspendAll();
+	{
+		vTaskMultiWaitEnter( pxObjects, uxObjectCount );
+
+		/* Reference the calling task from the waiting list of each object in
+		turn, stopping at the first object that is already available. */
+		for( ux = 0; ux < uxObjectCount; ux++ )
+		{
+			if( prvArmObject( &( pxObjects[ ux ] ) ) != pdFALSE )
+			{
+				xReturn = ( BaseType_t ) ux;
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( xReturn == multiwaitTIMEOUT )
+		{
+			xBlocked = xTaskMultiWaitBlock( xTicksToWait );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( xBlocked == pdFALSE )
+		{
+			/* Not going to block, so tidy up without resuming the scheduler
+			in between. */
+			xUnblockedBy = xTaskMultiWaitExit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	if( xBlocked != pdFALSE )
+	{
+		if( xTaskResumeAll() == pdFALSE )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* The task is running again, either because one of the objects
+		became available or because the block time expired.  The list items
+		referenced from the objects that did not unblock the task are removed
+		here, rather than by whatever unblocked the task, so the cost of
+		unblocking the task does not depend on the number of objects. */
+		vTaskSuspendAll();
+		{
+			xUnblockedBy = xTaskMultiWaitExit();
+		}
+		( void ) xTaskResumeAll();
+	}
+	else
+	{
+		( void ) xTaskResumeAll();
+	}
+
+	if( xReturn == multiwaitTIMEOUT )
+	{
+		xReturn = xUnblockedBy;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvArmObject( MultiWaitObject_t * const pxObject )
+{
+BaseType_t xReturn;
+
+	configASSERT( pxObject->pvObject );
+
+	switch( pxObject->ucObjectType )
+	{
+		case multiwaitTYPE_QUEUE :
+			xReturn = xQueueMultiWaitArm( ( QueueHandle_t ) pxObject->pvObject, &( pxObject->xWaitListItem ) );
+			break;
+
+		case multiwaitTYPE_EVENT_GROUP :
+			xReturn = xEventGroupMultiWaitArm( ( EventGroupHandle_t ) pxObject->pvObject, &( pxObject->xWaitListItem ), pxObject->uxBitsToWaitFor, pxObject->xWaitForAllBits );
+			break;
+
+		default :
+			/* Should not get here.  Treat an unknown object as available so
+			the application gets to see it. */
+			configASSERT( pdFALSE );
+			xReturn = pdTRUE;
+			break;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include multi-wait functionality.  If you want to include multi-waits then
+ensure configUSE_MULTI_WAIT is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_MULTI_WAIT == 1 */
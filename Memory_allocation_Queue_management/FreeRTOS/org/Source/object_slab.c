@@ -0,0 +1,372 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "object_slab.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+for the header files above, but not in this file, in order to generate the
+correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+to include object slabs.  This #if is closed at the very bottom of this file.
+If you want to include object slabs then ensure configUSE_OBJECT_SLABS is set
+to 1 in FreeRTOSConfig.h. */
+#if( configUSE_OBJECT_SLABS == 1 )
+
+#ifndef configSLAB_TASK_COUNT
+	#define configSLAB_TASK_COUNT			8
+#endif
+
+#ifndef configSLAB_SMALL_STACK_DEPTH
+	#define configSLAB_SMALL_STACK_DEPTH	( configMINIMAL_STACK_SIZE * 2 )
+#endif
+
+#ifndef configSLAB_SMALL_STACK_COUNT
+	#define configSLAB_SMALL_STACK_COUNT	6
+#endif
+
+#ifndef configSLAB_LARGE_STACK_DEPTH
+	#define configSLAB_LARGE_STACK_DEPTH	( configMINIMAL_STACK_SIZE * 8 )
+#endif
+
+#ifndef configSLAB_LARGE_STACK_COUNT
+	#define configSLAB_LARGE_STACK_COUNT	2
+#endif
+
+#ifndef configSLAB_QUEUE_COUNT
+	#define configSLAB_QUEUE_COUNT			8
+#endif
+
+#ifndef configSLAB_QUEUE_STORAGE_SIZE
+	#define configSLAB_QUEUE_STORAGE_SIZE	64
+#endif
+
+#ifndef configSLAB_TIMER_COUNT
+	#define configSLAB_TIMER_COUNT			4
+#endif
+
+#if( ( configSLAB_TASK_COUNT < 1 ) || ( configSLAB_SMALL_STACK_COUNT < 1 ) || ( configSLAB_LARGE_STACK_COUNT < 1 ) || ( configSLAB_QUEUE_COUNT < 1 ) || ( configSLAB_TIMER_COUNT < 1 ) )
+	#error Every configSLAB_..._COUNT must be at least 1
+#endif
+
+/* The memory given to the heap when a request cannot be met by its slab, with
+the placement hint heap_regions.c would have been given. */
+#if( configUSE_HEAP_REGIONS == 1 )
+	#define slabHEAP_MALLOC( xSize, eHint )	pvPortMallocHint( ( xSize ), ( eHint ) )
+#else
+	#define slabHEAP_MALLOC( xSize, eHint )	pvPortMalloc( xSize )
+#endif
+
+/* A queue block.  queue.c places the item storage directly after the queue
+structure, which is the same size as StaticQueue_t. */
+typedef struct SLAB_QUEUE_BLOCK
+{
+	StaticQueue_t xQueue;
+	uint8_t ucStorage[ configSLAB_QUEUE_STORAGE_SIZE ];
+} SlabQueueBlock_t;
+
+/* A block that is not in use holds the link to the next free block. */
+typedef struct SLAB_FREE_BLOCK
+{
+	struct SLAB_FREE_BLOCK *pxNextFreeBlock;
+} SlabFreeBlock_t;
+
+/* A slab - the range of memory it covers, and its free list. */
+typedef struct SLAB
+{
+	uint8_t *pucStart;						/*< The first block. */
+	uint8_t *pucEnd;						/*< One past the last block. */
+	size_t xBlockSize;
+	UBaseType_t uxNumberOfBlocks;
+	SlabFreeBlock_t *pxFreeBlocks;			/*< NULL when the slab is empty. */
+	UBaseType_t uxBlocksInUse;
+	UBaseType_t uxMaximumBlocksInUse;
+	UBaseType_t uxHeapFallbacks;
+	eHeapHint eFallbackHint;				/*< The placement hint used when the request goes to the heap. */
+} Slab_t;
+
+/*
+ * Links the blocks of every slab into their free lists.  Called the first time
+ * a block is allocated.
+ */
+static void prvInitialiseSlabs( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Selects the slab a request for xWantedSize bytes is served from, or returns
+ * NULL and counts a fallback if it must be given to the heap.  A stack that
+ * fits the small slab is taken from the large slab when the small slab is
+ * empty.
+ */
+static Slab_t *prvSelectSlab( eSlab eSlabToUse, size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* The blocks of each slab. */
+static StaticTask_t xTaskBlocks[ configSLAB_TASK_COUNT ];
+static StackType_t xSmallStackBlocks[ configSLAB_SMALL_STACK_COUNT ][ configSLAB_SMALL_STACK_DEPTH ];
+static StackType_t xLargeStackBlocks[ configSLAB_LARGE_STACK_COUNT ][ configSLAB_LARGE_STACK_DEPTH ];
+static SlabQueueBlock_t xQueueBlocks[ configSLAB_QUEUE_COUNT ];
+static StaticTimer_t xTimerBlocks[ configSLAB_TIMER_COUNT ];
+
+/* In the order of eSlab. */
+static Slab_t xSlabs[ eSlabNumberOfSlabs ] =
+{
+	{ ( uint8_t * ) xTaskBlocks, ( uint8_t * ) &( xTaskBlocks[ configSLAB_TASK_COUNT ] ), sizeof( StaticTask_t ), configSLAB_TASK_COUNT, NULL, 0, 0, 0, eHeapHintTCB },
+	{ ( uint8_t * ) xSmallStackBlocks, ( uint8_t * ) &( xSmallStackBlocks[ configSLAB_SMALL_STACK_COUNT ] ), sizeof( xSmallStackBlocks[ 0 ] ), configSLAB_SMALL_STACK_COUNT, NULL, 0, 0, 0, eHeapHintStack },
+	{ ( uint8_t * ) xLargeStackBlocks, ( uint8_t * ) &( xLargeStackBlocks[ configSLAB_LARGE_STACK_COUNT ] ), sizeof( xLargeStackBlocks[ 0 ] ), configSLAB_LARGE_STACK_COUNT, NULL, 0, 0, 0, eHeapHintStack },
+	{ ( uint8_t * ) xQueueBlocks, ( uint8_t * ) &( xQueueBlocks[ configSLAB_QUEUE_COUNT ] ), sizeof( SlabQueueBlock_t ), configSLAB_QUEUE_COUNT, NULL, 0, 0, 0, eHeapHintGeneral },
+	{ ( uint8_t * ) xTimerBlocks, ( uint8_t * ) &( xTimerBlocks[ configSLAB_TIMER_COUNT ] ), sizeof( StaticTimer_t ), configSLAB_TIMER_COUNT, NULL, 0, 0, 0, eHeapHintGeneral }
+};
+
+static BaseType_t xSlabsInitialised = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseSlabs( void )
+{
+Slab_t *pxSlab;
+SlabFreeBlock_t *pxBlock;
+UBaseType_t uxSlab, uxBlock;
+
+	/* configMINIMAL_STACK_SIZE usually contains a cast, so this cannot be
+	checked by the pre-processor. */
+	configASSERT( configSLAB_SMALL_STACK_DEPTH <= configSLAB_LARGE_STACK_DEPTH );
+
+	for( uxSlab = 0; uxSlab < ( UBaseType_t ) eSlabNumberOfSlabs; uxSlab++ )
+	{
+		pxSlab = &( xSlabs[ uxSlab ] );
+
+		/* Link the blocks so they are handed out in address order. */
+		for( uxBlock = pxSlab->uxNumberOfBlocks; uxBlock > ( UBaseType_t ) 0; uxBlock-- )
+		{
+			pxBlock = ( SlabFreeBlock_t * ) ( pxSlab->pucStart + ( ( uxBlock - ( UBaseType_t ) 1 ) * pxSlab->xBlockSize ) ); /*lint !e9087 !e826 Every block is aligned for the object it holds. */
+			pxBlock->pxNextFreeBlock = pxSlab->pxFreeBlocks;
+			pxSlab->pxFreeBlocks = pxBlock;
+		}
+	}
+
+	xSlabsInitialised = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+static Slab_t *prvSelectSlab( eSlab eSlabToUse, size_t xWantedSize )
+{
+Slab_t *pxSlab = &( xSlabs[ eSlabToUse ] );
+Slab_t *pxLargeStacks = &( xSlabs[ eSlabLargeStack ] );
+
+	if( eSlabToUse == eSlabSmallStack )
+	{
+		if( xWantedSize > pxSlab->xBlockSize )
+		{
+			pxSlab = pxLargeStacks;
+		}
+		else if( ( pxSlab->pxFreeBlocks == NULL ) && ( pxLargeStacks->pxFreeBlocks != NULL ) )
+		{
+			pxSlab = pxLargeStacks;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	if( ( xWantedSize > pxSlab->xBlockSize ) || ( pxSlab->pxFreeBlocks == NULL ) )
+	{
+		pxSlab->uxHeapFallbacks++;
+		pxSlab = NULL;
+	}
+
+	return pxSlab;
+}
+/*-----------------------------------------------------------*/
+
+void *pvSlabAlloc( eSlab eSlabToUse, size_t xWantedSize )
+{
+Slab_t *pxSlab;
+void *pvReturn = NULL;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( eSlabToUse < eSlabNumberOfSlabs );
+
+	heapLOCK_FROM_ISR( uxSavedInterruptStatus );
+	{
+		if( xSlabsInitialised == pdFALSE )
+		{
+			prvInitialiseSlabs();
+		}
+
+		pxSlab = prvSelectSlab( eSlabToUse, xWantedSize );
+
+		if( pxSlab != NULL )
+		{
+			pvReturn = ( void * ) pxSlab->pxFreeBlocks;
+			pxSlab->pxFreeBlocks = pxSlab->pxFreeBlocks->pxNextFreeBlock;
+			( pxSlab->uxBlocksInUse )++;
+
+			if( pxSlab->uxBlocksInUse > pxSlab->uxMaximumBlocksInUse )
+			{
+				pxSlab->uxMaximumBlocksInUse = pxSlab->uxBlocksInUse;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	heapUNLOCK_FROM_ISR( uxSavedInterruptStatus );
+
+	if( pvReturn == NULL )
+	{
+		pvReturn = slabHEAP_MALLOC( xWantedSize, xSlabs[ eSlabToUse ].eFallbackHint );
+	}
+	else
+	{
+		traceMALLOC( pvReturn, xWantedSize );
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vSlabFree( void *pv )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+Slab_t *pxSlab = NULL;
+SlabFreeBlock_t *pxBlock = ( SlabFreeBlock_t * ) pv;
+UBaseType_t uxSlab, uxSavedInterruptStatus;
+
+	for( uxSlab = 0; uxSlab < ( UBaseType_t ) eSlabNumberOfSlabs; uxSlab++ )
+	{
+		if( ( puc >= xSlabs[ uxSlab ].pucStart ) && ( puc < xSlabs[ uxSlab ].pucEnd ) )
+		{
+			pxSlab = &( xSlabs[ uxSlab ] );
+			break;
+		}
+	}
+
+	if( pxSlab != NULL )
+	{
+		/* The pointer must be the start of a block. */
+		configASSERT( ( ( size_t ) ( puc - pxSlab->pucStart ) % pxSlab->xBlockSize ) == 0 );
+		traceFREE( pv, pxSlab->xBlockSize );
+
+		heapLOCK_FROM_ISR( uxSavedInterruptStatus );
+		{
+			configASSERT( pxSlab->uxBlocksInUse > ( UBaseType_t ) 0 );
+			pxBlock->pxNextFreeBlock = pxSlab->pxFreeBlocks;
+			pxSlab->pxFreeBlocks = pxBlock;
+			( pxSlab->uxBlocksInUse )--;
+		}
+		heapUNLOCK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	else
+	{
+		vPortFree( pv );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vSlabGetStats( eSlab eSlabToQuery, SlabStats_t *pxSlabStats )
+{
+Slab_t *pxSlab;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( eSlabToQuery < eSlabNumberOfSlabs );
+	pxSlab = &( xSlabs[ eSlabToQuery ] );
+
+	heapLOCK_FROM_ISR( uxSavedInterruptStatus );
+	{
+		pxSlabStats->xBlockSizeInBytes = pxSlab->xBlockSize;
+		pxSlabStats->uxNumberOfBlocks = pxSlab->uxNumberOfBlocks;
+		pxSlabStats->uxBlocksInUse = pxSlab->uxBlocksInUse;
+		pxSlabStats->uxMaximumBlocksInUse = pxSlab->uxMaximumBlocksInUse;
+		pxSlabStats->uxHeapFallbacks = pxSlab->uxHeapFallbacks;
+	}
+	heapUNLOCK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	/* The idle and timer tasks are never deleted, so are given memory of their
+	own rather than blocks from the slabs. */
+	void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize )
+	{
+	static StaticTask_t xIdleTaskTCB;
+	static StackType_t uxIdleTaskStack[ configMINIMAL_STACK_SIZE ];
+
+		*ppxIdleTaskTCBBuffer = &xIdleTaskTCB;
+		*ppxIdleTaskStackBuffer = uxIdleTaskStack;
+		*pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+	}
+	/*-----------------------------------------------------------*/
+
+	#if( configNUMBER_OF_CORES > 1 )
+
+		void vApplicationGetPassiveIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize, BaseType_t xPassiveIdleTaskIndex )
+		{
+		static StaticTask_t xIdleTaskTCBs[ configNUMBER_OF_CORES - 1 ];
+		static StackType_t uxIdleTaskStacks[ configNUMBER_OF_CORES - 1 ][ configMINIMAL_STACK_SIZE ];
+
+			*ppxIdleTaskTCBBuffer = &( xIdleTaskTCBs[ xPassiveIdleTaskIndex ] );
+			*ppxIdleTaskStackBuffer = uxIdleTaskStacks[ xPassiveIdleTaskIndex ];
+			*pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+		}
+
+	#endif /* configNUMBER_OF_CORES */
+	/*-----------------------------------------------------------*/
+
+	#if( configUSE_TIMERS == 1 )
+
+		void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint32_t *pulTimerTaskStackSize )
+		{
+		static StaticTask_t xTimerTaskTCB;
+		static StackType_t uxTimerTaskStack[ configTIMER_TASK_STACK_DEPTH ];
+
+			*ppxTimerTaskTCBBuffer = &xTimerTaskTCB;
+			*ppxTimerTaskStackBuffer = uxTimerTaskStack;
+			*pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+		}
+
+	#endif /* configUSE_TIMERS */
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+/* This entire source file will be skipped if the application is not configured
+to include object slabs.  If you want to include object slabs then ensure
+configUSE_OBJECT_SLABS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_OBJECT_SLABS == 1 */
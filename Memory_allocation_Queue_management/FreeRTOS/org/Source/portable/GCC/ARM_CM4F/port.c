@@ -58,6 +58,44 @@
 #define portNVIC_SYSTICK_COUNT_FLAG_BIT		( 1UL << 16UL )
 #define portNVIC_PENDSVCLEAR_BIT 			( 1UL << 27UL )
 #define portNVIC_PEND_SYSTICK_CLEAR_BIT		( 1UL << 25UL )
+#define portNVIC_PEND_SYSTICK_SET_BIT		( 1UL << 26UL )
+
+/* Constants required to enable the DWT cycle counter. */
+#define portDEMCR_REG						( * ( ( volatile uint32_t * ) 0xe000edfc ) )
+#define portDWT_CTRL_REG					( * ( ( volatile uint32_t * ) 0xe0001000 ) )
+#define portDEMCR_TRCENA_BIT				( 1UL << 24UL )
+#define portDWT_CTRL_CYCCNTENA_BIT			( 1UL << 0UL )
+
+/* Constants required to use DWT comparator 0 as the stack overflow watchpoint.
+The comparator matches any write to the portSTACK_GUARD_BYTES block at
+portSTACK_GUARD_ADDRESS(). */
+#define portDWT_COMP0_REG					( * ( ( volatile uint32_t * ) 0xe0001020 ) )
+#define portDWT_MASK0_REG					( * ( ( volatile uint32_t * ) 0xe0001024 ) )
+#define portDWT_FUNCTION0_REG				( * ( ( volatile uint32_t * ) 0xe0001028 ) )
+#define portDWT_FUNCTION_WRITE_WATCHPOINT	( 0x6UL )
+#define portDWT_FUNCTION_MATCHED_BIT		( 1UL << 24UL )
+#define portDEMCR_MON_EN_BIT				( 1UL << 16UL )
+
+/* Constants required to use an MPU region as the stack overflow guard.  The
+region is read only for privileged code, so the high water mark of a stack can
+still be read while its task is running, and no access for unprivileged code.
+Everything else uses the default memory map. */
+#define portMPU_TYPE_REG					( * ( ( volatile uint32_t * ) 0xe000ed90 ) )
+#define portMPU_CTRL_REG					( * ( ( volatile uint32_t * ) 0xe000ed94 ) )
+#define portMPU_REGION_NUMBER_REG			( * ( ( volatile uint32_t * ) 0xe000ed98 ) )
+#define portMPU_REGION_ATTRIBUTE_REG		( * ( ( volatile uint32_t * ) 0xe000eda0 ) )
+#define portNVIC_SYSHND_CTRL_REG			( * ( ( volatile uint32_t * ) 0xe000ed24 ) )
+#define portMPU_TYPE_DREGION_SHIFT			( 8UL )
+#define portMPU_TYPE_DREGION_MASK			( 0xffUL )
+#define portMPU_ENABLE_BIT					( 1UL << 0UL )
+#define portMPU_PRIVDEFENA_BIT				( 1UL << 2UL )
+#define portMPU_REGION_EXECUTE_NEVER_BIT	( 1UL << 28UL )
+#define portMPU_REGION_PRIVILEGED_READ_ONLY	( 5UL << 24UL )
+#define portMPU_REGION_ENABLE_BIT			( 1UL << 0UL )
+#define portMPU_REGION_SIZE( ulBits )		( ( ( ulBits ) - 1UL ) << 1UL )
+#define portNVIC_MEM_FAULT_ENABLE_BIT		( 1UL << 16UL )
+#define portNVIC_MEM_FAULT_STATUS_REG		( * ( ( volatile uint8_t * ) 0xe000ed28 ) )
+#define portMEM_FAULT_INSTRUCTION_BIT		( 1UL << 0UL )
 
 /* Constants used to detect a Cortex-M7 r0p1 core, which should use the ARM_CM7
 r0p1 port. */
@@ -123,6 +161,12 @@ void vPortSetupTimerInterrupt( void );
 void xPortPendSVHandler( void ) __attribute__ (( naked ));
 void xPortSysTickHandler( void );
 void vPortSVCHandler( void ) __attribute__ (( naked ));
+#if( configSTACK_OVERFLOW_WATCHPOINT == 1 )
+	void vPortDebugMonitorHandler( void );
+#endif
+#if( configSTACK_OVERFLOW_MPU_GUARD == 1 )
+	void vPortMemManageHandler( void );
+#endif
 
 /*
  * Start first task is a separate function so it can be tested in isolation.
@@ -139,6 +183,14 @@ static void vPortEnableVFP( void ) __attribute__ (( naked ));
  */
 static void prvTaskExitError( void );
 
+/*
+ * Enable the MPU with the stack guard region, which portSET_STACK_GUARD()
+ * already points at the stack of the first task.
+ */
+#if( configSTACK_OVERFLOW_MPU_GUARD == 1 )
+	static void prvSetupStackGuardRegion( void );
+#endif
+
 /*-----------------------------------------------------------*/
 
 /* Each task maintains its own interrupt status in the critical nesting
@@ -375,6 +427,12 @@ BaseType_t xPortStartScheduler( void )
 	/* Lazy save always. */
 	*( portFPCCR ) |= portASPEN_AND_LSPEN_BITS;
 
+	#if( configSTACK_OVERFLOW_MPU_GUARD == 1 )
+	{
+		prvSetupStackGuardRegion();
+	}
+	#endif
+
 	/* Start the first task. */
 	prvPortStartFirstTask();
 
@@ -428,14 +486,163 @@ void vPortExitCritical( void )
 }
 /*-----------------------------------------------------------*/
 
+void vPortEnableCycleCounter( void )
+{
+	/* The DWT is only accessible once trace is enabled in the DEMCR. */
+	portDEMCR_REG |= portDEMCR_TRCENA_BIT;
+	portDWT_CYCCNT_REG = 0UL;
+	portDWT_CTRL_REG |= portDWT_CTRL_CYCCNTENA_BIT;
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MONOTONIC_CLOCK == 1 )
+
+	uint32_t ulPortGetTickFraction( UBaseType_t *puxPendingTicks )
+	{
+	const uint32_t ulCountsPerTick = configSYSTICK_CLOCK_HZ / configTICK_RATE_HZ;
+	uint32_t ulCurrentValue, ulElapsed;
+
+		/* Called from a critical section, so the SysTick interrupt cannot be
+		processed.  If it is pending the counter reloaded either before or
+		after it was read, so it is read again to be sure the value is from
+		after the reload, and the tick is added to the tick count by the
+		kernel. */
+		ulCurrentValue = portNVIC_SYSTICK_CURRENT_VALUE_REG;
+
+		if( ( portNVIC_INT_CTRL_REG & portNVIC_PEND_SYSTICK_SET_BIT ) != 0UL )
+		{
+			ulCurrentValue = portNVIC_SYSTICK_CURRENT_VALUE_REG;
+			*puxPendingTicks = 1;
+		}
+		else
+		{
+			*puxPendingTicks = 0;
+		}
+
+		/* The counter counts down from the reload value.  While ticks are
+		suppressed the reload value spans several tick periods, so the time is
+		held at the end of the current tick period until the kernel is told
+		how many ticks passed. */
+		ulElapsed = portNVIC_SYSTICK_LOAD_REG - ulCurrentValue;
+
+		if( ulElapsed >= ulCountsPerTick )
+		{
+			ulElapsed = ulCountsPerTick - 1UL;
+		}
+
+		return ulElapsed;
+	}
+
+#endif /* configUSE_MONOTONIC_CLOCK */
+/*-----------------------------------------------------------*/
+
+#if( configSTACK_OVERFLOW_WATCHPOINT == 1 )
+
+	void vPortSetStackWatchpoint( StackType_t *pxStack )
+	{
+	uint32_t ulWatchAddress;
+
+		/* The DWT is only accessible once trace is enabled in the DEMCR, and
+		this is first called before the scheduler is started.  A match raises
+		the DebugMonitor exception, which is left at priority 0 so a write
+		from inside a critical section is also caught.  When a debugger is
+		attached the core halts instead. */
+		portDEMCR_REG |= ( portDEMCR_TRCENA_BIT | portDEMCR_MON_EN_BIT );
+
+		/* The task is stopped when it comes within 2 * portSTACK_GUARD_BYTES
+		of the end of its stack. */
+		ulWatchAddress = portSTACK_GUARD_ADDRESS( pxStack );
+
+		portDWT_FUNCTION0_REG = 0UL;
+		portDWT_COMP0_REG = ulWatchAddress;
+		portDWT_MASK0_REG = portSTACK_GUARD_SIZE_BITS;
+		portDWT_FUNCTION0_REG = portDWT_FUNCTION_WRITE_WATCHPOINT;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortDebugMonitorHandler( void )
+	{
+	extern void vApplicationStackOverflowHook( TaskHandle_t xTask, char *pcTaskName );
+	TaskHandle_t xTask;
+
+		/* Reading the function register clears the matched bit.  Watchpoints
+		are imprecise, so the exception is taken a few instructions after
+		the write, still in the task that overflowed. */
+		if( ( portDWT_FUNCTION0_REG & portDWT_FUNCTION_MATCHED_BIT ) != 0UL )
+		{
+			xTask = xTaskGetCurrentTaskHandle();
+			vApplicationStackOverflowHook( xTask, pcTaskGetName( xTask ) );
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configSTACK_OVERFLOW_WATCHPOINT */
+
+#if( configSTACK_OVERFLOW_MPU_GUARD == 1 )
+
+	static void prvSetupStackGuardRegion( void )
+	{
+		/* The Cortex-M4 has 8 regions if it has an MPU at all. */
+		configASSERT( ( ( portMPU_TYPE_REG >> portMPU_TYPE_DREGION_SHIFT ) & portMPU_TYPE_DREGION_MASK ) > portMPU_STACK_GUARD_REGION );
+
+		/* The base address of the region was written by portSET_STACK_GUARD()
+		when the first task was selected, so only its size and attributes
+		are set here. */
+		portMPU_REGION_NUMBER_REG = portMPU_STACK_GUARD_REGION;
+		portMPU_REGION_ATTRIBUTE_REG = portMPU_REGION_EXECUTE_NEVER_BIT | portMPU_REGION_PRIVILEGED_READ_ONLY | portMPU_REGION_SIZE( portSTACK_GUARD_SIZE_BITS ) | portMPU_REGION_ENABLE_BIT;
+
+		/* MemManage is left at priority 0, so an overflow inside a critical
+		section is also caught, and enabled so it does not escalate to a
+		hard fault. */
+		portNVIC_SYSHND_CTRL_REG |= portNVIC_MEM_FAULT_ENABLE_BIT;
+		portMPU_CTRL_REG = portMPU_ENABLE_BIT | portMPU_PRIVDEFENA_BIT;
+		__asm volatile( "dsb" ::: "memory" );
+		__asm volatile( "isb" );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortMemManageHandler( void )
+	{
+	extern void vApplicationStackOverflowHook( TaskHandle_t xTask, char *pcTaskName );
+	TaskHandle_t xTask;
+
+		/* The guard region is the only region, so a data access fault is a
+		write to the end of the running task's stack - either by the task or
+		by the processor stacking an exception frame.  An instruction fetch
+		fault is a jump into the execute never part of the default memory
+		map instead.  The access has not been made, and would be retried if
+		this returned. */
+		if( ( portNVIC_MEM_FAULT_STATUS_REG & portMEM_FAULT_INSTRUCTION_BIT ) == 0U )
+		{
+			xTask = xTaskGetCurrentTaskHandle();
+			vApplicationStackOverflowHook( xTask, pcTaskGetName( xTask ) );
+		}
+
+		portDISABLE_INTERRUPTS();
+		for( ;; );
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configSTACK_OVERFLOW_MPU_GUARD */
+
 void xPortPendSVHandler( void )
 {
 	/* This is a naked function. */
 
+	/* No barriers are needed on a Cortex-M4: a write to BASEPRI or PSP with
+	MSR takes effect for the instructions that follow it, and the exception
+	return is itself context synchronising.
+
+	If vTaskSwitchContext() selects the task that was already running - for
+	example because the task yielded with no other task of its priority ready,
+	or the scheduler was suspended so the switch is only recorded in
+	xYieldPending - the context is not restored, as r4 to r11 and s16 to s31
+	are callee saved and so still hold the task's values.  The context is
+	always saved before vTaskSwitchContext() is called so the stack overflow
+	checks and trace macros see it as before. */
 	__asm volatile
 	(
 	"	mrs r0, psp							\n"
-	"	isb									\n"
 	"										\n"
 	"	ldr	r3, pxCurrentTCBConst			\n" /* Get the location of the current TCB. */
 	"	ldr	r2, [r3]						\n"
@@ -447,19 +654,20 @@ void xPortPendSVHandler( void )
 	"	stmdb r0!, {r4-r11, r14}			\n" /* Save the core registers. */
 	"	str r0, [r2]						\n" /* Save the new top of stack into the first member of the TCB. */
 	"										\n"
-	"	stmdb sp!, {r0, r3}					\n"
+	"	push {r2, r14}						\n" /* Keep the outgoing TCB and EXC_RETURN, which keeps the stack 8 byte aligned. */
 	"	mov r0, %0 							\n"
 	"	msr basepri, r0						\n"
-	"	dsb									\n"
-	"	isb									\n"
 	"	bl vTaskSwitchContext				\n"
 	"	mov r0, #0							\n"
 	"	msr basepri, r0						\n"
-	"	ldmia sp!, {r0, r3}					\n"
+	"	pop {r2, r14}						\n"
 	"										\n"
-	"	ldr r1, [r3]						\n" /* The first item in pxCurrentTCB is the task top of stack. */
-	"	ldr r0, [r1]						\n"
+	"	ldr	r3, pxCurrentTCBConst			\n"
+	"	ldr r1, [r3]						\n"
+	"	cmp r1, r2							\n" /* Is the same task still selected?  If so its registers have not changed. */
+	"	beq 1f								\n"
 	"										\n"
+	"	ldr r0, [r1]						\n" /* The first item in pxCurrentTCB is the task top of stack. */
 	"	ldmia r0!, {r4-r11, r14}			\n" /* Pop the core registers. */
 	"										\n"
 	"	tst r14, #0x10						\n" /* Is the task using the FPU context?  If so, pop the high vfp registers too. */
@@ -467,8 +675,8 @@ void xPortPendSVHandler( void )
 	"	vldmiaeq r0!, {s16-s31}				\n"
 	"										\n"
 	"	msr psp, r0							\n"
-	"	isb									\n"
 	"										\n"
+	"1:										\n"
 	#ifdef WORKAROUND_PMU_CM001 /* XMC4000 specific errata workaround. */
 		#if WORKAROUND_PMU_CM001 == 1
 	"			push { r14 }				\n"
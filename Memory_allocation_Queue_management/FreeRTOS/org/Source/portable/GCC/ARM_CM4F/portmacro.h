@@ -112,6 +112,61 @@ not necessary for to use this port.  They are defined so the common demo files
 #define portTASK_FUNCTION( vFunction, pvParameters ) void vFunction( void *pvParameters )
 /*-----------------------------------------------------------*/
 
+/* Trace timestamp.  The DWT cycle counter is read directly, so taking a
+timestamp costs a single load. */
+#define portDWT_CYCCNT_REG				( * ( ( volatile uint32_t * ) 0xe0001004 ) )
+extern void vPortEnableCycleCounter( void );
+#define portINIT_TRACE_TIMESTAMP()		vPortEnableCycleCounter()
+#define portGET_TRACE_TIMESTAMP()		portDWT_CYCCNT_REG
+#define portTRACE_TIMESTAMP_HZ			configCPU_CLOCK_HZ
+/*-----------------------------------------------------------*/
+
+/* Stack overflow guards.  The lowest naturally aligned block of
+portSTACK_GUARD_BYTES inside the stack of the running task is guarded, either by
+a DWT watchpoint that raises the DebugMonitor exception when the block is
+written (configSTACK_OVERFLOW_WATCHPOINT), or by a read only MPU region that
+raises MemManage before the write completes (configSTACK_OVERFLOW_MPU_GUARD).
+portSET_STACK_GUARD() moves the guard as each task is switched in.  The block
+is inside the stack so accesses to whatever lies below the stack are not
+caught. */
+#define portSTACK_GUARD_SIZE_BITS				( 5UL )
+#define portSTACK_GUARD_BYTES					( 1UL << portSTACK_GUARD_SIZE_BITS )
+#define portSTACK_GUARD_ADDRESS( pxStack )		( ( ( uint32_t ) ( pxStack ) + ( portSTACK_GUARD_BYTES - 1UL ) ) & ~( portSTACK_GUARD_BYTES - 1UL ) )
+
+#if( configSTACK_OVERFLOW_WATCHPOINT == 1 )
+	extern void vPortSetStackWatchpoint( StackType_t *pxStack );
+	#define portSET_STACK_GUARD( pxStack )	vPortSetStackWatchpoint( pxStack )
+#elif( configSTACK_OVERFLOW_MPU_GUARD == 1 )
+	/* The size and attributes of the guard region are set once by
+	xPortStartScheduler(), so moving it is a single write of the region's base
+	address, which also selects the region. */
+	#define portMPU_REGION_BASE_ADDRESS_REG	( * ( ( volatile uint32_t * ) 0xe000ed9c ) )
+	#define portMPU_REGION_VALID_BIT		( 1UL << 4UL )
+	#define portMPU_STACK_GUARD_REGION		( 7UL )
+	#define portSET_STACK_GUARD( pxStack )	portMPU_REGION_BASE_ADDRESS_REG = ( portSTACK_GUARD_ADDRESS( pxStack ) | portMPU_REGION_VALID_BIT | portMPU_STACK_GUARD_REGION )
+#endif
+/*-----------------------------------------------------------*/
+
+/* Floating point context statistics.  xPortPendSVHandler() saves s16 to s31,
+and stacks the EXC_RETURN value with r4 to r11, when bit 4 of EXC_RETURN is
+clear - that is, when the task has used the FPU since CONTROL.FPCA was last
+cleared.  The EXC_RETURN value is the ninth word of the saved context. */
+#define portEXC_RETURN_STANDARD_FRAME_BIT		( 0x10UL )
+#define portFPU_CONTEXT_SAVED( pxTopOfStack )	( ( ( ( pxTopOfStack )[ 8 ] ) & portEXC_RETURN_STANDARD_FRAME_BIT ) == 0UL )
+#define portCLEAR_FPU_CONTEXT()					vPortClearFPUContext()
+/*-----------------------------------------------------------*/
+
+/* Monotonic clock.  The time within the current tick period is read from the
+SysTick counter, which counts at configSYSTICK_CLOCK_HZ. */
+extern uint32_t ulPortGetTickFraction( UBaseType_t *puxPendingTicks );
+#define portGET_TICK_FRACTION( puxPendingTicks )	ulPortGetTickFraction( puxPendingTicks )
+#ifdef configSYSTICK_CLOCK_HZ
+	#define portTICK_FRACTION_HZ					configSYSTICK_CLOCK_HZ
+#else
+	#define portTICK_FRACTION_HZ					configCPU_CLOCK_HZ
+#endif
+/*-----------------------------------------------------------*/
+
 /* Tickless idle/low power functionality. */
 #ifndef portSUPPRESS_TICKS_AND_SLEEP
 	extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
@@ -233,6 +288,23 @@ portFORCE_INLINE static void vPortSetBASEPRI( uint32_t ulNewMaskValue )
 }
 /*-----------------------------------------------------------*/
 
+portFORCE_INLINE static void vPortClearFPUContext( void )
+{
+uint32_t ulControl;
+
+	/* Clearing CONTROL.FPCA discards the floating point context of the running
+	task, so exceptions stack a standard frame until the FPU is next used. */
+	__asm volatile
+	(
+		"	mrs %0, control		\n"
+		"	bic %0, %0, #4		\n"
+		"	msr control, %0		\n"
+		"	isb					\n"
+		: "=r" ( ulControl ) :: "memory"
+	);
+}
+/*-----------------------------------------------------------*/
+
 #define portMEMORY_BARRIER() __asm volatile( "" ::: "memory" )
 
 #ifdef __cplusplus
@@ -0,0 +1,706 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the Posix port.
+ *
+ * Each task is a host thread, and each simulated core is a permit to run that
+ * is passed from thread to thread on a context switch.  A thread that does not
+ * hold a core waits on its own semaphore.  Interrupts are simulated by setting
+ * a bit in the pending mask of a core, then sending SIGUSR1 to the thread that
+ * holds the core.  The signal handler only processes the interrupt if the
+ * thread has not masked interrupts - otherwise the interrupt is processed when
+ * the mask is cleared.
+ *
+ * As in any host simulation the tasks must not be switched out while they are
+ * inside a C library function that takes a lock (printf(), malloc(), etc.) that
+ * another task might then also try to take.  Call such functions from within
+ * a critical section.
+ *----------------------------------------------------------*/
+
+/* Standard includes. */
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define portINTERRUPT_SIGNAL		SIGUSR1
+#define portNO_CORE					( ( BaseType_t ) -1 )
+#define portNANOSECONDS_PER_SECOND	( 1000000000L )
+
+/* The TCB of the task that is running on each core.  As with the other ports
+the task control block is not visible here, only its first member, which for
+this port points to the thread that runs the task. */
+#if( configNUMBER_OF_CORES == 1 )
+	extern void * volatile pxCurrentTCB;
+	#define portCURRENT_TCB( xCoreID )	( ( void ) ( xCoreID ), pxCurrentTCB )
+#else
+	extern void * volatile pxCurrentTCBs[];
+	#define portCURRENT_TCB( xCoreID )	( pxCurrentTCBs[ ( xCoreID ) ] )
+#endif
+
+/* The host thread that runs a task.  The structure is placed at the top of the
+stack allocated to the task by the kernel, and pxTopOfStack points to it. */
+typedef struct THREAD
+{
+	pthread_t xThread;
+	sem_t xWakeSemaphore;				/*< Posted when the thread is given a core. */
+	TaskFunction_t pxCode;
+	void *pvParameters;
+	volatile BaseType_t xCoreID;		/*< The core the thread was last given. */
+	volatile BaseType_t xExit;			/*< Set when the task has been deleted. */
+} Thread_t;
+
+/* A kernel spinlock.  The lock is held by a core, not a thread, as a thread
+cannot be switched out while it holds a lock. */
+typedef struct SPINLOCK
+{
+	volatile BaseType_t xOwnerCore;
+	UBaseType_t uxRecursionCount;
+} Spinlock_t;
+
+#define portGET_THREAD( pxTCB )		( *( ( Thread_t ** ) ( pxTCB ) ) )
+/*-----------------------------------------------------------*/
+
+/*
+ * The entry point of each task thread.
+ */
+static void *prvThreadEntry( void *pvParameters );
+
+/*
+ * Block the calling thread until it is given a core.
+ */
+static void prvWaitForCore( void );
+
+/*
+ * Give the core xCoreID to pxThread.
+ */
+static void prvGiveCore( Thread_t *pxThread, BaseType_t xCoreID );
+
+/*
+ * Run the scheduler on the calling core, and if a different task was selected
+ * pass the core to its thread and wait to be given a core again.
+ */
+static void prvSwitchContext( void );
+
+/*
+ * Process the interrupts that are pending on the core held by the calling
+ * thread.
+ */
+static void prvProcessInterrupts( void );
+
+/*
+ * Mark an interrupt as pending on xCoreID and signal the thread that holds
+ * the core.
+ */
+static void prvTriggerInterrupt( BaseType_t xCoreID, uint32_t ulInterruptNumber );
+
+/*
+ * Simulated interrupts are delivered using portINTERRUPT_SIGNAL.
+ */
+static void prvInterruptSignalHandler( int iSignal );
+
+/*
+ * Generates the tick interrupt at configTICK_RATE_HZ.
+ */
+static void *prvTickThread( void *pvParameters );
+/*-----------------------------------------------------------*/
+
+/* State of the calling host thread. */
+static __thread Thread_t *pxThisThread = NULL;
+static __thread volatile BaseType_t xThisCoreID = 0;
+static __thread volatile sig_atomic_t xHoldsCore = pdFALSE;
+static __thread volatile sig_atomic_t xInterruptsMasked = pdTRUE;
+
+/* Interrupts pending on each core, and the number of unprocessed ticks. */
+static volatile uint32_t ulPendingInterrupts[ configNUMBER_OF_CORES ] = { 0 };
+static volatile uint32_t ulPendingTicks = 0;
+
+/* The host time, in nanoseconds, of the last tick added to ulPendingTicks.
+ulTickSequence is odd while the tick thread changes ullLastTickTime and
+ulPendingTicks. */
+static volatile uint64_t ullLastTickTime = 0;
+static volatile uint32_t ulTickSequence = 0;
+static uint32_t ( *pvInterruptHandlers[ portMAX_INTERRUPTS ] )( void ) = { NULL };
+
+/* The thread that holds each core.  xCoreThreadMutex prevents a thread from
+exiting while it is being signalled. */
+static volatile pthread_t xCoreThreads[ configNUMBER_OF_CORES ];
+static volatile BaseType_t xCoreThreadsValid = pdFALSE;
+static pthread_mutex_t xCoreThreadMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static pthread_t xTickThread;
+static sem_t xSchedulerEndSemaphore;
+static volatile BaseType_t xSchedulerEnd = pdFALSE;
+
+#if( configNUMBER_OF_CORES > 1 )
+	UBaseType_t uxPortCriticalNesting[ configNUMBER_OF_CORES ] = { 0 };
+	static Spinlock_t xSpinlocks[ portNUM_LOCKS ] = { { portNO_CORE, 0 }, { portNO_CORE, 0 }, { portNO_CORE, 0 } };
+#else
+	static UBaseType_t uxCriticalNesting = 0;
+#endif
+/*-----------------------------------------------------------*/
+
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+Thread_t *pxThread;
+UBaseType_t uxSavedInterruptStatus;
+int iResult;
+
+	/* Place the thread structure at the top of the stack.  pxTopOfStack is
+	already aligned by the kernel. */
+	pxThread = ( Thread_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack - sizeof( Thread_t ) ) & ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) );
+	memset( ( void * ) pxThread, 0x00, sizeof( Thread_t ) );
+	pxThread->pxCode = pxCode;
+	pxThread->pvParameters = pvParameters;
+	pxThread->xCoreID = portNO_CORE;
+	( void ) sem_init( &( pxThread->xWakeSemaphore ), 0, 0 );
+
+	/* The calling task must not be switched out while the C library is
+	creating the thread. */
+	uxSavedInterruptStatus = uxPortSetInterruptMask();
+	{
+		iResult = pthread_create( &( pxThread->xThread ), NULL, prvThreadEntry, ( void * ) pxThread );
+	}
+	vPortClearInterruptMask( uxSavedInterruptStatus );
+	configASSERT( iResult == 0 );
+	( void ) iResult;
+
+	return ( StackType_t * ) pxThread;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvThreadEntry( void *pvParameters )
+{
+sigset_t xSignals;
+
+	pxThisThread = ( Thread_t * ) pvParameters;
+
+	( void ) sigemptyset( &xSignals );
+	( void ) sigaddset( &xSignals, portINTERRUPT_SIGNAL );
+	( void ) pthread_sigmask( SIG_UNBLOCK, &xSignals, NULL );
+
+	prvWaitForCore();
+
+	/* Tasks start with interrupts enabled. */
+	vPortClearInterruptMask( pdFALSE );
+	pxThisThread->pxCode( pxThisThread->pvParameters );
+
+	/* Task functions must not return.  Delete the task instead so the thread
+	is cleaned up in the same way as any other deleted task. */
+	configASSERT( pdFALSE );
+	vTaskDelete( NULL );
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaitForCore( void )
+{
+	xHoldsCore = pdFALSE;
+
+	/* sem_wait() is interrupted by signals whether SA_RESTART is set or
+	not. */
+	while( sem_wait( &( pxThisThread->xWakeSemaphore ) ) != 0 )
+	{
+		configASSERT( errno == EINTR );
+	}
+
+	if( pxThisThread->xExit != pdFALSE )
+	{
+		pthread_exit( NULL );
+	}
+
+	xThisCoreID = pxThisThread->xCoreID;
+	xHoldsCore = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvGiveCore( Thread_t *pxThread, BaseType_t xCoreID )
+{
+	pxThread->xCoreID = xCoreID;
+	xCoreThreads[ xCoreID ] = pxThread->xThread;
+	__sync_synchronize();
+	( void ) sem_post( &( pxThread->xWakeSemaphore ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchContext( void )
+{
+BaseType_t xCoreID = xThisCoreID;
+Thread_t *pxNextThread;
+
+	/* Called with interrupts masked. */
+	vTaskSwitchContext();
+	pxNextThread = portGET_THREAD( portCURRENT_TCB( xCoreID ) );
+
+	if( pxNextThread != pxThisThread )
+	{
+		/* The thread stops holding the core before the core is passed on, as
+		with more than one core the thread may be given another core by
+		another thread before it reaches prvWaitForCore(). */
+		xHoldsCore = pdFALSE;
+		prvGiveCore( pxNextThread, xCoreID );
+		prvWaitForCore();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessInterrupts( void )
+{
+uint32_t ulPending, ulTicks, ulInterrupt;
+BaseType_t xSwitchRequired;
+UBaseType_t uxSavedInterruptStatus;
+
+	/* Called by a thread that holds a core with interrupts unmasked. */
+	do
+	{
+		xInterruptsMasked = pdTRUE;
+		__atomic_signal_fence( __ATOMIC_SEQ_CST );
+
+		/* Note the core held by the thread can change each time around the
+		loop. */
+		while( ( ulPending = __atomic_exchange_n( &( ulPendingInterrupts[ xThisCoreID ] ), 0UL, __ATOMIC_SEQ_CST ) ) != 0UL )
+		{
+			xSwitchRequired = ( ( ulPending & ( 1UL << portINTERRUPT_YIELD ) ) != 0UL ) ? pdTRUE : pdFALSE;
+
+			if( ( ulPending & ( 1UL << portINTERRUPT_TICK ) ) != 0UL )
+			{
+				uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+				{
+					/* Taken within the critical section so the ticks are
+					always in either ulPendingTicks or the tick count, as seen
+					by ulPortGetTickFraction(). */
+					ulTicks = __atomic_exchange_n( &ulPendingTicks, 0UL, __ATOMIC_SEQ_CST );
+
+					/* Ticks missed while the host was busy are not lost. */
+					while( ulTicks > 0UL )
+					{
+						if( xTaskIncrementTick() != pdFALSE )
+						{
+							xSwitchRequired = pdTRUE;
+						}
+
+						ulTicks--;
+					}
+				}
+				taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+			}
+
+			for( ulInterrupt = portFIRST_USER_INTERRUPT; ulInterrupt < portMAX_INTERRUPTS; ulInterrupt++ )
+			{
+				if( ( ( ulPending & ( 1UL << ulInterrupt ) ) != 0UL ) && ( pvInterruptHandlers[ ulInterrupt ] != NULL ) )
+				{
+					if( pvInterruptHandlers[ ulInterrupt ]() != pdFALSE )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+				}
+			}
+
+			if( xSwitchRequired != pdFALSE )
+			{
+				prvSwitchContext();
+			}
+		}
+
+		__atomic_signal_fence( __ATOMIC_SEQ_CST );
+		xInterruptsMasked = pdFALSE;
+
+		/* An interrupt that was triggered after the last check, but before
+		interrupts were unmasked, would otherwise be left pending. */
+	} while( __atomic_load_n( &( ulPendingInterrupts[ xThisCoreID ] ), __ATOMIC_SEQ_CST ) != 0UL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTriggerInterrupt( BaseType_t xCoreID, uint32_t ulInterruptNumber )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	( void ) __atomic_or_fetch( &( ulPendingInterrupts[ xCoreID ] ), 1UL << ulInterruptNumber, __ATOMIC_SEQ_CST );
+
+	/* The calling task must not be switched out while it holds the mutex. */
+	uxSavedInterruptStatus = uxPortSetInterruptMask();
+	{
+		( void ) pthread_mutex_lock( &xCoreThreadMutex );
+		{
+			if( xCoreThreadsValid != pdFALSE )
+			{
+				( void ) pthread_kill( xCoreThreads[ xCoreID ], portINTERRUPT_SIGNAL );
+			}
+		}
+		( void ) pthread_mutex_unlock( &xCoreThreadMutex );
+	}
+	vPortClearInterruptMask( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+static void prvInterruptSignalHandler( int iSignal )
+{
+int iSavedErrno = errno;
+
+	( void ) iSignal;
+
+	/* Threads that do not hold a core ignore the signal.  Interrupts pending on
+	a core are processed by the thread that holds it when the thread next
+	unmasks interrupts. */
+	if( ( xHoldsCore != pdFALSE ) && ( xInterruptsMasked == pdFALSE ) )
+	{
+		prvProcessInterrupts();
+	}
+
+	errno = iSavedErrno;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvTickThread( void *pvParameters )
+{
+struct timespec xNextTick;
+sigset_t xSignals;
+
+	( void ) pvParameters;
+
+	/* This thread never holds a core. */
+	( void ) sigemptyset( &xSignals );
+	( void ) sigaddset( &xSignals, portINTERRUPT_SIGNAL );
+	( void ) pthread_sigmask( SIG_BLOCK, &xSignals, NULL );
+
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xNextTick );
+	__atomic_store_n( &ullLastTickTime, ( ( uint64_t ) xNextTick.tv_sec * portNANOSECONDS_PER_SECOND ) + ( uint64_t ) xNextTick.tv_nsec, __ATOMIC_SEQ_CST );
+
+	while( xSchedulerEnd == pdFALSE )
+	{
+		xNextTick.tv_nsec += portNANOSECONDS_PER_SECOND / configTICK_RATE_HZ;
+		if( xNextTick.tv_nsec >= portNANOSECONDS_PER_SECOND )
+		{
+			xNextTick.tv_nsec -= portNANOSECONDS_PER_SECOND;
+			xNextTick.tv_sec++;
+		}
+
+		while( clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &xNextTick, NULL ) == EINTR )
+		{
+			/* Sleep the remainder of the tick period. */
+		}
+
+		( void ) __atomic_add_fetch( &ulTickSequence, 1UL, __ATOMIC_SEQ_CST );
+		__atomic_store_n( &ullLastTickTime, ( ( uint64_t ) xNextTick.tv_sec * portNANOSECONDS_PER_SECOND ) + ( uint64_t ) xNextTick.tv_nsec, __ATOMIC_SEQ_CST );
+		( void ) __atomic_add_fetch( &ulPendingTicks, 1UL, __ATOMIC_SEQ_CST );
+		( void ) __atomic_add_fetch( &ulTickSequence, 1UL, __ATOMIC_SEQ_CST );
+		prvTriggerInterrupt( 0, portINTERRUPT_TICK );
+	}
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+struct sigaction xAction;
+sigset_t xSignals;
+Thread_t *pxFirstThreads[ configNUMBER_OF_CORES ];
+BaseType_t xCoreID;
+
+	/* Interrupts are masked by vTaskStartScheduler(). */
+	( void ) sem_init( &xSchedulerEndSemaphore, 0, 0 );
+
+	memset( ( void * ) &xAction, 0x00, sizeof( xAction ) );
+	xAction.sa_handler = prvInterruptSignalHandler;
+	( void ) sigemptyset( &( xAction.sa_mask ) );
+	( void ) sigaction( portINTERRUPT_SIGNAL, &xAction, NULL );
+
+	/* The calling thread only waits for vTaskEndScheduler() to be called. */
+	( void ) sigemptyset( &xSignals );
+	( void ) sigaddset( &xSignals, portINTERRUPT_SIGNAL );
+	( void ) pthread_sigmask( SIG_BLOCK, &xSignals, NULL );
+
+	/* Select the first task for each core.  The kernel has already selected
+	the task for core 0 when there is a single core. */
+	for( xCoreID = 0; xCoreID < configNUMBER_OF_CORES; xCoreID++ )
+	{
+		#if( configNUMBER_OF_CORES > 1 )
+		{
+			xThisCoreID = xCoreID;
+			vTaskSwitchContext();
+		}
+		#endif
+
+		pxFirstThreads[ xCoreID ] = portGET_THREAD( portCURRENT_TCB( xCoreID ) );
+		xCoreThreads[ xCoreID ] = pxFirstThreads[ xCoreID ]->xThread;
+	}
+
+	xThisCoreID = 0;
+	xCoreThreadsValid = pdTRUE;
+	__sync_synchronize();
+
+	( void ) pthread_create( &xTickThread, NULL, prvTickThread, NULL );
+
+	for( xCoreID = 0; xCoreID < configNUMBER_OF_CORES; xCoreID++ )
+	{
+		prvGiveCore( pxFirstThreads[ xCoreID ], xCoreID );
+	}
+
+	while( sem_wait( &xSchedulerEndSemaphore ) != 0 )
+	{
+		/* Interrupted by a signal. */
+	}
+
+	( void ) pthread_join( xTickThread, NULL );
+
+	return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+	/* The tasks that do not hold a core remain blocked, and the calling task
+	keeps its core, until the process exits. */
+	portDISABLE_INTERRUPTS();
+	xSchedulerEnd = pdTRUE;
+	( void ) sem_post( &xSchedulerEndSemaphore );
+
+	for( ;; )
+	{
+		( void ) sem_wait( &( pxThisThread->xWakeSemaphore ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = uxPortSetInterruptMask();
+	{
+		( void ) __atomic_or_fetch( &( ulPendingInterrupts[ xThisCoreID ] ), 1UL << portINTERRUPT_YIELD, __ATOMIC_SEQ_CST );
+	}
+
+	/* The yield is performed now if interrupts were not already masked, and
+	otherwise when they are unmasked. */
+	vPortClearInterruptMask( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+UBaseType_t uxPreviousMask = ( UBaseType_t ) xInterruptsMasked;
+
+	xInterruptsMasked = pdTRUE;
+	__atomic_signal_fence( __ATOMIC_SEQ_CST );
+
+	return uxPreviousMask;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxNewMaskValue )
+{
+	__atomic_signal_fence( __ATOMIC_SEQ_CST );
+
+	if( uxNewMaskValue == ( UBaseType_t ) pdFALSE )
+	{
+		xInterruptsMasked = pdFALSE;
+
+		if( ( xHoldsCore != pdFALSE ) && ( __atomic_load_n( &( ulPendingInterrupts[ xThisCoreID ] ), __ATOMIC_SEQ_CST ) != 0UL ) )
+		{
+			prvProcessInterrupts();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetInterruptHandler( uint32_t ulInterruptNumber, uint32_t ( *pvHandler )( void ) )
+{
+	configASSERT( ( ulInterruptNumber >= portFIRST_USER_INTERRUPT ) && ( ulInterruptNumber < portMAX_INTERRUPTS ) );
+	pvInterruptHandlers[ ulInterruptNumber ] = pvHandler;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGenerateSimulatedInterrupt( uint32_t ulInterruptNumber )
+{
+	configASSERT( ( ulInterruptNumber >= portFIRST_USER_INTERRUPT ) && ( ulInterruptNumber < portMAX_INTERRUPTS ) );
+	prvTriggerInterrupt( 0, ulInterruptNumber );
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulPortGetTraceTimestamp( void )
+{
+struct timespec xNow;
+
+	/* Nanoseconds, wrapping every 4.3 seconds, which the trace converter
+	allows for as long as events are recorded more often than that. */
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+	return ( uint32_t ) ( ( ( uint64_t ) xNow.tv_sec * 1000000000ULL ) + ( uint64_t ) xNow.tv_nsec );
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulPortGetTickFraction( UBaseType_t *puxPendingTicks )
+{
+struct timespec xNow;
+uint32_t ulPending, ulSequence;
+uint64_t ullLastTick, ullElapsed;
+const uint64_t ullTickPeriod = portNANOSECONDS_PER_SECOND / configTICK_RATE_HZ;
+
+	/* Called from a critical section, so ticks cannot move from ulPendingTicks
+	to the tick count, but the tick thread can still add to ulPendingTicks. */
+	do
+	{
+		ulSequence = __atomic_load_n( &ulTickSequence, __ATOMIC_SEQ_CST );
+		ulPending = __atomic_load_n( &ulPendingTicks, __ATOMIC_SEQ_CST );
+		ullLastTick = __atomic_load_n( &ullLastTickTime, __ATOMIC_SEQ_CST );
+		( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+	} while( ( ( ulSequence & 1UL ) != 0UL ) || ( ulSequence != __atomic_load_n( &ulTickSequence, __ATOMIC_SEQ_CST ) ) );
+
+	*puxPendingTicks = ( UBaseType_t ) ulPending;
+
+	/* A late tick thread must not let the time reach the next tick. */
+	ullElapsed = ( ( ( uint64_t ) xNow.tv_sec * portNANOSECONDS_PER_SECOND ) + ( uint64_t ) xNow.tv_nsec ) - ullLastTick;
+
+	if( ullElapsed >= ullTickPeriod )
+	{
+		ullElapsed = ullTickPeriod - 1ULL;
+	}
+
+	return ( uint32_t ) ullElapsed;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCleanUpTCB( void *pxTCB )
+{
+Thread_t *pxThread = portGET_THREAD( pxTCB );
+UBaseType_t uxSavedInterruptStatus;
+
+	/* The task is not running, so its thread is waiting for a core, or is
+	just about to.  Once the mutex is released the thread is no longer being
+	signalled. */
+	uxSavedInterruptStatus = uxPortSetInterruptMask();
+	{
+		( void ) pthread_mutex_lock( &xCoreThreadMutex );
+		pxThread->xExit = pdTRUE;
+		( void ) pthread_mutex_unlock( &xCoreThreadMutex );
+
+		( void ) sem_post( &( pxThread->xWakeSemaphore ) );
+		( void ) pthread_join( pxThread->xThread, NULL );
+		( void ) sem_destroy( &( pxThread->xWakeSemaphore ) );
+	}
+	vPortClearInterruptMask( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+#if( configNUMBER_OF_CORES > 1 )
+
+	BaseType_t xPortGetCoreID( void )
+	{
+		return xThisCoreID;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortYieldCore( BaseType_t xCoreID )
+	{
+		if( xCoreID == xThisCoreID )
+		{
+			vPortYield();
+		}
+		else
+		{
+			prvTriggerInterrupt( xCoreID, portINTERRUPT_YIELD );
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortGetSpinlock( BaseType_t xLock )
+	{
+	Spinlock_t *pxLock = &( xSpinlocks[ xLock ] );
+	BaseType_t xFree;
+
+		if( __atomic_load_n( &( pxLock->xOwnerCore ), __ATOMIC_ACQUIRE ) == xThisCoreID )
+		{
+			( pxLock->uxRecursionCount )++;
+		}
+		else
+		{
+			for( ;; )
+			{
+				xFree = portNO_CORE;
+
+				if( __atomic_compare_exchange_n( &( pxLock->xOwnerCore ), &xFree, xThisCoreID, pdFALSE, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED ) != pdFALSE )
+				{
+					break;
+				}
+
+				/* The owner may be a host thread that is not currently
+				scheduled by the host. */
+				( void ) sched_yield();
+			}
+
+			pxLock->uxRecursionCount = 1;
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortReleaseSpinlock( BaseType_t xLock )
+	{
+	Spinlock_t *pxLock = &( xSpinlocks[ xLock ] );
+
+		configASSERT( pxLock->xOwnerCore == xThisCoreID );
+		( pxLock->uxRecursionCount )--;
+
+		if( pxLock->uxRecursionCount == 0 )
+		{
+			__atomic_store_n( &( pxLock->xOwnerCore ), portNO_CORE, __ATOMIC_RELEASE );
+		}
+	}
+
+#else /* configNUMBER_OF_CORES */
+
+	void vPortEnterCritical( void )
+	{
+		portDISABLE_INTERRUPTS();
+		uxCriticalNesting++;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortExitCritical( void )
+	{
+		if( uxCriticalNesting > 0 )
+		{
+			uxCriticalNesting--;
+
+			if( uxCriticalNesting == 0 )
+			{
+				portENABLE_INTERRUPTS();
+			}
+		}
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
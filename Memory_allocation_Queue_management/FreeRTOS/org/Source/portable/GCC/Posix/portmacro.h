@@ -0,0 +1,203 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-----------------------------------------------------------
+ * Port specific definitions.
+ *
+ * The settings in this file configure FreeRTOS correctly for the
+ * given hardware and compiler.
+ *
+ * These settings should not be altered.
+ *-----------------------------------------------------------
+ */
+
+/* Type definitions. */
+#define portCHAR		char
+#define portFLOAT		float
+#define portDOUBLE		double
+#define portLONG		long
+#define portSHORT		short
+#define portSTACK_TYPE	unsigned long
+#define portBASE_TYPE	long
+#define portPOINTER_SIZE_TYPE	uintptr_t
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+#if( configUSE_16_BIT_TICKS == 1 )
+	typedef uint16_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffff
+#else
+	typedef uint32_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffffffffUL
+
+	/* 32-bit tick type on a 32 or 64-bit architecture, so reads of the tick
+	count do not need to be guarded with a critical section. */
+	#define portTICK_TYPE_IS_ATOMIC 1
+#endif
+/*-----------------------------------------------------------*/
+
+/* Architecture specifics. */
+#define portSTACK_GROWTH			( -1 )
+#define portTICK_PERIOD_MS			( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT			16
+/*-----------------------------------------------------------*/
+
+/* Each task runs in its own host thread, and each simulated core is a permit to
+run that only one task thread holds at a time.  Interrupts are simulated by
+setting a pending bit for the target core and signalling the thread that holds
+the core.  The interrupt is then handled in that thread as soon as it is not
+masked. */
+
+/* Scheduler utilities. */
+extern void vPortYield( void );
+#define portYIELD()									vPortYield()
+#define portEND_SWITCHING_ISR( xSwitchRequired )	if( xSwitchRequired != pdFALSE ) portYIELD()
+#define portYIELD_FROM_ISR( x )						portEND_SWITCHING_ISR( x )
+/*-----------------------------------------------------------*/
+
+/* Critical section management. */
+extern UBaseType_t uxPortSetInterruptMask( void );
+extern void vPortClearInterruptMask( UBaseType_t uxNewMaskValue );
+#define portSET_INTERRUPT_MASK_FROM_ISR()		uxPortSetInterruptMask()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )	vPortClearInterruptMask( x )
+#define portDISABLE_INTERRUPTS()				( void ) uxPortSetInterruptMask()
+#define portENABLE_INTERRUPTS()					vPortClearInterruptMask( pdFALSE )
+
+#if defined( configNUMBER_OF_CORES ) && ( configNUMBER_OF_CORES > 1 )
+
+	/* The critical sections are implemented by the kernel on top of the
+	spinlocks below. */
+	#define portENTER_CRITICAL()					vTaskEnterCritical()
+	#define portEXIT_CRITICAL()						vTaskExitCritical()
+
+	/* Multiple core support. */
+	extern BaseType_t xPortGetCoreID( void );
+	extern void vPortYieldCore( BaseType_t xCoreID );
+	extern UBaseType_t uxPortCriticalNesting[];
+	#define portGET_CORE_ID()						xPortGetCoreID()
+	#define portYIELD_CORE( xCoreID )				vPortYieldCore( xCoreID )
+	#define portGET_CRITICAL_NESTING_COUNT()		( uxPortCriticalNesting[ portGET_CORE_ID() ] )
+	#define portINCREMENT_CRITICAL_NESTING_COUNT()	( uxPortCriticalNesting[ portGET_CORE_ID() ]++ )
+	#define portDECREMENT_CRITICAL_NESTING_COUNT()	( uxPortCriticalNesting[ portGET_CORE_ID() ]-- )
+
+	/* The kernel spinlocks, and the lock used by the heap when it does not
+	suspend the scheduler.  All are recursive on the core that holds them. */
+	#define portTASK_LOCK	0
+	#define portISR_LOCK	1
+	#define portHEAP_LOCK	2
+	#define portNUM_LOCKS	3
+	extern void vPortGetSpinlock( BaseType_t xLock );
+	extern void vPortReleaseSpinlock( BaseType_t xLock );
+	#define portGET_TASK_LOCK()						vPortGetSpinlock( portTASK_LOCK )
+	#define portRELEASE_TASK_LOCK()					vPortReleaseSpinlock( portTASK_LOCK )
+	#define portGET_ISR_LOCK()						vPortGetSpinlock( portISR_LOCK )
+	#define portRELEASE_ISR_LOCK()					vPortReleaseSpinlock( portISR_LOCK )
+	#define portGET_HEAP_LOCK()						vPortGetSpinlock( portHEAP_LOCK )
+	#define portRELEASE_HEAP_LOCK()					vPortReleaseSpinlock( portHEAP_LOCK )
+
+#else
+
+	extern void vPortEnterCritical( void );
+	extern void vPortExitCritical( void );
+	#define portENTER_CRITICAL()					vPortEnterCritical()
+	#define portEXIT_CRITICAL()						vPortExitCritical()
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
+/* Simulated interrupts.  Interrupt numbers below portFIRST_USER_INTERRUPT are
+used by the port itself. */
+#define portINTERRUPT_YIELD				( 0UL )
+#define portINTERRUPT_TICK				( 1UL )
+#define portFIRST_USER_INTERRUPT		( 2UL )
+#define portMAX_INTERRUPTS				( 32UL )
+
+/* Install the handler for simulated interrupt ulInterruptNumber.  The handler
+returns pdTRUE if a context switch is required, as with xHigherPriorityTaskWoken.
+vPortGenerateSimulatedInterrupt() can be called from any host thread, for
+example one simulating a peripheral, and the handler runs on core 0. */
+extern void vPortSetInterruptHandler( uint32_t ulInterruptNumber, uint32_t ( *pvHandler )( void ) );
+extern void vPortGenerateSimulatedInterrupt( uint32_t ulInterruptNumber );
+/*-----------------------------------------------------------*/
+
+/* Trace timestamp, in nanoseconds of the host monotonic clock. */
+extern uint32_t ulPortGetTraceTimestamp( void );
+#define portGET_TRACE_TIMESTAMP()	ulPortGetTraceTimestamp()
+#define portTRACE_TIMESTAMP_HZ		( 1000000000UL )
+/*-----------------------------------------------------------*/
+
+/* Monotonic clock.  The time within the current tick period is measured with
+the host monotonic clock, from the time the tick thread generated the last
+tick. */
+extern uint32_t ulPortGetTickFraction( UBaseType_t *puxPendingTicks );
+#define portGET_TICK_FRACTION( puxPendingTicks )	ulPortGetTickFraction( puxPendingTicks )
+#define portTICK_FRACTION_HZ						( 1000000000UL )
+/*-----------------------------------------------------------*/
+
+/* The host thread of a task is stopped when the TCB of the task is freed. */
+extern void vPortCleanUpTCB( void *pxTCB );
+#define portCLEAN_UP_TCB( pxTCB )	vPortCleanUpTCB( pxTCB )
+/*-----------------------------------------------------------*/
+
+/* Task function macros as described on the FreeRTOS.org WEB site.  These are
+not necessary for to use this port.  They are defined so the common demo files
+(which build with all the ports) will build. */
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters ) void vFunction( void *pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters ) void vFunction( void *pvParameters )
+/*-----------------------------------------------------------*/
+
+/* Architecture specific optimisations.  Generic task selection is used as it is
+required when more than one core is in use. */
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+	#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#endif
+
+#define portNOP()
+
+#define portINLINE	__inline
+
+#ifndef portFORCE_INLINE
+	#define portFORCE_INLINE inline __attribute__(( always_inline))
+#endif
+
+#define portMEMORY_BARRIER() __sync_synchronize()
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORTMACRO_H */
@@ -43,8 +43,16 @@ task.h is included from an application file. */
 #include "FreeRTOS.h"
 #include "task.h"
 
+#if( configUSE_HEAP_TRACE == 1 )
+	#include "heap_trace.h"
+#endif
+
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+/* heap_regions.c is used instead of this file when the heap spans several
+regions.  This #if is closed at the very bottom of this file. */
+#if( configUSE_HEAP_REGIONS == 0 )
+
 #if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
 	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
 #endif
@@ -110,14 +118,41 @@ application.  When the bit is free the block is still part of the free heap
 space. */
 static size_t xBlockAllocatedBit = 0;
 
+#if( configHEAP_ISR_BLOCK_COUNT > 0 )
+
+	/* The size of each block reserved for interrupts, rounded up so every
+	block stays aligned. */
+	#define heapISR_BLOCK_SIZE	( ( ( size_t ) configHEAP_ISR_BLOCK_SIZE + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+	/* The blocks reserved for interrupts are kept apart from the heap in a
+	singly linked list of equal sized blocks, so they can be allocated and
+	freed in constant time with interrupts masked. */
+	static uint8_t ucIsrBlocks[ ( configHEAP_ISR_BLOCK_COUNT * heapISR_BLOCK_SIZE ) + portBYTE_ALIGNMENT ];
+	static uint8_t *pucIsrBlocksStart = NULL, *pucIsrBlocksEnd = NULL;
+	static BlockLink_t *pxFreeIsrBlocks = NULL;
+	static size_t xFreeIsrBlocks = 0U;
+	static size_t xMinimumEverFreeIsrBlocks = 0U;
+
+	/* True if pv was returned by pvPortMallocFromISR(). */
+	#define heapIS_ISR_BLOCK( pv )	( ( ( uint8_t * ) ( pv ) >= pucIsrBlocksStart ) && ( ( uint8_t * ) ( pv ) < pucIsrBlocksEnd ) )
+
+	/*
+	 * Links the reserved blocks into the list of free reserved blocks the first
+	 * time one is allocated.
+	 */
+	static void prvIsrBlocksInit( void );
+
+#endif /* configHEAP_ISR_BLOCK_COUNT */
+
 /*-----------------------------------------------------------*/
 
 void *pvPortMalloc( size_t xWantedSize )
 {
 BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
 void *pvReturn = NULL;
+UBaseType_t uxSavedInterruptStatus;
 
-	vTaskSuspendAll();
+	heapLOCK( uxSavedInterruptStatus );
 	{
 		/* If this is the first call to malloc then the heap will require
 		initialisation to setup the list of free blocks. */
@@ -224,6 +259,12 @@ void *pvReturn = NULL;
 					pxBlock->xBlockSize |= xBlockAllocatedBit;
 					pxBlock->pxNextFreeBlock = NULL;
 					xNumberOfSuccessfulAllocations++;
+
+					#if( configUSE_HEAP_TRACE == 1 )
+					{
+						vHeapTraceAlloc( pvReturn, pxBlock->xBlockSize & ~xBlockAllocatedBit, heapTRACE_CALLER() );
+					}
+					#endif
 				}
 				else
 				{
@@ -242,7 +283,7 @@ void *pvReturn = NULL;
 
 		traceMALLOC( pvReturn, xWantedSize );
 	}
-	( void ) xTaskResumeAll();
+	heapUNLOCK( uxSavedInterruptStatus );
 
 	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
 	{
@@ -267,6 +308,17 @@ void vPortFree( void *pv )
 {
 uint8_t *puc = ( uint8_t * ) pv;
 BlockLink_t *pxLink;
+UBaseType_t uxSavedInterruptStatus;
+
+	#if( configHEAP_ISR_BLOCK_COUNT > 0 )
+	{
+		if( heapIS_ISR_BLOCK( pv ) )
+		{
+			vPortFreeFromISR( pv );
+			return;
+		}
+	}
+	#endif
 
 	if( pv != NULL )
 	{
@@ -289,15 +341,21 @@ BlockLink_t *pxLink;
 				allocated. */
 				pxLink->xBlockSize &= ~xBlockAllocatedBit;
 
-				vTaskSuspendAll();
+				heapLOCK( uxSavedInterruptStatus );
 				{
 					/* Add this block to the list of free blocks. */
 					xFreeBytesRemaining += pxLink->xBlockSize;
 					traceFREE( pv, pxLink->xBlockSize );
 					prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
 					xNumberOfSuccessfulFrees++;
+
+					#if( configUSE_HEAP_TRACE == 1 )
+					{
+						vHeapTraceFree( pv );
+					}
+					#endif
 				}
-				( void ) xTaskResumeAll();
+				heapUNLOCK( uxSavedInterruptStatus );
 			}
 			else
 			{
@@ -375,6 +433,12 @@ size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
 
 	/* Work out the position of the top bit in a size_t variable. */
 	xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
+
+	#if( configUSE_HEAP_TRACE == 1 )
+	{
+		vHeapTraceInit( xFreeBytesRemaining );
+	}
+	#endif
 }
 /*-----------------------------------------------------------*/
 
@@ -443,8 +507,9 @@ void vPortGetHeapStats( HeapStats_t *pxHeapStats )
 {
 BlockLink_t *pxBlock;
 size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+UBaseType_t uxSavedInterruptStatus;
 
-	vTaskSuspendAll();
+	heapLOCK( uxSavedInterruptStatus );
 	{
 		pxBlock = xStart.pxNextFreeBlock;
 
@@ -473,20 +538,154 @@ size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY use
 				pxBlock = pxBlock->pxNextFreeBlock;
 			} while( pxBlock != pxEnd );
 		}
+
+		/* The counters are only updated with the heap locked, so are read
+		here rather than in a separate critical section. */
+		pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+		pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+		pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+		pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
 	}
-	xTaskResumeAll();
+	heapUNLOCK( uxSavedInterruptStatus );
 
 	pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
 	pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
 	pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+}
+/*-----------------------------------------------------------*/
+
+#if( configHEAP_ISR_BLOCK_COUNT > 0 )
 
-	taskENTER_CRITICAL();
+	void *pvPortMallocFromISR( size_t xWantedSize )
 	{
-		pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
-		pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
-		pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
-		pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+	void *pvReturn = NULL;
+	UBaseType_t uxSavedInterruptStatus;
+
+		if( ( xWantedSize > 0 ) && ( xWantedSize <= ( size_t ) configHEAP_ISR_BLOCK_SIZE ) )
+		{
+			heapLOCK_FROM_ISR( uxSavedInterruptStatus );
+			{
+				if( pucIsrBlocksStart == NULL )
+				{
+					prvIsrBlocksInit();
+				}
+
+				if( pxFreeIsrBlocks != NULL )
+				{
+					pvReturn = ( void * ) pxFreeIsrBlocks;
+					pxFreeIsrBlocks = pxFreeIsrBlocks->pxNextFreeBlock;
+					xFreeIsrBlocks--;
+
+					if( xFreeIsrBlocks < xMinimumEverFreeIsrBlocks )
+					{
+						xMinimumEverFreeIsrBlocks = xFreeIsrBlocks;
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				traceMALLOC( pvReturn, xWantedSize );
+			}
+			heapUNLOCK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pvReturn;
 	}
-	taskEXIT_CRITICAL();
-}
+	/*-----------------------------------------------------------*/
+
+	void vPortFreeFromISR( void *pv )
+	{
+	BlockLink_t *pxLink = ( BlockLink_t * ) pv;
+	UBaseType_t uxSavedInterruptStatus;
+
+		/* Only the reserved blocks can be freed from an interrupt. */
+		configASSERT( heapIS_ISR_BLOCK( pv ) );
+		configASSERT( ( ( size_t ) ( ( uint8_t * ) pv - pucIsrBlocksStart ) % heapISR_BLOCK_SIZE ) == 0 );
+
+		if( heapIS_ISR_BLOCK( pv ) )
+		{
+			heapLOCK_FROM_ISR( uxSavedInterruptStatus );
+			{
+				traceFREE( pv, heapISR_BLOCK_SIZE );
+				pxLink->pxNextFreeBlock = pxFreeIsrBlocks;
+				pxFreeIsrBlocks = pxLink;
+				xFreeIsrBlocks++;
+			}
+			heapUNLOCK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	size_t xPortGetFreeIsrBlockCount( void )
+	{
+		/* Before the first allocation all the blocks are free. */
+		return ( pucIsrBlocksStart == NULL ) ? ( size_t ) configHEAP_ISR_BLOCK_COUNT : xFreeIsrBlocks;
+	}
+	/*-----------------------------------------------------------*/
+
+	size_t xPortGetMinimumEverFreeIsrBlockCount( void )
+	{
+		return ( pucIsrBlocksStart == NULL ) ? ( size_t ) configHEAP_ISR_BLOCK_COUNT : xMinimumEverFreeIsrBlocks;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvIsrBlocksInit( void )
+	{
+	size_t uxAddress, xBlock;
+	BlockLink_t *pxLink;
+
+		/* Called with the reserved blocks locked.  Ensure the first block
+		starts on a correctly aligned boundary. */
+		uxAddress = ( size_t ) ucIsrBlocks;
+		uxAddress = ( uxAddress + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+		/* Link the blocks in address order. */
+		for( xBlock = configHEAP_ISR_BLOCK_COUNT; xBlock > 0U; xBlock-- )
+		{
+			pxLink = ( BlockLink_t * ) ( uxAddress + ( ( xBlock - 1U ) * heapISR_BLOCK_SIZE ) );
+			pxLink->pxNextFreeBlock = pxFreeIsrBlocks;
+			pxFreeIsrBlocks = pxLink;
+		}
+
+		xFreeIsrBlocks = configHEAP_ISR_BLOCK_COUNT;
+		xMinimumEverFreeIsrBlocks = configHEAP_ISR_BLOCK_COUNT;
+		pucIsrBlocksEnd = ( uint8_t * ) ( uxAddress + ( configHEAP_ISR_BLOCK_COUNT * heapISR_BLOCK_SIZE ) );
+		pucIsrBlocksStart = ( uint8_t * ) uxAddress;
+	}
+
+#endif /* configHEAP_ISR_BLOCK_COUNT */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_TRACE == 1 )
+
+	void vPortHeapTraceGetFreeBlocks( HeapTraceFreeBlocks_t *pxFreeBlocks )
+	{
+	BlockLink_t *pxBlock;
+
+		/* Called with the heap locked.  pxBlock will be NULL if the
+		heap has not been initialised. */
+		pxBlock = xStart.pxNextFreeBlock;
+
+		if( pxBlock != NULL )
+		{
+			while( pxBlock != pxEnd )
+			{
+				vHeapTraceAddFreeBlock( pxFreeBlocks, pxBlock->xBlockSize );
+				pxBlock = pxBlock->pxNextFreeBlock;
+			}
+		}
+	}
+
+#endif /* configUSE_HEAP_TRACE */
 
+#endif /* configUSE_HEAP_REGIONS == 0 */
@@ -0,0 +1,927 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * A heap made of several separate memory regions, each with its own free list,
+ * statistics and set of placement hints.  The allocation algorithm within a
+ * region is that of heap_4.c - first fit, with adjacent free blocks combined
+ * (coalesced) as they are freed.
+ *
+ * heap_5.c joins its regions into one free list, so an allocation can land in
+ * any region.  Here the caller can say what the memory is for (see eHeapHint in
+ * portable.h) and each region lists the hints it is preferred for, and the
+ * hints it will accept when no preferred region has space.  This lets task
+ * stacks, TCBs and DMA buffers be kept in the memory banks that minimise bus
+ * contention between the CPU and the DMA controllers.
+ *
+ * vPortDefineHeapRegionsWithHints() (or heap_5.c's vPortDefineHeapRegions())
+ * must be called before the first allocation.  pvPortMalloc() uses the
+ * eHeapHintGeneral hint.
+ *
+ * See heap_4.c and heap_5.c, and the memory management pages of
+ * http://www.FreeRTOS.org for more information.
+ */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if( configUSE_HEAP_TRACE == 1 )
+	#include "heap_trace.h"
+#else
+	#define heapTRACE_CALLER() NULL
+#endif
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+to use a multi-region heap.  This #if is closed at the very bottom of this
+file. */
+#if( configUSE_HEAP_REGIONS == 1 )
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+/* The maximum number of regions that can be passed to
+vPortDefineHeapRegionsWithHints(). */
+#ifndef configHEAP_MAX_REGIONS
+	#define configHEAP_MAX_REGIONS	4
+#endif
+
+/* Block sizes must not get too small. */
+#define heapMINIMUM_BLOCK_SIZE	( ( size_t ) ( xHeapStructSize << 1 ) )
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE		( ( size_t ) 8 )
+
+/* Define the linked list structure.  This is used to link free blocks in order
+of their memory address. */
+typedef struct A_BLOCK_LINK
+{
+	struct A_BLOCK_LINK *pxNextFreeBlock;	/*<< The next free block in the list. */
+	size_t xBlockSize;						/*<< The size of the free block. */
+} BlockLink_t;
+
+/* The state of one region.  Each region is a heap_4 heap in its own right. */
+typedef struct A_HEAP_REGION
+{
+	BlockLink_t xStart;						/*<< Marks the start of the region's free list. */
+	BlockLink_t *pxEnd;						/*<< Marks the end of the region's free list, and the end of the region. */
+	uint8_t *pucStartAddress;				/*<< The first byte of the region, used to find the region a block is freed to. */
+	const char *pcName;						/*<< Reported by xPortGetHeapRegionStats(). */
+	UBaseType_t uxPreferredHints;			/*<< heapHINT_BIT() of each hint the region is tried first for. */
+	UBaseType_t uxAcceptedHints;			/*<< heapHINT_BIT() of each hint the region is tried for when no preferred region has space. */
+	size_t xTotalBytes;						/*<< The usable size of the region. */
+	size_t xFreeBytesRemaining;
+	size_t xMinimumEverFreeBytesRemaining;
+	size_t xNumberOfSuccessfulAllocations;
+	size_t xNumberOfSuccessfulFrees;
+} HeapRegionState_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Inserts a block of memory that is being freed into the correct position in
+ * the free list of its region.  The block being freed will be merged with the
+ * block in front it and/or the block behind it if the memory blocks are
+ * adjacent to each other.
+ */
+static void prvInsertBlockIntoFreeList( HeapRegionState_t *pxRegion, BlockLink_t *pxBlockToInsert );
+
+/*
+ * Allocates a block of xWantedSize bytes, which already includes the block
+ * header and alignment padding, from pxRegion.  Returns NULL if the region does
+ * not have a large enough free block.
+ */
+static void *prvAllocateFromRegion( HeapRegionState_t *pxRegion, size_t xWantedSize );
+
+/*
+ * Implements pvPortMallocHint() and pvPortMalloc().  pvCaller is the return
+ * address of the public function, recorded when heap tracing is enabled.
+ */
+static void *prvMallocHint( size_t xWantedSize, eHeapHint eHint, void *pvCaller );
+
+/*
+ * Returns the region that contains pv, or NULL if pv is not within the heap.
+ */
+static HeapRegionState_t *prvFindRegion( const void *pv );
+
+/*-----------------------------------------------------------*/
+
+/* The size of the structure placed at the beginning of each allocated memory
+block must by correctly byte aligned. */
+static const size_t xHeapStructSize	= ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* The regions, in the order they were defined.  Within the regions a hint
+allows, allocations are tried in this order. */
+static HeapRegionState_t xHeapRegions[ configHEAP_MAX_REGIONS ];
+static UBaseType_t uxNumberOfRegions = 0;
+
+/* The free bytes of all the regions together.  The minimum of the total is not
+the sum of the minimums of the regions, as they need not occur at the same
+time, so it is kept separately. */
+static size_t xFreeBytesRemaining = 0U;
+static size_t xMinimumEverFreeBytesRemaining = 0U;
+
+/* Gets set to the top bit of an size_t type.  When this bit in the xBlockSize
+member of an BlockLink_t structure is set then the block belongs to the
+application.  When the bit is free the block is still part of the free heap
+space. */
+static size_t xBlockAllocatedBit = 0;
+
+#if( configHEAP_ISR_BLOCK_COUNT > 0 )
+
+	/* The size of each block reserved for interrupts, rounded up so every
+	block stays aligned. */
+	#define heapISR_BLOCK_SIZE	( ( ( size_t ) configHEAP_ISR_BLOCK_SIZE + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+	/* The blocks reserved for interrupts are kept apart from the heap in a
+	singly linked list of equal sized blocks, so they can be allocated and
+	freed in constant time with interrupts masked. */
+	static uint8_t ucIsrBlocks[ ( configHEAP_ISR_BLOCK_COUNT * heapISR_BLOCK_SIZE ) + portBYTE_ALIGNMENT ];
+	static uint8_t *pucIsrBlocksStart = NULL, *pucIsrBlocksEnd = NULL;
+	static BlockLink_t *pxFreeIsrBlocks = NULL;
+	static size_t xFreeIsrBlocks = 0U;
+	static size_t xMinimumEverFreeIsrBlocks = 0U;
+
+	/* True if pv was returned by pvPortMallocFromISR(). */
+	#define heapIS_ISR_BLOCK( pv )	( ( ( uint8_t * ) ( pv ) >= pucIsrBlocksStart ) && ( ( uint8_t * ) ( pv ) < pucIsrBlocksEnd ) )
+
+	/*
+	 * Links the reserved blocks into the list of free reserved blocks the first
+	 * time one is allocated.
+	 */
+	static void prvIsrBlocksInit( void );
+
+#endif /* configHEAP_ISR_BLOCK_COUNT */
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMallocHint( size_t xWantedSize, eHeapHint eHint )
+{
+	return prvMallocHint( xWantedSize, eHint, heapTRACE_CALLER() );
+}
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+	return prvMallocHint( xWantedSize, eHeapHintGeneral, heapTRACE_CALLER() );
+}
+/*-----------------------------------------------------------*/
+
+static void *prvMallocHint( size_t xWantedSize, eHeapHint eHint, void *pvCaller )
+{
+HeapRegionState_t *pxRegion;
+UBaseType_t uxHintBit, uxPass, uxRegion, uxSavedInterruptStatus;
+void *pvReturn = NULL;
+
+	/* The heap must be initialised before the first call to
+	pvPortMallocHint(). */
+	configASSERT( uxNumberOfRegions > 0 );
+	configASSERT( eHint < eHeapNumberOfHints );
+
+	uxHintBit = heapHINT_BIT( eHint );
+
+	heapLOCK( uxSavedInterruptStatus );
+	{
+		/* Check the requested block size is not so large that the top bit is
+		set.  The top bit of the block size member of the BlockLink_t structure
+		is used to determine who owns the block - the application or the
+		kernel, so it must be free. */
+		if( ( xWantedSize & xBlockAllocatedBit ) == 0 )
+		{
+			/* The wanted size is increased so it can contain a BlockLink_t
+			structure in addition to the requested amount of bytes. */
+			if( xWantedSize > 0 )
+			{
+				xWantedSize += xHeapStructSize;
+
+				/* Ensure that blocks are always aligned to the required number
+				of bytes. */
+				if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+				{
+					/* Byte alignment required. */
+					xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+					configASSERT( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) == 0 );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The first pass tries the regions that prefer the hint, the
+				second the regions that only accept it. */
+				for( uxPass = 0; ( uxPass < 2 ) && ( pvReturn == NULL ); uxPass++ )
+				{
+					for( uxRegion = 0; ( uxRegion < uxNumberOfRegions ) && ( pvReturn == NULL ); uxRegion++ )
+					{
+						pxRegion = &( xHeapRegions[ uxRegion ] );
+
+						if( uxPass == 0 )
+						{
+							if( ( pxRegion->uxPreferredHints & uxHintBit ) != 0 )
+							{
+								pvReturn = prvAllocateFromRegion( pxRegion, xWantedSize );
+							}
+						}
+						else
+						{
+							if( ( ( pxRegion->uxPreferredHints & uxHintBit ) == 0 ) && ( ( pxRegion->uxAcceptedHints & uxHintBit ) != 0 ) )
+							{
+								pvReturn = prvAllocateFromRegion( pxRegion, xWantedSize );
+							}
+						}
+					}
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		#if( configUSE_HEAP_TRACE == 1 )
+		{
+			if( pvReturn != NULL )
+			{
+				/* The size of the block is stored just before it. */
+				vHeapTraceAlloc( pvReturn, ( ( BlockLink_t * ) ( ( ( uint8_t * ) pvReturn ) - xHeapStructSize ) )->xBlockSize & ~xBlockAllocatedBit, pvCaller );
+			}
+		}
+		#else
+		{
+			( void ) pvCaller;
+		}
+		#endif
+
+		traceMALLOC( pvReturn, xWantedSize );
+	}
+	heapUNLOCK( uxSavedInterruptStatus );
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvAllocateFromRegion( HeapRegionState_t *pxRegion, size_t xWantedSize )
+{
+BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
+void *pvReturn = NULL;
+
+	if( xWantedSize <= pxRegion->xFreeBytesRemaining )
+	{
+		/* Traverse the list from the start	(lowest address) block until
+		one	of adequate size is found. */
+		pxPreviousBlock = &( pxRegion->xStart );
+		pxBlock = pxRegion->xStart.pxNextFreeBlock;
+		while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != NULL ) )
+		{
+			pxPreviousBlock = pxBlock;
+			pxBlock = pxBlock->pxNextFreeBlock;
+		}
+
+		/* If the end marker was reached then a block of adequate size
+		was	not found. */
+		if( pxBlock != pxRegion->pxEnd )
+		{
+			/* Return the memory space pointed to - jumping over the
+			BlockLink_t structure at its start. */
+			pvReturn = ( void * ) ( ( ( uint8_t * ) pxPreviousBlock->pxNextFreeBlock ) + xHeapStructSize );
+
+			/* This block is being returned for use so must be taken out
+			of the list of free blocks. */
+			pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+
+			/* If the block is larger than required it can be split into
+			two. */
+			if( ( pxBlock->xBlockSize - xWantedSize ) > heapMINIMUM_BLOCK_SIZE )
+			{
+				/* This block is to be split into two.  Create a new
+				block following the number of bytes requested. The void
+				cast is used to prevent byte alignment warnings from the
+				compiler. */
+				pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+				configASSERT( ( ( ( size_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+				/* Calculate the sizes of two blocks split from the
+				single block. */
+				pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+				pxBlock->xBlockSize = xWantedSize;
+
+				/* Insert the new block into the list of free blocks. */
+				prvInsertBlockIntoFreeList( pxRegion, pxNewBlockLink );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxRegion->xFreeBytesRemaining -= pxBlock->xBlockSize;
+			xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+			if( pxRegion->xFreeBytesRemaining < pxRegion->xMinimumEverFreeBytesRemaining )
+			{
+				pxRegion->xMinimumEverFreeBytesRemaining = pxRegion->xFreeBytesRemaining;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+			{
+				xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The block is being returned - it is allocated and owned
+			by the application and has no "next" block. */
+			pxBlock->xBlockSize |= xBlockAllocatedBit;
+			pxBlock->pxNextFreeBlock = NULL;
+			pxRegion->xNumberOfSuccessfulAllocations++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+BlockLink_t *pxLink;
+HeapRegionState_t *pxRegion;
+UBaseType_t uxSavedInterruptStatus;
+
+	#if( configHEAP_ISR_BLOCK_COUNT > 0 )
+	{
+		if( heapIS_ISR_BLOCK( pv ) )
+		{
+			vPortFreeFromISR( pv );
+			return;
+		}
+	}
+	#endif
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have an BlockLink_t structure immediately
+		before it. */
+		puc -= xHeapStructSize;
+
+		/* This casting is to keep the compiler from issuing warnings. */
+		pxLink = ( void * ) puc;
+
+		/* Check the block is actually allocated, and from this heap. */
+		pxRegion = prvFindRegion( pxLink );
+		configASSERT( pxRegion != NULL );
+		configASSERT( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 );
+		configASSERT( pxLink->pxNextFreeBlock == NULL );
+
+		if( ( pxRegion != NULL ) && ( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 ) )
+		{
+			if( pxLink->pxNextFreeBlock == NULL )
+			{
+				/* The block is being returned to the heap - it is no longer
+				allocated. */
+				pxLink->xBlockSize &= ~xBlockAllocatedBit;
+
+				heapLOCK( uxSavedInterruptStatus );
+				{
+					/* Add this block to the list of free blocks. */
+					pxRegion->xFreeBytesRemaining += pxLink->xBlockSize;
+					xFreeBytesRemaining += pxLink->xBlockSize;
+					traceFREE( pv, pxLink->xBlockSize );
+					prvInsertBlockIntoFreeList( pxRegion, ( ( BlockLink_t * ) pxLink ) );
+					pxRegion->xNumberOfSuccessfulFrees++;
+
+					#if( configUSE_HEAP_TRACE == 1 )
+					{
+						vHeapTraceFree( pv );
+					}
+					#endif
+				}
+				heapUNLOCK( uxSavedInterruptStatus );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static HeapRegionState_t *prvFindRegion( const void *pv )
+{
+HeapRegionState_t *pxRegion;
+UBaseType_t uxRegion;
+
+	/* The regions do not change once defined, so no lock is needed. */
+	for( uxRegion = 0; uxRegion < uxNumberOfRegions; uxRegion++ )
+	{
+		pxRegion = &( xHeapRegions[ uxRegion ] );
+
+		if( ( ( const uint8_t * ) pv >= pxRegion->pucStartAddress ) && ( ( const uint8_t * ) pv < ( const uint8_t * ) pxRegion->pxEnd ) )
+		{
+			return pxRegion;
+		}
+	}
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+	/* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertBlockIntoFreeList( HeapRegionState_t *pxRegion, BlockLink_t *pxBlockToInsert )
+{
+BlockLink_t *pxIterator;
+uint8_t *puc;
+
+	/* Iterate through the list until a block is found that has a higher address
+	than the block being inserted. */
+	for( pxIterator = &( pxRegion->xStart ); pxIterator->pxNextFreeBlock < pxBlockToInsert; pxIterator = pxIterator->pxNextFreeBlock )
+	{
+		/* Nothing to do here, just iterate to the right position. */
+	}
+
+	/* Do the block being inserted, and the block it is being inserted after
+	make a contiguous block of memory? */
+	puc = ( uint8_t * ) pxIterator;
+	if( ( puc + pxIterator->xBlockSize ) == ( uint8_t * ) pxBlockToInsert )
+	{
+		pxIterator->xBlockSize += pxBlockToInsert->xBlockSize;
+		pxBlockToInsert = pxIterator;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Do the block being inserted, and the block it is being inserted before
+	make a contiguous block of memory? */
+	puc = ( uint8_t * ) pxBlockToInsert;
+	if( ( puc + pxBlockToInsert->xBlockSize ) == ( uint8_t * ) pxIterator->pxNextFreeBlock )
+	{
+		if( pxIterator->pxNextFreeBlock != pxRegion->pxEnd )
+		{
+			/* Form one big block from the two blocks. */
+			pxBlockToInsert->xBlockSize += pxIterator->pxNextFreeBlock->xBlockSize;
+			pxBlockToInsert->pxNextFreeBlock = pxIterator->pxNextFreeBlock->pxNextFreeBlock;
+		}
+		else
+		{
+			pxBlockToInsert->pxNextFreeBlock = pxRegion->pxEnd;
+		}
+	}
+	else
+	{
+		pxBlockToInsert->pxNextFreeBlock = pxIterator->pxNextFreeBlock;
+	}
+
+	/* If the block being inserted plugged a gab, so was merged with the block
+	before and the block after, then it's pxNextFreeBlock pointer will have
+	already been set, and should not be set here as that would make it point
+	to itself. */
+	if( pxIterator != pxBlockToInsert )
+	{
+		pxIterator->pxNextFreeBlock = pxBlockToInsert;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegionsWithHints( const HeapRegionWithHints_t * const pxHeapRegions )
+{
+BlockLink_t *pxFirstFreeBlock;
+HeapRegionState_t *pxRegion;
+size_t xAlignedHeap;
+size_t xTotalRegionSize, xAddress;
+BaseType_t xDefinedRegions = 0;
+const HeapRegionWithHints_t *pxHeapRegion;
+
+	/* Can only call once! */
+	configASSERT( uxNumberOfRegions == 0 );
+
+	pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+
+	while( pxHeapRegion->xSizeInBytes > 0 )
+	{
+		configASSERT( xDefinedRegions < configHEAP_MAX_REGIONS );
+		pxRegion = &( xHeapRegions[ xDefinedRegions ] );
+
+		xTotalRegionSize = pxHeapRegion->xSizeInBytes;
+
+		/* Ensure the heap region starts on a correctly aligned boundary. */
+		xAddress = ( size_t ) pxHeapRegion->pucStartAddress;
+		if( ( xAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+		{
+			xAddress += ( portBYTE_ALIGNMENT - 1 );
+			xAddress &= ~portBYTE_ALIGNMENT_MASK;
+
+			/* Adjust the size for the bytes lost to alignment. */
+			xTotalRegionSize -= xAddress - ( size_t ) pxHeapRegion->pucStartAddress;
+		}
+
+		xAlignedHeap = xAddress;
+
+		/* xStart is used to hold a pointer to the first item in the list of
+		free blocks.  The void cast is used to prevent compiler warnings. */
+		pxRegion->xStart.pxNextFreeBlock = ( BlockLink_t * ) xAlignedHeap;
+		pxRegion->xStart.xBlockSize = ( size_t ) 0;
+
+		/* pxEnd is used to mark the end of the list of free blocks and is
+		inserted at the end of the region space. */
+		xAddress = xAlignedHeap + xTotalRegionSize;
+		xAddress -= xHeapStructSize;
+		xAddress &= ~portBYTE_ALIGNMENT_MASK;
+		pxRegion->pxEnd = ( BlockLink_t * ) xAddress;
+		pxRegion->pxEnd->xBlockSize = 0;
+		pxRegion->pxEnd->pxNextFreeBlock = NULL;
+
+		/* To start with there is a single free block in the region that is
+		sized to take up the entire region space, minus the space taken by
+		pxEnd. */
+		pxFirstFreeBlock = ( BlockLink_t * ) xAlignedHeap;
+		pxFirstFreeBlock->xBlockSize = xAddress - ( size_t ) pxFirstFreeBlock;
+		pxFirstFreeBlock->pxNextFreeBlock = pxRegion->pxEnd;
+
+		pxRegion->pucStartAddress = ( uint8_t * ) xAlignedHeap;
+		pxRegion->pcName = pxHeapRegion->pcName;
+		pxRegion->uxPreferredHints = pxHeapRegion->uxPreferredHints;
+		pxRegion->uxAcceptedHints = pxHeapRegion->uxAcceptedHints;
+		pxRegion->xTotalBytes = pxFirstFreeBlock->xBlockSize;
+		pxRegion->xFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+		pxRegion->xMinimumEverFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+		pxRegion->xNumberOfSuccessfulAllocations = 0;
+		pxRegion->xNumberOfSuccessfulFrees = 0;
+
+		xFreeBytesRemaining += pxFirstFreeBlock->xBlockSize;
+
+		/* Move onto the next HeapRegionWithHints_t structure. */
+		xDefinedRegions++;
+		pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+	}
+
+	xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+
+	/* Check something was actually defined before it is accessed. */
+	configASSERT( xFreeBytesRemaining );
+
+	/* Work out the position of the top bit in a size_t variable. */
+	xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
+
+	#if( configUSE_HEAP_TRACE == 1 )
+	{
+		vHeapTraceInit( xFreeBytesRemaining );
+	}
+	#endif
+
+	/* Publish the regions last, as pvPortMallocHint() asserts on
+	uxNumberOfRegions. */
+	uxNumberOfRegions = ( UBaseType_t ) xDefinedRegions;
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+HeapRegionWithHints_t xRegionsWithHints[ configHEAP_MAX_REGIONS + 1 ];
+BaseType_t xRegion = 0;
+
+	/* Without hints every region is preferred for everything, so allocations
+	are made from the first region with space, as heap_5.c would. */
+	do
+	{
+		configASSERT( xRegion <= configHEAP_MAX_REGIONS );
+		xRegionsWithHints[ xRegion ].pucStartAddress = pxHeapRegions[ xRegion ].pucStartAddress;
+		xRegionsWithHints[ xRegion ].xSizeInBytes = pxHeapRegions[ xRegion ].xSizeInBytes;
+		xRegionsWithHints[ xRegion ].pcName = NULL;
+		xRegionsWithHints[ xRegion ].uxPreferredHints = heapHINT_ALL;
+		xRegionsWithHints[ xRegion ].uxAcceptedHints = heapHINT_ALL;
+		xRegion++;
+	} while( pxHeapRegions[ xRegion - 1 ].xSizeInBytes > 0 );
+
+	vPortDefineHeapRegionsWithHints( xRegionsWithHints );
+}
+/*-----------------------------------------------------------*/
+
+static void prvGetFreeBlockStats( HeapRegionState_t *pxRegion, HeapStats_t *pxHeapStats )
+{
+BlockLink_t *pxBlock;
+
+	/* Called with the heap locked.  The sizes and count are added to
+	pxHeapStats so the blocks of several regions can be combined. */
+	pxBlock = pxRegion->xStart.pxNextFreeBlock;
+
+	while( pxBlock != pxRegion->pxEnd )
+	{
+		/* Increment the number of blocks and record the largest and smallest
+		block seen so far. */
+		pxHeapStats->xNumberOfFreeBlocks++;
+
+		if( pxBlock->xBlockSize > pxHeapStats->xSizeOfLargestFreeBlockInBytes )
+		{
+			pxHeapStats->xSizeOfLargestFreeBlockInBytes = pxBlock->xBlockSize;
+		}
+
+		if( pxBlock->xBlockSize < pxHeapStats->xSizeOfSmallestFreeBlockInBytes )
+		{
+			pxHeapStats->xSizeOfSmallestFreeBlockInBytes = pxBlock->xBlockSize;
+		}
+
+		/* Move to the next block in the chain until the last block is
+		reached. */
+		pxBlock = pxBlock->pxNextFreeBlock;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseHeapStats( HeapStats_t *pxHeapStats )
+{
+	pxHeapStats->xAvailableHeapSpaceInBytes = 0;
+	pxHeapStats->xSizeOfLargestFreeBlockInBytes = 0;
+	pxHeapStats->xSizeOfSmallestFreeBlockInBytes = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+	pxHeapStats->xNumberOfFreeBlocks = 0;
+	pxHeapStats->xMinimumEverFreeBytesRemaining = 0;
+	pxHeapStats->xNumberOfSuccessfulAllocations = 0;
+	pxHeapStats->xNumberOfSuccessfulFrees = 0;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortGetHeapRegionStats( UBaseType_t uxRegion, HeapRegionStats_t *pxRegionStats )
+{
+HeapRegionState_t *pxRegion;
+BaseType_t xReturn = pdFAIL;
+UBaseType_t uxSavedInterruptStatus;
+
+	if( uxRegion < uxNumberOfRegions )
+	{
+		pxRegion = &( xHeapRegions[ uxRegion ] );
+		prvInitialiseHeapStats( &( pxRegionStats->xStats ) );
+
+		heapLOCK( uxSavedInterruptStatus );
+		{
+			prvGetFreeBlockStats( pxRegion, &( pxRegionStats->xStats ) );
+			pxRegionStats->xStats.xAvailableHeapSpaceInBytes = pxRegion->xFreeBytesRemaining;
+			pxRegionStats->xStats.xMinimumEverFreeBytesRemaining = pxRegion->xMinimumEverFreeBytesRemaining;
+			pxRegionStats->xStats.xNumberOfSuccessfulAllocations = pxRegion->xNumberOfSuccessfulAllocations;
+			pxRegionStats->xStats.xNumberOfSuccessfulFrees = pxRegion->xNumberOfSuccessfulFrees;
+		}
+		heapUNLOCK( uxSavedInterruptStatus );
+
+		pxRegionStats->pcName = pxRegion->pcName;
+		pxRegionStats->pucStartAddress = pxRegion->pucStartAddress;
+		pxRegionStats->xTotalHeapSpaceInBytes = pxRegion->xTotalBytes;
+		xReturn = pdPASS;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t *pxHeapStats )
+{
+HeapRegionState_t *pxRegion;
+UBaseType_t uxRegion, uxSavedInterruptStatus;
+
+	prvInitialiseHeapStats( pxHeapStats );
+
+	heapLOCK( uxSavedInterruptStatus );
+	{
+		for( uxRegion = 0; uxRegion < uxNumberOfRegions; uxRegion++ )
+		{
+			pxRegion = &( xHeapRegions[ uxRegion ] );
+			prvGetFreeBlockStats( pxRegion, pxHeapStats );
+			pxHeapStats->xNumberOfSuccessfulAllocations += pxRegion->xNumberOfSuccessfulAllocations;
+			pxHeapStats->xNumberOfSuccessfulFrees += pxRegion->xNumberOfSuccessfulFrees;
+		}
+
+		pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+		pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+	}
+	heapUNLOCK( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+#if( configHEAP_ISR_BLOCK_COUNT > 0 )
+
+	void *pvPortMallocFromISR( size_t xWantedSize )
+	{
+	void *pvReturn = NULL;
+	UBaseType_t uxSavedInterruptStatus;
+
+		if( ( xWantedSize > 0 ) && ( xWantedSize <= ( size_t ) configHEAP_ISR_BLOCK_SIZE ) )
+		{
+			heapLOCK_FROM_ISR( uxSavedInterruptStatus );
+			{
+				if( pucIsrBlocksStart == NULL )
+				{
+					prvIsrBlocksInit();
+				}
+
+				if( pxFreeIsrBlocks != NULL )
+				{
+					pvReturn = ( void * ) pxFreeIsrBlocks;
+					pxFreeIsrBlocks = pxFreeIsrBlocks->pxNextFreeBlock;
+					xFreeIsrBlocks--;
+
+					if( xFreeIsrBlocks < xMinimumEverFreeIsrBlocks )
+					{
+						xMinimumEverFreeIsrBlocks = xFreeIsrBlocks;
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				traceMALLOC( pvReturn, xWantedSize );
+			}
+			heapUNLOCK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pvReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortFreeFromISR( void *pv )
+	{
+	BlockLink_t *pxLink = ( BlockLink_t * ) pv;
+	UBaseType_t uxSavedInterruptStatus;
+
+		/* Only the reserved blocks can be freed from an interrupt. */
+		configASSERT( heapIS_ISR_BLOCK( pv ) );
+		configASSERT( ( ( size_t ) ( ( uint8_t * ) pv - pucIsrBlocksStart ) % heapISR_BLOCK_SIZE ) == 0 );
+
+		if( heapIS_ISR_BLOCK( pv ) )
+		{
+			heapLOCK_FROM_ISR( uxSavedInterruptStatus );
+			{
+				traceFREE( pv, heapISR_BLOCK_SIZE );
+				pxLink->pxNextFreeBlock = pxFreeIsrBlocks;
+				pxFreeIsrBlocks = pxLink;
+				xFreeIsrBlocks++;
+			}
+			heapUNLOCK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	size_t xPortGetFreeIsrBlockCount( void )
+	{
+		/* Before the first allocation all the blocks are free. */
+		return ( pucIsrBlocksStart == NULL ) ? ( size_t ) configHEAP_ISR_BLOCK_COUNT : xFreeIsrBlocks;
+	}
+	/*-----------------------------------------------------------*/
+
+	size_t xPortGetMinimumEverFreeIsrBlockCount( void )
+	{
+		return ( pucIsrBlocksStart == NULL ) ? ( size_t ) configHEAP_ISR_BLOCK_COUNT : xMinimumEverFreeIsrBlocks;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvIsrBlocksInit( void )
+	{
+	size_t uxAddress, xBlock;
+	BlockLink_t *pxLink;
+
+		/* Called with the reserved blocks locked.  Ensure the first block
+		starts on a correctly aligned boundary. */
+		uxAddress = ( size_t ) ucIsrBlocks;
+		uxAddress = ( uxAddress + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+		/* Link the blocks in address order. */
+		for( xBlock = configHEAP_ISR_BLOCK_COUNT; xBlock > 0U; xBlock-- )
+		{
+			pxLink = ( BlockLink_t * ) ( uxAddress + ( ( xBlock - 1U ) * heapISR_BLOCK_SIZE ) );
+			pxLink->pxNextFreeBlock = pxFreeIsrBlocks;
+			pxFreeIsrBlocks = pxLink;
+		}
+
+		xFreeIsrBlocks = configHEAP_ISR_BLOCK_COUNT;
+		xMinimumEverFreeIsrBlocks = configHEAP_ISR_BLOCK_COUNT;
+		pucIsrBlocksEnd = ( uint8_t * ) ( uxAddress + ( configHEAP_ISR_BLOCK_COUNT * heapISR_BLOCK_SIZE ) );
+		pucIsrBlocksStart = ( uint8_t * ) uxAddress;
+	}
+
+#endif /* configHEAP_ISR_BLOCK_COUNT */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_TRACE == 1 )
+
+	void vPortHeapTraceGetFreeBlocks( HeapTraceFreeBlocks_t *pxFreeBlocks )
+	{
+	HeapRegionState_t *pxRegion;
+	BlockLink_t *pxBlock;
+	UBaseType_t uxRegion;
+
+		/* Called with the heap locked. */
+		for( uxRegion = 0; uxRegion < uxNumberOfRegions; uxRegion++ )
+		{
+			pxRegion = &( xHeapRegions[ uxRegion ] );
+
+			for( pxBlock = pxRegion->xStart.pxNextFreeBlock; pxBlock != pxRegion->pxEnd; pxBlock = pxBlock->pxNextFreeBlock )
+			{
+				vHeapTraceAddFreeBlock( pxFreeBlocks, pxBlock->xBlockSize );
+			}
+		}
+	}
+
+#endif /* configUSE_HEAP_TRACE */
+
+#endif /* configUSE_HEAP_REGIONS == 1 */
@@ -0,0 +1,303 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "stack_profiler.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+for the header files above, but not in this file, in order to generate the
+correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+to include the stack profiler.  This #if is closed at the very bottom of this
+file.  If you want to include the stack profiler then ensure
+configUSE_STACK_PROFILER is set to 1 in FreeRTOSConfig.h. */
+#if( configUSE_STACK_PROFILER == 1 )
+
+#ifndef configSTACK_PROFILER_MAX_TASKS
+	#define configSTACK_PROFILER_MAX_TASKS		16
+#endif
+
+#ifndef configSTACK_PROFILER_MARGIN_PERCENT
+	#define configSTACK_PROFILER_MARGIN_PERCENT	25
+#endif
+
+/* Room for an exception frame with the floating point registers (26 words on
+a Cortex-M4F), and its alignment. */
+#ifndef configSTACK_PROFILER_MARGIN_WORDS
+	#define configSTACK_PROFILER_MARGIN_WORDS	32
+#endif
+
+#if( configSTACK_PROFILER_MAX_TASKS < 1 )
+	#error configSTACK_PROFILER_MAX_TASKS must be at least 1
+#endif
+
+/* Recommended depths are rounded up to this many words. */
+#define stackprofilerDEPTH_ROUNDING		( 8UL )
+
+/*
+ * Called by the timer started by xStackProfilerStart().
+ */
+static void prvSampleTimerCallback( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Update the record of the task described by pxStatus.
+ */
+static void prvUpdateRecord( StackProfile_t *pxRecord, const TaskStatus_t *pxStatus ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the record to use for a task seen for the first time - an unused
+ * record, or else the record of a deleted task - or NULL if there is none.
+ */
+static StackProfile_t *prvNewRecord( void ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* The record of each task, in the order the tasks were first seen. */
+static StackProfile_t xRecords[ configSTACK_PROFILER_MAX_TASKS ];
+static UBaseType_t uxRecordsUsed = 0;
+
+/* The state of every task at the latest sample.  Only used by
+vStackProfilerSample(), but too large for the stack of the timer task. */
+static TaskStatus_t xTaskStatus[ configSTACK_PROFILER_MAX_TASKS ];
+
+static UBaseType_t uxSkippedSamples = 0;
+static TimerHandle_t xSampleTimer = NULL;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xStackProfilerStart( TickType_t xSamplePeriod )
+{
+BaseType_t xReturn = pdFAIL;
+
+	configASSERT( xSampleTimer == NULL );
+
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	{
+	static StaticTimer_t xSampleTimerBuffer;
+
+		xSampleTimer = xTimerCreateStatic( "StackProf", xSamplePeriod, pdTRUE, NULL, prvSampleTimerCallback, &xSampleTimerBuffer );
+	}
+	#else
+	{
+		xSampleTimer = xTimerCreate( "StackProf", xSamplePeriod, pdTRUE, NULL, prvSampleTimerCallback );
+	}
+	#endif
+
+	if( xSampleTimer != NULL )
+	{
+		xReturn = xTimerStart( xSampleTimer, 0 );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vStackProfilerSample( void )
+{
+UBaseType_t uxTasks, uxTask, uxRecord;
+
+	/* uxTaskGetSystemState() finds the high water mark of every task, so is
+	called before the scheduler is suspended again to update the records. */
+	uxTasks = uxTaskGetSystemState( xTaskStatus, ( UBaseType_t ) configSTACK_PROFILER_MAX_TASKS, NULL );
+
+	vTaskSuspendAll();
+	{
+		if( uxTasks == ( UBaseType_t ) 0 )
+		{
+			/* There are more tasks than configSTACK_PROFILER_MAX_TASKS. */
+			uxSkippedSamples++;
+		}
+		else
+		{
+			for( uxRecord = 0; uxRecord < uxRecordsUsed; uxRecord++ )
+			{
+				xRecords[ uxRecord ].xDeleted = pdTRUE;
+			}
+
+			/* Update the tasks that already have a record first, and clear
+			their handles, so a record is only given to a new task once it
+			is known which tasks have been deleted. */
+			for( uxTask = 0; uxTask < uxTasks; uxTask++ )
+			{
+				for( uxRecord = 0; uxRecord < uxRecordsUsed; uxRecord++ )
+				{
+					if( xRecords[ uxRecord ].xTaskNumber == xTaskStatus[ uxTask ].xTaskNumber )
+					{
+						prvUpdateRecord( &( xRecords[ uxRecord ] ), &( xTaskStatus[ uxTask ] ) );
+						xTaskStatus[ uxTask ].xHandle = NULL;
+						break;
+					}
+				}
+			}
+
+			for( uxTask = 0; uxTask < uxTasks; uxTask++ )
+			{
+				if( xTaskStatus[ uxTask ].xHandle != NULL )
+				{
+				StackProfile_t *pxRecord = prvNewRecord();
+
+					/* There is always a record, as there cannot be more tasks
+					than records. */
+					configASSERT( pxRecord != NULL );
+
+					if( pxRecord != NULL )
+					{
+						pxRecord->xTaskNumber = xTaskStatus[ uxTask ].xTaskNumber;
+						pxRecord->uxMaximumUsed = 0;
+						prvUpdateRecord( pxRecord, &( xTaskStatus[ uxTask ] ) );
+					}
+				}
+			}
+		}
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxStackProfilerGetReport( StackProfile_t *pxReport, UBaseType_t uxReportLength )
+{
+UBaseType_t uxRecord;
+
+	configASSERT( pxReport != NULL );
+
+	vTaskSuspendAll();
+	{
+		for( uxRecord = 0; ( uxRecord < uxRecordsUsed ) && ( uxRecord < uxReportLength ); uxRecord++ )
+		{
+			pxReport[ uxRecord ] = xRecords[ uxRecord ];
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	return uxRecord;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxStackProfilerGetSkippedSamples( void )
+{
+	return uxSkippedSamples;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSampleTimerCallback( TimerHandle_t xTimer )
+{
+	( void ) xTimer;
+
+	vStackProfilerSample();
+}
+/*-----------------------------------------------------------*/
+
+static void prvUpdateRecord( StackProfile_t *pxRecord, const TaskStatus_t *pxStatus )
+{
+configSTACK_DEPTH_TYPE uxStackDepth, uxUsed;
+uint32_t ulRecommended;
+UBaseType_t x;
+
+	/* pxStackBase is the lowest word of the stack and pxEndOfStack the
+	highest, whichever way the stack grows. */
+	uxStackDepth = ( configSTACK_DEPTH_TYPE ) ( ( pxStatus->pxEndOfStack - pxStatus->pxStackBase ) + 1 );
+
+	if( pxStatus->usStackHighWaterMark < uxStackDepth )
+	{
+		uxUsed = uxStackDepth - pxStatus->usStackHighWaterMark;
+	}
+	else
+	{
+		uxUsed = 0;
+	}
+
+	if( uxUsed > pxRecord->uxMaximumUsed )
+	{
+		pxRecord->uxMaximumUsed = uxUsed;
+	}
+
+	ulRecommended = ( uint32_t ) pxRecord->uxMaximumUsed;
+	ulRecommended += ( ulRecommended * ( uint32_t ) configSTACK_PROFILER_MARGIN_PERCENT ) / 100UL;
+	ulRecommended += ( uint32_t ) configSTACK_PROFILER_MARGIN_WORDS;
+	ulRecommended = ( ulRecommended + ( stackprofilerDEPTH_ROUNDING - 1UL ) ) & ~( stackprofilerDEPTH_ROUNDING - 1UL );
+
+	pxRecord->uxStackDepth = uxStackDepth;
+	pxRecord->uxRecommendedDepth = ( configSTACK_DEPTH_TYPE ) ulRecommended;
+	pxRecord->xDeleted = pdFALSE;
+
+	/* The name is copied as the task may be deleted before the report is
+	read. */
+	for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+	{
+		pxRecord->pcTaskName[ x ] = pxStatus->pcTaskName[ x ];
+
+		if( pxStatus->pcTaskName[ x ] == ( char ) 0x00 )
+		{
+			break;
+		}
+	}
+
+	pxRecord->pcTaskName[ configMAX_TASK_NAME_LEN - 1 ] = '\0';
+}
+/*-----------------------------------------------------------*/
+
+static StackProfile_t *prvNewRecord( void )
+{
+StackProfile_t *pxRecord = NULL;
+UBaseType_t uxRecord;
+
+	if( uxRecordsUsed < ( UBaseType_t ) configSTACK_PROFILER_MAX_TASKS )
+	{
+		pxRecord = &( xRecords[ uxRecordsUsed ] );
+		uxRecordsUsed++;
+	}
+	else
+	{
+		for( uxRecord = 0; uxRecord < uxRecordsUsed; uxRecord++ )
+		{
+			if( xRecords[ uxRecord ].xDeleted != pdFALSE )
+			{
+				pxRecord = &( xRecords[ uxRecord ] );
+				break;
+			}
+		}
+	}
+
+	return pxRecord;
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include the stack profiler.  If you want to include the stack profiler then
+ensure configUSE_STACK_PROFILER is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_STACK_PROFILER == 1 */
@@ -0,0 +1,323 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_arena.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+for the header files above, but not in this file, in order to generate the
+correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+to include task arena functionality.  This #if is closed at the very bottom of
+this file.  If you want to include task arenas then ensure configUSE_TASK_ARENA
+is set to 1 in FreeRTOSConfig.h. */
+#if( configUSE_TASK_ARENA == 1 )
+
+/* Values for ucStaticallyAllocated. */
+#define arenaDYNAMICALLY_ALLOCATED		( ( uint8_t ) 0U )
+#define arenaSTATICALLY_ALLOCATED		( ( uint8_t ) 1U )
+
+/* Round a size up to a multiple of portBYTE_ALIGNMENT. */
+#define arenaALIGN_UP( x )	( ( ( x ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* The state of an arena, held at the start of the arena's memory.  The memory
+given out by pvTaskArenaAlloc() starts xArenaStructSize bytes later. */
+typedef struct xTASK_ARENA
+{
+	size_t xSizeInBytes;			/*< The number of bytes that can be allocated. */
+	size_t xUsed;					/*< The number of bytes allocated - also the offset of the next allocation. */
+	size_t xHighWaterMark;			/*< The largest value xUsed has had. */
+	uint8_t ucStaticallyAllocated;	/*< arenaSTATICALLY_ALLOCATED if the memory must not be freed. */
+} TaskArena_t;
+
+/* The size of the arena state, rounded up so the first allocation is
+aligned. */
+static const size_t xArenaStructSize = arenaALIGN_UP( sizeof( TaskArena_t ) );
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Initialise the arena state at pucMemory and give the arena to the calling
+ * task.
+ */
+static void prvInitialiseArena( uint8_t *pucMemory, size_t xSizeInBytes, uint8_t ucStaticallyAllocated ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	BaseType_t xTaskArenaCreate( size_t xSizeInBytes )
+	{
+	uint8_t *pucMemory;
+	BaseType_t xReturn = pdFAIL;
+
+		if( ( pxTaskGetArena() == NULL ) && ( xSizeInBytes > xArenaStructSize ) )
+		{
+			/* heap_4 and the other heaps return memory aligned to
+			portBYTE_ALIGNMENT, so the arena state needs no adjustment. */
+			pucMemory = ( uint8_t * ) pvPortMalloc( xSizeInBytes ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU. */
+
+			if( pucMemory != NULL )
+			{
+				prvInitialiseArena( pucMemory, xSizeInBytes, arenaDYNAMICALLY_ALLOCATED );
+				xReturn = pdPASS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	BaseType_t xTaskArenaCreateStatic( uint8_t *pucArenaBuffer, size_t xSizeInBytes )
+	{
+	size_t xAlignment;
+	BaseType_t xReturn = pdFAIL;
+
+		configASSERT( pucArenaBuffer );
+
+		/* Skip any bytes before the first aligned address. */
+		xAlignment = ( size_t ) ( ( portBYTE_ALIGNMENT - ( ( portPOINTER_SIZE_TYPE ) pucArenaBuffer & portBYTE_ALIGNMENT_MASK ) ) & portBYTE_ALIGNMENT_MASK );
+
+		if( ( pxTaskGetArena() == NULL ) && ( xSizeInBytes > ( xAlignment + xArenaStructSize ) ) )
+		{
+			prvInitialiseArena( pucArenaBuffer + xAlignment, xSizeInBytes - xAlignment, arenaSTATICALLY_ALLOCATED );
+			xReturn = pdPASS;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseArena( uint8_t *pucMemory, size_t xSizeInBytes, uint8_t ucStaticallyAllocated )
+{
+TaskArena_t *pxArena = ( TaskArena_t * ) pucMemory; /*lint !e9087 !e9079 The memory is aligned to portBYTE_ALIGNMENT. */
+
+	/* The usable size is rounded down so every allocation, including one that
+	fills the arena, ends on an aligned boundary. */
+	pxArena->xSizeInBytes = ( xSizeInBytes - xArenaStructSize ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+	pxArena->xUsed = 0;
+	pxArena->xHighWaterMark = 0;
+	pxArena->ucStaticallyAllocated = ucStaticallyAllocated;
+
+	vTaskSetArena( pxArena );
+}
+/*-----------------------------------------------------------*/
+
+void vTaskArenaDelete( void )
+{
+TaskArena_t *pxArena = pxTaskGetArena();
+
+	/* Detach the arena from the task before its memory is released. */
+	vTaskSetArena( NULL );
+	vTaskArenaRelease( pxArena );
+}
+/*-----------------------------------------------------------*/
+
+void vTaskArenaRelease( TaskArena_t *pxArena )
+{
+	if( pxArena != NULL )
+	{
+		#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+		{
+			if( pxArena->ucStaticallyAllocated == arenaDYNAMICALLY_ALLOCATED )
+			{
+				vPortFree( pxArena );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void *pvTaskArenaAlloc( size_t xWantedSize )
+{
+TaskArena_t *pxArena = pxTaskGetArena();
+void *pvReturn = NULL;
+
+	/* Only the owning task allocates from its arena, so no critical section
+	or scheduler suspension is needed.  The size is rounded up so the next
+	allocation is aligned.  The first comparison prevents the rounding, and the
+	second the addition, from overflowing. */
+	if( ( pxArena != NULL ) && ( xWantedSize > 0 ) && ( xWantedSize <= pxArena->xSizeInBytes ) )
+	{
+		xWantedSize = arenaALIGN_UP( xWantedSize );
+
+		if( xWantedSize <= ( pxArena->xSizeInBytes - pxArena->xUsed ) )
+		{
+			pvReturn = ( void * ) ( ( ( uint8_t * ) pxArena ) + xArenaStructSize + pxArena->xUsed );
+			pxArena->xUsed += xWantedSize;
+
+			if( pxArena->xUsed > pxArena->xHighWaterMark )
+			{
+				pxArena->xHighWaterMark = pxArena->xUsed;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+TaskArenaMark_t xTaskArenaMark( void )
+{
+TaskArena_t *pxArena = pxTaskGetArena();
+TaskArenaMark_t xReturn = 0;
+
+	if( pxArena != NULL )
+	{
+		xReturn = ( TaskArenaMark_t ) pxArena->xUsed;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskArenaRewind( TaskArenaMark_t xMark )
+{
+TaskArena_t *pxArena = pxTaskGetArena();
+
+	if( pxArena != NULL )
+	{
+		/* A mark can only move the arena backwards. */
+		configASSERT( xMark <= pxArena->xUsed );
+
+		if( xMark <= pxArena->xUsed )
+		{
+			pxArena->xUsed = ( size_t ) xMark;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vTaskArenaReset( void )
+{
+	vTaskArenaRewind( 0 );
+}
+/*-----------------------------------------------------------*/
+
+size_t xTaskArenaGetFreeSize( void )
+{
+TaskArena_t *pxArena = pxTaskGetArena();
+size_t xReturn = 0;
+
+	if( pxArena != NULL )
+	{
+		xReturn = pxArena->xSizeInBytes - pxArena->xUsed;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xTaskArenaGetHighWaterMark( void )
+{
+TaskArena_t *pxArena = pxTaskGetArena();
+size_t xReturn = 0;
+
+	if( pxArena != NULL )
+	{
+		xReturn = pxArena->xHighWaterMark;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include task arena functionality.  If you want to include task arenas then
+ensure configUSE_TASK_ARENA is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_TASK_ARENA == 1 */
@@ -40,6 +40,22 @@ task.h is included from an application file. */
 #include "timers.h"
 #include "stack_macros.h"
 
+#if( configUSE_MULTI_WAIT == 1 )
+	#include "multi_wait.h"
+#endif
+
+#if( configUSE_TASK_ARENA == 1 )
+	#include "task_arena.h"
+#endif
+
+#if( configUSE_HEAP_TRACE == 1 )
+	#include "heap_trace.h"
+#endif
+
+#if( configUSE_OBJECT_SLABS == 1 )
+	#include "object_slab.h"
+#endif
+
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
 because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
 for the header files above, but not in this file, in order to generate the
@@ -64,6 +80,34 @@ functions but without including stdio.h here. */
 	#define taskYIELD_IF_USING_PREEMPTION() portYIELD_WITHIN_API()
 #endif
 
+/* Values that can be held in the xTaskRunState member of the TCB when more
+than one core is in use.  Any value of zero or above is the number of the core
+on which the task is running. */
+#define taskTASK_NOT_RUNNING			( ( BaseType_t ) -1 )
+
+#if( configNUMBER_OF_CORES > 1 )
+
+	#define taskTASK_IS_RUNNING( pxTCB ) ( ( pxTCB )->xTaskRunState != taskTASK_NOT_RUNNING )
+	#define taskCORE_MASK( xCoreID ) ( ( UBaseType_t ) 1U << ( UBaseType_t ) ( xCoreID ) )
+
+	/* Each core has its own current task and its own pending yield flag.  A
+	task only ever accesses the entries for the core it is running on, from a
+	critical section or with the scheduler suspended, so it cannot migrate
+	between reading the core number and using the entry. */
+	#define pxCurrentTCB	( ( TCB_t * ) xTaskGetCurrentTaskHandle() )
+	#define xYieldPending	xYieldPendings[ portGET_CORE_ID() ]
+
+	/* uxSchedulerSuspended may be non-zero because another core has the
+	scheduler suspended, which is not an error. */
+	#define taskASSERT_SCHEDULER_NOT_SUSPENDED() configASSERT( xTaskGetSchedulerState() != taskSCHEDULER_SUSPENDED )
+
+#else
+
+	#define taskTASK_IS_RUNNING( pxTCB ) ( ( pxTCB ) == pxCurrentTCB )
+	#define taskASSERT_SCHEDULER_NOT_SUSPENDED() configASSERT( uxSchedulerSuspended == 0 )
+
+#endif /* configNUMBER_OF_CORES */
+
 /* Values that can be assigned to the ucNotifyState member of the TCB. */
 #define taskNOT_WAITING_NOTIFICATION	( ( uint8_t ) 0 )
 #define taskWAITING_NOTIFICATION		( ( uint8_t ) 1 )
@@ -75,6 +119,10 @@ functions but without including stdio.h here. */
  */
 #define tskSTACK_FILL_BYTE	( 0xa5U )
 
+/* tskSTACK_FILL_BYTE repeated across a whole StackType_t, so the high water
+mark can be found a word at a time. */
+#define tskSTACK_FILL_WORD	( ( StackType_t ) ( ( ( ( StackType_t ) ~( StackType_t ) 0U ) / ( StackType_t ) 0xffU ) * ( StackType_t ) tskSTACK_FILL_BYTE ) )
+
 /* Bits used to recored how a task's stack and TCB were allocated. */
 #define tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB 		( ( uint8_t ) 0 )
 #define tskSTATICALLY_ALLOCATED_STACK_ONLY 			( ( uint8_t ) 1 )
@@ -98,6 +146,14 @@ set then don't fill the stack so there is no unnecessary dependency on memset. *
 #define tskDELETED_CHAR		( 'D' )
 #define tskSUSPENDED_CHAR	( 'S' )
 
+/*
+ * Constants used by the monotonic clock.  The timer that generates the tick
+ * interrupt counts at portTICK_FRACTION_HZ.
+ */
+#define tskNANOSECONDS_PER_SECOND		( 1000000000ULL )
+#define tskMICROSECONDS_PER_SECOND		( 1000000ULL )
+#define tskMONOTONIC_COUNTS_PER_TICK	( ( uint64_t ) portTICK_FRACTION_HZ / ( uint64_t ) configTICK_RATE_HZ )
+
 /*
  * Some kernel aware debuggers require the data the debugger needs access to be
  * global, rather than file scope.
@@ -215,11 +271,26 @@ count overflows. */
  * Place the task represented by pxTCB into the appropriate ready list for
  * the task.  It is inserted at the end of the list.
  */
-#define prvAddTaskToReadyList( pxTCB )																\
-	traceMOVED_TASK_TO_READY_STATE( pxTCB );														\
-	taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );												\
-	vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
-	tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+#if( configNUMBER_OF_CORES == 1 )
+
+	#define prvAddTaskToReadyList( pxTCB )																\
+		traceMOVED_TASK_TO_READY_STATE( pxTCB );														\
+		taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );												\
+		vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+		tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+
+#else
+
+	/* As above, but the task may also preempt a lower priority task running on
+	any of the cores it is allowed to run on, not just the calling core. */
+	#define prvAddTaskToReadyList( pxTCB )																\
+		traceMOVED_TASK_TO_READY_STATE( pxTCB );														\
+		taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );												\
+		vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+		prvYieldForTask( pxTCB );																		\
+		tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+
+#endif /* configNUMBER_OF_CORES */
 /*-----------------------------------------------------------*/
 
 /*
@@ -244,6 +315,33 @@ to its original value when it is released. */
 	#define taskEVENT_LIST_ITEM_VALUE_IN_USE	0x80000000UL
 #endif
 
+/* Values that can be held in the xMultiWaitState member of the TCB.  Any value
+of zero or above is the index of the object that unblocked the task. */
+#define taskMULTI_WAIT_NONE					( ( BaseType_t ) -2 )
+#define taskMULTI_WAIT_PENDING				( ( BaseType_t ) -1 )
+
+#if( configUSE_MULTI_WAIT == 1 )
+
+	/* True if the task is blocked in xMultiWaitForAny() and has not yet been
+	unblocked by any of the objects it is waiting on. */
+	#define taskIS_MULTI_WAITING( pxTCB ) ( ( pxTCB )->xMultiWaitState == taskMULTI_WAIT_PENDING )
+
+	/* The task is leaving the Blocked state for a reason other than one of the
+	objects becoming available (timeout, suspension, abort).  Any list items it
+	left in the objects' waiting lists must no longer unblock it. */
+	#define prvMultiWaitCancel( pxTCB )												\
+		if( ( pxTCB )->xMultiWaitState == taskMULTI_WAIT_PENDING )					\
+		{																			\
+			( pxTCB )->xMultiWaitState = taskMULTI_WAIT_NONE;						\
+		}
+
+#else
+
+	#define taskIS_MULTI_WAITING( pxTCB ) pdFALSE
+	#define prvMultiWaitCancel( pxTCB )
+
+#endif /* configUSE_MULTI_WAIT */
+
 /*
  * Task control block.  A task control block (TCB) is allocated for each task,
  * and stores task state information, including a pointer to the task's context
@@ -326,6 +424,28 @@ typedef struct tskTaskControlBlock 			/* The old naming convention is used to pr
 		int iTaskErrno;
 	#endif
 
+	#if( configUSE_MULTI_WAIT == 1 )
+		MultiWaitObject_t	*pxMultiWaitObjects;	/*< The objects passed to xMultiWaitForAny() while the task is using them, otherwise NULL. */
+		UBaseType_t			uxMultiWaitCount;		/*< The number of objects in pxMultiWaitObjects. */
+		volatile BaseType_t	xMultiWaitState;		/*< taskMULTI_WAIT_NONE, taskMULTI_WAIT_PENDING, or the index of the object that unblocked the task. */
+	#endif
+
+	#if( configNUMBER_OF_CORES > 1 )
+		volatile BaseType_t	xTaskRunState;			/*< The core the task is running on, or taskTASK_NOT_RUNNING. */
+		UBaseType_t			uxCoreAffinityMask;		/*< Bit N set if the task is allowed to run on core N. */
+		BaseType_t			xIsIdle;				/*< pdTRUE for the idle tasks. */
+	#endif
+
+	#if( configUSE_TASK_ARENA == 1 )
+		struct xTASK_ARENA	*pxTaskArena;			/*< The task's arena, or NULL.  Released by prvDeleteTCB(). */
+	#endif
+
+	#if( configUSE_FPU_CONTEXT_STATS == 1 )
+		uint32_t			ulContextSwitches;		/*< The number of times the task's context has been saved. */
+		uint32_t			ulFPUContextSaves;		/*< The number of those saves that included the floating point registers. */
+		BaseType_t			xFPUFree;				/*< pdTRUE from vTaskSetFPUFree() until a save next includes the floating point registers. */
+	#endif
+
 } tskTCB;
 
 /* The old tskTCB name is maintained above then typedefed to the new TCB_t name
@@ -334,7 +454,11 @@ typedef tskTCB TCB_t;
 
 /*lint -save -e956 A manual analysis and inspection has been used to determine
 which static variables must be declared volatile. */
-PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
+#if( configNUMBER_OF_CORES == 1 )
+	PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
+#else
+	PRIVILEGED_DATA TCB_t * volatile pxCurrentTCBs[ configNUMBER_OF_CORES ];
+#endif
 
 /* Lists for ready and blocked tasks. --------------------
 xDelayedTaskList1 and xDelayedTaskList2 could be move to function scople but
@@ -372,11 +496,15 @@ PRIVILEGED_DATA static volatile TickType_t xTickCount 				= ( TickType_t ) confi
 PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority 		= tskIDLE_PRIORITY;
 PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunning 		= pdFALSE;
 PRIVILEGED_DATA static volatile TickType_t xPendedTicks 			= ( TickType_t ) 0U;
-PRIVILEGED_DATA static volatile BaseType_t xYieldPending 			= pdFALSE;
+#if( configNUMBER_OF_CORES == 1 )
+	PRIVILEGED_DATA static volatile BaseType_t xYieldPending 		= pdFALSE;
+#else
+	PRIVILEGED_DATA static volatile BaseType_t xYieldPendings[ configNUMBER_OF_CORES ];
+#endif
 PRIVILEGED_DATA static volatile BaseType_t xNumOfOverflows 			= ( BaseType_t ) 0;
 PRIVILEGED_DATA static UBaseType_t uxTaskNumber 					= ( UBaseType_t ) 0U;
 PRIVILEGED_DATA static volatile TickType_t xNextTaskUnblockTime		= ( TickType_t ) 0U; /* Initialised to portMAX_DELAY before the scheduler starts. */
-PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandle					= NULL;			/*< Holds the handle of the idle task.  The idle task is created automatically when the scheduler is started. */
+PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandles[ configNUMBER_OF_CORES ];		/*< Holds the handles of the idle tasks, one per core.  The idle tasks are created automatically when the scheduler is started. */
 
 /* Context switches are held pending while the scheduler is suspended.  Also,
 interrupts must not manipulate the xStateListItem of a TCB, or any of the
@@ -397,6 +525,15 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 
 #endif
 
+#if ( configUSE_FPU_CONTEXT_STATS == 1 )
+
+	/* The totals of ulContextSwitches and ulFPUContextSaves over every task,
+	including tasks that have been deleted. */
+	PRIVILEGED_DATA static uint32_t ulTotalContextSwitches = 0UL;
+	PRIVILEGED_DATA static uint32_t ulTotalFPUContextSaves = 0UL;
+
+#endif
+
 /*lint -restore */
 
 /*-----------------------------------------------------------*/
@@ -418,6 +555,10 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 
 	extern void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize ); /*lint !e526 Symbol not defined as it is an application callback. */
 
+	#if( configNUMBER_OF_CORES > 1 )
+		extern void vApplicationGetPassiveIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize, BaseType_t xPassiveIdleTaskIndex ); /*lint !e526 Symbol not defined as it is an application callback. */
+	#endif
+
 #endif
 
 /* File private functions. --------------------------------*/
@@ -509,7 +650,7 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
  */
 #if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
 
-	static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte ) PRIVILEGED_FUNCTION;
+	static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const StackType_t * pxStackWord ) PRIVILEGED_FUNCTION;
 
 #endif
 
@@ -534,6 +675,73 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
  */
 static void prvResetNextTaskUnblockTime( void );
 
+#if( configUSE_MULTI_WAIT == 1 )
+
+	/*
+	 * Called when pxEventListItem, which belongs to pxTCB, has been removed from
+	 * an event list in order to unblock pxTCB.  Returns pdTRUE if pxTCB should be
+	 * unblocked, or pdFALSE if pxEventListItem was left behind by a multi-wait
+	 * that has already completed.  MUST BE CALLED FROM A CRITICAL SECTION.
+	 */
+	static BaseType_t prvMultiWaitClaim( TCB_t * const pxTCB, const ListItem_t * const pxEventListItem ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Remove every list item that pxTCB placed in an object's waiting list
+	 * from within xMultiWaitForAny(), and take pxTCB out of the multi-wait.
+	 * MUST BE CALLED FROM A CRITICAL SECTION.
+	 */
+	static void prvMultiWaitUnlink( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if( configNUMBER_OF_CORES > 1 )
+
+	/*
+	 * pxTCB has just been placed in a ready list.  If it is not already running
+	 * and has a higher priority than the task running on one of the cores it
+	 * is allowed to run on then request a yield on the core running the lowest
+	 * priority task.  MUST BE CALLED FROM A CRITICAL SECTION.
+	 */
+	static void prvYieldForTask( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Request a context switch on core xCoreID - either by holding a yield
+	 * pending if xCoreID is the calling core, or by interrupting the other core.
+	 * MUST BE CALLED FROM A CRITICAL SECTION.
+	 */
+	static void prvYieldCore( const BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Select the highest priority ready task that is not already running on
+	 * another core, and that is allowed to run on core xCoreID, as the task
+	 * to run on core xCoreID.  Called with both kernel locks held.
+	 */
+	static void prvSelectHighestPriorityTask( const BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if( configUSE_MONOTONIC_CLOCK == 1 )
+
+	/*
+	 * Return the time since the scheduler started in counts of the timer that
+	 * generates the tick interrupt.  MUST BE CALLED FROM A CRITICAL SECTION.
+	 */
+	static uint64_t prvGetMonotonicCounts( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Convert a number of timer counts to units of which there are
+	 * ullUnitsPerSecond in a second, rounding down.
+	 */
+	static uint64_t prvCountsToUnits( const uint64_t ullCounts, const uint64_t ullUnitsPerSecond ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Convert a time in microseconds to the number of ticks that have occurred
+	 * at that time, rounding down, or rounding up if xRoundUp is pdTRUE.
+	 */
+	static uint64_t prvMicrosecondsToTicks( const uint64_t ullMicroseconds, const BaseType_t xRoundUp ) PRIVILEGED_FUNCTION;
+
+#endif
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 	/*
@@ -693,7 +901,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 			/* Allocate space for the TCB.  Where the memory comes from depends
 			on the implementation of the port malloc function and whether or
 			not static allocation is being used. */
-			pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+			pxNewTCB = ( TCB_t * ) pvPortMallocTCB( sizeof( TCB_t ) );
 
 			if( pxNewTCB != NULL )
 			{
@@ -748,19 +956,19 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 			/* Allocate space for the TCB.  Where the memory comes from depends on
 			the implementation of the port malloc function and whether or not static
 			allocation is being used. */
-			pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+			pxNewTCB = ( TCB_t * ) pvPortMallocTCB( sizeof( TCB_t ) );
 
 			if( pxNewTCB != NULL )
 			{
 				/* Allocate space for the stack used by the task being created.
 				The base of the stack memory stored in the TCB so the task can
 				be deleted later if required. */
-				pxNewTCB->pxStack = ( StackType_t * ) pvPortMalloc( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocStack( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
 				if( pxNewTCB->pxStack == NULL )
 				{
 					/* Could not allocate the stack.  Delete the allocated TCB. */
-					vPortFree( pxNewTCB );
+					vPortFreeObject( pxNewTCB );
 					pxNewTCB = NULL;
 				}
 			}
@@ -770,12 +978,12 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 		StackType_t *pxStack;
 
 			/* Allocate space for the stack used by the task being created. */
-			pxStack = pvPortMalloc( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation is the stack. */
+			pxStack = pvPortMallocStack( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation is the stack. */
 
 			if( pxStack != NULL )
 			{
 				/* Allocate space for the TCB. */
-				pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TCB_t is always a pointer to the task's stack. */
+				pxNewTCB = ( TCB_t * ) pvPortMallocTCB( sizeof( TCB_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TCB_t is always a pointer to the task's stack. */
 
 				if( pxNewTCB != NULL )
 				{
@@ -786,7 +994,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 				{
 					/* The stack cannot be used as the TCB was not created.  Free
 					it again. */
-					vPortFree( pxStack );
+					vPortFreeObject( pxStack );
 				}
 			}
 			else
@@ -994,6 +1202,28 @@ UBaseType_t x;
 	}
 	#endif
 
+	#if ( configUSE_MULTI_WAIT == 1 )
+	{
+		pxNewTCB->pxMultiWaitObjects = NULL;
+		pxNewTCB->uxMultiWaitCount = ( UBaseType_t ) 0U;
+		pxNewTCB->xMultiWaitState = taskMULTI_WAIT_NONE;
+	}
+	#endif
+
+	#if ( configUSE_TASK_ARENA == 1 )
+	{
+		pxNewTCB->pxTaskArena = NULL;
+	}
+	#endif
+
+	#if ( configUSE_FPU_CONTEXT_STATS == 1 )
+	{
+		pxNewTCB->ulContextSwitches = 0UL;
+		pxNewTCB->ulFPUContextSaves = 0UL;
+		pxNewTCB->xFPUFree = pdFALSE;
+	}
+	#endif
+
 	#if ( configUSE_NEWLIB_REENTRANT == 1 )
 	{
 		/* Initialise this task's Newlib reent structure.
@@ -1009,6 +1239,14 @@ UBaseType_t x;
 	}
 	#endif
 
+	#if( configNUMBER_OF_CORES > 1 )
+	{
+		pxNewTCB->xTaskRunState = taskTASK_NOT_RUNNING;
+		pxNewTCB->uxCoreAffinityMask = tskNO_AFFINITY;
+		pxNewTCB->xIsIdle = ( pxTaskCode == prvIdleTask ) ? pdTRUE : pdFALSE;
+	}
+	#endif
+
 	/* Initialize the TCB stack to look as if the task was already running,
 	but had been interrupted by the scheduler.  The return address is set
 	to the start of the task function. Once the stack has been initialised
@@ -1074,6 +1312,75 @@ UBaseType_t x;
 }
 /*-----------------------------------------------------------*/
 
+#if( configNUMBER_OF_CORES > 1 )
+
+static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
+{
+BaseType_t xCoreID;
+
+	/* Ensure interrupts and the other cores don't access the task lists while
+	the lists are being updated. */
+	taskENTER_CRITICAL();
+	{
+		uxCurrentNumberOfTasks++;
+
+		if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
+		{
+			/* This is the first task to be created so do the preliminary
+			initialisation required. */
+			prvInitialiseTaskLists();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ( xSchedulerRunning == pdFALSE ) && ( pxNewTCB->xIsIdle != pdFALSE ) )
+		{
+			/* Each core starts with an idle task as its current task so every
+			core has a valid task before the scheduler starts.  The port selects
+			the real first task for each core when it starts the cores. */
+			for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+			{
+				if( pxCurrentTCBs[ xCoreID ] == NULL )
+				{
+					pxNewTCB->xTaskRunState = xCoreID;
+					pxCurrentTCBs[ xCoreID ] = pxNewTCB;
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		uxTaskNumber++;
+
+		#if ( configUSE_TRACE_FACILITY == 1 )
+		{
+			/* Add a counter into the TCB for tracing only. */
+			pxNewTCB->uxTCBNumber = uxTaskNumber;
+		}
+		#endif /* configUSE_TRACE_FACILITY */
+		traceTASK_CREATE( pxNewTCB );
+
+		/* If the scheduler is running this also requests a yield on the core,
+		if any, that the new task should preempt.  A yield requested on the
+		calling core is performed when the critical section is exited. */
+		prvAddTaskToReadyList( pxNewTCB );
+
+		portSETUP_TCB( pxNewTCB );
+	}
+	taskEXIT_CRITICAL();
+}
+
+#else /* configNUMBER_OF_CORES */
+
 static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 {
 	/* Ensure interrupts don't access the task lists while the lists are being
@@ -1155,6 +1462,8 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 		mtCOVERAGE_TEST_MARKER();
 	}
 }
+
+#endif /* configNUMBER_OF_CORES */
 /*-----------------------------------------------------------*/
 
 #if ( INCLUDE_vTaskDelete == 1 )
@@ -1189,13 +1498,22 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				mtCOVERAGE_TEST_MARKER();
 			}
 
+			#if( configUSE_MULTI_WAIT == 1 )
+			{
+				/* The list items used by a multi-wait are held on the stack
+				of the task being deleted, so must not be left in any event
+				list. */
+				prvMultiWaitUnlink( pxTCB );
+			}
+			#endif
+
 			/* Increment the uxTaskNumber also so kernel aware debuggers can
 			detect that the task lists need re-generating.  This is done before
 			portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
 			not return. */
 			uxTaskNumber++;
 
-			if( pxTCB == pxCurrentTCB )
+			if( taskTASK_IS_RUNNING( pxTCB ) )
 			{
 				/* A task is deleting itself.  This cannot complete within the
 				task itself, as a context switch to another task is required.
@@ -1204,6 +1522,21 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				the scheduler for the TCB and stack of the deleted task. */
 				vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xStateListItem ) );
 
+				#if( configNUMBER_OF_CORES > 1 )
+				{
+					/* The task is running on another core, which must switch
+					away from it before the idle task can free its memory. */
+					if( pxTCB->xTaskRunState != portGET_CORE_ID() )
+					{
+						prvYieldCore( pxTCB->xTaskRunState );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+
 				/* Increment the ucTasksDeleted variable so the idle task knows
 				there is a task that has been deleted and that it should therefore
 				check the xTasksWaitingTermination list. */
@@ -1239,7 +1572,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 		{
 			if( pxTCB == pxCurrentTCB )
 			{
-				configASSERT( uxSchedulerSuspended == 0 );
+				taskASSERT_SCHEDULER_NOT_SUSPENDED();
 				portYIELD_WITHIN_API();
 			}
 			else
@@ -1261,7 +1594,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 
 		configASSERT( pxPreviousWakeTime );
 		configASSERT( ( xTimeIncrement > 0U ) );
-		configASSERT( uxSchedulerSuspended == 0 );
+		taskASSERT_SCHEDULER_NOT_SUSPENDED();
 
 		vTaskSuspendAll();
 		{
@@ -1345,7 +1678,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 		/* A delay time of zero just forces a reschedule. */
 		if( xTicksToDelay > ( TickType_t ) 0U )
 		{
-			configASSERT( uxSchedulerSuspended == 0 );
+			taskASSERT_SCHEDULER_NOT_SUSPENDED();
 			vTaskSuspendAll();
 			{
 				traceTASK_DELAY();
@@ -1391,9 +1724,10 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 
 		configASSERT( pxTCB );
 
-		if( pxTCB == pxCurrentTCB )
+		if( taskTASK_IS_RUNNING( pxTCB ) )
 		{
-			/* The task calling this function is querying its own state. */
+			/* The task calling this function is querying its own state, or
+			the state of a task running on another core. */
 			eReturn = eRunning;
 		}
 		else
@@ -1419,7 +1753,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 					/* The task being queried is referenced from the suspended
 					list.  Is it genuinely suspended or is it blocked
 					indefinitely? */
-					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL )
+					if( ( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL ) && ( taskIS_MULTI_WAITING( pxTCB ) == pdFALSE ) )
 					{
 						#if( configUSE_TASK_NOTIFICATIONS == 1 )
 						{
@@ -1520,14 +1854,14 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 		https://www.freertos.org/RTOS-Cortex-M3-M4.html */
 		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
-		uxSavedInterruptState = portSET_INTERRUPT_MASK_FROM_ISR();
+		uxSavedInterruptState = taskENTER_CRITICAL_FROM_ISR();
 		{
 			/* If null is passed in here then it is the priority of the calling
 			task that is being queried. */
 			pxTCB = prvGetTCBFromHandle( xTask );
 			uxReturn = pxTCB->uxPriority;
 		}
-		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptState );
+		taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptState );
 
 		return uxReturn;
 	}
@@ -1607,6 +1941,14 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 					is ready to execute. */
 					xYieldRequired = pdTRUE;
 				}
+				#if( configNUMBER_OF_CORES > 1 )
+					else if( taskTASK_IS_RUNNING( pxTCB ) )
+					{
+						/* The same applies to a task running on another
+						core, but it is that core that must yield. */
+						prvYieldCore( pxTCB->xTaskRunState );
+					}
+				#endif
 				else
 				{
 					/* Setting the priority of any other task down does not
@@ -1734,6 +2076,8 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				mtCOVERAGE_TEST_MARKER();
 			}
 
+			prvMultiWaitCancel( pxTCB );
+
 			vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
 
 			#if( configUSE_TASK_NOTIFICATIONS == 1 )
@@ -1746,6 +2090,21 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				}
 			}
 			#endif
+
+			#if( configNUMBER_OF_CORES > 1 )
+			{
+				/* A task running on another core keeps running until that core
+				switches away from it. */
+				if( taskTASK_IS_RUNNING( pxTCB ) && ( pxTCB->xTaskRunState != portGET_CORE_ID() ) )
+				{
+					prvYieldCore( pxTCB->xTaskRunState );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
 		}
 		taskEXIT_CRITICAL();
 
@@ -1769,26 +2128,37 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			if( xSchedulerRunning != pdFALSE )
 			{
 				/* The current task has just been suspended. */
-				configASSERT( uxSchedulerSuspended == 0 );
+				taskASSERT_SCHEDULER_NOT_SUSPENDED();
 				portYIELD_WITHIN_API();
 			}
 			else
 			{
-				/* The scheduler is not running, but the task that was pointed
-				to by pxCurrentTCB has just been suspended and pxCurrentTCB
-				must be adjusted to point to a different task. */
-				if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks ) /*lint !e931 Right has no side effect, just volatile. */
+				#if( configNUMBER_OF_CORES == 1 )
 				{
-					/* No other tasks are ready, so set pxCurrentTCB back to
-					NULL so when the next task is created pxCurrentTCB will
-					be set to point to it no matter what its relative priority
-					is. */
-					pxCurrentTCB = NULL;
+					/* The scheduler is not running, but the task that was pointed
+					to by pxCurrentTCB has just been suspended and pxCurrentTCB
+					must be adjusted to point to a different task. */
+					if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks ) /*lint !e931 Right has no side effect, just volatile. */
+					{
+						/* No other tasks are ready, so set pxCurrentTCB back to
+						NULL so when the next task is created pxCurrentTCB will
+						be set to point to it no matter what its relative priority
+						is. */
+						pxCurrentTCB = NULL;
+					}
+					else
+					{
+						vTaskSwitchContext();
+					}
 				}
-				else
+				#else
 				{
-					vTaskSwitchContext();
+					/* Only the idle tasks are current before the scheduler
+					starts, and the port selects the first task for each core
+					when it starts the cores. */
+					mtCOVERAGE_TEST_MARKER();
 				}
+				#endif
 			}
 		}
 		else
@@ -1821,7 +2191,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			{
 				/* Is it in the suspended list because it is in the	Suspended
 				state, or because is is blocked with no timeout? */
-				if( listIS_CONTAINED_WITHIN( NULL, &( pxTCB->xEventListItem ) ) != pdFALSE ) /*lint !e961.  The cast is only redundant when NULL is used. */
+				if( ( listIS_CONTAINED_WITHIN( NULL, &( pxTCB->xEventListItem ) ) != pdFALSE ) && ( taskIS_MULTI_WAITING( pxTCB ) == pdFALSE ) ) /*lint !e961.  The cast is only redundant when NULL is used. */
 				{
 					xReturn = pdTRUE;
 				}
@@ -1928,7 +2298,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 		https://www.freertos.org/RTOS-Cortex-M3-M4.html */
 		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
-		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
 		{
 			if( prvTaskIsTaskSuspended( pxTCB ) != pdFALSE )
 			{
@@ -1964,7 +2334,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
 		return xYieldRequired;
 	}
@@ -1972,48 +2342,112 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 #endif /* ( ( INCLUDE_xTaskResumeFromISR == 1 ) && ( INCLUDE_vTaskSuspend == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-void vTaskStartScheduler( void )
+static BaseType_t prvCreateIdleTasks( void )
 {
-BaseType_t xReturn;
+BaseType_t xReturn = pdPASS;
+BaseType_t xCoreID;
+char cIdleName[ configMAX_TASK_NAME_LEN ];
+UBaseType_t x;
 
-	/* Add the idle task at the lowest priority. */
-	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	/* Add one idle task at the lowest priority for each core.  When there is
+	more than one core the core number is appended to the name of the idle
+	task. */
+	for( xCoreID = 0; ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) && ( xReturn == pdPASS ); xCoreID++ )
 	{
-		StaticTask_t *pxIdleTaskTCBBuffer = NULL;
-		StackType_t *pxIdleTaskStackBuffer = NULL;
-		uint32_t ulIdleTaskStackSize;
+		for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configMAX_TASK_NAME_LEN; x++ )
+		{
+			cIdleName[ x ] = configIDLE_TASK_NAME[ x ];
 
-		/* The Idle task is created using user provided RAM - obtain the
-		address of the RAM then create the idle task. */
-		vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
-		xIdleTaskHandle = xTaskCreateStatic(	prvIdleTask,
-												configIDLE_TASK_NAME,
-												ulIdleTaskStackSize,
-												( void * ) NULL, /*lint !e961.  The cast is not redundant for all compilers. */
-												portPRIVILEGE_BIT, /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
-												pxIdleTaskStackBuffer,
-												pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+			if( cIdleName[ x ] == ( char ) 0x00 )
+			{
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
 
-		if( xIdleTaskHandle != NULL )
+		#if( configNUMBER_OF_CORES > 1 )
 		{
-			xReturn = pdPASS;
+			if( x < ( UBaseType_t ) ( configMAX_TASK_NAME_LEN - 1 ) )
+			{
+				cIdleName[ x ] = ( char ) ( '0' + xCoreID );
+				x++;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
-		else
+		#endif
+
+		cIdleName[ ( x < ( UBaseType_t ) configMAX_TASK_NAME_LEN ) ? x : ( UBaseType_t ) ( configMAX_TASK_NAME_LEN - 1 ) ] = ( char ) 0x00;
+
+		#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 		{
-			xReturn = pdFAIL;
+			StaticTask_t *pxIdleTaskTCBBuffer = NULL;
+			StackType_t *pxIdleTaskStackBuffer = NULL;
+			uint32_t ulIdleTaskStackSize;
+
+			/* The Idle task is created using user provided RAM - obtain the
+			address of the RAM then create the idle task. */
+			#if( configNUMBER_OF_CORES > 1 )
+			{
+				if( xCoreID != 0 )
+				{
+					vApplicationGetPassiveIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize, xCoreID - 1 );
+				}
+				else
+				{
+					vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
+				}
+			}
+			#else
+			{
+				vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
+			}
+			#endif
+
+			xIdleTaskHandles[ xCoreID ] = xTaskCreateStatic(	prvIdleTask,
+																cIdleName,
+																ulIdleTaskStackSize,
+																( void * ) NULL, /*lint !e961.  The cast is not redundant for all compilers. */
+																portPRIVILEGE_BIT, /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+																pxIdleTaskStackBuffer,
+																pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+
+			if( xIdleTaskHandles[ xCoreID ] != NULL )
+			{
+				xReturn = pdPASS;
+			}
+			else
+			{
+				xReturn = pdFAIL;
+			}
 		}
+		#else
+		{
+			/* The Idle task is being created using dynamically allocated RAM. */
+			xReturn = xTaskCreate(	prvIdleTask,
+									cIdleName,
+									configMINIMAL_STACK_SIZE,
+									( void * ) NULL,
+									portPRIVILEGE_BIT, /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+									&( xIdleTaskHandles[ xCoreID ] ) ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+		}
+		#endif /* configSUPPORT_STATIC_ALLOCATION */
 	}
-	#else
-	{
-		/* The Idle task is being created using dynamically allocated RAM. */
-		xReturn = xTaskCreate(	prvIdleTask,
-								configIDLE_TASK_NAME,
-								configMINIMAL_STACK_SIZE,
-								( void * ) NULL,
-								portPRIVILEGE_BIT, /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
-								&xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
-	}
-	#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskStartScheduler( void )
+{
+BaseType_t xReturn;
+
+	xReturn = prvCreateIdleTasks();
 
 	#if ( configUSE_TIMERS == 1 )
 	{
@@ -2070,6 +2504,9 @@ BaseType_t xReturn;
 
 		traceTASK_SWITCHED_IN();
 
+		/* Guard the end of the first task's stack, if the port can. */
+		portSET_STACK_GUARD( pxCurrentTCB->pxStack );
+
 		/* Setting up the timer tick is hardware specific and thus in the
 		portable interface. */
 		if( xPortStartScheduler() != pdFALSE )
@@ -2091,8 +2528,8 @@ BaseType_t xReturn;
 	}
 
 	/* Prevent compiler warnings if INCLUDE_xTaskGetIdleTaskHandle is set to 0,
-	meaning xIdleTaskHandle is not used anywhere else. */
-	( void ) xIdleTaskHandle;
+	meaning xIdleTaskHandles is not used anywhere else. */
+	( void ) xIdleTaskHandles;
 }
 /*-----------------------------------------------------------*/
 
@@ -2118,13 +2555,43 @@ void vTaskSuspendAll( void )
 	do not otherwise exhibit real time behaviour. */
 	portSOFTWARE_BARRIER();
 
-	/* The scheduler is suspended if uxSchedulerSuspended is non-zero.  An increment
-	is used to allow calls to vTaskSuspendAll() to nest. */
-	++uxSchedulerSuspended;
+	#if( configNUMBER_OF_CORES == 1 )
+	{
+		/* The scheduler is suspended if uxSchedulerSuspended is non-zero.  An increment
+		is used to allow calls to vTaskSuspendAll() to nest. */
+		++uxSchedulerSuspended;
 
-	/* Enforces ordering for ports and optimised compilers that may otherwise place
-	the above increment elsewhere. */
-	portMEMORY_BARRIER();
+		/* Enforces ordering for ports and optimised compilers that may otherwise place
+		the above increment elsewhere. */
+		portMEMORY_BARRIER();
+	}
+	#else
+	{
+	UBaseType_t uxSavedInterruptStatus;
+
+		if( xSchedulerRunning != pdFALSE )
+		{
+			/* Interrupts are masked so the calling task cannot be moved to
+			another core while it takes the locks.  The task lock is then held
+			until the matching xTaskResumeAll(), which keeps the other cores
+			out of the kernel while still allowing interrupts on this core.
+			The ISR lock is taken while the count is incremented as interrupts
+			on the other cores check the count. */
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			portGET_TASK_LOCK();
+			portGET_ISR_LOCK();
+			{
+				++uxSchedulerSuspended;
+			}
+			portRELEASE_ISR_LOCK();
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		else
+		{
+			++uxSchedulerSuspended;
+		}
+	}
+	#endif /* configNUMBER_OF_CORES */
 }
 /*----------------------------------------------------------*/
 
@@ -2209,6 +2676,21 @@ BaseType_t xAlreadyYielded = pdFALSE;
 	{
 		--uxSchedulerSuspended;
 
+		#if( configNUMBER_OF_CORES > 1 )
+		{
+			/* Drop the hold vTaskSuspendAll() took on the task lock.  The
+			critical section still holds it. */
+			if( xSchedulerRunning != pdFALSE )
+			{
+				portRELEASE_TASK_LOCK();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif
+
 		if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
 		{
 			if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
@@ -2347,6 +2829,101 @@ UBaseType_t uxSavedInterruptStatus;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_MONOTONIC_CLOCK == 1 )
+
+	static uint64_t prvGetMonotonicCounts( void )
+	{
+	uint64_t ullTicks;
+	UBaseType_t uxPendingTicks;
+	uint32_t ulFraction;
+
+		/* The tick interrupt cannot be processed within the critical section,
+		so the port reports a tick that has occurred but not yet been
+		processed in uxPendingTicks.  Ticks that occurred while the scheduler
+		was suspended are held in xPendedTicks. */
+		ulFraction = portGET_TICK_FRACTION( &uxPendingTicks );
+
+		ullTicks = ( ( uint64_t ) ( UBaseType_t ) xNumOfOverflows * ( ( uint64_t ) portMAX_DELAY + 1ULL ) );
+		ullTicks += ( uint64_t ) xTickCount + ( uint64_t ) xPendedTicks + ( uint64_t ) uxPendingTicks;
+
+		return ( ullTicks * tskMONOTONIC_COUNTS_PER_TICK ) + ( uint64_t ) ulFraction;
+	}
+	/*-----------------------------------------------------------*/
+
+	static uint64_t prvCountsToUnits( const uint64_t ullCounts, const uint64_t ullUnitsPerSecond )
+	{
+	const uint64_t ullCountsPerSecond = ( uint64_t ) portTICK_FRACTION_HZ;
+
+		/* Whole seconds and the remainder are converted separately so the
+		multiplication cannot overflow. */
+		return ( ( ullCounts / ullCountsPerSecond ) * ullUnitsPerSecond ) + ( ( ( ullCounts % ullCountsPerSecond ) * ullUnitsPerSecond ) / ullCountsPerSecond );
+	}
+	/*-----------------------------------------------------------*/
+
+	static uint64_t prvMicrosecondsToTicks( const uint64_t ullMicroseconds, const BaseType_t xRoundUp )
+	{
+	uint64_t ullTicks, ullRemainder;
+
+		ullTicks = ( ullMicroseconds / tskMICROSECONDS_PER_SECOND ) * ( uint64_t ) configTICK_RATE_HZ;
+		ullRemainder = ( ullMicroseconds % tskMICROSECONDS_PER_SECOND ) * ( uint64_t ) configTICK_RATE_HZ;
+		ullTicks += ullRemainder / tskMICROSECONDS_PER_SECOND;
+
+		if( ( xRoundUp != pdFALSE ) && ( ( ullRemainder % tskMICROSECONDS_PER_SECOND ) != 0ULL ) )
+		{
+			ullTicks++;
+		}
+
+		return ullTicks;
+	}
+	/*-----------------------------------------------------------*/
+
+	uint64_t ullTaskGetMonotonicTimeNs( void )
+	{
+	uint64_t ullCounts;
+
+		taskENTER_CRITICAL();
+		{
+			ullCounts = prvGetMonotonicCounts();
+		}
+		taskEXIT_CRITICAL();
+
+		return prvCountsToUnits( ullCounts, tskNANOSECONDS_PER_SECOND );
+	}
+	/*-----------------------------------------------------------*/
+
+	uint64_t ullTaskGetMonotonicTimeUs( void )
+	{
+	uint64_t ullCounts;
+
+		taskENTER_CRITICAL();
+		{
+			ullCounts = prvGetMonotonicCounts();
+		}
+		taskEXIT_CRITICAL();
+
+		return prvCountsToUnits( ullCounts, tskMICROSECONDS_PER_SECOND );
+	}
+	/*-----------------------------------------------------------*/
+
+	uint64_t ullTaskGetMonotonicTimeUsFromISR( void )
+	{
+	uint64_t ullCounts;
+	UBaseType_t uxSavedInterruptStatus;
+
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+		{
+			ullCounts = prvGetMonotonicCounts();
+		}
+		taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+		return prvCountsToUnits( ullCounts, tskMICROSECONDS_PER_SECOND );
+	}
+
+#endif /* configUSE_MONOTONIC_CLOCK */
+/*-----------------------------------------------------------*/
+
 UBaseType_t uxTaskGetNumberOfTasks( void )
 {
 	/* A critical section is not required because the variables are of type
@@ -2579,9 +3156,11 @@ TCB_t *pxTCB;
 	TaskHandle_t xTaskGetIdleTaskHandle( void )
 	{
 		/* If xTaskGetIdleTaskHandle() is called before the scheduler has been
-		started, then xIdleTaskHandle will be NULL. */
-		configASSERT( ( xIdleTaskHandle != NULL ) );
-		return xIdleTaskHandle;
+		started, then the idle task handle will be NULL.  When there is more
+		than one core the handle of the idle task created for core 0 is
+		returned. */
+		configASSERT( ( xIdleTaskHandles[ 0 ] != NULL ) );
+		return xIdleTaskHandles[ 0 ];
 	}
 
 #endif /* INCLUDE_xTaskGetIdleTaskHandle */
@@ -2612,7 +3191,7 @@ BaseType_t xYieldRequired = pdFALSE;
 
 	/* Must not be called with the scheduler suspended as the implementation
 	relies on xPendedTicks being wound down to 0 in xTaskResumeAll(). */
-	configASSERT( uxSchedulerSuspended == 0 );
+	taskASSERT_SCHEDULER_NOT_SUSPENDED();
 
 	/* Use xPendedTicks to mimic xTicksToCatchUp number of ticks occurring when
 	the scheduler is suspended so the ticks are executed in xTaskResumeAll(). */
@@ -2665,6 +3244,8 @@ BaseType_t xYieldRequired = pdFALSE;
 					{
 						mtCOVERAGE_TEST_MARKER();
 					}
+
+					prvMultiWaitCancel( pxTCB );
 				}
 				taskEXIT_CRITICAL();
 
@@ -2789,13 +3370,18 @@ BaseType_t xSwitchRequired = pdFALSE;
 						mtCOVERAGE_TEST_MARKER();
 					}
 
+					prvMultiWaitCancel( pxTCB );
+
 					/* Place the unblocked task into the appropriate ready
 					list. */
 					prvAddTaskToReadyList( pxTCB );
 
 					/* A task being unblocked cannot cause an immediate
-					context switch if preemption is turned off. */
-					#if (  configUSE_PREEMPTION == 1 )
+					context switch if preemption is turned off.  When more
+					than one core is in use prvAddTaskToReadyList() has
+					already chosen the core to preempt, and a switch on this
+					core is picked up from xYieldPending below. */
+					#if ( ( configUSE_PREEMPTION == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
 					{
 						/* Preemption is on, but a context switch should
 						only be performed if the unblocked task has a
@@ -2818,7 +3404,7 @@ BaseType_t xSwitchRequired = pdFALSE;
 		/* Tasks of equal priority to the currently running task will share
 		processing time (time slice) if preemption is on, and the application
 		writer has not explicitly turned time slicing off. */
-		#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+		#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
 		{
 			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
 			{
@@ -2829,6 +3415,41 @@ BaseType_t xSwitchRequired = pdFALSE;
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
+		#elif ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+		{
+		BaseType_t xCoreID, xOtherCoreID;
+		UBaseType_t uxPriority, uxCoresAtPriority;
+
+			/* A core only needs to time slice if there are more ready tasks
+			at the priority of its running task than there are cores running
+			tasks of that priority. */
+			for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+			{
+				uxPriority = pxCurrentTCBs[ xCoreID ]->uxPriority;
+				uxCoresAtPriority = 0U;
+
+				for( xOtherCoreID = 0; xOtherCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xOtherCoreID++ )
+				{
+					if( pxCurrentTCBs[ xOtherCoreID ]->uxPriority == uxPriority )
+					{
+						uxCoresAtPriority++;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+
+				if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxPriority ] ) ) > uxCoresAtPriority )
+				{
+					prvYieldCore( xCoreID );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
 		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
 
 		#if ( configUSE_TICK_HOOK == 1 )
@@ -2942,11 +3563,11 @@ BaseType_t xSwitchRequired = pdFALSE;
 
 		/* Save the hook function in the TCB.  A critical section is required as
 		the value can be accessed from an interrupt. */
-		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
 		{
 			xReturn = pxTCB->pxTaskTag;
 		}
-		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
 		return xReturn;
 	}
@@ -2988,6 +3609,35 @@ BaseType_t xSwitchRequired = pdFALSE;
 
 void vTaskSwitchContext( void )
 {
+	#if( configNUMBER_OF_CORES > 1 )
+	{
+		/* The ready lists and the current tasks of the other cores are
+		examined, so must not change while the new task is selected. */
+		portGET_TASK_LOCK();
+		portGET_ISR_LOCK();
+	}
+	#endif
+
+	#if( configUSE_FPU_CONTEXT_STATS == 1 )
+	{
+		/* The context of the current task has just been saved, whether or
+		not the scheduler is suspended, so the port can tell from it whether
+		the floating point registers were saved too. */
+		pxCurrentTCB->ulContextSwitches++;
+		ulTotalContextSwitches++;
+
+		if( portFPU_CONTEXT_SAVED( pxCurrentTCB->pxTopOfStack ) != pdFALSE )
+		{
+			pxCurrentTCB->ulFPUContextSaves++;
+			ulTotalFPUContextSaves++;
+
+			/* The task has used the floating point unit again since it was
+			set free of it. */
+			pxCurrentTCB->xFPUFree = pdFALSE;
+		}
+	}
+	#endif
+
 	if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
 	{
 		/* The scheduler is currently suspended - do not allow a context
@@ -3038,9 +3688,21 @@ void vTaskSwitchContext( void )
 
 		/* Select a new task to run using either the generic C or port
 		optimised asm code. */
-		taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+		#if( configNUMBER_OF_CORES == 1 )
+		{
+			taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+		}
+		#else
+		{
+			prvSelectHighestPriorityTask( portGET_CORE_ID() );
+		}
+		#endif
 		traceTASK_SWITCHED_IN();
 
+		/* Move the stack guard, if the port has one, to the end of the stack
+		of the task that is about to run. */
+		portSET_STACK_GUARD( pxCurrentTCB->pxStack );
+
 		/* After the new task is switched in, update the global errno. */
 		#if( configUSE_POSIX_ERRNO == 1 )
 		{
@@ -3058,9 +3720,152 @@ void vTaskSwitchContext( void )
 		}
 		#endif /* configUSE_NEWLIB_REENTRANT */
 	}
+
+	#if( configNUMBER_OF_CORES > 1 )
+	{
+		portRELEASE_ISR_LOCK();
+		portRELEASE_TASK_LOCK();
+	}
+	#endif
 }
 /*-----------------------------------------------------------*/
 
+#if( configNUMBER_OF_CORES > 1 )
+
+	static void prvSelectHighestPriorityTask( const BaseType_t xCoreID )
+	{
+	TCB_t * const pxPreviousTCB = pxCurrentTCBs[ xCoreID ];
+	TCB_t *pxTCB;
+	List_t *pxReadyList;
+	ListItem_t const *pxEndMarker;
+	ListItem_t *pxIterator;
+	UBaseType_t uxPriority;
+
+		/* uxTopReadyPriority is only raised as tasks are readied, so first
+		lower it to the highest priority that actually has ready tasks. */
+		while( ( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxTopReadyPriority ] ) ) != pdFALSE ) && ( uxTopReadyPriority > tskIDLE_PRIORITY ) )
+		{
+			--uxTopReadyPriority;
+		}
+
+		/* Unlike the single core scheduler the highest priority ready task
+		might already be running on another core, or not be allowed to run on
+		this core, so search down from the highest priority for the first task
+		that can run here.  There is one idle task per core so the search
+		always succeeds. */
+		uxPriority = uxTopReadyPriority;
+
+		for( ;; )
+		{
+			pxReadyList = &( pxReadyTasksLists[ uxPriority ] );
+			pxEndMarker = listGET_END_MARKER( pxReadyList );
+
+			for( pxIterator = listGET_HEAD_ENTRY( pxReadyList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+			{
+				pxTCB = listGET_LIST_ITEM_OWNER( pxIterator ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+				if( ( ( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING ) || ( pxTCB->xTaskRunState == xCoreID ) ) &&
+					( ( pxTCB->uxCoreAffinityMask & taskCORE_MASK( xCoreID ) ) != 0U ) )
+				{
+					if( pxPreviousTCB->xTaskRunState == xCoreID )
+					{
+						pxPreviousTCB->xTaskRunState = taskTASK_NOT_RUNNING;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					pxTCB->xTaskRunState = xCoreID;
+					pxCurrentTCBs[ xCoreID ] = pxTCB;
+
+					/* Move the selected task to the end of its ready list so
+					tasks of equal priority get an equal share of the cores. */
+					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+					vListInsertEnd( pxReadyList, &( pxTCB->xStateListItem ) );
+
+					return;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+
+			configASSERT( uxPriority > tskIDLE_PRIORITY );
+
+			if( uxPriority == tskIDLE_PRIORITY )
+			{
+				break;
+			}
+			else
+			{
+				--uxPriority;
+			}
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvYieldCore( const BaseType_t xCoreID )
+	{
+		/* The core's current task is no longer considered when looking for a
+		core to preempt until the core has switched tasks. */
+		xYieldPendings[ xCoreID ] = pdTRUE;
+
+		if( ( xSchedulerRunning != pdFALSE ) && ( xCoreID != portGET_CORE_ID() ) )
+		{
+			portYIELD_CORE( xCoreID );
+		}
+		else
+		{
+			/* A yield on the calling core is performed when the critical
+			section or interrupt is exited, or when the scheduler is
+			resumed. */
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvYieldForTask( const TCB_t * const pxTCB )
+	{
+	BaseType_t xCoreID, xLowestPriorityCore = taskTASK_NOT_RUNNING;
+	UBaseType_t uxLowestPriority = pxTCB->uxPriority;
+
+		if( ( xSchedulerRunning != pdFALSE ) && ( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING ) )
+		{
+			for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+			{
+				if( ( ( pxTCB->uxCoreAffinityMask & taskCORE_MASK( xCoreID ) ) != 0U ) &&
+					( xYieldPendings[ xCoreID ] == pdFALSE ) &&
+					( pxCurrentTCBs[ xCoreID ]->uxPriority < uxLowestPriority ) )
+				{
+					uxLowestPriority = pxCurrentTCBs[ xCoreID ]->uxPriority;
+					xLowestPriorityCore = xCoreID;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+
+			if( xLowestPriorityCore != taskTASK_NOT_RUNNING )
+			{
+				prvYieldCore( xLowestPriorityCore );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
 void vTaskPlaceOnEventList( List_t * const pxEventList, const TickType_t xTicksToWait )
 {
 	configASSERT( pxEventList );
@@ -3139,6 +3944,9 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
 {
 TCB_t *pxUnblockedTCB;
 BaseType_t xReturn;
+#if( configUSE_MULTI_WAIT == 1 )
+	ListItem_t *pxEventListItem;
+#endif
 
 	/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
 	called from a critical section within an ISR. */
@@ -3153,9 +3961,41 @@ BaseType_t xReturn;
 
 	This function assumes that a check has already been made to ensure that
 	pxEventList is not empty. */
-	pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-	configASSERT( pxUnblockedTCB );
-	( void ) uxListRemove( &( pxUnblockedTCB->xEventListItem ) );
+	#if( configUSE_MULTI_WAIT == 1 )
+	{
+		/* A task blocked in xMultiWaitForAny() is referenced from the event
+		lists of several objects.  Once one object has unblocked it the list
+		items it left in the other event lists no longer refer to a blocked
+		task, so are discarded until a task that can be unblocked is found. */
+		for( ;; )
+		{
+			pxEventListItem = listGET_HEAD_ENTRY( pxEventList );
+			pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			configASSERT( pxUnblockedTCB );
+			( void ) uxListRemove( pxEventListItem );
+
+			if( prvMultiWaitClaim( pxUnblockedTCB, pxEventListItem ) != pdFALSE )
+			{
+				break;
+			}
+			else if( listLIST_IS_EMPTY( pxEventList ) != pdFALSE )
+			{
+				/* Only stale multi-wait list items were in the list. */
+				return pdFALSE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	#else
+	{
+		pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+		configASSERT( pxUnblockedTCB );
+		( void ) uxListRemove( &( pxUnblockedTCB->xEventListItem ) );
+	}
+	#endif /* configUSE_MULTI_WAIT */
 
 	if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
 	{
@@ -3220,6 +4060,28 @@ TCB_t *pxUnblockedTCB;
 	configASSERT( pxUnblockedTCB );
 	( void ) uxListRemove( pxEventListItem );
 
+	#if( configUSE_MULTI_WAIT == 1 )
+	{
+	BaseType_t xClaimed;
+
+		/* The task may also be referenced from the event list of a queue, and
+		queues are accessed from interrupts, so the claim is made from a
+		critical section. */
+		taskENTER_CRITICAL();
+		{
+			xClaimed = prvMultiWaitClaim( pxUnblockedTCB, pxEventListItem );
+		}
+		taskEXIT_CRITICAL();
+
+		if( xClaimed == pdFALSE )
+		{
+			/* The list item was left behind by a multi-wait that has already
+			completed, so there is no task to unblock. */
+			return;
+		}
+	}
+	#endif /* configUSE_MULTI_WAIT */
+
 	#if( configUSE_TICKLESS_IDLE != 0 )
 	{
 		/* If a task is blocked on a kernel object then xNextTaskUnblockTime
@@ -3251,6 +4113,161 @@ TCB_t *pxUnblockedTCB;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_MULTI_WAIT == 1 )
+
+	void vTaskMultiWaitEnter( MultiWaitObject_t * const pxObjects, const UBaseType_t uxObjectCount )
+	{
+	UBaseType_t ux;
+
+		/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is
+		used by the multi-wait implementation. */
+		configASSERT( uxSchedulerSuspended != 0 );
+		configASSERT( pxCurrentTCB->uxMultiWaitCount == ( UBaseType_t ) 0U );
+
+		/* Each list item references the calling task, and is given the same
+		item value as the task's own event list item so it can be inserted into
+		a queue's waiting list in priority order. */
+		for( ux = 0; ux < uxObjectCount; ux++ )
+		{
+			vListInitialiseItem( &( pxObjects[ ux ].xWaitListItem ) );
+			listSET_LIST_ITEM_OWNER( &( pxObjects[ ux ].xWaitListItem ), pxCurrentTCB );
+			listSET_LIST_ITEM_VALUE( &( pxObjects[ ux ].xWaitListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		}
+
+		/* No list item has been placed in an event list yet, so interrupts
+		cannot be accessing these members. */
+		pxCurrentTCB->pxMultiWaitObjects = pxObjects;
+		pxCurrentTCB->uxMultiWaitCount = uxObjectCount;
+		pxCurrentTCB->xMultiWaitState = taskMULTI_WAIT_PENDING;
+	}
+
+#endif /* configUSE_MULTI_WAIT */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTI_WAIT == 1 )
+
+	BaseType_t xTaskMultiWaitBlock( const TickType_t xTicksToWait )
+	{
+	BaseType_t xReturn = pdFALSE;
+
+		/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is
+		used by the multi-wait implementation. */
+		configASSERT( uxSchedulerSuspended != 0 );
+
+		/* An interrupt might have made one of the objects available while the
+		other objects were being set up, in which case the task has already
+		been placed in the pending ready list and must not block. */
+		if( ( xTicksToWait != ( TickType_t ) 0 ) && ( pxCurrentTCB->xMultiWaitState == taskMULTI_WAIT_PENDING ) )
+		{
+			prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTI_WAIT */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTI_WAIT == 1 )
+
+	BaseType_t xTaskMultiWaitExit( void )
+	{
+	BaseType_t xReturn;
+
+		/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  The
+		scheduler being suspended protects event group waiting lists, and the
+		critical section protects queue waiting lists. */
+		configASSERT( uxSchedulerSuspended != 0 );
+
+		taskENTER_CRITICAL();
+		{
+			xReturn = pxCurrentTCB->xMultiWaitState;
+			prvMultiWaitUnlink( pxCurrentTCB );
+		}
+		taskEXIT_CRITICAL();
+
+		if( xReturn < ( BaseType_t ) 0 )
+		{
+			xReturn = multiwaitTIMEOUT;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTI_WAIT */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTI_WAIT == 1 )
+
+	static BaseType_t prvMultiWaitClaim( TCB_t * const pxTCB, const ListItem_t * const pxEventListItem )
+	{
+	BaseType_t xReturn = pdTRUE;
+
+		if( pxEventListItem != &( pxTCB->xEventListItem ) )
+		{
+			if( pxTCB->xMultiWaitState == taskMULTI_WAIT_PENDING )
+			{
+				/* The first object to become available unblocks the task.
+				xWaitListItem is the first member of MultiWaitObject_t, so the
+				list item also points to the object description. */
+				pxTCB->xMultiWaitState = ( BaseType_t ) ( ( const MultiWaitObject_t * ) pxEventListItem - pxTCB->pxMultiWaitObjects ); /*lint !e9087 !e740 Cast is safe as xWaitListItem is the first structure member. */
+			}
+			else
+			{
+				/* The task has already been unblocked by another object, or
+				has timed out. */
+				xReturn = pdFALSE;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTI_WAIT */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTI_WAIT == 1 )
+
+	static void prvMultiWaitUnlink( TCB_t * const pxTCB )
+	{
+	UBaseType_t ux;
+	ListItem_t *pxWaitListItem;
+
+		for( ux = 0; ux < pxTCB->uxMultiWaitCount; ux++ )
+		{
+			pxWaitListItem = &( pxTCB->pxMultiWaitObjects[ ux ].xWaitListItem );
+
+			if( listLIST_ITEM_CONTAINER( pxWaitListItem ) != NULL )
+			{
+				( void ) uxListRemove( pxWaitListItem );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		pxTCB->pxMultiWaitObjects = NULL;
+		pxTCB->uxMultiWaitCount = ( UBaseType_t ) 0U;
+		pxTCB->xMultiWaitState = taskMULTI_WAIT_NONE;
+	}
+
+#endif /* configUSE_MULTI_WAIT */
+/*-----------------------------------------------------------*/
+
 void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
 {
 	configASSERT( pxTimeOut );
@@ -3334,6 +4351,115 @@ BaseType_t xReturn;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_MONOTONIC_CLOCK == 1 )
+
+	BaseType_t xTaskCheckForTimeOutUs( const uint64_t ullDeadlineUs, TickType_t * const pxTicksToWait )
+	{
+	uint64_t ullNowUs, ullTicks;
+	BaseType_t xReturn;
+
+		configASSERT( pxTicksToWait );
+
+		ullNowUs = ullTaskGetMonotonicTimeUs();
+
+		if( ullNowUs >= ullDeadlineUs )
+		{
+			*pxTicksToWait = 0;
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			/* A task that blocks for n ticks unblocks at the nth tick
+			interrupt, so must block until the first tick interrupt at or after
+			the deadline. */
+			ullTicks = prvMicrosecondsToTicks( ullDeadlineUs, pdTRUE ) - prvMicrosecondsToTicks( ullNowUs, pdFALSE );
+
+			if( ullTicks >= ( uint64_t ) portMAX_DELAY )
+			{
+				/* Not portMAX_DELAY, which can mean wait indefinitely. */
+				ullTicks = ( uint64_t ) portMAX_DELAY - 1ULL;
+			}
+
+			*pxTicksToWait = ( TickType_t ) ullTicks;
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskDelayUntilUs( uint64_t * const pullPreviousWakeTimeUs, const uint64_t ullTimeIncrementUs )
+	{
+	uint64_t ullWakeTimeUs, ullNowUs, ullTicks, ullSpinUs;
+
+		configASSERT( pullPreviousWakeTimeUs );
+		taskASSERT_SCHEDULER_NOT_SUSPENDED();
+
+		/* The spin must stay well below a tick period, or it would hold off
+		tasks of equal and lower priority for most of one. */
+		configASSERT( ( ( uint64_t ) configDELAY_US_MAX_SPIN_US * 2ULL * ( uint64_t ) configTICK_RATE_HZ ) < tskMICROSECONDS_PER_SECOND );
+
+		ullWakeTimeUs = *pullPreviousWakeTimeUs + ullTimeIncrementUs;
+		*pullPreviousWakeTimeUs = ullWakeTimeUs;
+
+		ullNowUs = ullTaskGetMonotonicTimeUs();
+
+		if( ullNowUs < ullWakeTimeUs )
+		{
+			/* The time from the last tick interrupt before the wake time until
+			the wake time. */
+			ullSpinUs = ( ( ( ullWakeTimeUs % tskMICROSECONDS_PER_SECOND ) * ( uint64_t ) configTICK_RATE_HZ ) % tskMICROSECONDS_PER_SECOND ) / ( uint64_t ) configTICK_RATE_HZ;
+
+			if( ullSpinUs <= ( uint64_t ) configDELAY_US_MAX_SPIN_US )
+			{
+				/* Close enough to be worth waiting for without blocking, so
+				block until the last tick interrupt before the wake time. */
+				ullTicks = prvMicrosecondsToTicks( ullWakeTimeUs, pdFALSE ) - prvMicrosecondsToTicks( ullNowUs, pdFALSE );
+			}
+			else
+			{
+				/* Block until the first tick interrupt at or after the wake
+				time. */
+				ullTicks = prvMicrosecondsToTicks( ullWakeTimeUs, pdTRUE ) - prvMicrosecondsToTicks( ullNowUs, pdFALSE );
+				ullSpinUs = 0ULL;
+			}
+
+			while( ullTicks > 0ULL )
+			{
+				if( ullTicks >= ( uint64_t ) portMAX_DELAY )
+				{
+					vTaskDelay( portMAX_DELAY - ( TickType_t ) 1 );
+					ullTicks -= ( uint64_t ) portMAX_DELAY - 1ULL;
+				}
+				else
+				{
+					vTaskDelay( ( TickType_t ) ullTicks );
+					ullTicks = 0ULL;
+				}
+			}
+
+			while( ( ullSpinUs > 0ULL ) && ( ullTaskGetMonotonicTimeUs() < ullWakeTimeUs ) )
+			{
+				/* Busy wait for at most configDELAY_US_MAX_SPIN_US. */
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskDelayUs( const uint32_t ulMicroseconds )
+	{
+	uint64_t ullStartUs = ullTaskGetMonotonicTimeUs();
+
+		vTaskDelayUntilUs( &ullStartUs, ( uint64_t ) ulMicroseconds );
+	}
+
+#endif /* configUSE_MONOTONIC_CLOCK */
+/*-----------------------------------------------------------*/
+
 void vTaskMissedYield( void )
 {
 	xYieldPending = pdTRUE;
@@ -3428,8 +4554,9 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 			A critical region is not required here as we are just reading from
 			the list, and an occasional incorrect value will not matter.  If
 			the ready list at the idle priority contains more than one task
-			then a task other than the idle task is ready to execute. */
-			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
+			then a task other than the idle task is ready to execute.  There
+			is one idle task per core. */
+			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) configNUMBER_OF_CORES )
 			{
 				taskYIELD();
 			}
@@ -3548,6 +4675,28 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 #endif /* configUSE_TICKLESS_IDLE */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TASK_ARENA == 1 )
+
+	struct xTASK_ARENA *pxTaskGetArena( void )
+	{
+		/* A task only reads and writes its own arena pointer, so no critical
+		section is needed. */
+		return pxCurrentTCB->pxTaskArena;
+	}
+
+#endif /* configUSE_TASK_ARENA */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_ARENA == 1 )
+
+	void vTaskSetArena( struct xTASK_ARENA *pxArena )
+	{
+		pxCurrentTCB->pxTaskArena = pxArena;
+	}
+
+#endif /* configUSE_TASK_ARENA */
+/*-----------------------------------------------------------*/
+
 #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
 
 	void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet, BaseType_t xIndex, void *pvValue )
@@ -3645,21 +4794,67 @@ static void prvCheckTasksWaitingTermination( void )
 	{
 		TCB_t *pxTCB;
 
-		/* uxDeletedTasksWaitingCleanUp is used to prevent taskENTER_CRITICAL()
-		being called too often in the idle task. */
-		while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+		/* uxDeletedTasksWaitingCleanUp is used to prevent taskENTER_CRITICAL()
+		being called too often in the idle task. */
+		#if( configNUMBER_OF_CORES == 1 )
+		{
+			while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+			{
+				taskENTER_CRITICAL();
+				{
+					pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+					--uxCurrentNumberOfTasks;
+					--uxDeletedTasksWaitingCleanUp;
+				}
+				taskEXIT_CRITICAL();
+
+				prvDeleteTCB( pxTCB );
+			}
+		}
+		#else
 		{
-			taskENTER_CRITICAL();
+			ListItem_t const *pxEndMarker = listGET_END_MARKER( &xTasksWaitingTermination );
+			ListItem_t *pxIterator;
+
+			/* A deleted task might still be running on another core until that
+			core switches away from it, so only tasks that are no longer
+			running are freed. */
+			while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
 			{
-				pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-				--uxCurrentNumberOfTasks;
-				--uxDeletedTasksWaitingCleanUp;
-			}
-			taskEXIT_CRITICAL();
+				pxTCB = NULL;
+
+				taskENTER_CRITICAL();
+				{
+					for( pxIterator = listGET_HEAD_ENTRY( &xTasksWaitingTermination ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+					{
+						if( ( ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator ) )->xTaskRunState == taskTASK_NOT_RUNNING )
+						{
+							pxTCB = listGET_LIST_ITEM_OWNER( pxIterator ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+							( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+							--uxCurrentNumberOfTasks;
+							--uxDeletedTasksWaitingCleanUp;
+							break;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+				}
+				taskEXIT_CRITICAL();
 
-			prvDeleteTCB( pxTCB );
+				if( pxTCB != NULL )
+				{
+					prvDeleteTCB( pxTCB );
+				}
+				else
+				{
+					break;
+				}
+			}
 		}
+		#endif /* configNUMBER_OF_CORES */
 	}
 	#endif /* INCLUDE_vTaskDelete */
 }
@@ -3678,6 +4873,11 @@ static void prvCheckTasksWaitingTermination( void )
 		pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName [ 0 ] );
 		pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
 		pxTaskStatus->pxStackBase = pxTCB->pxStack;
+		#if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+		{
+			pxTaskStatus->pxEndOfStack = pxTCB->pxEndOfStack;
+		}
+		#endif
 		pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
 
 		#if ( configUSE_MUTEXES == 1 )
@@ -3700,12 +4900,20 @@ static void prvCheckTasksWaitingTermination( void )
 		}
 		#endif
 
+		#if ( configUSE_FPU_CONTEXT_STATS == 1 )
+		{
+			pxTaskStatus->ulContextSwitches = pxTCB->ulContextSwitches;
+			pxTaskStatus->ulFPUContextSaves = pxTCB->ulFPUContextSaves;
+			pxTaskStatus->xFPUFree = pxTCB->xFPUFree;
+		}
+		#endif
+
 		/* Obtaining the task state is a little fiddly, so is only done if the
 		value of eState passed into this function is eInvalid - otherwise the
 		state is just set to whatever is passed in. */
 		if( eState != eInvalid )
 		{
-			if( pxTCB == pxCurrentTCB )
+			if( taskTASK_IS_RUNNING( pxTCB ) )
 			{
 				pxTaskStatus->eCurrentState = eRunning;
 			}
@@ -3744,11 +4952,11 @@ static void prvCheckTasksWaitingTermination( void )
 		{
 			#if ( portSTACK_GROWTH > 0 )
 			{
-				pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
+				pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( pxTCB->pxEndOfStack );
 			}
 			#else
 			{
-				pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
+				pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( pxTCB->pxStack );
 			}
 			#endif
 		}
@@ -3796,17 +5004,31 @@ static void prvCheckTasksWaitingTermination( void )
 
 #if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
 
-	static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
+	static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const StackType_t * pxStackWord )
 	{
 	uint32_t ulCount = 0U;
 
-		while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+		/* The stack is compared a word at a time, four words per iteration
+		while the words are still untouched.  A word that has been partly
+		overwritten is not counted, so the result is the same as counting the
+		untouched bytes and dividing by sizeof( StackType_t ).  The initial
+		context placed at the top of the stack by pxPortInitialiseStack() is
+		always more than four words, so the first loop cannot read past the
+		end of the stack. */
+		while( ( ( pxStackWord[ 0 ] ^ tskSTACK_FILL_WORD ) |
+				 ( pxStackWord[ -portSTACK_GROWTH ] ^ tskSTACK_FILL_WORD ) |
+				 ( pxStackWord[ -portSTACK_GROWTH * 2 ] ^ tskSTACK_FILL_WORD ) |
+				 ( pxStackWord[ -portSTACK_GROWTH * 3 ] ^ tskSTACK_FILL_WORD ) ) == ( StackType_t ) 0 )
 		{
-			pucStackByte -= portSTACK_GROWTH;
-			ulCount++;
+			pxStackWord -= portSTACK_GROWTH * 4;
+			ulCount += 4U;
 		}
 
-		ulCount /= ( uint32_t ) sizeof( StackType_t ); /*lint !e961 Casting is not redundant on smaller architectures. */
+		while( *pxStackWord == tskSTACK_FILL_WORD )
+		{
+			pxStackWord -= portSTACK_GROWTH;
+			ulCount++;
+		}
 
 		return ( configSTACK_DEPTH_TYPE ) ulCount;
 	}
@@ -3824,7 +5046,7 @@ static void prvCheckTasksWaitingTermination( void )
 	configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
 	{
 	TCB_t *pxTCB;
-	uint8_t *pucEndOfStack;
+	StackType_t *pxEndOfStack;
 	configSTACK_DEPTH_TYPE uxReturn;
 
 		/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
@@ -3838,15 +5060,15 @@ static void prvCheckTasksWaitingTermination( void )
 
 		#if portSTACK_GROWTH < 0
 		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+			pxEndOfStack = pxTCB->pxStack;
 		}
 		#else
 		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+			pxEndOfStack = pxTCB->pxEndOfStack;
 		}
 		#endif
 
-		uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+		uxReturn = prvTaskCheckFreeStackSpace( pxEndOfStack );
 
 		return uxReturn;
 	}
@@ -3859,22 +5081,22 @@ static void prvCheckTasksWaitingTermination( void )
 	UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
 	{
 	TCB_t *pxTCB;
-	uint8_t *pucEndOfStack;
+	StackType_t *pxEndOfStack;
 	UBaseType_t uxReturn;
 
 		pxTCB = prvGetTCBFromHandle( xTask );
 
 		#if portSTACK_GROWTH < 0
 		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+			pxEndOfStack = pxTCB->pxStack;
 		}
 		#else
 		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+			pxEndOfStack = pxTCB->pxEndOfStack;
 		}
 		#endif
 
-		uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+		uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pxEndOfStack );
 
 		return uxReturn;
 	}
@@ -3901,12 +5123,27 @@ static void prvCheckTasksWaitingTermination( void )
 		}
 		#endif /* configUSE_NEWLIB_REENTRANT */
 
+		/* Memory allocated from the task's arena belongs to the task, so is
+		released with it. */
+		#if ( configUSE_TASK_ARENA == 1 )
+		{
+			vTaskArenaRelease( pxTCB->pxTaskArena );
+		}
+		#endif /* configUSE_TASK_ARENA */
+
+		/* Anything else the task allocated and did not free has been leaked. */
+		#if ( configUSE_HEAP_TRACE == 1 )
+		{
+			vHeapTraceTaskDeleted( pxTCB );
+		}
+		#endif /* configUSE_HEAP_TRACE */
+
 		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
 		{
 			/* The task can only have been allocated dynamically - free both
 			the stack and TCB. */
-			vPortFree( pxTCB->pxStack );
-			vPortFree( pxTCB );
+			vPortFreeObject( pxTCB->pxStack );
+			vPortFreeObject( pxTCB );
 		}
 		#elif( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
 		{
@@ -3917,14 +5154,14 @@ static void prvCheckTasksWaitingTermination( void )
 			{
 				/* Both the stack and TCB were allocated dynamically, so both
 				must be freed. */
-				vPortFree( pxTCB->pxStack );
-				vPortFree( pxTCB );
+				vPortFreeObject( pxTCB->pxStack );
+				vPortFreeObject( pxTCB );
 			}
 			else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
 			{
 				/* Only the stack was statically allocated, so the TCB is the
 				only memory that must be freed. */
-				vPortFree( pxTCB );
+				vPortFreeObject( pxTCB );
 			}
 			else
 			{
@@ -3964,7 +5201,7 @@ TCB_t *pxTCB;
 }
 /*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
+#if ( ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) && ( configNUMBER_OF_CORES == 1 ) )
 
 	TaskHandle_t xTaskGetCurrentTaskHandle( void )
 	{
@@ -3978,10 +5215,29 @@ TCB_t *pxTCB;
 		return xReturn;
 	}
 
+#elif ( configNUMBER_OF_CORES > 1 )
+
+	TaskHandle_t xTaskGetCurrentTaskHandle( void )
+	{
+	TaskHandle_t xReturn;
+	UBaseType_t uxSavedInterruptStatus;
+
+		/* The calling task could be moved to another core between reading the
+		core number and reading the current task of that core, so interrupts
+		are masked to prevent a context switch. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			xReturn = pxCurrentTCBs[ portGET_CORE_ID() ];
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+
 #endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) || ( configNUMBER_OF_CORES > 1 ) )
 
 	BaseType_t xTaskGetSchedulerState( void )
 	{
@@ -3993,6 +5249,15 @@ TCB_t *pxTCB;
 		}
 		else
 		{
+			#if( configNUMBER_OF_CORES > 1 )
+			{
+				/* Taking the task lock waits for any other core that has
+				the scheduler suspended, so a non-zero count can only have
+				come from the calling task. */
+				taskENTER_CRITICAL();
+			}
+			#endif
+
 			if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
 			{
 				xReturn = taskSCHEDULER_RUNNING;
@@ -4001,12 +5266,18 @@ TCB_t *pxTCB;
 			{
 				xReturn = taskSCHEDULER_SUSPENDED;
 			}
+
+			#if( configNUMBER_OF_CORES > 1 )
+			{
+				taskEXIT_CRITICAL();
+			}
+			#endif
 		}
 
 		return xReturn;
 	}
 
-#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) ) */
+#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) || ( configNUMBER_OF_CORES > 1 ) ) */
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_MUTEXES == 1 )
@@ -4347,6 +5618,216 @@ TCB_t *pxTCB;
 #endif /* portCRITICAL_NESTING_IN_TCB */
 /*-----------------------------------------------------------*/
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+	/* When more than one core is in use masking interrupts only protects the
+	kernel data from the calling core, so the critical section also takes the
+	two recursive kernel spinlocks provided by the port.  The task lock is held
+	while the scheduler is suspended, and while a task is in a critical section.
+	The ISR lock is held while a task is in a critical section, and while an
+	interrupt is in a critical section.  The task lock is always taken before
+	the ISR lock. */
+	void vTaskEnterCritical( void )
+	{
+		portDISABLE_INTERRUPTS();
+
+		if( xSchedulerRunning != pdFALSE )
+		{
+			if( portGET_CRITICAL_NESTING_COUNT() == 0U )
+			{
+				portGET_TASK_LOCK();
+				portGET_ISR_LOCK();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			portINCREMENT_CRITICAL_NESTING_COUNT();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskExitCritical( void )
+	{
+	BaseType_t xYieldCurrentTask;
+
+		if( xSchedulerRunning != pdFALSE )
+		{
+			configASSERT( portGET_CRITICAL_NESTING_COUNT() > 0U );
+
+			if( portGET_CRITICAL_NESTING_COUNT() > 0U )
+			{
+				portDECREMENT_CRITICAL_NESTING_COUNT();
+
+				if( portGET_CRITICAL_NESTING_COUNT() == 0U )
+				{
+					/* Another core, or the calling core from inside the
+					critical section, may have requested a yield on this core.
+					It cannot be performed while the scheduler is suspended,
+					in which case it is performed by xTaskResumeAll(). */
+					xYieldCurrentTask = ( ( xYieldPending != pdFALSE ) && ( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE ) ) ? pdTRUE : pdFALSE;
+
+					portRELEASE_ISR_LOCK();
+					portRELEASE_TASK_LOCK();
+					portENABLE_INTERRUPTS();
+
+					if( xYieldCurrentTask != pdFALSE )
+					{
+						portYIELD();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	UBaseType_t uxTaskEnterCriticalFromISR( void )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+
+		if( xSchedulerRunning != pdFALSE )
+		{
+			if( portGET_CRITICAL_NESTING_COUNT() == 0U )
+			{
+				portGET_ISR_LOCK();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			portINCREMENT_CRITICAL_NESTING_COUNT();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return uxSavedInterruptStatus;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus )
+	{
+		if( xSchedulerRunning != pdFALSE )
+		{
+			configASSERT( portGET_CRITICAL_NESTING_COUNT() > 0U );
+
+			if( portGET_CRITICAL_NESTING_COUNT() > 0U )
+			{
+				portDECREMENT_CRITICAL_NESTING_COUNT();
+
+				if( portGET_CRITICAL_NESTING_COUNT() == 0U )
+				{
+					portRELEASE_ISR_LOCK();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskCoreAffinitySet( const TaskHandle_t xTask, UBaseType_t uxCoreAffinityMask )
+	{
+	TCB_t *pxTCB;
+
+		/* The task must be allowed to run on at least one core. */
+		configASSERT( ( uxCoreAffinityMask & ( taskCORE_MASK( configNUMBER_OF_CORES ) - 1U ) ) != 0U );
+
+		taskENTER_CRITICAL();
+		{
+			pxTCB = prvGetTCBFromHandle( xTask );
+			pxTCB->uxCoreAffinityMask = uxCoreAffinityMask;
+
+			if( xSchedulerRunning != pdFALSE )
+			{
+				if( taskTASK_IS_RUNNING( pxTCB ) )
+				{
+					/* The task must move if it is no longer allowed to run on
+					the core it is running on. */
+					if( ( uxCoreAffinityMask & taskCORE_MASK( pxTCB->xTaskRunState ) ) == 0U )
+					{
+						prvYieldCore( pxTCB->xTaskRunState );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+				{
+					/* The task may now be able to preempt a core it could not
+					run on before. */
+					prvYieldForTask( pxTCB );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	UBaseType_t uxTaskCoreAffinityGet( const TaskHandle_t xTask )
+	{
+	const TCB_t *pxTCB;
+	UBaseType_t uxReturn;
+
+		taskENTER_CRITICAL();
+		{
+			pxTCB = prvGetTCBFromHandle( xTask );
+			uxReturn = pxTCB->uxCoreAffinityMask;
+		}
+		taskEXIT_CRITICAL();
+
+		return uxReturn;
+	}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 	static char *prvWriteNameToBuffer( char *pcBuffer, const char *pcTaskName )
@@ -4923,7 +6404,7 @@ TickType_t uxReturn;
 
 		pxTCB = xTaskToNotify;
 
-		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
 		{
 			if( pulPreviousNotificationValue != NULL )
 			{
@@ -5013,7 +6494,7 @@ TickType_t uxReturn;
 				}
 			}
 		}
-		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
 		return xReturn;
 	}
@@ -5051,7 +6532,7 @@ TickType_t uxReturn;
 
 		pxTCB = xTaskToNotify;
 
-		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
 		{
 			ucOriginalNotifyState = pxTCB->ucNotifyState;
 			pxTCB->ucNotifyState = taskNOTIFICATION_RECEIVED;
@@ -5101,7 +6582,7 @@ TickType_t uxReturn;
 				}
 			}
 		}
-		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 	}
 
 #endif /* configUSE_TASK_NOTIFICATIONS */
@@ -5168,12 +6649,45 @@ TickType_t uxReturn;
 
 	uint32_t ulTaskGetIdleRunTimeCounter( void )
 	{
-		return xIdleTaskHandle->ulRunTimeCounter;
+		return xIdleTaskHandles[ 0 ]->ulRunTimeCounter;
 	}
 
 #endif
 /*-----------------------------------------------------------*/
 
+#if( configUSE_FPU_CONTEXT_STATS == 1 )
+
+	void vTaskGetFPUContextStats( uint32_t *pulContextSwitches, uint32_t *pulFPUContextSaves )
+	{
+		taskENTER_CRITICAL();
+		{
+			*pulContextSwitches = ulTotalContextSwitches;
+			*pulFPUContextSaves = ulTotalFPUContextSaves;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_FPU_CONTEXT_STATS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_FPU_CONTEXT_STATS == 1 )
+
+	void vTaskSetFPUFree( void )
+	{
+		/* The floating point registers are part of the task's context until
+		the port is told otherwise, so this must not be interrupted by a
+		context switch. */
+		taskENTER_CRITICAL();
+		{
+			portCLEAR_FPU_CONTEXT();
+			pxCurrentTCB->xFPUFree = pdTRUE;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_FPU_CONTEXT_STATS */
+/*-----------------------------------------------------------*/
+
 static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseType_t xCanBlockIndefinitely )
 {
 TickType_t xTimeToWake;
@@ -38,6 +38,10 @@ task.h is included from an application file. */
 #include "queue.h"
 #include "timers.h"
 
+#if( configUSE_OBJECT_SLABS == 1 )
+	#include "object_slab.h"
+#endif
+
 #if ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 0 )
 	#error configUSE_TIMERS must be set to 1 to make the xTimerPendFunctionCall() function available.
 #endif
@@ -287,7 +291,7 @@ BaseType_t xReturn = pdFAIL;
 	{
 	Timer_t *pxNewTimer;
 
-		pxNewTimer = ( Timer_t * ) pvPortMalloc( sizeof( Timer_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of Timer_t is always a pointer to the timer's mame. */
+		pxNewTimer = ( Timer_t * ) pvPortMallocTimer( sizeof( Timer_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of Timer_t is always a pointer to the timer's mame. */
 
 		if( pxNewTimer != NULL )
 		{
@@ -852,7 +856,7 @@ TickType_t xTimeNow;
 						allocated. */
 						if( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
 						{
-							vPortFree( pxTimer );
+							vPortFreeObject( pxTimer );
 						}
 						else
 						{
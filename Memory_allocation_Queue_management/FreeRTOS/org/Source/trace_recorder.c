@@ -0,0 +1,306 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+for the header files above, but not in this file, in order to generate the
+correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+to include the trace recorder.  This #if is closed at the very bottom of this
+file.  If you want to include the trace recorder then ensure
+configUSE_TRACE_RECORDER is set to 1 in FreeRTOSConfig.h. */
+#if( configUSE_TRACE_RECORDER == 1 )
+
+#ifndef portGET_TRACE_TIMESTAMP
+	#error configUSE_TRACE_RECORDER is 1 but the port does not define portGET_TRACE_TIMESTAMP()
+#endif
+
+#ifndef portTRACE_TIMESTAMP_HZ
+	#error configUSE_TRACE_RECORDER is 1 but the port does not define portTRACE_TIMESTAMP_HZ
+#endif
+
+#ifndef portINIT_TRACE_TIMESTAMP
+	#define portINIT_TRACE_TIMESTAMP()
+#endif
+
+#ifndef configTRACE_RECORDER_EVENT_SLOTS
+	#define configTRACE_RECORDER_EVENT_SLOTS	512
+#endif
+
+#ifndef configTRACE_RECORDER_NAME_SLOTS
+	#define configTRACE_RECORDER_NAME_SLOTS		16
+#endif
+
+#ifndef configTRACE_RECORDER_STOP_WHEN_FULL
+	#define configTRACE_RECORDER_STOP_WHEN_FULL	0
+#endif
+
+#ifndef configTRACE_RECORDER_CYCLE_BUDGET
+	#define configTRACE_RECORDER_CYCLE_BUDGET	100
+#endif
+
+#if( ( configTRACE_RECORDER_EVENT_SLOTS & ( configTRACE_RECORDER_EVENT_SLOTS - 1 ) ) != 0 )
+	#error configTRACE_RECORDER_EVENT_SLOTS must be a power of two
+#endif
+
+/* The number of events recorded back to back by
+xTraceRecorderMeasureOverhead(). */
+#define traceCALIBRATION_EVENTS		( 32UL )
+
+#define traceNO_NAME_SLOT			( 0xffffUL )
+
+#if( configNUMBER_OF_CORES > 1 )
+	#define traceGET_CORE_ID()		( ( uint8_t ) portGET_CORE_ID() )
+
+	/* The record must be complete before another core can see its event
+	code. */
+	#define traceRELEASE_FENCE()	__atomic_thread_fence( __ATOMIC_RELEASE )
+#else
+	#define traceGET_CORE_ID()		( ( uint8_t ) 0U )
+
+	/* Only an interrupt on the same core can observe the record, so only the
+	compiler needs to be prevented from reordering the stores. */
+	#define traceRELEASE_FENCE()	__atomic_signal_fence( __ATOMIC_RELEASE )
+#endif
+
+/* The recorder image.  It is not static so it can be located by name from a
+debugger. */
+typedef struct TraceRecorderImage
+{
+	TraceRecorderHeader_t xHeader;
+	TraceName_t xNames[ configTRACE_RECORDER_NAME_SLOTS ];
+	TraceEvent_t xEvents[ configTRACE_RECORDER_EVENT_SLOTS ];
+} TraceRecorder_t;
+
+PRIVILEGED_DATA TraceRecorder_t xTraceRecorder =
+{
+	{
+		traceRECORDER_MAGIC,
+		traceRECORDER_VERSION,
+		configTRACE_RECORDER_NAME_SLOTS,
+		configTRACE_RECORDER_EVENT_SLOTS,
+		0UL,		/* ulTimestampHz is set when recording starts. */
+		0UL,
+		configTRACE_RECORDER_CYCLE_BUDGET,
+		0UL,
+		0UL,
+		0UL,
+		( configTRACE_RECORDER_STOP_WHEN_FULL == 1 ) ? traceRECORDER_FLAG_STOP_WHEN_FULL : 0UL
+	},
+	{ { 0UL, { 0 } } },
+	{ { 0UL, 0UL, 0U, 0U, traceEVENT_NONE } }
+};
+
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStart( void )
+{
+	portINIT_TRACE_TIMESTAMP();
+	xTraceRecorder.xHeader.ulTimestampHz = ( uint32_t ) portTRACE_TIMESTAMP_HZ;
+	xTraceRecorder.xHeader.ulRecording = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStop( void )
+{
+	xTraceRecorder.xHeader.ulRecording = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderClear( void )
+{
+uint32_t ulSlot;
+
+	taskENTER_CRITICAL();
+	{
+		for( ulSlot = 0; ulSlot < ( uint32_t ) configTRACE_RECORDER_EVENT_SLOTS; ulSlot++ )
+		{
+			xTraceRecorder.xEvents[ ulSlot ].ucEvent = traceEVENT_NONE;
+		}
+
+		xTraceRecorder.xHeader.ulEventsWritten = 0;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderEvent( uint32_t ulEvent, uint32_t ulObject, uint32_t ulParameter )
+{
+uint32_t ulIndex;
+TraceEvent_t *pxEvent;
+
+	if( xTraceRecorder.xHeader.ulRecording != pdFALSE )
+	{
+		/* Claiming the slot is the only operation that must be atomic.  An
+		event recorded by an interrupt between claiming and completing the slot
+		simply takes the next slot. */
+		ulIndex = __atomic_fetch_add( &( xTraceRecorder.xHeader.ulEventsWritten ), 1UL, __ATOMIC_RELAXED );
+
+		#if( configTRACE_RECORDER_STOP_WHEN_FULL == 1 )
+		{
+			if( ulIndex >= ( uint32_t ) configTRACE_RECORDER_EVENT_SLOTS )
+			{
+				xTraceRecorder.xHeader.ulRecording = pdFALSE;
+				return;
+			}
+		}
+		#endif
+
+		pxEvent = &( xTraceRecorder.xEvents[ ulIndex & ( ( uint32_t ) configTRACE_RECORDER_EVENT_SLOTS - 1UL ) ] );
+
+		/* Mark the slot incomplete while it is overwritten, so a dump taken
+		part way through is not misread. */
+		pxEvent->ucEvent = traceEVENT_NONE;
+		traceRELEASE_FENCE();
+
+		pxEvent->ulTimestamp = ( uint32_t ) portGET_TRACE_TIMESTAMP();
+		pxEvent->ulObject = ulObject;
+		pxEvent->usParameter = ( uint16_t ) ulParameter;
+		pxEvent->ucCore = traceGET_CORE_ID();
+		traceRELEASE_FENCE();
+		pxEvent->ucEvent = ( uint8_t ) ulEvent;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderName( uint32_t ulEvent, uint32_t ulObject, const char *pcName )
+{
+uint32_t ulSlot, ulChar;
+TraceName_t *pxName;
+
+	if( xTraceRecorder.xHeader.ulRecording != pdFALSE )
+	{
+		ulSlot = __atomic_fetch_add( &( xTraceRecorder.xHeader.ulNamesWritten ), 1UL, __ATOMIC_RELAXED );
+
+		if( ulSlot < ( uint32_t ) configTRACE_RECORDER_NAME_SLOTS )
+		{
+			pxName = &( xTraceRecorder.xNames[ ulSlot ] );
+			pxName->ulObject = ulObject;
+
+			for( ulChar = 0; ulChar < traceRECORDER_NAME_LENGTH; ulChar++ )
+			{
+				pxName->cName[ ulChar ] = pcName[ ulChar ];
+
+				if( pcName[ ulChar ] == ( char ) 0x00 )
+				{
+					break;
+				}
+			}
+
+			for( ; ulChar < traceRECORDER_NAME_LENGTH; ulChar++ )
+			{
+				pxName->cName[ ulChar ] = ( char ) 0x00;
+			}
+		}
+		else
+		{
+			/* The name table is full.  The event is still recorded so the
+			object is shown, without its name. */
+			ulSlot = traceNO_NAME_SLOT;
+		}
+
+		vTraceRecorderEvent( ulEvent, ulObject, ulSlot );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderSetObjectName( const void *pvObject, const char *pcName )
+{
+	vTraceRecorderName( traceEVENT_OBJECT_NAME, traceRECORDER_OBJECT( pvObject ), pcName );
+}
+/*-----------------------------------------------------------*/
+
+const void *pvTraceRecorderGetImage( size_t *pxLength )
+{
+	*pxLength = sizeof( xTraceRecorder );
+	return &xTraceRecorder;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderDump( void ( *pxWrite )( const void *pvData, size_t xLength ) )
+{
+	vTraceRecorderStop();
+
+	pxWrite( &( xTraceRecorder.xHeader ), sizeof( xTraceRecorder.xHeader ) );
+	pxWrite( xTraceRecorder.xNames, sizeof( xTraceRecorder.xNames ) );
+	pxWrite( xTraceRecorder.xEvents, sizeof( xTraceRecorder.xEvents ) );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTraceRecorderMeasureOverhead( uint32_t *pulOverhead )
+{
+uint32_t ulEvent, ulStart, ulEnd, ulWasRecording;
+
+	taskENTER_CRITICAL();
+	{
+		/* The events must be recorded to be measured. */
+		ulWasRecording = xTraceRecorder.xHeader.ulRecording;
+		xTraceRecorder.xHeader.ulRecording = pdTRUE;
+
+		ulStart = ( uint32_t ) portGET_TRACE_TIMESTAMP();
+
+		for( ulEvent = 0; ulEvent < traceCALIBRATION_EVENTS; ulEvent++ )
+		{
+			vTraceRecorderEvent( traceEVENT_CALIBRATION, ulEvent, 0 );
+		}
+
+		ulEnd = ( uint32_t ) portGET_TRACE_TIMESTAMP();
+
+		xTraceRecorder.xHeader.ulRecording = ulWasRecording;
+	}
+	taskEXIT_CRITICAL();
+
+	/* The loop overhead is included, so the result is slightly pessimistic. */
+	*pulOverhead = ( ulEnd - ulStart ) / traceCALIBRATION_EVENTS;
+	xTraceRecorder.xHeader.ulOverhead = *pulOverhead;
+
+	if( *pulOverhead <= ( uint32_t ) configTRACE_RECORDER_CYCLE_BUDGET )
+	{
+		return pdPASS;
+	}
+	else
+	{
+		return pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include the trace recorder.  If you want to include the trace recorder then
+ensure configUSE_TRACE_RECORDER is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_TRACE_RECORDER == 1 */
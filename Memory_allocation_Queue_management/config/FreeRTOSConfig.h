@@ -54,7 +54,6 @@
 #define configTICK_RATE_HZ				( ( TickType_t ) 1000 )
 #define configMAX_PRIORITIES			( 5 )
 #define configMINIMAL_STACK_SIZE		( ( unsigned short ) 130 )
-#define configTOTAL_HEAP_SIZE			( ( size_t ) ( 75 * 1024 ) )
 #define configMAX_TASK_NAME_LEN			( 10 )
 #define configUSE_TRACE_FACILITY		1
 #define configUSE_16_BIT_TICKS			0
@@ -62,12 +61,81 @@
 #define configUSE_MUTEXES				1
 #define configQUEUE_REGISTRY_SIZE		8
 #define configCHECK_FOR_STACK_OVERFLOW	0
+#define configRECORD_STACK_HIGH_ADDRESS	1
 #define configUSE_RECURSIVE_MUTEXES		1
 #define configUSE_MALLOC_FAILED_HOOK	0
 #define configUSE_APPLICATION_TASK_TAG	0
 #define configUSE_COUNTING_SEMAPHORES	1
 #define configGENERATE_RUN_TIME_STATS	0
 
+/* Trace recorder definitions.  512 events use 6KB of RAM.  The budget is in
+CPU cycles, and is checked at start up by xTraceRecorderMeasureOverhead(). */
+#define configUSE_TRACE_RECORDER			1
+#define configTRACE_RECORDER_EVENT_SLOTS	512
+#define configTRACE_RECORDER_NAME_SLOTS		8
+#define configTRACE_RECORDER_CYCLE_BUDGET	100
+
+/* Heap definitions.  The heap spans SRAM1, SRAM2 and the backup SRAM, which
+are given to heap_regions.c by prvSetupHeap() using symbols from
+LinkerScript.ld.  configTOTAL_HEAP_SIZE is only used by heap_4.c. */
+#define configUSE_HEAP_REGIONS			1
+#define configHEAP_MAX_REGIONS			3
+#define configTOTAL_HEAP_SIZE			( ( size_t ) ( 75 * 1024 ) )
+
+/* The heap is locked by raising BASEPRI rather than suspending the scheduler,
+so an allocation does not delay a task woken by an interrupt.  Blocks can be
+reserved for pvPortMallocFromISR() with configHEAP_ISR_BLOCK_COUNT. */
+#define configHEAP_LOCKING				heapLOCKING_MASK_INTERRUPTS
+#define configHEAP_ISR_BLOCK_COUNT		0
+#define configHEAP_ISR_BLOCK_SIZE		32
+
+/* Task arenas, for memory a task only needs until it has finished with its
+current item. */
+#define configUSE_TASK_ARENA			1
+
+/* Object slabs.  The demo's tasks, queue and timers are taken from fixed
+pools sized for main.c, so creating and deleting them does not fragment the
+heap.  The idle and timer tasks are given static memory by object_slab.c. */
+#define configSUPPORT_STATIC_ALLOCATION	1
+#define configUSE_OBJECT_SLABS			1
+#define configSLAB_TASK_COUNT			4
+#define configSLAB_SMALL_STACK_DEPTH	500
+#define configSLAB_SMALL_STACK_COUNT	3
+#define configSLAB_LARGE_STACK_DEPTH	1000
+#define configSLAB_LARGE_STACK_COUNT	1
+#define configSLAB_QUEUE_COUNT			4
+#define configSLAB_QUEUE_STORAGE_SIZE	64
+#define configSLAB_TIMER_COUNT			2
+
+/* Stack profiler definitions.  The stack used by each task is sampled every
+500ms and printed by the consumer with a recommended depth.  A read only MPU
+region at the end of the running task's stack calls
+vApplicationStackOverflowHook() from MemManage as soon as the task reaches it,
+so configCHECK_FOR_STACK_OVERFLOW is left at 0.  configSTACK_OVERFLOW_WATCHPOINT
+uses a DWT watchpoint instead. */
+#define configUSE_STACK_PROFILER			1
+#define configSTACK_PROFILER_MAX_TASKS		8
+#define configSTACK_OVERFLOW_WATCHPOINT		0
+#define configSTACK_OVERFLOW_MPU_GUARD		1
+
+/* Count the context switches of each task, and how many of them saved the FPU
+registers, for prvPrintFPUStats(). */
+#define configUSE_FPU_CONTEXT_STATS			1
+
+/* 64 bit time since the scheduler started with the resolution of the SysTick
+counter, and delays in microseconds, independent of configTICK_RATE_HZ. */
+#define configUSE_MONOTONIC_CLOCK			1
+
+/* Queue items and stream buffer data are copied a word at a time, in LDM/STM
+bursts, by pvMemCopy() (mem_ops.h) rather than by the C library's memcpy(). */
+#define configUSE_MEM_OPS					1
+
+/* Heap trace definitions.  64 slots and 32 samples use 2KB of RAM. */
+#define configUSE_HEAP_TRACE			1
+#define configHEAP_TRACE_SLOTS			64
+#define configHEAP_TRACE_HISTORY		32
+#define configHEAP_TRACE_SAMPLE_PERIOD	16
+
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES 		0
 #define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
@@ -122,6 +190,8 @@ standard names. */
 #define vPortSVCHandler SVC_Handler
 #define xPortPendSVHandler PendSV_Handler
 #define xPortSysTickHandler SysTick_Handler
+#define vPortDebugMonitorHandler DebugMon_Handler
+#define vPortMemManageHandler MemManage_Handler
 
 #endif /* FREERTOS_CONFIG_H */
 
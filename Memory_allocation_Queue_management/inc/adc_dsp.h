@@ -0,0 +1,44 @@
+/**
+  ******************************************************************************
+  * @file    adc_dsp.h
+  * @brief   Stages of the ADC acquisition pipeline (adc_pipeline.h) built on
+  * 		 the CMSIS-DSP filters: an FIR decimator and a biquad cascade, each
+  * 		 with its own state for every channel of the pipeline.
+  ******************************************************************************
+*/
+
+#ifndef ADC_DSP_H
+#define ADC_DSP_H
+
+#include "adc_pipeline.h"
+
+// arm_math.h needs to be told the core it is built for
+#if !defined(ARM_MATH_CM4) && !defined(ARM_MATH_CM7) && !defined(ARM_MATH_CM3) && \
+	!defined(ARM_MATH_CM0) && !defined(ARM_MATH_CM0PLUS)
+#define ARM_MATH_CM4
+#endif
+
+#include "arm_math.h"
+
+typedef struct
+{
+	adc_stage_t stage;
+	arm_fir_decimate_instance_f32 instance[ADC_PIPELINE_MAX_CHANNELS];
+	uint32_t channels;
+	uint32_t block_size;
+	float32_t *output;				// Of block_size / factor samples
+} adc_fir_decimator_t;
+
+typedef struct
+{
+	adc_stage_t stage;
+	arm_biquad_casd_df1_inst_f32 instance[ADC_PIPELINE_MAX_CHANNELS];
+	uint32_t channels;
+} adc_biquad_t;
+
+BaseType_t adc_fir_decimator_init(adc_fir_decimator_t *decimator, uint32_t channels, uint8_t factor,
+		float32_t *coeffs, uint16_t taps, float32_t *state, uint32_t block_size, float32_t *output);
+void adc_biquad_init(adc_biquad_t *biquad, uint32_t channels, uint8_t sections, float32_t *coeffs,
+		float32_t *state);
+
+#endif /* ADC_DSP_H */
@@ -0,0 +1,131 @@
+/**
+  ******************************************************************************
+  * @file    adc_pipeline.h
+  * @brief   ADC acquisition pipeline.  A timer triggers a scan of the ADC's
+  * 		 channels at the sample rate, and a DMA stream in double buffer
+  * 		 mode fills a pool of blocks from the DMA stream manager.  Each
+  * 		 full block goes to the pipeline's task without being copied,
+  * 		 where optional stages, such as the CMSIS-DSP filters of
+  * 		 adc_dsp.h, process each channel before the consumer is called.
+  ******************************************************************************
+*/
+
+#ifndef ADC_PIPELINE_H
+#define ADC_PIPELINE_H
+
+#include <stdint.h>
+
+#include "stm32f4xx.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "dma_manager.h"
+
+#define ADC_PIPELINE_MAX_CHANNELS	(16)
+#define ADC_PIPELINE_MAX_STAGES		(4)
+
+// Notification bits of the pipeline's task
+#define ADC_PIPELINE_BLOCK_BIT		(1UL << 0)
+#define ADC_PIPELINE_STOP_BIT		(1UL << 1)
+
+struct adc_stage;
+
+// Processes the samples of one channel of a block in place, setting count to
+// the samples left, which is fewer if the stage decimates
+typedef void (*adc_stage_process_t)(struct adc_stage *stage, uint32_t channel, float *samples, uint32_t *count);
+
+typedef struct adc_stage
+{
+	adc_stage_process_t process;
+	void *context;
+} adc_stage_t;
+
+// A full block, valid until the consumer returns
+typedef struct
+{
+	const uint16_t *samples;		// In the DMA buffer, a sample of each channel per scan
+	uint32_t scans;
+	uint32_t channels;
+	float *const *output;			// Each channel after the stages, or NULL if there are none
+	uint32_t output_count;			// Samples in each channel's output
+	uint32_t sequence;				// Blocks filled before this one, including any dropped
+	uint64_t time_us;				// Monotonic time the block was filled
+} adc_block_t;
+
+typedef void (*adc_consumer_t)(const adc_block_t *block, void *context);
+
+typedef struct
+{
+	ADC_TypeDef *regs;
+	const uint8_t *channels;		// ADC_Channel_0 to ADC_Channel_18, in the order converted
+	uint32_t channel_count;
+	uint8_t sample_time;			// ADC_SampleTime_3Cycles to ADC_SampleTime_480Cycles
+	uint32_t sample_rate;			// Scans per second
+
+	// The stream and channel of the ADC's requests
+	uint32_t dma_controller;		// 1 or 2
+	uint32_t dma_stream;
+	uint32_t dma_channel;			// DMA_Channel_0 to DMA_Channel_7
+
+	// 2 to DMA_STREAM_MAX_BUFFERS blocks, each of scans_per_block scans of
+	// 16 bit samples
+	uint8_t *const *buffers;
+	uint32_t buffer_count;
+	uint32_t scans_per_block;
+
+	// Stages run on each channel, with its samples multiplied by scale into
+	// its work buffer of scans_per_block floats.  stage_count may be 0.
+	adc_stage_t *const *stages;
+	uint32_t stage_count;
+	float *const *work;
+	float scale;
+
+	adc_consumer_t consumer;
+	void *context;					// For the consumer
+	UBaseType_t priority;			// Of the pipeline's task
+	configSTACK_DEPTH_TYPE stack_depth;
+} adc_pipeline_config_t;
+
+// Enables the clock of an ADC and sets up what the ADCs share, or disables
+// it, and starts or stops the timer whose trigger output starts each scan,
+// which trigger_source names.  adc_stm32f4_hw is the STM32F4; the host
+// simulation has its own.
+typedef struct
+{
+	void (*enable)(const adc_pipeline_config_t *config, FunctionalState state);
+	void (*trigger)(const adc_pipeline_config_t *config, FunctionalState state);
+	uint32_t trigger_source;		// ADC_ExternalTrigConv_xxx
+} adc_hw_t;
+
+typedef struct
+{
+	uint32_t blocks;				// Processed by the task
+	uint32_t dropped;				// Filled again as the task held every other block
+	uint32_t errors;				// DMA transfer and direct mode errors
+	uint64_t samples;				// In the blocks processed
+	uint32_t samples_per_second;	// Since the pipeline was started
+	uint32_t process_mean_us;		// Stages and consumer, for each block
+	uint32_t process_max_us;
+	uint32_t latency_max_us;		// From a block being filled to the consumer returning
+	uint32_t load;					// Processing time in tenths of a percent of the time running
+} adc_pipeline_stats_t;
+
+typedef struct
+{
+	adc_pipeline_config_t config;
+	const adc_hw_t *hw;
+	dma_stream_t dma;
+	TaskHandle_t task;
+	TaskHandle_t stopping;			// The task waiting for the pipeline to stop
+
+	uint64_t start_us;
+	uint64_t process_total_us;
+	adc_pipeline_stats_t stats;
+} adc_pipeline_t;
+
+extern const adc_hw_t adc_stm32f4_hw;
+
+BaseType_t adc_pipeline_start(adc_pipeline_t *pipeline, const adc_hw_t *hw, const adc_pipeline_config_t *config);
+void adc_pipeline_stop(adc_pipeline_t *pipeline);
+void adc_pipeline_get_stats(adc_pipeline_t *pipeline, adc_pipeline_stats_t *stats);
+
+#endif /* ADC_PIPELINE_H */
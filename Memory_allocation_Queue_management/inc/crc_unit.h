@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file    crc_unit.h
+  * @brief   RTOS CRC service on the CRC calculation unit.  Tasks take turns
+  * 		 at the unit through a mutex.  Long buffers of the unit's own
+  * 		 variant are fed to it by a DMA2 stream in memory to memory mode
+  * 		 while the task blocks, and others by the CPU a word at a time,
+  * 		 with bytes past the last whole word added in software.  The
+  * 		 standard variants come out the same as from crc_soft_calculate(),
+  * 		 a slice-by-8 software CRC.
+  ******************************************************************************
+*/
+
+#ifndef CRC_UNIT_H
+#define CRC_UNIT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "stm32f4xx.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "dma_manager.h"
+
+// The notification bit a task waits for while a stream feeds the unit
+#define CRC_DMA_NOTIFY_BIT			(1UL << 29)
+
+// Every variant uses the polynomial 0x04C11DB7 of the unit
+typedef enum
+{
+	CRC_VARIANT_STM32 = 0,			// The unit's own: 32 bit words in memory order, most significant bit
+									// first, then any bytes left over.  Start 0xFFFFFFFF, no final XOR
+	CRC_VARIANT_MPEG2,				// CRC-32/MPEG-2: bytes most significant bit first.  Start 0xFFFFFFFF,
+									// no final XOR
+	CRC_VARIANT_32					// CRC-32 of zlib, Ethernet and PNG: bytes least significant bit first,
+									// result reflected.  Start and final XOR 0xFFFFFFFF
+} crc_variant_t;
+
+// How the CPU writes words to the unit: as they are, byte reversed so the
+// first byte goes first, or bit reversed so the first bit of the first byte
+// goes first
+typedef enum
+{
+	CRC_INPUT_WORDS = 0,
+	CRC_INPUT_BYTES_MSB,
+	CRC_INPUT_BYTES_LSB
+} crc_input_t;
+
+// Enables the clock of the unit, resets it to 0xFFFFFFFF, writes words from
+// the CPU and reads the CRC, and gives the data register DMA writes to.
+// crc_stm32f4_hw is the STM32F4; the host simulation has its own.
+typedef struct
+{
+	void (*enable)(FunctionalState state);
+	void (*reset)(void);
+	void (*write)(const uint8_t *data, uint32_t words, crc_input_t input);
+	uint32_t (*read)(void);
+	volatile uint32_t *data_register;
+} crc_hw_t;
+
+typedef struct
+{
+	uint32_t dma_controller;		// 2, as only DMA2 can copy memory to memory
+	uint32_t dma_stream;
+	uint32_t dma_threshold;			// Bytes from which a buffer is fed by DMA, 0 never to
+} crc_unit_config_t;
+
+typedef struct
+{
+	uint32_t calculations;
+	uint64_t bytes;
+	uint64_t dma_bytes;				// Fed to the unit by the stream
+	uint64_t cpu_bytes;				// Written to the unit by the CPU
+	uint64_t soft_bytes;			// Added in software
+	uint32_t dma_errors;
+	uint32_t waits;					// Calls that found the unit in use
+} crc_unit_stats_t;
+
+typedef struct
+{
+	crc_unit_config_t config;
+	const crc_hw_t *hw;
+	dma_stream_t dma;
+	SemaphoreHandle_t mutex;
+	TaskHandle_t waiting;			// The task a stream is feeding the unit for
+	volatile BaseType_t dma_error;
+	crc_unit_stats_t stats;
+} crc_unit_t;
+
+extern const crc_hw_t crc_stm32f4_hw;
+
+BaseType_t crc_unit_open(crc_unit_t *unit, const crc_hw_t *hw, const crc_unit_config_t *config);
+void crc_unit_close(crc_unit_t *unit);
+BaseType_t crc_calculate(crc_unit_t *unit, crc_variant_t variant, uint32_t initial, const void *data,
+		size_t length, uint32_t *crc, TickType_t timeout);
+void crc_unit_get_stats(crc_unit_t *unit, crc_unit_stats_t *stats);
+
+uint32_t crc_initial(crc_variant_t variant);
+uint32_t crc_soft_calculate(crc_variant_t variant, uint32_t initial, const void *data, size_t length);
+
+#endif /* CRC_UNIT_H */
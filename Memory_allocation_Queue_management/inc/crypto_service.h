@@ -0,0 +1,206 @@
+/**
+  ******************************************************************************
+  * @file    crypto_service.h
+  * @brief   RTOS crypto offload service.  Tasks queue hash and AES jobs, and
+  * 		 a service task runs them on an engine one slice at a time,
+  * 		 highest priority first and in the order queued within a priority.
+  * 		 A job that still has data left after its slice goes to the back
+  * 		 of its priority, so a long job gives way to others between slices
+  * 		 and the engine's state is saved with the job and restored when it
+  * 		 runs again.  Each job completes through a callback, a task
+  * 		 notification, or both.  crypto_stm32f4_engine feeds the HASH and
+  * 		 CRYP processors by DMA; crypto_soft_engine runs the same
+  * 		 algorithms on the CPU.
+  ******************************************************************************
+*/
+
+#ifndef CRYPTO_SERVICE_H
+#define CRYPTO_SERVICE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "stm32f4xx.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "dma_manager.h"
+
+// Job priorities, 0 the lowest
+#define CRYPTO_PRIORITIES			(4)
+
+// The notification bit crypto_run() waits for
+#define CRYPTO_RUN_NOTIFY_BIT		(1UL << 28)
+
+// The service task's own notification bits: a job was queued, and a stream
+// feeding an engine has finished
+#define CRYPTO_QUEUE_NOTIFY_BIT		(1UL << 0)
+#define CRYPTO_DMA_NOTIFY_BIT		(1UL << 1)
+
+#define CRYPTO_AES_BLOCK			(16)
+#define CRYPTO_HASH_BLOCK			(64)
+#define CRYPTO_DIGEST_MAX			(32)
+
+typedef enum
+{
+	CRYPTO_MD5 = 0,					// 16 byte digest
+	CRYPTO_SHA1,					// 20 byte digest
+	CRYPTO_SHA256,					// 32 byte digest, STM32F43x HASH only
+	CRYPTO_AES_ECB,
+	CRYPTO_AES_CBC,
+	CRYPTO_AES_CTR					// The last 32 bits of the counter block count, as in the CRYP
+} crypto_algorithm_t;
+
+#define CRYPTO_IS_HASH(algorithm)	((algorithm) <= CRYPTO_SHA256)
+
+typedef enum
+{
+	CRYPTO_IDLE = 0,
+	CRYPTO_QUEUED,					// Waiting to start
+	CRYPTO_ACTIVE,					// Started, running or waiting for its next slice
+	CRYPTO_DONE,
+	CRYPTO_ERROR,
+	CRYPTO_CANCELLED
+} crypto_status_t;
+
+// A hash part way through, big enough for any of the three
+typedef struct
+{
+	uint32_t state[8];
+	uint64_t bytes;
+	uint8_t block[CRYPTO_HASH_BLOCK];
+} crypto_hash_state_t;
+
+// An AES key schedule, and the chaining block or counter of CBC and CTR
+typedef struct
+{
+	uint8_t round_key[240];
+	uint32_t rounds;
+	uint8_t iv[CRYPTO_AES_BLOCK];
+	BaseType_t decrypt;
+} crypto_aes_state_t;
+
+// What an engine keeps of a job while another job has it: the software
+// state, or the registers of the HASH or CRYP with the key the CRYP cannot
+// give back
+typedef union
+{
+	crypto_hash_state_t hash;
+	crypto_aes_state_t aes;
+	HASH_Context hash_unit;
+	struct
+	{
+		CRYP_Context regs;
+		CRYP_KeyInitTypeDef key;
+	} cryp_unit;
+} crypto_context_t;
+
+struct crypto_job;
+
+// Called from the service task when a job has finished
+typedef void (*crypto_callback_t)(struct crypto_job *job);
+
+// Owned by the service from crypto_submit() until it completes, so must not be
+// on the stack of a function that returns before then
+typedef struct crypto_job
+{
+	crypto_algorithm_t algorithm;
+	BaseType_t decrypt;				// pdTRUE to decrypt, for ECB and CBC
+	const uint8_t *key;				// AES: 16, 24 or 32 bytes
+	uint16_t key_bits;				// 128, 192 or 256
+	const uint8_t *iv;				// CBC and CTR: 16 bytes
+	const uint8_t *input;
+	uint8_t *output;				// AES: length bytes, which may be input.  Hashes: the digest
+	size_t length;					// AES: a multiple of 16 bytes
+	uint8_t priority;				// 0 to CRYPTO_PRIORITIES - 1
+	crypto_callback_t callback;		// NULL for none
+	void *context;					// For the callback
+	TaskHandle_t notify_task;		// If not NULL, notified with eSetBits on
+	uint32_t notify_bits;			// completion
+
+	// Set by the service
+	struct crypto_job *next;
+	volatile crypto_status_t status;
+	size_t done;					// Bytes processed
+	uint32_t slices;
+	uint64_t queued_us;
+	uint32_t latency_us;			// From being queued to completing
+	crypto_context_t saved;
+} crypto_job_t;
+
+// Runs jobs for the service task.  start() sets the engine up for a job's
+// first slice, process() runs a slice, whole blocks unless it is the last,
+// and writes a hash's digest after the last, and save() and restore() move
+// the engine's state to and from the job.  A failed call ends the job.
+typedef struct
+{
+	BaseType_t (*open)(void);
+	void (*close)(void);
+	BaseType_t (*start)(crypto_job_t *job);
+	BaseType_t (*process)(crypto_job_t *job, const uint8_t *input, uint8_t *output, size_t length, BaseType_t last);
+	void (*save)(crypto_job_t *job);
+	BaseType_t (*restore)(crypto_job_t *job);
+} crypto_engine_t;
+
+typedef struct
+{
+	UBaseType_t task_priority;
+	configSTACK_DEPTH_TYPE stack_depth;
+	size_t slice_bytes;				// A multiple of 64: the most a job runs before giving way
+} crypto_service_config_t;
+
+typedef struct
+{
+	uint32_t jobs;					// Completed, including any with errors
+	uint32_t errors;
+	uint64_t bytes;
+	uint32_t slices;
+	uint32_t switches;				// Times a job's state was saved for another job
+	uint64_t busy_us;				// Time the engine was running a slice
+	uint32_t utilisation;			// Busy time in tenths of a percent since opened
+	uint32_t latency_mean_us;		// From being queued to completing
+	uint32_t latency_max_us;
+	uint32_t queued_max;			// Most jobs waiting at once
+} crypto_service_stats_t;
+
+typedef struct
+{
+	crypto_service_config_t config;
+	const crypto_engine_t *engine;
+	TaskHandle_t task;
+
+	// Waiting jobs, a list for each priority, and the job whose state the
+	// engine holds
+	crypto_job_t *head[CRYPTO_PRIORITIES];
+	crypto_job_t *tail[CRYPTO_PRIORITIES];
+	crypto_job_t *loaded;
+	uint32_t queued;
+
+	uint64_t open_us;
+	uint64_t latency_total_us;
+	crypto_service_stats_t stats;
+} crypto_service_t;
+
+extern const crypto_engine_t crypto_stm32f4_engine;
+extern const crypto_engine_t crypto_soft_engine;
+
+BaseType_t crypto_service_open(crypto_service_t *service, const crypto_engine_t *engine,
+		const crypto_service_config_t *config);
+void crypto_service_close(crypto_service_t *service);
+void crypto_submit(crypto_service_t *service, crypto_job_t *job);
+void crypto_submit_from_isr(crypto_service_t *service, crypto_job_t *job);
+BaseType_t crypto_cancel(crypto_service_t *service, crypto_job_t *job);
+BaseType_t crypto_run(crypto_service_t *service, crypto_job_t *job, TickType_t timeout);
+void crypto_service_get_stats(crypto_service_t *service, crypto_service_stats_t *stats);
+
+// The algorithms in software, for crypto_soft_engine and for callers that
+// do not need the service
+size_t crypto_digest_length(crypto_algorithm_t algorithm);
+void crypto_hash_init(crypto_hash_state_t *state, crypto_algorithm_t algorithm);
+void crypto_hash_update(crypto_hash_state_t *state, crypto_algorithm_t algorithm, const uint8_t *data, size_t length);
+void crypto_hash_final(crypto_hash_state_t *state, crypto_algorithm_t algorithm, uint8_t *digest);
+void crypto_aes_init(crypto_aes_state_t *state, const uint8_t *key, uint32_t key_bits, const uint8_t *iv,
+		BaseType_t decrypt);
+void crypto_aes_process(crypto_aes_state_t *state, crypto_algorithm_t algorithm, const uint8_t *input,
+		uint8_t *output, size_t length);
+
+#endif /* CRYPTO_SERVICE_H */
@@ -8,10 +8,23 @@
 #include "task.h"
 #include "semphr.h"
 #include "queue.h"
+#include "heap_trace.h"
+#include "object_slab.h"
+#include "stack_profiler.h"
+#include "dma_manager.h"
+#include "uart_driver.h"
 
 
+extern uart_t console_uart;
+
 void prvPrintMsg(const char *message);
+void prvPrintHeapStats(void);
+void prvPrintStackReport(void);
+void prvPrintFPUStats(void);
+uint32_t prvMeasureContextSwitch(void);
+uint32_t prvMeasureYield(void);
 void prvSetupUart(void);
 void prvSetupGpio(void);
 void prvSetupInterrupt(void);
+void prvSetupHeap(void);
 void prvSetupHW(void);
@@ -0,0 +1,124 @@
+/**
+  ******************************************************************************
+  * @file    dma_manager.h
+  * @brief   RTOS aware DMA stream manager.  A driver claims the DMA streams
+  * 		 it uses, then streams data from its peripheral into a pool of
+  * 		 buffers with the double buffer mode of the stream.  Each filled
+  * 		 buffer is handed to a task through a queue without being copied,
+  * 		 and the task gives it back with dma_stream_release().
+  ******************************************************************************
+*/
+
+#ifndef DMA_MANAGER_H
+#define DMA_MANAGER_H
+
+#include <stdint.h>
+
+#include "stm32f4xx.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+#define DMA_CONTROLLERS				(2)
+#define DMA_STREAMS_PER_CONTROLLER	(8)
+
+// The most buffers one stream can fill in turn
+#define DMA_STREAM_MAX_BUFFERS		(8)
+
+// Interrupt flags of a stream, as passed to a dma_stream_handler_t
+#define DMA_STREAM_FEIF				(1UL << 0)
+#define DMA_STREAM_DMEIF			(1UL << 2)
+#define DMA_STREAM_TEIF				(1UL << 3)
+#define DMA_STREAM_HTIF				(1UL << 4)
+#define DMA_STREAM_TCIF				(1UL << 5)
+
+// The registers of the DMA controllers, a function that enables or disables
+// the clock and interrupt of a stream, and one that clears interrupt flags
+// through LIFCR (high 0) or HIFCR (high 1).  dma_stm32f4_hw describes the
+// STM32F4; the host simulations describe simulated registers, whose flags are
+// not cleared by writing to a register.
+typedef struct
+{
+	DMA_TypeDef *controller[DMA_CONTROLLERS];
+	DMA_Stream_TypeDef *stream[DMA_CONTROLLERS][DMA_STREAMS_PER_CONTROLLER];
+	void (*enable_stream)(uint32_t controller, uint32_t stream, FunctionalState state);
+	void (*clear_flags)(DMA_TypeDef *controller, uint32_t high, uint32_t flags);
+} dma_hw_t;
+
+// How a stream reads from its peripheral
+typedef struct
+{
+	uint32_t channel;				// DMA_Channel_0 to DMA_Channel_7
+	volatile void *peripheral;		// Data register read on each request
+	uint32_t item_size;				// 1, 2 or 4 bytes read on each request
+	uint32_t priority;				// DMA_Priority_Low to DMA_Priority_VeryHigh
+	uint8_t *const *buffers;		// 2 to DMA_STREAM_MAX_BUFFERS buffers
+	uint32_t buffer_count;
+	uint32_t buffer_size;			// Bytes in each buffer
+	TaskHandle_t notify_task;		// If not NULL, notified with eSetBits as
+	uint32_t notify_bits;			// each buffer is filled
+} dma_stream_config_t;
+
+// A filled buffer, owned by the task until it is released
+typedef struct
+{
+	uint8_t *data;
+	uint32_t length;
+	uint32_t sequence;				// Buffers filled before this one, including any dropped
+	uint64_t time_us;				// Monotonic time the buffer was filled
+} dma_buffer_t;
+
+typedef struct
+{
+	uint32_t buffers;				// Filled buffers handed to the task
+	uint32_t overruns;				// Filled buffers dropped as the task held every other buffer
+	uint32_t errors;				// Transfer and direct mode errors
+	uint64_t bytes;					// Bytes in the buffers handed to the task
+	uint32_t bytes_per_second;		// Since the stream was started
+} dma_stream_stats_t;
+
+struct dma_stream;
+
+// Handles the interrupts of a stream the driver programs itself, with the
+// flags that were set
+typedef void (*dma_stream_handler_t)(struct dma_stream *stream, uint32_t flags, void *context, BaseType_t *woken);
+
+typedef struct dma_stream
+{
+	uint32_t controller;			// 1 or 2
+	uint32_t number;				// 0 to 7
+	DMA_Stream_TypeDef *regs;
+	dma_stream_config_t config;
+	QueueHandle_t filled;
+
+	// Buffers neither being filled nor held by the task, and the buffers
+	// in the memory 0 and memory 1 targets of the stream
+	uint8_t free_list[DMA_STREAM_MAX_BUFFERS];
+	uint32_t free_count;
+	uint8_t target[2];
+
+	uint32_t sequence;
+	uint64_t start_us;
+	dma_stream_stats_t stats;
+	BaseType_t running;
+
+	dma_stream_handler_t handler;
+	void *context;
+} dma_stream_t;
+
+extern const dma_hw_t dma_stm32f4_hw;
+
+void dma_manager_init(const dma_hw_t *hw);
+BaseType_t dma_manager_irq(uint32_t controller, uint32_t number);
+
+BaseType_t dma_stream_claim(dma_stream_t *stream, uint32_t controller, uint32_t number);
+void dma_stream_free(dma_stream_t *stream);
+void dma_stream_set_handler(dma_stream_t *stream, dma_stream_handler_t handler, void *context);
+uint32_t dma_stream_clear_flags(dma_stream_t *stream);
+BaseType_t dma_stream_start(dma_stream_t *stream, const dma_stream_config_t *config);
+void dma_stream_stop(dma_stream_t *stream);
+BaseType_t dma_stream_receive(dma_stream_t *stream, dma_buffer_t *buffer, TickType_t timeout);
+void dma_stream_release(dma_stream_t *stream, const dma_buffer_t *buffer);
+void dma_stream_get_stats(dma_stream_t *stream, dma_stream_stats_t *stats);
+
+#endif /* DMA_MANAGER_H */
@@ -0,0 +1,181 @@
+/**
+  ******************************************************************************
+  * @file    i2c_bus.h
+  * @brief   Non-blocking I2C master.  Tasks queue transactions, each writing
+  * 		 bytes to a device, reading bytes from it, or writing a register
+  * 		 number and reading after a repeated start, and the bus runs them
+  * 		 one after another from its event and error interrupts, with DMA
+  * 		 for longer transfers.  Each transaction completes through a
+  * 		 callback, a task notification, or both.  A timer checks the
+  * 		 running transaction against its timeout and recovers the bus
+  * 		 after a timeout or bus error.
+  ******************************************************************************
+*/
+
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <stdint.h>
+
+#include "stm32f4xx.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "dma_manager.h"
+
+// Maximum number of buses open at once
+#define I2C_MAX_BUSES				(3)
+
+// The notification bit i2c_transfer() waits for, not the one spi_transfer()
+// uses, so a task can use both
+#define I2C_TRANSFER_NOTIFY_BIT		(1UL << 30)
+
+// Time a transaction may take from starting, if it does not set its own
+#define I2C_DEFAULT_TIMEOUT_MS		(10)
+
+// Period of the timer that checks for timeouts and recovers the bus
+#define I2C_WATCHDOG_MS				(2)
+
+// Shorter transfers are moved by the interrupts, as setting up a stream
+// takes longer than a few bytes do
+#define I2C_DMA_MIN_LENGTH			(4)
+
+typedef struct
+{
+	I2C_TypeDef *regs;
+	uint32_t clock_speed;			// 100000 or 400000 Hz
+
+	// Pins of the bus, which the caller configures as open drain alternate
+	// functions.  Bus recovery drives them as GPIOs for a while.
+	GPIO_TypeDef *scl_port;
+	uint16_t scl_pin;
+	GPIO_TypeDef *sda_port;
+	uint16_t sda_pin;
+
+	// DMA streams and channels of the I2C's requests, on one controller
+	uint32_t dma_controller;		// 1 or 2, or 0 to move every byte by interrupt
+	uint32_t rx_stream;
+	uint32_t rx_channel;			// DMA_Channel_0 to DMA_Channel_7
+	uint32_t tx_stream;
+	uint32_t tx_channel;
+} i2c_bus_config_t;
+
+// Enables the clock and interrupts of an I2C and sets it up, or disables
+// them, and frees a bus held by a device by clocking SCL until SDA is
+// released.  i2c_stm32f4_hw is the STM32F4; the host simulation has its own.
+typedef struct
+{
+	void (*enable)(const i2c_bus_config_t *config, FunctionalState state);
+	BaseType_t (*recover)(const i2c_bus_config_t *config);
+} i2c_hw_t;
+
+typedef enum
+{
+	I2C_IDLE = 0,
+	I2C_QUEUED,
+	I2C_ACTIVE,
+	I2C_DONE,
+	I2C_NACK,						// The device did not acknowledge
+	I2C_BUS_ERROR,					// Misplaced start or stop, lost arbitration or DMA error
+	I2C_TIMEOUT,
+	I2C_CANCELLED
+} i2c_status_t;
+
+// Where the running transaction is
+typedef enum
+{
+	I2C_STATE_IDLE = 0,
+	I2C_STATE_START,				// Start or repeated start sent
+	I2C_STATE_ADDRESS,				// Address sent
+	I2C_STATE_WRITE,				// Writing by interrupt
+	I2C_STATE_WRITE_DMA,			// Writing by DMA
+	I2C_STATE_WRITE_END,			// Waiting for the last byte to leave
+	I2C_STATE_READ,					// Reading by interrupt
+	I2C_STATE_READ_DMA				// Reading by DMA
+} i2c_state_t;
+
+struct i2c_transaction;
+
+// Called from the bus interrupts when a transaction has finished, or from the
+// timer task after a timeout.  It may queue another transaction.
+typedef void (*i2c_callback_t)(struct i2c_transaction *transaction, BaseType_t *woken);
+
+// Owned by the bus from i2c_submit() until it completes, so must not be on the
+// stack of a function that returns before then
+typedef struct i2c_transaction
+{
+	uint8_t address;				// 7 bit address of the device
+	const uint8_t *tx;				// Written first, such as a register number
+	uint16_t tx_length;				// 0 to only read
+	uint8_t *rx;					// Then read, after a repeated start if
+	uint16_t rx_length;				// anything was written.  0 to only write
+	uint16_t timeout_ms;			// From starting, 0 for I2C_DEFAULT_TIMEOUT_MS
+	i2c_callback_t callback;		// NULL for none
+	void *context;					// For the callback
+	TaskHandle_t notify_task;		// If not NULL, notified with eSetBits on
+	uint32_t notify_bits;			// completion
+
+	// Set by the bus
+	struct i2c_transaction *next;
+	volatile i2c_status_t status;
+	uint64_t queued_us;
+	uint32_t latency_us;			// From being queued to completing
+} i2c_transaction_t;
+
+typedef struct
+{
+	uint32_t transactions;			// Completed, including any that failed
+	uint32_t nacks;
+	uint32_t bus_errors;
+	uint32_t timeouts;
+	uint32_t recoveries;
+	uint64_t bytes;					// Written and read by transactions that completed
+	uint32_t interrupts;			// Event, error and DMA interrupts handled
+	uint64_t busy_us;				// Time a transaction was running
+	uint32_t utilisation;			// Busy time in tenths of a percent since opened
+	uint32_t latency_mean_us;		// From being queued to completing
+	uint32_t latency_max_us;
+	uint32_t queued_max;			// Most transactions waiting at once
+} i2c_bus_stats_t;
+
+typedef struct
+{
+	i2c_bus_config_t config;
+	const i2c_hw_t *hw;
+	dma_stream_t rx_dma;
+	dma_stream_t tx_dma;
+	TimerHandle_t watchdog;
+
+	// Waiting transactions, in the order queued, and the one running
+	i2c_transaction_t *head;
+	i2c_transaction_t *tail;
+	i2c_transaction_t *active;
+	uint32_t queued;
+
+	// Progress of the running transaction
+	volatile i2c_state_t state;
+	BaseType_t reading;
+	uint16_t index;
+
+	// Set after a bus error or timeout, until the timer has recovered the bus
+	volatile BaseType_t recover;
+
+	uint64_t open_us;
+	uint64_t start_us;
+	uint64_t latency_total_us;
+	i2c_bus_stats_t stats;
+} i2c_bus_t;
+
+extern const i2c_hw_t i2c_stm32f4_hw;
+
+BaseType_t i2c_bus_open(i2c_bus_t *bus, const i2c_hw_t *hw, const i2c_bus_config_t *config);
+void i2c_bus_close(i2c_bus_t *bus);
+void i2c_submit(i2c_bus_t *bus, i2c_transaction_t *transaction);
+void i2c_submit_from_isr(i2c_bus_t *bus, i2c_transaction_t *transaction);
+BaseType_t i2c_cancel(i2c_bus_t *bus, i2c_transaction_t *transaction);
+i2c_status_t i2c_transfer(i2c_bus_t *bus, i2c_transaction_t *transaction, TickType_t timeout);
+void i2c_bus_get_stats(i2c_bus_t *bus, i2c_bus_stats_t *stats);
+BaseType_t i2c_event_irq(I2C_TypeDef *regs);
+BaseType_t i2c_error_irq(I2C_TypeDef *regs);
+
+#endif /* I2C_BUS_H */
@@ -0,0 +1,115 @@
+/**
+  ******************************************************************************
+  * @file    kv_store.h
+  * @brief   Log-structured key-value store on flash sectors.  Each write
+  * 		 appends a CRC-protected record to the sector being written, the
+  * 		 head, and a hash index in RAM maps each key to its latest record.
+  * 		 When the head is full the next sector round the ring becomes the
+  * 		 head, and once no sector is left free the oldest is compacted: its
+  * 		 live records are copied to the head and it is erased, so every
+  * 		 sector is erased in turn.  Writes are queued for a worker task,
+  * 		 which also does the slow sector erases while it has nothing else
+  * 		 to do.  Opening the store rebuilds the index from the sectors,
+  * 		 dropping a record cut short by a power loss.
+  ******************************************************************************
+*/
+
+#ifndef KV_STORE_H
+#define KV_STORE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "stm32f4xx.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+
+// The notification bit kv_flush() waits for
+#define KV_FLUSH_NOTIFY_BIT			(1UL << 27)
+
+#define KV_KEY_MAX					(32)
+#define KV_VALUE_MAX				(128)
+#define KV_SECTORS_MAX				(8)
+
+// Erases and programs the sectors of the store, which are read where they
+// are mapped.  Offsets are from the start of the first sector, and programs
+// are of whole words, which only clear bits.  kv_flash_stm32f4 is sectors 6
+// and 7 of the STM32F446; the host simulation has its own.
+typedef struct
+{
+	const uint8_t *base;			// Where the first sector is mapped, the others following
+	uint32_t sector_size;
+	uint32_t sectors;				// 2 to KV_SECTORS_MAX, all sector_size bytes
+	BaseType_t (*erase)(uint32_t sector);
+	BaseType_t (*program)(uint32_t offset, const uint32_t *words, uint32_t count);
+} kv_flash_t;
+
+// A slot of the index: a key's record, found by the key's hash
+typedef struct
+{
+	uint32_t hash;
+	uint32_t location;				// Offset of the record, 0 for an empty slot
+} kv_index_entry_t;
+
+typedef struct
+{
+	UBaseType_t task_priority;		// The worker's, usually low as erases stall flash reads
+	configSTACK_DEPTH_TYPE stack_depth;
+	UBaseType_t queue_length;		// Writes that can wait for the worker
+	kv_index_entry_t *index;		// Kept until closed
+	uint32_t index_size;			// A power of two, at least 4/3 of the keys
+} kv_store_config_t;
+
+typedef struct
+{
+	uint32_t keys;
+	uint32_t sets;					// Records written for the callers
+	uint32_t deletes;
+	uint32_t unchanged;				// Sets of the value a key already had, not written
+	uint32_t write_errors;			// Writes dropped: flash errors, or the store or index full
+	uint64_t user_bytes;			// Keys and values of the writes
+	uint64_t programmed_bytes;		// Including headers, padding and records copied
+	uint32_t compactions;			// Sectors whose live records were copied
+	uint32_t copied;				// Records copied
+	uint32_t erases;
+	uint32_t erase_min;				// Fewest and most times a sector has been erased
+	uint32_t erase_max;
+	uint32_t erase_max_us;			// Longest erase
+	uint32_t torn;					// Records found cut short when opened
+	uint32_t live_bytes;			// Of the latest records of the keys
+	uint32_t free_bytes;			// Left in the head and the free sectors
+} kv_store_stats_t;
+
+typedef struct
+{
+	kv_store_config_t config;
+	const kv_flash_t *flash;
+	TaskHandle_t task;
+	QueueHandle_t requests;
+	SemaphoreHandle_t lock;			// The index, and the records it points to
+
+	// Written only by the worker after opening
+	uint32_t head;
+	uint32_t sequence;				// Of the head, one more for each sector opened
+	uint8_t state[KV_SECTORS_MAX];
+	uint32_t end[KV_SECTORS_MAX];	// Offset in each sector after its last record
+	uint32_t erase_count[KV_SECTORS_MAX];
+	uint32_t sector_sequence[KV_SECTORS_MAX];
+	uint32_t flushed_errors;		// write_errors when the last flush was answered
+
+	kv_store_stats_t stats;
+} kv_store_t;
+
+extern const kv_flash_t kv_flash_stm32f4;
+
+BaseType_t kv_store_open(kv_store_t *store, const kv_flash_t *flash, const kv_store_config_t *config);
+void kv_store_close(kv_store_t *store);
+BaseType_t kv_set(kv_store_t *store, const char *key, const void *value, size_t length, TickType_t timeout);
+BaseType_t kv_delete(kv_store_t *store, const char *key, TickType_t timeout);
+BaseType_t kv_get(kv_store_t *store, const char *key, void *value, size_t size, size_t *length);
+BaseType_t kv_flush(kv_store_t *store, TickType_t timeout);
+void kv_store_get_stats(kv_store_t *store, kv_store_stats_t *stats);
+
+#endif /* KV_STORE_H */
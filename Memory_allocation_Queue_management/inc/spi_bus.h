@@ -0,0 +1,144 @@
+/**
+  ******************************************************************************
+  * @file    spi_bus.h
+  * @brief   RTOS SPI bus manager.  Tasks queue transactions, each naming the
+  * 		 device to select and the bytes to send and receive, and the bus
+  * 		 runs them with DMA one after another from its interrupt, highest
+  * 		 priority first and in the order queued within a priority.  Each
+  * 		 transaction completes through a callback, a task notification,
+  * 		 or both.
+  ******************************************************************************
+*/
+
+#ifndef SPI_BUS_H
+#define SPI_BUS_H
+
+#include <stdint.h>
+
+#include "stm32f4xx.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "dma_manager.h"
+
+// Transaction priorities, 0 the lowest
+#define SPI_PRIORITIES				(4)
+
+// The notification bit spi_transfer() waits for
+#define SPI_TRANSFER_NOTIFY_BIT		(1UL << 31)
+
+// A device on the bus, selected by driving its chip select pin low
+typedef struct
+{
+	GPIO_TypeDef *cs_port;
+	uint16_t cs_pin;
+	uint16_t cpol;					// SPI_CPOL_Low or SPI_CPOL_High
+	uint16_t cpha;					// SPI_CPHA_1Edge or SPI_CPHA_2Edge
+	uint16_t prescaler;				// SPI_BaudRatePrescaler_2 to _256
+} spi_device_t;
+
+// Enables the clock and interrupts of an SPI, or disables them, and drives
+// the chip select of a device.  spi_stm32f4_hw is the STM32F4; the host
+// simulation has its own.
+typedef struct
+{
+	void (*enable)(SPI_TypeDef *regs, FunctionalState state);
+	void (*chip_select)(const spi_device_t *device, FunctionalState active);
+} spi_hw_t;
+
+typedef enum
+{
+	SPI_IDLE = 0,
+	SPI_QUEUED,
+	SPI_ACTIVE,
+	SPI_DONE,
+	SPI_ERROR,
+	SPI_CANCELLED
+} spi_status_t;
+
+struct spi_transaction;
+
+// Called from the bus interrupt when a transaction has finished.  It may queue
+// another transaction, which then runs without waiting for a task.
+typedef void (*spi_callback_t)(struct spi_transaction *transaction, BaseType_t *woken);
+
+// Owned by the bus from spi_submit() until it completes, so must not be on the
+// stack of a function that returns before then
+typedef struct spi_transaction
+{
+	const spi_device_t *device;
+	const uint8_t *tx;				// NULL to send 0xFF
+	uint8_t *rx;					// NULL to discard what is received
+	uint16_t length;				// 1 to 65535 bytes
+	uint8_t priority;				// 0 to SPI_PRIORITIES - 1
+	spi_callback_t callback;		// NULL for none
+	void *context;					// For the callback
+	TaskHandle_t notify_task;		// If not NULL, notified with eSetBits on
+	uint32_t notify_bits;			// completion
+
+	// Set by the bus
+	struct spi_transaction *next;
+	volatile spi_status_t status;
+	uint64_t queued_us;
+	uint32_t latency_us;			// From being queued to completing
+} spi_transaction_t;
+
+typedef struct
+{
+	SPI_TypeDef *regs;
+
+	// DMA streams and channels of the SPI's requests, on one controller
+	uint32_t dma_controller;		// 1 or 2
+	uint32_t rx_stream;
+	uint32_t rx_channel;			// DMA_Channel_0 to DMA_Channel_7
+	uint32_t tx_stream;
+	uint32_t tx_channel;
+} spi_bus_config_t;
+
+typedef struct
+{
+	uint32_t transactions;			// Completed, including any with errors
+	uint32_t errors;				// DMA transfer errors
+	uint64_t bytes;
+	uint64_t busy_us;				// Time a transaction was running
+	uint32_t utilisation;			// Busy time in tenths of a percent since opened
+	uint32_t latency_mean_us;		// From being queued to completing
+	uint32_t latency_max_us;
+	uint32_t queued_max;			// Most transactions waiting at once
+} spi_bus_stats_t;
+
+typedef struct
+{
+	spi_bus_config_t config;
+	const spi_hw_t *hw;
+	dma_stream_t rx_dma;
+	dma_stream_t tx_dma;
+
+	// Waiting transactions, a list for each priority, and the one running
+	spi_transaction_t *head[SPI_PRIORITIES];
+	spi_transaction_t *tail[SPI_PRIORITIES];
+	spi_transaction_t *active;
+	uint32_t queued;
+
+	// The device the SPI is set up for, and the byte sent or received when a
+	// transaction has no buffer
+	const spi_device_t *device;
+	uint8_t fill;
+	uint8_t discard;
+
+	uint64_t open_us;
+	uint64_t start_us;
+	uint64_t latency_total_us;
+	spi_bus_stats_t stats;
+} spi_bus_t;
+
+extern const spi_hw_t spi_stm32f4_hw;
+
+BaseType_t spi_bus_open(spi_bus_t *bus, const spi_hw_t *hw, const spi_bus_config_t *config);
+void spi_bus_close(spi_bus_t *bus);
+void spi_submit(spi_bus_t *bus, spi_transaction_t *transaction);
+void spi_submit_from_isr(spi_bus_t *bus, spi_transaction_t *transaction);
+BaseType_t spi_cancel(spi_bus_t *bus, spi_transaction_t *transaction);
+BaseType_t spi_transfer(spi_bus_t *bus, spi_transaction_t *transaction, TickType_t timeout);
+void spi_bus_get_stats(spi_bus_t *bus, spi_bus_stats_t *stats);
+
+#endif /* SPI_BUS_H */
@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file    uart_driver.h
+  * @brief   Full duplex USART driver using the DMA stream manager.  Received
+  * 		 bytes are written by a circular DMA stream into a ring, which
+  * 		 is copied into a stream buffer at half and full ring and each
+  * 		 time the line goes idle, so a frame reaches the reader as soon as
+  * 		 it ends.  Written bytes are queued in a transmit ring and sent
+  * 		 by a second DMA stream, one contiguous run at a time.
+  ******************************************************************************
+*/
+
+#ifndef UART_DRIVER_H
+#define UART_DRIVER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "stm32f4xx.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "dma_manager.h"
+
+// The most USARTs open at once
+#define UART_MAX_PORTS				(2)
+
+// Enables the clock and interrupt of a USART and sets its baud rate and frame
+// format, or disables its interrupt.  uart_stm32f4_hw is the STM32F4; the host
+// simulation has its own.
+typedef struct
+{
+	void (*enable)(USART_TypeDef *regs, uint32_t baud_rate, FunctionalState state);
+} uart_hw_t;
+
+typedef struct
+{
+	USART_TypeDef *regs;
+	uint32_t baud_rate;
+
+	// DMA streams and channels of the USART's requests, on one controller
+	uint32_t dma_controller;		// 1 or 2
+	uint32_t rx_stream;
+	uint32_t rx_channel;			// DMA_Channel_0 to DMA_Channel_7
+	uint32_t tx_stream;
+	uint32_t tx_channel;
+
+	uint8_t *rx_ring;				// Written by the receive stream
+	uint32_t rx_ring_size;			// Even, at most 65534 bytes
+	size_t rx_buffer_size;			// Bytes the stream buffer holds for the reader
+	uint8_t *tx_ring;				// Read by the transmit stream
+	uint32_t tx_ring_size;			// A power of 2, at most 65536 bytes
+} uart_config_t;
+
+typedef struct
+{
+	uint32_t rx_bytes;				// Bytes received
+	uint32_t rx_frames;				// Times the line went idle after receiving
+	uint32_t rx_dropped;			// Bytes received while the stream buffer was full
+	uint32_t rx_errors;				// Overrun, noise and framing errors
+	uint32_t tx_bytes;				// Bytes sent
+	uint32_t tx_transfers;			// Transmit DMA transfers
+	uint32_t dma_errors;			// Transfer errors on either stream
+	uint32_t interrupts;			// USART and DMA interrupts
+} uart_stats_t;
+
+typedef struct
+{
+	uart_config_t config;
+	const uart_hw_t *hw;
+	dma_stream_t rx_dma;
+	dma_stream_t tx_dma;
+
+	// Received bytes waiting for the reader, and the next byte of the receive
+	// ring to copy to them
+	StreamBufferHandle_t rx;
+	uint32_t rx_tail;
+
+	// Bytes written and bytes sent, counting up, and the length of the
+	// transfer in progress
+	SemaphoreHandle_t tx_lock;		// Held by the writing or flushing task
+	SemaphoreHandle_t tx_done;		// Given as each transfer finishes
+	uint32_t tx_head;
+	uint32_t tx_tail;
+	uint32_t tx_length;
+
+	uart_stats_t stats;
+} uart_t;
+
+extern const uart_hw_t uart_stm32f4_hw;
+
+BaseType_t uart_open(uart_t *uart, const uart_hw_t *hw, const uart_config_t *config);
+void uart_close(uart_t *uart);
+size_t uart_read(uart_t *uart, void *data, size_t length, TickType_t timeout);
+size_t uart_write(uart_t *uart, const void *data, size_t length, TickType_t timeout);
+BaseType_t uart_flush(uart_t *uart, TickType_t timeout);
+void uart_write_polled(uart_t *uart, const void *data, size_t length);
+void uart_get_stats(uart_t *uart, uart_stats_t *stats);
+BaseType_t uart_irq(USART_TypeDef *regs);
+
+#endif /* UART_DRIVER_H */
@@ -0,0 +1,145 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*-----------------------------------------------------------
+ * Application specific definitions for the host simulation, built with the
+ * GCC/Posix port.  The number of simulated cores can be set on the command
+ * line with -DconfigNUMBER_OF_CORES=n.
+ *
+ * See http://www.freertos.org/a00110.html
+ *----------------------------------------------------------*/
+
+#ifndef configNUMBER_OF_CORES
+	#define configNUMBER_OF_CORES		2
+#endif
+
+#define configUSE_PREEMPTION			1
+#define configUSE_TIME_SLICING			1
+#define configUSE_IDLE_HOOK				0
+#define configUSE_TICK_HOOK				0
+#ifndef configTICK_RATE_HZ
+	#define configTICK_RATE_HZ			( ( TickType_t ) 1000 )
+#endif
+#define configMAX_PRIORITIES			( 5 )
+#define configMINIMAL_STACK_SIZE		( ( unsigned short ) 256 )
+#define configTOTAL_HEAP_SIZE			( ( size_t ) ( 512 * 1024 ) )
+#define configMAX_TASK_NAME_LEN			( 10 )
+#define configUSE_TRACE_FACILITY		1
+#define configUSE_16_BIT_TICKS			0
+#define configIDLE_SHOULD_YIELD			1
+#define configUSE_MUTEXES				1
+#define configQUEUE_REGISTRY_SIZE		8
+#define configCHECK_FOR_STACK_OVERFLOW	0
+#define configUSE_RECURSIVE_MUTEXES		1
+#define configUSE_MALLOC_FAILED_HOOK	0
+#define configUSE_APPLICATION_TASK_TAG	0
+#define configUSE_COUNTING_SEMAPHORES	1
+#define configGENERATE_RUN_TIME_STATS	0
+#define configUSE_JOB_POOL				1
+#define configUSE_MULTI_WAIT			1
+#define configUSE_ASYNC					1
+#define configUSE_TASK_ARENA			1
+#define configUSE_MONOTONIC_CLOCK		1
+
+/* Trace recorder definitions.  The recorder adds to the cost of every kernel
+call, so it is only built in when requested with -DconfigUSE_TRACE_RECORDER=1.
+Timestamps are in nanoseconds on the host, so the budget is too. */
+#ifndef configUSE_TRACE_RECORDER
+	#define configUSE_TRACE_RECORDER		0
+#endif
+#define configTRACE_RECORDER_EVENT_SLOTS	8192
+#define configTRACE_RECORDER_NAME_SLOTS		32
+#define configTRACE_RECORDER_CYCLE_BUDGET	200
+
+/* Heap trace definitions.  Every pvPortMalloc() and vPortFree() is recorded,
+so it is only built in when requested with -DconfigUSE_HEAP_TRACE=1. */
+#ifndef configUSE_HEAP_TRACE
+	#define configUSE_HEAP_TRACE			0
+#endif
+#define configHEAP_TRACE_SLOTS			256
+#define configHEAP_TRACE_HISTORY		64
+#define configHEAP_TRACE_SAMPLE_PERIOD	16
+
+/* Heap locking.  Build with -DconfigHEAP_LOCKING=1 to mask interrupts and take
+the heap spinlock instead of suspending the scheduler. */
+#ifndef configHEAP_LOCKING
+	#define configHEAP_LOCKING				heapLOCKING_SUSPEND_SCHEDULER
+#endif
+#define configHEAP_ISR_BLOCK_COUNT		8
+#define configHEAP_ISR_BLOCK_SIZE		32
+
+/* Object slabs.  Build with -DconfigUSE_OBJECT_SLABS=1 to take tasks, queues
+and timers from object_slab.c, which then also provides the static memory of
+the idle and timer tasks. */
+#ifndef configUSE_OBJECT_SLABS
+	#define configUSE_OBJECT_SLABS			0
+#endif
+#define configSUPPORT_STATIC_ALLOCATION	configUSE_OBJECT_SLABS
+#define configSLAB_TASK_COUNT			16
+#define configSLAB_SMALL_STACK_COUNT	12
+#define configSLAB_LARGE_STACK_COUNT	4
+#define configSLAB_QUEUE_COUNT			16
+#define configSLAB_TIMER_COUNT			8
+
+/* Memory operations.  Build with -DconfigUSE_MEM_OPS=1 to copy queue items and
+stream buffer data with mem_ops.c instead of memcpy(). */
+#ifndef configUSE_MEM_OPS
+	#define configUSE_MEM_OPS				0
+#endif
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES 			0
+#define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
+
+/* Software timer definitions. */
+#define configUSE_TIMERS				1
+#define configTIMER_TASK_PRIORITY		( 2 )
+#define configTIMER_QUEUE_LENGTH		10
+#define configTIMER_TASK_STACK_DEPTH	( configMINIMAL_STACK_SIZE * 2 )
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+#define INCLUDE_vTaskPrioritySet		1
+#define INCLUDE_uxTaskPriorityGet		1
+#define INCLUDE_vTaskDelete				1
+#define INCLUDE_vTaskCleanUpResources	1
+#define INCLUDE_vTaskSuspend			1
+#define INCLUDE_vTaskDelayUntil			1
+#define INCLUDE_vTaskDelay				1
+#define INCLUDE_xTaskGetCurrentTaskHandle	1
+
+/* Normal assert() semantics without relying on the provision of an assert.h
+header file. */
+void vAssertCalled( const char *pcFile, unsigned long ulLine );
+#define configASSERT( x ) if( ( x ) == 0 ) vAssertCalled( __FILE__, __LINE__ )
+
+#endif /* FREERTOS_CONFIG_H */
+
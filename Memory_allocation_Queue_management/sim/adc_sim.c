@@ -0,0 +1,346 @@
+/**
+  ******************************************************************************
+  * @file    adc_sim.c
+  * @brief   Host simulation of the ADC acquisition pipeline (adc_pipeline.h)
+  * 		 against simulated ADC and DMA registers.  A host thread plays the
+  * 		 part of the timer, ADC and DMA controller, filling the memory
+  * 		 target of the stream with a block of synthetic scans at the
+  * 		 sample rate and raising its interrupt.  The pipeline is run at a
+  * 		 rising sample rate to find what it keeps up with, then with a
+  * 		 slow consumer so blocks are dropped.  Channel 0 carries a counter
+  * 		 that checks every block, and the others sines that check the
+  * 		 CMSIS-DSP decimating stage.  See README.md for the build command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include "adc_pipeline.h"
+#include "adc_dsp.h"
+#include "dma_hw_sim.h"
+#include "sim_common.h"
+
+#define SIM_CONTROLLER			(2)
+#define SIM_STREAM				(0)
+#define SIM_CHANNELS			(4)
+#define SIM_BUFFERS				(4)
+#define SIM_SCANS				(256)
+#define SIM_BLOCK_SIZE			(SIM_SCANS * SIM_CHANNELS * sizeof(uint16_t))
+#define SIM_DECIMATION			(4)
+#define SIM_TAPS				(4)
+#define SIM_SINE_PERIOD			(64)
+#define SIM_PHASE_TIME			(pdMS_TO_TICKS(1000))
+#define SIM_SLOW_RATE			(100000)
+#define SIM_SLOW_CONSUMER		(pdMS_TO_TICKS(4))
+#define SIM_POLL_NS				(20000)
+#define SIM_INTERRUPT			(portFIRST_USER_INTERRUPT)
+
+// Simulated registers
+static ADC_TypeDef sim_adc;
+
+// The simulated stream raises its transfer complete flag in LISR
+#define SIM_TCIF				(1UL << 5)
+
+static const uint32_t sim_rates[] = { 50000, 100000, 200000, 400000 };
+static const uint8_t sim_channels[SIM_CHANNELS] =
+{
+	ADC_Channel_0, ADC_Channel_1, ADC_Channel_4, ADC_Channel_8
+};
+
+static uint16_t sine[SIM_SINE_PERIOD];
+static volatile BaseType_t stop;
+static volatile BaseType_t triggering;
+static volatile BaseType_t filling;
+static volatile BaseType_t interrupt_pending;
+static volatile uint32_t sample_rate;
+static volatile uint32_t late_interrupts;
+
+// Checked by the consumer
+static volatile BaseType_t slow;
+static uint32_t corrupt, filter_errors;
+static uint32_t next_sequence;
+
+static void sim_adc_enable(const adc_pipeline_config_t *config, FunctionalState state)
+{
+	(void) config;
+	(void) state;
+}
+
+// Starts the simulated timer, or stops it once the controller has finished
+// the block it is on and its interrupt has been handled, so nothing is left
+// to fill a stream that is about to be stopped
+static void sim_adc_trigger(const adc_pipeline_config_t *config, FunctionalState state)
+{
+	struct timespec poll = { 0, SIM_POLL_NS };
+
+	if (state == ENABLE)
+	{
+		sample_rate = config->sample_rate;
+		__atomic_store_n(&triggering, pdTRUE, __ATOMIC_SEQ_CST);
+		return;
+	}
+
+	__atomic_store_n(&triggering, pdFALSE, __ATOMIC_SEQ_CST);
+	while ((__atomic_load_n(&filling, __ATOMIC_SEQ_CST) == pdTRUE) ||
+			(__atomic_load_n(&interrupt_pending, __ATOMIC_SEQ_CST) == pdTRUE))
+	{
+		nanosleep(&poll, NULL);
+	}
+}
+
+static const adc_hw_t sim_adc_hw =
+{
+	sim_adc_enable,
+	sim_adc_trigger,
+	ADC_ExternalTrigConv_T2_TRGO
+};
+
+static void add_ns(struct timespec *time, uint64_t ns)
+{
+	ns += (uint64_t) time->tv_nsec;
+	time->tv_sec += (time_t) (ns / 1000000000ULL);
+	time->tv_nsec = (long) (ns % 1000000000ULL);
+}
+
+// Fills the current memory target of the stream with a block of scans each
+// block period, then switches target and raises the transfer complete
+// interrupt, as the ADC and the controller in double buffer mode do.
+// Channel 0 of scan n is n, to 12 bits, and the others sines of 1, 3 and 5
+// cycles every SIM_SINE_PERIOD scans.
+static void *adc_controller_thread(void *params)
+{
+	DMA_Stream_TypeDef *regs = &sim_stream[SIM_CONTROLLER - 1][SIM_STREAM];
+	struct timespec poll = { 0, SIM_POLL_NS }, next;
+	BaseType_t running = pdFALSE;
+	uint32_t scan = 0;
+	uint16_t *target;
+
+	(void) params;
+
+	while (stop == pdFALSE)
+	{
+		__atomic_store_n(&filling, pdTRUE, __ATOMIC_SEQ_CST);
+
+		if ((__atomic_load_n(&triggering, __ATOMIC_SEQ_CST) == pdFALSE) || ((regs->CR & DMA_SxCR_EN) == 0))
+		{
+			__atomic_store_n(&filling, pdFALSE, __ATOMIC_SEQ_CST);
+			running = pdFALSE;
+			nanosleep(&poll, NULL);
+			continue;
+		}
+
+		if (running == pdFALSE)
+		{
+			running = pdTRUE;
+			scan = 0;
+			clock_gettime(CLOCK_MONOTONIC, &next);
+		}
+
+		// The block is ready once its last scan has been triggered
+		add_ns(&next, (SIM_SCANS * 1000000000ULL) / sample_rate);
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+
+		// On the target the interrupt is serviced well within the time it
+		// takes to fill a block.  The host may not run the interrupt that
+		// soon, so wait for it to return rather than switch target while it
+		// is finding the target that was filled.
+		if (__atomic_load_n(&interrupt_pending, __ATOMIC_SEQ_CST) == pdTRUE)
+		{
+			late_interrupts++;
+			while (__atomic_load_n(&interrupt_pending, __ATOMIC_SEQ_CST) == pdTRUE)
+			{
+				nanosleep(&poll, NULL);
+			}
+		}
+
+		target = (uint16_t *) (uintptr_t) (((regs->CR & DMA_SxCR_CT) != 0) ? regs->M1AR : regs->M0AR);
+		for (uint32_t i = 0; i < SIM_SCANS; i++, scan++)
+		{
+			target[0] = (uint16_t) (scan & 0xFFF);
+			target[1] = sine[scan % SIM_SINE_PERIOD];
+			target[2] = sine[(scan * 3) % SIM_SINE_PERIOD];
+			target[3] = sine[(scan * 5) % SIM_SINE_PERIOD];
+			target += SIM_CHANNELS;
+		}
+
+		__atomic_xor_fetch(&regs->CR, DMA_SxCR_CT, __ATOMIC_SEQ_CST);
+
+		__atomic_store_n(&interrupt_pending, pdTRUE, __ATOMIC_SEQ_CST);
+		__atomic_or_fetch(&sim_controller[SIM_CONTROLLER - 1].LISR, SIM_TCIF, __ATOMIC_SEQ_CST);
+
+		vPortGenerateSimulatedInterrupt(SIM_INTERRUPT);
+
+		__atomic_store_n(&filling, pdFALSE, __ATOMIC_SEQ_CST);
+	}
+
+	return NULL;
+}
+
+static uint32_t dma_interrupt_handler(void)
+{
+	BaseType_t woken = dma_manager_irq(SIM_CONTROLLER, SIM_STREAM);
+
+	__atomic_store_n(&interrupt_pending, pdFALSE, __ATOMIC_SEQ_CST);
+
+	return (uint32_t) woken;
+}
+
+// Checks the counter of channel 0 against the block's sequence number, and
+// that each sine, which has whole cycles in a block, still averages half of
+// full scale after decimating.  The filter reaches back into the block
+// before, so the sines are only checked when that block was processed too.
+static void consumer(const adc_block_t *block, void *context)
+{
+	uint32_t scan = block->sequence * block->scans;
+	BaseType_t follows = ((block->sequence != 0) && (block->sequence == next_sequence)) ? pdTRUE : pdFALSE;
+
+	(void) context;
+
+	next_sequence = block->sequence + 1;
+
+	for (uint32_t i = 0; i < block->scans; i++, scan++)
+	{
+		if (block->samples[i * block->channels] != (scan & 0xFFF))
+		{
+			corrupt++;
+			break;
+		}
+	}
+
+	if (block->output_count != (block->scans / SIM_DECIMATION))
+	{
+		filter_errors++;
+	}
+
+	for (uint32_t channel = 1; (channel < block->channels) && (follows == pdTRUE); channel++)
+	{
+		float sum = 0.0f;
+
+		for (uint32_t i = 0; i < block->output_count; i++)
+		{
+			sum += block->output[channel][i];
+		}
+
+		if (fabsf((sum / block->output_count) - 0.5f) > 0.001f)
+		{
+			filter_errors++;
+		}
+	}
+
+	if (slow == pdTRUE)
+	{
+		vTaskDelay(SIM_SLOW_CONSUMER);
+	}
+}
+
+static void print_phase(const adc_pipeline_stats_t *stats, uint32_t rate)
+{
+	sim_printf("cores: %d, %s %6lu scans/s, blocks: %4lu, dropped: %4lu, errors: %lu, %7lu samples/s, "
+			"process mean/max: %lu/%lu us, latency max: %lu us, load: %lu.%lu%%, corrupt: %lu, "
+			"filter errors: %lu, late interrupts: %lu\n",
+			configNUMBER_OF_CORES, (slow == pdTRUE) ? "slow," : "     ", (unsigned long) rate,
+			(unsigned long) stats->blocks, (unsigned long) stats->dropped, (unsigned long) stats->errors,
+			(unsigned long) stats->samples_per_second, (unsigned long) stats->process_mean_us,
+			(unsigned long) stats->process_max_us, (unsigned long) stats->latency_max_us,
+			(unsigned long) (stats->load / 10), (unsigned long) (stats->load % 10),
+			(unsigned long) corrupt, (unsigned long) filter_errors, (unsigned long) late_interrupts);
+}
+
+// Runs the pipeline for a second at each rate, then with a slow consumer
+static void main_task(void *params)
+{
+	static adc_pipeline_t pipeline;
+	static float work_buffers[SIM_CHANNELS][SIM_SCANS];
+	float *work[SIM_CHANNELS];
+	uint8_t *buffers[SIM_BUFFERS];
+	static adc_fir_decimator_t decimator;
+	static float32_t coeffs[SIM_TAPS] = { 0.25f, 0.25f, 0.25f, 0.25f };
+	static float32_t state[SIM_CHANNELS * (SIM_TAPS + SIM_SCANS - 1)];
+	static float32_t output[SIM_SCANS / SIM_DECIMATION];
+	adc_stage_t *stages[] = { &decimator.stage };
+	adc_pipeline_config_t config;
+	adc_pipeline_stats_t stats;
+	pthread_t controller;
+
+	(void) params;
+
+	// The stream holds 32 bit addresses, so the buffers must be in the low
+	// 4GB of the host's address space
+	for (uint32_t i = 0; i < SIM_BUFFERS; i++)
+	{
+		buffers[i] = mmap(NULL, SIM_BLOCK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+		configASSERT(buffers[i] != MAP_FAILED);
+	}
+
+	for (uint32_t channel = 0; channel < SIM_CHANNELS; channel++)
+	{
+		work[channel] = work_buffers[channel];
+	}
+
+	for (uint32_t i = 0; i < SIM_SINE_PERIOD; i++)
+	{
+		sine[i] = (uint16_t) lroundf(2048.0f + (1500.0f * sinf((2.0f * (float) M_PI * (float) i) / SIM_SINE_PERIOD)));
+	}
+
+	memset(&config, 0, sizeof(config));
+	config.regs = &sim_adc;
+	config.channels = sim_channels;
+	config.channel_count = SIM_CHANNELS;
+	config.sample_time = ADC_SampleTime_15Cycles;
+	config.dma_controller = SIM_CONTROLLER;
+	config.dma_stream = SIM_STREAM;
+	config.dma_channel = DMA_Channel_0;
+	config.buffers = buffers;
+	config.buffer_count = SIM_BUFFERS;
+	config.scans_per_block = SIM_SCANS;
+	config.stages = stages;
+	config.stage_count = 1;
+	config.work = work;
+	config.scale = 1.0f / 4096.0f;
+	config.consumer = consumer;
+	config.priority = configMAX_PRIORITIES - 2;
+	config.stack_depth = SIM_STACK_SIZE;
+
+	pthread_create(&controller, NULL, adc_controller_thread, NULL);
+
+	for (uint32_t phase = 0; phase <= (sizeof(sim_rates) / sizeof(sim_rates[0])); phase++)
+	{
+		slow = (phase == (sizeof(sim_rates) / sizeof(sim_rates[0]))) ? pdTRUE : pdFALSE;
+		config.sample_rate = (slow == pdTRUE) ? SIM_SLOW_RATE : sim_rates[phase];
+		corrupt = 0;
+		filter_errors = 0;
+		late_interrupts = 0;
+		next_sequence = 0;
+
+		// A fresh filter state, as the sequence starts again
+		configASSERT(adc_fir_decimator_init(&decimator, SIM_CHANNELS, SIM_DECIMATION, coeffs, SIM_TAPS,
+				state, SIM_SCANS, output) == pdPASS);
+
+		configASSERT(adc_pipeline_start(&pipeline, &sim_adc_hw, &config) == pdPASS);
+		vTaskDelay(SIM_PHASE_TIME);
+		adc_pipeline_get_stats(&pipeline, &stats);
+		adc_pipeline_stop(&pipeline);
+
+		print_phase(&stats, config.sample_rate);
+	}
+
+	stop = pdTRUE;
+	pthread_join(controller, NULL);
+
+	exit(0);
+}
+
+// driver funtion
+int main(void)
+{
+	dma_manager_init(&sim_dma_hw);
+	vPortSetInterruptHandler(SIM_INTERRUPT, dma_interrupt_handler);
+
+	sim_run(main_task, "Main", configMAX_PRIORITIES - 1);
+}
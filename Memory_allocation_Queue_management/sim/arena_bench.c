@@ -0,0 +1,215 @@
+/**
+  ******************************************************************************
+  * @file    arena_bench.c
+  * @brief   Host simulation comparing task arenas (task_arena.h) with
+  * 		 heap_4.  Worker tasks repeatedly build a transient list of
+  * 		 nodes then release it, while keeping a few long lived objects
+  * 		 on the heap.  The run is made once with the nodes taken from
+  * 		 the heap and once with them taken from an arena, and the
+  * 		 allocation latency and heap fragmentation are printed.  See
+  * 		 README.md for the build command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_arena.h"
+#include "sim_common.h"
+
+#define BENCH_WORKERS			(4)
+#define BENCH_ROUNDS			(2000)
+#define BENCH_NODES				(32)
+#define BENCH_KEPT				(16)
+#define BENCH_ARENA_SIZE		(BENCH_NODES * 160)
+#define BENCH_PRIORITY			(1)
+
+typedef struct bench_node
+{
+	struct bench_node *next;
+	uint32_t payload[];
+} bench_node;
+
+typedef struct
+{
+	uint64_t allocations;
+	uint64_t total_ns;
+	uint64_t worst_ns;
+	uint64_t free_blocks;
+	uint64_t stranded_bytes;
+	uint64_t samples;
+} bench_result;
+
+static TaskHandle_t controller;
+static BaseType_t use_arena;
+static bench_result result;
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+
+// A small deterministic generator so both runs see the same sizes
+static uint32_t next_random(uint32_t *state)
+{
+	*state = (*state * 1103515245UL) + 12345UL;
+	return *state >> 16;
+}
+
+static void record_latency(uint64_t ns)
+{
+	taskENTER_CRITICAL();
+	{
+		result.allocations++;
+		result.total_ns += ns;
+		if (ns > result.worst_ns)
+		{
+			result.worst_ns = ns;
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+
+// Samples the number of free blocks, and the free bytes stranded in blocks
+// other than the largest
+static void record_fragmentation(void)
+{
+	HeapStats_t stats;
+
+	vPortGetHeapStats(&stats);
+
+	taskENTER_CRITICAL();
+	{
+		result.samples++;
+		result.free_blocks += stats.xNumberOfFreeBlocks;
+		result.stranded_bytes += stats.xAvailableHeapSpaceInBytes - stats.xSizeOfLargestFreeBlockInBytes;
+	}
+	taskEXIT_CRITICAL();
+}
+
+static void worker_task(void *params)
+{
+	uint32_t state = (uint32_t) (uintptr_t) params;
+	void *kept[BENCH_KEPT] = { NULL };
+	bench_node *list, *node;
+	TaskArenaMark_t mark = 0;
+	uint64_t start;
+	uint32_t round, i;
+
+	if (use_arena != pdFALSE)
+	{
+		configASSERT(xTaskArenaCreate(BENCH_ARENA_SIZE) == pdPASS);
+	}
+
+	for (round = 0; round < BENCH_ROUNDS; round++)
+	{
+		list = NULL;
+
+		if (use_arena != pdFALSE)
+		{
+			mark = xTaskArenaMark();
+		}
+
+		// Build the transient list
+		for (i = 0; i < BENCH_NODES; i++)
+		{
+			size_t size = sizeof(bench_node) + (next_random(&state) % 128);
+
+			start = now_ns();
+			node = (use_arena != pdFALSE) ? pvTaskArenaAlloc(size) : pvPortMalloc(size);
+			record_latency(now_ns() - start);
+
+			configASSERT(node != NULL);
+			node->next = list;
+			list = node;
+		}
+
+		// Replace one long lived object, which lands between the nodes on
+		// the heap
+		vPortFree(kept[round % BENCH_KEPT]);
+		kept[round % BENCH_KEPT] = pvPortMalloc(24 + (next_random(&state) % 40));
+
+		// Release the transient list
+		if (use_arena != pdFALSE)
+		{
+			vTaskArenaRewind(mark);
+		}
+		else
+		{
+			while (list != NULL)
+			{
+				node = list->next;
+				vPortFree(list);
+				list = node;
+			}
+		}
+
+		record_fragmentation();
+		taskYIELD();
+	}
+
+	for (i = 0; i < BENCH_KEPT; i++)
+	{
+		vPortFree(kept[i]);
+	}
+
+	// The arena is released with the task
+	xTaskNotifyGive(controller);
+	vTaskDelete(NULL);
+}
+
+static void run(const char *method)
+{
+	uint32_t i;
+
+	memset(&result, 0, sizeof(result));
+
+	for (i = 0; i < BENCH_WORKERS; i++)
+	{
+		xTaskCreate(worker_task, "Worker", SIM_STACK_SIZE, (void *) (uintptr_t) (i + 1), BENCH_PRIORITY, NULL);
+	}
+
+	for (i = 0; i < BENCH_WORKERS; i++)
+	{
+		ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+	}
+
+	// Let the idle task free the workers
+	vTaskDelay(10);
+
+	sim_printf("cores: %d, %-7s alloc mean %3lu ns, worst %6lu ns, free blocks %3lu, stranded %5lu bytes, heap free after %lu\n",
+			configNUMBER_OF_CORES, method,
+			(unsigned long) (result.total_ns / result.allocations),
+			(unsigned long) result.worst_ns,
+			(unsigned long) (result.free_blocks / result.samples),
+			(unsigned long) (result.stranded_bytes / result.samples),
+			(unsigned long) xPortGetFreeHeapSize());
+}
+
+// Runs each method in turn above the priority of the workers
+static void bench_task(void *params)
+{
+	(void) params;
+
+	controller = xTaskGetCurrentTaskHandle();
+
+	use_arena = pdFALSE;
+	run("heap_4,");
+	use_arena = pdTRUE;
+	run("arena,");
+
+	exit(0);
+}
+
+// driver funtion
+int main(void)
+{
+	sim_run(bench_task, "Bench", BENCH_PRIORITY + 1);
+}
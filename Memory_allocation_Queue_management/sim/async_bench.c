@@ -0,0 +1,136 @@
+/**
+  ******************************************************************************
+  * @file    async_bench.c
+  * @brief   Host simulation comparing async contexts (async.h) with full
+  * 		 tasks.  A token is passed around a ring of contexts, then around
+  * 		 a ring of tasks, and the number of hops per second is printed
+  * 		 with the RAM used by each context and each task.  See README.md
+  * 		 for the build command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "async.h"
+#include "sim_common.h"
+
+#define BENCH_RING_SIZE			(128)
+#define BENCH_RUN_TICKS			(pdMS_TO_TICKS(1000))
+#define BENCH_PRIORITY			(1)
+
+static AsyncContext_t ring_context[BENCH_RING_SIZE];
+static TaskHandle_t ring_task[BENCH_RING_SIZE];
+static volatile uint32_t hops;
+static volatile BaseType_t stop;
+
+static void print_result(const char *method, size_t bytes_each, TickType_t ticks)
+{
+	sim_printf("cores: %d, %-10s RAM each: %4lu bytes, hops per second: %lu\n", configNUMBER_OF_CORES, method,
+			(unsigned long) bytes_each, (unsigned long) (((uint64_t) hops * configTICK_RATE_HZ) / ticks));
+}
+
+// Waits for the token then passes it to the next context in the ring
+static void ring_context_function(AsyncContext_t *context)
+{
+	uint32_t index = (uint32_t) (uintptr_t) pvAsyncGetParameters(context);
+	uint32_t value;
+	BaseType_t result;
+
+	asyncBEGIN(context);
+
+	while (stop == pdFALSE)
+	{
+		asyncNOTIFY_WAIT(context, portMAX_DELAY, &value, &result);
+
+		if (result == pdPASS)
+		{
+			hops++;
+			vAsyncNotify(&ring_context[(index + 1) % BENCH_RING_SIZE], 1);
+		}
+	}
+
+	asyncEND(context);
+}
+
+// The same as ring_context_function(), using a task per ring position
+static void ring_task_function(void *params)
+{
+	uint32_t index = (uint32_t) (uintptr_t) params;
+
+	while (stop == pdFALSE)
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		hops++;
+		xTaskNotifyGive(ring_task[(index + 1) % BENCH_RING_SIZE]);
+	}
+
+	vTaskSuspend(NULL);
+}
+
+static void bench_contexts(void)
+{
+	AsyncExecutorHandle_t executor;
+	uint32_t i;
+
+	executor = xAsyncExecutorCreate(4, SIM_STACK_SIZE, BENCH_PRIORITY);
+	configASSERT(executor != NULL);
+
+	for (i = 0; i < BENCH_RING_SIZE; i++)
+	{
+		vAsyncContextStart(executor, &ring_context[i], ring_context_function, (void *) (uintptr_t) i);
+	}
+
+	hops = 0;
+	vAsyncNotify(&ring_context[0], 1);
+	vTaskDelay(BENCH_RUN_TICKS);
+	print_result("contexts,", sizeof(AsyncContext_t), BENCH_RUN_TICKS);
+
+	// Let the contexts finish before the tasks start
+	stop = pdTRUE;
+	for (i = 0; i < BENCH_RING_SIZE; i++)
+	{
+		vAsyncNotify(&ring_context[i], 1);
+	}
+	vTaskDelay(2);
+}
+
+static void bench_tasks(void)
+{
+	uint32_t i;
+
+	stop = pdFALSE;
+
+	for (i = 0; i < BENCH_RING_SIZE; i++)
+	{
+		xTaskCreate(ring_task_function, "Ring", configMINIMAL_STACK_SIZE, (void *) (uintptr_t) i, BENCH_PRIORITY, &ring_task[i]);
+		configASSERT(ring_task[i] != NULL);
+	}
+
+	hops = 0;
+	xTaskNotifyGive(ring_task[0]);
+	vTaskDelay(BENCH_RUN_TICKS);
+
+	// A task needs its control block and a stack of at least
+	// configMINIMAL_STACK_SIZE words
+	print_result("tasks,", sizeof(StaticTask_t) + (configMINIMAL_STACK_SIZE * sizeof(StackType_t)), BENCH_RUN_TICKS);
+}
+
+// Runs each benchmark in turn above the priority of the ring
+static void bench_task(void *params)
+{
+	(void) params;
+
+	bench_contexts();
+	bench_tasks();
+
+	exit(0);
+}
+
+// driver funtion
+int main(void)
+{
+	sim_run(bench_task, "Bench", BENCH_PRIORITY + 1);
+}
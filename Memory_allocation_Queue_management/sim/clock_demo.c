@@ -0,0 +1,103 @@
+/**
+  ******************************************************************************
+  * @file    clock_demo.c
+  * @brief   Host simulation of the monotonic clock (ullTaskGetMonotonicTimeUs()).
+  * 		 A task with a period that is not a whole number of ticks runs
+  * 		 with vTaskDelayUntilUs(), and its wake times are compared with
+  * 		 the host clock, while other tasks check that the clock never goes
+  * 		 backwards.  See README.md for the build command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "sim_common.h"
+
+#define CLOCK_PERIOD_US			(2500)
+#define CLOCK_PERIODS			(400)
+#define CLOCK_READERS			(2)
+
+static volatile uint32_t backwards;
+
+static uint64_t host_time_us(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t) now.tv_sec * 1000000ULL) + ((uint64_t) now.tv_nsec / 1000ULL);
+}
+
+// Reads the clock continuously, counting any read earlier than the last
+static void reader_task(void *params)
+{
+	uint64_t last = 0, now;
+
+	(void) params;
+
+	for(;;)
+	{
+		now = ullTaskGetMonotonicTimeNs();
+
+		if (now < last)
+		{
+			backwards++;
+		}
+
+		last = now;
+	}
+}
+
+// Wakes every CLOCK_PERIOD_US and measures how late each wake is
+static void periodic_task(void *params)
+{
+	uint64_t wake_us, host_start_us, late_us, total_late_us = 0, max_late_us = 0;
+	int64_t drift_us;
+	uint32_t period;
+
+	(void) params;
+
+	wake_us = ullTaskGetMonotonicTimeUs();
+	host_start_us = host_time_us() - wake_us;
+
+	for (period = 0; period < CLOCK_PERIODS; period++)
+	{
+		vTaskDelayUntilUs(&wake_us, CLOCK_PERIOD_US);
+
+		late_us = ullTaskGetMonotonicTimeUs() - wake_us;
+		total_late_us += late_us;
+
+		if (late_us > max_late_us)
+		{
+			max_late_us = late_us;
+		}
+	}
+
+	// The kernel clock follows the tick thread, which can fall behind the host
+	drift_us = (int64_t) (host_time_us() - host_start_us) - (int64_t) ullTaskGetMonotonicTimeUs();
+
+	sim_print_lock();
+	{
+		printf("cores: %d, tick rate: %d Hz, period: %d us, late by mean %lu us, max %lu us, "
+				"drift from host %ld us, backwards reads: %lu\n",
+				configNUMBER_OF_CORES, configTICK_RATE_HZ, CLOCK_PERIOD_US,
+				(unsigned long) (total_late_us / CLOCK_PERIODS), (unsigned long) max_late_us,
+				(long) drift_us, (unsigned long) backwards);
+		exit(0);
+	}
+	sim_print_unlock();
+}
+
+// driver funtion
+int main(void)
+{
+	for (uint32_t reader = 0; reader < CLOCK_READERS; reader++)
+	{
+		xTaskCreate(reader_task, "Reader", SIM_STACK_SIZE, NULL, 1, NULL);
+	}
+
+	sim_run(periodic_task, "Periodic", 2);
+}
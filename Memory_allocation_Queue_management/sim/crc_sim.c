@@ -0,0 +1,652 @@
+/**
+  ******************************************************************************
+  * @file    crc_sim.c
+  * @brief   Host simulation of the CRC service (crc_unit.h) against a
+  * 		 simulated CRC unit and DMA stream.  A host thread plays the DMA
+  * 		 controller, moving words or packed bytes from the stream's source
+  * 		 into the unit.  The software CRCs are checked against bit at a
+  * 		 time references and the standard check values, then the service
+  * 		 against the references for every variant at many lengths and
+  * 		 alignments, fed by the CPU and by DMA, from a set CRC, across
+  * 		 buffers longer than a stream can move at once, after a transfer
+  * 		 error, and from three tasks at once.  Last it prints the cycles
+  * 		 per byte of the software CRCs.  See README.md for the build
+  * 		 command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+// Before the CMSIS headers, whose __I would break the intrinsics
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "crc_unit.h"
+#include "dma_hw_sim.h"
+#include "sim_common.h"
+
+#define SIM_DMA_CONTROLLER		(2)
+#define SIM_DMA_STREAM			(0)
+#define SIM_DMA_THRESHOLD		(64)
+#define SIM_INTERRUPT			(portFIRST_USER_INTERRUPT)
+#define SIM_POLL_NS				(20000)
+#define SIM_CHECK_LENGTH		(300)
+#define SIM_OFFSETS				(8)
+#define SIM_LARGE_LENGTH		(600000)
+#define SIM_SHARED_TASKS		(3)
+#define SIM_SHARED_TICKS		(pdMS_TO_TICKS(500))
+#define SIM_SHARED_MAX_LENGTH	(4096)
+#define SIM_VARIANTS			(3)
+#define BENCH_RUNS				(200)
+#define BENCH_LENGTH			(4096)
+
+// Where the transfer complete and transfer error flags of stream 0 are in
+// LISR
+#define SIM_TCIF				(1UL << 5)
+#define SIM_TEIF				(1UL << 3)
+
+#define SIM_POLYNOMIAL			(0x04C11DB7UL)
+#define SIM_POLYNOMIAL_REFLECTED	(0xEDB88320UL)
+
+// The streams hold 32 bit addresses, so the data register and every buffer
+// are in the low 4GB of the host's address space
+typedef struct
+{
+	crc_unit_t unit;
+	volatile uint32_t data_register;
+	uint8_t check[SIM_CHECK_LENGTH + SIM_OFFSETS];
+	uint8_t shared[SIM_SHARED_TASKS][SIM_SHARED_MAX_LENGTH + SIM_OFFSETS];
+	uint8_t large[SIM_LARGE_LENGTH + SIM_OFFSETS];
+} sim_memory_t;
+
+static sim_memory_t *memory;
+
+// Simulated registers
+static volatile uint32_t sim_crc = 0xFFFFFFFF;
+static volatile BaseType_t sim_crc_enabled;
+
+static const char *const variant_name[SIM_VARIANTS] = { "STM32", "MPEG-2", "CRC-32" };
+
+static volatile BaseType_t stop_dma, fail_next;
+static volatile uint32_t dma_transfers, dma_config_errors, disabled_writes;
+static volatile uint32_t running_tasks;
+static uint32_t checks, failures;
+static uint32_t shared_calculations[SIM_SHARED_TASKS], shared_failures;
+static uint32_t random_state = 1;
+
+static uint32_t sim_reflect(uint32_t value)
+{
+	uint32_t reflected = 0;
+
+	for (uint32_t bit = 0; bit < 32; bit++)
+	{
+		reflected = (reflected << 1) | ((value >> bit) & 1);
+	}
+
+	return reflected;
+}
+
+// A word written to the unit is XORed into its register, which is then
+// shifted 32 times, most significant bit first
+static void sim_crc_step(uint32_t word)
+{
+	uint32_t crc = sim_crc ^ word;
+
+	if (sim_crc_enabled == pdFALSE)
+	{
+		disabled_writes++;
+	}
+
+	for (uint32_t bit = 0; bit < 32; bit++)
+	{
+		crc = ((crc & 0x80000000UL) != 0) ? ((crc << 1) ^ SIM_POLYNOMIAL) : (crc << 1);
+	}
+
+	sim_crc = crc;
+}
+
+static void sim_crc_enable(FunctionalState state)
+{
+	sim_crc_enabled = (state == ENABLE) ? pdTRUE : pdFALSE;
+}
+
+static void sim_crc_reset(void)
+{
+	sim_crc = 0xFFFFFFFF;
+}
+
+static void sim_crc_write(const uint8_t *data, uint32_t words, crc_input_t input)
+{
+	uint32_t word;
+
+	for (; words > 0; words--, data += 4)
+	{
+		memcpy(&word, data, sizeof(word));
+
+		if (input == CRC_INPUT_BYTES_MSB)
+		{
+			word = __builtin_bswap32(word);
+		}
+		else if (input == CRC_INPUT_BYTES_LSB)
+		{
+			word = sim_reflect(word);
+		}
+
+		sim_crc_step(word);
+	}
+}
+
+static uint32_t sim_crc_read(void)
+{
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	return sim_crc;
+}
+
+static crc_hw_t sim_crc_hw =
+{
+	sim_crc_enable,
+	sim_crc_reset,
+	sim_crc_write,
+	sim_crc_read,
+	NULL
+};
+
+// Moves each transfer the stream is enabled for into the unit, as the
+// controller does in memory to memory mode: words read one at a time, or
+// bytes read one at a time and packed into words by the FIFO.  The stream
+// must read from its peripheral port with increment, and write whole words
+// to the data register from its memory port without.
+static void *dma_thread(void *params)
+{
+	DMA_Stream_TypeDef *stream = &sim_stream[SIM_DMA_CONTROLLER - 1][SIM_DMA_STREAM];
+	struct timespec poll = { 0, SIM_POLL_NS };
+	const uint8_t *source;
+	uint32_t cr, words, word, flag;
+
+	(void) params;
+
+	while (stop_dma == pdFALSE)
+	{
+		if ((stream->CR & DMA_SxCR_EN) == 0)
+		{
+			nanosleep(&poll, NULL);
+			continue;
+		}
+
+		cr = stream->CR;
+		source = (const uint8_t *) (uintptr_t) stream->PAR;
+		flag = SIM_TCIF;
+
+		if (((cr & DMA_SxCR_DIR) != DMA_DIR_MemoryToMemory) || ((cr & DMA_SxCR_PINC) == 0) ||
+				((cr & DMA_SxCR_MINC) != 0) || ((cr & DMA_SxCR_MSIZE) != DMA_MemoryDataSize_Word) ||
+				((stream->FCR & DMA_SxFCR_DMDIS) == 0) ||
+				(stream->M0AR != (uint32_t) (uintptr_t) &memory->data_register) ||
+				(((cr & DMA_SxCR_PSIZE) == DMA_PeripheralDataSize_Word) && (((uintptr_t) source & 3) != 0)) ||
+				(((cr & DMA_SxCR_PSIZE) == DMA_PeripheralDataSize_Byte) && ((stream->NDTR & 3) != 0)))
+		{
+			dma_config_errors++;
+			flag = SIM_TEIF;
+		}
+		else if (fail_next == pdTRUE)
+		{
+			fail_next = pdFALSE;
+			flag = SIM_TEIF;
+		}
+		else
+		{
+			words = ((cr & DMA_SxCR_PSIZE) == DMA_PeripheralDataSize_Word) ? stream->NDTR : (stream->NDTR / 4);
+
+			for (; words > 0; words--, source += 4)
+			{
+				memcpy(&word, source, sizeof(word));
+				sim_crc_step(word);
+			}
+		}
+
+		dma_transfers++;
+		stream->NDTR = 0;
+		__atomic_and_fetch(&stream->CR, ~DMA_SxCR_EN, __ATOMIC_SEQ_CST);
+		__atomic_or_fetch(&sim_controller[SIM_DMA_CONTROLLER - 1].LISR, flag, __ATOMIC_SEQ_CST);
+		vPortGenerateSimulatedInterrupt(SIM_INTERRUPT);
+	}
+
+	return NULL;
+}
+
+static uint32_t dma_interrupt_handler(void)
+{
+	return (uint32_t) dma_manager_irq(SIM_DMA_CONTROLLER, SIM_DMA_STREAM);
+}
+
+// A small deterministic generator, so every run sees the same data
+static uint32_t next_random(void)
+{
+	random_state = (random_state * 1103515245UL) + 12345UL;
+	return random_state >> 16;
+}
+
+static void fill(uint8_t *data, size_t length)
+{
+	for (size_t i = 0; i < length; i++)
+	{
+		data[i] = (uint8_t) next_random();
+	}
+}
+
+static uint32_t reference_msb(uint32_t crc, uint8_t byte)
+{
+	crc ^= (uint32_t) byte << 24;
+
+	for (uint32_t bit = 0; bit < 8; bit++)
+	{
+		crc = ((crc & 0x80000000UL) != 0) ? ((crc << 1) ^ SIM_POLYNOMIAL) : (crc << 1);
+	}
+
+	return crc;
+}
+
+static uint32_t reference_lsb(uint32_t crc, uint8_t byte)
+{
+	crc ^= byte;
+
+	for (uint32_t bit = 0; bit < 8; bit++)
+	{
+		crc = ((crc & 1) != 0) ? ((crc >> 1) ^ SIM_POLYNOMIAL_REFLECTED) : (crc >> 1);
+	}
+
+	return crc;
+}
+
+// The variants a bit at a time: CRC_VARIANT_STM32 takes each whole word last
+// byte first, as the unit does with a little endian word
+static uint32_t reference(crc_variant_t variant, uint32_t initial, const uint8_t *data, size_t length)
+{
+	uint32_t crc = initial;
+	size_t i = 0;
+
+	if (variant == CRC_VARIANT_32)
+	{
+		crc ^= 0xFFFFFFFF;
+
+		for (; i < length; i++)
+		{
+			crc = reference_lsb(crc, data[i]);
+		}
+
+		return crc ^ 0xFFFFFFFF;
+	}
+
+	if (variant == CRC_VARIANT_STM32)
+	{
+		for (; (i + 4) <= length; i += 4)
+		{
+			for (uint32_t byte = 4; byte > 0; byte--)
+			{
+				crc = reference_msb(crc, data[i + byte - 1]);
+			}
+		}
+	}
+
+	for (; i < length; i++)
+	{
+		crc = reference_msb(crc, data[i]);
+	}
+
+	return crc;
+}
+
+static void check(uint32_t got, uint32_t expected, const char *what, crc_variant_t variant, size_t length,
+		uint32_t offset)
+{
+	checks++;
+
+	if (got != expected)
+	{
+		if (failures < 10)
+		{
+			printf("%s %s: %lu bytes at offset %lu gave 0x%08lX, expected 0x%08lX\n", what, variant_name[variant],
+					(unsigned long) length, (unsigned long) offset, (unsigned long) got, (unsigned long) expected);
+		}
+
+		failures++;
+	}
+}
+
+static uint32_t service(crc_variant_t variant, uint32_t initial, const uint8_t *data, size_t length)
+{
+	uint32_t crc = 0;
+
+	if (crc_calculate(&memory->unit, variant, initial, data, length, &crc, portMAX_DELAY) == pdFAIL)
+	{
+		failures++;
+	}
+
+	return crc;
+}
+
+// The data before a split of CRC_VARIANT_STM32 must be whole words
+static size_t split_point(crc_variant_t variant, size_t length)
+{
+	size_t split = (length > 0) ? (next_random() % (length + 1)) : 0;
+
+	return (variant == CRC_VARIANT_STM32) ? (split & ~(size_t) 3) : split;
+}
+
+// The software CRCs against the references, whole and in two parts, and the
+// standard check values
+static void check_soft(void)
+{
+	static const uint8_t digits[] = "123456789";
+	uint8_t *data;
+	uint32_t expected;
+	size_t split;
+
+	check(crc_soft_calculate(CRC_VARIANT_32, crc_initial(CRC_VARIANT_32), digits, 9), 0xCBF43926UL,
+			"soft check value", CRC_VARIANT_32, 9, 0);
+	check(crc_soft_calculate(CRC_VARIANT_MPEG2, crc_initial(CRC_VARIANT_MPEG2), digits, 9), 0x0376E6E7UL,
+			"soft check value", CRC_VARIANT_MPEG2, 9, 0);
+
+	for (uint32_t variant = 0; variant < SIM_VARIANTS; variant++)
+	{
+		for (uint32_t offset = 0; offset < SIM_OFFSETS; offset++)
+		{
+			for (size_t length = 0; length <= SIM_CHECK_LENGTH; length++)
+			{
+				data = &memory->check[offset];
+				fill(data, length);
+				expected = reference((crc_variant_t) variant, crc_initial((crc_variant_t) variant), data, length);
+				check(crc_soft_calculate((crc_variant_t) variant, crc_initial((crc_variant_t) variant), data, length),
+						expected, "soft", (crc_variant_t) variant, length, offset);
+
+				split = split_point((crc_variant_t) variant, length);
+				check(crc_soft_calculate((crc_variant_t) variant,
+						crc_soft_calculate((crc_variant_t) variant, crc_initial((crc_variant_t) variant), data, split),
+						&data[split], length - split), expected, "soft split", (crc_variant_t) variant, length, offset);
+			}
+		}
+	}
+}
+
+// The service against the references, below and above the DMA threshold,
+// whole and from the CRC of a first part, then across buffers longer than a
+// stream moves at once
+static void check_service(void)
+{
+	static const uint8_t digits[] = "123456789";
+	uint8_t *data;
+	uint32_t expected;
+	size_t split;
+
+	check(service(CRC_VARIANT_32, crc_initial(CRC_VARIANT_32), digits, 9), 0xCBF43926UL, "service check value",
+			CRC_VARIANT_32, 9, 0);
+	check(service(CRC_VARIANT_MPEG2, crc_initial(CRC_VARIANT_MPEG2), digits, 9), 0x0376E6E7UL,
+			"service check value", CRC_VARIANT_MPEG2, 9, 0);
+
+	for (uint32_t variant = 0; variant < SIM_VARIANTS; variant++)
+	{
+		for (uint32_t offset = 0; offset < SIM_OFFSETS; offset++)
+		{
+			for (size_t length = 0; length <= SIM_CHECK_LENGTH; length++)
+			{
+				data = &memory->check[offset];
+				fill(data, length);
+				expected = reference((crc_variant_t) variant, crc_initial((crc_variant_t) variant), data, length);
+				check(service((crc_variant_t) variant, crc_initial((crc_variant_t) variant), data, length), expected,
+						"service", (crc_variant_t) variant, length, offset);
+
+				split = split_point((crc_variant_t) variant, length);
+				check(service((crc_variant_t) variant,
+						service((crc_variant_t) variant, crc_initial((crc_variant_t) variant), data, split),
+						&data[split], length - split), expected, "service split", (crc_variant_t) variant, length,
+						offset);
+			}
+		}
+	}
+
+	for (uint32_t variant = 0; variant < SIM_VARIANTS; variant++)
+	{
+		for (uint32_t offset = 0; offset < 4; offset++)
+		{
+			data = &memory->large[offset];
+			fill(data, SIM_LARGE_LENGTH);
+			expected = crc_soft_calculate((crc_variant_t) variant, crc_initial((crc_variant_t) variant), data,
+					SIM_LARGE_LENGTH - offset);
+			check(service((crc_variant_t) variant, crc_initial((crc_variant_t) variant), data,
+					SIM_LARGE_LENGTH - offset), expected, "service large", (crc_variant_t) variant,
+					SIM_LARGE_LENGTH - offset, offset);
+		}
+	}
+}
+
+// A transfer error fails the calculation, and the next one passes
+static void check_transfer_error(void)
+{
+	uint32_t crc = 0;
+
+	fill(memory->check, SIM_CHECK_LENGTH);
+	fail_next = pdTRUE;
+
+	checks++;
+	if (crc_calculate(&memory->unit, CRC_VARIANT_STM32, crc_initial(CRC_VARIANT_STM32), memory->check,
+			SIM_CHECK_LENGTH, &crc, portMAX_DELAY) != pdFAIL)
+	{
+		printf("a transfer error was not reported\n");
+		failures++;
+	}
+
+	check(service(CRC_VARIANT_STM32, crc_initial(CRC_VARIANT_STM32), memory->check, SIM_CHECK_LENGTH),
+			reference(CRC_VARIANT_STM32, crc_initial(CRC_VARIANT_STM32), memory->check, SIM_CHECK_LENGTH),
+			"after transfer error", CRC_VARIANT_STM32, SIM_CHECK_LENGTH, 0);
+}
+
+// Calculates CRCs of every variant, length and alignment on its own buffer,
+// checking each against the software CRC, while the other tasks do the same
+static void shared_task(void *params)
+{
+	uint32_t task = (uint32_t) (uintptr_t) params;
+	uint32_t state = task + 1, crc;
+	uint8_t *buffer = memory->shared[task];
+	TickType_t end = xTaskGetTickCount() + SIM_SHARED_TICKS;
+	crc_variant_t variant;
+	size_t length, offset;
+
+	while (xTaskGetTickCount() < end)
+	{
+		state = (state * 1103515245UL) + 12345UL;
+		variant = (crc_variant_t) ((state >> 16) % SIM_VARIANTS);
+		length = (state >> 4) % (SIM_SHARED_MAX_LENGTH + 1);
+		offset = (state >> 24) % SIM_OFFSETS;
+
+		for (size_t i = 0; i < length; i++)
+		{
+			buffer[offset + i] = (uint8_t) (state + (i * 7));
+		}
+
+		if ((crc_calculate(&memory->unit, variant, crc_initial(variant), &buffer[offset], length, &crc,
+				portMAX_DELAY) == pdFAIL) ||
+				(crc != crc_soft_calculate(variant, crc_initial(variant), &buffer[offset], length)))
+		{
+			__atomic_add_fetch(&shared_failures, 1, __ATOMIC_SEQ_CST);
+		}
+
+		shared_calculations[task]++;
+	}
+
+	__atomic_sub_fetch(&running_tasks, 1, __ATOMIC_SEQ_CST);
+	vTaskDelete(NULL);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// The time stamp counter, which runs at the processor's nominal clock
+#define BENCH_UNIT				"cycles"
+
+// The barrier keeps the compiler from moving the timed calls past the reads
+static uint64_t bench_now(void)
+{
+	__asm volatile ("" ::: "memory");
+	return __rdtsc();
+}
+#else
+#define BENCH_UNIT				"ns"
+
+static uint64_t bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+#endif
+
+// Runs a call BENCH_RUNS times, returning the quickest
+#define BENCH(ticks, call)							\
+	do												\
+	{												\
+		(ticks) = UINT64_MAX;						\
+		for (uint32_t run = 0; run < BENCH_RUNS; run++)	\
+		{											\
+			uint64_t start = bench_now();			\
+			call;									\
+			uint64_t spent = bench_now() - start;	\
+			if (spent < (ticks))					\
+			{										\
+				(ticks) = spent;					\
+			}										\
+		}											\
+	} while (0)
+
+static uint32_t byte_table_msb[256], byte_table_lsb[256];
+static volatile uint32_t bench_sink;
+
+// A table of 256 entries, a byte at a time, as most software CRCs are
+static uint32_t byte_table(crc_variant_t variant, uint32_t crc, const uint8_t *data, size_t length)
+{
+	if (variant == CRC_VARIANT_32)
+	{
+		crc ^= 0xFFFFFFFF;
+
+		for (size_t i = 0; i < length; i++)
+		{
+			crc = (crc >> 8) ^ byte_table_lsb[(crc ^ data[i]) & 0xFF];
+		}
+
+		return crc ^ 0xFFFFFFFF;
+	}
+
+	for (size_t i = 0; i < length; i++)
+	{
+		crc = (crc << 8) ^ byte_table_msb[(crc >> 24) ^ data[i]];
+	}
+
+	return crc;
+}
+
+static void bench(void)
+{
+	uint8_t *data = memory->large;
+	uint64_t bitwise, table, slice;
+
+	for (uint32_t i = 0; i < 256; i++)
+	{
+		byte_table_msb[i] = reference_msb(0, (uint8_t) i);
+		byte_table_lsb[i] = reference_lsb(0, (uint8_t) i);
+	}
+
+	fill(data, BENCH_LENGTH);
+
+	printf("%-8s %12s %12s %12s  (%s/byte, %u bytes)\n", "variant", "bitwise", "byte table", "slice-by-8",
+			BENCH_UNIT, BENCH_LENGTH);
+
+	for (uint32_t variant = CRC_VARIANT_MPEG2; variant < SIM_VARIANTS; variant++)
+	{
+		BENCH(bitwise, bench_sink = reference((crc_variant_t) variant, 0xFFFFFFFF, data, BENCH_LENGTH));
+		BENCH(table, bench_sink = byte_table((crc_variant_t) variant, 0xFFFFFFFF, data, BENCH_LENGTH));
+		BENCH(slice, bench_sink = crc_soft_calculate((crc_variant_t) variant, 0xFFFFFFFF, data, BENCH_LENGTH));
+
+		printf("%-8s %12.2f %12.2f %12.2f\n", variant_name[variant], (double) bitwise / BENCH_LENGTH,
+				(double) table / BENCH_LENGTH, (double) slice / BENCH_LENGTH);
+	}
+}
+
+// Opens the unit, runs the checks and the benchmark, and prints the results
+static void main_task(void *params)
+{
+	pthread_t controller;
+	crc_unit_config_t config;
+	crc_unit_stats_t stats;
+	uint32_t calculations = 0;
+
+	(void) params;
+
+	memset(&config, 0, sizeof(config));
+	config.dma_controller = SIM_DMA_CONTROLLER;
+	config.dma_stream = SIM_DMA_STREAM;
+	config.dma_threshold = SIM_DMA_THRESHOLD;
+
+	sim_crc_hw.data_register = &memory->data_register;
+	configASSERT(crc_unit_open(&memory->unit, &sim_crc_hw, &config) == pdPASS);
+	pthread_create(&controller, NULL, dma_thread, NULL);
+
+	check_soft();
+	check_service();
+	check_transfer_error();
+
+	running_tasks = SIM_SHARED_TASKS;
+	for (uint32_t task = 0; task < SIM_SHARED_TASKS; task++)
+	{
+		xTaskCreate(shared_task, "Shared", SIM_STACK_SIZE, (void *) (uintptr_t) task, 2, NULL);
+	}
+
+	while (running_tasks > 0)
+	{
+		vTaskDelay(1);
+	}
+
+	crc_unit_get_stats(&memory->unit, &stats);
+
+	for (uint32_t task = 0; task < SIM_SHARED_TASKS; task++)
+	{
+		calculations += shared_calculations[task];
+	}
+
+	sim_print_lock();
+	{
+		printf("checks: %lu, failures: %lu\n", (unsigned long) checks, (unsigned long) failures);
+		printf("shared: %lu calculations by %d tasks (%lu, %lu, %lu), failures: %lu\n", (unsigned long) calculations,
+				SIM_SHARED_TASKS, (unsigned long) shared_calculations[0], (unsigned long) shared_calculations[1],
+				(unsigned long) shared_calculations[2], (unsigned long) shared_failures);
+		printf("unit: %lu calculations, %llu bytes: %llu by DMA in %lu transfers, %llu by the CPU, %llu in "
+				"software; %lu waits, %lu DMA errors, %lu bad transfers, %lu writes while disabled\n",
+				(unsigned long) stats.calculations, (unsigned long long) stats.bytes,
+				(unsigned long long) stats.dma_bytes, (unsigned long) dma_transfers,
+				(unsigned long long) stats.cpu_bytes, (unsigned long long) stats.soft_bytes,
+				(unsigned long) stats.waits, (unsigned long) stats.dma_errors, (unsigned long) dma_config_errors,
+				(unsigned long) disabled_writes);
+		bench();
+	}
+	sim_print_unlock();
+
+	crc_unit_close(&memory->unit);
+	stop_dma = pdTRUE;
+	pthread_join(controller, NULL);
+
+	exit(((failures == 0) && (shared_failures == 0)) ? 0 : 1);
+}
+
+// driver funtion
+int main(void)
+{
+	memory = mmap(NULL, sizeof(sim_memory_t), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+	configASSERT(memory != MAP_FAILED);
+
+	dma_manager_init(&sim_dma_hw);
+	vPortSetInterruptHandler(SIM_INTERRUPT, dma_interrupt_handler);
+
+	sim_run(main_task, "Main", configMAX_PRIORITIES - 1);
+}
@@ -0,0 +1,686 @@
+/**
+  ******************************************************************************
+  * @file    crypto_sim.c
+  * @brief   Host simulation of the crypto service (crypto_service.h) on
+  * 		 crypto_soft_engine.  The software algorithms and the service are
+  * 		 checked against published vectors, then the service against the
+  * 		 software algorithms for every algorithm, key size and direction
+  * 		 at many lengths, from tasks that queue several jobs at once above
+  * 		 and below the service task's priority, so that jobs are
+  * 		 interleaved slice by slice and the engine's state moves between
+  * 		 them.  Cancelling, an engine error and a job queued from an
+  * 		 interrupt are checked too.  Then it measures how long a short
+  * 		 urgent job waits behind a long one for several slice sizes, and
+  * 		 the throughput of each algorithm called directly and through the
+  * 		 service.  See README.md for the build command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Before the CMSIS headers, whose __I would break the intrinsics
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "crypto_service.h"
+#include "sim_common.h"
+
+#define SIM_INTERRUPT			(portFIRST_USER_INTERRUPT)
+#define SIM_SERVICE_PRIORITY	(2)
+#define SIM_SLICE_BYTES			(256)
+#define SIM_RANDOM_JOBS			(400)
+#define SIM_RANDOM_MAX_LENGTH	(3000)
+#define SIM_SHARED_TASKS		(3)
+#define SIM_BATCH				(3)
+#define SIM_SHARED_TICKS		(pdMS_TO_TICKS(500))
+#define SIM_LONG_LENGTH			(4UL * 1024 * 1024)
+#define SIM_URGENT_LENGTH		(64)
+#define SIM_MILLION				(1000000UL)
+#define BENCH_RUNS				(20)
+#define BENCH_LENGTH			(16384)
+
+// Marks a job the failing engine fails part way through
+#define SIM_FAIL_CONTEXT		((void *) 1)
+
+typedef struct
+{
+	crypto_algorithm_t algorithm;
+	const char *message;
+	uint32_t repeat;
+	const char *digest;
+} hash_vector_t;
+
+typedef struct
+{
+	crypto_algorithm_t algorithm;
+	const char *key;
+	const char *iv;
+	const char *plain;
+	const char *cipher;
+} aes_vector_t;
+
+static const char *const algorithm_name[] = {"MD5", "SHA-1", "SHA-256", "AES-ECB", "AES-CBC", "AES-CTR"};
+
+static const hash_vector_t hash_vectors[] =
+{
+	{CRYPTO_MD5, "", 1, "d41d8cd98f00b204e9800998ecf8427e"},
+	{CRYPTO_MD5, "abc", 1, "900150983cd24fb0d6963f7d28e17f72"},
+	{CRYPTO_MD5, "a", SIM_MILLION, "7707d6ae4e027c70eea2a935c2296f21"},
+	{CRYPTO_SHA1, "abc", 1, "a9993e364706816aba3e25717850c26c9cd0d89d"},
+	{CRYPTO_SHA1, "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1,
+			"84983e441c3bd26ebaae4aa1f95129e5e54670f1"},
+	{CRYPTO_SHA1, "a", SIM_MILLION, "34aa973cd4c4daa4f61eeb2bdbad27316534016f"},
+	{CRYPTO_SHA256, "abc", 1, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"},
+	{CRYPTO_SHA256, "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1,
+			"248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"},
+	{CRYPTO_SHA256, "a", SIM_MILLION, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"}
+};
+
+// FIPS-197 appendix C, and SP 800-38A F.1.1, F.2.1 and F.5.1
+#define SP800_38A_PLAIN		"6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51" \
+							"30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710"
+#define SP800_38A_KEY		"2b7e151628aed2a6abf7158809cf4f3c"
+
+static const aes_vector_t aes_vectors[] =
+{
+	{CRYPTO_AES_ECB, "000102030405060708090a0b0c0d0e0f", NULL, "00112233445566778899aabbccddeeff",
+			"69c4e0d86a7b0430d8cdb78070b4c55a"},
+	{CRYPTO_AES_ECB, "000102030405060708090a0b0c0d0e0f1011121314151617", NULL,
+			"00112233445566778899aabbccddeeff", "dda97ca4864cdfe06eaf70a0ec0d7191"},
+	{CRYPTO_AES_ECB, "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f", NULL,
+			"00112233445566778899aabbccddeeff", "8ea2b7ca516745bfeafc49904b496089"},
+	{CRYPTO_AES_ECB, SP800_38A_KEY, NULL, SP800_38A_PLAIN,
+			"3ad77bb40d7a3660a89ecaf32466ef97f5d3d58503b9699de785895a96fdbaaf"
+			"43b1cd7f598ece23881b00e3ed0306887b0c785e27e8ad3f8223207104725dd4"},
+	{CRYPTO_AES_CBC, SP800_38A_KEY, "000102030405060708090a0b0c0d0e0f", SP800_38A_PLAIN,
+			"7649abac8119b246cee98e9b12e9197d5086cb9b507219ee95db113a917678b2"
+			"73bed6b8e3c1743b7116e69e222295163ff1caa1681fac09120eca307586e1a7"},
+	{CRYPTO_AES_CTR, SP800_38A_KEY, "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff", SP800_38A_PLAIN,
+			"874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff"
+			"5ae4df3edbd5d35e5b4f09020db03eab1e031dda2fbe03d1792170a0f3009cee"}
+};
+
+static crypto_service_t service;
+static crypto_engine_t failing_engine;
+static uint8_t long_data[SIM_LONG_LENGTH];
+static uint8_t bench_output[BENCH_LENGTH];
+static crypto_job_t isr_job;
+static uint8_t isr_digest[CRYPTO_DIGEST_MAX];
+static uint32_t random_state = 1;
+static uint32_t checks, failures;
+static volatile uint32_t shared_jobs[SIM_SHARED_TASKS];
+static volatile uint32_t shared_failures, callbacks, running_tasks;
+
+static void check(BaseType_t good, const char *what, crypto_algorithm_t algorithm, size_t length)
+{
+	checks++;
+
+	if (good == pdFALSE)
+	{
+		if (failures < 10)
+		{
+			printf("%s %s: %lu bytes wrong\n", what, algorithm_name[algorithm], (unsigned long) length);
+		}
+
+		failures++;
+	}
+}
+
+// A small deterministic generator, so every run sees the same data
+static uint32_t next_random(uint32_t *state)
+{
+	*state = (*state * 1103515245UL) + 12345UL;
+	return *state >> 16;
+}
+
+static void fill(uint8_t *data, size_t length, uint32_t *state)
+{
+	for (size_t i = 0; i < length; i++)
+	{
+		data[i] = (uint8_t) next_random(state);
+	}
+}
+
+static size_t from_hex(const char *hex, uint8_t *data)
+{
+	size_t length = strlen(hex) / 2;
+	unsigned int byte;
+
+	for (size_t i = 0; i < length; i++)
+	{
+		(void) sscanf(&hex[i * 2], "%2x", &byte);
+		data[i] = (uint8_t) byte;
+	}
+
+	return length;
+}
+
+// A job's result computed directly with the software algorithms
+static void expected(const crypto_job_t *job, uint8_t *output)
+{
+	crypto_hash_state_t hash;
+	crypto_aes_state_t aes;
+
+	if (CRYPTO_IS_HASH(job->algorithm))
+	{
+		crypto_hash_init(&hash, job->algorithm);
+		crypto_hash_update(&hash, job->algorithm, job->input, job->length);
+		crypto_hash_final(&hash, job->algorithm, output);
+	}
+	else
+	{
+		crypto_aes_init(&aes, job->key, job->key_bits, (job->algorithm == CRYPTO_AES_ECB) ? NULL : job->iv,
+				job->decrypt);
+		crypto_aes_process(&aes, job->algorithm, job->input, output, job->length);
+	}
+}
+
+static size_t result_length(const crypto_job_t *job)
+{
+	return CRYPTO_IS_HASH(job->algorithm) ? crypto_digest_length(job->algorithm) : job->length;
+}
+
+// A random job of any algorithm, key size and direction, on a random part of
+// data, with its own key and IV
+static void random_job(crypto_job_t *job, uint32_t *state, uint8_t *data, size_t data_length, uint8_t *key,
+		uint8_t *iv, uint8_t *output)
+{
+	size_t length = next_random(state) % (SIM_RANDOM_MAX_LENGTH + 1);
+
+	memset(job, 0, sizeof(crypto_job_t));
+	job->algorithm = (crypto_algorithm_t) (next_random(state) % (CRYPTO_AES_CTR + 1));
+	job->priority = (uint8_t) (next_random(state) % CRYPTO_PRIORITIES);
+
+	if (!CRYPTO_IS_HASH(job->algorithm))
+	{
+		length -= length % CRYPTO_AES_BLOCK;
+		job->key_bits = (uint16_t) (128 + (64 * (next_random(state) % 3)));
+		job->decrypt = ((next_random(state) & 1) != 0) ? pdTRUE : pdFALSE;
+		fill(key, 32, state);
+		fill(iv, CRYPTO_AES_BLOCK, state);
+		job->key = key;
+		job->iv = iv;
+	}
+
+	job->input = &data[next_random(state) % (data_length - length + 1)];
+	job->length = length;
+	job->output = output;
+}
+
+// The software algorithms and the service against the published vectors.
+// The hashes also in uneven parts, and the ciphers both ways
+static void check_vectors(void)
+{
+	uint8_t digest[CRYPTO_DIGEST_MAX], reference[CRYPTO_DIGEST_MAX], key[32], iv[CRYPTO_AES_BLOCK];
+	uint8_t plain[64], cipher[64], output[64];
+	crypto_hash_state_t hash;
+	crypto_job_t job;
+	size_t length, key_length, part;
+
+	for (size_t v = 0; v < (sizeof(hash_vectors) / sizeof(hash_vectors[0])); v++)
+	{
+		const hash_vector_t *vector = &hash_vectors[v];
+		size_t message_length = strlen(vector->message);
+
+		length = message_length * vector->repeat;
+		for (uint32_t i = 0; i < vector->repeat; i++)
+		{
+			memcpy(&long_data[i * message_length], vector->message, message_length);
+		}
+
+		(void) from_hex(vector->digest, reference);
+
+		crypto_hash_init(&hash, vector->algorithm);
+		for (size_t done = 0, step = 1; done < length; done += part, step = (step * 3) + 1)
+		{
+			part = ((length - done) < step) ? (length - done) : step;
+			crypto_hash_update(&hash, vector->algorithm, &long_data[done], part);
+		}
+		crypto_hash_final(&hash, vector->algorithm, digest);
+		check(memcmp(digest, reference, crypto_digest_length(vector->algorithm)) == 0, "vector",
+				vector->algorithm, length);
+
+		memset(&job, 0, sizeof(job));
+		memset(digest, 0, sizeof(digest));
+		job.algorithm = vector->algorithm;
+		job.input = long_data;
+		job.length = length;
+		job.output = digest;
+		check((crypto_run(&service, &job, portMAX_DELAY) == pdPASS) &&
+				(memcmp(digest, reference, crypto_digest_length(vector->algorithm)) == 0), "service vector",
+				vector->algorithm, length);
+	}
+
+	for (size_t v = 0; v < (sizeof(aes_vectors) / sizeof(aes_vectors[0])); v++)
+	{
+		const aes_vector_t *vector = &aes_vectors[v];
+
+		key_length = from_hex(vector->key, key);
+		if (vector->iv != NULL)
+		{
+			(void) from_hex(vector->iv, iv);
+		}
+		length = from_hex(vector->plain, plain);
+		(void) from_hex(vector->cipher, cipher);
+
+		for (BaseType_t decrypt = pdFALSE; decrypt <= pdTRUE; decrypt++)
+		{
+			memset(&job, 0, sizeof(job));
+			memset(output, 0, sizeof(output));
+			job.algorithm = vector->algorithm;
+			job.decrypt = decrypt;
+			job.key = key;
+			job.key_bits = (uint16_t) (key_length * 8);
+			job.iv = iv;
+			job.input = (decrypt == pdTRUE) ? cipher : plain;
+			job.length = length;
+			job.output = output;
+
+			expected(&job, output);
+			check(memcmp(output, (decrypt == pdTRUE) ? plain : cipher, length) == 0, "vector",
+					vector->algorithm, length);
+
+			memset(output, 0, sizeof(output));
+			check((crypto_run(&service, &job, portMAX_DELAY) == pdPASS) &&
+					(memcmp(output, (decrypt == pdTRUE) ? plain : cipher, length) == 0), "service vector",
+					vector->algorithm, length);
+		}
+	}
+}
+
+// The service against the software algorithms for random jobs, longer than
+// a slice, some of them in place
+static void check_random(void)
+{
+	static uint8_t data[SIM_RANDOM_MAX_LENGTH * 2], output[SIM_RANDOM_MAX_LENGTH], reference[SIM_RANDOM_MAX_LENGTH];
+	uint8_t key[32], iv[CRYPTO_AES_BLOCK];
+	crypto_job_t job;
+
+	fill(data, sizeof(data), &random_state);
+
+	for (uint32_t n = 0; n < SIM_RANDOM_JOBS; n++)
+	{
+		random_job(&job, &random_state, data, sizeof(data), key, iv, output);
+		expected(&job, reference);
+
+		if (!CRYPTO_IS_HASH(job.algorithm) && ((n & 3) == 0))
+		{
+			// In place, on a copy of the input
+			memcpy(output, job.input, job.length);
+			job.input = output;
+		}
+
+		check((crypto_run(&service, &job, portMAX_DELAY) == pdPASS) &&
+				(memcmp(output, reference, result_length(&job)) == 0) &&
+				(job.slices == ((job.length == 0) ? 1 : ((job.length + SIM_SLICE_BYTES - 1) / SIM_SLICE_BYTES))),
+				"random", job.algorithm, job.length);
+	}
+}
+
+static void count_callback(crypto_job_t *job)
+{
+	(void) job;
+	__atomic_add_fetch(&callbacks, 1, __ATOMIC_SEQ_CST);
+}
+
+// Queues SIM_BATCH random jobs at once, each completing through its own
+// notification bit and a callback, and checks them against the software
+// algorithms while the other tasks do the same
+static void shared_task(void *params)
+{
+	uint32_t task = (uint32_t) (uintptr_t) params;
+	uint32_t state = task + 1, bits, pending;
+	static uint8_t data[SIM_SHARED_TASKS][SIM_RANDOM_MAX_LENGTH * 2];
+	static uint8_t output[SIM_SHARED_TASKS][SIM_BATCH][SIM_RANDOM_MAX_LENGTH];
+	uint8_t key[SIM_BATCH][32], iv[SIM_BATCH][CRYPTO_AES_BLOCK], reference[SIM_RANDOM_MAX_LENGTH];
+	crypto_job_t jobs[SIM_BATCH];
+	TickType_t end = xTaskGetTickCount() + SIM_SHARED_TICKS;
+
+	fill(data[task], sizeof(data[task]), &state);
+
+	while (xTaskGetTickCount() < end)
+	{
+		pending = 0;
+
+		for (uint32_t j = 0; j < SIM_BATCH; j++)
+		{
+			random_job(&jobs[j], &state, data[task], sizeof(data[task]), key[j], iv[j], output[task][j]);
+			jobs[j].callback = count_callback;
+			jobs[j].notify_task = xTaskGetCurrentTaskHandle();
+			jobs[j].notify_bits = 1UL << j;
+			pending |= 1UL << j;
+			crypto_submit(&service, &jobs[j]);
+		}
+
+		while (pending != 0)
+		{
+			(void) xTaskNotifyWait(0, pending, &bits, portMAX_DELAY);
+			pending &= ~bits;
+		}
+
+		for (uint32_t j = 0; j < SIM_BATCH; j++)
+		{
+			expected(&jobs[j], reference);
+
+			if ((jobs[j].status != CRYPTO_DONE) || (memcmp(output[task][j], reference, result_length(&jobs[j])) != 0))
+			{
+				__atomic_add_fetch(&shared_failures, 1, __ATOMIC_SEQ_CST);
+			}
+
+			shared_jobs[task]++;
+		}
+	}
+
+	__atomic_sub_fetch(&running_tasks, 1, __ATOMIC_SEQ_CST);
+	vTaskDelete(NULL);
+}
+
+static uint32_t submit_interrupt_handler(void)
+{
+	crypto_submit_from_isr(&service, &isr_job);
+	return pdFALSE;
+}
+
+// A job queued behind another can be cancelled, and one that has completed
+// cannot; a job queued from an interrupt completes
+static void check_cancel_and_isr(void)
+{
+	crypto_job_t first, second;
+	uint8_t digest[CRYPTO_DIGEST_MAX], reference[CRYPTO_DIGEST_MAX];
+
+	// The main task is above the service task, which cannot start either
+	// job until it waits
+	memset(&first, 0, sizeof(first));
+	first.algorithm = CRYPTO_SHA256;
+	first.input = long_data;
+	first.length = SIM_LONG_LENGTH / 4;
+	first.output = digest;
+	first.notify_task = xTaskGetCurrentTaskHandle();
+	first.notify_bits = 1UL << 0;
+	second = first;
+	second.notify_bits = 1UL << 1;
+
+	crypto_submit(&service, &first);
+	crypto_submit(&service, &second);
+	check((crypto_cancel(&service, &second) == pdPASS) && (second.status == CRYPTO_CANCELLED), "cancel",
+			CRYPTO_SHA256, second.length);
+
+	(void) xTaskNotifyWait(0, 1UL << 0, NULL, portMAX_DELAY);
+	expected(&first, reference);
+	check((first.status == CRYPTO_DONE) && (crypto_cancel(&service, &first) == pdFAIL) &&
+			(memcmp(digest, reference, 32) == 0), "cancel done", CRYPTO_SHA256, first.length);
+
+	memset(&isr_job, 0, sizeof(isr_job));
+	isr_job.algorithm = CRYPTO_MD5;
+	isr_job.input = long_data;
+	isr_job.length = 1000;
+	isr_job.output = isr_digest;
+	isr_job.notify_task = xTaskGetCurrentTaskHandle();
+	isr_job.notify_bits = 1UL << 2;
+
+	vPortGenerateSimulatedInterrupt(SIM_INTERRUPT);
+	(void) xTaskNotifyWait(0, 1UL << 2, NULL, portMAX_DELAY);
+	expected(&isr_job, reference);
+	check((isr_job.status == CRYPTO_DONE) && (memcmp(isr_digest, reference, 16) == 0), "interrupt", CRYPTO_MD5,
+			isr_job.length);
+}
+
+static BaseType_t failing_process(crypto_job_t *job, const uint8_t *input, uint8_t *output, size_t length,
+		BaseType_t last)
+{
+	if ((job->context == SIM_FAIL_CONTEXT) && (job->done > 0))
+	{
+		return pdFAIL;
+	}
+
+	return crypto_soft_engine.process(job, input, output, length, last);
+}
+
+// An engine error on the second slice ends the job and the next job passes
+static void check_engine_error(void)
+{
+	crypto_service_config_t config = {SIM_SERVICE_PRIORITY, SIM_STACK_SIZE, SIM_SLICE_BYTES};
+	crypto_service_stats_t stats;
+	uint8_t digest[CRYPTO_DIGEST_MAX], reference[CRYPTO_DIGEST_MAX];
+	crypto_job_t job;
+
+	failing_engine = crypto_soft_engine;
+	failing_engine.process = failing_process;
+	configASSERT(crypto_service_open(&service, &failing_engine, &config) == pdPASS);
+
+	memset(&job, 0, sizeof(job));
+	job.algorithm = CRYPTO_SHA1;
+	job.input = long_data;
+	job.length = SIM_SLICE_BYTES * 4;
+	job.output = digest;
+	job.context = SIM_FAIL_CONTEXT;
+	check((crypto_run(&service, &job, portMAX_DELAY) == pdFAIL) && (job.status == CRYPTO_ERROR) &&
+			(job.slices == 2), "engine error", CRYPTO_SHA1, job.length);
+
+	job.context = NULL;
+	expected(&job, reference);
+	check((crypto_run(&service, &job, portMAX_DELAY) == pdPASS) && (memcmp(digest, reference, 20) == 0),
+			"after error", CRYPTO_SHA1, job.length);
+
+	crypto_service_get_stats(&service, &stats);
+	check((stats.jobs == 2) && (stats.errors == 1), "error stats", CRYPTO_SHA1, job.length);
+
+	crypto_service_close(&service);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// The time stamp counter, which runs at the processor's nominal clock
+#define BENCH_UNIT				"cycles"
+
+// The barrier keeps the compiler from moving the timed calls past the reads
+static uint64_t bench_now(void)
+{
+	__asm volatile ("" ::: "memory");
+	return __rdtsc();
+}
+#else
+#define BENCH_UNIT				"ns"
+
+static uint64_t bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+#endif
+
+// Runs a call BENCH_RUNS times, returning the quickest
+#define BENCH(ticks, call)							\
+	do												\
+	{												\
+		(ticks) = UINT64_MAX;						\
+		for (uint32_t run = 0; run < BENCH_RUNS; run++)	\
+		{											\
+			uint64_t start = bench_now();			\
+			call;									\
+			uint64_t spent = bench_now() - start;	\
+			if (spent < (ticks))					\
+			{										\
+				(ticks) = spent;					\
+			}										\
+		}											\
+	} while (0)
+
+// A long SHA-256 job at the lowest priority while an urgent MD5 job is
+// queued at the highest every tick, for each slice size.  The last size
+// takes the long job in one slice, as a service without preemption would
+static void bench_latency(void)
+{
+	static const size_t slices[] = {1024, 16384, 262144, SIM_LONG_LENGTH};
+	crypto_service_config_t config = {SIM_SERVICE_PRIORITY, SIM_STACK_SIZE, 0};
+	crypto_service_stats_t stats;
+	crypto_job_t long_job, urgent;
+	uint8_t digest[CRYPTO_DIGEST_MAX], urgent_digest[CRYPTO_DIGEST_MAX];
+	uint64_t total_us, max_us;
+	uint32_t count;
+
+	printf("%-10s %10s %14s %14s %10s %12s\n", "slice", "urgent", "mean wait us", "max wait us", "switches",
+			"long job us");
+
+	for (size_t s = 0; s < (sizeof(slices) / sizeof(slices[0])); s++)
+	{
+		config.slice_bytes = slices[s];
+		configASSERT(crypto_service_open(&service, &crypto_soft_engine, &config) == pdPASS);
+
+		memset(&long_job, 0, sizeof(long_job));
+		long_job.algorithm = CRYPTO_SHA256;
+		long_job.input = long_data;
+		long_job.length = SIM_LONG_LENGTH;
+		long_job.output = digest;
+		long_job.priority = 0;
+		long_job.notify_task = xTaskGetCurrentTaskHandle();
+		long_job.notify_bits = 1UL << 0;
+
+		memset(&urgent, 0, sizeof(urgent));
+		urgent.algorithm = CRYPTO_MD5;
+		urgent.input = long_data;
+		urgent.length = SIM_URGENT_LENGTH;
+		urgent.output = urgent_digest;
+		urgent.priority = CRYPTO_PRIORITIES - 1;
+
+		total_us = 0;
+		max_us = 0;
+		count = 0;
+
+		crypto_submit(&service, &long_job);
+
+		// The main task is above the service task, so the urgent job is
+		// queued while the long job is running
+		vTaskDelay(1);
+		while (long_job.status != CRYPTO_DONE)
+		{
+			check(crypto_run(&service, &urgent, portMAX_DELAY), "urgent", CRYPTO_MD5, urgent.length);
+			total_us += urgent.latency_us;
+			max_us = (urgent.latency_us > max_us) ? urgent.latency_us : max_us;
+			count++;
+			vTaskDelay(1);
+		}
+
+		(void) xTaskNotifyWait(0, 1UL << 0, NULL, 0);
+		crypto_service_get_stats(&service, &stats);
+
+		printf("%-10lu %10lu %14.1f %14lu %10lu %12lu\n", (unsigned long) slices[s], (unsigned long) count,
+				(count > 0) ? ((double) total_us / count) : 0.0, (unsigned long) max_us,
+				(unsigned long) stats.switches, (unsigned long) long_job.latency_us);
+
+		crypto_service_close(&service);
+	}
+}
+
+// Each algorithm called directly and through the service, for one buffer
+static void bench_throughput(void)
+{
+	crypto_service_config_t config = {SIM_SERVICE_PRIORITY, SIM_STACK_SIZE, BENCH_LENGTH};
+	uint8_t key[32], iv[CRYPTO_AES_BLOCK];
+	crypto_job_t job;
+	uint64_t direct, through;
+	uint32_t state = 7;
+
+	configASSERT(crypto_service_open(&service, &crypto_soft_engine, &config) == pdPASS);
+
+	fill(key, sizeof(key), &state);
+	fill(iv, sizeof(iv), &state);
+
+	printf("%-10s %12s %12s  (%s/byte, %u bytes)\n", "algorithm", "direct", "service", BENCH_UNIT, BENCH_LENGTH);
+
+	for (uint32_t algorithm = CRYPTO_MD5; algorithm <= CRYPTO_AES_CTR; algorithm++)
+	{
+		memset(&job, 0, sizeof(job));
+		job.algorithm = (crypto_algorithm_t) algorithm;
+		job.key = key;
+		job.key_bits = 128;
+		job.iv = iv;
+		job.input = long_data;
+		job.length = BENCH_LENGTH;
+		job.output = bench_output;
+
+		BENCH(direct, expected(&job, bench_output));
+		BENCH(through, (void) crypto_run(&service, &job, portMAX_DELAY));
+
+		printf("%-10s %12.2f %12.2f\n", algorithm_name[algorithm], (double) direct / BENCH_LENGTH,
+				(double) through / BENCH_LENGTH);
+	}
+
+	crypto_service_close(&service);
+}
+
+// Opens the service, runs the checks and the benchmarks, and prints the
+// results
+static void main_task(void *params)
+{
+	crypto_service_config_t config = {SIM_SERVICE_PRIORITY, SIM_STACK_SIZE, SIM_SLICE_BYTES};
+	crypto_service_stats_t stats;
+	uint32_t jobs = 0;
+
+	(void) params;
+
+	configASSERT(crypto_service_open(&service, &crypto_soft_engine, &config) == pdPASS);
+
+	check_vectors();
+	check_random();
+	check_cancel_and_isr();
+
+	// Two tasks above the service task queue jobs while it is part way
+	// through others, and one below it
+	running_tasks = SIM_SHARED_TASKS;
+	for (uint32_t task = 0; task < SIM_SHARED_TASKS; task++)
+	{
+		xTaskCreate(shared_task, "Shared", SIM_STACK_SIZE, (void *) (uintptr_t) task,
+				(task < 2) ? (SIM_SERVICE_PRIORITY + 1) : (SIM_SERVICE_PRIORITY - 1), NULL);
+	}
+
+	while (running_tasks > 0)
+	{
+		vTaskDelay(1);
+	}
+
+	crypto_service_get_stats(&service, &stats);
+	crypto_service_close(&service);
+
+	check_engine_error();
+
+	for (uint32_t task = 0; task < SIM_SHARED_TASKS; task++)
+	{
+		jobs += shared_jobs[task];
+	}
+
+	sim_print_lock();
+	{
+		printf("checks: %lu, failures: %lu\n", (unsigned long) checks, (unsigned long) failures);
+		printf("shared: %lu jobs by %d tasks (%lu, %lu, %lu), %lu callbacks, failures: %lu\n", (unsigned long) jobs,
+				SIM_SHARED_TASKS, (unsigned long) shared_jobs[0], (unsigned long) shared_jobs[1],
+				(unsigned long) shared_jobs[2], (unsigned long) callbacks, (unsigned long) shared_failures);
+		printf("service: %lu jobs, %lu errors, %llu bytes in %lu slices, %lu switches, %lu%% busy, "
+				"latency mean %lu us max %lu us, %lu queued at most\n", (unsigned long) stats.jobs,
+				(unsigned long) stats.errors, (unsigned long long) stats.bytes, (unsigned long) stats.slices,
+				(unsigned long) stats.switches, (unsigned long) (stats.utilisation / 10),
+				(unsigned long) stats.latency_mean_us, (unsigned long) stats.latency_max_us,
+				(unsigned long) stats.queued_max);
+	}
+	sim_print_unlock();
+
+	// The other tasks have finished, and the service task does not print
+	bench_latency();
+	bench_throughput();
+	fflush(stdout);
+
+	exit(((failures == 0) && (shared_failures == 0) && (callbacks == jobs)) ? 0 : 1);
+}
+
+// driver funtion
+int main(void)
+{
+	vPortSetInterruptHandler(SIM_INTERRUPT, submit_interrupt_handler);
+
+	sim_run(main_task, "Main", configMAX_PRIORITIES - 1);
+}
@@ -0,0 +1,39 @@
+/**
+  ******************************************************************************
+  * @file    dma_hw_sim.c
+  * @brief   Simulated DMA controller registers, see dma_hw_sim.h
+  ******************************************************************************
+*/
+
+#include "dma_hw_sim.h"
+
+// Simulated registers
+DMA_TypeDef sim_controller[DMA_CONTROLLERS];
+DMA_Stream_TypeDef sim_stream[DMA_CONTROLLERS][DMA_STREAMS_PER_CONTROLLER];
+
+static void sim_enable_stream(uint32_t controller, uint32_t number, FunctionalState state)
+{
+	(void) controller;
+	(void) number;
+	(void) state;
+}
+
+// The flags of the simulated registers are cleared at once, rather than by
+// writing to LIFCR or HIFCR
+static void sim_clear_flags(DMA_TypeDef *controller, uint32_t high, uint32_t flags)
+{
+	__atomic_and_fetch((high == 0) ? &controller->LISR : &controller->HISR, ~flags, __ATOMIC_SEQ_CST);
+}
+
+const dma_hw_t sim_dma_hw =
+{
+	{ &sim_controller[0], &sim_controller[1] },
+	{
+		{ &sim_stream[0][0], &sim_stream[0][1], &sim_stream[0][2], &sim_stream[0][3],
+		  &sim_stream[0][4], &sim_stream[0][5], &sim_stream[0][6], &sim_stream[0][7] },
+		{ &sim_stream[1][0], &sim_stream[1][1], &sim_stream[1][2], &sim_stream[1][3],
+		  &sim_stream[1][4], &sim_stream[1][5], &sim_stream[1][6], &sim_stream[1][7] }
+	},
+	sim_enable_stream,
+	sim_clear_flags
+};
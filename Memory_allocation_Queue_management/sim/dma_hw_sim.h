@@ -0,0 +1,21 @@
+/**
+  ******************************************************************************
+  * @file    dma_hw_sim.h
+  * @brief   Simulated DMA controller registers shared by the host
+  * 		 simulations of the DMA stream manager and the drivers built on
+  * 		 it.  The host thread playing a peripheral moves data through
+  * 		 sim_stream and raises flags in sim_controller, and the
+  * 		 simulation passes sim_dma_hw to dma_manager_init().
+  ******************************************************************************
+*/
+
+#ifndef DMA_HW_SIM_H
+#define DMA_HW_SIM_H
+
+#include "dma_manager.h"
+
+extern DMA_TypeDef sim_controller[DMA_CONTROLLERS];
+extern DMA_Stream_TypeDef sim_stream[DMA_CONTROLLERS][DMA_STREAMS_PER_CONTROLLER];
+extern const dma_hw_t sim_dma_hw;
+
+#endif /* DMA_HW_SIM_H */
@@ -0,0 +1,191 @@
+/**
+  ******************************************************************************
+  * @file    dma_sim.c
+  * @brief   Host simulation of the DMA stream manager (dma_manager.h) against
+  * 		 simulated DMA registers.  A host thread plays the part of the
+  * 		 DMA controller, filling the memory target of an enabled stream
+  * 		 in double buffer mode and raising its interrupt, while a task
+  * 		 receives the buffers, first keeping up and then releasing each
+  * 		 one slowly so buffers are dropped.  The contents of every buffer
+  * 		 received are checked.  See README.md for the build command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include "dma_manager.h"
+#include "dma_hw_sim.h"
+#include "sim_common.h"
+
+#define SIM_CONTROLLER			(2)
+#define SIM_STREAM				(0)
+#define SIM_BUFFERS				(4)
+#define SIM_BUFFER_SIZE			(256)
+#define SIM_WORDS				(SIM_BUFFER_SIZE / sizeof(uint32_t))
+#define SIM_PERIOD_NS			(500000)
+#define SIM_PHASE_BUFFERS		(1000)
+#define SIM_SLOW_RELEASE		(pdMS_TO_TICKS(2))
+#define SIM_INTERRUPT			(portFIRST_USER_INTERRUPT)
+
+// Simulated registers
+static volatile uint32_t sim_data_register;
+
+static dma_stream_t stream;
+static volatile BaseType_t stop;
+static volatile uint32_t late_interrupts;
+
+// The simulated stream raises its transfer complete flag in LISR
+#define SIM_TCIF				(1UL << 5)
+
+// Fills the current memory target of the stream with consecutive words,
+// then switches target and raises the transfer complete interrupt, as the
+// controller does in double buffer mode
+static void *dma_controller_thread(void *params)
+{
+	DMA_Stream_TypeDef *regs = &sim_stream[SIM_CONTROLLER - 1][SIM_STREAM];
+	struct timespec period = { 0, SIM_PERIOD_NS };
+	uint32_t next_word = 0, *target;
+
+	(void) params;
+
+	while (stop == pdFALSE)
+	{
+		nanosleep(&period, NULL);
+
+		if ((regs->CR & DMA_SxCR_EN) == 0)
+		{
+			continue;
+		}
+
+		// On the target the interrupt is serviced well within the time it
+		// takes to fill a buffer.  The host may not run the interrupt that
+		// soon, so wait for it rather than switch target twice.
+		if ((__atomic_load_n(&sim_controller[SIM_CONTROLLER - 1].LISR, __ATOMIC_SEQ_CST) & SIM_TCIF) != 0)
+		{
+			late_interrupts++;
+			while (((__atomic_load_n(&sim_controller[SIM_CONTROLLER - 1].LISR, __ATOMIC_SEQ_CST) & SIM_TCIF) != 0) &&
+					(stop == pdFALSE))
+			{
+				nanosleep(&period, NULL);
+			}
+		}
+
+		target = (uint32_t *) (uintptr_t) (((regs->CR & DMA_SxCR_CT) != 0) ? regs->M1AR : regs->M0AR);
+		for (uint32_t word = 0; word < SIM_WORDS; word++)
+		{
+			target[word] = next_word++;
+		}
+
+		__atomic_xor_fetch(&regs->CR, DMA_SxCR_CT, __ATOMIC_SEQ_CST);
+
+		__atomic_or_fetch(&sim_controller[SIM_CONTROLLER - 1].LISR, SIM_TCIF, __ATOMIC_SEQ_CST);
+
+		vPortGenerateSimulatedInterrupt(SIM_INTERRUPT);
+	}
+
+	return NULL;
+}
+
+static uint32_t dma_interrupt_handler(void)
+{
+	BaseType_t woken = dma_manager_irq(SIM_CONTROLLER, SIM_STREAM);
+
+	return (uint32_t) woken;
+}
+
+static void print_phase(const char *phase, uint32_t corrupt)
+{
+	dma_stream_stats_t stats;
+
+	dma_stream_get_stats(&stream, &stats);
+
+	sim_printf("cores: %d, %-5s buffers: %lu, overruns: %lu, errors: %lu, %lu bytes/s, corrupt buffers: %lu, late interrupts: %lu\n",
+			configNUMBER_OF_CORES, phase, (unsigned long) stats.buffers, (unsigned long) stats.overruns,
+			(unsigned long) stats.errors, (unsigned long) stats.bytes_per_second, (unsigned long) corrupt,
+			(unsigned long) late_interrupts);
+}
+
+// Receives buffers, checking each holds the words the controller wrote for
+// its sequence number, first releasing them at once and then slowly
+static void receive_task(void *params)
+{
+	pthread_t controller;
+	uint8_t *buffers[SIM_BUFFERS];
+	dma_stream_config_t config;
+	dma_buffer_t buffer;
+	uint32_t corrupt, expected;
+
+	(void) params;
+
+	// The stream holds 32 bit addresses, so the buffers must be in the low
+	// 4GB of the host's address space
+	for (uint32_t i = 0; i < SIM_BUFFERS; i++)
+	{
+		buffers[i] = mmap(NULL, SIM_BUFFER_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+		configASSERT(buffers[i] != MAP_FAILED);
+	}
+
+	memset(&config, 0, sizeof(config));
+	config.channel = DMA_Channel_0;
+	config.peripheral = &sim_data_register;
+	config.item_size = sizeof(uint32_t);
+	config.priority = DMA_Priority_High;
+	config.buffers = buffers;
+	config.buffer_count = SIM_BUFFERS;
+	config.buffer_size = SIM_BUFFER_SIZE;
+
+	configASSERT(dma_stream_claim(&stream, SIM_CONTROLLER, SIM_STREAM) == pdPASS);
+	configASSERT(dma_stream_claim(&stream, SIM_CONTROLLER, SIM_STREAM) == pdFAIL);
+	configASSERT(dma_stream_start(&stream, &config) == pdPASS);
+
+	pthread_create(&controller, NULL, dma_controller_thread, NULL);
+
+	for (uint32_t phase = 0; phase < 2; phase++)
+	{
+		corrupt = 0;
+
+		for (uint32_t received = 0; received < SIM_PHASE_BUFFERS; received++)
+		{
+			configASSERT(dma_stream_receive(&stream, &buffer, portMAX_DELAY) == pdPASS);
+
+			expected = buffer.sequence * SIM_WORDS;
+			for (uint32_t word = 0; word < SIM_WORDS; word++)
+			{
+				if (((uint32_t *) buffer.data)[word] != expected + word)
+				{
+					corrupt++;
+					break;
+				}
+			}
+
+			if (phase == 1)
+			{
+				vTaskDelay(SIM_SLOW_RELEASE);
+			}
+
+			dma_stream_release(&stream, &buffer);
+		}
+
+		print_phase((phase == 0) ? "fast," : "slow,", corrupt);
+	}
+
+	dma_stream_free(&stream);
+	stop = pdTRUE;
+	pthread_join(controller, NULL);
+
+	exit(0);
+}
+
+// driver funtion
+int main(void)
+{
+	dma_manager_init(&sim_dma_hw);
+	vPortSetInterruptHandler(SIM_INTERRUPT, dma_interrupt_handler);
+
+	sim_run(receive_task, "Receive", configMAX_PRIORITIES - 1);
+}
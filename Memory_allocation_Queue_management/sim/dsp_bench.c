@@ -0,0 +1,568 @@
+/**
+  ******************************************************************************
+  * @file    dsp_bench.c
+  * @brief   Host check and benchmark of the CMSIS-DSP kernels in CMSIS/DSP.
+  * 		 Each kernel is run on pseudo random data and compared with a
+  * 		 reference written here: bit for bit against one that does the
+  * 		 same arithmetic in the same order, or within a tolerance of one
+  * 		 in double precision, and the FFT against a direct DFT.  It then
+  * 		 prints the cycles each kernel takes per sample.  Built with
+  * 		 ARM_MATH_CM4 it runs the kernels' unrolled paths, which the
+  * 		 target uses, and with ARM_MATH_CM0 their plain loops.  See
+  * 		 README.md for the build command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+#define BENCH_RUNS				(200)
+#define BENCH_SIGNAL			(1024)
+#define BENCH_FIR_TAPS			(29)
+#define BENCH_FIR_BLOCK			(256)
+#define BENCH_DECIMATE_TAPS		(32)
+#define BENCH_DECIMATION		(4)
+#define BENCH_SECTIONS			(2)
+#define BENCH_FFT_MAX			(4096)
+#define BENCH_MATRIX_MAX		(16)
+
+// Uneven block sizes reach the tails of the unrolled loops
+static const uint32_t block_sizes[] = { 256, 13, 1, 100 };
+
+static uint32_t random_state = 1;
+static uint32_t failures;
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+
+// The time stamp counter, which runs at the processor's nominal clock
+#define BENCH_UNIT				"cycles"
+
+static uint64_t bench_now(void)
+{
+	return __rdtsc();
+}
+#else
+#define BENCH_UNIT				"ns"
+
+static uint64_t bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+#endif
+
+// A small deterministic generator, so every run sees the same data
+static float next_random(void)
+{
+	random_state = (random_state * 1103515245UL) + 12345UL;
+	return ((float) ((random_state >> 8) & 0xFFFF) / 32768.0f) - 1.0f;
+}
+
+static void fill_random(float32_t *data, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++)
+	{
+		data[i] = next_random();
+	}
+}
+
+static void report(const char *kernel, const char *check, int passed, double error)
+{
+	printf("%-30s %-22s %s (%.3g)\n", kernel, check, passed ? "ok" : "FAILED", error);
+
+	if (!passed)
+	{
+		failures++;
+	}
+}
+
+static void report_speed(const char *kernel, uint64_t ticks, uint32_t samples)
+{
+	printf("%-30s %8.2f %s/sample\n", kernel, (double) ticks / samples, BENCH_UNIT);
+}
+
+// Runs a kernel BENCH_RUNS times, returning the quickest
+#define BENCH(ticks, call)							\
+	do												\
+	{												\
+		(ticks) = UINT64_MAX;						\
+		for (uint32_t run = 0; run < BENCH_RUNS; run++)	\
+		{											\
+			uint64_t start = bench_now();			\
+			call;									\
+			uint64_t spent = bench_now() - start;	\
+			if (spent < (ticks))					\
+			{										\
+				(ticks) = spent;					\
+			}										\
+		}											\
+	} while (0)
+
+// y[n] = sum of coeffs[k] x[n - (taps - 1) + k], adding in order of k as
+// the kernels do, in float and in double
+static void fir_reference(const float32_t *coeffs, uint32_t taps, const float32_t *x, uint32_t n,
+		float32_t *single, double *dbl)
+{
+	float32_t acc = 0.0f;
+	double acc_dbl = 0.0;
+
+	for (uint32_t k = 0; k < taps; k++)
+	{
+		int32_t index = (int32_t) n - (int32_t) (taps - 1) + (int32_t) k;
+		float32_t sample = (index >= 0) ? x[index] : 0.0f;
+
+		acc += coeffs[k] * sample;
+		acc_dbl += (double) coeffs[k] * sample;
+	}
+
+	*single = acc;
+	*dbl = acc_dbl;
+}
+
+static void check_fir(void)
+{
+	static float32_t coeffs[BENCH_FIR_TAPS], state[BENCH_FIR_TAPS + BENCH_FIR_BLOCK - 1];
+	static float32_t x[BENCH_SIGNAL], y[BENCH_SIGNAL];
+	arm_fir_instance_f32 fir;
+	uint32_t done, mismatches = 0;
+	double error = 0.0, reference_dbl;
+	float32_t reference;
+	uint64_t ticks;
+
+	fill_random(coeffs, BENCH_FIR_TAPS);
+	fill_random(x, BENCH_SIGNAL);
+
+	// Through the signal in uneven blocks, so the state carries over
+	arm_fir_init_f32(&fir, BENCH_FIR_TAPS, coeffs, state, BENCH_FIR_BLOCK);
+	done = 0;
+	for (uint32_t i = 0; done < BENCH_SIGNAL; i++)
+	{
+		uint32_t block = block_sizes[i % (sizeof(block_sizes) / sizeof(block_sizes[0]))];
+
+		block = (block > (BENCH_SIGNAL - done)) ? (BENCH_SIGNAL - done) : block;
+		arm_fir_f32(&fir, &x[done], &y[done], block);
+		done += block;
+	}
+
+	for (uint32_t n = 0; n < BENCH_SIGNAL; n++)
+	{
+		fir_reference(coeffs, BENCH_FIR_TAPS, x, n, &reference, &reference_dbl);
+		mismatches += (y[n] != reference) ? 1 : 0;
+		error = fmax(error, fabs(y[n] - reference_dbl));
+	}
+
+	report("arm_fir_f32", "same order", mismatches == 0, mismatches);
+	report("arm_fir_f32", "double", error < 1e-5, error);
+
+	BENCH(ticks, arm_fir_f32(&fir, x, y, BENCH_FIR_BLOCK));
+	report_speed("arm_fir_f32 29 taps", ticks, BENCH_FIR_BLOCK);
+}
+
+static void check_fir_decimate(void)
+{
+	static float32_t coeffs[BENCH_DECIMATE_TAPS], state[BENCH_DECIMATE_TAPS + BENCH_FIR_BLOCK - 1];
+	static float32_t x[BENCH_SIGNAL], y[BENCH_SIGNAL / BENCH_DECIMATION];
+	arm_fir_decimate_instance_f32 decimator;
+	uint32_t mismatches = 0;
+	double error = 0.0, reference_dbl;
+	float32_t reference;
+	uint64_t ticks;
+
+	fill_random(coeffs, BENCH_DECIMATE_TAPS);
+	fill_random(x, BENCH_SIGNAL);
+
+	report("arm_fir_decimate_init_f32", "length error",
+			arm_fir_decimate_init_f32(&decimator, BENCH_DECIMATE_TAPS, BENCH_DECIMATION, coeffs, state, 255) ==
+			ARM_MATH_LENGTH_ERROR, 0);
+
+	arm_fir_decimate_init_f32(&decimator, BENCH_DECIMATE_TAPS, BENCH_DECIMATION, coeffs, state, BENCH_FIR_BLOCK);
+	for (uint32_t done = 0; done < BENCH_SIGNAL; done += BENCH_FIR_BLOCK)
+	{
+		arm_fir_decimate_f32(&decimator, &x[done], &y[done / BENCH_DECIMATION], BENCH_FIR_BLOCK);
+	}
+
+	for (uint32_t m = 0; m < (BENCH_SIGNAL / BENCH_DECIMATION); m++)
+	{
+		fir_reference(coeffs, BENCH_DECIMATE_TAPS, x, m * BENCH_DECIMATION, &reference, &reference_dbl);
+		mismatches += (y[m] != reference) ? 1 : 0;
+		error = fmax(error, fabs(y[m] - reference_dbl));
+	}
+
+	report("arm_fir_decimate_f32", "same order", mismatches == 0, mismatches);
+	report("arm_fir_decimate_f32", "double", error < 1e-5, error);
+
+	BENCH(ticks, arm_fir_decimate_f32(&decimator, x, y, BENCH_FIR_BLOCK));
+	report_speed("arm_fir_decimate_f32 32/4", ticks, BENCH_FIR_BLOCK);
+}
+
+// Two low pass sections, with the feedback coefficients negated
+static const float32_t biquad_coeffs[5 * BENCH_SECTIONS] =
+{
+	0.0675f, 0.1349f, 0.0675f, 1.1430f, -0.4128f,
+	0.0902f, 0.1804f, 0.0902f, 1.2850f, -0.6458f
+};
+
+static void check_biquad_f32(void)
+{
+	static float32_t x[BENCH_SIGNAL], y[BENCH_SIGNAL], stage[BENCH_SIGNAL];
+	float32_t coeffs[5 * BENCH_SECTIONS], state[4 * BENCH_SECTIONS];
+	arm_biquad_casd_df1_inst_f32 biquad;
+	uint32_t done = 0, mismatches = 0;
+	uint64_t ticks;
+
+	memcpy(coeffs, biquad_coeffs, sizeof(coeffs));
+	fill_random(x, BENCH_SIGNAL);
+
+	// In place, in uneven blocks
+	memcpy(y, x, sizeof(y));
+	arm_biquad_cascade_df1_init_f32(&biquad, BENCH_SECTIONS, coeffs, state);
+	for (uint32_t i = 0; done < BENCH_SIGNAL; i++)
+	{
+		uint32_t block = block_sizes[i % (sizeof(block_sizes) / sizeof(block_sizes[0]))];
+
+		block = (block > (BENCH_SIGNAL - done)) ? (BENCH_SIGNAL - done) : block;
+		arm_biquad_cascade_df1_f32(&biquad, &y[done], &y[done], block);
+		done += block;
+	}
+
+	memcpy(stage, x, sizeof(stage));
+	for (uint32_t section = 0; section < BENCH_SECTIONS; section++)
+	{
+		const float32_t *c = &biquad_coeffs[5 * section];
+		float32_t x1 = 0.0f, x2 = 0.0f, y1 = 0.0f, y2 = 0.0f, out;
+
+		for (uint32_t n = 0; n < BENCH_SIGNAL; n++)
+		{
+			out = (c[0] * stage[n]) + (c[1] * x1) + (c[2] * x2) + (c[3] * y1) + (c[4] * y2);
+			x2 = x1;
+			x1 = stage[n];
+			y2 = y1;
+			y1 = out;
+			stage[n] = out;
+		}
+	}
+
+	for (uint32_t n = 0; n < BENCH_SIGNAL; n++)
+	{
+		mismatches += (y[n] != stage[n]) ? 1 : 0;
+	}
+
+	report("arm_biquad_cascade_df1_f32", "same order", mismatches == 0, mismatches);
+
+	BENCH(ticks, arm_biquad_cascade_df1_f32(&biquad, x, y, BENCH_FIR_BLOCK));
+	report_speed("arm_biquad_cascade_df1_f32 x2", ticks, BENCH_FIR_BLOCK);
+}
+
+static void check_biquad_q31(void)
+{
+	static q31_t x[BENCH_SIGNAL], y[BENCH_SIGNAL], stage[BENCH_SIGNAL];
+	q31_t coeffs[5 * BENCH_SECTIONS], state[4 * BENCH_SECTIONS];
+	arm_biquad_casd_df1_inst_q31 biquad;
+	uint32_t done = 0, mismatches = 0;
+	double error = 0.0, reference;
+	uint64_t ticks;
+
+	// Halved to fit 1.31, with a post shift of 1
+	for (uint32_t i = 0; i < (5 * BENCH_SECTIONS); i++)
+	{
+		coeffs[i] = (q31_t) lround(biquad_coeffs[i] * 0.5 * 2147483648.0);
+	}
+
+	// Half scale, so the filters' gain cannot overflow
+	for (uint32_t n = 0; n < BENCH_SIGNAL; n++)
+	{
+		x[n] = (q31_t) (next_random() * 1073741824.0f);
+	}
+
+	arm_biquad_cascade_df1_init_q31(&biquad, BENCH_SECTIONS, coeffs, state, 1);
+	for (uint32_t i = 0; done < BENCH_SIGNAL; i++)
+	{
+		uint32_t block = block_sizes[i % (sizeof(block_sizes) / sizeof(block_sizes[0]))];
+
+		block = (block > (BENCH_SIGNAL - done)) ? (BENCH_SIGNAL - done) : block;
+		arm_biquad_cascade_df1_q31(&biquad, &x[done], &y[done], block);
+		done += block;
+	}
+
+	memcpy(stage, x, sizeof(stage));
+	for (uint32_t section = 0; section < BENCH_SECTIONS; section++)
+	{
+		const q31_t *c = &coeffs[5 * section];
+		q31_t x1 = 0, x2 = 0, y1 = 0, y2 = 0, out;
+
+		for (uint32_t n = 0; n < BENCH_SIGNAL; n++)
+		{
+			int64_t acc = ((int64_t) c[0] * stage[n]) + ((int64_t) c[1] * x1) + ((int64_t) c[2] * x2) +
+					((int64_t) c[3] * y1) + ((int64_t) c[4] * y2);
+
+			out = (q31_t) (acc >> 30);
+			x2 = x1;
+			x1 = stage[n];
+			y2 = y1;
+			y1 = out;
+			stage[n] = out;
+		}
+	}
+
+	// The floating point cascade on the same input, for the error of Q31
+	{
+		static float32_t xf[BENCH_SIGNAL];
+		float32_t coeffs_f[5 * BENCH_SECTIONS], state_f[4 * BENCH_SECTIONS];
+		arm_biquad_casd_df1_inst_f32 biquad_f;
+
+		memcpy(coeffs_f, biquad_coeffs, sizeof(coeffs_f));
+		for (uint32_t n = 0; n < BENCH_SIGNAL; n++)
+		{
+			xf[n] = (float32_t) x[n] / 2147483648.0f;
+		}
+
+		arm_biquad_cascade_df1_init_f32(&biquad_f, BENCH_SECTIONS, coeffs_f, state_f);
+		arm_biquad_cascade_df1_f32(&biquad_f, xf, xf, BENCH_SIGNAL);
+
+		for (uint32_t n = 0; n < BENCH_SIGNAL; n++)
+		{
+			mismatches += (y[n] != stage[n]) ? 1 : 0;
+			reference = xf[n];
+			error = fmax(error, fabs(((double) y[n] / 2147483648.0) - reference));
+		}
+	}
+
+	report("arm_biquad_cascade_df1_q31", "bit exact", mismatches == 0, mismatches);
+	report("arm_biquad_cascade_df1_q31", "float", error < 1e-5, error);
+
+	BENCH(ticks, arm_biquad_cascade_df1_q31(&biquad, x, y, BENCH_FIR_BLOCK));
+	report_speed("arm_biquad_cascade_df1_q31 x2", ticks, BENCH_FIR_BLOCK);
+}
+
+static uint32_t bit_reverse(uint32_t index, uint32_t length)
+{
+	uint32_t reversed = 0;
+
+	for (uint32_t bit = 1; bit < length; bit <<= 1)
+	{
+		reversed = (reversed << 1) | (((index & bit) != 0) ? 1 : 0);
+	}
+
+	return reversed;
+}
+
+static void check_cfft(const arm_cfft_instance_f32 *fft)
+{
+	static float32_t x[2 * BENCH_FFT_MAX], y[2 * BENCH_FFT_MAX], unordered[2 * BENCH_FFT_MAX];
+	static double dft[2 * BENCH_FFT_MAX], cosine[BENCH_FFT_MAX], sine[BENCH_FFT_MAX];
+	uint32_t length = fft->fftLen, mismatches = 0;
+	double error = 0.0, roundtrip = 0.0, peak = 0.0;
+	char name[32];
+	uint64_t ticks;
+
+	fill_random(x, 2 * length);
+
+	for (uint32_t i = 0; i < length; i++)
+	{
+		cosine[i] = cos((2.0 * M_PI * i) / length);
+		sine[i] = sin((2.0 * M_PI * i) / length);
+	}
+
+	for (uint32_t k = 0; k < length; k++)
+	{
+		double re = 0.0, im = 0.0;
+
+		for (uint32_t n = 0; n < length; n++)
+		{
+			uint32_t w = (uint32_t) (((uint64_t) k * n) % length);
+
+			re += (x[2 * n] * cosine[w]) + (x[(2 * n) + 1] * sine[w]);
+			im += (x[(2 * n) + 1] * cosine[w]) - (x[2 * n] * sine[w]);
+		}
+
+		dft[2 * k] = re;
+		dft[(2 * k) + 1] = im;
+		peak = fmax(peak, sqrt((re * re) + (im * im)));
+	}
+
+	memcpy(y, x, 2 * length * sizeof(float32_t));
+	arm_cfft_f32(fft, y, 0, 1);
+	for (uint32_t i = 0; i < (2 * length); i++)
+	{
+		error = fmax(error, fabs(y[i] - dft[i]));
+	}
+
+	memcpy(unordered, x, 2 * length * sizeof(float32_t));
+	arm_cfft_f32(fft, unordered, 0, 0);
+	for (uint32_t k = 0; k < length; k++)
+	{
+		uint32_t r = bit_reverse(k, length);
+
+		mismatches += ((unordered[2 * r] != y[2 * k]) || (unordered[(2 * r) + 1] != y[(2 * k) + 1])) ? 1 : 0;
+	}
+
+	arm_cfft_f32(fft, y, 1, 1);
+	for (uint32_t i = 0; i < (2 * length); i++)
+	{
+		roundtrip = fmax(roundtrip, fabs(y[i] - x[i]));
+	}
+
+	snprintf(name, sizeof(name), "arm_cfft_f32 %lu", (unsigned long) length);
+	report(name, "DFT, of peak", (error / peak) < 1e-6, error / peak);
+	report(name, "bit reversed order", mismatches == 0, mismatches);
+	report(name, "inverse", roundtrip < 1e-5, roundtrip);
+
+	if ((length == 64) || (length == 256) || (length == 1024))
+	{
+		BENCH(ticks, arm_cfft_f32(fft, y, 0, 1));
+		report_speed(name, ticks, length);
+	}
+}
+
+static void matrix_mult_reference(const float32_t *a, const float32_t *b, float32_t *c, uint32_t m, uint32_t n,
+		uint32_t p)
+{
+	for (uint32_t row = 0; row < m; row++)
+	{
+		for (uint32_t col = 0; col < p; col++)
+		{
+			float32_t sum = 0.0f;
+
+			for (uint32_t k = 0; k < n; k++)
+			{
+				sum += a[(row * n) + k] * b[(k * p) + col];
+			}
+
+			c[(row * p) + col] = sum;
+		}
+	}
+}
+
+static void check_matrix(void)
+{
+	static float32_t a[BENCH_MATRIX_MAX * BENCH_MATRIX_MAX], b[BENCH_MATRIX_MAX * BENCH_MATRIX_MAX];
+	static float32_t c[BENCH_MATRIX_MAX * BENCH_MATRIX_MAX], reference[BENCH_MATRIX_MAX * BENCH_MATRIX_MAX];
+	static float32_t work[BENCH_MATRIX_MAX * BENCH_MATRIX_MAX];
+	arm_matrix_instance_f32 ma, mb, mc, mw;
+	uint32_t mismatches = 0;
+	double error = 0.0;
+	arm_status status;
+	uint64_t ticks;
+
+	fill_random(a, BENCH_MATRIX_MAX * BENCH_MATRIX_MAX);
+	fill_random(b, BENCH_MATRIX_MAX * BENCH_MATRIX_MAX);
+
+	// Uneven sizes, 7 by 13 times 13 by 5
+	arm_mat_init_f32(&ma, 7, 13, a);
+	arm_mat_init_f32(&mb, 13, 5, b);
+	arm_mat_init_f32(&mc, 7, 5, c);
+	status = arm_mat_mult_f32(&ma, &mb, &mc);
+	matrix_mult_reference(a, b, reference, 7, 13, 5);
+	for (uint32_t i = 0; i < (7 * 5); i++)
+	{
+		mismatches += (c[i] != reference[i]) ? 1 : 0;
+	}
+	report("arm_mat_mult_f32", "same order", (status == ARM_MATH_SUCCESS) && (mismatches == 0), mismatches);
+
+	arm_mat_init_f32(&mc, 5, 5, c);
+	report("arm_mat_mult_f32", "size mismatch", arm_mat_mult_f32(&ma, &mb, &mc) == ARM_MATH_SIZE_MISMATCH, 0);
+
+	// Transposing twice gives the matrix back
+	arm_mat_init_f32(&mc, 13, 7, c);
+	arm_mat_init_f32(&mw, 7, 13, work);
+	arm_mat_trans_f32(&ma, &mc);
+	arm_mat_trans_f32(&mc, &mw);
+	report("arm_mat_trans_f32", "twice", (c[1] == a[13]) && (memcmp(work, a, 7 * 13 * sizeof(float32_t)) == 0), 0);
+
+	// a + b - b is a when b is a power of 2 times a
+	arm_mat_init_f32(&ma, 9, 9, a);
+	arm_mat_init_f32(&mb, 9, 9, b);
+	arm_mat_init_f32(&mc, 9, 9, c);
+	arm_mat_scale_f32(&ma, 4.0f, &mb);
+	arm_mat_add_f32(&ma, &mb, &mc);
+	arm_mat_sub_f32(&mc, &mb, &mc);
+	report("arm_mat_add/sub/scale_f32", "exact", memcmp(c, a, 9 * 9 * sizeof(float32_t)) == 0, 0);
+
+	// A diagonally dominant matrix times its inverse is the identity
+	fill_random(a, 8 * 8);
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		a[(i * 8) + i] += 8.0f;
+	}
+	memcpy(work, a, 8 * 8 * sizeof(float32_t));
+	arm_mat_init_f32(&mw, 8, 8, work);
+	arm_mat_init_f32(&mb, 8, 8, b);
+	status = arm_mat_inverse_f32(&mw, &mb);
+	matrix_mult_reference(a, b, c, 8, 8, 8);
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		for (uint32_t j = 0; j < 8; j++)
+		{
+			error = fmax(error, fabs(c[(i * 8) + j] - ((i == j) ? 1.0 : 0.0)));
+		}
+	}
+	report("arm_mat_inverse_f32", "A inverse(A)", (status == ARM_MATH_SUCCESS) && (error < 1e-5), error);
+
+	memset(work, 0, sizeof(work));
+	report("arm_mat_inverse_f32", "singular", arm_mat_inverse_f32(&mw, &mb) == ARM_MATH_SINGULAR, 0);
+
+	fill_random(a, BENCH_MATRIX_MAX * BENCH_MATRIX_MAX);
+	for (uint32_t size = 4; size <= BENCH_MATRIX_MAX; size *= 2)
+	{
+		char name[32];
+
+		arm_mat_init_f32(&ma, size, size, a);
+		arm_mat_init_f32(&mb, size, size, b);
+		arm_mat_init_f32(&mc, size, size, c);
+
+		BENCH(ticks, arm_mat_mult_f32(&ma, &mb, &mc));
+		snprintf(name, sizeof(name), "arm_mat_mult_f32 %lux%lu", (unsigned long) size, (unsigned long) size);
+		report_speed(name, ticks, size * size);
+	}
+
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		a[(i * 8) + i] += 8.0f;
+	}
+	arm_mat_init_f32(&mw, 8, 8, work);
+	arm_mat_init_f32(&mb, 8, 8, b);
+	BENCH(ticks, (memcpy(work, a, 8 * 8 * sizeof(float32_t)), arm_mat_inverse_f32(&mw, &mb)));
+	report_speed("arm_mat_inverse_f32 8x8", ticks, 8 * 8);
+}
+
+// driver funtion
+int main(void)
+{
+	static const arm_cfft_instance_f32 *const ffts[] =
+	{
+		&arm_cfft_sR_f32_len16, &arm_cfft_sR_f32_len32, &arm_cfft_sR_f32_len64,
+		&arm_cfft_sR_f32_len128, &arm_cfft_sR_f32_len256, &arm_cfft_sR_f32_len512,
+		&arm_cfft_sR_f32_len1024, &arm_cfft_sR_f32_len2048, &arm_cfft_sR_f32_len4096
+	};
+
+#ifdef ARM_MATH_CM0_FAMILY
+	printf("Plain loops (ARM_MATH_CM0)\n");
+#else
+	printf("Unrolled (ARM_MATH_CM4)\n");
+#endif
+
+	check_fir();
+	check_fir_decimate();
+	check_biquad_f32();
+	check_biquad_q31();
+
+	for (uint32_t i = 0; i < (sizeof(ffts) / sizeof(ffts[0])); i++)
+	{
+		check_cfft(ffts[i]);
+	}
+
+	check_matrix();
+
+	printf("%lu failed\n", (unsigned long) failures);
+
+	return (failures == 0) ? 0 : 1;
+}
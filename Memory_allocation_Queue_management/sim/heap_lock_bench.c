@@ -0,0 +1,162 @@
+/**
+  ******************************************************************************
+  * @file    heap_lock_bench.c
+  * @brief   Host simulation measuring how long a high priority task takes to
+  * 		 run after an interrupt while lower priority tasks keep the heap
+  * 		 busy.  A host thread standing in for a peripheral raises the
+  * 		 simulated interrupt, which takes a block reserved for interrupts
+  * 		 (pvPortMallocFromISR()) and queues it to the high priority task.
+  * 		 Build once with each configHEAP_LOCKING to compare suspending the
+  * 		 scheduler with masking interrupts.  See README.md for the build
+  * 		 command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "sim_common.h"
+
+#if (configHEAP_ISR_BLOCK_COUNT == 0)
+	#error Build with configHEAP_ISR_BLOCK_COUNT greater than 0
+#endif
+
+#define BENCH_CHURN_TASKS		(2)
+#define BENCH_LIVE_BLOCKS		(256)
+#define BENCH_MAX_BLOCK			(200)
+#define BENCH_SAMPLES			(2000)
+#define BENCH_PERIOD_NS			(500000L)
+#define BENCH_INTERRUPT			(portFIRST_USER_INTERRUPT)
+
+// What the interrupt passes to the high priority task in its reserved block
+typedef struct
+{
+	uint32_t raised_at;
+} Event_st;
+
+static QueueHandle_t event_queue;
+static volatile uint32_t raised_at;
+static volatile BaseType_t stop;
+static uint32_t latency[BENCH_SAMPLES];
+static volatile uint32_t isr_failures;
+
+// Keeps many blocks of random sizes live, replacing one at a time, so every
+// allocation walks a long free list
+static void churn_task(void *params)
+{
+	static void *blocks[BENCH_CHURN_TASKS][BENCH_LIVE_BLOCKS];
+	uint32_t index = (uint32_t) (uintptr_t) params;
+	uint32_t seed = index + 1, slot;
+
+	for(;;)
+	{
+		seed = (seed * 1103515245UL) + 12345UL;
+		slot = (seed >> 8) % BENCH_LIVE_BLOCKS;
+
+		vPortFree(blocks[index][slot]);
+		blocks[index][slot] = pvPortMalloc(8 + ((seed >> 16) % BENCH_MAX_BLOCK));
+	}
+}
+
+static uint32_t interrupt_handler(void)
+{
+	BaseType_t woken = pdFALSE;
+	Event_st *event = pvPortMallocFromISR(sizeof(Event_st));
+
+	if (event != NULL)
+	{
+		event->raised_at = raised_at;
+		xQueueSendFromISR(event_queue, &event, &woken);
+	}
+	else
+	{
+		isr_failures++;
+	}
+
+	return (uint32_t) woken;
+}
+
+// Stands in for a peripheral, raising the interrupt at a fixed rate
+static void *peripheral_thread(void *params)
+{
+	struct timespec period = { 0, BENCH_PERIOD_NS };
+
+	(void) params;
+
+	while (stop == pdFALSE)
+	{
+		nanosleep(&period, NULL);
+		raised_at = ulPortGetTraceTimestamp();
+		vPortGenerateSimulatedInterrupt(BENCH_INTERRUPT);
+	}
+
+	return NULL;
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *) a, y = *(const uint32_t *) b;
+
+	return (x > y) - (x < y);
+}
+
+// Measures the time from raising each interrupt to running, then prints the
+// mean, 99th percentile and worst latency
+static void high_priority_task(void *params)
+{
+	pthread_t peripheral;
+	Event_st *event;
+	uint64_t total = 0;
+	uint32_t sample;
+
+	(void) params;
+
+	pthread_create(&peripheral, NULL, peripheral_thread, NULL);
+
+	for (sample = 0; sample < BENCH_SAMPLES; sample++)
+	{
+		xQueueReceive(event_queue, &event, portMAX_DELAY);
+		latency[sample] = ulPortGetTraceTimestamp() - event->raised_at;
+		total += latency[sample];
+
+		// A reserved block can be freed with vPortFree() too
+		vPortFree(event);
+	}
+
+	stop = pdTRUE;
+	qsort(latency, BENCH_SAMPLES, sizeof(uint32_t), compare_u32);
+
+	sim_print_lock();
+	{
+		printf("cores: %d, heap locking: %s, wake up latency mean %lu ns, 99%% %lu ns, worst %lu ns, "
+				"reserved blocks min free %lu of %d, failed %lu\n", configNUMBER_OF_CORES,
+				(configHEAP_LOCKING == heapLOCKING_MASK_INTERRUPTS) ? "mask interrupts" : "suspend scheduler",
+				(unsigned long) (total / BENCH_SAMPLES), (unsigned long) latency[(BENCH_SAMPLES * 99) / 100],
+				(unsigned long) latency[BENCH_SAMPLES - 1], (unsigned long) xPortGetMinimumEverFreeIsrBlockCount(),
+				configHEAP_ISR_BLOCK_COUNT, (unsigned long) isr_failures);
+		exit(0);
+	}
+	sim_print_unlock();
+}
+
+// driver funtion
+int main(void)
+{
+	uint32_t i;
+
+	event_queue = xQueueCreate(configHEAP_ISR_BLOCK_COUNT, sizeof(Event_st *));
+	configASSERT(event_queue != NULL);
+	vPortSetInterruptHandler(BENCH_INTERRUPT, interrupt_handler);
+
+	for (i = 0; i < BENCH_CHURN_TASKS; i++)
+	{
+		xTaskCreate(churn_task, "Churn", SIM_STACK_SIZE, (void *) (uintptr_t) i, 1, NULL);
+	}
+
+	sim_run(high_priority_task, "High", configMAX_PRIORITIES - 1);
+}
@@ -0,0 +1,107 @@
+/**
+  ******************************************************************************
+  * @file    heap_trace_demo.c
+  * @brief   Host simulation of the heap trace (heap_trace.h).  Worker tasks
+  * 		 allocate and free messages of random sizes while keeping a few
+  * 		 long lived buffers, and some of them are deleted while still
+  * 		 holding memory.  The heap trace image is then written to a file
+  * 		 that tools/heap_trace_report.c turns into a leak and
+  * 		 fragmentation report.  See README.md for the build command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "heap_trace.h"
+#include "sim_common.h"
+
+#if (configUSE_HEAP_TRACE != 1)
+	#error Build with -DconfigUSE_HEAP_TRACE=1
+#endif
+
+#define DEMO_WORKERS			(4)
+#define DEMO_KEPT				(4)
+#define DEMO_MAX_MESSAGE		(600)
+#define DEMO_RUN_TICKS			(pdMS_TO_TICKS(200))
+
+static TaskHandle_t worker[DEMO_WORKERS];
+static FILE *trace_file;
+
+// Allocates and frees messages, replacing one of its kept buffers each round.
+// The kept buffers are never freed, so they leak when the task is deleted.
+static void worker_task(void *params)
+{
+	uint32_t seed = (uint32_t) (uintptr_t) params;
+	void *kept[DEMO_KEPT] = { NULL };
+	void *message;
+	uint32_t round = 0;
+
+	for(;;)
+	{
+		seed = (seed * 1103515245UL) + 12345UL;
+		message = pvPortMalloc(16 + ((seed >> 8) % DEMO_MAX_MESSAGE));
+		configASSERT(message != NULL);
+
+		vPortFree(kept[round % DEMO_KEPT]);
+		kept[round % DEMO_KEPT] = pvPortMalloc(32 + ((seed >> 16) % (DEMO_MAX_MESSAGE / 2)));
+
+		vPortFree(message);
+		round++;
+		vTaskDelay(1);
+	}
+}
+
+static void write_trace(const void *data, size_t length)
+{
+	fwrite(data, 1, length, trace_file);
+}
+
+// Deletes half of the workers part way through the run, then writes the image
+static void dump_task(void *params)
+{
+	size_t orphaned_bytes;
+	UBaseType_t orphans;
+	uint32_t i;
+
+	(void) params;
+
+	vTaskDelay(DEMO_RUN_TICKS / 2);
+
+	for (i = 0; i < (DEMO_WORKERS / 2); i++)
+	{
+		vTaskDelete(worker[i]);
+	}
+
+	vTaskDelay(DEMO_RUN_TICKS / 2);
+
+	sim_print_lock();
+	{
+		orphans = uxHeapTraceGetOrphans(&orphaned_bytes);
+		vHeapTraceDump(write_trace);
+		fclose(trace_file);
+		printf("cores: %d, %lu allocations (%lu bytes) leaked by deleted tasks, heap trace image written\n",
+				configNUMBER_OF_CORES, (unsigned long) orphans, (unsigned long) orphaned_bytes);
+		exit(0);
+	}
+	sim_print_unlock();
+}
+
+// driver funtion
+int main(int argc, char **argv)
+{
+	uint32_t i;
+
+	trace_file = fopen((argc > 1) ? argv[1] : "heap.bin", "wb");
+	configASSERT(trace_file != NULL);
+
+	for (i = 0; i < DEMO_WORKERS; i++)
+	{
+		xTaskCreate(worker_task, "Worker", SIM_STACK_SIZE, (void *) (uintptr_t) (i + 1), 1, &worker[i]);
+		configASSERT(worker[i] != NULL);
+	}
+
+	sim_run(dump_task, "Dump", configMAX_PRIORITIES - 1);
+}
@@ -0,0 +1,812 @@
+/**
+  ******************************************************************************
+  * @file    i2c_sim.c
+  * @brief   Host simulation of the I2C master (i2c_bus.h) against simulated
+  * 		 I2C and DMA registers.  A host thread plays the part of the I2C,
+  * 		 the bus at 400kHz and the devices on it, following a script: a
+  * 		 sensor with read only registers, an EEPROM that stretches the
+  * 		 clock after its address, an address nothing answers, and faults
+  * 		 injected at set points, a device that holds the bus and a bus
+  * 		 error.  Each step raises the I2C's interrupt, or a DMA stream's,
+  * 		 and waits for it to be handled, as a device waits on a stretched
+  * 		 clock.  Tasks read the sensor, write and read back the EEPROM and
+  * 		 probe the empty address, checking every byte and status, then
+  * 		 the latency, interrupts and handler time of each transfer are
+  * 		 printed.  See README.md for the build command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include "i2c_bus.h"
+#include "dma_hw_sim.h"
+#include "sim_common.h"
+
+#define SIM_CLOCK_SPEED			(400000)
+#define SIM_POLL_NS				(20000)
+#define SIM_SPIN_NS				(30000)
+#define SIM_RUN_TICKS			(pdMS_TO_TICKS(2000))
+#define SIM_DMA_CONTROLLER		(1)
+#define SIM_RX_STREAM			(0)
+#define SIM_TX_STREAM			(6)
+#define SIM_EVENT_INTERRUPT		(portFIRST_USER_INTERRUPT)
+#define SIM_ERROR_INTERRUPT		(portFIRST_USER_INTERRUPT + 1)
+#define SIM_DMA_INTERRUPT		(portFIRST_USER_INTERRUPT + 2)
+
+// Where the transfer complete flags of streams 0 and 6 are in LISR and HISR
+#define SIM_RX_TCIF				(1UL << 5)
+#define SIM_TX_TCIF				(1UL << 21)
+
+// Bit 5 of SR1 is reserved and reads as 0, so if it is set the bus has
+// written the register to clear an error flag
+#define SIM_SR1_RESERVED		(1U << 5)
+
+// DR holds this when the I2C has taken the byte written to it
+#define SIM_DR_EMPTY			(0x100)
+
+#define SIM_SENSOR_ADDRESS		(0x48)
+#define SIM_EEPROM_ADDRESS		(0x50)
+#define SIM_MISSING_ADDRESS		(0x30)
+#define SIM_EEPROM_STRETCH_US	(100)
+#define SIM_EEPROM_PAGE			(16)
+#define SIM_SENSOR_VALUE(reg)	((uint8_t) (((reg) * 7) + 3))
+
+typedef enum
+{
+	SIM_FAULT_NONE = 0,
+	SIM_FAULT_HOLD,					// The device holds the clock until recovery
+	SIM_FAULT_BUS_ERROR				// A misplaced start or stop
+} sim_fault_t;
+
+typedef struct
+{
+	uint32_t address_phase;			// Counted from 1 over the whole run
+	sim_fault_t fault;
+} sim_script_t;
+
+typedef struct
+{
+	uint8_t address;
+	uint8_t writable;
+	uint32_t stretch_us;			// Clock held low after the address
+	uint8_t pointer;
+	uint8_t registers[256];
+} sim_device_t;
+
+typedef struct
+{
+	const char *name;
+	uint32_t transactions;
+	uint64_t latency_total_us;
+	uint32_t latency_max_us;
+	uint32_t corrupt;
+	uint32_t failed[I2C_CANCELLED + 1];
+} sim_class_t;
+
+// Faults injected at set address phases
+static const sim_script_t script[] =
+{
+	{ 1500, SIM_FAULT_HOLD },
+	{ 3000, SIM_FAULT_BUS_ERROR }
+};
+
+// Simulated registers
+static I2C_TypeDef sim_i2c;
+
+// The streams hold 32 bit addresses, so the buffers the bus moves by DMA are
+// in the low 4GB of the host's address space
+typedef struct
+{
+	uint8_t sensor_tx[1];
+	uint8_t sensor_rx[3];
+	uint8_t eeprom_tx[1 + SIM_EEPROM_PAGE];
+	uint8_t eeprom_rx[SIM_EEPROM_PAGE];
+	uint8_t probe_tx[1];
+} sim_memory_t;
+
+static sim_memory_t *memory;
+static i2c_bus_t bus;
+
+static sim_device_t device[] =
+{
+	{ .address = SIM_SENSOR_ADDRESS, .writable = 0, .stretch_us = 0 },
+	{ .address = SIM_EEPROM_ADDRESS, .writable = 1, .stretch_us = SIM_EEPROM_STRETCH_US }
+};
+
+static sim_class_t sensor_class = { .name = "sensor" };
+static sim_class_t eeprom_class = { .name = "eeprom" };
+static sim_class_t probe_class = { .name = "probe" };
+
+// Interrupts raised by the thread and handled, which it waits to be equal
+static pthread_mutex_t handled_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t handled_signal = PTHREAD_COND_INITIALIZER;
+static uint32_t raised, handled;
+
+static uint64_t sim_time_ns, handler_ns;
+static uint32_t address_phases, protocol_errors, recoveries;
+static volatile BaseType_t held, reset;
+static volatile BaseType_t stop_tasks, stop_controller;
+static volatile uint32_t running_tasks;
+
+// Setting the I2C up after a software reset leaves it as it was at power on
+static void sim_enable(const i2c_bus_config_t *config, FunctionalState state)
+{
+	(void) config;
+
+	sim_i2c.CR1 = (state == ENABLE) ? I2C_CR1_PE : 0;
+	sim_i2c.CR2 = 0;
+	sim_i2c.SR1 = 0;
+	sim_i2c.SR2 = 0;
+	sim_i2c.DR = SIM_DR_EMPTY;
+}
+
+// Nine clocks free a device holding the bus
+static BaseType_t sim_recover(const i2c_bus_config_t *config)
+{
+	(void) config;
+
+	recoveries++;
+	held = pdFALSE;
+	reset = pdTRUE;
+
+	return pdPASS;
+}
+
+static const i2c_hw_t sim_i2c_hw =
+{
+	sim_enable,
+	sim_recover
+};
+
+static uint64_t now_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t) now.tv_sec * 1000000000ULL) + (uint64_t) now.tv_nsec;
+}
+
+// Lets the bus time of some clocks pass, sleeping while far enough ahead
+static void clocks(uint32_t count)
+{
+	struct timespec sleep = { 0, 0 };
+	uint64_t now;
+
+	sim_time_ns += (count * 1000000000ULL) / SIM_CLOCK_SPEED;
+
+	while ((now = now_ns()) < sim_time_ns)
+	{
+		if ((sim_time_ns - now) > SIM_SPIN_NS)
+		{
+			sleep.tv_nsec = (long) (sim_time_ns - now - SIM_SPIN_NS);
+			nanosleep(&sleep, NULL);
+		}
+	}
+}
+
+// Raises an interrupt and waits for it to be handled.  Returns pdFALSE if
+// the I2C has it disabled, as after a timeout.
+static BaseType_t interrupt(uint32_t number, uint16_t enable)
+{
+	if ((number != SIM_DMA_INTERRUPT) && ((sim_i2c.CR2 & enable) == 0))
+	{
+		return pdFALSE;
+	}
+
+	pthread_mutex_lock(&handled_lock);
+	raised++;
+	pthread_mutex_unlock(&handled_lock);
+
+	vPortGenerateSimulatedInterrupt(number);
+
+	pthread_mutex_lock(&handled_lock);
+	while (handled != raised)
+	{
+		pthread_cond_wait(&handled_signal, &handled_lock);
+	}
+	pthread_mutex_unlock(&handled_lock);
+
+	// The time taken to handle it is the time the clock was stretched
+	if (now_ns() > sim_time_ns)
+	{
+		sim_time_ns = now_ns();
+	}
+
+	return pdTRUE;
+}
+
+// Raises the event interrupt with status flags set, which handling it clears
+static BaseType_t event(uint16_t flags, uint16_t enable)
+{
+	BaseType_t delivered;
+
+	__atomic_or_fetch(&sim_i2c.SR1, flags, __ATOMIC_SEQ_CST);
+	delivered = interrupt(SIM_EVENT_INTERRUPT, enable);
+	__atomic_and_fetch(&sim_i2c.SR1, ~flags, __ATOMIC_SEQ_CST);
+
+	return delivered;
+}
+
+// Raises the error interrupt with an error flag set, which the bus must clear
+static void error(uint16_t flag)
+{
+	__atomic_or_fetch(&sim_i2c.SR1, flag, __ATOMIC_SEQ_CST);
+
+	if (interrupt(SIM_ERROR_INTERRUPT, I2C_CR2_ITERREN) == pdFALSE)
+	{
+		protocol_errors++;
+	}
+
+	if ((sim_i2c.SR1 & SIM_SR1_RESERVED) == 0)
+	{
+		protocol_errors++;
+	}
+
+	sim_i2c.SR1 = 0;
+}
+
+// Raises a stream's transfer complete interrupt
+static void dma_complete(DMA_Stream_TypeDef *stream, volatile uint32_t *status, uint32_t flag)
+{
+	__atomic_and_fetch(&stream->CR, ~DMA_SxCR_EN, __ATOMIC_SEQ_CST);
+	__atomic_or_fetch(status, flag, __ATOMIC_SEQ_CST);
+	(void) interrupt(SIM_DMA_INTERRUPT, 0);
+}
+
+// The bytes a stream has moved since it was enabled
+static uint32_t dma_position(DMA_Stream_TypeDef *stream, uint32_t *length)
+{
+	if (*length == 0)
+	{
+		*length = stream->NDTR;
+	}
+
+	return *length - stream->NDTR;
+}
+
+// Takes the next byte to write from DR or the transmit stream
+static BaseType_t fetch(uint8_t *byte, uint32_t *dma_length)
+{
+	DMA_Stream_TypeDef *stream = &sim_stream[SIM_DMA_CONTROLLER - 1][SIM_TX_STREAM];
+
+	if (sim_i2c.DR != SIM_DR_EMPTY)
+	{
+		*byte = (uint8_t) sim_i2c.DR;
+		sim_i2c.DR = SIM_DR_EMPTY;
+		return pdTRUE;
+	}
+
+	if (((sim_i2c.CR2 & I2C_CR2_DMAEN) != 0) && ((stream->CR & DMA_SxCR_EN) != 0) && (stream->NDTR > 0))
+	{
+		*byte = ((uint8_t *) (uintptr_t) stream->M0AR)[dma_position(stream, dma_length)];
+		if (--stream->NDTR == 0)
+		{
+			*dma_length = 0;
+			dma_complete(stream, &sim_controller[SIM_DMA_CONTROLLER - 1].HISR, SIM_TX_TCIF);
+		}
+		return pdTRUE;
+	}
+
+	return pdFALSE;
+}
+
+// The master writes to a device, the first byte setting its register pointer
+static void write_phase(sim_device_t *target)
+{
+	uint32_t dma_length = 0, count = 0;
+	uint8_t byte;
+
+	__atomic_or_fetch(&sim_i2c.SR1, I2C_SR1_TXE, __ATOMIC_SEQ_CST);
+
+	for (;;)
+	{
+		if (fetch(&byte, &dma_length) == pdFALSE)
+		{
+			// With DR empty the buffer interrupt asks for another byte, and
+			// when there is none BTF says the last has gone
+			if ((sim_i2c.CR2 & I2C_CR2_ITBUFEN) != 0)
+			{
+				(void) event(I2C_SR1_TXE, I2C_CR2_ITBUFEN);
+				if (fetch(&byte, &dma_length) == pdFALSE)
+				{
+					continue;
+				}
+			}
+			else
+			{
+				(void) event(I2C_SR1_TXE | I2C_SR1_BTF, I2C_CR2_ITEVTEN);
+				break;
+			}
+		}
+
+		clocks(9);
+
+		if (count++ == 0)
+		{
+			target->pointer = byte;
+		}
+		else if (target->writable != 0)
+		{
+			target->registers[target->pointer++] = byte;
+		}
+	}
+
+	__atomic_and_fetch(&sim_i2c.SR1, ~I2C_SR1_TXE, __ATOMIC_SEQ_CST);
+}
+
+// The master reads from a device at its register pointer, acknowledging
+// each byte but the last
+static void read_phase(sim_device_t *target)
+{
+	DMA_Stream_TypeDef *stream = &sim_stream[SIM_DMA_CONTROLLER - 1][SIM_RX_STREAM];
+	uint32_t dma_length = 0;
+	BaseType_t acknowledged, stop;
+	uint8_t byte;
+
+	do
+	{
+		// A stop or start asked for while a byte is handled follows the next
+		stop = ((sim_i2c.CR1 & (I2C_CR1_STOP | I2C_CR1_START)) != 0) ? pdTRUE : pdFALSE;
+		byte = target->registers[target->pointer++];
+		clocks(8);
+
+		if (((sim_i2c.CR2 & I2C_CR2_DMAEN) != 0) && ((stream->CR & DMA_SxCR_EN) != 0) && (stream->NDTR > 0))
+		{
+			((uint8_t *) (uintptr_t) stream->M0AR)[dma_position(stream, &dma_length)] = byte;
+			stream->NDTR--;
+
+			// With LAST set the byte the stream ends on is not acknowledged
+			acknowledged = (((sim_i2c.CR1 & I2C_CR1_ACK) != 0) &&
+					(((sim_i2c.CR2 & I2C_CR2_LAST) == 0) || (stream->NDTR > 0))) ? pdTRUE : pdFALSE;
+			clocks(1);
+
+			if (stream->NDTR == 0)
+			{
+				dma_length = 0;
+				dma_complete(stream, &sim_controller[SIM_DMA_CONTROLLER - 1].LISR, SIM_RX_TCIF);
+			}
+		}
+		else
+		{
+			acknowledged = ((sim_i2c.CR1 & I2C_CR1_ACK) != 0) ? pdTRUE : pdFALSE;
+			clocks(1);
+
+			sim_i2c.DR = byte;
+			if (event(I2C_SR1_RXNE, I2C_CR2_ITBUFEN) == pdFALSE)
+			{
+				return;
+			}
+		}
+
+		// A stop after an acknowledged byte leaves the device driving SDA
+		if (stop == pdTRUE)
+		{
+			if (acknowledged == pdTRUE)
+			{
+				protocol_errors++;
+			}
+			break;
+		}
+	} while (acknowledged == pdTRUE);
+}
+
+// Waits for the master to ask for a start or stop
+static BaseType_t wait_for(uint16_t bits)
+{
+	struct timespec poll = { 0, SIM_POLL_NS };
+
+	while (((sim_i2c.CR1 & bits) == 0) && (reset == pdFALSE) && (stop_controller == pdFALSE))
+	{
+		nanosleep(&poll, NULL);
+	}
+
+	return ((sim_i2c.CR1 & bits) != 0) ? pdTRUE : pdFALSE;
+}
+
+// Runs the bus from a start to the stop, or until a fault ends it
+static void transaction(void)
+{
+	struct timespec poll = { 0, SIM_POLL_NS };
+	sim_device_t *target;
+	sim_fault_t fault;
+	uint8_t address;
+
+	sim_time_ns = now_ns();
+
+	for (;;)
+	{
+		// Start or repeated start
+		__atomic_and_fetch(&sim_i2c.CR1, ~I2C_CR1_START, __ATOMIC_SEQ_CST);
+		sim_i2c.SR2 |= I2C_SR2_MSL | I2C_SR2_BUSY;
+		clocks(1);
+
+		if (event(I2C_SR1_SB, I2C_CR2_ITEVTEN) == pdFALSE)
+		{
+			return;
+		}
+
+		address = (uint8_t) sim_i2c.DR;
+		sim_i2c.DR = SIM_DR_EMPTY;
+		clocks(9);
+
+		address_phases++;
+		fault = SIM_FAULT_NONE;
+		for (uint32_t i = 0; i < (sizeof(script) / sizeof(script[0])); i++)
+		{
+			if (script[i].address_phase == address_phases)
+			{
+				fault = script[i].fault;
+			}
+		}
+
+		if (fault == SIM_FAULT_HOLD)
+		{
+			held = pdTRUE;
+			while ((held == pdTRUE) && (stop_controller == pdFALSE))
+			{
+				nanosleep(&poll, NULL);
+			}
+			return;
+		}
+
+		if (fault == SIM_FAULT_BUS_ERROR)
+		{
+			error(I2C_SR1_BERR);
+			return;
+		}
+
+		target = NULL;
+		for (uint32_t i = 0; i < (sizeof(device) / sizeof(device[0])); i++)
+		{
+			if (device[i].address == (address >> 1))
+			{
+				target = &device[i];
+			}
+		}
+
+		if (target == NULL)
+		{
+			error(I2C_SR1_AF);
+		}
+		else
+		{
+			clocks((target->stretch_us * SIM_CLOCK_SPEED) / 1000000UL);
+
+			if ((address & 1) == 0)
+			{
+				sim_i2c.SR2 |= I2C_SR2_TRA;
+			}
+
+			if (event(I2C_SR1_ADDR, I2C_CR2_ITEVTEN) == pdFALSE)
+			{
+				return;
+			}
+
+			if ((address & 1) == 0)
+			{
+				write_phase(target);
+				sim_i2c.SR2 &= ~I2C_SR2_TRA;
+			}
+			else
+			{
+				read_phase(target);
+			}
+		}
+
+		if (wait_for(I2C_CR1_START | I2C_CR1_STOP) == pdFALSE)
+		{
+			return;
+		}
+
+		if ((sim_i2c.CR1 & I2C_CR1_STOP) != 0)
+		{
+			// The next transaction may already have asked for a start
+			__atomic_and_fetch(&sim_i2c.CR1, ~I2C_CR1_STOP, __ATOMIC_SEQ_CST);
+			sim_i2c.SR2 = 0;
+			clocks(1);
+			return;
+		}
+	}
+}
+
+// Plays the I2C, the bus and the devices
+static void *i2c_thread(void *params)
+{
+	(void) params;
+
+	while (stop_controller == pdFALSE)
+	{
+		if (wait_for(I2C_CR1_START) == pdTRUE)
+		{
+			transaction();
+		}
+
+		// The bus recovered and set the I2C up again
+		reset = pdFALSE;
+	}
+
+	return NULL;
+}
+
+static void handled_interrupt(uint64_t start)
+{
+	handler_ns += now_ns() - start;
+
+	pthread_mutex_lock(&handled_lock);
+	handled++;
+	pthread_cond_signal(&handled_signal);
+	pthread_mutex_unlock(&handled_lock);
+}
+
+static uint32_t event_interrupt_handler(void)
+{
+	uint64_t start = now_ns();
+	BaseType_t woken = i2c_event_irq(&sim_i2c);
+
+	handled_interrupt(start);
+	return (uint32_t) woken;
+}
+
+static uint32_t error_interrupt_handler(void)
+{
+	uint64_t start = now_ns();
+	BaseType_t woken = i2c_error_irq(&sim_i2c);
+
+	handled_interrupt(start);
+	return (uint32_t) woken;
+}
+
+static uint32_t dma_interrupt_handler(void)
+{
+	DMA_TypeDef *regs = &sim_controller[SIM_DMA_CONTROLLER - 1];
+	uint64_t start = now_ns();
+	BaseType_t woken = pdFALSE;
+
+	// Each stream has its own interrupt on the target
+	if ((regs->LISR & SIM_RX_TCIF) != 0)
+	{
+		woken |= dma_manager_irq(SIM_DMA_CONTROLLER, SIM_RX_STREAM);
+	}
+
+	if ((regs->HISR & SIM_TX_TCIF) != 0)
+	{
+		woken |= dma_manager_irq(SIM_DMA_CONTROLLER, SIM_TX_STREAM);
+	}
+
+	handled_interrupt(start);
+	return (uint32_t) woken;
+}
+
+static void record(sim_class_t *class, const i2c_transaction_t *transaction, i2c_status_t status)
+{
+	class->transactions++;
+	class->latency_total_us += transaction->latency_us;
+	if (transaction->latency_us > class->latency_max_us)
+	{
+		class->latency_max_us = transaction->latency_us;
+	}
+
+	class->failed[status]++;
+}
+
+// Reads registers of the sensor from reg on, checking what they hold
+static void sensor_read(i2c_transaction_t *transaction, uint8_t reg, uint16_t length)
+{
+	i2c_status_t status;
+
+	memory->sensor_tx[0] = reg;
+	transaction->rx_length = length;
+
+	status = i2c_transfer(&bus, transaction, portMAX_DELAY);
+	record(&sensor_class, transaction, status);
+
+	for (uint16_t i = 0; (status == I2C_DONE) && (i < length); i++)
+	{
+		if (memory->sensor_rx[i] != SIM_SENSOR_VALUE((uint8_t) (reg + i)))
+		{
+			sensor_class.corrupt++;
+		}
+	}
+}
+
+// Reads three registers of the sensor, by interrupt, and then one, every tick
+static void sensor_task(void *params)
+{
+	i2c_transaction_t transaction;
+	uint8_t reg = 0;
+
+	(void) params;
+
+	memset(&transaction, 0, sizeof(transaction));
+	transaction.address = SIM_SENSOR_ADDRESS;
+	transaction.tx = memory->sensor_tx;
+	transaction.tx_length = 1;
+	transaction.rx = memory->sensor_rx;
+
+	while (stop_tasks == pdFALSE)
+	{
+		sensor_read(&transaction, reg, 3);
+		sensor_read(&transaction, (uint8_t) (reg + 11), 1);
+		reg += 22;
+
+		vTaskDelay(1);
+	}
+
+	__atomic_sub_fetch(&running_tasks, 1, __ATOMIC_SEQ_CST);
+	vTaskDelete(NULL);
+}
+
+// Writes a page of the EEPROM and reads it back, both by DMA
+static void eeprom_task(void *params)
+{
+	i2c_transaction_t transaction;
+	i2c_status_t status;
+	uint32_t random = 1;
+
+	(void) params;
+
+	memset(&transaction, 0, sizeof(transaction));
+	transaction.address = SIM_EEPROM_ADDRESS;
+
+	while (stop_tasks == pdFALSE)
+	{
+		random = (random * 1103515245UL) + 12345UL;
+		memory->eeprom_tx[0] = (uint8_t) ((random >> 16) & ~(SIM_EEPROM_PAGE - 1));
+		for (uint32_t i = 0; i < SIM_EEPROM_PAGE; i++)
+		{
+			memory->eeprom_tx[1 + i] = (uint8_t) ((random >> 8) + (i * 13));
+		}
+
+		transaction.tx = memory->eeprom_tx;
+		transaction.tx_length = 1 + SIM_EEPROM_PAGE;
+		transaction.rx = NULL;
+		transaction.rx_length = 0;
+		status = i2c_transfer(&bus, &transaction, portMAX_DELAY);
+		record(&eeprom_class, &transaction, status);
+
+		if (status != I2C_DONE)
+		{
+			continue;
+		}
+
+		transaction.tx_length = 1;
+		transaction.rx = memory->eeprom_rx;
+		transaction.rx_length = SIM_EEPROM_PAGE;
+		status = i2c_transfer(&bus, &transaction, portMAX_DELAY);
+		record(&eeprom_class, &transaction, status);
+
+		for (uint32_t i = 0; (status == I2C_DONE) && (i < SIM_EEPROM_PAGE); i++)
+		{
+			if (memory->eeprom_rx[i] != memory->eeprom_tx[1 + i])
+			{
+				eeprom_class.corrupt++;
+			}
+		}
+
+		vTaskDelay(1);
+	}
+
+	__atomic_sub_fetch(&running_tasks, 1, __ATOMIC_SEQ_CST);
+	vTaskDelete(NULL);
+}
+
+// Writes to an address no device answers every ten ticks
+static void probe_task(void *params)
+{
+	i2c_transaction_t transaction;
+
+	(void) params;
+
+	memset(&transaction, 0, sizeof(transaction));
+	transaction.address = SIM_MISSING_ADDRESS;
+	transaction.tx = memory->probe_tx;
+	transaction.tx_length = 1;
+
+	while (stop_tasks == pdFALSE)
+	{
+		record(&probe_class, &transaction, i2c_transfer(&bus, &transaction, portMAX_DELAY));
+		vTaskDelay(10);
+	}
+
+	__atomic_sub_fetch(&running_tasks, 1, __ATOMIC_SEQ_CST);
+	vTaskDelete(NULL);
+}
+
+static void print_class(const sim_class_t *class)
+{
+	printf("cores: %d, %-6s %6lu transactions, latency mean %lu us max %lu us, done %lu, nack %lu, "
+			"bus error %lu, timeout %lu, corrupt bytes: %lu\n", configNUMBER_OF_CORES, class->name,
+			(unsigned long) class->transactions,
+			(unsigned long) ((class->transactions > 0) ? (class->latency_total_us / class->transactions) : 0),
+			(unsigned long) class->latency_max_us, (unsigned long) class->failed[I2C_DONE],
+			(unsigned long) class->failed[I2C_NACK], (unsigned long) class->failed[I2C_BUS_ERROR],
+			(unsigned long) class->failed[I2C_TIMEOUT], (unsigned long) class->corrupt);
+}
+
+// Opens the bus, runs the tasks for a while, and prints the statistics
+static void main_task(void *params)
+{
+	pthread_t controller;
+	i2c_bus_config_t config;
+	i2c_bus_stats_t stats;
+
+	(void) params;
+
+	memset(&config, 0, sizeof(config));
+	config.regs = &sim_i2c;
+	config.clock_speed = SIM_CLOCK_SPEED;
+	config.dma_controller = SIM_DMA_CONTROLLER;
+	config.rx_stream = SIM_RX_STREAM;
+	config.rx_channel = DMA_Channel_1;
+	config.tx_stream = SIM_TX_STREAM;
+	config.tx_channel = DMA_Channel_1;
+
+	for (uint32_t i = 0; i < 256; i++)
+	{
+		device[0].registers[i] = SIM_SENSOR_VALUE(i);
+	}
+
+	configASSERT(i2c_bus_open(&bus, &sim_i2c_hw, &config) == pdPASS);
+	pthread_create(&controller, NULL, i2c_thread, NULL);
+
+	running_tasks = 3;
+	xTaskCreate(sensor_task, "Sensor", SIM_STACK_SIZE, NULL, 4, NULL);
+	xTaskCreate(eeprom_task, "EEPROM", SIM_STACK_SIZE, NULL, 3, NULL);
+	xTaskCreate(probe_task, "Probe", SIM_STACK_SIZE, NULL, 3, NULL);
+
+	vTaskDelay(SIM_RUN_TICKS);
+
+	stop_tasks = pdTRUE;
+	while (running_tasks > 0)
+	{
+		vTaskDelay(1);
+	}
+
+	i2c_bus_get_stats(&bus, &stats);
+
+	sim_print_lock();
+	{
+		printf("cores: %d, %lu transactions, %lu bytes, utilisation %lu.%lu%%, latency mean %lu us max %lu us, "
+				"nacks %lu, bus errors %lu, timeouts %lu, recoveries %lu\n", configNUMBER_OF_CORES,
+				(unsigned long) stats.transactions, (unsigned long) stats.bytes,
+				(unsigned long) (stats.utilisation / 10), (unsigned long) (stats.utilisation % 10),
+				(unsigned long) stats.latency_mean_us, (unsigned long) stats.latency_max_us,
+				(unsigned long) stats.nacks, (unsigned long) stats.bus_errors, (unsigned long) stats.timeouts,
+				(unsigned long) stats.recoveries);
+		print_class(&sensor_class);
+		print_class(&eeprom_class);
+		print_class(&probe_class);
+		printf("cores: %d, per transaction: bus busy %lu us, %lu.%02lu interrupts, handlers %lu ns; "
+				"protocol errors: %lu\n", configNUMBER_OF_CORES,
+				(unsigned long) (stats.busy_us / stats.transactions),
+				(unsigned long) (stats.interrupts / stats.transactions),
+				(unsigned long) (((stats.interrupts * 100ULL) / stats.transactions) % 100),
+				(unsigned long) (handler_ns / stats.transactions), (unsigned long) protocol_errors);
+	}
+	sim_print_unlock();
+
+	i2c_bus_close(&bus);
+	stop_controller = pdTRUE;
+	pthread_join(controller, NULL);
+
+	exit(0);
+}
+
+// driver funtion
+int main(void)
+{
+	memory = mmap(NULL, sizeof(sim_memory_t), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+	configASSERT(memory != MAP_FAILED);
+
+	dma_manager_init(&sim_dma_hw);
+	vPortSetInterruptHandler(SIM_EVENT_INTERRUPT, event_interrupt_handler);
+	vPortSetInterruptHandler(SIM_ERROR_INTERRUPT, error_interrupt_handler);
+	vPortSetInterruptHandler(SIM_DMA_INTERRUPT, dma_interrupt_handler);
+
+	sim_run(main_task, "Main", configMAX_PRIORITIES - 1);
+}
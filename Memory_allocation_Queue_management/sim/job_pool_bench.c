@@ -0,0 +1,183 @@
+/**
+  ******************************************************************************
+  * @file    job_pool_bench.c
+  * @brief   Host simulation comparing three ways of running many tiny jobs:
+  * 		 a task created per job, a single worker fed through a queue,
+  * 		 and a job pool with one worker per simulated core.  The jobs
+  * 		 completed per second are printed for each.  See README.md for
+  * 		 the build command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "job_pool.h"
+#include "sim_common.h"
+
+#define BENCH_JOBS				(20000)
+#define BENCH_TASK_JOBS			(2000)
+#define BENCH_BATCH				(32)
+#define BENCH_JOB_WORK			(200)
+#define BENCH_DEQUE_LENGTH		(64)
+#define BENCH_WORKER_PRIORITY	(1)
+
+static volatile uint32_t job_sink;
+static QueueHandle_t job_queue;
+static QueueHandle_t done_queue;
+
+// The job: a short piece of arithmetic that cannot be optimised away
+static void tiny_job(void *params)
+{
+	uint32_t i, value = (uint32_t) (uintptr_t) params;
+
+	for (i = 0; i < BENCH_JOB_WORK; i++)
+	{
+		value = (value * 1103515245UL) + 12345UL;
+	}
+
+	job_sink += value;
+}
+
+static void print_result(const char *method, uint32_t jobs, TickType_t ticks)
+{
+	if (ticks == 0)
+	{
+		ticks = 1;
+	}
+
+	sim_printf("cores: %d, %-18s jobs per second: %lu\n", configNUMBER_OF_CORES, method,
+			(unsigned long) (((uint64_t) jobs * configTICK_RATE_HZ) / ticks));
+}
+
+// Runs one job then waits to be deleted.  The creator deletes the task so the
+// memory is freed straight away rather than by the idle task, which would not
+// run on a single core while the benchmark is busy.
+static void job_task(void *params)
+{
+	tiny_job(params);
+	xQueueSend(done_queue, &params, portMAX_DELAY);
+	vTaskSuspend(NULL);
+}
+
+// Runs the jobs received through job_queue
+static void queue_worker_task(void *params)
+{
+	void *job;
+
+	(void) params;
+
+	for(;;)
+	{
+		xQueueReceive(job_queue, &job, portMAX_DELAY);
+		tiny_job(job);
+		xQueueSend(done_queue, &job, portMAX_DELAY);
+	}
+}
+
+static void bench_task_per_job(void)
+{
+	TickType_t start = xTaskGetTickCount();
+	TaskHandle_t handle;
+	uint32_t i;
+	void *job;
+
+	for (i = 0; i < BENCH_TASK_JOBS; i++)
+	{
+		xTaskCreate(job_task, "Job", SIM_STACK_SIZE, (void *) (uintptr_t) i, BENCH_WORKER_PRIORITY, &handle);
+		xQueueReceive(done_queue, &job, portMAX_DELAY);
+		vTaskDelete(handle);
+	}
+
+	print_result("task per job,", BENCH_TASK_JOBS, xTaskGetTickCount() - start);
+}
+
+static void bench_single_worker(void)
+{
+	TickType_t start = xTaskGetTickCount();
+	uint32_t i, received = 0;
+	void *job;
+
+	for (i = 0; i < BENCH_JOBS; i++)
+	{
+		job = (void *) (uintptr_t) i;
+
+		// Keep the done queue drained so the worker never blocks on it
+		while (xQueueSend(job_queue, &job, 0) != pdPASS)
+		{
+			xQueueReceive(done_queue, &job, portMAX_DELAY);
+			received++;
+		}
+	}
+
+	while (received < BENCH_JOBS)
+	{
+		xQueueReceive(done_queue, &job, portMAX_DELAY);
+		received++;
+	}
+
+	print_result("single worker,", BENCH_JOBS, xTaskGetTickCount() - start);
+}
+
+static void bench_job_pool(JobPoolHandle_t pool)
+{
+	TickType_t start = xTaskGetTickCount();
+	Job_t batch[BENCH_BATCH];
+	JobGroup_t group;
+	uint32_t i, j, submitted;
+
+	vJobGroupInitialise(&group);
+
+	for (i = 0; i < BENCH_JOBS; i += submitted)
+	{
+		for (j = 0; j < BENCH_BATCH; j++)
+		{
+			batch[j].pxFunction = tiny_job;
+			batch[j].pvParameter = (void *) (uintptr_t) (i + j);
+		}
+
+		submitted = uxJobPoolSubmitBatch(pool, batch, BENCH_BATCH, &group);
+
+		if (submitted == 0)
+		{
+			// The pool is full, let the workers catch up
+			taskYIELD();
+		}
+	}
+
+	xJobGroupWait(pool, &group, portMAX_DELAY);
+	xJobPoolFence(pool, portMAX_DELAY);
+
+	print_result("job pool,", i, xTaskGetTickCount() - start);
+}
+
+// Runs each benchmark in turn from a task below the workers' priority
+static void bench_task(void *params)
+{
+	JobPoolHandle_t pool;
+
+	(void) params;
+
+	bench_task_per_job();
+	bench_single_worker();
+
+	pool = xJobPoolCreate(configNUMBER_OF_CORES, BENCH_DEQUE_LENGTH, SIM_STACK_SIZE, BENCH_WORKER_PRIORITY);
+	configASSERT(pool != NULL);
+	bench_job_pool(pool);
+
+	exit(0);
+}
+
+// driver funtion
+int main(void)
+{
+	job_queue = xQueueCreate(BENCH_DEQUE_LENGTH, sizeof(void *));
+	done_queue = xQueueCreate(BENCH_DEQUE_LENGTH, sizeof(void *));
+	configASSERT((job_queue != NULL) && (done_queue != NULL));
+
+	xTaskCreate(queue_worker_task, "Worker", SIM_STACK_SIZE, NULL, BENCH_WORKER_PRIORITY, NULL);
+	sim_run(bench_task, "Bench", BENCH_WORKER_PRIORITY);
+}
@@ -0,0 +1,639 @@
+/**
+  ******************************************************************************
+  * @file    kv_sim.c
+  * @brief   Host simulation of the key-value store (kv_store.h) on a
+  * 		 simulated flash, where programming can only clear bits and an
+  * 		 erase sets a whole sector.  The flash can lose power after a set
+  * 		 number of words programmed and sectors erased, leaving the word
+  * 		 being programmed with only some of its bits cleared, or the
+  * 		 sector being erased only partly erased, and failing everything
+  * 		 after.  Basic sets, gets, deletes and reopening are checked
+  * 		 first, then a random workload against a model across many
+  * 		 compactions, then hundreds of power losses at random points, each
+  * 		 followed by reopening the store, which must hold the model's
+  * 		 state after some prefix of the writes no shorter than the last
+  * 		 successful flush.  All of it runs on four 4KB sectors and on two
+  * 		 8KB.  Last it measures write throughput and lookups on two 128KB
+  * 		 sectors, as on the STM32F446.  See README.md for the build
+  * 		 command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Before the CMSIS headers, whose __I would break the intrinsics
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "kv_store.h"
+#include "sim_common.h"
+
+#define SIM_WORKER_PRIORITY		(1)
+#define SIM_QUEUE_LENGTH		(16)
+#define SIM_KEYS				(64)
+#define SIM_INDEX_SIZE			(128)
+#define SIM_VALUE_MAX			(100)
+#define SIM_WORKLOAD_OPS		(20000)
+#define SIM_FLUSH_EVERY			(50)
+#define SIM_CYCLES				(300)
+#define SIM_CYCLE_OPS			(200)
+#define SIM_CYCLE_BUDGET		(6000)
+#define BENCH_SECTOR_SIZE		(128UL * 1024)
+#define BENCH_UPDATES			(100000)
+#define BENCH_COUNTERS			(8)
+#define BENCH_SETTINGS			(24)
+#define BENCH_LOOKUP_KEYS		(1024)
+#define BENCH_LOOKUP_INDEX		(2048)
+#define BENCH_LOOKUPS			(100000)
+
+// STM32F446 datasheet typical times, 32 bits at a time
+#define F446_PROGRAM_WORD_US	(16)
+#define F446_ERASE_128KB_US		(1000000)
+#define F446_ENDURANCE			(10000)
+
+typedef struct
+{
+	uint32_t sectors;
+	uint32_t sector_size;
+} sim_geometry_t;
+
+typedef struct
+{
+	BaseType_t present;
+	uint16_t length;
+	uint8_t value[KV_VALUE_MAX];
+} sim_value_t;
+
+typedef struct
+{
+	uint8_t key;
+	BaseType_t remove;
+	uint16_t length;
+	uint8_t value[KV_VALUE_MAX];
+} sim_op_t;
+
+static const sim_geometry_t geometries[] = {{4, 4096}, {2, 8192}};
+
+static kv_store_t store;
+static kv_index_entry_t index_slots[BENCH_LOOKUP_INDEX];
+static kv_flash_t sim_flash;
+static uint8_t *sim_memory;
+
+// Operations left before the power is lost, or -1 for none
+static int64_t sim_budget = -1;
+static BaseType_t sim_cut;
+static uint64_t sim_words, sim_erases;
+static uint32_t sim_erase_count[KV_SECTORS_MAX];
+static uint32_t sim_overwrites;
+
+static sim_value_t model[SIM_KEYS], prefix[SIM_KEYS];
+static sim_op_t ops[SIM_CYCLE_OPS];
+static uint32_t random_state = 1;
+static uint32_t checks, failures;
+
+static void check(BaseType_t good, const char *what, uint32_t detail)
+{
+	checks++;
+
+	if (good == pdFALSE)
+	{
+		if (failures < 10)
+		{
+			printf("%s failed (%lu)\n", what, (unsigned long) detail);
+		}
+
+		failures++;
+	}
+}
+
+// A small deterministic generator, so every run sees the same data
+static uint32_t next_random(void)
+{
+	random_state = (random_state * 1103515245UL) + 12345UL;
+	return random_state >> 16;
+}
+
+// Counts an operation against the budget, reporting whether the power
+// fails during it
+static BaseType_t sim_power_lost(void)
+{
+	if (sim_budget == 0)
+	{
+		sim_cut = pdTRUE;
+		sim_budget = -1;
+		return pdTRUE;
+	}
+
+	if (sim_budget > 0)
+	{
+		sim_budget--;
+	}
+
+	return pdFALSE;
+}
+
+// An erase cut short leaves the words from some point on as they were
+static BaseType_t sim_erase(uint32_t sector)
+{
+	uint8_t *start = &sim_memory[sector * sim_flash.sector_size];
+
+	if (sim_cut == pdTRUE)
+	{
+		return pdFAIL;
+	}
+
+	if (sim_power_lost() == pdTRUE)
+	{
+		memset(start, 0xFF, (next_random() % (sim_flash.sector_size / 4)) * 4);
+		return pdFAIL;
+	}
+
+	memset(start, 0xFF, sim_flash.sector_size);
+	sim_erases++;
+	sim_erase_count[sector]++;
+
+	return pdPASS;
+}
+
+// A word programmed as the power fails keeps some of its bits.  The store
+// programs erased words, apart from clearing a whole word
+static BaseType_t sim_program(uint32_t offset, const uint32_t *words, uint32_t count)
+{
+	uint32_t old;
+
+	configASSERT(((offset % 4) == 0) && ((offset + (count * 4)) <= (sim_flash.sector_size * sim_flash.sectors)));
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (sim_cut == pdTRUE)
+		{
+			return pdFAIL;
+		}
+
+		memcpy(&old, &sim_memory[offset + (i * 4)], sizeof(old));
+
+		if ((old != 0xFFFFFFFF) && (words[i] != 0))
+		{
+			sim_overwrites++;
+		}
+
+		old &= (sim_power_lost() == pdTRUE) ? (words[i] | (next_random() * 65537UL)) : words[i];
+		memcpy(&sim_memory[offset + (i * 4)], &old, sizeof(old));
+		sim_words++;
+	}
+
+	return (sim_cut == pdTRUE) ? pdFAIL : pdPASS;
+}
+
+// A flash that has never been written, which the store formats
+static void sim_flash_init(uint32_t sectors, uint32_t sector_size)
+{
+	free(sim_memory);
+	sim_memory = malloc(sectors * sector_size);
+	configASSERT(sim_memory != NULL);
+
+	for (uint32_t i = 0; i < (sectors * sector_size); i++)
+	{
+		sim_memory[i] = (uint8_t) next_random();
+	}
+
+	sim_flash.base = sim_memory;
+	sim_flash.sectors = sectors;
+	sim_flash.sector_size = sector_size;
+	sim_flash.erase = sim_erase;
+	sim_flash.program = sim_program;
+
+	sim_budget = -1;
+	sim_cut = pdFALSE;
+	sim_words = 0;
+	sim_erases = 0;
+	memset(sim_erase_count, 0, sizeof(sim_erase_count));
+}
+
+static void open_store(uint32_t index_size)
+{
+	kv_store_config_t config;
+
+	config.task_priority = SIM_WORKER_PRIORITY;
+	config.stack_depth = SIM_STACK_SIZE;
+	config.queue_length = SIM_QUEUE_LENGTH;
+	config.index = index_slots;
+	config.index_size = index_size;
+
+	configASSERT(kv_store_open(&store, &sim_flash, &config) == pdPASS);
+}
+
+static void key_name(uint32_t key, char *name)
+{
+	sprintf(name, "key/%02lu", (unsigned long) key);
+}
+
+// Whether the store holds a state, key by key
+static BaseType_t store_matches(const sim_value_t *state)
+{
+	uint8_t value[KV_VALUE_MAX];
+	char name[16];
+	size_t length;
+	BaseType_t found;
+
+	for (uint32_t key = 0; key < SIM_KEYS; key++)
+	{
+		key_name(key, name);
+		found = kv_get(&store, name, value, sizeof(value), &length);
+
+		if ((found != state[key].present) ||
+				((found == pdPASS) && ((length != state[key].length) ||
+				(memcmp(value, state[key].value, length) != 0))))
+		{
+			return pdFALSE;
+		}
+	}
+
+	return pdTRUE;
+}
+
+static void random_op(sim_op_t *op)
+{
+	op->key = (uint8_t) (next_random() % SIM_KEYS);
+	op->remove = ((next_random() % 10) == 0) ? pdTRUE : pdFALSE;
+	op->length = ((next_random() % 16) == 0) ? KV_VALUE_MAX : (uint16_t) (next_random() % (SIM_VALUE_MAX + 1));
+
+	for (uint32_t i = 0; i < op->length; i++)
+	{
+		op->value[i] = (uint8_t) next_random();
+	}
+}
+
+static void apply(sim_value_t *state, const sim_op_t *op)
+{
+	state[op->key].present = (op->remove == pdTRUE) ? pdFALSE : pdTRUE;
+	state[op->key].length = op->length;
+	memcpy(state[op->key].value, op->value, op->length);
+}
+
+static BaseType_t issue(const sim_op_t *op)
+{
+	char name[16];
+
+	key_name(op->key, name);
+
+	if (op->remove == pdTRUE)
+	{
+		return kv_delete(&store, name, portMAX_DELAY);
+	}
+
+	return kv_set(&store, name, op->value, op->length, portMAX_DELAY);
+}
+
+// Sets, gets, deletes, an unchanged value, a full index and reopening
+static void check_basic(void)
+{
+	kv_store_stats_t stats;
+	uint8_t value[KV_VALUE_MAX];
+	size_t length = 0;
+	char name[16];
+	uint32_t counter;
+
+	open_store(16);
+
+	check(kv_get(&store, "missing", value, sizeof(value), &length) == pdFAIL, "get missing", 0);
+
+	counter = 1;
+	check((kv_set(&store, "boot/count", &counter, sizeof(counter), portMAX_DELAY) == pdPASS) &&
+			(kv_set(&store, "net/name", "board-1", 7, portMAX_DELAY) == pdPASS) &&
+			(kv_flush(&store, portMAX_DELAY) == pdPASS), "set", 0);
+	check((kv_get(&store, "net/name", value, sizeof(value), &length) == pdPASS) && (length == 7) &&
+			(memcmp(value, "board-1", 7) == 0), "get", 0);
+	check((kv_get(&store, "net/name", value, 3, &length) == pdFAIL) && (length == 7), "get too small", 0);
+
+	counter = 2;
+	(void) kv_set(&store, "boot/count", &counter, sizeof(counter), portMAX_DELAY);
+	(void) kv_set(&store, "net/name", "board-1", 7, portMAX_DELAY);
+	(void) kv_delete(&store, "net/name", portMAX_DELAY);
+	(void) kv_delete(&store, "never/set", portMAX_DELAY);
+	check(kv_flush(&store, portMAX_DELAY) == pdPASS, "flush", 0);
+	check((kv_get(&store, "boot/count", &counter, sizeof(counter), &length) == pdPASS) && (counter == 2) &&
+			(kv_get(&store, "net/name", value, sizeof(value), &length) == pdFAIL), "overwrite and delete", 0);
+
+	// 16 slots take 12 keys
+	for (uint32_t key = 0; key < 12; key++)
+	{
+		key_name(key, name);
+		(void) kv_set(&store, name, &key, sizeof(key), portMAX_DELAY);
+	}
+	check(kv_flush(&store, portMAX_DELAY) == pdFAIL, "index full", 0);
+
+	kv_store_get_stats(&store, &stats);
+	check((stats.keys == 12) && (stats.unchanged == 1) && (stats.deletes == 1) && (stats.write_errors == 1),
+			"basic stats", stats.keys);
+	kv_store_close(&store);
+
+	open_store(16);
+	kv_store_get_stats(&store, &stats);
+	check((stats.keys == 12) && (stats.torn == 0) &&
+			(kv_get(&store, "boot/count", &counter, sizeof(counter), &length) == pdPASS) && (counter == 2) &&
+			(kv_get(&store, "key/10", &counter, sizeof(counter), &length) == pdPASS) && (counter == 10),
+			"reopen", stats.keys);
+	kv_store_close(&store);
+}
+
+// Random writes against the model, flushing and checking as they go, then
+// again after reopening.  Every sector is erased about as often
+static void check_workload(void)
+{
+	kv_store_stats_t stats;
+	uint32_t erase_min = UINT32_MAX, erase_max = 0;
+
+	memset(model, 0, sizeof(model));
+	open_store(SIM_INDEX_SIZE);
+
+	for (uint32_t n = 0; n < SIM_WORKLOAD_OPS; n++)
+	{
+		random_op(&ops[0]);
+		apply(model, &ops[0]);
+		(void) issue(&ops[0]);
+
+		if ((n % SIM_FLUSH_EVERY) == (SIM_FLUSH_EVERY - 1))
+		{
+			check(kv_flush(&store, portMAX_DELAY) == pdPASS, "workload flush", n);
+			check(store_matches(model), "workload", n);
+		}
+	}
+
+	kv_store_get_stats(&store, &stats);
+	kv_store_close(&store);
+
+	open_store(SIM_INDEX_SIZE);
+	check(store_matches(model), "workload reopen", 0);
+	kv_store_close(&store);
+
+	for (uint32_t sector = 0; sector < sim_flash.sectors; sector++)
+	{
+		erase_min = (sim_erase_count[sector] < erase_min) ? sim_erase_count[sector] : erase_min;
+		erase_max = (sim_erase_count[sector] > erase_max) ? sim_erase_count[sector] : erase_max;
+	}
+
+	check((stats.compactions > 10) && ((erase_max - erase_min) <= 1) && (sim_overwrites == 0), "wear",
+			erase_max - erase_min);
+
+	printf("  workload: %lu sets, %lu deletes, %lu unchanged, %lu compactions copying %lu records, "
+			"%lu erases (%lu to %lu a sector), %.2f bytes programmed per byte written\n",
+			(unsigned long) stats.sets, (unsigned long) stats.deletes, (unsigned long) stats.unchanged,
+			(unsigned long) stats.compactions, (unsigned long) stats.copied, (unsigned long) stats.erases,
+			(unsigned long) erase_min, (unsigned long) erase_max,
+			(double) stats.programmed_bytes / (double) stats.user_bytes);
+}
+
+// Cuts the power at a random point in a run of random writes, reopens the
+// store and finds the prefix of the writes it holds
+static void check_power_loss(void)
+{
+	kv_store_stats_t stats;
+	uint32_t issued, durable, found, torn = 0, lost = 0;
+	BaseType_t failed;
+
+	open_store(SIM_INDEX_SIZE);
+
+	for (uint32_t cycle = 0; cycle < SIM_CYCLES; cycle++)
+	{
+		issued = 0;
+		durable = 0;
+		failed = pdFALSE;
+		sim_budget = next_random() % SIM_CYCLE_BUDGET;
+
+		while ((issued < SIM_CYCLE_OPS) && (sim_cut == pdFALSE))
+		{
+			random_op(&ops[issued]);
+			(void) issue(&ops[issued]);
+			issued++;
+
+			if (((issued % 20) == 0) && (kv_flush(&store, portMAX_DELAY) == pdFAIL))
+			{
+				failed = pdTRUE;
+			}
+
+			durable = (((issued % 20) == 0) && (failed == pdFALSE)) ? issued : durable;
+		}
+
+		// Whatever the worker still has fails once the power is gone.  A
+		// flush only reports the failures since the one before
+		if ((kv_flush(&store, portMAX_DELAY) == pdPASS) && (failed == pdFALSE))
+		{
+			durable = issued;
+		}
+
+		kv_store_close(&store);
+
+		// Power back on
+		sim_cut = pdFALSE;
+		sim_budget = -1;
+		open_store(SIM_INDEX_SIZE);
+		kv_store_get_stats(&store, &stats);
+		torn += (stats.torn > 0) ? 1 : 0;
+
+		memcpy(prefix, model, sizeof(prefix));
+		found = UINT32_MAX;
+
+		for (uint32_t p = 0; p <= issued; p++)
+		{
+			if (p > 0)
+			{
+				apply(prefix, &ops[p - 1]);
+			}
+
+			// The longest, as a write of an unchanged value matches twice
+			if ((p >= durable) && (store_matches(prefix) == pdTRUE))
+			{
+				found = p;
+				memcpy(model, prefix, sizeof(model));
+			}
+		}
+
+		check(found != UINT32_MAX, "power loss", cycle);
+
+		if (found == UINT32_MAX)
+		{
+			// The model no longer follows the store
+			break;
+		}
+
+		lost += issued - found;
+	}
+
+	kv_store_close(&store);
+	check(sim_overwrites == 0, "overwrites", sim_overwrites);
+
+	printf("  power loss: %d cycles, %lu reopened past a torn record, %lu unflushed writes lost\n", SIM_CYCLES,
+			(unsigned long) torn, (unsigned long) lost);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// The time stamp counter, which runs at the processor's nominal clock
+#define BENCH_UNIT				"cycles"
+
+// The barrier keeps the compiler from moving the timed calls past the reads
+static uint64_t bench_now(void)
+{
+	__asm volatile ("" ::: "memory");
+	return __rdtsc();
+}
+#else
+#define BENCH_UNIT				"ns"
+
+static uint64_t bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+#endif
+
+// Wall clock time, for the rate of the whole store on the host
+static uint64_t host_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec * 1000000ULL) + ((uint64_t) ts.tv_nsec / 1000);
+}
+
+// Counters updated constantly and settings now and then, on two 128KB
+// sectors, against rewriting a 1KB block of them in place each update
+static void bench_writes(void)
+{
+	kv_store_stats_t stats;
+	uint64_t start_us, queued_us, flash_us;
+	uint32_t counters[BENCH_COUNTERS] = {0};
+	uint8_t setting[32];
+	char name[16];
+	double per_update_us;
+
+	sim_flash_init(2, BENCH_SECTOR_SIZE);
+	open_store(SIM_INDEX_SIZE);
+
+	start_us = host_us();
+
+	for (uint32_t n = 0; n < BENCH_UPDATES; n++)
+	{
+		if ((n % 16) == 15)
+		{
+			sprintf(name, "cfg/%02lu", (unsigned long) (next_random() % BENCH_SETTINGS));
+			for (uint32_t i = 0; i < sizeof(setting); i++)
+			{
+				setting[i] = (uint8_t) next_random();
+			}
+			(void) kv_set(&store, name, setting, sizeof(setting), portMAX_DELAY);
+		}
+		else
+		{
+			uint32_t counter = n % BENCH_COUNTERS;
+
+			counters[counter]++;
+			sprintf(name, "cnt/%lu", (unsigned long) counter);
+			(void) kv_set(&store, name, &counters[counter], sizeof(counters[counter]), portMAX_DELAY);
+		}
+	}
+
+	queued_us = host_us() - start_us;
+	check(kv_flush(&store, portMAX_DELAY) == pdPASS, "bench flush", 0);
+	flash_us = host_us() - start_us;
+
+	kv_store_get_stats(&store, &stats);
+	kv_store_close(&store);
+
+	per_update_us = ((double) sim_words * F446_PROGRAM_WORD_US + (double) sim_erases * F446_ERASE_128KB_US) /
+			BENCH_UPDATES;
+
+	printf("writes: %d updates of %d counters and %d settings on 2 x 128KB sectors\n", BENCH_UPDATES,
+			BENCH_COUNTERS, BENCH_SETTINGS);
+	printf("  host: %.0f updates/s written, %.2f us queued per update\n",
+			(double) BENCH_UPDATES * 1e6 / (double) flash_us, (double) queued_us / BENCH_UPDATES);
+	printf("  flash: %llu words programmed, %llu erases, %lu compactions copying %lu records, %.2f bytes "
+			"programmed per byte written\n", (unsigned long long) sim_words, (unsigned long long) sim_erases,
+			(unsigned long) stats.compactions, (unsigned long) stats.copied,
+			(double) stats.programmed_bytes / (double) stats.user_bytes);
+	printf("  F446 estimate: %.1f us per update, %.0f updates per erase, %.2e updates to wear out\n",
+			per_update_us, (double) BENCH_UPDATES / (double) sim_erases,
+			(double) BENCH_UPDATES / (double) sim_erases * 2 * F446_ENDURANCE);
+	printf("  rewriting a 1KB block in place: %.1f us per update, 1 erase per update, %.2e updates to wear "
+			"out\n", (double) F446_ERASE_128KB_US + (256.0 * F446_PROGRAM_WORD_US), (double) F446_ENDURANCE);
+}
+
+// Lookups of keys that are there, with few and with many keys
+static void bench_lookups(void)
+{
+	static const uint32_t key_counts[] = {32, BENCH_LOOKUP_KEYS};
+	uint8_t value[KV_VALUE_MAX];
+	char name[16];
+	size_t length;
+	uint64_t start, spent;
+	uint32_t found;
+
+	printf("lookups: %s per kv_get() of a 4 byte value, %d slots\n", BENCH_UNIT, BENCH_LOOKUP_INDEX);
+
+	for (uint32_t k = 0; k < (sizeof(key_counts) / sizeof(key_counts[0])); k++)
+	{
+		sim_flash_init(2, BENCH_SECTOR_SIZE);
+		open_store(BENCH_LOOKUP_INDEX);
+
+		for (uint32_t key = 0; key < key_counts[k]; key++)
+		{
+			sprintf(name, "id/%04lu", (unsigned long) key);
+			(void) kv_set(&store, name, &key, sizeof(key), portMAX_DELAY);
+		}
+		check(kv_flush(&store, portMAX_DELAY) == pdPASS, "lookup flush", key_counts[k]);
+
+		found = 0;
+		start = bench_now();
+		for (uint32_t n = 0; n < BENCH_LOOKUPS; n++)
+		{
+			sprintf(name, "id/%04lu", (unsigned long) ((n * 7919) % key_counts[k]));
+			found += (kv_get(&store, name, value, sizeof(value), &length) == pdPASS) ? 1 : 0;
+		}
+		spent = bench_now() - start;
+
+		check(found == BENCH_LOOKUPS, "lookups", found);
+		printf("  %4lu keys: %.1f\n", (unsigned long) key_counts[k], (double) spent / BENCH_LOOKUPS);
+
+		kv_store_close(&store);
+	}
+}
+
+// Runs the checks on each geometry and the benchmarks, and prints the
+// results.  The worker is below this task, so writes queue up behind it
+static void main_task(void *params)
+{
+	(void) params;
+
+	for (uint32_t g = 0; g < (sizeof(geometries) / sizeof(geometries[0])); g++)
+	{
+		printf("%lu x %lu byte sectors\n", (unsigned long) geometries[g].sectors,
+				(unsigned long) geometries[g].sector_size);
+
+		sim_flash_init(geometries[g].sectors, geometries[g].sector_size);
+		check_basic();
+
+		sim_flash_init(geometries[g].sectors, geometries[g].sector_size);
+		check_workload();
+		check_power_loss();
+	}
+
+	bench_writes();
+	bench_lookups();
+
+	printf("checks: %lu, failures: %lu\n", (unsigned long) checks, (unsigned long) failures);
+	fflush(stdout);
+
+	exit((failures == 0) ? 0 : 1);
+}
+
+// driver funtion
+int main(void)
+{
+	sim_run(main_task, "Main", configMAX_PRIORITIES - 1);
+}
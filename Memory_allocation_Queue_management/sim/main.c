@@ -0,0 +1,93 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @brief   Host simulation of the queue workload on N simulated cores.
+  * 		 Each producer/consumer pair passes items through its own queue.
+  * 		 The number of items moved in a fixed number of ticks is printed
+  * 		 so throughput can be compared between configNUMBER_OF_CORES
+  * 		 values.  See README.md for the build command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "sim_common.h"
+
+#define SIM_PAIRS			(4)
+#define SIM_QUEUE_LENGTH	(16)
+#define SIM_RUN_TICKS		(pdMS_TO_TICKS(2000))
+
+static QueueHandle_t pair_queue[SIM_PAIRS];
+static volatile uint32_t received[SIM_PAIRS];
+
+// Sends an increasing sequence number to the queue of its pair
+static void producer_task(void *params)
+{
+	QueueHandle_t queue = (QueueHandle_t) params;
+	uint32_t sequence = 0;
+
+	for(;;)
+	{
+		xQueueSend(queue, &sequence, portMAX_DELAY);
+		sequence++;
+	}
+}
+
+// Receives from the queue of its pair and checks no item was lost
+static void consumer_task(void *params)
+{
+	uint32_t pair = (uint32_t) (uintptr_t) params;
+	uint32_t item, expected = 0;
+
+	for(;;)
+	{
+		xQueueReceive(pair_queue[pair], &item, portMAX_DELAY);
+		configASSERT(item == expected);
+		expected++;
+		received[pair]++;
+	}
+}
+
+// Waits for the run to complete then prints the number of items moved
+static void report_task(void *params)
+{
+	uint32_t pair, total = 0;
+
+	(void) params;
+
+	vTaskDelay(SIM_RUN_TICKS);
+
+	sim_print_lock();
+	{
+		for (pair = 0; pair < SIM_PAIRS; pair++)
+		{
+			total += received[pair];
+		}
+
+		printf("cores: %d, pairs: %d, items per second: %lu\n", configNUMBER_OF_CORES,
+				SIM_PAIRS, (unsigned long) (total / (SIM_RUN_TICKS / configTICK_RATE_HZ)));
+		exit(0);
+	}
+	sim_print_unlock();
+}
+
+// driver funtion
+int main(void)
+{
+	uint32_t pair;
+
+	for (pair = 0; pair < SIM_PAIRS; pair++)
+	{
+		pair_queue[pair] = xQueueCreate(SIM_QUEUE_LENGTH, sizeof(uint32_t));
+		configASSERT(pair_queue[pair] != NULL);
+
+		xTaskCreate(producer_task, "Producer", SIM_STACK_SIZE, (void *) pair_queue[pair], 1, NULL);
+		xTaskCreate(consumer_task, "Consumer", SIM_STACK_SIZE, (void *) (uintptr_t) pair, 1, NULL);
+	}
+
+	sim_run(report_task, "Report", configMAX_PRIORITIES - 1);
+}
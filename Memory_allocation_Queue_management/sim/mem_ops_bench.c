@@ -0,0 +1,435 @@
+/**
+  ******************************************************************************
+  * @file    mem_ops_bench.c
+  * @brief   Host check and benchmark of the memory operations (mem_ops.h)
+  * 		 and of the kernel copies that use them.  Built with
+  * 		 configUSE_MEM_OPS it checks pvMemCopy(), pvMemSet() and
+  * 		 xMemCompare() against the C library and usMemChecksum() against
+  * 		 a byte at a time reference, at every alignment and many lengths,
+  * 		 then prints the cycles each takes by size.  Either way it then
+  * 		 times items through a queue and data through a stream buffer,
+  * 		 checking every byte received.  See README.md for the build
+  * 		 command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "stream_buffer.h"
+#include "sim_common.h"
+
+// The reference loops must stay byte loops rather than become library calls
+#pragma GCC optimize ("no-tree-loop-distribute-patterns")
+
+#define BENCH_RUNS				(200)
+#define BENCH_MAX_SIZE			(4096)
+#define BENCH_CHECK_LENGTH		(160)
+#define BENCH_OFFSETS			(8)
+#define BENCH_GUARD				(16)
+#define BENCH_GUARD_BYTE		(0xA5)
+#define BENCH_QUEUE_ITEM		(64)
+#define BENCH_QUEUE_LENGTH		(8)
+#define BENCH_STREAM_SIZE		(1024)
+#define BENCH_STREAM_CHUNK		(200)
+#define BENCH_ROUNDS			(20000)
+
+static uint8_t source[BENCH_MAX_SIZE + BENCH_OFFSETS + (2 * BENCH_GUARD)];
+static uint8_t expected[BENCH_MAX_SIZE + BENCH_OFFSETS + (2 * BENCH_GUARD)];
+static uint32_t random_state = 1;
+static uint32_t failures;
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+
+// The time stamp counter, which runs at the processor's nominal clock
+#define BENCH_UNIT				"cycles"
+
+// The barrier keeps the compiler from moving the timed calls past the reads
+static uint64_t bench_now(void)
+{
+	__asm volatile ("" ::: "memory");
+	return __rdtsc();
+}
+#else
+#define BENCH_UNIT				"ns"
+
+static uint64_t bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+#endif
+
+// Runs a call BENCH_RUNS times, returning the quickest
+#define BENCH(ticks, call)							\
+	do												\
+	{												\
+		(ticks) = UINT64_MAX;						\
+		for (uint32_t run = 0; run < BENCH_RUNS; run++)	\
+		{											\
+			uint64_t start = bench_now();			\
+			call;									\
+			uint64_t spent = bench_now() - start;	\
+			if (spent < (ticks))					\
+			{										\
+				(ticks) = spent;					\
+			}										\
+		}											\
+	} while (0)
+
+// A small deterministic generator, so every run sees the same data
+static uint8_t next_random(void)
+{
+	random_state = (random_state * 1103515245UL) + 12345UL;
+	return (uint8_t) (random_state >> 16);
+}
+
+static void fill_random(uint8_t *data, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++)
+	{
+		data[i] = next_random();
+	}
+}
+
+static void report(const char *name, const char *check, uint32_t mismatches)
+{
+	sim_printf("%-26s %-34s %s (%lu)\n", name, check, (mismatches == 0) ? "ok" : "FAILED",
+			(unsigned long) mismatches);
+
+	if (mismatches != 0)
+	{
+		failures++;
+	}
+}
+
+#if (configUSE_MEM_OPS == 1)
+
+// Sizes the operations are timed at
+static const uint32_t bench_sizes[] = { 4, 16, 64, 256, 1024, 4096 };
+
+static uint8_t dest[BENCH_MAX_SIZE + BENCH_OFFSETS + (2 * BENCH_GUARD)];
+
+// A byte at a time, as the C library's size optimised routines are
+static __attribute__((noinline, optimize("no-tree-vectorize"))) void byte_copy(void *dst, const void *src, size_t length)
+{
+	uint8_t *d = dst;
+	const uint8_t *s = src;
+
+	while (length-- > 0)
+	{
+		*d++ = *s++;
+	}
+}
+
+static __attribute__((noinline, optimize("no-tree-vectorize"))) void byte_set(void *dst, int value, size_t length)
+{
+	uint8_t *d = dst;
+
+	while (length-- > 0)
+	{
+		*d++ = (uint8_t) value;
+	}
+}
+
+static __attribute__((noinline, optimize("no-tree-vectorize"))) int byte_compare(const void *a, const void *b, size_t length)
+{
+	const uint8_t *p = a, *q = b;
+
+	for (size_t i = 0; i < length; i++)
+	{
+		if (p[i] != q[i])
+		{
+			return (int) p[i] - (int) q[i];
+		}
+	}
+
+	return 0;
+}
+
+// RFC 1071 as written: big endian 16 bit words, an odd last byte padded
+static __attribute__((noinline, optimize("no-tree-vectorize"))) uint16_t byte_checksum(const void *data, size_t length, uint16_t initial)
+{
+	const uint8_t *p = data;
+	uint32_t sum = initial;
+
+	for (size_t i = 0; i < length; i += 2)
+	{
+		sum += (uint32_t) p[i] << 8;
+
+		if ((i + 1) < length)
+		{
+			sum += p[i + 1];
+		}
+
+		sum = (sum & 0xFFFF) + (sum >> 16);
+	}
+
+	return (uint16_t) sum;
+}
+
+static int sign(int value)
+{
+	return (value > 0) - (value < 0);
+}
+
+// Every destination and source alignment and every length up to
+// BENCH_CHECK_LENGTH, plus a few long ones.  The bytes either side of the
+// destination must be left alone.
+static void check_copy_and_set(void)
+{
+	static const uint32_t long_lengths[] = { 1000, 1027, BENCH_MAX_SIZE };
+	uint32_t copy_errors = 0, set_errors = 0, returns = 0;
+
+	for (uint32_t pass = 0; pass < (BENCH_CHECK_LENGTH + 1 + (sizeof(long_lengths) / sizeof(long_lengths[0]))); pass++)
+	{
+		uint32_t length = (pass <= BENCH_CHECK_LENGTH) ? pass : long_lengths[pass - BENCH_CHECK_LENGTH - 1];
+
+		for (uint32_t to = 0; to < BENCH_OFFSETS; to++)
+		{
+			for (uint32_t from = 0; from < BENCH_OFFSETS; from++)
+			{
+				fill_random(source, sizeof(source));
+				memset(dest, BENCH_GUARD_BYTE, sizeof(dest));
+				memcpy(expected, dest, sizeof(dest));
+				memcpy(&expected[BENCH_GUARD + to], &source[BENCH_GUARD + from], length);
+
+				returns += (pvMemCopy(&dest[BENCH_GUARD + to], &source[BENCH_GUARD + from], length) != &dest[BENCH_GUARD + to]) ? 1 : 0;
+				copy_errors += (memcmp(dest, expected, sizeof(dest)) != 0) ? 1 : 0;
+			}
+
+			memset(dest, BENCH_GUARD_BYTE, sizeof(dest));
+			memcpy(expected, dest, sizeof(dest));
+			memset(&expected[BENCH_GUARD + to], (int) (length + to), length);
+
+			returns += (pvMemSet(&dest[BENCH_GUARD + to], (int) (length + to) | 0x300, length) != &dest[BENCH_GUARD + to]) ? 1 : 0;
+			set_errors += (memcmp(dest, expected, sizeof(dest)) != 0) ? 1 : 0;
+		}
+	}
+
+	report("pvMemCopy", "every alignment and length", copy_errors);
+	report("pvMemSet", "every alignment and length", set_errors);
+	report("pvMemCopy, pvMemSet", "return the destination", returns);
+}
+
+// Equal data, then one byte changed up and down at each position, must give
+// the sign memcmp() does
+static void check_compare(void)
+{
+	uint32_t errors = 0;
+
+	for (uint32_t length = 0; length <= BENCH_CHECK_LENGTH; length += (length < 40) ? 1 : 7)
+	{
+		for (uint32_t a = 0; a < BENCH_OFFSETS; a++)
+		{
+			for (uint32_t b = 0; b < BENCH_OFFSETS; b++)
+			{
+				uint8_t *p = &source[BENCH_GUARD + a], *q = &dest[BENCH_GUARD + b];
+
+				fill_random(p, length);
+				memcpy(q, p, length);
+				errors += (xMemCompare(p, q, length) != 0) ? 1 : 0;
+
+				for (uint32_t at = 0; at < length; at++)
+				{
+					uint8_t saved = q[at];
+
+					q[at] = (uint8_t) (saved + 1 + (next_random() % 255));
+					errors += (sign((int) xMemCompare(p, q, length)) != sign(memcmp(p, q, length))) ? 1 : 0;
+					errors += (sign((int) xMemCompare(q, p, length)) != sign(memcmp(q, p, length))) ? 1 : 0;
+					errors += ((int) xMemCompare(p, q, length) != ((int) p[at] - (int) q[at])) ? 1 : 0;
+					q[at] = saved;
+				}
+			}
+		}
+	}
+
+	report("xMemCompare", "sign and difference of memcmp", errors);
+}
+
+// Every alignment and length against the reference, data summed in two parts,
+// and data that holds its own checksum
+static void check_checksum(void)
+{
+	uint32_t errors = 0, split_errors = 0, verify_errors = 0;
+
+	for (uint32_t length = 0; length <= (BENCH_CHECK_LENGTH * 4); length += (length < BENCH_CHECK_LENGTH) ? 1 : 13)
+	{
+		for (uint32_t offset = 0; offset < BENCH_OFFSETS; offset++)
+		{
+			uint8_t *p = &source[BENCH_GUARD + offset];
+			uint16_t initial = (uint16_t) ((next_random() << 8) | next_random());
+
+			fill_random(p, length);
+			errors += (usMemChecksum(p, length, initial) != byte_checksum(p, length, initial)) ? 1 : 0;
+
+			// All ones data carries into every fold
+			memset(p, 0xFF, length);
+			errors += (usMemChecksum(p, length, 0xFFFF) != byte_checksum(p, length, 0xFFFF)) ? 1 : 0;
+
+			if (length >= 2)
+			{
+				uint32_t first = (length / 2) & ~1U;
+
+				fill_random(p, length);
+				split_errors += (usMemChecksum(&p[first], length - first, usMemChecksum(p, first, 0))
+						!= usMemChecksum(p, length, 0)) ? 1 : 0;
+
+				// A header with its checksum field, high byte first
+				p[0] = 0;
+				p[1] = 0;
+				uint16_t checksum = (uint16_t) ~usMemChecksum(p, length, 0);
+				p[0] = (uint8_t) (checksum >> 8);
+				p[1] = (uint8_t) checksum;
+				verify_errors += (usMemChecksum(p, length, 0) != 0xFFFF) ? 1 : 0;
+			}
+		}
+	}
+
+	report("usMemChecksum", "every alignment against RFC 1071", errors);
+	report("usMemChecksum", "summed in two parts", split_errors);
+	report("usMemChecksum", "data holding its checksum", verify_errors);
+}
+
+static void print_speed(const char *name, uint32_t size, uint64_t bytes, uint64_t library, uint64_t mem_ops)
+{
+	sim_printf("%-26s %5lu bytes  byte loop %7lu  libc %7lu  mem_ops %7lu %s\n", name, (unsigned long) size,
+			(unsigned long) bytes, (unsigned long) library, (unsigned long) mem_ops, BENCH_UNIT);
+}
+
+static void bench_operations(void)
+{
+	// Keep the checksums, so the calls are not optimised away
+	static volatile uint32_t sink;
+	uint64_t bytes, library, mem_ops;
+
+	fill_random(source, sizeof(source));
+
+	for (uint32_t i = 0; i < (sizeof(bench_sizes) / sizeof(bench_sizes[0])); i++)
+	{
+		uint32_t size = bench_sizes[i];
+		uint8_t *aligned = &source[BENCH_GUARD], *odd = &source[BENCH_GUARD + 1];
+		uint8_t *to = &dest[BENCH_GUARD];
+
+		BENCH(bytes, byte_copy(to, aligned, size));
+		BENCH(library, memcpy(to, aligned, size));
+		BENCH(mem_ops, pvMemCopy(to, aligned, size));
+		print_speed("copy, aligned", size, bytes, library, mem_ops);
+
+		BENCH(bytes, byte_copy(to, odd, size));
+		BENCH(library, memcpy(to, odd, size));
+		BENCH(mem_ops, pvMemCopy(to, odd, size));
+		print_speed("copy, source unaligned", size, bytes, library, mem_ops);
+
+		BENCH(bytes, byte_set(to, 0x5A, size));
+		BENCH(library, memset(to, 0x5A, size));
+		BENCH(mem_ops, pvMemSet(to, 0x5A, size));
+		print_speed("set", size, bytes, library, mem_ops);
+
+		memcpy(to, aligned, size);
+		BENCH(bytes, sink += (uint32_t) byte_compare(to, aligned, size));
+		BENCH(library, sink += (uint32_t) memcmp(to, aligned, size));
+		BENCH(mem_ops, sink += (uint32_t) xMemCompare(to, aligned, size));
+		print_speed("compare, equal", size, bytes, library, mem_ops);
+
+		// The C library has no checksum, so the column is left at 0
+		BENCH(bytes, sink += byte_checksum(aligned, size, 0));
+		BENCH(mem_ops, sink += usMemChecksum(aligned, size, 0));
+		print_speed("checksum", size, bytes, 0, mem_ops);
+	}
+}
+
+#endif /* configUSE_MEM_OPS */
+
+// Items through a queue and chunks through a stream buffer from a task to
+// itself, so the time is that of the kernel's copies and bookkeeping
+static void bench_kernel_copies(void)
+{
+	static uint8_t item[BENCH_QUEUE_ITEM], received[BENCH_STREAM_CHUNK];
+	QueueHandle_t queue = xQueueCreate(BENCH_QUEUE_LENGTH, BENCH_QUEUE_ITEM);
+	StreamBufferHandle_t stream = xStreamBufferCreate(BENCH_STREAM_SIZE, 1);
+	uint32_t queue_errors = 0, stream_errors = 0;
+	uint64_t start, queue_ticks, stream_ticks;
+
+	configASSERT((queue != NULL) && (stream != NULL));
+
+	fill_random(source, sizeof(source));
+
+	start = bench_now();
+	for (uint32_t round = 0; round < BENCH_ROUNDS; round++)
+	{
+		item[0] = (uint8_t) round;
+		configASSERT(xQueueSend(queue, item, 0) == pdPASS);
+		configASSERT(xQueueReceive(queue, received, 0) == pdPASS);
+		queue_errors += (received[0] != (uint8_t) round) ? 1 : 0;
+	}
+	queue_ticks = bench_now() - start;
+
+	// The chunks do not divide the buffer, so they wrap at every offset
+	start = bench_now();
+	for (uint32_t round = 0; round < BENCH_ROUNDS; round++)
+	{
+		const uint8_t *chunk = &source[round % (sizeof(source) - BENCH_STREAM_CHUNK)];
+
+		configASSERT(xStreamBufferSend(stream, chunk, BENCH_STREAM_CHUNK, 0) == BENCH_STREAM_CHUNK);
+		configASSERT(xStreamBufferReceive(stream, received, BENCH_STREAM_CHUNK, 0) == BENCH_STREAM_CHUNK);
+		stream_errors += (memcmp(received, chunk, BENCH_STREAM_CHUNK) != 0) ? 1 : 0;
+	}
+	stream_ticks = bench_now() - start;
+
+	// Every byte of the items, not only the first, must come back
+	for (uint32_t i = 0; i < BENCH_QUEUE_LENGTH; i++)
+	{
+		fill_random(item, sizeof(item));
+		memcpy(&expected[i * BENCH_QUEUE_ITEM], item, sizeof(item));
+		configASSERT(xQueueSend(queue, item, 0) == pdPASS);
+	}
+	for (uint32_t i = 0; i < BENCH_QUEUE_LENGTH; i++)
+	{
+		configASSERT(xQueueReceive(queue, received, 0) == pdPASS);
+		queue_errors += (memcmp(received, &expected[i * BENCH_QUEUE_ITEM], BENCH_QUEUE_ITEM) != 0) ? 1 : 0;
+	}
+
+	report("queue", "items received", queue_errors);
+	report("stream buffer", "data received", stream_errors);
+
+	sim_printf("%s: queue send and receive of %d bytes %lu %s, stream buffer send and receive of %d bytes %lu %s\n",
+			(configUSE_MEM_OPS == 1) ? "mem_ops" : "memcpy", BENCH_QUEUE_ITEM,
+			(unsigned long) (queue_ticks / BENCH_ROUNDS), BENCH_UNIT, BENCH_STREAM_CHUNK,
+			(unsigned long) (stream_ticks / BENCH_ROUNDS), BENCH_UNIT);
+
+	vQueueDelete(queue);
+	vStreamBufferDelete(stream);
+}
+
+static void bench_task(void *params)
+{
+	(void) params;
+
+#if (configUSE_MEM_OPS == 1)
+	check_copy_and_set();
+	check_compare();
+	check_checksum();
+	bench_operations();
+#endif
+
+	bench_kernel_copies();
+
+	sim_printf("%lu failed\n", (unsigned long) failures);
+
+	exit((failures == 0) ? 0 : 1);
+}
+
+// driver funtion
+int main(void)
+{
+	sim_run(bench_task, "Bench", configTIMER_TASK_PRIORITY - 1);
+}
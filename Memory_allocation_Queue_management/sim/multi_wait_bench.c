@@ -0,0 +1,631 @@
+/**
+  ******************************************************************************
+  * @file    multi_wait_bench.c
+  * @brief   Host simulation of xMultiWaitForAny() (multi_wait.h).  It checks
+  * 		 polling, timeouts, wakeups by queues, semaphores and event groups
+  * 		 from tasks and from a simulated interrupt, and that a task woken
+  * 		 by one object leaves list items in the others that later senders
+  * 		 skip, passing the object to the next task waiting for it.  After
+  * 		 every wait no list item may be left in an object.  Then it times
+  * 		 from a send to the woken task holding the item, waiting on 1 to 16
+  * 		 queues with a multi-wait and with a queue set, against a plain
+  * 		 xQueueReceive().  See README.md for the build command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <semaphore.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "multi_wait.h"
+#include "sim_common.h"
+
+#if (configUSE_QUEUE_SETS != 1)
+	#error Build with -DconfigUSE_QUEUE_SETS=1 to compare with queue sets
+#endif
+
+#define SIM_INTERRUPT			(portFIRST_USER_INTERRUPT)
+#define SIM_TIMEOUT_TICKS		(10)
+#define SIM_ISR_WAITS			(2000)
+#define SIM_ISR_DELAY_NS		(20000)
+#define SIM_BITS				((EventBits_t) 0x03)
+#define BENCH_MAX_QUEUES		(16)
+#define BENCH_SAMPLES			(20000)
+
+// Priorities, below the main task at configMAX_PRIORITIES - 1
+#define SIM_WAITER_PRIORITY		(2)
+#define SIM_HELPER_PRIORITY		(1)
+#define BENCH_WAITER_PRIORITY	(3)
+#define BENCH_SENDER_PRIORITY	(2)
+
+typedef enum
+{
+	WAIT_RECEIVE = 0,
+	WAIT_MULTI,
+	WAIT_SET
+} wait_method_t;
+
+static QueueHandle_t queues[BENCH_MAX_QUEUES];
+static SemaphoreHandle_t semaphore;
+static EventGroupHandle_t events;
+static MultiWaitObject_t objects[4];
+
+static TaskHandle_t main_handle, helper_handle, waiter_handle, receiver_handle;
+static void (*volatile helper_action)(void);
+static MultiWaitObject_t *volatile waiter_list;
+static volatile BaseType_t waiter_result, stale_event_group, main_blocked;
+static volatile uint32_t receiver_items, receiver_value;
+
+// What the simulated interrupt gives, set before it is raised
+static volatile uint32_t isr_object;
+static volatile uint32_t isr_count;
+static sem_t isr_request;
+
+static uint32_t checks, failures;
+
+static void check(BaseType_t good, const char *what, uint32_t detail)
+{
+	checks++;
+
+	if (good == pdFALSE)
+	{
+		if (failures < 10)
+		{
+			printf("%s failed (%lu)\n", what, (unsigned long) detail);
+		}
+
+		failures++;
+	}
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// The time stamp counter, which runs at the processor's nominal clock
+#define BENCH_UNIT				"cycles"
+
+static uint64_t bench_now(void)
+{
+	__asm volatile ("" ::: "memory");
+	return __rdtsc();
+}
+#else
+#define BENCH_UNIT				"ns"
+
+static uint64_t bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+}
+#endif
+
+// Whether xMultiWaitForAny() took every list item out of the objects
+static BaseType_t unlinked(const MultiWaitObject_t *list, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (listLIST_ITEM_CONTAINER(&list[i].xWaitListItem) != NULL)
+		{
+			return pdFALSE;
+		}
+	}
+
+	return pdTRUE;
+}
+
+// Queues 0 and 1, the semaphore, and both event bits
+static void set_objects(void)
+{
+	vMultiWaitSetQueue(&objects[0], queues[0]);
+	vMultiWaitSetQueue(&objects[1], queues[1]);
+	vMultiWaitSetSemaphore(&objects[2], semaphore);
+	vMultiWaitSetEventGroup(&objects[3], events, SIM_BITS, pdTRUE);
+}
+
+// Runs helper_action below the main task, so once the main task blocks
+static void helper_task(void *params)
+{
+	(void) params;
+
+	for (;;)
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		helper_action();
+	}
+}
+
+static void run_helper(void (*action)(void))
+{
+	helper_action = action;
+	xTaskNotifyGive(helper_handle);
+}
+
+static void send_queue_1(void)
+{
+	uint32_t value = 11;
+
+	(void) xQueueSend(queues[1], &value, 0);
+}
+
+static void give_semaphore(void)
+{
+	(void) xSemaphoreGive(semaphore);
+}
+
+// One bit must not wake a wait for both
+static void set_bits_in_turn(void)
+{
+	(void) xEventGroupSetBits(events, 0x01);
+	main_blocked = (eTaskGetState(main_handle) == eBlocked) ? pdTRUE : pdFALSE;
+	(void) xEventGroupSetBits(events, 0x02);
+}
+
+// Waits on queue 0 and on queue 1 or the event bits, for the main task,
+// which is above it
+static void waiter_task(void *params)
+{
+	MultiWaitObject_t list[2];
+
+	(void) params;
+
+	// Published so the main task can see the list items left behind
+	waiter_list = list;
+
+	for (;;)
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+		vMultiWaitSetQueue(&list[0], queues[0]);
+		if (stale_event_group == pdTRUE)
+		{
+			vMultiWaitSetEventGroup(&list[1], events, SIM_BITS, pdFALSE);
+		}
+		else
+		{
+			vMultiWaitSetQueue(&list[1], queues[1]);
+		}
+
+		waiter_result = xMultiWaitForAny(list, 2, portMAX_DELAY);
+		check(unlinked(list, 2), "waiter unlinked", 0);
+	}
+}
+
+// Waits for queue 1, or the event bits, behind the waiter
+static void receiver_task(void *params)
+{
+	uint32_t value;
+
+	(void) params;
+
+	for (;;)
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+		if (stale_event_group == pdTRUE)
+		{
+			(void) xEventGroupWaitBits(events, SIM_BITS, pdTRUE, pdFALSE, portMAX_DELAY);
+			receiver_items++;
+		}
+		else if (xQueueReceive(queues[1], &value, portMAX_DELAY) == pdPASS)
+		{
+			receiver_value = value;
+			receiver_items++;
+		}
+	}
+}
+
+static uint32_t interrupt_handler(void)
+{
+	BaseType_t woken = pdFALSE;
+	uint32_t value = 33;
+
+	isr_count++;
+
+	if (isr_object == 2)
+	{
+		(void) xSemaphoreGiveFromISR(semaphore, &woken);
+	}
+	else
+	{
+		(void) xQueueSendFromISR(queues[isr_object], &value, &woken);
+	}
+
+	return (uint32_t) woken;
+}
+
+// Stands in for a peripheral, raising the interrupt a little after each
+// request, so it lands before, during or after the wait is set up
+static void *peripheral_thread(void *params)
+{
+	uint32_t seed = 1;
+	struct timespec delay = { 0, 0 };
+
+	(void) params;
+
+	for (;;)
+	{
+		(void) sem_wait(&isr_request);
+
+		seed = (seed * 1103515245UL) + 12345UL;
+		delay.tv_nsec = (seed >> 8) % SIM_ISR_DELAY_NS;
+		nanosleep(&delay, NULL);
+
+		vPortGenerateSimulatedInterrupt(SIM_INTERRUPT);
+	}
+
+	return NULL;
+}
+
+// Polling, lowest index first, and a timeout that leaves nothing behind
+static void check_poll_and_timeout(void)
+{
+	TickType_t start, elapsed;
+	uint32_t value = 7;
+	BaseType_t result;
+
+	set_objects();
+	check(xMultiWaitForAny(objects, 4, 0) == multiwaitTIMEOUT, "poll empty", 0);
+	check(unlinked(objects, 4), "poll empty unlinked", 0);
+
+	(void) xSemaphoreGive(semaphore);
+	(void) xQueueSend(queues[1], &value, 0);
+	result = xMultiWaitForAny(objects, 4, 0);
+	check((result == 1) && unlinked(objects, 4), "poll lowest index", (uint32_t) result);
+	(void) xQueueReceive(queues[1], &value, 0);
+	check(xMultiWaitForAny(objects, 4, 0) == 2, "poll semaphore", 0);
+	(void) xSemaphoreTake(semaphore, 0);
+
+	(void) xEventGroupSetBits(events, SIM_BITS);
+	check(xMultiWaitForAny(objects, 4, 0) == 3, "poll event bits", 0);
+	check(xEventGroupGetBits(events) == SIM_BITS, "bits kept", 0);
+	(void) xEventGroupClearBits(events, SIM_BITS);
+
+	start = xTaskGetTickCount();
+	result = xMultiWaitForAny(objects, 4, SIM_TIMEOUT_TICKS);
+	elapsed = xTaskGetTickCount() - start;
+	check((result == multiwaitTIMEOUT) && (elapsed >= SIM_TIMEOUT_TICKS) && (elapsed <= (SIM_TIMEOUT_TICKS + 2)),
+			"timeout", (uint32_t) elapsed);
+	check(unlinked(objects, 4), "timeout unlinked", 0);
+
+	// Nothing may still point at this task once the wait has timed out
+	(void) xQueueSend(queues[0], &value, 0);
+	(void) xSemaphoreGive(semaphore);
+	check((uxQueueMessagesWaiting(queues[0]) == 1) && (uxQueueMessagesWaiting(semaphore) == 1), "after timeout", 0);
+	(void) xQueueReceive(queues[0], &value, 0);
+	(void) xSemaphoreTake(semaphore, 0);
+}
+
+// Woken while blocked by a queue, a semaphore and an event group, whose
+// bits must all be set and are not cleared
+static void check_task_wakeups(void)
+{
+	uint32_t value = 0;
+	BaseType_t result;
+
+	set_objects();
+
+	run_helper(send_queue_1);
+	result = xMultiWaitForAny(objects, 4, portMAX_DELAY);
+	check((result == 1) && (xQueueReceive(queues[1], &value, 0) == pdPASS) && (value == 11) &&
+			unlinked(objects, 4), "queue wakeup", (uint32_t) result);
+
+	run_helper(give_semaphore);
+	result = xMultiWaitForAny(objects, 4, portMAX_DELAY);
+	check((result == 2) && (xSemaphoreTake(semaphore, 0) == pdPASS) && unlinked(objects, 4),
+			"semaphore wakeup", (uint32_t) result);
+
+	main_blocked = pdFALSE;
+	run_helper(set_bits_in_turn);
+	result = xMultiWaitForAny(objects, 4, portMAX_DELAY);
+	check((result == 3) && (main_blocked == pdTRUE) && (xEventGroupGetBits(events) == SIM_BITS) &&
+			unlinked(objects, 4), "event group wakeup", (uint32_t) result);
+	(void) xEventGroupClearBits(events, SIM_BITS);
+}
+
+// The waiter is woken by queue 0 but cannot run until the main task blocks,
+// so its list item is still in queue 1, or the event group, when the main
+// task gives that too.  The item is skipped, and the receiver behind it, if
+// there is one, gets the object
+static void check_stale_items(void)
+{
+	uint32_t value = 5, items;
+
+	for (uint32_t variant = 0; variant < 4; variant++)
+	{
+		BaseType_t event_group = ((variant & 1) != 0) ? pdTRUE : pdFALSE;
+		BaseType_t receiver = ((variant & 2) != 0) ? pdTRUE : pdFALSE;
+
+		stale_event_group = event_group;
+		items = receiver_items;
+		waiter_result = multiwaitTIMEOUT - 1;
+
+		xTaskNotifyGive(waiter_handle);
+		if (receiver == pdTRUE)
+		{
+			xTaskNotifyGive(receiver_handle);
+		}
+		vTaskDelay(2);
+
+		check(eTaskGetState(waiter_handle) == eBlocked, "waiter blocked", variant);
+		(void) xQueueSend(queues[0], &value, 0);
+		check((listLIST_ITEM_CONTAINER(&waiter_list[0].xWaitListItem) == NULL) &&
+				(listLIST_ITEM_CONTAINER(&waiter_list[1].xWaitListItem) != NULL), "stale item left", variant);
+
+		if (event_group == pdTRUE)
+		{
+			(void) xEventGroupSetBits(events, 0x01);
+		}
+		else
+		{
+			value = 42;
+			(void) xQueueSend(queues[1], &value, 0);
+		}
+
+		vTaskDelay(2);
+
+		check((waiter_result == 0) && (xQueueReceive(queues[0], &value, 0) == pdPASS), "stale waiter", variant);
+
+		if (receiver == pdTRUE)
+		{
+			check((receiver_items == (items + 1)) && ((event_group == pdTRUE) || (receiver_value == 42)),
+					"stale skipped to receiver", variant);
+		}
+		else if (event_group == pdTRUE)
+		{
+			check(xEventGroupGetBits(events) == 0x01, "stale bits kept", variant);
+		}
+		else
+		{
+			check(xQueueReceive(queues[1], &value, 0) == pdPASS, "stale item kept", variant);
+		}
+
+		(void) xEventGroupClearBits(events, SIM_BITS);
+	}
+
+	stale_event_group = pdFALSE;
+}
+
+// A simulated interrupt gives one of three objects at a random point before
+// or during the wait
+static void check_interrupt_wakeups(void)
+{
+	uint32_t value, seed = 7, timeouts = 0, wrong = 0;
+	BaseType_t result;
+
+	set_objects();
+
+	for (uint32_t i = 0; i < SIM_ISR_WAITS; i++)
+	{
+		seed = (seed * 1103515245UL) + 12345UL;
+		isr_object = (seed >> 8) % 3;
+		(void) sem_post(&isr_request);
+
+		result = xMultiWaitForAny(objects, 4, pdMS_TO_TICKS(100));
+		timeouts += (result == multiwaitTIMEOUT) ? 1 : 0;
+		wrong += ((result != (BaseType_t) isr_object) || (unlinked(objects, 4) == pdFALSE)) ? 1 : 0;
+
+		if (isr_object == 2)
+		{
+			wrong += (xSemaphoreTake(semaphore, 0) == pdPASS) ? 0 : 1;
+		}
+		else
+		{
+			wrong += (xQueueReceive(queues[isr_object], &value, 0) == pdPASS) ? 0 : 1;
+		}
+	}
+
+	check((timeouts == 0) && (wrong == 0) && (isr_count == SIM_ISR_WAITS), "interrupt wakeups", wrong + timeouts);
+}
+
+// Times sending to the last of count queues.  With the waiter above the
+// sender, from the send to the waiter holding the item, switching to it on
+// the way.  With the two at the same priority, the send alone, which only
+// makes the waiter ready; the sender then yields to let it wait again
+static volatile uint64_t sent_at;
+static uint64_t samples[BENCH_SAMPLES];
+static volatile wait_method_t bench_method;
+static volatile uint32_t bench_count;
+static volatile BaseType_t bench_switch;
+static QueueSetHandle_t bench_set;
+
+static void bench_waiter_task(void *params)
+{
+	MultiWaitObject_t list[BENCH_MAX_QUEUES];
+	QueueHandle_t last;
+	uint32_t value;
+
+	(void) params;
+
+	for (;;)
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		last = queues[bench_count - 1];
+
+		for (uint32_t n = 0; n < BENCH_SAMPLES; n++)
+		{
+			if (bench_method == WAIT_RECEIVE)
+			{
+				(void) xQueueReceive(last, &value, portMAX_DELAY);
+			}
+			else if (bench_method == WAIT_MULTI)
+			{
+				for (uint32_t i = 0; i < bench_count; i++)
+				{
+					vMultiWaitSetQueue(&list[i], queues[i]);
+				}
+				configASSERT(xMultiWaitForAny(list, bench_count, portMAX_DELAY) == (BaseType_t) (bench_count - 1));
+				(void) xQueueReceive(last, &value, 0);
+			}
+			else
+			{
+				configASSERT(xQueueSelectFromSet(bench_set, portMAX_DELAY) == last);
+				(void) xQueueReceive(last, &value, 0);
+			}
+
+			if (bench_switch == pdTRUE)
+			{
+				samples[n] = bench_now() - sent_at;
+			}
+		}
+	}
+}
+
+static void bench_sender_task(void *params)
+{
+	uint32_t value = 1;
+
+	(void) params;
+
+	for (;;)
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+		for (uint32_t n = 0; n < BENCH_SAMPLES; n++)
+		{
+			// A time slice can leave the waiter holding the last item
+			sent_at = bench_now();
+			(void) xQueueSend(queues[bench_count - 1], &value, portMAX_DELAY);
+
+			if (bench_switch == pdFALSE)
+			{
+				samples[n] = bench_now() - sent_at;
+				taskYIELD();
+			}
+		}
+
+		xTaskNotifyGive(main_handle);
+	}
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *) a, y = *(const uint64_t *) b;
+
+	return (x > y) - (x < y);
+}
+
+// The median of BENCH_SAMPLES sends, as the host adds its own delays to some
+static uint64_t bench_send(TaskHandle_t waiter, TaskHandle_t sender, wait_method_t method, uint32_t count,
+		BaseType_t with_switch)
+{
+	bench_method = method;
+	bench_count = count;
+	bench_switch = with_switch;
+	vTaskPrioritySet(waiter, (with_switch == pdTRUE) ? BENCH_WAITER_PRIORITY : BENCH_SENDER_PRIORITY);
+
+	if (method == WAIT_SET)
+	{
+		// Room for an event of every member
+		bench_set = xQueueCreateSet(count);
+		configASSERT(bench_set != NULL);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			configASSERT(xQueueAddToSet(queues[i], bench_set) == pdPASS);
+		}
+	}
+
+	// The waiter blocks first, then the sender runs
+	xTaskNotifyGive(waiter);
+	xTaskNotifyGive(sender);
+	(void) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+	if (method == WAIT_SET)
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			configASSERT(xQueueRemoveFromSet(queues[i], bench_set) == pdPASS);
+		}
+		vQueueDelete(bench_set);
+	}
+
+	qsort(samples, BENCH_SAMPLES, sizeof(samples[0]), compare_u64);
+	return samples[BENCH_SAMPLES / 2];
+}
+
+static void bench(void)
+{
+	static const uint32_t counts[] = {1, 4, 16};
+	TaskHandle_t waiter, sender;
+
+	xTaskCreate(bench_waiter_task, "BWait", SIM_STACK_SIZE, NULL, BENCH_WAITER_PRIORITY, &waiter);
+	xTaskCreate(bench_sender_task, "BSend", SIM_STACK_SIZE, NULL, BENCH_SENDER_PRIORITY, &sender);
+	configASSERT((waiter != NULL) && (sender != NULL));
+
+	printf("median %s of %d sends, waking a task blocked on the last of the queues\n", BENCH_UNIT, BENCH_SAMPLES);
+	printf("%-14s %6s %12s %12s\n", "waiting with", "queues", "send", "send to wake");
+	printf("%-14s %6d %12llu %12llu\n", "xQueueReceive", 1,
+			(unsigned long long) bench_send(waiter, sender, WAIT_RECEIVE, 1, pdFALSE),
+			(unsigned long long) bench_send(waiter, sender, WAIT_RECEIVE, 1, pdTRUE));
+
+	for (uint32_t k = 0; k < (sizeof(counts) / sizeof(counts[0])); k++)
+	{
+		printf("%-14s %6lu %12llu %12llu\n", "multi-wait", (unsigned long) counts[k],
+				(unsigned long long) bench_send(waiter, sender, WAIT_MULTI, counts[k], pdFALSE),
+				(unsigned long long) bench_send(waiter, sender, WAIT_MULTI, counts[k], pdTRUE));
+		printf("%-14s %6lu %12llu %12llu\n", "queue set", (unsigned long) counts[k],
+				(unsigned long long) bench_send(waiter, sender, WAIT_SET, counts[k], pdFALSE),
+				(unsigned long long) bench_send(waiter, sender, WAIT_SET, counts[k], pdTRUE));
+	}
+}
+
+// Runs the checks, then the benchmark, and prints the results
+static void main_task(void *params)
+{
+	pthread_t peripheral;
+
+	(void) params;
+
+	main_handle = xTaskGetCurrentTaskHandle();
+	xTaskCreate(helper_task, "Helper", SIM_STACK_SIZE, NULL, SIM_HELPER_PRIORITY, &helper_handle);
+	xTaskCreate(waiter_task, "Waiter", SIM_STACK_SIZE, NULL, SIM_WAITER_PRIORITY, &waiter_handle);
+	xTaskCreate(receiver_task, "Recv", SIM_STACK_SIZE, NULL, SIM_HELPER_PRIORITY, &receiver_handle);
+	configASSERT((helper_handle != NULL) && (waiter_handle != NULL) && (receiver_handle != NULL));
+
+	(void) sem_init(&isr_request, 0, 0);
+	pthread_create(&peripheral, NULL, peripheral_thread, NULL);
+
+	check_poll_and_timeout();
+	check_task_wakeups();
+	check_stale_items();
+	check_interrupt_wakeups();
+
+	printf("checks: %lu, failures: %lu\n", (unsigned long) checks, (unsigned long) failures);
+	fflush(stdout);
+
+	if (failures == 0)
+	{
+		bench();
+	}
+
+	fflush(stdout);
+	exit((failures == 0) ? 0 : 1);
+}
+
+// driver funtion
+int main(void)
+{
+	for (uint32_t i = 0; i < BENCH_MAX_QUEUES; i++)
+	{
+		queues[i] = xQueueCreate(1, sizeof(uint32_t));
+		configASSERT(queues[i] != NULL);
+	}
+
+	semaphore = xSemaphoreCreateBinary();
+	events = xEventGroupCreate();
+	configASSERT((semaphore != NULL) && (events != NULL));
+	vPortSetInterruptHandler(SIM_INTERRUPT, interrupt_handler);
+
+	sim_run(main_task, "Main", configMAX_PRIORITIES - 1);
+}
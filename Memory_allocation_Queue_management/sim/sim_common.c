@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * @file    sim_common.c
+  * @brief   Helpers shared by the host simulations, see sim_common.h
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+
+#include "sim_common.h"
+
+void sim_print_lock(void)
+{
+	taskENTER_CRITICAL();
+}
+
+void sim_print_unlock(void)
+{
+	fflush(stdout);
+	taskEXIT_CRITICAL();
+}
+
+void sim_printf(const char *format, ...)
+{
+	va_list args;
+
+	va_start(args, format);
+	sim_print_lock();
+	{
+		vprintf(format, args);
+	}
+	sim_print_unlock();
+	va_end(args);
+}
+
+void sim_run(TaskFunction_t function, const char *name, UBaseType_t priority)
+{
+	BaseType_t result;
+
+	result = xTaskCreate(function, name, SIM_STACK_SIZE, NULL, priority, NULL);
+	configASSERT(result == pdPASS);
+
+	// Start Scheduler
+	vTaskStartScheduler();
+
+	for(;;);
+}
+
+void vAssertCalled(const char *file, unsigned long line)
+{
+	taskDISABLE_INTERRUPTS();
+	fprintf(stderr, "assert failed: %s:%lu\n", file, line);
+	abort();
+}
@@ -0,0 +1,29 @@
+/**
+  ******************************************************************************
+  * @file    sim_common.h
+  * @brief   Helpers shared by the host simulations: printing from tasks,
+  * 		 starting the scheduler with a first task, and the assert
+  * 		 handler.
+  ******************************************************************************
+*/
+
+#ifndef SIM_COMMON_H
+#define SIM_COMMON_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+// Stack of every task a simulation creates.  Each is a host thread, so this
+// only needs to hold the kernel's view of the task
+#define SIM_STACK_SIZE			(configMINIMAL_STACK_SIZE * 4)
+
+// The C library must not be entered by two tasks at once, so tasks print
+// between sim_print_lock() and sim_print_unlock(), or with sim_printf()
+void sim_print_lock(void);
+void sim_print_unlock(void);
+void sim_printf(const char *format, ...) __attribute__((format(printf, 1, 2)));
+
+// Creates the task that runs the simulation and starts the scheduler
+void sim_run(TaskFunction_t function, const char *name, UBaseType_t priority) __attribute__((noreturn));
+
+#endif /* SIM_COMMON_H */
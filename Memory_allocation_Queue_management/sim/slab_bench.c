@@ -0,0 +1,175 @@
+/**
+  ******************************************************************************
+  * @file    slab_bench.c
+  * @brief   Host simulation timing the creation and deletion of tasks, queues
+  * 		 and timers on a fragmented heap.  Build with and without
+  * 		 configUSE_OBJECT_SLABS to compare heap_4 with the object slabs
+  * 		 (object_slab.h).  The mean time of each operation is printed,
+  * 		 with the occupancy of each slab.  See README.md for the build
+  * 		 command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "timers.h"
+#include "sim_common.h"
+
+#if (configUSE_OBJECT_SLABS == 1)
+	#include "object_slab.h"
+#endif
+
+#define BENCH_ROUNDS			(2000)
+#define BENCH_OBJECTS			(4)
+#define BENCH_FRAGMENTS			(400)
+
+typedef struct
+{
+	const char *name;
+	uint64_t create_ns;
+	uint64_t delete_ns;
+} Result_st;
+
+static Result_st results[] = { { "task", 0, 0 }, { "queue", 0, 0 }, { "timer", 0, 0 } };
+static void *fragments[BENCH_FRAGMENTS];
+
+// Never runs, as it is created below the priority of the benchmark
+static void idle_worker(void *params)
+{
+	(void) params;
+
+	for(;;)
+	{
+		vTaskDelay(portMAX_DELAY);
+	}
+}
+
+static void timer_callback(TimerHandle_t timer)
+{
+	(void) timer;
+}
+
+// Leaves every other block of a long run free, so the heap's free list is long
+static void fragment_heap(void)
+{
+	uint32_t i;
+
+	for (i = 0; i < BENCH_FRAGMENTS; i++)
+	{
+		fragments[i] = pvPortMalloc(16 + ((i * 37) % 96));
+	}
+
+	for (i = 0; i < BENCH_FRAGMENTS; i += 2)
+	{
+		vPortFree(fragments[i]);
+	}
+}
+
+static void print_results(void)
+{
+	uint32_t i;
+
+	sim_print_lock();
+	{
+		for (i = 0; i < (sizeof(results) / sizeof(results[0])); i++)
+		{
+			printf("cores: %d, %s, %-5s create %5lu ns, delete %5lu ns\n", configNUMBER_OF_CORES,
+					(configUSE_OBJECT_SLABS == 1) ? "slabs" : "heap", results[i].name,
+					(unsigned long) (results[i].create_ns / (BENCH_ROUNDS * BENCH_OBJECTS)),
+					(unsigned long) (results[i].delete_ns / (BENCH_ROUNDS * BENCH_OBJECTS)));
+		}
+
+#if (configUSE_OBJECT_SLABS == 1)
+		static const char *slab_names[] = { "tasks", "small stacks", "large stacks", "queues", "timers" };
+		SlabStats_t stats;
+
+		for (i = 0; i < eSlabNumberOfSlabs; i++)
+		{
+			vSlabGetStats((eSlab) i, &stats);
+			printf("  slab %-12s %2lu of %2lu blocks of %4lu bytes in use, most %2lu, heap fallbacks %lu\n",
+					slab_names[i], (unsigned long) stats.uxBlocksInUse, (unsigned long) stats.uxNumberOfBlocks,
+					(unsigned long) stats.xBlockSizeInBytes, (unsigned long) stats.uxMaximumBlocksInUse,
+					(unsigned long) stats.uxHeapFallbacks);
+		}
+#endif
+	}
+	sim_print_unlock();
+}
+
+static void bench_task(void *params)
+{
+	TaskHandle_t tasks[BENCH_OBJECTS];
+	QueueHandle_t queues[BENCH_OBJECTS];
+	TimerHandle_t timers[BENCH_OBJECTS];
+	uint32_t round, i, start;
+
+	(void) params;
+
+	fragment_heap();
+
+	for (round = 0; round < BENCH_ROUNDS; round++)
+	{
+		start = ulPortGetTraceTimestamp();
+		for (i = 0; i < BENCH_OBJECTS; i++)
+		{
+			xTaskCreate(idle_worker, "Worker", configMINIMAL_STACK_SIZE, NULL, 1, &tasks[i]);
+		}
+		results[0].create_ns += ulPortGetTraceTimestamp() - start;
+
+		start = ulPortGetTraceTimestamp();
+		for (i = 0; i < BENCH_OBJECTS; i++)
+		{
+			queues[i] = xQueueCreate(4, sizeof(uint32_t));
+		}
+		results[1].create_ns += ulPortGetTraceTimestamp() - start;
+
+		start = ulPortGetTraceTimestamp();
+		for (i = 0; i < BENCH_OBJECTS; i++)
+		{
+			timers[i] = xTimerCreate("Timer", 10, pdFALSE, NULL, timer_callback);
+		}
+		results[2].create_ns += ulPortGetTraceTimestamp() - start;
+
+		configASSERT((tasks[BENCH_OBJECTS - 1] != NULL) && (queues[BENCH_OBJECTS - 1] != NULL) && (timers[BENCH_OBJECTS - 1] != NULL));
+
+		// The workers have not run, so are freed by vTaskDelete() itself
+		start = ulPortGetTraceTimestamp();
+		for (i = 0; i < BENCH_OBJECTS; i++)
+		{
+			vTaskDelete(tasks[i]);
+		}
+		results[0].delete_ns += ulPortGetTraceTimestamp() - start;
+
+		start = ulPortGetTraceTimestamp();
+		for (i = 0; i < BENCH_OBJECTS; i++)
+		{
+			vQueueDelete(queues[i]);
+		}
+		results[1].delete_ns += ulPortGetTraceTimestamp() - start;
+
+		// Timers are deleted by the timer task, so the time is only that of
+		// sending the command
+		start = ulPortGetTraceTimestamp();
+		for (i = 0; i < BENCH_OBJECTS; i++)
+		{
+			xTimerDelete(timers[i], portMAX_DELAY);
+		}
+		results[2].delete_ns += ulPortGetTraceTimestamp() - start;
+
+		// Let the timer task free the timers
+		vTaskDelay(1);
+	}
+
+	print_results();
+	exit(0);
+}
+
+// driver funtion
+int main(void)
+{
+	sim_run(bench_task, "Bench", configTIMER_TASK_PRIORITY - 1);
+}
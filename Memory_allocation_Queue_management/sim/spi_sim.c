@@ -0,0 +1,401 @@
+/**
+  ******************************************************************************
+  * @file    spi_sim.c
+  * @brief   Host simulation of the SPI bus manager (spi_bus.h) against
+  * 		 simulated SPI and DMA registers.  A host thread plays the part of
+  * 		 the SPI and its two DMA streams, clocking bytes at the rate the
+  * 		 selected device's prescaler gives from an 84MHz bus, and answers
+  * 		 for three devices.  Two tasks share a sensor at the same priority,
+  * 		 each reading it every tick, a third writes to another device at
+  * 		 high priority every tick, and a bulk read of the third device runs
+  * 		 continuously from its own callback in the time left.  Every byte
+  * 		 is checked, then the bus statistics and the latency of each kind
+  * 		 of transaction are printed.  See README.md for the build command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include "spi_bus.h"
+#include "dma_hw_sim.h"
+#include "sim_common.h"
+
+#define SIM_BUS_CLOCK_HZ		(84000000ULL)
+#define SIM_RUN_TICKS			(pdMS_TO_TICKS(2000))
+#define SIM_DMA_CONTROLLER		(2)
+#define SIM_RX_STREAM			(0)
+#define SIM_TX_STREAM			(3)
+#define SIM_INTERRUPT			(portFIRST_USER_INTERRUPT)
+#define SIM_POLL_NS				(20000)
+#define SIM_SENSOR_LENGTH		(16)
+#define SIM_POLL_LENGTH			(4)
+#define SIM_BULK_LENGTH			(256)
+#define SIM_DEVICES				(3)
+
+// Where the transfer complete flags of streams 0 and 3 are in LISR
+#define SIM_RX_TCIF				(1UL << 5)
+#define SIM_TX_TCIF				(1UL << 27)
+
+// How the simulated devices answer: each byte received is the byte sent, its
+// position in the transfer and the device's number combined
+#define SIM_ANSWER(device, position, sent)	((uint8_t) ((sent) ^ (position) ^ (0x40 * ((device) + 1))))
+
+typedef struct
+{
+	const char *name;
+	uint32_t transactions;
+	uint64_t latency_total_us;
+	uint32_t latency_max_us;
+	uint32_t corrupt;
+} sim_class_t;
+
+// Simulated registers
+static SPI_TypeDef sim_spi;
+
+// The streams hold 32 bit addresses, so the bus, which holds the bytes sent
+// and received when a transaction has no buffer, and every buffer are in the
+// low 4GB of the host's address space
+typedef struct
+{
+	spi_bus_t bus;
+	spi_transaction_t bulk;
+	uint8_t sensor_tx[2][SIM_SENSOR_LENGTH];
+	uint8_t sensor_rx[2][SIM_SENSOR_LENGTH];
+	uint8_t poll_tx[SIM_POLL_LENGTH];
+	uint8_t bulk_rx[SIM_BULK_LENGTH];
+} sim_memory_t;
+
+static sim_memory_t *memory;
+
+static const spi_device_t device[SIM_DEVICES] =
+{
+	{ NULL, 0, SPI_CPOL_Low, SPI_CPHA_1Edge, SPI_BaudRatePrescaler_8 },
+	{ NULL, 1, SPI_CPOL_High, SPI_CPHA_2Edge, SPI_BaudRatePrescaler_16 },
+	{ NULL, 2, SPI_CPOL_Low, SPI_CPHA_1Edge, SPI_BaudRatePrescaler_4 }
+};
+
+static sim_class_t sensor_class[2] = { { .name = "sensor A" }, { .name = "sensor B" } };
+static sim_class_t poll_class = { .name = "poll" };
+static sim_class_t bulk_class = { .name = "bulk" };
+
+static volatile int32_t selected = -1;
+static volatile uint32_t select_errors, gaps;
+static volatile uint64_t gap_total_ns;
+static volatile BaseType_t stop_tasks, stop_controller;
+static volatile uint32_t running_tasks;
+
+static void sim_enable_spi(SPI_TypeDef *regs, FunctionalState state)
+{
+	(void) regs;
+	(void) state;
+}
+
+// Only one device may be selected at a time
+static void sim_chip_select(const spi_device_t *device, FunctionalState active)
+{
+	if (active == ENABLE)
+	{
+		if (selected != -1)
+		{
+			select_errors++;
+		}
+
+		selected = device->cs_pin;
+	}
+	else
+	{
+		if (selected != device->cs_pin)
+		{
+			select_errors++;
+		}
+
+		selected = -1;
+	}
+}
+
+static const spi_hw_t sim_spi_hw =
+{
+	sim_enable_spi,
+	sim_chip_select
+};
+
+static uint64_t now_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t) now.tv_sec * 1000000000ULL) + (uint64_t) now.tv_nsec;
+}
+
+// Clocks the bytes of each transfer the streams are enabled for at the rate
+// set in the SPI, and raises the receive stream's interrupt at the end.  It
+// looks for work every SIM_POLL_NS, which on the host is longer than a short
+// transfer takes on the bus.
+static void *spi_thread(void *params)
+{
+	DMA_Stream_TypeDef *rx = &sim_stream[SIM_DMA_CONTROLLER - 1][SIM_RX_STREAM];
+	DMA_Stream_TypeDef *tx = &sim_stream[SIM_DMA_CONTROLLER - 1][SIM_TX_STREAM];
+	struct timespec poll = { 0, SIM_POLL_NS };
+	uint64_t begin = 0, last_done = 0, due, bytes_per_second;
+	uint32_t moved = 0, position;
+	BaseType_t running = pdFALSE;
+	uint8_t sent, *source, *target;
+
+	(void) params;
+
+	while (stop_controller == pdFALSE)
+	{
+		if (((rx->CR & DMA_SxCR_EN) == 0) || ((tx->CR & DMA_SxCR_EN) == 0) || ((sim_spi.CR1 & SPI_CR1_SPE) == 0) ||
+				((sim_spi.CR2 & (SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN)) != (SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN)))
+		{
+			nanosleep(&poll, NULL);
+			continue;
+		}
+
+		if (running == pdFALSE)
+		{
+			running = pdTRUE;
+			begin = now_ns();
+			moved = 0;
+
+			if (last_done != 0)
+			{
+				gap_total_ns += begin - last_done;
+				gaps++;
+			}
+		}
+
+		// Eight clocks of the prescaled bus clock for each byte
+		bytes_per_second = SIM_BUS_CLOCK_HZ / (2UL << ((sim_spi.CR1 & SPI_CR1_BR) >> 3)) / 8;
+		due = ((now_ns() - begin) * bytes_per_second) / 1000000000ULL;
+
+		for (; (moved < due) && (rx->NDTR > 0); moved++)
+		{
+			position = moved;
+			source = (uint8_t *) (uintptr_t) tx->M0AR;
+			target = (uint8_t *) (uintptr_t) rx->M0AR;
+			sent = ((tx->CR & DMA_SxCR_MINC) != 0) ? source[position] : source[0];
+
+			if ((rx->CR & DMA_SxCR_MINC) != 0)
+			{
+				target[position] = SIM_ANSWER(selected, position, sent);
+			}
+			else
+			{
+				target[0] = SIM_ANSWER(selected, position, sent);
+			}
+
+			tx->NDTR--;
+			rx->NDTR--;
+		}
+
+		if (rx->NDTR == 0)
+		{
+			running = pdFALSE;
+			last_done = now_ns();
+
+			__atomic_and_fetch(&tx->CR, ~DMA_SxCR_EN, __ATOMIC_SEQ_CST);
+			__atomic_and_fetch(&rx->CR, ~DMA_SxCR_EN, __ATOMIC_SEQ_CST);
+			__atomic_or_fetch(&sim_controller[SIM_DMA_CONTROLLER - 1].LISR, SIM_RX_TCIF | SIM_TX_TCIF, __ATOMIC_SEQ_CST);
+			vPortGenerateSimulatedInterrupt(SIM_INTERRUPT);
+		}
+		else
+		{
+			nanosleep(&poll, NULL);
+		}
+	}
+
+	return NULL;
+}
+
+static uint32_t dma_interrupt_handler(void)
+{
+	return (uint32_t) dma_manager_irq(SIM_DMA_CONTROLLER, SIM_RX_STREAM);
+}
+
+static void record(sim_class_t *class, const spi_transaction_t *transaction)
+{
+	class->transactions++;
+	class->latency_total_us += transaction->latency_us;
+	if (transaction->latency_us > class->latency_max_us)
+	{
+		class->latency_max_us = transaction->latency_us;
+	}
+}
+
+// Reads one of two sensors that share device 0 every tick at transaction
+// priority 1
+static void sensor_task(void *params)
+{
+	uint32_t sensor = (uint32_t) (uintptr_t) params;
+	sim_class_t *class = &sensor_class[sensor];
+	spi_transaction_t transaction;
+	uint8_t *tx = memory->sensor_tx[sensor], *rx = memory->sensor_rx[sensor];
+
+	memset(&transaction, 0, sizeof(transaction));
+	transaction.device = &device[0];
+	transaction.tx = tx;
+	transaction.rx = rx;
+	transaction.length = SIM_SENSOR_LENGTH;
+	transaction.priority = 1;
+
+	while (stop_tasks == pdFALSE)
+	{
+		for (uint32_t i = 0; i < SIM_SENSOR_LENGTH; i++)
+		{
+			tx[i] = (uint8_t) (class->transactions + i + (sensor * 0x80));
+		}
+
+		configASSERT(spi_transfer(&memory->bus, &transaction, portMAX_DELAY) == pdPASS);
+		record(class, &transaction);
+
+		for (uint32_t i = 0; i < SIM_SENSOR_LENGTH; i++)
+		{
+			if (rx[i] != SIM_ANSWER(0, i, tx[i]))
+			{
+				class->corrupt++;
+			}
+		}
+
+		vTaskDelay(1);
+	}
+
+	__atomic_sub_fetch(&running_tasks, 1, __ATOMIC_SEQ_CST);
+	vTaskDelete(NULL);
+}
+
+// Writes to device 2 every tick at transaction priority 3, without reading
+static void poll_task(void *params)
+{
+	spi_transaction_t transaction;
+
+	(void) params;
+
+	memset(&transaction, 0, sizeof(transaction));
+	transaction.device = &device[2];
+	transaction.tx = memory->poll_tx;
+	transaction.length = SIM_POLL_LENGTH;
+	transaction.priority = 3;
+
+	while (stop_tasks == pdFALSE)
+	{
+		configASSERT(spi_transfer(&memory->bus, &transaction, portMAX_DELAY) == pdPASS);
+		record(&poll_class, &transaction);
+		vTaskDelay(1);
+	}
+
+	__atomic_sub_fetch(&running_tasks, 1, __ATOMIC_SEQ_CST);
+	vTaskDelete(NULL);
+}
+
+// Checks a bulk read of device 1 and queues it again, from the bus interrupt
+static void bulk_callback(spi_transaction_t *transaction, BaseType_t *woken)
+{
+	(void) woken;
+
+	record(&bulk_class, transaction);
+
+	for (uint32_t i = 0; i < SIM_BULK_LENGTH; i++)
+	{
+		if (memory->bulk_rx[i] != SIM_ANSWER(1, i, 0xFF))
+		{
+			bulk_class.corrupt++;
+		}
+	}
+
+	if (stop_tasks == pdFALSE)
+	{
+		spi_submit_from_isr(&memory->bus, transaction);
+	}
+}
+
+static void print_class(const sim_class_t *class)
+{
+	printf("cores: %d, %-8s %6lu transactions, latency mean %lu us max %lu us, corrupt bytes: %lu\n",
+			configNUMBER_OF_CORES, class->name, (unsigned long) class->transactions,
+			(unsigned long) ((class->transactions > 0) ? (class->latency_total_us / class->transactions) : 0),
+			(unsigned long) class->latency_max_us, (unsigned long) class->corrupt);
+}
+
+// Opens the bus, runs the workload for a while, and prints the statistics
+static void main_task(void *params)
+{
+	pthread_t controller;
+	spi_bus_config_t config;
+	spi_bus_stats_t stats;
+
+	(void) params;
+
+	memset(&config, 0, sizeof(config));
+	config.regs = &sim_spi;
+	config.dma_controller = SIM_DMA_CONTROLLER;
+	config.rx_stream = SIM_RX_STREAM;
+	config.rx_channel = DMA_Channel_3;
+	config.tx_stream = SIM_TX_STREAM;
+	config.tx_channel = DMA_Channel_3;
+
+	configASSERT(spi_bus_open(&memory->bus, &sim_spi_hw, &config) == pdPASS);
+	pthread_create(&controller, NULL, spi_thread, NULL);
+
+	running_tasks = 3;
+	xTaskCreate(sensor_task, "Sensor A", SIM_STACK_SIZE, (void *) 0, 2, NULL);
+	xTaskCreate(sensor_task, "Sensor B", SIM_STACK_SIZE, (void *) 1, 2, NULL);
+	xTaskCreate(poll_task, "Poll", SIM_STACK_SIZE, NULL, 3, NULL);
+
+	memory->bulk.device = &device[1];
+	memory->bulk.rx = memory->bulk_rx;
+	memory->bulk.length = SIM_BULK_LENGTH;
+	memory->bulk.priority = 0;
+	memory->bulk.callback = bulk_callback;
+	spi_submit(&memory->bus, &memory->bulk);
+
+	vTaskDelay(SIM_RUN_TICKS);
+
+	stop_tasks = pdTRUE;
+	while ((running_tasks > 0) || (memory->bulk.status == SPI_QUEUED) || (memory->bulk.status == SPI_ACTIVE))
+	{
+		vTaskDelay(1);
+	}
+
+	spi_bus_get_stats(&memory->bus, &stats);
+
+	sim_print_lock();
+	{
+		printf("cores: %d, %lu transactions, %lu bytes/s, utilisation %lu.%lu%%, latency mean %lu us max %lu us, "
+				"queued at most %lu, errors: %lu\n", configNUMBER_OF_CORES, (unsigned long) stats.transactions,
+				(unsigned long) ((stats.bytes * 1000ULL) / (SIM_RUN_TICKS * portTICK_PERIOD_MS)),
+				(unsigned long) (stats.utilisation / 10), (unsigned long) (stats.utilisation % 10),
+				(unsigned long) stats.latency_mean_us, (unsigned long) stats.latency_max_us,
+				(unsigned long) stats.queued_max, (unsigned long) stats.errors);
+		print_class(&sensor_class[0]);
+		print_class(&sensor_class[1]);
+		print_class(&poll_class);
+		print_class(&bulk_class);
+		printf("cores: %d, mean gap between transactions %lu ns, chip select errors: %lu\n", configNUMBER_OF_CORES,
+				(unsigned long) ((gaps > 0) ? (gap_total_ns / gaps) : 0), (unsigned long) select_errors);
+	}
+	sim_print_unlock();
+
+	spi_bus_close(&memory->bus);
+	stop_controller = pdTRUE;
+	pthread_join(controller, NULL);
+
+	exit(0);
+}
+
+// driver funtion
+int main(void)
+{
+	memory = mmap(NULL, sizeof(sim_memory_t), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+	configASSERT(memory != MAP_FAILED);
+
+	dma_manager_init(&sim_dma_hw);
+	vPortSetInterruptHandler(SIM_INTERRUPT, dma_interrupt_handler);
+
+	sim_run(main_task, "Main", configMAX_PRIORITIES - 1);
+}
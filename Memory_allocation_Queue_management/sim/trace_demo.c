@@ -0,0 +1,155 @@
+/**
+  ******************************************************************************
+  * @file    trace_demo.c
+  * @brief   Host simulation of the trace recorder (trace_recorder.h).  A
+  * 		 queue workload, an event group and a simulated interrupt run for
+  * 		 a short time, then the recorder image is written to a file that
+  * 		 tools/trace_to_json.c converts for Perfetto.  The measured cost
+  * 		 of recording an event is printed.  See README.md for the build
+  * 		 command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "event_groups.h"
+#include "sim_common.h"
+
+#if (configUSE_TRACE_RECORDER != 1)
+	#error Build with -DconfigUSE_TRACE_RECORDER=1
+#endif
+
+#define TRACE_PAIRS				(2)
+#define TRACE_QUEUE_LENGTH		(4)
+#define TRACE_RUN_TICKS			(pdMS_TO_TICKS(100))
+#define TRACE_INTERRUPT			(portFIRST_USER_INTERRUPT)
+#define TRACE_READY_BIT			(1UL << 0)
+
+static QueueHandle_t pair_queue[TRACE_PAIRS];
+static QueueHandle_t interrupt_queue;
+static EventGroupHandle_t ready_events;
+static FILE *trace_file;
+
+// Sends a sequence number to its queue every tick
+static void producer_task(void *params)
+{
+	QueueHandle_t queue = (QueueHandle_t) params;
+	uint32_t sequence = 0;
+
+	for(;;)
+	{
+		xQueueSend(queue, &sequence, portMAX_DELAY);
+		sequence++;
+		vTaskDelay(1);
+	}
+}
+
+// Receives from its queue and sets a bit in the event group
+static void consumer_task(void *params)
+{
+	QueueHandle_t queue = (QueueHandle_t) params;
+	uint32_t item;
+
+	for(;;)
+	{
+		xQueueReceive(queue, &item, portMAX_DELAY);
+		xEventGroupSetBits(ready_events, TRACE_READY_BIT);
+	}
+}
+
+// Waits for the consumers, and every few ticks raises the simulated interrupt
+static void monitor_task(void *params)
+{
+	uint32_t count = 0, item;
+
+	(void) params;
+
+	for(;;)
+	{
+		xEventGroupWaitBits(ready_events, TRACE_READY_BIT, pdTRUE, pdFALSE, portMAX_DELAY);
+
+		if ((++count % 4) == 0)
+		{
+			vPortGenerateSimulatedInterrupt(TRACE_INTERRUPT);
+			xQueueReceive(interrupt_queue, &item, portMAX_DELAY);
+		}
+	}
+}
+
+static uint32_t interrupt_handler(void)
+{
+	BaseType_t woken = pdFALSE;
+	uint32_t item = 0;
+
+	vTraceRecorderISRBegin(TRACE_INTERRUPT);
+	xQueueSendFromISR(interrupt_queue, &item, &woken);
+	vTraceRecorderISREnd(TRACE_INTERRUPT);
+
+	return (uint32_t) woken;
+}
+
+static void write_trace(const void *data, size_t length)
+{
+	fwrite(data, 1, length, trace_file);
+}
+
+// Stops the run and writes the recorder image
+static void dump_task(void *params)
+{
+	size_t length;
+
+	(void) params;
+
+	vTaskDelay(TRACE_RUN_TICKS);
+
+	sim_print_lock();
+	{
+		vTraceRecorderDump(write_trace);
+		fclose(trace_file);
+		pvTraceRecorderGetImage(&length);
+		printf("cores: %d, trace image of %lu bytes written\n", configNUMBER_OF_CORES, (unsigned long) length);
+		exit(0);
+	}
+	sim_print_unlock();
+}
+
+// driver funtion
+int main(int argc, char **argv)
+{
+	uint32_t pair, overhead;
+	BaseType_t within_budget;
+
+	trace_file = fopen((argc > 1) ? argv[1] : "trace.bin", "wb");
+	configASSERT(trace_file != NULL);
+
+	// Start tracing before any kernel object is created so the names are
+	// recorded, then check recording an event stays within budget
+	vTraceRecorderStart();
+	within_budget = xTraceRecorderMeasureOverhead(&overhead);
+	printf("cores: %d, %lu ns per event, budget %d ns: %s\n", configNUMBER_OF_CORES, (unsigned long) overhead,
+			configTRACE_RECORDER_CYCLE_BUDGET, (within_budget == pdPASS) ? "pass" : "FAIL");
+
+	for (pair = 0; pair < TRACE_PAIRS; pair++)
+	{
+		pair_queue[pair] = xQueueCreate(TRACE_QUEUE_LENGTH, sizeof(uint32_t));
+		configASSERT(pair_queue[pair] != NULL);
+		vQueueAddToRegistry(pair_queue[pair], (pair == 0) ? "Pair 0" : "Pair 1");
+
+		xTaskCreate(producer_task, "Producer", SIM_STACK_SIZE, (void *) pair_queue[pair], 2, NULL);
+		xTaskCreate(consumer_task, "Consumer", SIM_STACK_SIZE, (void *) pair_queue[pair], 1, NULL);
+	}
+
+	interrupt_queue = xQueueCreate(1, sizeof(uint32_t));
+	vQueueAddToRegistry(interrupt_queue, "Interrupt");
+	ready_events = xEventGroupCreate();
+	vTraceRecorderSetObjectName(ready_events, "Ready");
+	vTraceRecorderSetObjectName((void *) (uintptr_t) TRACE_INTERRUPT, "Sim IRQ");
+	vPortSetInterruptHandler(TRACE_INTERRUPT, interrupt_handler);
+
+	xTaskCreate(monitor_task, "Monitor", SIM_STACK_SIZE, NULL, 3, NULL);
+	sim_run(dump_task, "Dump", configMAX_PRIORITIES - 1);
+}
@@ -0,0 +1,472 @@
+/**
+  ******************************************************************************
+  * @file    uart_sim.c
+  * @brief   Host simulation of the USART driver (uart_driver.h) against
+  * 		 simulated USART and DMA registers.  A host thread plays the part
+  * 		 of the USART and its two DMA streams at 921600 baud: it receives
+  * 		 frames of varying length separated by an idle character, and
+  * 		 sends what the transmit stream is given.  One task writes and
+  * 		 another reads, both checking every byte, then the throughput,
+  * 		 the interrupt rate and the time spent in the driver's interrupt
+  * 		 handlers are printed.  See README.md for the build command.
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include "uart_driver.h"
+#include "dma_hw_sim.h"
+#include "sim_common.h"
+
+#define SIM_BAUD_RATE			(921600)
+#define SIM_CHARS_PER_SECOND	(SIM_BAUD_RATE / 10)
+#define SIM_POLL_NS				(100000)
+#define SIM_RUN_TICKS			(pdMS_TO_TICKS(2000))
+#define SIM_TIMEOUT_TICKS		(pdMS_TO_TICKS(20))
+#define SIM_RX_RING_SIZE		(512)
+#define SIM_RX_BUFFER_SIZE		(2048)
+#define SIM_TX_RING_SIZE		(1024)
+#define SIM_MAX_FRAME			(256)
+#define SIM_MAX_WRITE			(300)
+#define SIM_DMA_CONTROLLER		(1)
+#define SIM_RX_STREAM			(5)
+#define SIM_TX_STREAM			(6)
+#define SIM_DMA_INTERRUPT		(portFIRST_USER_INTERRUPT)
+#define SIM_USART_INTERRUPT		(portFIRST_USER_INTERRUPT + 1)
+
+// Where the flags of streams 5 and 6 start in HISR
+#define SIM_RX_FLAG_SHIFT		(6)
+#define SIM_TX_FLAG_SHIFT		(16)
+#define SIM_HTIF				(1UL << 4)
+#define SIM_TCIF				(1UL << 5)
+
+// Bits 10 to 15 of the status register are reserved and read as 0, so if they
+// are set the driver has written the register to clear a flag
+#define SIM_SR_FLAGS			(0x03FFUL)
+
+// Simulated registers
+static USART_TypeDef *sim_usart;
+
+// The status flags the USART has set, which the register is brought back to
+// after the driver has cleared one by writing to it
+static uint32_t sim_status;
+static volatile char sim_status_lock;
+
+static uart_t uart;
+static volatile BaseType_t stop_writer, stop_controller, paused;
+static volatile uint32_t tx_corrupt, rx_lost, late_interrupts;
+static uint64_t handler_ns;
+
+static void sim_enable_usart(USART_TypeDef *regs, uint32_t baud_rate, FunctionalState state)
+{
+	(void) regs;
+	(void) baud_rate;
+	(void) state;
+}
+
+static const uart_hw_t sim_uart_hw =
+{
+	sim_enable_usart
+};
+
+// The byte at a position of either direction's stream of bytes
+static uint8_t pattern(uint32_t position)
+{
+	return (uint8_t) (position ^ (position >> 8) ^ (position >> 16));
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t) now.tv_sec * 1000000000ULL) + (uint64_t) now.tv_nsec;
+}
+
+static void status_lock(void)
+{
+	while (__atomic_test_and_set(&sim_status_lock, __ATOMIC_ACQUIRE));
+}
+
+static void status_unlock(void)
+{
+	__atomic_clear(&sim_status_lock, __ATOMIC_RELEASE);
+}
+
+// Sets USART status flags, first applying any the driver has cleared
+static void status_update(uint32_t set, uint32_t clear)
+{
+	uint32_t written;
+
+	status_lock();
+	{
+		written = sim_usart->SR;
+		if ((written & ~SIM_SR_FLAGS) != 0)
+		{
+			sim_status &= written;
+		}
+
+		sim_status = (sim_status | set) & ~clear;
+		sim_usart->SR = (uint16_t) sim_status;
+	}
+	status_unlock();
+}
+
+// Returns pdTRUE if the receive ring is full of bytes the driver has not yet
+// copied.  On the target the interrupts are serviced long before the stream
+// fills the other half of the ring, but the host may not run them that soon.
+static BaseType_t receive_ring_full(uint32_t reload)
+{
+	uint32_t position = reload - sim_stream[SIM_DMA_CONTROLLER - 1][SIM_RX_STREAM].NDTR;
+
+	return (((position + reload - __atomic_load_n(&uart.rx_tail, __ATOMIC_SEQ_CST)) % reload) == (reload - 1)) ?
+			pdTRUE : pdFALSE;
+}
+
+// Receives one character through the receive stream
+static BaseType_t receive_char(uint8_t data, uint32_t *reload)
+{
+	DMA_Stream_TypeDef *regs = &sim_stream[SIM_DMA_CONTROLLER - 1][SIM_RX_STREAM];
+	struct timespec poll = { 0, SIM_POLL_NS };
+	uint32_t remaining = regs->NDTR, flags = 0;
+
+	if (((regs->CR & DMA_SxCR_EN) == 0) || ((sim_usart->CR3 & USART_CR3_DMAR) == 0))
+	{
+		rx_lost++;
+		return pdFALSE;
+	}
+
+	// The stream reloads the counter it was enabled with
+	if (*reload == 0)
+	{
+		*reload = remaining;
+	}
+
+	if (receive_ring_full(*reload) == pdTRUE)
+	{
+		late_interrupts++;
+		vPortGenerateSimulatedInterrupt(SIM_DMA_INTERRUPT);
+
+		while ((receive_ring_full(*reload) == pdTRUE) && (stop_controller == pdFALSE))
+		{
+			nanosleep(&poll, NULL);
+		}
+	}
+
+	((uint8_t *) (uintptr_t) regs->M0AR)[*reload - remaining] = data;
+	remaining--;
+
+	if (remaining == (*reload / 2))
+	{
+		flags = SIM_HTIF;
+	}
+	else if (remaining == 0)
+	{
+		flags = SIM_TCIF;
+		remaining = *reload;
+	}
+
+	regs->NDTR = remaining;
+
+	if (flags != 0)
+	{
+		__atomic_or_fetch(&sim_controller[SIM_DMA_CONTROLLER - 1].HISR, flags << SIM_RX_FLAG_SHIFT, __ATOMIC_SEQ_CST);
+		return pdTRUE;
+	}
+
+	return pdFALSE;
+}
+
+// Sends one character from the transmit stream, if it is enabled
+static BaseType_t send_char(uint32_t *sent)
+{
+	DMA_Stream_TypeDef *regs = &sim_stream[SIM_DMA_CONTROLLER - 1][SIM_TX_STREAM];
+	static uint32_t offset;
+
+	if (((regs->CR & DMA_SxCR_EN) == 0) || ((sim_usart->CR3 & USART_CR3_DMAT) == 0))
+	{
+		offset = 0;
+		return pdFALSE;
+	}
+
+	if (((uint8_t *) (uintptr_t) regs->M0AR)[offset++] != pattern(*sent))
+	{
+		tx_corrupt++;
+	}
+
+	(*sent)++;
+
+	if (--regs->NDTR == 0)
+	{
+		offset = 0;
+		__atomic_and_fetch(&regs->CR, ~DMA_SxCR_EN, __ATOMIC_SEQ_CST);
+		status_update(USART_FLAG_TC, 0);
+		__atomic_or_fetch(&sim_controller[SIM_DMA_CONTROLLER - 1].HISR, SIM_TCIF << SIM_TX_FLAG_SHIFT, __ATOMIC_SEQ_CST);
+		return pdTRUE;
+	}
+
+	return pdFALSE;
+}
+
+// Moves as many characters each way as the baud rate allows in the time since
+// the last call, receiving frames of 1 to SIM_MAX_FRAME bytes each followed by
+// an idle character
+static void *usart_thread(void *params)
+{
+	struct timespec poll = { 0, SIM_POLL_NS };
+	uint64_t start = now_ns(), chars = 0, due;
+	uint32_t received = 0, sent = 0, reload = 0, frame_left = 0, random = 1;
+	BaseType_t dma_interrupt, usart_interrupt;
+
+	(void) params;
+
+	while (stop_controller == pdFALSE)
+	{
+		nanosleep(&poll, NULL);
+
+		due = ((now_ns() - start) * SIM_CHARS_PER_SECOND) / 1000000000ULL;
+		dma_interrupt = pdFALSE;
+		usart_interrupt = pdFALSE;
+
+		for (; chars < due; chars++)
+		{
+			if (paused == pdTRUE)
+			{
+				continue;
+			}
+
+			if (frame_left > 0)
+			{
+				if (receive_char(pattern(received), &reload) == pdTRUE)
+				{
+					dma_interrupt = pdTRUE;
+				}
+
+				received++;
+				frame_left--;
+			}
+			else
+			{
+				// A character time of idle line ends the frame
+				if ((sim_usart->CR1 & USART_CR1_IDLEIE) != 0)
+				{
+					status_update(USART_FLAG_IDLE, 0);
+					usart_interrupt = pdTRUE;
+				}
+
+				random = (random * 1103515245UL) + 12345UL;
+				frame_left = 1 + ((random >> 16) % SIM_MAX_FRAME);
+			}
+
+			if (send_char(&sent) == pdTRUE)
+			{
+				dma_interrupt = pdTRUE;
+			}
+		}
+
+		if (dma_interrupt == pdTRUE)
+		{
+			vPortGenerateSimulatedInterrupt(SIM_DMA_INTERRUPT);
+		}
+
+		if (usart_interrupt == pdTRUE)
+		{
+			vPortGenerateSimulatedInterrupt(SIM_USART_INTERRUPT);
+		}
+	}
+
+	return NULL;
+}
+
+static uint32_t dma_interrupt_handler(void)
+{
+	DMA_TypeDef *regs = &sim_controller[SIM_DMA_CONTROLLER - 1];
+	uint64_t start = now_ns();
+	BaseType_t woken = pdFALSE;
+
+	// Each stream has its own interrupt on the target
+	if (((regs->HISR >> SIM_RX_FLAG_SHIFT) & (SIM_HTIF | SIM_TCIF)) != 0)
+	{
+		woken |= dma_manager_irq(SIM_DMA_CONTROLLER, SIM_RX_STREAM);
+	}
+
+	if (((regs->HISR >> SIM_TX_FLAG_SHIFT) & SIM_TCIF) != 0)
+	{
+		woken |= dma_manager_irq(SIM_DMA_CONTROLLER, SIM_TX_STREAM);
+	}
+
+	handler_ns += now_ns() - start;
+
+	return (uint32_t) woken;
+}
+
+static uint32_t usart_interrupt_handler(void)
+{
+	uint64_t start;
+	BaseType_t woken;
+	uint32_t status;
+
+	status_update(0, 0);
+	status = sim_usart->SR;
+
+	start = now_ns();
+	woken = uart_irq(sim_usart);
+	handler_ns += now_ns() - start;
+
+	// The driver read the status and then the data register
+	status_update(0, status & (USART_FLAG_IDLE | USART_FLAG_ORE | USART_FLAG_NE | USART_FLAG_FE));
+
+	return (uint32_t) woken;
+}
+
+// Writes the pattern in pieces of varying size until told to stop
+static void writer_task(void *params)
+{
+	uint8_t data[SIM_MAX_WRITE];
+	uint32_t position = 0, length, random = 7;
+
+	(void) params;
+
+	while (stop_writer == pdFALSE)
+	{
+		random = (random * 1103515245UL) + 12345UL;
+		length = 1 + ((random >> 16) % SIM_MAX_WRITE);
+
+		for (uint32_t i = 0; i < length; i++)
+		{
+			data[i] = pattern(position + i);
+		}
+
+		configASSERT(uart_write(&uart, data, length, portMAX_DELAY) == length);
+		position += length;
+	}
+
+	stop_writer = pdFALSE;
+	vTaskDelete(NULL);
+}
+
+// Opens the USART, reads and checks for a while, then tests the timeouts
+static void reader_task(void *params)
+{
+	static uint8_t data[SIM_RX_BUFFER_SIZE];
+	pthread_t controller;
+	uart_config_t config;
+	uart_stats_t stats;
+	uint32_t position = 0, rx_corrupt = 0, reads = 0;
+	size_t length;
+	TickType_t start;
+	uint64_t start_ns, elapsed_ns, timeout_ns;
+	uint8_t *rings = (uint8_t *) (sim_usart + 1);
+
+	(void) params;
+
+	memset(&config, 0, sizeof(config));
+	config.regs = sim_usart;
+	config.baud_rate = SIM_BAUD_RATE;
+	config.dma_controller = SIM_DMA_CONTROLLER;
+	config.rx_stream = SIM_RX_STREAM;
+	config.rx_channel = DMA_Channel_4;
+	config.tx_stream = SIM_TX_STREAM;
+	config.tx_channel = DMA_Channel_4;
+	config.rx_ring = rings;
+	config.rx_ring_size = SIM_RX_RING_SIZE;
+	config.rx_buffer_size = SIM_RX_BUFFER_SIZE;
+	config.tx_ring = rings + SIM_RX_RING_SIZE;
+	config.tx_ring_size = SIM_TX_RING_SIZE;
+
+	configASSERT(uart_open(&uart, &sim_uart_hw, &config) == pdPASS);
+
+	pthread_create(&controller, NULL, usart_thread, NULL);
+	xTaskCreate(writer_task, "Writer", SIM_STACK_SIZE, NULL, configMAX_PRIORITIES - 2, NULL);
+
+	start = xTaskGetTickCount();
+	start_ns = now_ns();
+
+	while ((xTaskGetTickCount() - start) < SIM_RUN_TICKS)
+	{
+		length = uart_read(&uart, data, sizeof(data), SIM_TIMEOUT_TICKS);
+		reads++;
+
+		for (size_t i = 0; i < length; i++)
+		{
+			if (data[i] != pattern(position))
+			{
+				rx_corrupt++;
+			}
+
+			position++;
+		}
+	}
+
+	stop_writer = pdTRUE;
+	while (stop_writer == pdTRUE)
+	{
+		vTaskDelay(1);
+	}
+
+	configASSERT(uart_flush(&uart, portMAX_DELAY) == pdPASS);
+	elapsed_ns = now_ns() - start_ns;
+	uart_get_stats(&uart, &stats);
+
+	// With the line stopped, both calls must give up at their timeouts
+	paused = pdTRUE;
+	vTaskDelay(SIM_TIMEOUT_TICKS);
+	while (uart_read(&uart, data, sizeof(data), 0) > 0);
+	timeout_ns = now_ns();
+	configASSERT(uart_read(&uart, data, sizeof(data), SIM_TIMEOUT_TICKS) == 0);
+	configASSERT(uart_write(&uart, data, sizeof(data), SIM_TIMEOUT_TICKS) == SIM_TX_RING_SIZE);
+	timeout_ns = now_ns() - timeout_ns;
+
+	sim_print_lock();
+	{
+		printf("cores: %d, %d baud, received %lu bytes/s in %lu frames, sent %lu bytes/s, line %d bytes/s\n",
+				configNUMBER_OF_CORES, SIM_BAUD_RATE,
+				(unsigned long) ((stats.rx_bytes * 1000000000ULL) / elapsed_ns), (unsigned long) stats.rx_frames,
+				(unsigned long) ((stats.tx_bytes * 1000000000ULL) / elapsed_ns), SIM_CHARS_PER_SECOND);
+		printf("cores: %d, %lu reads, corrupt rx: %lu tx: %lu, dropped: %lu, lost: %lu, errors: %lu, late interrupts: %lu\n",
+				configNUMBER_OF_CORES, (unsigned long) reads, (unsigned long) rx_corrupt, (unsigned long) tx_corrupt,
+				(unsigned long) stats.rx_dropped, (unsigned long) rx_lost,
+				(unsigned long) (stats.rx_errors + stats.dma_errors), (unsigned long) late_interrupts);
+		printf("cores: %d, %lu interrupts/s, %lu bytes each, %lu ns each in the driver, %lu.%02lu%% of a CPU\n",
+				configNUMBER_OF_CORES, (unsigned long) ((stats.interrupts * 1000000000ULL) / elapsed_ns),
+				(unsigned long) ((stats.rx_bytes + stats.tx_bytes) / stats.interrupts),
+				(unsigned long) (handler_ns / stats.interrupts),
+				(unsigned long) ((handler_ns * 100ULL) / elapsed_ns),
+				(unsigned long) (((handler_ns * 10000ULL) / elapsed_ns) % 100));
+		printf("cores: %d, a read and a write with timeouts of %lu ms took %lu ms\n", configNUMBER_OF_CORES,
+				(unsigned long) (SIM_TIMEOUT_TICKS * portTICK_PERIOD_MS), (unsigned long) (timeout_ns / 1000000ULL));
+	}
+	sim_print_unlock();
+
+	uart_close(&uart);
+	stop_controller = pdTRUE;
+	pthread_join(controller, NULL);
+
+	exit(0);
+}
+
+// driver funtion
+int main(void)
+{
+	// The streams hold 32 bit addresses, and the USART library keeps the
+	// address of the registers in a 32 bit variable, so the registers and
+	// rings must be in the low 4GB of the host's address space
+	sim_usart = mmap(NULL, sizeof(USART_TypeDef) + SIM_RX_RING_SIZE + SIM_TX_RING_SIZE, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+	configASSERT(sim_usart != MAP_FAILED);
+
+	// The transmit register is always empty
+	sim_status = USART_FLAG_TXE | USART_FLAG_TC;
+	sim_usart->SR = (uint16_t) sim_status;
+
+	dma_manager_init(&sim_dma_hw);
+	vPortSetInterruptHandler(SIM_DMA_INTERRUPT, dma_interrupt_handler);
+	vPortSetInterruptHandler(SIM_USART_INTERRUPT, usart_interrupt_handler);
+
+	sim_run(reader_task, "Reader", configMAX_PRIORITIES - 1);
+}
@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file    adc_dsp.c
+  * @brief   CMSIS-DSP stages of the ADC acquisition pipeline (see adc_dsp.h).
+  * 		 They call the CMSIS-DSP kernels of CMSIS/DSP/Source.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "adc_dsp.h"
+
+/**
+  * @brief  Filter and decimate the samples of a channel
+  *
+  * @param  stage -> the stage of an adc_fir_decimator_t
+  * @param  channel -> the channel, which has its own state
+  * @param  samples -> the channel's samples, replaced by the decimated ones
+  * @param  count -> the samples, the block size the decimator was set up
+  * 		with, and set to the decimated samples
+  *
+  * @retval None
+  */
+static void adc_fir_decimator_process(adc_stage_t *stage, uint32_t channel, float *samples, uint32_t *count)
+{
+	adc_fir_decimator_t *decimator = (adc_fir_decimator_t *) stage->context;
+	const arm_fir_decimate_instance_f32 *instance = &decimator->instance[channel];
+	uint32_t decimated = *count / instance->M;
+
+	configASSERT(*count == decimator->block_size);
+
+	// The kernel does not promise to work in place, so the result is moved
+	// back, which is a fraction of the samples read
+	arm_fir_decimate_f32(instance, samples, decimator->output, *count);
+	memcpy(samples, decimator->output, decimated * sizeof(float32_t));
+
+	*count = decimated;
+}
+
+/**
+  * @brief  Set up an FIR decimator stage
+  *
+  * @param  decimator -> the stage, kept while the pipeline runs
+  * @param  channels -> channels of the pipeline
+  * @param  factor -> decimation factor, which divides block_size
+  * @param  coeffs -> taps coefficients, in time reversed order, shared by
+  * 		every channel
+  * @param  taps -> number of coefficients
+  * @param  state -> channels * (taps + block_size - 1) floats
+  * @param  block_size -> samples of each channel given to the stage, which
+  * 		is scans_per_block unless an earlier stage decimates
+  * @param  output -> block_size / factor floats of scratch
+  *
+  * @retval pdPASS, or pdFAIL if factor does not divide block_size
+  */
+BaseType_t adc_fir_decimator_init(adc_fir_decimator_t *decimator, uint32_t channels, uint8_t factor,
+		float32_t *coeffs, uint16_t taps, float32_t *state, uint32_t block_size, float32_t *output)
+{
+	configASSERT((channels > 0) && (channels <= ADC_PIPELINE_MAX_CHANNELS));
+
+	for (uint32_t channel = 0; channel < channels; channel++)
+	{
+		if (arm_fir_decimate_init_f32(&decimator->instance[channel], taps, factor, coeffs,
+				&state[channel * (taps + block_size - 1)], block_size) != ARM_MATH_SUCCESS)
+		{
+			return pdFAIL;
+		}
+	}
+
+	decimator->channels = channels;
+	decimator->block_size = block_size;
+	decimator->output = output;
+	decimator->stage.process = adc_fir_decimator_process;
+	decimator->stage.context = decimator;
+
+	return pdPASS;
+}
+
+/**
+  * @brief  Filter the samples of a channel in place
+  *
+  * @param  stage -> the stage of an adc_biquad_t
+  * @param  channel -> the channel, which has its own state
+  * @param  samples -> the channel's samples
+  * @param  count -> the samples, left as it is
+  *
+  * @retval None
+  */
+static void adc_biquad_process(adc_stage_t *stage, uint32_t channel, float *samples, uint32_t *count)
+{
+	adc_biquad_t *biquad = (adc_biquad_t *) stage->context;
+
+	// Each input is read before its output is written, so in place is safe
+	arm_biquad_cascade_df1_f32(&biquad->instance[channel], samples, samples, *count);
+}
+
+/**
+  * @brief  Set up a biquad cascade stage
+  *
+  * @param  biquad -> the stage, kept while the pipeline runs
+  * @param  channels -> channels of the pipeline
+  * @param  sections -> second order sections of the cascade
+  * @param  coeffs -> {b0, b1, b2, a1, a2} for each section, shared by every
+  * 		channel
+  * @param  state -> channels * 4 * sections floats
+  *
+  * @retval None
+  */
+void adc_biquad_init(adc_biquad_t *biquad, uint32_t channels, uint8_t sections, float32_t *coeffs,
+		float32_t *state)
+{
+	configASSERT((channels > 0) && (channels <= ADC_PIPELINE_MAX_CHANNELS));
+
+	for (uint32_t channel = 0; channel < channels; channel++)
+	{
+		arm_biquad_cascade_df1_init_f32(&biquad->instance[channel], sections, coeffs,
+				&state[channel * 4 * sections]);
+	}
+
+	biquad->channels = channels;
+	biquad->stage.process = adc_biquad_process;
+	biquad->stage.context = biquad;
+}
@@ -0,0 +1,258 @@
+/**
+  ******************************************************************************
+  * @file    adc_pipeline.c
+  * @brief   ADC acquisition pipeline (see adc_pipeline.h).  The ADC and its
+  * 		 trigger are reached through the configuration and the adc_hw_t,
+  * 		 and the stream through the DMA stream manager, so the pipeline
+  * 		 also runs against simulated registers on the host.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "adc_pipeline.h"
+
+/**
+  * @brief  Run the stages on each channel of a block
+  *
+  * @param  pipeline -> the pipeline, which has stages
+  * @param  block -> the block, whose output is set
+  *
+  * @retval None
+  */
+static void adc_pipeline_run_stages(adc_pipeline_t *pipeline, adc_block_t *block)
+{
+	const adc_pipeline_config_t *config = &pipeline->config;
+	uint32_t count = block->scans;
+
+	for (uint32_t channel = 0; channel < block->channels; channel++)
+	{
+		const uint16_t *sample = &block->samples[channel];
+		float *work = config->work[channel];
+
+		for (uint32_t scan = 0; scan < block->scans; scan++)
+		{
+			work[scan] = (float) *sample * config->scale;
+			sample += block->channels;
+		}
+
+		count = block->scans;
+		for (uint32_t stage = 0; stage < config->stage_count; stage++)
+		{
+			config->stages[stage]->process(config->stages[stage], channel, work, &count);
+		}
+	}
+
+	block->output = config->work;
+	block->output_count = count;
+}
+
+/**
+  * @brief  Task of a pipeline.  Processes each block as it is filled and
+  * 		gives it back to the stream, until the pipeline is stopped
+  *
+  * @param  params -> the pipeline
+  *
+  * @retval None
+  */
+static void adc_pipeline_task(void *params)
+{
+	adc_pipeline_t *pipeline = (adc_pipeline_t *) params;
+	const adc_pipeline_config_t *config = &pipeline->config;
+	uint32_t bits = 0, process_us, latency_us;
+	uint64_t start_us, end_us;
+	dma_buffer_t buffer;
+	adc_block_t block;
+
+	block.channels = config->channel_count;
+	block.scans = config->scans_per_block;
+
+	while ((bits & ADC_PIPELINE_STOP_BIT) == 0)
+	{
+		(void) xTaskNotifyWait(0, ADC_PIPELINE_BLOCK_BIT | ADC_PIPELINE_STOP_BIT, &bits, portMAX_DELAY);
+
+		while (dma_stream_receive(&pipeline->dma, &buffer, 0) == pdPASS)
+		{
+			start_us = ullTaskGetMonotonicTimeUs();
+
+			block.samples = (const uint16_t *) buffer.data;
+			block.output = NULL;
+			block.output_count = 0;
+			block.sequence = buffer.sequence;
+			block.time_us = buffer.time_us;
+
+			if (config->stage_count > 0)
+			{
+				adc_pipeline_run_stages(pipeline, &block);
+			}
+
+			config->consumer(&block, config->context);
+			dma_stream_release(&pipeline->dma, &buffer);
+
+			end_us = ullTaskGetMonotonicTimeUs();
+			process_us = (uint32_t) (end_us - start_us);
+			latency_us = (uint32_t) (end_us - buffer.time_us);
+
+			taskENTER_CRITICAL();
+			{
+				pipeline->stats.blocks++;
+				pipeline->stats.samples += block.scans * block.channels;
+				pipeline->process_total_us += process_us;
+				if (process_us > pipeline->stats.process_max_us)
+				{
+					pipeline->stats.process_max_us = process_us;
+				}
+				if (latency_us > pipeline->stats.latency_max_us)
+				{
+					pipeline->stats.latency_max_us = latency_us;
+				}
+			}
+			taskEXIT_CRITICAL();
+		}
+	}
+
+	// The stopping task frees the pipeline once notified, so nothing of it is
+	// used after that
+	xTaskNotifyGive(pipeline->stopping);
+	vTaskDelete(NULL);
+}
+
+/**
+  * @brief  Start a pipeline: claim its stream, create its task, set the ADC
+  * 		up to scan its channels on each trigger, and start the stream and
+  * 		the trigger.  The pins are configured by the caller
+  *
+  * @param  pipeline -> state of the pipeline, kept until adc_pipeline_stop()
+  * @param  hw -> &adc_stm32f4_hw, or simulated registers
+  * @param  config -> the ADC, its channels, stream, blocks and stages,
+  * 		copied by the call
+  *
+  * @retval pdPASS, or pdFAIL if the stream is already claimed or the task
+  * 		or the stream's queue could not be created
+  */
+BaseType_t adc_pipeline_start(adc_pipeline_t *pipeline, const adc_hw_t *hw, const adc_pipeline_config_t *config)
+{
+	dma_stream_config_t dma_config;
+	ADC_InitTypeDef adc_init;
+
+	configASSERT((config->channel_count > 0) && (config->channel_count <= ADC_PIPELINE_MAX_CHANNELS));
+	configASSERT(config->stage_count <= ADC_PIPELINE_MAX_STAGES);
+	configASSERT((config->stage_count == 0) || (config->work != NULL));
+
+	memset(pipeline, 0, sizeof(adc_pipeline_t));
+	pipeline->config = *config;
+	pipeline->hw = hw;
+
+	if (dma_stream_claim(&pipeline->dma, config->dma_controller, config->dma_stream) == pdFAIL)
+	{
+		return pdFAIL;
+	}
+
+	if (xTaskCreate(adc_pipeline_task, "ADC", config->stack_depth, pipeline, config->priority,
+			&pipeline->task) != pdPASS)
+	{
+		dma_stream_free(&pipeline->dma);
+		return pdFAIL;
+	}
+
+	hw->enable(config, ENABLE);
+
+	// Each trigger converts every channel once, and the ADC asks for a
+	// transfer after each conversion for as long as the stream runs
+	ADC_StructInit(&adc_init);
+	adc_init.ADC_ScanConvMode = (config->channel_count > 1) ? ENABLE : DISABLE;
+	adc_init.ADC_ExternalTrigConvEdge = ADC_ExternalTrigConvEdge_Rising;
+	adc_init.ADC_ExternalTrigConv = hw->trigger_source;
+	adc_init.ADC_NbrOfConversion = (uint8_t) config->channel_count;
+	ADC_Init(config->regs, &adc_init);
+
+	for (uint32_t rank = 0; rank < config->channel_count; rank++)
+	{
+		ADC_RegularChannelConfig(config->regs, config->channels[rank], (uint8_t) (rank + 1), config->sample_time);
+	}
+
+	ADC_DMARequestAfterLastTransferCmd(config->regs, ENABLE);
+	ADC_DMACmd(config->regs, ENABLE);
+	ADC_Cmd(config->regs, ENABLE);
+
+	memset(&dma_config, 0, sizeof(dma_config));
+	dma_config.channel = config->dma_channel;
+	dma_config.peripheral = &config->regs->DR;
+	dma_config.item_size = sizeof(uint16_t);
+	dma_config.priority = DMA_Priority_VeryHigh;
+	dma_config.buffers = config->buffers;
+	dma_config.buffer_count = config->buffer_count;
+	dma_config.buffer_size = config->scans_per_block * config->channel_count * sizeof(uint16_t);
+	dma_config.notify_task = pipeline->task;
+	dma_config.notify_bits = ADC_PIPELINE_BLOCK_BIT;
+
+	if (dma_stream_start(&pipeline->dma, &dma_config) == pdFAIL)
+	{
+		ADC_DMACmd(config->regs, DISABLE);
+		ADC_Cmd(config->regs, DISABLE);
+		hw->enable(config, DISABLE);
+		vTaskDelete(pipeline->task);
+		dma_stream_free(&pipeline->dma);
+		return pdFAIL;
+	}
+
+	pipeline->start_us = ullTaskGetMonotonicTimeUs();
+	hw->trigger(config, ENABLE);
+
+	return pdPASS;
+}
+
+/**
+  * @brief  Stop a pipeline, waiting for its task to finish the blocks
+  * 		already filled
+  *
+  * @param  pipeline -> a started pipeline
+  *
+  * @retval None
+  */
+void adc_pipeline_stop(adc_pipeline_t *pipeline)
+{
+	pipeline->hw->trigger(&pipeline->config, DISABLE);
+	dma_stream_stop(&pipeline->dma);
+
+	ADC_DMACmd(pipeline->config.regs, DISABLE);
+	ADC_Cmd(pipeline->config.regs, DISABLE);
+	pipeline->hw->enable(&pipeline->config, DISABLE);
+
+	pipeline->stopping = xTaskGetCurrentTaskHandle();
+	(void) xTaskNotify(pipeline->task, ADC_PIPELINE_STOP_BIT, eSetBits);
+	(void) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+	dma_stream_free(&pipeline->dma);
+}
+
+/**
+  * @brief  Read the counters of a pipeline
+  *
+  * @param  pipeline -> a started pipeline that has not been stopped
+  * @param  stats -> set to the counters since the pipeline was started
+  *
+  * @retval None
+  */
+void adc_pipeline_get_stats(adc_pipeline_t *pipeline, adc_pipeline_stats_t *stats)
+{
+	dma_stream_stats_t dma_stats;
+	uint64_t process_total_us, elapsed_us;
+
+	dma_stream_get_stats(&pipeline->dma, &dma_stats);
+
+	taskENTER_CRITICAL();
+	{
+		*stats = pipeline->stats;
+		process_total_us = pipeline->process_total_us;
+	}
+	taskEXIT_CRITICAL();
+
+	elapsed_us = ullTaskGetMonotonicTimeUs() - pipeline->start_us;
+
+	stats->dropped = dma_stats.overruns;
+	stats->errors = dma_stats.errors;
+	stats->samples_per_second = (elapsed_us > 0) ? (uint32_t) ((stats->samples * 1000000ULL) / elapsed_us) : 0;
+	stats->process_mean_us = (stats->blocks > 0) ? (uint32_t) (process_total_us / stats->blocks) : 0;
+	stats->load = (elapsed_us > 0) ? (uint32_t) ((process_total_us * 1000ULL) / elapsed_us) : 0;
+}
@@ -0,0 +1,110 @@
+/**
+  ******************************************************************************
+  * @file    adc_stm32f4.c
+  * @brief   The ADCs of the STM32F4 for the ADC acquisition pipeline
+  * 		 (adc_pipeline.h), triggered by the update event of TIM2.  The
+  * 		 pipeline only uses the interrupt of its DMA stream, so there are
+  * 		 no ADC interrupt handlers.
+  ******************************************************************************
+*/
+
+#include "adc_pipeline.h"
+
+typedef struct
+{
+	ADC_TypeDef *regs;
+	uint32_t clock;					// On APB2
+} adc_stm32f4_port_t;
+
+static const adc_stm32f4_port_t adc_stm32f4_port[] =
+{
+	{ ADC1, RCC_APB2Periph_ADC1 },
+	{ ADC2, RCC_APB2Periph_ADC2 },
+	{ ADC3, RCC_APB2Periph_ADC3 }
+};
+
+/**
+  * @brief  Enable the clock of an ADC and run the ADCs independently from
+  * 		a quarter of PCLK2, or disable its clock
+  *
+  * @param  config -> the pipeline
+  * @param  state -> ENABLE or DISABLE
+  *
+  * @retval None
+  */
+static void adc_stm32f4_enable(const adc_pipeline_config_t *config, FunctionalState state)
+{
+	const adc_stm32f4_port_t *port = NULL;
+	ADC_CommonInitTypeDef common_init;
+
+	for (uint32_t i = 0; i < (sizeof(adc_stm32f4_port) / sizeof(adc_stm32f4_port[0])); i++)
+	{
+		if (adc_stm32f4_port[i].regs == config->regs)
+		{
+			port = &adc_stm32f4_port[i];
+		}
+	}
+
+	configASSERT(port != NULL);
+
+	RCC_APB2PeriphClockCmd(port->clock, state);
+
+	if (state == ENABLE)
+	{
+		// At most 36 MHz, which a quarter of PCLK2 stays under up to 144 MHz
+		ADC_CommonStructInit(&common_init);
+		common_init.ADC_Mode = ADC_Mode_Independent;
+		common_init.ADC_Prescaler = ADC_Prescaler_Div4;
+		common_init.ADC_DMAAccessMode = ADC_DMAAccessMode_Disabled;
+		ADC_CommonInit(&common_init);
+	}
+}
+
+/**
+  * @brief  Start TIM2 with an update event, and so a trigger, at the sample
+  * 		rate, or stop it
+  *
+  * @param  config -> the pipeline
+  * @param  state -> ENABLE or DISABLE
+  *
+  * @retval None
+  */
+static void adc_stm32f4_trigger(const adc_pipeline_config_t *config, FunctionalState state)
+{
+	TIM_TimeBaseInitTypeDef time_base;
+	RCC_ClocksTypeDef clocks;
+	uint32_t timer_clock;
+
+	if (state == DISABLE)
+	{
+		TIM_Cmd(TIM2, DISABLE);
+		RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2, DISABLE);
+		return;
+	}
+
+	configASSERT(config->sample_rate > 0);
+
+	// The timers of APB1 run at twice PCLK1 unless APB1 is not divided
+	RCC_GetClocksFreq(&clocks);
+	timer_clock = (clocks.PCLK1_Frequency == clocks.HCLK_Frequency) ?
+			clocks.PCLK1_Frequency : (clocks.PCLK1_Frequency * 2);
+
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2, ENABLE);
+
+	// TIM2 counts to 32 bits, so it divides down to any rate without a prescaler
+	TIM_TimeBaseStructInit(&time_base);
+	time_base.TIM_Prescaler = 0;
+	time_base.TIM_Period = (timer_clock / config->sample_rate) - 1;
+	time_base.TIM_CounterMode = TIM_CounterMode_Up;
+	TIM_TimeBaseInit(TIM2, &time_base);
+
+	TIM_SelectOutputTrigger(TIM2, TIM_TRGOSource_Update);
+	TIM_Cmd(TIM2, ENABLE);
+}
+
+const adc_hw_t adc_stm32f4_hw =
+{
+	adc_stm32f4_enable,
+	adc_stm32f4_trigger,
+	ADC_ExternalTrigConv_T2_TRGO
+};
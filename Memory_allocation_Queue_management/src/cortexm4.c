@@ -1,5 +1,15 @@
 #include "demo.h"
 
+// Rings of the console, filled and emptied by DMA1 streams 5 and 6
+#define CONSOLE_RX_RING_SIZE	(64)
+#define CONSOLE_RX_BUFFER_SIZE	(256)
+#define CONSOLE_TX_RING_SIZE	(512)
+
+uart_t console_uart;
+
+static uint8_t console_rx_ring[CONSOLE_RX_RING_SIZE];
+static uint8_t console_tx_ring[CONSOLE_TX_RING_SIZE];
+
 /**
   * @brief  A private function that initilizes USART
   *
@@ -9,24 +19,26 @@
   */
 void prvSetupUart(void)
 {
-
-	USART_InitTypeDef uart_init;
-
-	// 1. Enable Peripheral clock for UART2
-	RCC_APB1PeriphClockCmd(RCC_APB1Periph_USART2, ENABLE);
-
-	// UART initialize
-	memset(&uart_init, 0, sizeof(uart_init));
-	uart_init.USART_BaudRate = 115200;
-	uart_init.USART_Mode = USART_Mode_Rx | USART_Mode_Tx;
-	uart_init.USART_Parity = USART_Parity_No;
-	uart_init.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
-	uart_init.USART_StopBits = USART_StopBits_1;
-	uart_init.USART_WordLength = USART_WordLength_8b;
-	USART_Init(USART2, &uart_init);
-
-	// Enable USART
-	USART_Cmd(USART2, ENABLE);
+	uart_config_t config;
+	BaseType_t result;
+
+	// USART2 at 115200 baud, 8N1, through the ST-LINK virtual COM port
+	memset(&config, 0, sizeof(config));
+	config.regs = USART2;
+	config.baud_rate = 115200;
+	config.dma_controller = 1;
+	config.rx_stream = 5;
+	config.rx_channel = DMA_Channel_4;
+	config.tx_stream = 6;
+	config.tx_channel = DMA_Channel_4;
+	config.rx_ring = console_rx_ring;
+	config.rx_ring_size = CONSOLE_RX_RING_SIZE;
+	config.rx_buffer_size = CONSOLE_RX_BUFFER_SIZE;
+	config.tx_ring = console_tx_ring;
+	config.tx_ring_size = CONSOLE_TX_RING_SIZE;
+
+	result = uart_open(&console_uart, &uart_stm32f4_hw, &config);
+	configASSERT(result == pdPASS);
 }
 
 /**
@@ -106,6 +118,47 @@ void prvSetupInterrupt(void)
 	NVIC_EnableIRQ(EXTI15_10_IRQn);
 }
 
+/**
+  * @brief  A private function that gives the heap its regions.
+  * 		SRAM1 holds the stacks and TCBs the CPU uses on every context
+  * 		switch, SRAM2 holds DMA buffers so DMA transfers do not contend
+  * 		with the CPU for SRAM1, and the backup SRAM holds data that is
+  * 		rarely used. The regions are the free space left by the linker
+  *
+  * @param  None
+  *
+  * @retval None
+  */
+void prvSetupHeap(void)
+{
+	extern uint8_t _sram1_heap_start[], _sram1_heap_end[];
+	extern uint8_t _sram2_heap_start[], _sram2_heap_end[];
+	extern uint8_t _bkpsram_heap_start[], _bkpsram_heap_end[];
+
+	// The regions are tried in this order, first those that prefer the
+	// hint then those that accept it
+	const HeapRegionWithHints_t regions[] =
+	{
+		{ _sram1_heap_start, (size_t) (_sram1_heap_end - _sram1_heap_start), "SRAM1",
+		  heapHINT_BIT(eHeapHintGeneral) | heapHINT_BIT(eHeapHintTCB) | heapHINT_BIT(eHeapHintStack),
+		  heapHINT_BIT(eHeapHintDMA) | heapHINT_BIT(eHeapHintRarelyUsed) },
+		{ _sram2_heap_start, (size_t) (_sram2_heap_end - _sram2_heap_start), "SRAM2",
+		  heapHINT_BIT(eHeapHintDMA),
+		  heapHINT_BIT(eHeapHintGeneral) | heapHINT_BIT(eHeapHintTCB) | heapHINT_BIT(eHeapHintStack) },
+		{ _bkpsram_heap_start, (size_t) (_bkpsram_heap_end - _bkpsram_heap_start), "BKPSRAM",
+		  heapHINT_BIT(eHeapHintRarelyUsed),
+		  heapHINT_BIT(eHeapHintGeneral) },
+		{ NULL, 0, NULL, 0, 0 }
+	};
+
+	// Enable the backup SRAM clock, and write access to the backup domain
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_PWR, ENABLE);
+	PWR_BackupAccessCmd(ENABLE);
+	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_BKPSRAM, ENABLE);
+
+	vPortDefineHeapRegionsWithHints(regions);
+}
+
  /* @brief  A private function that initilizes STM32F4 Nucleo-F446RE
   *
   * @param  None
@@ -115,8 +168,10 @@ void prvSetupInterrupt(void)
 void prvSetupHW(void)
 {
 	prvSetupGpio();
-	prvSetupUart();
 	prvSetupInterrupt();
+	prvSetupHeap();
+	dma_manager_init(&dma_stm32f4_hw);
+	prvSetupUart();
 }
 
 
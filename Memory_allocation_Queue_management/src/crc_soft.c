@@ -0,0 +1,885 @@
+/**
+  ******************************************************************************
+  * @file    crc_soft.c
+  * @brief   Software CRCs of the variants of crc_unit.h, eight bytes at a
+  * 		 time with slice-by-8 tables.  The tables take 16KB, and are only
+  * 		 linked in when crc_soft_calculate() is used.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "crc_unit.h"
+
+// Entry [k][i] is the CRC register after byte i and then k zero bytes, most
+// significant bit first with the polynomial 0x04C11DB7, or least significant
+// bit first with its reflection 0xEDB88320
+static const uint32_t crc_msb_table[8][256] =
+{
+	{
+		0x00000000UL, 0x04C11DB7UL, 0x09823B6EUL, 0x0D4326D9UL, 0x130476DCUL, 0x17C56B6BUL,
+		0x1A864DB2UL, 0x1E475005UL, 0x2608EDB8UL, 0x22C9F00FUL, 0x2F8AD6D6UL, 0x2B4BCB61UL,
+		0x350C9B64UL, 0x31CD86D3UL, 0x3C8EA00AUL, 0x384FBDBDUL, 0x4C11DB70UL, 0x48D0C6C7UL,
+		0x4593E01EUL, 0x4152FDA9UL, 0x5F15ADACUL, 0x5BD4B01BUL, 0x569796C2UL, 0x52568B75UL,
+		0x6A1936C8UL, 0x6ED82B7FUL, 0x639B0DA6UL, 0x675A1011UL, 0x791D4014UL, 0x7DDC5DA3UL,
+		0x709F7B7AUL, 0x745E66CDUL, 0x9823B6E0UL, 0x9CE2AB57UL, 0x91A18D8EUL, 0x95609039UL,
+		0x8B27C03CUL, 0x8FE6DD8BUL, 0x82A5FB52UL, 0x8664E6E5UL, 0xBE2B5B58UL, 0xBAEA46EFUL,
+		0xB7A96036UL, 0xB3687D81UL, 0xAD2F2D84UL, 0xA9EE3033UL, 0xA4AD16EAUL, 0xA06C0B5DUL,
+		0xD4326D90UL, 0xD0F37027UL, 0xDDB056FEUL, 0xD9714B49UL, 0xC7361B4CUL, 0xC3F706FBUL,
+		0xCEB42022UL, 0xCA753D95UL, 0xF23A8028UL, 0xF6FB9D9FUL, 0xFBB8BB46UL, 0xFF79A6F1UL,
+		0xE13EF6F4UL, 0xE5FFEB43UL, 0xE8BCCD9AUL, 0xEC7DD02DUL, 0x34867077UL, 0x30476DC0UL,
+		0x3D044B19UL, 0x39C556AEUL, 0x278206ABUL, 0x23431B1CUL, 0x2E003DC5UL, 0x2AC12072UL,
+		0x128E9DCFUL, 0x164F8078UL, 0x1B0CA6A1UL, 0x1FCDBB16UL, 0x018AEB13UL, 0x054BF6A4UL,
+		0x0808D07DUL, 0x0CC9CDCAUL, 0x7897AB07UL, 0x7C56B6B0UL, 0x71159069UL, 0x75D48DDEUL,
+		0x6B93DDDBUL, 0x6F52C06CUL, 0x6211E6B5UL, 0x66D0FB02UL, 0x5E9F46BFUL, 0x5A5E5B08UL,
+		0x571D7DD1UL, 0x53DC6066UL, 0x4D9B3063UL, 0x495A2DD4UL, 0x44190B0DUL, 0x40D816BAUL,
+		0xACA5C697UL, 0xA864DB20UL, 0xA527FDF9UL, 0xA1E6E04EUL, 0xBFA1B04BUL, 0xBB60ADFCUL,
+		0xB6238B25UL, 0xB2E29692UL, 0x8AAD2B2FUL, 0x8E6C3698UL, 0x832F1041UL, 0x87EE0DF6UL,
+		0x99A95DF3UL, 0x9D684044UL, 0x902B669DUL, 0x94EA7B2AUL, 0xE0B41DE7UL, 0xE4750050UL,
+		0xE9362689UL, 0xEDF73B3EUL, 0xF3B06B3BUL, 0xF771768CUL, 0xFA325055UL, 0xFEF34DE2UL,
+		0xC6BCF05FUL, 0xC27DEDE8UL, 0xCF3ECB31UL, 0xCBFFD686UL, 0xD5B88683UL, 0xD1799B34UL,
+		0xDC3ABDEDUL, 0xD8FBA05AUL, 0x690CE0EEUL, 0x6DCDFD59UL, 0x608EDB80UL, 0x644FC637UL,
+		0x7A089632UL, 0x7EC98B85UL, 0x738AAD5CUL, 0x774BB0EBUL, 0x4F040D56UL, 0x4BC510E1UL,
+		0x46863638UL, 0x42472B8FUL, 0x5C007B8AUL, 0x58C1663DUL, 0x558240E4UL, 0x51435D53UL,
+		0x251D3B9EUL, 0x21DC2629UL, 0x2C9F00F0UL, 0x285E1D47UL, 0x36194D42UL, 0x32D850F5UL,
+		0x3F9B762CUL, 0x3B5A6B9BUL, 0x0315D626UL, 0x07D4CB91UL, 0x0A97ED48UL, 0x0E56F0FFUL,
+		0x1011A0FAUL, 0x14D0BD4DUL, 0x19939B94UL, 0x1D528623UL, 0xF12F560EUL, 0xF5EE4BB9UL,
+		0xF8AD6D60UL, 0xFC6C70D7UL, 0xE22B20D2UL, 0xE6EA3D65UL, 0xEBA91BBCUL, 0xEF68060BUL,
+		0xD727BBB6UL, 0xD3E6A601UL, 0xDEA580D8UL, 0xDA649D6FUL, 0xC423CD6AUL, 0xC0E2D0DDUL,
+		0xCDA1F604UL, 0xC960EBB3UL, 0xBD3E8D7EUL, 0xB9FF90C9UL, 0xB4BCB610UL, 0xB07DABA7UL,
+		0xAE3AFBA2UL, 0xAAFBE615UL, 0xA7B8C0CCUL, 0xA379DD7BUL, 0x9B3660C6UL, 0x9FF77D71UL,
+		0x92B45BA8UL, 0x9675461FUL, 0x8832161AUL, 0x8CF30BADUL, 0x81B02D74UL, 0x857130C3UL,
+		0x5D8A9099UL, 0x594B8D2EUL, 0x5408ABF7UL, 0x50C9B640UL, 0x4E8EE645UL, 0x4A4FFBF2UL,
+		0x470CDD2BUL, 0x43CDC09CUL, 0x7B827D21UL, 0x7F436096UL, 0x7200464FUL, 0x76C15BF8UL,
+		0x68860BFDUL, 0x6C47164AUL, 0x61043093UL, 0x65C52D24UL, 0x119B4BE9UL, 0x155A565EUL,
+		0x18197087UL, 0x1CD86D30UL, 0x029F3D35UL, 0x065E2082UL, 0x0B1D065BUL, 0x0FDC1BECUL,
+		0x3793A651UL, 0x3352BBE6UL, 0x3E119D3FUL, 0x3AD08088UL, 0x2497D08DUL, 0x2056CD3AUL,
+		0x2D15EBE3UL, 0x29D4F654UL, 0xC5A92679UL, 0xC1683BCEUL, 0xCC2B1D17UL, 0xC8EA00A0UL,
+		0xD6AD50A5UL, 0xD26C4D12UL, 0xDF2F6BCBUL, 0xDBEE767CUL, 0xE3A1CBC1UL, 0xE760D676UL,
+		0xEA23F0AFUL, 0xEEE2ED18UL, 0xF0A5BD1DUL, 0xF464A0AAUL, 0xF9278673UL, 0xFDE69BC4UL,
+		0x89B8FD09UL, 0x8D79E0BEUL, 0x803AC667UL, 0x84FBDBD0UL, 0x9ABC8BD5UL, 0x9E7D9662UL,
+		0x933EB0BBUL, 0x97FFAD0CUL, 0xAFB010B1UL, 0xAB710D06UL, 0xA6322BDFUL, 0xA2F33668UL,
+		0xBCB4666DUL, 0xB8757BDAUL, 0xB5365D03UL, 0xB1F740B4UL
+	},
+	{
+		0x00000000UL, 0xD219C1DCUL, 0xA0F29E0FUL, 0x72EB5FD3UL, 0x452421A9UL, 0x973DE075UL,
+		0xE5D6BFA6UL, 0x37CF7E7AUL, 0x8A484352UL, 0x5851828EUL, 0x2ABADD5DUL, 0xF8A31C81UL,
+		0xCF6C62FBUL, 0x1D75A327UL, 0x6F9EFCF4UL, 0xBD873D28UL, 0x10519B13UL, 0xC2485ACFUL,
+		0xB0A3051CUL, 0x62BAC4C0UL, 0x5575BABAUL, 0x876C7B66UL, 0xF58724B5UL, 0x279EE569UL,
+		0x9A19D841UL, 0x4800199DUL, 0x3AEB464EUL, 0xE8F28792UL, 0xDF3DF9E8UL, 0x0D243834UL,
+		0x7FCF67E7UL, 0xADD6A63BUL, 0x20A33626UL, 0xF2BAF7FAUL, 0x8051A829UL, 0x524869F5UL,
+		0x6587178FUL, 0xB79ED653UL, 0xC5758980UL, 0x176C485CUL, 0xAAEB7574UL, 0x78F2B4A8UL,
+		0x0A19EB7BUL, 0xD8002AA7UL, 0xEFCF54DDUL, 0x3DD69501UL, 0x4F3DCAD2UL, 0x9D240B0EUL,
+		0x30F2AD35UL, 0xE2EB6CE9UL, 0x9000333AUL, 0x4219F2E6UL, 0x75D68C9CUL, 0xA7CF4D40UL,
+		0xD5241293UL, 0x073DD34FUL, 0xBABAEE67UL, 0x68A32FBBUL, 0x1A487068UL, 0xC851B1B4UL,
+		0xFF9ECFCEUL, 0x2D870E12UL, 0x5F6C51C1UL, 0x8D75901DUL, 0x41466C4CUL, 0x935FAD90UL,
+		0xE1B4F243UL, 0x33AD339FUL, 0x04624DE5UL, 0xD67B8C39UL, 0xA490D3EAUL, 0x76891236UL,
+		0xCB0E2F1EUL, 0x1917EEC2UL, 0x6BFCB111UL, 0xB9E570CDUL, 0x8E2A0EB7UL, 0x5C33CF6BUL,
+		0x2ED890B8UL, 0xFCC15164UL, 0x5117F75FUL, 0x830E3683UL, 0xF1E56950UL, 0x23FCA88CUL,
+		0x1433D6F6UL, 0xC62A172AUL, 0xB4C148F9UL, 0x66D88925UL, 0xDB5FB40DUL, 0x094675D1UL,
+		0x7BAD2A02UL, 0xA9B4EBDEUL, 0x9E7B95A4UL, 0x4C625478UL, 0x3E890BABUL, 0xEC90CA77UL,
+		0x61E55A6AUL, 0xB3FC9BB6UL, 0xC117C465UL, 0x130E05B9UL, 0x24C17BC3UL, 0xF6D8BA1FUL,
+		0x8433E5CCUL, 0x562A2410UL, 0xEBAD1938UL, 0x39B4D8E4UL, 0x4B5F8737UL, 0x994646EBUL,
+		0xAE893891UL, 0x7C90F94DUL, 0x0E7BA69EUL, 0xDC626742UL, 0x71B4C179UL, 0xA3AD00A5UL,
+		0xD1465F76UL, 0x035F9EAAUL, 0x3490E0D0UL, 0xE689210CUL, 0x94627EDFUL, 0x467BBF03UL,
+		0xFBFC822BUL, 0x29E543F7UL, 0x5B0E1C24UL, 0x8917DDF8UL, 0xBED8A382UL, 0x6CC1625EUL,
+		0x1E2A3D8DUL, 0xCC33FC51UL, 0x828CD898UL, 0x50951944UL, 0x227E4697UL, 0xF067874BUL,
+		0xC7A8F931UL, 0x15B138EDUL, 0x675A673EUL, 0xB543A6E2UL, 0x08C49BCAUL, 0xDADD5A16UL,
+		0xA83605C5UL, 0x7A2FC419UL, 0x4DE0BA63UL, 0x9FF97BBFUL, 0xED12246CUL, 0x3F0BE5B0UL,
+		0x92DD438BUL, 0x40C48257UL, 0x322FDD84UL, 0xE0361C58UL, 0xD7F96222UL, 0x05E0A3FEUL,
+		0x770BFC2DUL, 0xA5123DF1UL, 0x189500D9UL, 0xCA8CC105UL, 0xB8679ED6UL, 0x6A7E5F0AUL,
+		0x5DB12170UL, 0x8FA8E0ACUL, 0xFD43BF7FUL, 0x2F5A7EA3UL, 0xA22FEEBEUL, 0x70362F62UL,
+		0x02DD70B1UL, 0xD0C4B16DUL, 0xE70BCF17UL, 0x35120ECBUL, 0x47F95118UL, 0x95E090C4UL,
+		0x2867ADECUL, 0xFA7E6C30UL, 0x889533E3UL, 0x5A8CF23FUL, 0x6D438C45UL, 0xBF5A4D99UL,
+		0xCDB1124AUL, 0x1FA8D396UL, 0xB27E75ADUL, 0x6067B471UL, 0x128CEBA2UL, 0xC0952A7EUL,
+		0xF75A5404UL, 0x254395D8UL, 0x57A8CA0BUL, 0x85B10BD7UL, 0x383636FFUL, 0xEA2FF723UL,
+		0x98C4A8F0UL, 0x4ADD692CUL, 0x7D121756UL, 0xAF0BD68AUL, 0xDDE08959UL, 0x0FF94885UL,
+		0xC3CAB4D4UL, 0x11D37508UL, 0x63382ADBUL, 0xB121EB07UL, 0x86EE957DUL, 0x54F754A1UL,
+		0x261C0B72UL, 0xF405CAAEUL, 0x4982F786UL, 0x9B9B365AUL, 0xE9706989UL, 0x3B69A855UL,
+		0x0CA6D62FUL, 0xDEBF17F3UL, 0xAC544820UL, 0x7E4D89FCUL, 0xD39B2FC7UL, 0x0182EE1BUL,
+		0x7369B1C8UL, 0xA1707014UL, 0x96BF0E6EUL, 0x44A6CFB2UL, 0x364D9061UL, 0xE45451BDUL,
+		0x59D36C95UL, 0x8BCAAD49UL, 0xF921F29AUL, 0x2B383346UL, 0x1CF74D3CUL, 0xCEEE8CE0UL,
+		0xBC05D333UL, 0x6E1C12EFUL, 0xE36982F2UL, 0x3170432EUL, 0x439B1CFDUL, 0x9182DD21UL,
+		0xA64DA35BUL, 0x74546287UL, 0x06BF3D54UL, 0xD4A6FC88UL, 0x6921C1A0UL, 0xBB38007CUL,
+		0xC9D35FAFUL, 0x1BCA9E73UL, 0x2C05E009UL, 0xFE1C21D5UL, 0x8CF77E06UL, 0x5EEEBFDAUL,
+		0xF33819E1UL, 0x2121D83DUL, 0x53CA87EEUL, 0x81D34632UL, 0xB61C3848UL, 0x6405F994UL,
+		0x16EEA647UL, 0xC4F7679BUL, 0x79705AB3UL, 0xAB699B6FUL, 0xD982C4BCUL, 0x0B9B0560UL,
+		0x3C547B1AUL, 0xEE4DBAC6UL, 0x9CA6E515UL, 0x4EBF24C9UL
+	},
+	{
+		0x00000000UL, 0x01D8AC87UL, 0x03B1590EUL, 0x0269F589UL, 0x0762B21CUL, 0x06BA1E9BUL,
+		0x04D3EB12UL, 0x050B4795UL, 0x0EC56438UL, 0x0F1DC8BFUL, 0x0D743D36UL, 0x0CAC91B1UL,
+		0x09A7D624UL, 0x087F7AA3UL, 0x0A168F2AUL, 0x0BCE23ADUL, 0x1D8AC870UL, 0x1C5264F7UL,
+		0x1E3B917EUL, 0x1FE33DF9UL, 0x1AE87A6CUL, 0x1B30D6EBUL, 0x19592362UL, 0x18818FE5UL,
+		0x134FAC48UL, 0x129700CFUL, 0x10FEF546UL, 0x112659C1UL, 0x142D1E54UL, 0x15F5B2D3UL,
+		0x179C475AUL, 0x1644EBDDUL, 0x3B1590E0UL, 0x3ACD3C67UL, 0x38A4C9EEUL, 0x397C6569UL,
+		0x3C7722FCUL, 0x3DAF8E7BUL, 0x3FC67BF2UL, 0x3E1ED775UL, 0x35D0F4D8UL, 0x3408585FUL,
+		0x3661ADD6UL, 0x37B90151UL, 0x32B246C4UL, 0x336AEA43UL, 0x31031FCAUL, 0x30DBB34DUL,
+		0x269F5890UL, 0x2747F417UL, 0x252E019EUL, 0x24F6AD19UL, 0x21FDEA8CUL, 0x2025460BUL,
+		0x224CB382UL, 0x23941F05UL, 0x285A3CA8UL, 0x2982902FUL, 0x2BEB65A6UL, 0x2A33C921UL,
+		0x2F388EB4UL, 0x2EE02233UL, 0x2C89D7BAUL, 0x2D517B3DUL, 0x762B21C0UL, 0x77F38D47UL,
+		0x759A78CEUL, 0x7442D449UL, 0x714993DCUL, 0x70913F5BUL, 0x72F8CAD2UL, 0x73206655UL,
+		0x78EE45F8UL, 0x7936E97FUL, 0x7B5F1CF6UL, 0x7A87B071UL, 0x7F8CF7E4UL, 0x7E545B63UL,
+		0x7C3DAEEAUL, 0x7DE5026DUL, 0x6BA1E9B0UL, 0x6A794537UL, 0x6810B0BEUL, 0x69C81C39UL,
+		0x6CC35BACUL, 0x6D1BF72BUL, 0x6F7202A2UL, 0x6EAAAE25UL, 0x65648D88UL, 0x64BC210FUL,
+		0x66D5D486UL, 0x670D7801UL, 0x62063F94UL, 0x63DE9313UL, 0x61B7669AUL, 0x606FCA1DUL,
+		0x4D3EB120UL, 0x4CE61DA7UL, 0x4E8FE82EUL, 0x4F5744A9UL, 0x4A5C033CUL, 0x4B84AFBBUL,
+		0x49ED5A32UL, 0x4835F6B5UL, 0x43FBD518UL, 0x4223799FUL, 0x404A8C16UL, 0x41922091UL,
+		0x44996704UL, 0x4541CB83UL, 0x47283E0AUL, 0x46F0928DUL, 0x50B47950UL, 0x516CD5D7UL,
+		0x5305205EUL, 0x52DD8CD9UL, 0x57D6CB4CUL, 0x560E67CBUL, 0x54679242UL, 0x55BF3EC5UL,
+		0x5E711D68UL, 0x5FA9B1EFUL, 0x5DC04466UL, 0x5C18E8E1UL, 0x5913AF74UL, 0x58CB03F3UL,
+		0x5AA2F67AUL, 0x5B7A5AFDUL, 0xEC564380UL, 0xED8EEF07UL, 0xEFE71A8EUL, 0xEE3FB609UL,
+		0xEB34F19CUL, 0xEAEC5D1BUL, 0xE885A892UL, 0xE95D0415UL, 0xE29327B8UL, 0xE34B8B3FUL,
+		0xE1227EB6UL, 0xE0FAD231UL, 0xE5F195A4UL, 0xE4293923UL, 0xE640CCAAUL, 0xE798602DUL,
+		0xF1DC8BF0UL, 0xF0042777UL, 0xF26DD2FEUL, 0xF3B57E79UL, 0xF6BE39ECUL, 0xF766956BUL,
+		0xF50F60E2UL, 0xF4D7CC65UL, 0xFF19EFC8UL, 0xFEC1434FUL, 0xFCA8B6C6UL, 0xFD701A41UL,
+		0xF87B5DD4UL, 0xF9A3F153UL, 0xFBCA04DAUL, 0xFA12A85DUL, 0xD743D360UL, 0xD69B7FE7UL,
+		0xD4F28A6EUL, 0xD52A26E9UL, 0xD021617CUL, 0xD1F9CDFBUL, 0xD3903872UL, 0xD24894F5UL,
+		0xD986B758UL, 0xD85E1BDFUL, 0xDA37EE56UL, 0xDBEF42D1UL, 0xDEE40544UL, 0xDF3CA9C3UL,
+		0xDD555C4AUL, 0xDC8DF0CDUL, 0xCAC91B10UL, 0xCB11B797UL, 0xC978421EUL, 0xC8A0EE99UL,
+		0xCDABA90CUL, 0xCC73058BUL, 0xCE1AF002UL, 0xCFC25C85UL, 0xC40C7F28UL, 0xC5D4D3AFUL,
+		0xC7BD2626UL, 0xC6658AA1UL, 0xC36ECD34UL, 0xC2B661B3UL, 0xC0DF943AUL, 0xC10738BDUL,
+		0x9A7D6240UL, 0x9BA5CEC7UL, 0x99CC3B4EUL, 0x981497C9UL, 0x9D1FD05CUL, 0x9CC77CDBUL,
+		0x9EAE8952UL, 0x9F7625D5UL, 0x94B80678UL, 0x9560AAFFUL, 0x97095F76UL, 0x96D1F3F1UL,
+		0x93DAB464UL, 0x920218E3UL, 0x906BED6AUL, 0x91B341EDUL, 0x87F7AA30UL, 0x862F06B7UL,
+		0x8446F33EUL, 0x859E5FB9UL, 0x8095182CUL, 0x814DB4ABUL, 0x83244122UL, 0x82FCEDA5UL,
+		0x8932CE08UL, 0x88EA628FUL, 0x8A839706UL, 0x8B5B3B81UL, 0x8E507C14UL, 0x8F88D093UL,
+		0x8DE1251AUL, 0x8C39899DUL, 0xA168F2A0UL, 0xA0B05E27UL, 0xA2D9ABAEUL, 0xA3010729UL,
+		0xA60A40BCUL, 0xA7D2EC3BUL, 0xA5BB19B2UL, 0xA463B535UL, 0xAFAD9698UL, 0xAE753A1FUL,
+		0xAC1CCF96UL, 0xADC46311UL, 0xA8CF2484UL, 0xA9178803UL, 0xAB7E7D8AUL, 0xAAA6D10DUL,
+		0xBCE23AD0UL, 0xBD3A9657UL, 0xBF5363DEUL, 0xBE8BCF59UL, 0xBB8088CCUL, 0xBA58244BUL,
+		0xB831D1C2UL, 0xB9E97D45UL, 0xB2275EE8UL, 0xB3FFF26FUL, 0xB19607E6UL, 0xB04EAB61UL,
+		0xB545ECF4UL, 0xB49D4073UL, 0xB6F4B5FAUL, 0xB72C197DUL
+	},
+	{
+		0x00000000UL, 0xDC6D9AB7UL, 0xBC1A28D9UL, 0x6077B26EUL, 0x7CF54C05UL, 0xA098D6B2UL,
+		0xC0EF64DCUL, 0x1C82FE6BUL, 0xF9EA980AUL, 0x258702BDUL, 0x45F0B0D3UL, 0x999D2A64UL,
+		0x851FD40FUL, 0x59724EB8UL, 0x3905FCD6UL, 0xE5686661UL, 0xF7142DA3UL, 0x2B79B714UL,
+		0x4B0E057AUL, 0x97639FCDUL, 0x8BE161A6UL, 0x578CFB11UL, 0x37FB497FUL, 0xEB96D3C8UL,
+		0x0EFEB5A9UL, 0xD2932F1EUL, 0xB2E49D70UL, 0x6E8907C7UL, 0x720BF9ACUL, 0xAE66631BUL,
+		0xCE11D175UL, 0x127C4BC2UL, 0xEAE946F1UL, 0x3684DC46UL, 0x56F36E28UL, 0x8A9EF49FUL,
+		0x961C0AF4UL, 0x4A719043UL, 0x2A06222DUL, 0xF66BB89AUL, 0x1303DEFBUL, 0xCF6E444CUL,
+		0xAF19F622UL, 0x73746C95UL, 0x6FF692FEUL, 0xB39B0849UL, 0xD3ECBA27UL, 0x0F812090UL,
+		0x1DFD6B52UL, 0xC190F1E5UL, 0xA1E7438BUL, 0x7D8AD93CUL, 0x61082757UL, 0xBD65BDE0UL,
+		0xDD120F8EUL, 0x017F9539UL, 0xE417F358UL, 0x387A69EFUL, 0x580DDB81UL, 0x84604136UL,
+		0x98E2BF5DUL, 0x448F25EAUL, 0x24F89784UL, 0xF8950D33UL, 0xD1139055UL, 0x0D7E0AE2UL,
+		0x6D09B88CUL, 0xB164223BUL, 0xADE6DC50UL, 0x718B46E7UL, 0x11FCF489UL, 0xCD916E3EUL,
+		0x28F9085FUL, 0xF49492E8UL, 0x94E32086UL, 0x488EBA31UL, 0x540C445AUL, 0x8861DEEDUL,
+		0xE8166C83UL, 0x347BF634UL, 0x2607BDF6UL, 0xFA6A2741UL, 0x9A1D952FUL, 0x46700F98UL,
+		0x5AF2F1F3UL, 0x869F6B44UL, 0xE6E8D92AUL, 0x3A85439DUL, 0xDFED25FCUL, 0x0380BF4BUL,
+		0x63F70D25UL, 0xBF9A9792UL, 0xA31869F9UL, 0x7F75F34EUL, 0x1F024120UL, 0xC36FDB97UL,
+		0x3BFAD6A4UL, 0xE7974C13UL, 0x87E0FE7DUL, 0x5B8D64CAUL, 0x470F9AA1UL, 0x9B620016UL,
+		0xFB15B278UL, 0x277828CFUL, 0xC2104EAEUL, 0x1E7DD419UL, 0x7E0A6677UL, 0xA267FCC0UL,
+		0xBEE502ABUL, 0x6288981CUL, 0x02FF2A72UL, 0xDE92B0C5UL, 0xCCEEFB07UL, 0x108361B0UL,
+		0x70F4D3DEUL, 0xAC994969UL, 0xB01BB702UL, 0x6C762DB5UL, 0x0C019FDBUL, 0xD06C056CUL,
+		0x3504630DUL, 0xE969F9BAUL, 0x891E4BD4UL, 0x5573D163UL, 0x49F12F08UL, 0x959CB5BFUL,
+		0xF5EB07D1UL, 0x29869D66UL, 0xA6E63D1DUL, 0x7A8BA7AAUL, 0x1AFC15C4UL, 0xC6918F73UL,
+		0xDA137118UL, 0x067EEBAFUL, 0x660959C1UL, 0xBA64C376UL, 0x5F0CA517UL, 0x83613FA0UL,
+		0xE3168DCEUL, 0x3F7B1779UL, 0x23F9E912UL, 0xFF9473A5UL, 0x9FE3C1CBUL, 0x438E5B7CUL,
+		0x51F210BEUL, 0x8D9F8A09UL, 0xEDE83867UL, 0x3185A2D0UL, 0x2D075CBBUL, 0xF16AC60CUL,
+		0x911D7462UL, 0x4D70EED5UL, 0xA81888B4UL, 0x74751203UL, 0x1402A06DUL, 0xC86F3ADAUL,
+		0xD4EDC4B1UL, 0x08805E06UL, 0x68F7EC68UL, 0xB49A76DFUL, 0x4C0F7BECUL, 0x9062E15BUL,
+		0xF0155335UL, 0x2C78C982UL, 0x30FA37E9UL, 0xEC97AD5EUL, 0x8CE01F30UL, 0x508D8587UL,
+		0xB5E5E3E6UL, 0x69887951UL, 0x09FFCB3FUL, 0xD5925188UL, 0xC910AFE3UL, 0x157D3554UL,
+		0x750A873AUL, 0xA9671D8DUL, 0xBB1B564FUL, 0x6776CCF8UL, 0x07017E96UL, 0xDB6CE421UL,
+		0xC7EE1A4AUL, 0x1B8380FDUL, 0x7BF43293UL, 0xA799A824UL, 0x42F1CE45UL, 0x9E9C54F2UL,
+		0xFEEBE69CUL, 0x22867C2BUL, 0x3E048240UL, 0xE26918F7UL, 0x821EAA99UL, 0x5E73302EUL,
+		0x77F5AD48UL, 0xAB9837FFUL, 0xCBEF8591UL, 0x17821F26UL, 0x0B00E14DUL, 0xD76D7BFAUL,
+		0xB71AC994UL, 0x6B775323UL, 0x8E1F3542UL, 0x5272AFF5UL, 0x32051D9BUL, 0xEE68872CUL,
+		0xF2EA7947UL, 0x2E87E3F0UL, 0x4EF0519EUL, 0x929DCB29UL, 0x80E180EBUL, 0x5C8C1A5CUL,
+		0x3CFBA832UL, 0xE0963285UL, 0xFC14CCEEUL, 0x20795659UL, 0x400EE437UL, 0x9C637E80UL,
+		0x790B18E1UL, 0xA5668256UL, 0xC5113038UL, 0x197CAA8FUL, 0x05FE54E4UL, 0xD993CE53UL,
+		0xB9E47C3DUL, 0x6589E68AUL, 0x9D1CEBB9UL, 0x4171710EUL, 0x2106C360UL, 0xFD6B59D7UL,
+		0xE1E9A7BCUL, 0x3D843D0BUL, 0x5DF38F65UL, 0x819E15D2UL, 0x64F673B3UL, 0xB89BE904UL,
+		0xD8EC5B6AUL, 0x0481C1DDUL, 0x18033FB6UL, 0xC46EA501UL, 0xA419176FUL, 0x78748DD8UL,
+		0x6A08C61AUL, 0xB6655CADUL, 0xD612EEC3UL, 0x0A7F7474UL, 0x16FD8A1FUL, 0xCA9010A8UL,
+		0xAAE7A2C6UL, 0x768A3871UL, 0x93E25E10UL, 0x4F8FC4A7UL, 0x2FF876C9UL, 0xF395EC7EUL,
+		0xEF171215UL, 0x337A88A2UL, 0x530D3ACCUL, 0x8F60A07BUL
+	},
+	{
+		0x00000000UL, 0x490D678DUL, 0x921ACF1AUL, 0xDB17A897UL, 0x20F48383UL, 0x69F9E40EUL,
+		0xB2EE4C99UL, 0xFBE32B14UL, 0x41E90706UL, 0x08E4608BUL, 0xD3F3C81CUL, 0x9AFEAF91UL,
+		0x611D8485UL, 0x2810E308UL, 0xF3074B9FUL, 0xBA0A2C12UL, 0x83D20E0CUL, 0xCADF6981UL,
+		0x11C8C116UL, 0x58C5A69BUL, 0xA3268D8FUL, 0xEA2BEA02UL, 0x313C4295UL, 0x78312518UL,
+		0xC23B090AUL, 0x8B366E87UL, 0x5021C610UL, 0x192CA19DUL, 0xE2CF8A89UL, 0xABC2ED04UL,
+		0x70D54593UL, 0x39D8221EUL, 0x036501AFUL, 0x4A686622UL, 0x917FCEB5UL, 0xD872A938UL,
+		0x2391822CUL, 0x6A9CE5A1UL, 0xB18B4D36UL, 0xF8862ABBUL, 0x428C06A9UL, 0x0B816124UL,
+		0xD096C9B3UL, 0x999BAE3EUL, 0x6278852AUL, 0x2B75E2A7UL, 0xF0624A30UL, 0xB96F2DBDUL,
+		0x80B70FA3UL, 0xC9BA682EUL, 0x12ADC0B9UL, 0x5BA0A734UL, 0xA0438C20UL, 0xE94EEBADUL,
+		0x3259433AUL, 0x7B5424B7UL, 0xC15E08A5UL, 0x88536F28UL, 0x5344C7BFUL, 0x1A49A032UL,
+		0xE1AA8B26UL, 0xA8A7ECABUL, 0x73B0443CUL, 0x3ABD23B1UL, 0x06CA035EUL, 0x4FC764D3UL,
+		0x94D0CC44UL, 0xDDDDABC9UL, 0x263E80DDUL, 0x6F33E750UL, 0xB4244FC7UL, 0xFD29284AUL,
+		0x47230458UL, 0x0E2E63D5UL, 0xD539CB42UL, 0x9C34ACCFUL, 0x67D787DBUL, 0x2EDAE056UL,
+		0xF5CD48C1UL, 0xBCC02F4CUL, 0x85180D52UL, 0xCC156ADFUL, 0x1702C248UL, 0x5E0FA5C5UL,
+		0xA5EC8ED1UL, 0xECE1E95CUL, 0x37F641CBUL, 0x7EFB2646UL, 0xC4F10A54UL, 0x8DFC6DD9UL,
+		0x56EBC54EUL, 0x1FE6A2C3UL, 0xE40589D7UL, 0xAD08EE5AUL, 0x761F46CDUL, 0x3F122140UL,
+		0x05AF02F1UL, 0x4CA2657CUL, 0x97B5CDEBUL, 0xDEB8AA66UL, 0x255B8172UL, 0x6C56E6FFUL,
+		0xB7414E68UL, 0xFE4C29E5UL, 0x444605F7UL, 0x0D4B627AUL, 0xD65CCAEDUL, 0x9F51AD60UL,
+		0x64B28674UL, 0x2DBFE1F9UL, 0xF6A8496EUL, 0xBFA52EE3UL, 0x867D0CFDUL, 0xCF706B70UL,
+		0x1467C3E7UL, 0x5D6AA46AUL, 0xA6898F7EUL, 0xEF84E8F3UL, 0x34934064UL, 0x7D9E27E9UL,
+		0xC7940BFBUL, 0x8E996C76UL, 0x558EC4E1UL, 0x1C83A36CUL, 0xE7608878UL, 0xAE6DEFF5UL,
+		0x757A4762UL, 0x3C7720EFUL, 0x0D9406BCUL, 0x44996131UL, 0x9F8EC9A6UL, 0xD683AE2BUL,
+		0x2D60853FUL, 0x646DE2B2UL, 0xBF7A4A25UL, 0xF6772DA8UL, 0x4C7D01BAUL, 0x05706637UL,
+		0xDE67CEA0UL, 0x976AA92DUL, 0x6C898239UL, 0x2584E5B4UL, 0xFE934D23UL, 0xB79E2AAEUL,
+		0x8E4608B0UL, 0xC74B6F3DUL, 0x1C5CC7AAUL, 0x5551A027UL, 0xAEB28B33UL, 0xE7BFECBEUL,
+		0x3CA84429UL, 0x75A523A4UL, 0xCFAF0FB6UL, 0x86A2683BUL, 0x5DB5C0ACUL, 0x14B8A721UL,
+		0xEF5B8C35UL, 0xA656EBB8UL, 0x7D41432FUL, 0x344C24A2UL, 0x0EF10713UL, 0x47FC609EUL,
+		0x9CEBC809UL, 0xD5E6AF84UL, 0x2E058490UL, 0x6708E31DUL, 0xBC1F4B8AUL, 0xF5122C07UL,
+		0x4F180015UL, 0x06156798UL, 0xDD02CF0FUL, 0x940FA882UL, 0x6FEC8396UL, 0x26E1E41BUL,
+		0xFDF64C8CUL, 0xB4FB2B01UL, 0x8D23091FUL, 0xC42E6E92UL, 0x1F39C605UL, 0x5634A188UL,
+		0xADD78A9CUL, 0xE4DAED11UL, 0x3FCD4586UL, 0x76C0220BUL, 0xCCCA0E19UL, 0x85C76994UL,
+		0x5ED0C103UL, 0x17DDA68EUL, 0xEC3E8D9AUL, 0xA533EA17UL, 0x7E244280UL, 0x3729250DUL,
+		0x0B5E05E2UL, 0x4253626FUL, 0x9944CAF8UL, 0xD049AD75UL, 0x2BAA8661UL, 0x62A7E1ECUL,
+		0xB9B0497BUL, 0xF0BD2EF6UL, 0x4AB702E4UL, 0x03BA6569UL, 0xD8ADCDFEUL, 0x91A0AA73UL,
+		0x6A438167UL, 0x234EE6EAUL, 0xF8594E7DUL, 0xB15429F0UL, 0x888C0BEEUL, 0xC1816C63UL,
+		0x1A96C4F4UL, 0x539BA379UL, 0xA878886DUL, 0xE175EFE0UL, 0x3A624777UL, 0x736F20FAUL,
+		0xC9650CE8UL, 0x80686B65UL, 0x5B7FC3F2UL, 0x1272A47FUL, 0xE9918F6BUL, 0xA09CE8E6UL,
+		0x7B8B4071UL, 0x328627FCUL, 0x083B044DUL, 0x413663C0UL, 0x9A21CB57UL, 0xD32CACDAUL,
+		0x28CF87CEUL, 0x61C2E043UL, 0xBAD548D4UL, 0xF3D82F59UL, 0x49D2034BUL, 0x00DF64C6UL,
+		0xDBC8CC51UL, 0x92C5ABDCUL, 0x692680C8UL, 0x202BE745UL, 0xFB3C4FD2UL, 0xB231285FUL,
+		0x8BE90A41UL, 0xC2E46DCCUL, 0x19F3C55BUL, 0x50FEA2D6UL, 0xAB1D89C2UL, 0xE210EE4FUL,
+		0x390746D8UL, 0x700A2155UL, 0xCA000D47UL, 0x830D6ACAUL, 0x581AC25DUL, 0x1117A5D0UL,
+		0xEAF48EC4UL, 0xA3F9E949UL, 0x78EE41DEUL, 0x31E32653UL
+	},
+	{
+		0x00000000UL, 0x1B280D78UL, 0x36501AF0UL, 0x2D781788UL, 0x6CA035E0UL, 0x77883898UL,
+		0x5AF02F10UL, 0x41D82268UL, 0xD9406BC0UL, 0xC26866B8UL, 0xEF107130UL, 0xF4387C48UL,
+		0xB5E05E20UL, 0xAEC85358UL, 0x83B044D0UL, 0x989849A8UL, 0xB641CA37UL, 0xAD69C74FUL,
+		0x8011D0C7UL, 0x9B39DDBFUL, 0xDAE1FFD7UL, 0xC1C9F2AFUL, 0xECB1E527UL, 0xF799E85FUL,
+		0x6F01A1F7UL, 0x7429AC8FUL, 0x5951BB07UL, 0x4279B67FUL, 0x03A19417UL, 0x1889996FUL,
+		0x35F18EE7UL, 0x2ED9839FUL, 0x684289D9UL, 0x736A84A1UL, 0x5E129329UL, 0x453A9E51UL,
+		0x04E2BC39UL, 0x1FCAB141UL, 0x32B2A6C9UL, 0x299AABB1UL, 0xB102E219UL, 0xAA2AEF61UL,
+		0x8752F8E9UL, 0x9C7AF591UL, 0xDDA2D7F9UL, 0xC68ADA81UL, 0xEBF2CD09UL, 0xF0DAC071UL,
+		0xDE0343EEUL, 0xC52B4E96UL, 0xE853591EUL, 0xF37B5466UL, 0xB2A3760EUL, 0xA98B7B76UL,
+		0x84F36CFEUL, 0x9FDB6186UL, 0x0743282EUL, 0x1C6B2556UL, 0x311332DEUL, 0x2A3B3FA6UL,
+		0x6BE31DCEUL, 0x70CB10B6UL, 0x5DB3073EUL, 0x469B0A46UL, 0xD08513B2UL, 0xCBAD1ECAUL,
+		0xE6D50942UL, 0xFDFD043AUL, 0xBC252652UL, 0xA70D2B2AUL, 0x8A753CA2UL, 0x915D31DAUL,
+		0x09C57872UL, 0x12ED750AUL, 0x3F956282UL, 0x24BD6FFAUL, 0x65654D92UL, 0x7E4D40EAUL,
+		0x53355762UL, 0x481D5A1AUL, 0x66C4D985UL, 0x7DECD4FDUL, 0x5094C375UL, 0x4BBCCE0DUL,
+		0x0A64EC65UL, 0x114CE11DUL, 0x3C34F695UL, 0x271CFBEDUL, 0xBF84B245UL, 0xA4ACBF3DUL,
+		0x89D4A8B5UL, 0x92FCA5CDUL, 0xD32487A5UL, 0xC80C8ADDUL, 0xE5749D55UL, 0xFE5C902DUL,
+		0xB8C79A6BUL, 0xA3EF9713UL, 0x8E97809BUL, 0x95BF8DE3UL, 0xD467AF8BUL, 0xCF4FA2F3UL,
+		0xE237B57BUL, 0xF91FB803UL, 0x6187F1ABUL, 0x7AAFFCD3UL, 0x57D7EB5BUL, 0x4CFFE623UL,
+		0x0D27C44BUL, 0x160FC933UL, 0x3B77DEBBUL, 0x205FD3C3UL, 0x0E86505CUL, 0x15AE5D24UL,
+		0x38D64AACUL, 0x23FE47D4UL, 0x622665BCUL, 0x790E68C4UL, 0x54767F4CUL, 0x4F5E7234UL,
+		0xD7C63B9CUL, 0xCCEE36E4UL, 0xE196216CUL, 0xFABE2C14UL, 0xBB660E7CUL, 0xA04E0304UL,
+		0x8D36148CUL, 0x961E19F4UL, 0xA5CB3AD3UL, 0xBEE337ABUL, 0x939B2023UL, 0x88B32D5BUL,
+		0xC96B0F33UL, 0xD243024BUL, 0xFF3B15C3UL, 0xE41318BBUL, 0x7C8B5113UL, 0x67A35C6BUL,
+		0x4ADB4BE3UL, 0x51F3469BUL, 0x102B64F3UL, 0x0B03698BUL, 0x267B7E03UL, 0x3D53737BUL,
+		0x138AF0E4UL, 0x08A2FD9CUL, 0x25DAEA14UL, 0x3EF2E76CUL, 0x7F2AC504UL, 0x6402C87CUL,
+		0x497ADFF4UL, 0x5252D28CUL, 0xCACA9B24UL, 0xD1E2965CUL, 0xFC9A81D4UL, 0xE7B28CACUL,
+		0xA66AAEC4UL, 0xBD42A3BCUL, 0x903AB434UL, 0x8B12B94CUL, 0xCD89B30AUL, 0xD6A1BE72UL,
+		0xFBD9A9FAUL, 0xE0F1A482UL, 0xA12986EAUL, 0xBA018B92UL, 0x97799C1AUL, 0x8C519162UL,
+		0x14C9D8CAUL, 0x0FE1D5B2UL, 0x2299C23AUL, 0x39B1CF42UL, 0x7869ED2AUL, 0x6341E052UL,
+		0x4E39F7DAUL, 0x5511FAA2UL, 0x7BC8793DUL, 0x60E07445UL, 0x4D9863CDUL, 0x56B06EB5UL,
+		0x17684CDDUL, 0x0C4041A5UL, 0x2138562DUL, 0x3A105B55UL, 0xA28812FDUL, 0xB9A01F85UL,
+		0x94D8080DUL, 0x8FF00575UL, 0xCE28271DUL, 0xD5002A65UL, 0xF8783DEDUL, 0xE3503095UL,
+		0x754E2961UL, 0x6E662419UL, 0x431E3391UL, 0x58363EE9UL, 0x19EE1C81UL, 0x02C611F9UL,
+		0x2FBE0671UL, 0x34960B09UL, 0xAC0E42A1UL, 0xB7264FD9UL, 0x9A5E5851UL, 0x81765529UL,
+		0xC0AE7741UL, 0xDB867A39UL, 0xF6FE6DB1UL, 0xEDD660C9UL, 0xC30FE356UL, 0xD827EE2EUL,
+		0xF55FF9A6UL, 0xEE77F4DEUL, 0xAFAFD6B6UL, 0xB487DBCEUL, 0x99FFCC46UL, 0x82D7C13EUL,
+		0x1A4F8896UL, 0x016785EEUL, 0x2C1F9266UL, 0x37379F1EUL, 0x76EFBD76UL, 0x6DC7B00EUL,
+		0x40BFA786UL, 0x5B97AAFEUL, 0x1D0CA0B8UL, 0x0624ADC0UL, 0x2B5CBA48UL, 0x3074B730UL,
+		0x71AC9558UL, 0x6A849820UL, 0x47FC8FA8UL, 0x5CD482D0UL, 0xC44CCB78UL, 0xDF64C600UL,
+		0xF21CD188UL, 0xE934DCF0UL, 0xA8ECFE98UL, 0xB3C4F3E0UL, 0x9EBCE468UL, 0x8594E910UL,
+		0xAB4D6A8FUL, 0xB06567F7UL, 0x9D1D707FUL, 0x86357D07UL, 0xC7ED5F6FUL, 0xDCC55217UL,
+		0xF1BD459FUL, 0xEA9548E7UL, 0x720D014FUL, 0x69250C37UL, 0x445D1BBFUL, 0x5F7516C7UL,
+		0x1EAD34AFUL, 0x058539D7UL, 0x28FD2E5FUL, 0x33D52327UL
+	},
+	{
+		0x00000000UL, 0x4F576811UL, 0x9EAED022UL, 0xD1F9B833UL, 0x399CBDF3UL, 0x76CBD5E2UL,
+		0xA7326DD1UL, 0xE86505C0UL, 0x73397BE6UL, 0x3C6E13F7UL, 0xED97ABC4UL, 0xA2C0C3D5UL,
+		0x4AA5C615UL, 0x05F2AE04UL, 0xD40B1637UL, 0x9B5C7E26UL, 0xE672F7CCUL, 0xA9259FDDUL,
+		0x78DC27EEUL, 0x378B4FFFUL, 0xDFEE4A3FUL, 0x90B9222EUL, 0x41409A1DUL, 0x0E17F20CUL,
+		0x954B8C2AUL, 0xDA1CE43BUL, 0x0BE55C08UL, 0x44B23419UL, 0xACD731D9UL, 0xE38059C8UL,
+		0x3279E1FBUL, 0x7D2E89EAUL, 0xC824F22FUL, 0x87739A3EUL, 0x568A220DUL, 0x19DD4A1CUL,
+		0xF1B84FDCUL, 0xBEEF27CDUL, 0x6F169FFEUL, 0x2041F7EFUL, 0xBB1D89C9UL, 0xF44AE1D8UL,
+		0x25B359EBUL, 0x6AE431FAUL, 0x8281343AUL, 0xCDD65C2BUL, 0x1C2FE418UL, 0x53788C09UL,
+		0x2E5605E3UL, 0x61016DF2UL, 0xB0F8D5C1UL, 0xFFAFBDD0UL, 0x17CAB810UL, 0x589DD001UL,
+		0x89646832UL, 0xC6330023UL, 0x5D6F7E05UL, 0x12381614UL, 0xC3C1AE27UL, 0x8C96C636UL,
+		0x64F3C3F6UL, 0x2BA4ABE7UL, 0xFA5D13D4UL, 0xB50A7BC5UL, 0x9488F9E9UL, 0xDBDF91F8UL,
+		0x0A2629CBUL, 0x457141DAUL, 0xAD14441AUL, 0xE2432C0BUL, 0x33BA9438UL, 0x7CEDFC29UL,
+		0xE7B1820FUL, 0xA8E6EA1EUL, 0x791F522DUL, 0x36483A3CUL, 0xDE2D3FFCUL, 0x917A57EDUL,
+		0x4083EFDEUL, 0x0FD487CFUL, 0x72FA0E25UL, 0x3DAD6634UL, 0xEC54DE07UL, 0xA303B616UL,
+		0x4B66B3D6UL, 0x0431DBC7UL, 0xD5C863F4UL, 0x9A9F0BE5UL, 0x01C375C3UL, 0x4E941DD2UL,
+		0x9F6DA5E1UL, 0xD03ACDF0UL, 0x385FC830UL, 0x7708A021UL, 0xA6F11812UL, 0xE9A67003UL,
+		0x5CAC0BC6UL, 0x13FB63D7UL, 0xC202DBE4UL, 0x8D55B3F5UL, 0x6530B635UL, 0x2A67DE24UL,
+		0xFB9E6617UL, 0xB4C90E06UL, 0x2F957020UL, 0x60C21831UL, 0xB13BA002UL, 0xFE6CC813UL,
+		0x1609CDD3UL, 0x595EA5C2UL, 0x88A71DF1UL, 0xC7F075E0UL, 0xBADEFC0AUL, 0xF589941BUL,
+		0x24702C28UL, 0x6B274439UL, 0x834241F9UL, 0xCC1529E8UL, 0x1DEC91DBUL, 0x52BBF9CAUL,
+		0xC9E787ECUL, 0x86B0EFFDUL, 0x574957CEUL, 0x181E3FDFUL, 0xF07B3A1FUL, 0xBF2C520EUL,
+		0x6ED5EA3DUL, 0x2182822CUL, 0x2DD0EE65UL, 0x62878674UL, 0xB37E3E47UL, 0xFC295656UL,
+		0x144C5396UL, 0x5B1B3B87UL, 0x8AE283B4UL, 0xC5B5EBA5UL, 0x5EE99583UL, 0x11BEFD92UL,
+		0xC04745A1UL, 0x8F102DB0UL, 0x67752870UL, 0x28224061UL, 0xF9DBF852UL, 0xB68C9043UL,
+		0xCBA219A9UL, 0x84F571B8UL, 0x550CC98BUL, 0x1A5BA19AUL, 0xF23EA45AUL, 0xBD69CC4BUL,
+		0x6C907478UL, 0x23C71C69UL, 0xB89B624FUL, 0xF7CC0A5EUL, 0x2635B26DUL, 0x6962DA7CUL,
+		0x8107DFBCUL, 0xCE50B7ADUL, 0x1FA90F9EUL, 0x50FE678FUL, 0xE5F41C4AUL, 0xAAA3745BUL,
+		0x7B5ACC68UL, 0x340DA479UL, 0xDC68A1B9UL, 0x933FC9A8UL, 0x42C6719BUL, 0x0D91198AUL,
+		0x96CD67ACUL, 0xD99A0FBDUL, 0x0863B78EUL, 0x4734DF9FUL, 0xAF51DA5FUL, 0xE006B24EUL,
+		0x31FF0A7DUL, 0x7EA8626CUL, 0x0386EB86UL, 0x4CD18397UL, 0x9D283BA4UL, 0xD27F53B5UL,
+		0x3A1A5675UL, 0x754D3E64UL, 0xA4B48657UL, 0xEBE3EE46UL, 0x70BF9060UL, 0x3FE8F871UL,
+		0xEE114042UL, 0xA1462853UL, 0x49232D93UL, 0x06744582UL, 0xD78DFDB1UL, 0x98DA95A0UL,
+		0xB958178CUL, 0xF60F7F9DUL, 0x27F6C7AEUL, 0x68A1AFBFUL, 0x80C4AA7FUL, 0xCF93C26EUL,
+		0x1E6A7A5DUL, 0x513D124CUL, 0xCA616C6AUL, 0x8536047BUL, 0x54CFBC48UL, 0x1B98D459UL,
+		0xF3FDD199UL, 0xBCAAB988UL, 0x6D5301BBUL, 0x220469AAUL, 0x5F2AE040UL, 0x107D8851UL,
+		0xC1843062UL, 0x8ED35873UL, 0x66B65DB3UL, 0x29E135A2UL, 0xF8188D91UL, 0xB74FE580UL,
+		0x2C139BA6UL, 0x6344F3B7UL, 0xB2BD4B84UL, 0xFDEA2395UL, 0x158F2655UL, 0x5AD84E44UL,
+		0x8B21F677UL, 0xC4769E66UL, 0x717CE5A3UL, 0x3E2B8DB2UL, 0xEFD23581UL, 0xA0855D90UL,
+		0x48E05850UL, 0x07B73041UL, 0xD64E8872UL, 0x9919E063UL, 0x02459E45UL, 0x4D12F654UL,
+		0x9CEB4E67UL, 0xD3BC2676UL, 0x3BD923B6UL, 0x748E4BA7UL, 0xA577F394UL, 0xEA209B85UL,
+		0x970E126FUL, 0xD8597A7EUL, 0x09A0C24DUL, 0x46F7AA5CUL, 0xAE92AF9CUL, 0xE1C5C78DUL,
+		0x303C7FBEUL, 0x7F6B17AFUL, 0xE4376989UL, 0xAB600198UL, 0x7A99B9ABUL, 0x35CED1BAUL,
+		0xDDABD47AUL, 0x92FCBC6BUL, 0x43050458UL, 0x0C526C49UL
+	},
+	{
+		0x00000000UL, 0x5BA1DCCAUL, 0xB743B994UL, 0xECE2655EUL, 0x6A466E9FUL, 0x31E7B255UL,
+		0xDD05D70BUL, 0x86A40BC1UL, 0xD48CDD3EUL, 0x8F2D01F4UL, 0x63CF64AAUL, 0x386EB860UL,
+		0xBECAB3A1UL, 0xE56B6F6BUL, 0x09890A35UL, 0x5228D6FFUL, 0xADD8A7CBUL, 0xF6797B01UL,
+		0x1A9B1E5FUL, 0x413AC295UL, 0xC79EC954UL, 0x9C3F159EUL, 0x70DD70C0UL, 0x2B7CAC0AUL,
+		0x79547AF5UL, 0x22F5A63FUL, 0xCE17C361UL, 0x95B61FABUL, 0x1312146AUL, 0x48B3C8A0UL,
+		0xA451ADFEUL, 0xFFF07134UL, 0x5F705221UL, 0x04D18EEBUL, 0xE833EBB5UL, 0xB392377FUL,
+		0x35363CBEUL, 0x6E97E074UL, 0x8275852AUL, 0xD9D459E0UL, 0x8BFC8F1FUL, 0xD05D53D5UL,
+		0x3CBF368BUL, 0x671EEA41UL, 0xE1BAE180UL, 0xBA1B3D4AUL, 0x56F95814UL, 0x0D5884DEUL,
+		0xF2A8F5EAUL, 0xA9092920UL, 0x45EB4C7EUL, 0x1E4A90B4UL, 0x98EE9B75UL, 0xC34F47BFUL,
+		0x2FAD22E1UL, 0x740CFE2BUL, 0x262428D4UL, 0x7D85F41EUL, 0x91679140UL, 0xCAC64D8AUL,
+		0x4C62464BUL, 0x17C39A81UL, 0xFB21FFDFUL, 0xA0802315UL, 0xBEE0A442UL, 0xE5417888UL,
+		0x09A31DD6UL, 0x5202C11CUL, 0xD4A6CADDUL, 0x8F071617UL, 0x63E57349UL, 0x3844AF83UL,
+		0x6A6C797CUL, 0x31CDA5B6UL, 0xDD2FC0E8UL, 0x868E1C22UL, 0x002A17E3UL, 0x5B8BCB29UL,
+		0xB769AE77UL, 0xECC872BDUL, 0x13380389UL, 0x4899DF43UL, 0xA47BBA1DUL, 0xFFDA66D7UL,
+		0x797E6D16UL, 0x22DFB1DCUL, 0xCE3DD482UL, 0x959C0848UL, 0xC7B4DEB7UL, 0x9C15027DUL,
+		0x70F76723UL, 0x2B56BBE9UL, 0xADF2B028UL, 0xF6536CE2UL, 0x1AB109BCUL, 0x4110D576UL,
+		0xE190F663UL, 0xBA312AA9UL, 0x56D34FF7UL, 0x0D72933DUL, 0x8BD698FCUL, 0xD0774436UL,
+		0x3C952168UL, 0x6734FDA2UL, 0x351C2B5DUL, 0x6EBDF797UL, 0x825F92C9UL, 0xD9FE4E03UL,
+		0x5F5A45C2UL, 0x04FB9908UL, 0xE819FC56UL, 0xB3B8209CUL, 0x4C4851A8UL, 0x17E98D62UL,
+		0xFB0BE83CUL, 0xA0AA34F6UL, 0x260E3F37UL, 0x7DAFE3FDUL, 0x914D86A3UL, 0xCAEC5A69UL,
+		0x98C48C96UL, 0xC365505CUL, 0x2F873502UL, 0x7426E9C8UL, 0xF282E209UL, 0xA9233EC3UL,
+		0x45C15B9DUL, 0x1E608757UL, 0x79005533UL, 0x22A189F9UL, 0xCE43ECA7UL, 0x95E2306DUL,
+		0x13463BACUL, 0x48E7E766UL, 0xA4058238UL, 0xFFA45EF2UL, 0xAD8C880DUL, 0xF62D54C7UL,
+		0x1ACF3199UL, 0x416EED53UL, 0xC7CAE692UL, 0x9C6B3A58UL, 0x70895F06UL, 0x2B2883CCUL,
+		0xD4D8F2F8UL, 0x8F792E32UL, 0x639B4B6CUL, 0x383A97A6UL, 0xBE9E9C67UL, 0xE53F40ADUL,
+		0x09DD25F3UL, 0x527CF939UL, 0x00542FC6UL, 0x5BF5F30CUL, 0xB7179652UL, 0xECB64A98UL,
+		0x6A124159UL, 0x31B39D93UL, 0xDD51F8CDUL, 0x86F02407UL, 0x26700712UL, 0x7DD1DBD8UL,
+		0x9133BE86UL, 0xCA92624CUL, 0x4C36698DUL, 0x1797B547UL, 0xFB75D019UL, 0xA0D40CD3UL,
+		0xF2FCDA2CUL, 0xA95D06E6UL, 0x45BF63B8UL, 0x1E1EBF72UL, 0x98BAB4B3UL, 0xC31B6879UL,
+		0x2FF90D27UL, 0x7458D1EDUL, 0x8BA8A0D9UL, 0xD0097C13UL, 0x3CEB194DUL, 0x674AC587UL,
+		0xE1EECE46UL, 0xBA4F128CUL, 0x56AD77D2UL, 0x0D0CAB18UL, 0x5F247DE7UL, 0x0485A12DUL,
+		0xE867C473UL, 0xB3C618B9UL, 0x35621378UL, 0x6EC3CFB2UL, 0x8221AAECUL, 0xD9807626UL,
+		0xC7E0F171UL, 0x9C412DBBUL, 0x70A348E5UL, 0x2B02942FUL, 0xADA69FEEUL, 0xF6074324UL,
+		0x1AE5267AUL, 0x4144FAB0UL, 0x136C2C4FUL, 0x48CDF085UL, 0xA42F95DBUL, 0xFF8E4911UL,
+		0x792A42D0UL, 0x228B9E1AUL, 0xCE69FB44UL, 0x95C8278EUL, 0x6A3856BAUL, 0x31998A70UL,
+		0xDD7BEF2EUL, 0x86DA33E4UL, 0x007E3825UL, 0x5BDFE4EFUL, 0xB73D81B1UL, 0xEC9C5D7BUL,
+		0xBEB48B84UL, 0xE515574EUL, 0x09F73210UL, 0x5256EEDAUL, 0xD4F2E51BUL, 0x8F5339D1UL,
+		0x63B15C8FUL, 0x38108045UL, 0x9890A350UL, 0xC3317F9AUL, 0x2FD31AC4UL, 0x7472C60EUL,
+		0xF2D6CDCFUL, 0xA9771105UL, 0x4595745BUL, 0x1E34A891UL, 0x4C1C7E6EUL, 0x17BDA2A4UL,
+		0xFB5FC7FAUL, 0xA0FE1B30UL, 0x265A10F1UL, 0x7DFBCC3BUL, 0x9119A965UL, 0xCAB875AFUL,
+		0x3548049BUL, 0x6EE9D851UL, 0x820BBD0FUL, 0xD9AA61C5UL, 0x5F0E6A04UL, 0x04AFB6CEUL,
+		0xE84DD390UL, 0xB3EC0F5AUL, 0xE1C4D9A5UL, 0xBA65056FUL, 0x56876031UL, 0x0D26BCFBUL,
+		0x8B82B73AUL, 0xD0236BF0UL, 0x3CC10EAEUL, 0x6760D264UL
+	}
+};
+
+static const uint32_t crc_lsb_table[8][256] =
+{
+	{
+		0x00000000UL, 0x77073096UL, 0xEE0E612CUL, 0x990951BAUL, 0x076DC419UL, 0x706AF48FUL,
+		0xE963A535UL, 0x9E6495A3UL, 0x0EDB8832UL, 0x79DCB8A4UL, 0xE0D5E91EUL, 0x97D2D988UL,
+		0x09B64C2BUL, 0x7EB17CBDUL, 0xE7B82D07UL, 0x90BF1D91UL, 0x1DB71064UL, 0x6AB020F2UL,
+		0xF3B97148UL, 0x84BE41DEUL, 0x1ADAD47DUL, 0x6DDDE4EBUL, 0xF4D4B551UL, 0x83D385C7UL,
+		0x136C9856UL, 0x646BA8C0UL, 0xFD62F97AUL, 0x8A65C9ECUL, 0x14015C4FUL, 0x63066CD9UL,
+		0xFA0F3D63UL, 0x8D080DF5UL, 0x3B6E20C8UL, 0x4C69105EUL, 0xD56041E4UL, 0xA2677172UL,
+		0x3C03E4D1UL, 0x4B04D447UL, 0xD20D85FDUL, 0xA50AB56BUL, 0x35B5A8FAUL, 0x42B2986CUL,
+		0xDBBBC9D6UL, 0xACBCF940UL, 0x32D86CE3UL, 0x45DF5C75UL, 0xDCD60DCFUL, 0xABD13D59UL,
+		0x26D930ACUL, 0x51DE003AUL, 0xC8D75180UL, 0xBFD06116UL, 0x21B4F4B5UL, 0x56B3C423UL,
+		0xCFBA9599UL, 0xB8BDA50FUL, 0x2802B89EUL, 0x5F058808UL, 0xC60CD9B2UL, 0xB10BE924UL,
+		0x2F6F7C87UL, 0x58684C11UL, 0xC1611DABUL, 0xB6662D3DUL, 0x76DC4190UL, 0x01DB7106UL,
+		0x98D220BCUL, 0xEFD5102AUL, 0x71B18589UL, 0x06B6B51FUL, 0x9FBFE4A5UL, 0xE8B8D433UL,
+		0x7807C9A2UL, 0x0F00F934UL, 0x9609A88EUL, 0xE10E9818UL, 0x7F6A0DBBUL, 0x086D3D2DUL,
+		0x91646C97UL, 0xE6635C01UL, 0x6B6B51F4UL, 0x1C6C6162UL, 0x856530D8UL, 0xF262004EUL,
+		0x6C0695EDUL, 0x1B01A57BUL, 0x8208F4C1UL, 0xF50FC457UL, 0x65B0D9C6UL, 0x12B7E950UL,
+		0x8BBEB8EAUL, 0xFCB9887CUL, 0x62DD1DDFUL, 0x15DA2D49UL, 0x8CD37CF3UL, 0xFBD44C65UL,
+		0x4DB26158UL, 0x3AB551CEUL, 0xA3BC0074UL, 0xD4BB30E2UL, 0x4ADFA541UL, 0x3DD895D7UL,
+		0xA4D1C46DUL, 0xD3D6F4FBUL, 0x4369E96AUL, 0x346ED9FCUL, 0xAD678846UL, 0xDA60B8D0UL,
+		0x44042D73UL, 0x33031DE5UL, 0xAA0A4C5FUL, 0xDD0D7CC9UL, 0x5005713CUL, 0x270241AAUL,
+		0xBE0B1010UL, 0xC90C2086UL, 0x5768B525UL, 0x206F85B3UL, 0xB966D409UL, 0xCE61E49FUL,
+		0x5EDEF90EUL, 0x29D9C998UL, 0xB0D09822UL, 0xC7D7A8B4UL, 0x59B33D17UL, 0x2EB40D81UL,
+		0xB7BD5C3BUL, 0xC0BA6CADUL, 0xEDB88320UL, 0x9ABFB3B6UL, 0x03B6E20CUL, 0x74B1D29AUL,
+		0xEAD54739UL, 0x9DD277AFUL, 0x04DB2615UL, 0x73DC1683UL, 0xE3630B12UL, 0x94643B84UL,
+		0x0D6D6A3EUL, 0x7A6A5AA8UL, 0xE40ECF0BUL, 0x9309FF9DUL, 0x0A00AE27UL, 0x7D079EB1UL,
+		0xF00F9344UL, 0x8708A3D2UL, 0x1E01F268UL, 0x6906C2FEUL, 0xF762575DUL, 0x806567CBUL,
+		0x196C3671UL, 0x6E6B06E7UL, 0xFED41B76UL, 0x89D32BE0UL, 0x10DA7A5AUL, 0x67DD4ACCUL,
+		0xF9B9DF6FUL, 0x8EBEEFF9UL, 0x17B7BE43UL, 0x60B08ED5UL, 0xD6D6A3E8UL, 0xA1D1937EUL,
+		0x38D8C2C4UL, 0x4FDFF252UL, 0xD1BB67F1UL, 0xA6BC5767UL, 0x3FB506DDUL, 0x48B2364BUL,
+		0xD80D2BDAUL, 0xAF0A1B4CUL, 0x36034AF6UL, 0x41047A60UL, 0xDF60EFC3UL, 0xA867DF55UL,
+		0x316E8EEFUL, 0x4669BE79UL, 0xCB61B38CUL, 0xBC66831AUL, 0x256FD2A0UL, 0x5268E236UL,
+		0xCC0C7795UL, 0xBB0B4703UL, 0x220216B9UL, 0x5505262FUL, 0xC5BA3BBEUL, 0xB2BD0B28UL,
+		0x2BB45A92UL, 0x5CB36A04UL, 0xC2D7FFA7UL, 0xB5D0CF31UL, 0x2CD99E8BUL, 0x5BDEAE1DUL,
+		0x9B64C2B0UL, 0xEC63F226UL, 0x756AA39CUL, 0x026D930AUL, 0x9C0906A9UL, 0xEB0E363FUL,
+		0x72076785UL, 0x05005713UL, 0x95BF4A82UL, 0xE2B87A14UL, 0x7BB12BAEUL, 0x0CB61B38UL,
+		0x92D28E9BUL, 0xE5D5BE0DUL, 0x7CDCEFB7UL, 0x0BDBDF21UL, 0x86D3D2D4UL, 0xF1D4E242UL,
+		0x68DDB3F8UL, 0x1FDA836EUL, 0x81BE16CDUL, 0xF6B9265BUL, 0x6FB077E1UL, 0x18B74777UL,
+		0x88085AE6UL, 0xFF0F6A70UL, 0x66063BCAUL, 0x11010B5CUL, 0x8F659EFFUL, 0xF862AE69UL,
+		0x616BFFD3UL, 0x166CCF45UL, 0xA00AE278UL, 0xD70DD2EEUL, 0x4E048354UL, 0x3903B3C2UL,
+		0xA7672661UL, 0xD06016F7UL, 0x4969474DUL, 0x3E6E77DBUL, 0xAED16A4AUL, 0xD9D65ADCUL,
+		0x40DF0B66UL, 0x37D83BF0UL, 0xA9BCAE53UL, 0xDEBB9EC5UL, 0x47B2CF7FUL, 0x30B5FFE9UL,
+		0xBDBDF21CUL, 0xCABAC28AUL, 0x53B39330UL, 0x24B4A3A6UL, 0xBAD03605UL, 0xCDD70693UL,
+		0x54DE5729UL, 0x23D967BFUL, 0xB3667A2EUL, 0xC4614AB8UL, 0x5D681B02UL, 0x2A6F2B94UL,
+		0xB40BBE37UL, 0xC30C8EA1UL, 0x5A05DF1BUL, 0x2D02EF8DUL
+	},
+	{
+		0x00000000UL, 0x191B3141UL, 0x32366282UL, 0x2B2D53C3UL, 0x646CC504UL, 0x7D77F445UL,
+		0x565AA786UL, 0x4F4196C7UL, 0xC8D98A08UL, 0xD1C2BB49UL, 0xFAEFE88AUL, 0xE3F4D9CBUL,
+		0xACB54F0CUL, 0xB5AE7E4DUL, 0x9E832D8EUL, 0x87981CCFUL, 0x4AC21251UL, 0x53D92310UL,
+		0x78F470D3UL, 0x61EF4192UL, 0x2EAED755UL, 0x37B5E614UL, 0x1C98B5D7UL, 0x05838496UL,
+		0x821B9859UL, 0x9B00A918UL, 0xB02DFADBUL, 0xA936CB9AUL, 0xE6775D5DUL, 0xFF6C6C1CUL,
+		0xD4413FDFUL, 0xCD5A0E9EUL, 0x958424A2UL, 0x8C9F15E3UL, 0xA7B24620UL, 0xBEA97761UL,
+		0xF1E8E1A6UL, 0xE8F3D0E7UL, 0xC3DE8324UL, 0xDAC5B265UL, 0x5D5DAEAAUL, 0x44469FEBUL,
+		0x6F6BCC28UL, 0x7670FD69UL, 0x39316BAEUL, 0x202A5AEFUL, 0x0B07092CUL, 0x121C386DUL,
+		0xDF4636F3UL, 0xC65D07B2UL, 0xED705471UL, 0xF46B6530UL, 0xBB2AF3F7UL, 0xA231C2B6UL,
+		0x891C9175UL, 0x9007A034UL, 0x179FBCFBUL, 0x0E848DBAUL, 0x25A9DE79UL, 0x3CB2EF38UL,
+		0x73F379FFUL, 0x6AE848BEUL, 0x41C51B7DUL, 0x58DE2A3CUL, 0xF0794F05UL, 0xE9627E44UL,
+		0xC24F2D87UL, 0xDB541CC6UL, 0x94158A01UL, 0x8D0EBB40UL, 0xA623E883UL, 0xBF38D9C2UL,
+		0x38A0C50DUL, 0x21BBF44CUL, 0x0A96A78FUL, 0x138D96CEUL, 0x5CCC0009UL, 0x45D73148UL,
+		0x6EFA628BUL, 0x77E153CAUL, 0xBABB5D54UL, 0xA3A06C15UL, 0x888D3FD6UL, 0x91960E97UL,
+		0xDED79850UL, 0xC7CCA911UL, 0xECE1FAD2UL, 0xF5FACB93UL, 0x7262D75CUL, 0x6B79E61DUL,
+		0x4054B5DEUL, 0x594F849FUL, 0x160E1258UL, 0x0F152319UL, 0x243870DAUL, 0x3D23419BUL,
+		0x65FD6BA7UL, 0x7CE65AE6UL, 0x57CB0925UL, 0x4ED03864UL, 0x0191AEA3UL, 0x188A9FE2UL,
+		0x33A7CC21UL, 0x2ABCFD60UL, 0xAD24E1AFUL, 0xB43FD0EEUL, 0x9F12832DUL, 0x8609B26CUL,
+		0xC94824ABUL, 0xD05315EAUL, 0xFB7E4629UL, 0xE2657768UL, 0x2F3F79F6UL, 0x362448B7UL,
+		0x1D091B74UL, 0x04122A35UL, 0x4B53BCF2UL, 0x52488DB3UL, 0x7965DE70UL, 0x607EEF31UL,
+		0xE7E6F3FEUL, 0xFEFDC2BFUL, 0xD5D0917CUL, 0xCCCBA03DUL, 0x838A36FAUL, 0x9A9107BBUL,
+		0xB1BC5478UL, 0xA8A76539UL, 0x3B83984BUL, 0x2298A90AUL, 0x09B5FAC9UL, 0x10AECB88UL,
+		0x5FEF5D4FUL, 0x46F46C0EUL, 0x6DD93FCDUL, 0x74C20E8CUL, 0xF35A1243UL, 0xEA412302UL,
+		0xC16C70C1UL, 0xD8774180UL, 0x9736D747UL, 0x8E2DE606UL, 0xA500B5C5UL, 0xBC1B8484UL,
+		0x71418A1AUL, 0x685ABB5BUL, 0x4377E898UL, 0x5A6CD9D9UL, 0x152D4F1EUL, 0x0C367E5FUL,
+		0x271B2D9CUL, 0x3E001CDDUL, 0xB9980012UL, 0xA0833153UL, 0x8BAE6290UL, 0x92B553D1UL,
+		0xDDF4C516UL, 0xC4EFF457UL, 0xEFC2A794UL, 0xF6D996D5UL, 0xAE07BCE9UL, 0xB71C8DA8UL,
+		0x9C31DE6BUL, 0x852AEF2AUL, 0xCA6B79EDUL, 0xD37048ACUL, 0xF85D1B6FUL, 0xE1462A2EUL,
+		0x66DE36E1UL, 0x7FC507A0UL, 0x54E85463UL, 0x4DF36522UL, 0x02B2F3E5UL, 0x1BA9C2A4UL,
+		0x30849167UL, 0x299FA026UL, 0xE4C5AEB8UL, 0xFDDE9FF9UL, 0xD6F3CC3AUL, 0xCFE8FD7BUL,
+		0x80A96BBCUL, 0x99B25AFDUL, 0xB29F093EUL, 0xAB84387FUL, 0x2C1C24B0UL, 0x350715F1UL,
+		0x1E2A4632UL, 0x07317773UL, 0x4870E1B4UL, 0x516BD0F5UL, 0x7A468336UL, 0x635DB277UL,
+		0xCBFAD74EUL, 0xD2E1E60FUL, 0xF9CCB5CCUL, 0xE0D7848DUL, 0xAF96124AUL, 0xB68D230BUL,
+		0x9DA070C8UL, 0x84BB4189UL, 0x03235D46UL, 0x1A386C07UL, 0x31153FC4UL, 0x280E0E85UL,
+		0x674F9842UL, 0x7E54A903UL, 0x5579FAC0UL, 0x4C62CB81UL, 0x8138C51FUL, 0x9823F45EUL,
+		0xB30EA79DUL, 0xAA1596DCUL, 0xE554001BUL, 0xFC4F315AUL, 0xD7626299UL, 0xCE7953D8UL,
+		0x49E14F17UL, 0x50FA7E56UL, 0x7BD72D95UL, 0x62CC1CD4UL, 0x2D8D8A13UL, 0x3496BB52UL,
+		0x1FBBE891UL, 0x06A0D9D0UL, 0x5E7EF3ECUL, 0x4765C2ADUL, 0x6C48916EUL, 0x7553A02FUL,
+		0x3A1236E8UL, 0x230907A9UL, 0x0824546AUL, 0x113F652BUL, 0x96A779E4UL, 0x8FBC48A5UL,
+		0xA4911B66UL, 0xBD8A2A27UL, 0xF2CBBCE0UL, 0xEBD08DA1UL, 0xC0FDDE62UL, 0xD9E6EF23UL,
+		0x14BCE1BDUL, 0x0DA7D0FCUL, 0x268A833FUL, 0x3F91B27EUL, 0x70D024B9UL, 0x69CB15F8UL,
+		0x42E6463BUL, 0x5BFD777AUL, 0xDC656BB5UL, 0xC57E5AF4UL, 0xEE530937UL, 0xF7483876UL,
+		0xB809AEB1UL, 0xA1129FF0UL, 0x8A3FCC33UL, 0x9324FD72UL
+	},
+	{
+		0x00000000UL, 0x01C26A37UL, 0x0384D46EUL, 0x0246BE59UL, 0x0709A8DCUL, 0x06CBC2EBUL,
+		0x048D7CB2UL, 0x054F1685UL, 0x0E1351B8UL, 0x0FD13B8FUL, 0x0D9785D6UL, 0x0C55EFE1UL,
+		0x091AF964UL, 0x08D89353UL, 0x0A9E2D0AUL, 0x0B5C473DUL, 0x1C26A370UL, 0x1DE4C947UL,
+		0x1FA2771EUL, 0x1E601D29UL, 0x1B2F0BACUL, 0x1AED619BUL, 0x18ABDFC2UL, 0x1969B5F5UL,
+		0x1235F2C8UL, 0x13F798FFUL, 0x11B126A6UL, 0x10734C91UL, 0x153C5A14UL, 0x14FE3023UL,
+		0x16B88E7AUL, 0x177AE44DUL, 0x384D46E0UL, 0x398F2CD7UL, 0x3BC9928EUL, 0x3A0BF8B9UL,
+		0x3F44EE3CUL, 0x3E86840BUL, 0x3CC03A52UL, 0x3D025065UL, 0x365E1758UL, 0x379C7D6FUL,
+		0x35DAC336UL, 0x3418A901UL, 0x3157BF84UL, 0x3095D5B3UL, 0x32D36BEAUL, 0x331101DDUL,
+		0x246BE590UL, 0x25A98FA7UL, 0x27EF31FEUL, 0x262D5BC9UL, 0x23624D4CUL, 0x22A0277BUL,
+		0x20E69922UL, 0x2124F315UL, 0x2A78B428UL, 0x2BBADE1FUL, 0x29FC6046UL, 0x283E0A71UL,
+		0x2D711CF4UL, 0x2CB376C3UL, 0x2EF5C89AUL, 0x2F37A2ADUL, 0x709A8DC0UL, 0x7158E7F7UL,
+		0x731E59AEUL, 0x72DC3399UL, 0x7793251CUL, 0x76514F2BUL, 0x7417F172UL, 0x75D59B45UL,
+		0x7E89DC78UL, 0x7F4BB64FUL, 0x7D0D0816UL, 0x7CCF6221UL, 0x798074A4UL, 0x78421E93UL,
+		0x7A04A0CAUL, 0x7BC6CAFDUL, 0x6CBC2EB0UL, 0x6D7E4487UL, 0x6F38FADEUL, 0x6EFA90E9UL,
+		0x6BB5866CUL, 0x6A77EC5BUL, 0x68315202UL, 0x69F33835UL, 0x62AF7F08UL, 0x636D153FUL,
+		0x612BAB66UL, 0x60E9C151UL, 0x65A6D7D4UL, 0x6464BDE3UL, 0x662203BAUL, 0x67E0698DUL,
+		0x48D7CB20UL, 0x4915A117UL, 0x4B531F4EUL, 0x4A917579UL, 0x4FDE63FCUL, 0x4E1C09CBUL,
+		0x4C5AB792UL, 0x4D98DDA5UL, 0x46C49A98UL, 0x4706F0AFUL, 0x45404EF6UL, 0x448224C1UL,
+		0x41CD3244UL, 0x400F5873UL, 0x4249E62AUL, 0x438B8C1DUL, 0x54F16850UL, 0x55330267UL,
+		0x5775BC3EUL, 0x56B7D609UL, 0x53F8C08CUL, 0x523AAABBUL, 0x507C14E2UL, 0x51BE7ED5UL,
+		0x5AE239E8UL, 0x5B2053DFUL, 0x5966ED86UL, 0x58A487B1UL, 0x5DEB9134UL, 0x5C29FB03UL,
+		0x5E6F455AUL, 0x5FAD2F6DUL, 0xE1351B80UL, 0xE0F771B7UL, 0xE2B1CFEEUL, 0xE373A5D9UL,
+		0xE63CB35CUL, 0xE7FED96BUL, 0xE5B86732UL, 0xE47A0D05UL, 0xEF264A38UL, 0xEEE4200FUL,
+		0xECA29E56UL, 0xED60F461UL, 0xE82FE2E4UL, 0xE9ED88D3UL, 0xEBAB368AUL, 0xEA695CBDUL,
+		0xFD13B8F0UL, 0xFCD1D2C7UL, 0xFE976C9EUL, 0xFF5506A9UL, 0xFA1A102CUL, 0xFBD87A1BUL,
+		0xF99EC442UL, 0xF85CAE75UL, 0xF300E948UL, 0xF2C2837FUL, 0xF0843D26UL, 0xF1465711UL,
+		0xF4094194UL, 0xF5CB2BA3UL, 0xF78D95FAUL, 0xF64FFFCDUL, 0xD9785D60UL, 0xD8BA3757UL,
+		0xDAFC890EUL, 0xDB3EE339UL, 0xDE71F5BCUL, 0xDFB39F8BUL, 0xDDF521D2UL, 0xDC374BE5UL,
+		0xD76B0CD8UL, 0xD6A966EFUL, 0xD4EFD8B6UL, 0xD52DB281UL, 0xD062A404UL, 0xD1A0CE33UL,
+		0xD3E6706AUL, 0xD2241A5DUL, 0xC55EFE10UL, 0xC49C9427UL, 0xC6DA2A7EUL, 0xC7184049UL,
+		0xC25756CCUL, 0xC3953CFBUL, 0xC1D382A2UL, 0xC011E895UL, 0xCB4DAFA8UL, 0xCA8FC59FUL,
+		0xC8C97BC6UL, 0xC90B11F1UL, 0xCC440774UL, 0xCD866D43UL, 0xCFC0D31AUL, 0xCE02B92DUL,
+		0x91AF9640UL, 0x906DFC77UL, 0x922B422EUL, 0x93E92819UL, 0x96A63E9CUL, 0x976454ABUL,
+		0x9522EAF2UL, 0x94E080C5UL, 0x9FBCC7F8UL, 0x9E7EADCFUL, 0x9C381396UL, 0x9DFA79A1UL,
+		0x98B56F24UL, 0x99770513UL, 0x9B31BB4AUL, 0x9AF3D17DUL, 0x8D893530UL, 0x8C4B5F07UL,
+		0x8E0DE15EUL, 0x8FCF8B69UL, 0x8A809DECUL, 0x8B42F7DBUL, 0x89044982UL, 0x88C623B5UL,
+		0x839A6488UL, 0x82580EBFUL, 0x801EB0E6UL, 0x81DCDAD1UL, 0x8493CC54UL, 0x8551A663UL,
+		0x8717183AUL, 0x86D5720DUL, 0xA9E2D0A0UL, 0xA820BA97UL, 0xAA6604CEUL, 0xABA46EF9UL,
+		0xAEEB787CUL, 0xAF29124BUL, 0xAD6FAC12UL, 0xACADC625UL, 0xA7F18118UL, 0xA633EB2FUL,
+		0xA4755576UL, 0xA5B73F41UL, 0xA0F829C4UL, 0xA13A43F3UL, 0xA37CFDAAUL, 0xA2BE979DUL,
+		0xB5C473D0UL, 0xB40619E7UL, 0xB640A7BEUL, 0xB782CD89UL, 0xB2CDDB0CUL, 0xB30FB13BUL,
+		0xB1490F62UL, 0xB08B6555UL, 0xBBD72268UL, 0xBA15485FUL, 0xB853F606UL, 0xB9919C31UL,
+		0xBCDE8AB4UL, 0xBD1CE083UL, 0xBF5A5EDAUL, 0xBE9834EDUL
+	},
+	{
+		0x00000000UL, 0xB8BC6765UL, 0xAA09C88BUL, 0x12B5AFEEUL, 0x8F629757UL, 0x37DEF032UL,
+		0x256B5FDCUL, 0x9DD738B9UL, 0xC5B428EFUL, 0x7D084F8AUL, 0x6FBDE064UL, 0xD7018701UL,
+		0x4AD6BFB8UL, 0xF26AD8DDUL, 0xE0DF7733UL, 0x58631056UL, 0x5019579FUL, 0xE8A530FAUL,
+		0xFA109F14UL, 0x42ACF871UL, 0xDF7BC0C8UL, 0x67C7A7ADUL, 0x75720843UL, 0xCDCE6F26UL,
+		0x95AD7F70UL, 0x2D111815UL, 0x3FA4B7FBUL, 0x8718D09EUL, 0x1ACFE827UL, 0xA2738F42UL,
+		0xB0C620ACUL, 0x087A47C9UL, 0xA032AF3EUL, 0x188EC85BUL, 0x0A3B67B5UL, 0xB28700D0UL,
+		0x2F503869UL, 0x97EC5F0CUL, 0x8559F0E2UL, 0x3DE59787UL, 0x658687D1UL, 0xDD3AE0B4UL,
+		0xCF8F4F5AUL, 0x7733283FUL, 0xEAE41086UL, 0x525877E3UL, 0x40EDD80DUL, 0xF851BF68UL,
+		0xF02BF8A1UL, 0x48979FC4UL, 0x5A22302AUL, 0xE29E574FUL, 0x7F496FF6UL, 0xC7F50893UL,
+		0xD540A77DUL, 0x6DFCC018UL, 0x359FD04EUL, 0x8D23B72BUL, 0x9F9618C5UL, 0x272A7FA0UL,
+		0xBAFD4719UL, 0x0241207CUL, 0x10F48F92UL, 0xA848E8F7UL, 0x9B14583DUL, 0x23A83F58UL,
+		0x311D90B6UL, 0x89A1F7D3UL, 0x1476CF6AUL, 0xACCAA80FUL, 0xBE7F07E1UL, 0x06C36084UL,
+		0x5EA070D2UL, 0xE61C17B7UL, 0xF4A9B859UL, 0x4C15DF3CUL, 0xD1C2E785UL, 0x697E80E0UL,
+		0x7BCB2F0EUL, 0xC377486BUL, 0xCB0D0FA2UL, 0x73B168C7UL, 0x6104C729UL, 0xD9B8A04CUL,
+		0x446F98F5UL, 0xFCD3FF90UL, 0xEE66507EUL, 0x56DA371BUL, 0x0EB9274DUL, 0xB6054028UL,
+		0xA4B0EFC6UL, 0x1C0C88A3UL, 0x81DBB01AUL, 0x3967D77FUL, 0x2BD27891UL, 0x936E1FF4UL,
+		0x3B26F703UL, 0x839A9066UL, 0x912F3F88UL, 0x299358EDUL, 0xB4446054UL, 0x0CF80731UL,
+		0x1E4DA8DFUL, 0xA6F1CFBAUL, 0xFE92DFECUL, 0x462EB889UL, 0x549B1767UL, 0xEC277002UL,
+		0x71F048BBUL, 0xC94C2FDEUL, 0xDBF98030UL, 0x6345E755UL, 0x6B3FA09CUL, 0xD383C7F9UL,
+		0xC1366817UL, 0x798A0F72UL, 0xE45D37CBUL, 0x5CE150AEUL, 0x4E54FF40UL, 0xF6E89825UL,
+		0xAE8B8873UL, 0x1637EF16UL, 0x048240F8UL, 0xBC3E279DUL, 0x21E91F24UL, 0x99557841UL,
+		0x8BE0D7AFUL, 0x335CB0CAUL, 0xED59B63BUL, 0x55E5D15EUL, 0x47507EB0UL, 0xFFEC19D5UL,
+		0x623B216CUL, 0xDA874609UL, 0xC832E9E7UL, 0x708E8E82UL, 0x28ED9ED4UL, 0x9051F9B1UL,
+		0x82E4565FUL, 0x3A58313AUL, 0xA78F0983UL, 0x1F336EE6UL, 0x0D86C108UL, 0xB53AA66DUL,
+		0xBD40E1A4UL, 0x05FC86C1UL, 0x1749292FUL, 0xAFF54E4AUL, 0x322276F3UL, 0x8A9E1196UL,
+		0x982BBE78UL, 0x2097D91DUL, 0x78F4C94BUL, 0xC048AE2EUL, 0xD2FD01C0UL, 0x6A4166A5UL,
+		0xF7965E1CUL, 0x4F2A3979UL, 0x5D9F9697UL, 0xE523F1F2UL, 0x4D6B1905UL, 0xF5D77E60UL,
+		0xE762D18EUL, 0x5FDEB6EBUL, 0xC2098E52UL, 0x7AB5E937UL, 0x680046D9UL, 0xD0BC21BCUL,
+		0x88DF31EAUL, 0x3063568FUL, 0x22D6F961UL, 0x9A6A9E04UL, 0x07BDA6BDUL, 0xBF01C1D8UL,
+		0xADB46E36UL, 0x15080953UL, 0x1D724E9AUL, 0xA5CE29FFUL, 0xB77B8611UL, 0x0FC7E174UL,
+		0x9210D9CDUL, 0x2AACBEA8UL, 0x38191146UL, 0x80A57623UL, 0xD8C66675UL, 0x607A0110UL,
+		0x72CFAEFEUL, 0xCA73C99BUL, 0x57A4F122UL, 0xEF189647UL, 0xFDAD39A9UL, 0x45115ECCUL,
+		0x764DEE06UL, 0xCEF18963UL, 0xDC44268DUL, 0x64F841E8UL, 0xF92F7951UL, 0x41931E34UL,
+		0x5326B1DAUL, 0xEB9AD6BFUL, 0xB3F9C6E9UL, 0x0B45A18CUL, 0x19F00E62UL, 0xA14C6907UL,
+		0x3C9B51BEUL, 0x842736DBUL, 0x96929935UL, 0x2E2EFE50UL, 0x2654B999UL, 0x9EE8DEFCUL,
+		0x8C5D7112UL, 0x34E11677UL, 0xA9362ECEUL, 0x118A49ABUL, 0x033FE645UL, 0xBB838120UL,
+		0xE3E09176UL, 0x5B5CF613UL, 0x49E959FDUL, 0xF1553E98UL, 0x6C820621UL, 0xD43E6144UL,
+		0xC68BCEAAUL, 0x7E37A9CFUL, 0xD67F4138UL, 0x6EC3265DUL, 0x7C7689B3UL, 0xC4CAEED6UL,
+		0x591DD66FUL, 0xE1A1B10AUL, 0xF3141EE4UL, 0x4BA87981UL, 0x13CB69D7UL, 0xAB770EB2UL,
+		0xB9C2A15CUL, 0x017EC639UL, 0x9CA9FE80UL, 0x241599E5UL, 0x36A0360BUL, 0x8E1C516EUL,
+		0x866616A7UL, 0x3EDA71C2UL, 0x2C6FDE2CUL, 0x94D3B949UL, 0x090481F0UL, 0xB1B8E695UL,
+		0xA30D497BUL, 0x1BB12E1EUL, 0x43D23E48UL, 0xFB6E592DUL, 0xE9DBF6C3UL, 0x516791A6UL,
+		0xCCB0A91FUL, 0x740CCE7AUL, 0x66B96194UL, 0xDE0506F1UL
+	},
+	{
+		0x00000000UL, 0x3D6029B0UL, 0x7AC05360UL, 0x47A07AD0UL, 0xF580A6C0UL, 0xC8E08F70UL,
+		0x8F40F5A0UL, 0xB220DC10UL, 0x30704BC1UL, 0x0D106271UL, 0x4AB018A1UL, 0x77D03111UL,
+		0xC5F0ED01UL, 0xF890C4B1UL, 0xBF30BE61UL, 0x825097D1UL, 0x60E09782UL, 0x5D80BE32UL,
+		0x1A20C4E2UL, 0x2740ED52UL, 0x95603142UL, 0xA80018F2UL, 0xEFA06222UL, 0xD2C04B92UL,
+		0x5090DC43UL, 0x6DF0F5F3UL, 0x2A508F23UL, 0x1730A693UL, 0xA5107A83UL, 0x98705333UL,
+		0xDFD029E3UL, 0xE2B00053UL, 0xC1C12F04UL, 0xFCA106B4UL, 0xBB017C64UL, 0x866155D4UL,
+		0x344189C4UL, 0x0921A074UL, 0x4E81DAA4UL, 0x73E1F314UL, 0xF1B164C5UL, 0xCCD14D75UL,
+		0x8B7137A5UL, 0xB6111E15UL, 0x0431C205UL, 0x3951EBB5UL, 0x7EF19165UL, 0x4391B8D5UL,
+		0xA121B886UL, 0x9C419136UL, 0xDBE1EBE6UL, 0xE681C256UL, 0x54A11E46UL, 0x69C137F6UL,
+		0x2E614D26UL, 0x13016496UL, 0x9151F347UL, 0xAC31DAF7UL, 0xEB91A027UL, 0xD6F18997UL,
+		0x64D15587UL, 0x59B17C37UL, 0x1E1106E7UL, 0x23712F57UL, 0x58F35849UL, 0x659371F9UL,
+		0x22330B29UL, 0x1F532299UL, 0xAD73FE89UL, 0x9013D739UL, 0xD7B3ADE9UL, 0xEAD38459UL,
+		0x68831388UL, 0x55E33A38UL, 0x124340E8UL, 0x2F236958UL, 0x9D03B548UL, 0xA0639CF8UL,
+		0xE7C3E628UL, 0xDAA3CF98UL, 0x3813CFCBUL, 0x0573E67BUL, 0x42D39CABUL, 0x7FB3B51BUL,
+		0xCD93690BUL, 0xF0F340BBUL, 0xB7533A6BUL, 0x8A3313DBUL, 0x0863840AUL, 0x3503ADBAUL,
+		0x72A3D76AUL, 0x4FC3FEDAUL, 0xFDE322CAUL, 0xC0830B7AUL, 0x872371AAUL, 0xBA43581AUL,
+		0x9932774DUL, 0xA4525EFDUL, 0xE3F2242DUL, 0xDE920D9DUL, 0x6CB2D18DUL, 0x51D2F83DUL,
+		0x167282EDUL, 0x2B12AB5DUL, 0xA9423C8CUL, 0x9422153CUL, 0xD3826FECUL, 0xEEE2465CUL,
+		0x5CC29A4CUL, 0x61A2B3FCUL, 0x2602C92CUL, 0x1B62E09CUL, 0xF9D2E0CFUL, 0xC4B2C97FUL,
+		0x8312B3AFUL, 0xBE729A1FUL, 0x0C52460FUL, 0x31326FBFUL, 0x7692156FUL, 0x4BF23CDFUL,
+		0xC9A2AB0EUL, 0xF4C282BEUL, 0xB362F86EUL, 0x8E02D1DEUL, 0x3C220DCEUL, 0x0142247EUL,
+		0x46E25EAEUL, 0x7B82771EUL, 0xB1E6B092UL, 0x8C869922UL, 0xCB26E3F2UL, 0xF646CA42UL,
+		0x44661652UL, 0x79063FE2UL, 0x3EA64532UL, 0x03C66C82UL, 0x8196FB53UL, 0xBCF6D2E3UL,
+		0xFB56A833UL, 0xC6368183UL, 0x74165D93UL, 0x49767423UL, 0x0ED60EF3UL, 0x33B62743UL,
+		0xD1062710UL, 0xEC660EA0UL, 0xABC67470UL, 0x96A65DC0UL, 0x248681D0UL, 0x19E6A860UL,
+		0x5E46D2B0UL, 0x6326FB00UL, 0xE1766CD1UL, 0xDC164561UL, 0x9BB63FB1UL, 0xA6D61601UL,
+		0x14F6CA11UL, 0x2996E3A1UL, 0x6E369971UL, 0x5356B0C1UL, 0x70279F96UL, 0x4D47B626UL,
+		0x0AE7CCF6UL, 0x3787E546UL, 0x85A73956UL, 0xB8C710E6UL, 0xFF676A36UL, 0xC2074386UL,
+		0x4057D457UL, 0x7D37FDE7UL, 0x3A978737UL, 0x07F7AE87UL, 0xB5D77297UL, 0x88B75B27UL,
+		0xCF1721F7UL, 0xF2770847UL, 0x10C70814UL, 0x2DA721A4UL, 0x6A075B74UL, 0x576772C4UL,
+		0xE547AED4UL, 0xD8278764UL, 0x9F87FDB4UL, 0xA2E7D404UL, 0x20B743D5UL, 0x1DD76A65UL,
+		0x5A7710B5UL, 0x67173905UL, 0xD537E515UL, 0xE857CCA5UL, 0xAFF7B675UL, 0x92979FC5UL,
+		0xE915E8DBUL, 0xD475C16BUL, 0x93D5BBBBUL, 0xAEB5920BUL, 0x1C954E1BUL, 0x21F567ABUL,
+		0x66551D7BUL, 0x5B3534CBUL, 0xD965A31AUL, 0xE4058AAAUL, 0xA3A5F07AUL, 0x9EC5D9CAUL,
+		0x2CE505DAUL, 0x11852C6AUL, 0x562556BAUL, 0x6B457F0AUL, 0x89F57F59UL, 0xB49556E9UL,
+		0xF3352C39UL, 0xCE550589UL, 0x7C75D999UL, 0x4115F029UL, 0x06B58AF9UL, 0x3BD5A349UL,
+		0xB9853498UL, 0x84E51D28UL, 0xC34567F8UL, 0xFE254E48UL, 0x4C059258UL, 0x7165BBE8UL,
+		0x36C5C138UL, 0x0BA5E888UL, 0x28D4C7DFUL, 0x15B4EE6FUL, 0x521494BFUL, 0x6F74BD0FUL,
+		0xDD54611FUL, 0xE03448AFUL, 0xA794327FUL, 0x9AF41BCFUL, 0x18A48C1EUL, 0x25C4A5AEUL,
+		0x6264DF7EUL, 0x5F04F6CEUL, 0xED242ADEUL, 0xD044036EUL, 0x97E479BEUL, 0xAA84500EUL,
+		0x4834505DUL, 0x755479EDUL, 0x32F4033DUL, 0x0F942A8DUL, 0xBDB4F69DUL, 0x80D4DF2DUL,
+		0xC774A5FDUL, 0xFA148C4DUL, 0x78441B9CUL, 0x4524322CUL, 0x028448FCUL, 0x3FE4614CUL,
+		0x8DC4BD5CUL, 0xB0A494ECUL, 0xF704EE3CUL, 0xCA64C78CUL
+	},
+	{
+		0x00000000UL, 0xCB5CD3A5UL, 0x4DC8A10BUL, 0x869472AEUL, 0x9B914216UL, 0x50CD91B3UL,
+		0xD659E31DUL, 0x1D0530B8UL, 0xEC53826DUL, 0x270F51C8UL, 0xA19B2366UL, 0x6AC7F0C3UL,
+		0x77C2C07BUL, 0xBC9E13DEUL, 0x3A0A6170UL, 0xF156B2D5UL, 0x03D6029BUL, 0xC88AD13EUL,
+		0x4E1EA390UL, 0x85427035UL, 0x9847408DUL, 0x531B9328UL, 0xD58FE186UL, 0x1ED33223UL,
+		0xEF8580F6UL, 0x24D95353UL, 0xA24D21FDUL, 0x6911F258UL, 0x7414C2E0UL, 0xBF481145UL,
+		0x39DC63EBUL, 0xF280B04EUL, 0x07AC0536UL, 0xCCF0D693UL, 0x4A64A43DUL, 0x81387798UL,
+		0x9C3D4720UL, 0x57619485UL, 0xD1F5E62BUL, 0x1AA9358EUL, 0xEBFF875BUL, 0x20A354FEUL,
+		0xA6372650UL, 0x6D6BF5F5UL, 0x706EC54DUL, 0xBB3216E8UL, 0x3DA66446UL, 0xF6FAB7E3UL,
+		0x047A07ADUL, 0xCF26D408UL, 0x49B2A6A6UL, 0x82EE7503UL, 0x9FEB45BBUL, 0x54B7961EUL,
+		0xD223E4B0UL, 0x197F3715UL, 0xE82985C0UL, 0x23755665UL, 0xA5E124CBUL, 0x6EBDF76EUL,
+		0x73B8C7D6UL, 0xB8E41473UL, 0x3E7066DDUL, 0xF52CB578UL, 0x0F580A6CUL, 0xC404D9C9UL,
+		0x4290AB67UL, 0x89CC78C2UL, 0x94C9487AUL, 0x5F959BDFUL, 0xD901E971UL, 0x125D3AD4UL,
+		0xE30B8801UL, 0x28575BA4UL, 0xAEC3290AUL, 0x659FFAAFUL, 0x789ACA17UL, 0xB3C619B2UL,
+		0x35526B1CUL, 0xFE0EB8B9UL, 0x0C8E08F7UL, 0xC7D2DB52UL, 0x4146A9FCUL, 0x8A1A7A59UL,
+		0x971F4AE1UL, 0x5C439944UL, 0xDAD7EBEAUL, 0x118B384FUL, 0xE0DD8A9AUL, 0x2B81593FUL,
+		0xAD152B91UL, 0x6649F834UL, 0x7B4CC88CUL, 0xB0101B29UL, 0x36846987UL, 0xFDD8BA22UL,
+		0x08F40F5AUL, 0xC3A8DCFFUL, 0x453CAE51UL, 0x8E607DF4UL, 0x93654D4CUL, 0x58399EE9UL,
+		0xDEADEC47UL, 0x15F13FE2UL, 0xE4A78D37UL, 0x2FFB5E92UL, 0xA96F2C3CUL, 0x6233FF99UL,
+		0x7F36CF21UL, 0xB46A1C84UL, 0x32FE6E2AUL, 0xF9A2BD8FUL, 0x0B220DC1UL, 0xC07EDE64UL,
+		0x46EAACCAUL, 0x8DB67F6FUL, 0x90B34FD7UL, 0x5BEF9C72UL, 0xDD7BEEDCUL, 0x16273D79UL,
+		0xE7718FACUL, 0x2C2D5C09UL, 0xAAB92EA7UL, 0x61E5FD02UL, 0x7CE0CDBAUL, 0xB7BC1E1FUL,
+		0x31286CB1UL, 0xFA74BF14UL, 0x1EB014D8UL, 0xD5ECC77DUL, 0x5378B5D3UL, 0x98246676UL,
+		0x852156CEUL, 0x4E7D856BUL, 0xC8E9F7C5UL, 0x03B52460UL, 0xF2E396B5UL, 0x39BF4510UL,
+		0xBF2B37BEUL, 0x7477E41BUL, 0x6972D4A3UL, 0xA22E0706UL, 0x24BA75A8UL, 0xEFE6A60DUL,
+		0x1D661643UL, 0xD63AC5E6UL, 0x50AEB748UL, 0x9BF264EDUL, 0x86F75455UL, 0x4DAB87F0UL,
+		0xCB3FF55EUL, 0x006326FBUL, 0xF135942EUL, 0x3A69478BUL, 0xBCFD3525UL, 0x77A1E680UL,
+		0x6AA4D638UL, 0xA1F8059DUL, 0x276C7733UL, 0xEC30A496UL, 0x191C11EEUL, 0xD240C24BUL,
+		0x54D4B0E5UL, 0x9F886340UL, 0x828D53F8UL, 0x49D1805DUL, 0xCF45F2F3UL, 0x04192156UL,
+		0xF54F9383UL, 0x3E134026UL, 0xB8873288UL, 0x73DBE12DUL, 0x6EDED195UL, 0xA5820230UL,
+		0x2316709EUL, 0xE84AA33BUL, 0x1ACA1375UL, 0xD196C0D0UL, 0x5702B27EUL, 0x9C5E61DBUL,
+		0x815B5163UL, 0x4A0782C6UL, 0xCC93F068UL, 0x07CF23CDUL, 0xF6999118UL, 0x3DC542BDUL,
+		0xBB513013UL, 0x700DE3B6UL, 0x6D08D30EUL, 0xA65400ABUL, 0x20C07205UL, 0xEB9CA1A0UL,
+		0x11E81EB4UL, 0xDAB4CD11UL, 0x5C20BFBFUL, 0x977C6C1AUL, 0x8A795CA2UL, 0x41258F07UL,
+		0xC7B1FDA9UL, 0x0CED2E0CUL, 0xFDBB9CD9UL, 0x36E74F7CUL, 0xB0733DD2UL, 0x7B2FEE77UL,
+		0x662ADECFUL, 0xAD760D6AUL, 0x2BE27FC4UL, 0xE0BEAC61UL, 0x123E1C2FUL, 0xD962CF8AUL,
+		0x5FF6BD24UL, 0x94AA6E81UL, 0x89AF5E39UL, 0x42F38D9CUL, 0xC467FF32UL, 0x0F3B2C97UL,
+		0xFE6D9E42UL, 0x35314DE7UL, 0xB3A53F49UL, 0x78F9ECECUL, 0x65FCDC54UL, 0xAEA00FF1UL,
+		0x28347D5FUL, 0xE368AEFAUL, 0x16441B82UL, 0xDD18C827UL, 0x5B8CBA89UL, 0x90D0692CUL,
+		0x8DD55994UL, 0x46898A31UL, 0xC01DF89FUL, 0x0B412B3AUL, 0xFA1799EFUL, 0x314B4A4AUL,
+		0xB7DF38E4UL, 0x7C83EB41UL, 0x6186DBF9UL, 0xAADA085CUL, 0x2C4E7AF2UL, 0xE712A957UL,
+		0x15921919UL, 0xDECECABCUL, 0x585AB812UL, 0x93066BB7UL, 0x8E035B0FUL, 0x455F88AAUL,
+		0xC3CBFA04UL, 0x089729A1UL, 0xF9C19B74UL, 0x329D48D1UL, 0xB4093A7FUL, 0x7F55E9DAUL,
+		0x6250D962UL, 0xA90C0AC7UL, 0x2F987869UL, 0xE4C4ABCCUL
+	},
+	{
+		0x00000000UL, 0xA6770BB4UL, 0x979F1129UL, 0x31E81A9DUL, 0xF44F2413UL, 0x52382FA7UL,
+		0x63D0353AUL, 0xC5A73E8EUL, 0x33EF4E67UL, 0x959845D3UL, 0xA4705F4EUL, 0x020754FAUL,
+		0xC7A06A74UL, 0x61D761C0UL, 0x503F7B5DUL, 0xF64870E9UL, 0x67DE9CCEUL, 0xC1A9977AUL,
+		0xF0418DE7UL, 0x56368653UL, 0x9391B8DDUL, 0x35E6B369UL, 0x040EA9F4UL, 0xA279A240UL,
+		0x5431D2A9UL, 0xF246D91DUL, 0xC3AEC380UL, 0x65D9C834UL, 0xA07EF6BAUL, 0x0609FD0EUL,
+		0x37E1E793UL, 0x9196EC27UL, 0xCFBD399CUL, 0x69CA3228UL, 0x582228B5UL, 0xFE552301UL,
+		0x3BF21D8FUL, 0x9D85163BUL, 0xAC6D0CA6UL, 0x0A1A0712UL, 0xFC5277FBUL, 0x5A257C4FUL,
+		0x6BCD66D2UL, 0xCDBA6D66UL, 0x081D53E8UL, 0xAE6A585CUL, 0x9F8242C1UL, 0x39F54975UL,
+		0xA863A552UL, 0x0E14AEE6UL, 0x3FFCB47BUL, 0x998BBFCFUL, 0x5C2C8141UL, 0xFA5B8AF5UL,
+		0xCBB39068UL, 0x6DC49BDCUL, 0x9B8CEB35UL, 0x3DFBE081UL, 0x0C13FA1CUL, 0xAA64F1A8UL,
+		0x6FC3CF26UL, 0xC9B4C492UL, 0xF85CDE0FUL, 0x5E2BD5BBUL, 0x440B7579UL, 0xE27C7ECDUL,
+		0xD3946450UL, 0x75E36FE4UL, 0xB044516AUL, 0x16335ADEUL, 0x27DB4043UL, 0x81AC4BF7UL,
+		0x77E43B1EUL, 0xD19330AAUL, 0xE07B2A37UL, 0x460C2183UL, 0x83AB1F0DUL, 0x25DC14B9UL,
+		0x14340E24UL, 0xB2430590UL, 0x23D5E9B7UL, 0x85A2E203UL, 0xB44AF89EUL, 0x123DF32AUL,
+		0xD79ACDA4UL, 0x71EDC610UL, 0x4005DC8DUL, 0xE672D739UL, 0x103AA7D0UL, 0xB64DAC64UL,
+		0x87A5B6F9UL, 0x21D2BD4DUL, 0xE47583C3UL, 0x42028877UL, 0x73EA92EAUL, 0xD59D995EUL,
+		0x8BB64CE5UL, 0x2DC14751UL, 0x1C295DCCUL, 0xBA5E5678UL, 0x7FF968F6UL, 0xD98E6342UL,
+		0xE86679DFUL, 0x4E11726BUL, 0xB8590282UL, 0x1E2E0936UL, 0x2FC613ABUL, 0x89B1181FUL,
+		0x4C162691UL, 0xEA612D25UL, 0xDB8937B8UL, 0x7DFE3C0CUL, 0xEC68D02BUL, 0x4A1FDB9FUL,
+		0x7BF7C102UL, 0xDD80CAB6UL, 0x1827F438UL, 0xBE50FF8CUL, 0x8FB8E511UL, 0x29CFEEA5UL,
+		0xDF879E4CUL, 0x79F095F8UL, 0x48188F65UL, 0xEE6F84D1UL, 0x2BC8BA5FUL, 0x8DBFB1EBUL,
+		0xBC57AB76UL, 0x1A20A0C2UL, 0x8816EAF2UL, 0x2E61E146UL, 0x1F89FBDBUL, 0xB9FEF06FUL,
+		0x7C59CEE1UL, 0xDA2EC555UL, 0xEBC6DFC8UL, 0x4DB1D47CUL, 0xBBF9A495UL, 0x1D8EAF21UL,
+		0x2C66B5BCUL, 0x8A11BE08UL, 0x4FB68086UL, 0xE9C18B32UL, 0xD82991AFUL, 0x7E5E9A1BUL,
+		0xEFC8763CUL, 0x49BF7D88UL, 0x78576715UL, 0xDE206CA1UL, 0x1B87522FUL, 0xBDF0599BUL,
+		0x8C184306UL, 0x2A6F48B2UL, 0xDC27385BUL, 0x7A5033EFUL, 0x4BB82972UL, 0xEDCF22C6UL,
+		0x28681C48UL, 0x8E1F17FCUL, 0xBFF70D61UL, 0x198006D5UL, 0x47ABD36EUL, 0xE1DCD8DAUL,
+		0xD034C247UL, 0x7643C9F3UL, 0xB3E4F77DUL, 0x1593FCC9UL, 0x247BE654UL, 0x820CEDE0UL,
+		0x74449D09UL, 0xD23396BDUL, 0xE3DB8C20UL, 0x45AC8794UL, 0x800BB91AUL, 0x267CB2AEUL,
+		0x1794A833UL, 0xB1E3A387UL, 0x20754FA0UL, 0x86024414UL, 0xB7EA5E89UL, 0x119D553DUL,
+		0xD43A6BB3UL, 0x724D6007UL, 0x43A57A9AUL, 0xE5D2712EUL, 0x139A01C7UL, 0xB5ED0A73UL,
+		0x840510EEUL, 0x22721B5AUL, 0xE7D525D4UL, 0x41A22E60UL, 0x704A34FDUL, 0xD63D3F49UL,
+		0xCC1D9F8BUL, 0x6A6A943FUL, 0x5B828EA2UL, 0xFDF58516UL, 0x3852BB98UL, 0x9E25B02CUL,
+		0xAFCDAAB1UL, 0x09BAA105UL, 0xFFF2D1ECUL, 0x5985DA58UL, 0x686DC0C5UL, 0xCE1ACB71UL,
+		0x0BBDF5FFUL, 0xADCAFE4BUL, 0x9C22E4D6UL, 0x3A55EF62UL, 0xABC30345UL, 0x0DB408F1UL,
+		0x3C5C126CUL, 0x9A2B19D8UL, 0x5F8C2756UL, 0xF9FB2CE2UL, 0xC813367FUL, 0x6E643DCBUL,
+		0x982C4D22UL, 0x3E5B4696UL, 0x0FB35C0BUL, 0xA9C457BFUL, 0x6C636931UL, 0xCA146285UL,
+		0xFBFC7818UL, 0x5D8B73ACUL, 0x03A0A617UL, 0xA5D7ADA3UL, 0x943FB73EUL, 0x3248BC8AUL,
+		0xF7EF8204UL, 0x519889B0UL, 0x6070932DUL, 0xC6079899UL, 0x304FE870UL, 0x9638E3C4UL,
+		0xA7D0F959UL, 0x01A7F2EDUL, 0xC400CC63UL, 0x6277C7D7UL, 0x539FDD4AUL, 0xF5E8D6FEUL,
+		0x647E3AD9UL, 0xC209316DUL, 0xF3E12BF0UL, 0x55962044UL, 0x90311ECAUL, 0x3646157EUL,
+		0x07AE0FE3UL, 0xA1D90457UL, 0x579174BEUL, 0xF1E67F0AUL, 0xC00E6597UL, 0x66796E23UL,
+		0xA3DE50ADUL, 0x05A95B19UL, 0x34414184UL, 0x92364A30UL
+	},
+	{
+		0x00000000UL, 0xCCAA009EUL, 0x4225077DUL, 0x8E8F07E3UL, 0x844A0EFAUL, 0x48E00E64UL,
+		0xC66F0987UL, 0x0AC50919UL, 0xD3E51BB5UL, 0x1F4F1B2BUL, 0x91C01CC8UL, 0x5D6A1C56UL,
+		0x57AF154FUL, 0x9B0515D1UL, 0x158A1232UL, 0xD92012ACUL, 0x7CBB312BUL, 0xB01131B5UL,
+		0x3E9E3656UL, 0xF23436C8UL, 0xF8F13FD1UL, 0x345B3F4FUL, 0xBAD438ACUL, 0x767E3832UL,
+		0xAF5E2A9EUL, 0x63F42A00UL, 0xED7B2DE3UL, 0x21D12D7DUL, 0x2B142464UL, 0xE7BE24FAUL,
+		0x69312319UL, 0xA59B2387UL, 0xF9766256UL, 0x35DC62C8UL, 0xBB53652BUL, 0x77F965B5UL,
+		0x7D3C6CACUL, 0xB1966C32UL, 0x3F196BD1UL, 0xF3B36B4FUL, 0x2A9379E3UL, 0xE639797DUL,
+		0x68B67E9EUL, 0xA41C7E00UL, 0xAED97719UL, 0x62737787UL, 0xECFC7064UL, 0x205670FAUL,
+		0x85CD537DUL, 0x496753E3UL, 0xC7E85400UL, 0x0B42549EUL, 0x01875D87UL, 0xCD2D5D19UL,
+		0x43A25AFAUL, 0x8F085A64UL, 0x562848C8UL, 0x9A824856UL, 0x140D4FB5UL, 0xD8A74F2BUL,
+		0xD2624632UL, 0x1EC846ACUL, 0x9047414FUL, 0x5CED41D1UL, 0x299DC2EDUL, 0xE537C273UL,
+		0x6BB8C590UL, 0xA712C50EUL, 0xADD7CC17UL, 0x617DCC89UL, 0xEFF2CB6AUL, 0x2358CBF4UL,
+		0xFA78D958UL, 0x36D2D9C6UL, 0xB85DDE25UL, 0x74F7DEBBUL, 0x7E32D7A2UL, 0xB298D73CUL,
+		0x3C17D0DFUL, 0xF0BDD041UL, 0x5526F3C6UL, 0x998CF358UL, 0x1703F4BBUL, 0xDBA9F425UL,
+		0xD16CFD3CUL, 0x1DC6FDA2UL, 0x9349FA41UL, 0x5FE3FADFUL, 0x86C3E873UL, 0x4A69E8EDUL,
+		0xC4E6EF0EUL, 0x084CEF90UL, 0x0289E689UL, 0xCE23E617UL, 0x40ACE1F4UL, 0x8C06E16AUL,
+		0xD0EBA0BBUL, 0x1C41A025UL, 0x92CEA7C6UL, 0x5E64A758UL, 0x54A1AE41UL, 0x980BAEDFUL,
+		0x1684A93CUL, 0xDA2EA9A2UL, 0x030EBB0EUL, 0xCFA4BB90UL, 0x412BBC73UL, 0x8D81BCEDUL,
+		0x8744B5F4UL, 0x4BEEB56AUL, 0xC561B289UL, 0x09CBB217UL, 0xAC509190UL, 0x60FA910EUL,
+		0xEE7596EDUL, 0x22DF9673UL, 0x281A9F6AUL, 0xE4B09FF4UL, 0x6A3F9817UL, 0xA6959889UL,
+		0x7FB58A25UL, 0xB31F8ABBUL, 0x3D908D58UL, 0xF13A8DC6UL, 0xFBFF84DFUL, 0x37558441UL,
+		0xB9DA83A2UL, 0x7570833CUL, 0x533B85DAUL, 0x9F918544UL, 0x111E82A7UL, 0xDDB48239UL,
+		0xD7718B20UL, 0x1BDB8BBEUL, 0x95548C5DUL, 0x59FE8CC3UL, 0x80DE9E6FUL, 0x4C749EF1UL,
+		0xC2FB9912UL, 0x0E51998CUL, 0x04949095UL, 0xC83E900BUL, 0x46B197E8UL, 0x8A1B9776UL,
+		0x2F80B4F1UL, 0xE32AB46FUL, 0x6DA5B38CUL, 0xA10FB312UL, 0xABCABA0BUL, 0x6760BA95UL,
+		0xE9EFBD76UL, 0x2545BDE8UL, 0xFC65AF44UL, 0x30CFAFDAUL, 0xBE40A839UL, 0x72EAA8A7UL,
+		0x782FA1BEUL, 0xB485A120UL, 0x3A0AA6C3UL, 0xF6A0A65DUL, 0xAA4DE78CUL, 0x66E7E712UL,
+		0xE868E0F1UL, 0x24C2E06FUL, 0x2E07E976UL, 0xE2ADE9E8UL, 0x6C22EE0BUL, 0xA088EE95UL,
+		0x79A8FC39UL, 0xB502FCA7UL, 0x3B8DFB44UL, 0xF727FBDAUL, 0xFDE2F2C3UL, 0x3148F25DUL,
+		0xBFC7F5BEUL, 0x736DF520UL, 0xD6F6D6A7UL, 0x1A5CD639UL, 0x94D3D1DAUL, 0x5879D144UL,
+		0x52BCD85DUL, 0x9E16D8C3UL, 0x1099DF20UL, 0xDC33DFBEUL, 0x0513CD12UL, 0xC9B9CD8CUL,
+		0x4736CA6FUL, 0x8B9CCAF1UL, 0x8159C3E8UL, 0x4DF3C376UL, 0xC37CC495UL, 0x0FD6C40BUL,
+		0x7AA64737UL, 0xB60C47A9UL, 0x3883404AUL, 0xF42940D4UL, 0xFEEC49CDUL, 0x32464953UL,
+		0xBCC94EB0UL, 0x70634E2EUL, 0xA9435C82UL, 0x65E95C1CUL, 0xEB665BFFUL, 0x27CC5B61UL,
+		0x2D095278UL, 0xE1A352E6UL, 0x6F2C5505UL, 0xA386559BUL, 0x061D761CUL, 0xCAB77682UL,
+		0x44387161UL, 0x889271FFUL, 0x825778E6UL, 0x4EFD7878UL, 0xC0727F9BUL, 0x0CD87F05UL,
+		0xD5F86DA9UL, 0x19526D37UL, 0x97DD6AD4UL, 0x5B776A4AUL, 0x51B26353UL, 0x9D1863CDUL,
+		0x1397642EUL, 0xDF3D64B0UL, 0x83D02561UL, 0x4F7A25FFUL, 0xC1F5221CUL, 0x0D5F2282UL,
+		0x079A2B9BUL, 0xCB302B05UL, 0x45BF2CE6UL, 0x89152C78UL, 0x50353ED4UL, 0x9C9F3E4AUL,
+		0x121039A9UL, 0xDEBA3937UL, 0xD47F302EUL, 0x18D530B0UL, 0x965A3753UL, 0x5AF037CDUL,
+		0xFF6B144AUL, 0x33C114D4UL, 0xBD4E1337UL, 0x71E413A9UL, 0x7B211AB0UL, 0xB78B1A2EUL,
+		0x39041DCDUL, 0xF5AE1D53UL, 0x2C8E0FFFUL, 0xE0240F61UL, 0x6EAB0882UL, 0xA201081CUL,
+		0xA8C40105UL, 0x646E019BUL, 0xEAE10678UL, 0x264B06E6UL
+	}
+};
+
+/**
+  * @brief  Load four bytes as a little endian word, from any address
+  *
+  * @param  data -> the bytes
+  *
+  * @retval The word
+  */
+static uint32_t crc_soft_load(const uint8_t *data)
+{
+	uint32_t word;
+
+	memcpy(&word, data, sizeof(word));
+
+	return word;
+}
+
+/**
+  * @brief  Add bytes to a CRC register, most significant bit first
+  *
+  * @param  crc -> the register
+  * @param  data -> the bytes
+  * @param  length -> number of bytes
+  * @param  words -> pdTRUE to add each whole four bytes as a little endian
+  * 		word, last byte first, as the CRC unit does, or pdFALSE to add the
+  * 		bytes in order
+  *
+  * @retval The register
+  */
+static uint32_t crc_soft_msb(uint32_t crc, const uint8_t *data, size_t length, BaseType_t words)
+{
+	uint32_t first, second;
+
+	while (length >= 8)
+	{
+		first = crc_soft_load(data);
+		second = crc_soft_load(&data[4]);
+
+		if (words == pdFALSE)
+		{
+			first = __builtin_bswap32(first);
+			second = __builtin_bswap32(second);
+		}
+
+		crc ^= first;
+		crc = crc_msb_table[7][crc >> 24] ^ crc_msb_table[6][(crc >> 16) & 0xFF] ^
+				crc_msb_table[5][(crc >> 8) & 0xFF] ^ crc_msb_table[4][crc & 0xFF] ^
+				crc_msb_table[3][second >> 24] ^ crc_msb_table[2][(second >> 16) & 0xFF] ^
+				crc_msb_table[1][(second >> 8) & 0xFF] ^ crc_msb_table[0][second & 0xFF];
+
+		data += 8;
+		length -= 8;
+	}
+
+	if ((words == pdTRUE) && (length >= 4))
+	{
+		crc ^= crc_soft_load(data);
+		crc = crc_msb_table[3][crc >> 24] ^ crc_msb_table[2][(crc >> 16) & 0xFF] ^
+				crc_msb_table[1][(crc >> 8) & 0xFF] ^ crc_msb_table[0][crc & 0xFF];
+
+		data += 4;
+		length -= 4;
+	}
+
+	while (length > 0)
+	{
+		crc = (crc << 8) ^ crc_msb_table[0][(crc >> 24) ^ *data++];
+		length--;
+	}
+
+	return crc;
+}
+
+/**
+  * @brief  Add bytes to a reflected CRC register, least significant bit first
+  *
+  * @param  crc -> the register
+  * @param  data -> the bytes
+  * @param  length -> number of bytes
+  *
+  * @retval The register
+  */
+static uint32_t crc_soft_lsb(uint32_t crc, const uint8_t *data, size_t length)
+{
+	uint32_t first, second;
+
+	while (length >= 8)
+	{
+		first = crc_soft_load(data) ^ crc;
+		second = crc_soft_load(&data[4]);
+
+		crc = crc_lsb_table[7][first & 0xFF] ^ crc_lsb_table[6][(first >> 8) & 0xFF] ^
+				crc_lsb_table[5][(first >> 16) & 0xFF] ^ crc_lsb_table[4][first >> 24] ^
+				crc_lsb_table[3][second & 0xFF] ^ crc_lsb_table[2][(second >> 8) & 0xFF] ^
+				crc_lsb_table[1][(second >> 16) & 0xFF] ^ crc_lsb_table[0][second >> 24];
+
+		data += 8;
+		length -= 8;
+	}
+
+	while (length > 0)
+	{
+		crc = (crc >> 8) ^ crc_lsb_table[0][(crc ^ *data++) & 0xFF];
+		length--;
+	}
+
+	return crc;
+}
+
+/**
+  * @brief  The CRC of no data, which a calculation starts from
+  *
+  * @param  variant -> the variant
+  *
+  * @retval 0xFFFFFFFF, or 0 for CRC_VARIANT_32, whose final XOR undoes its
+  * 		start
+  */
+uint32_t crc_initial(crc_variant_t variant)
+{
+	return (variant == CRC_VARIANT_32) ? 0 : 0xFFFFFFFF;
+}
+
+/**
+  * @brief  Calculate a CRC in software
+  *
+  * @param  variant -> the variant
+  * @param  initial -> the CRC of the data before, or crc_initial(variant).
+  * 		For CRC_VARIANT_STM32 the data before must be whole words
+  * @param  data -> the bytes, at any address
+  * @param  length -> number of bytes
+  *
+  * @retval The CRC
+  */
+uint32_t crc_soft_calculate(crc_variant_t variant, uint32_t initial, const void *data, size_t length)
+{
+	if (variant == CRC_VARIANT_32)
+	{
+		return crc_soft_lsb(initial ^ 0xFFFFFFFF, (const uint8_t *) data, length) ^ 0xFFFFFFFF;
+	}
+
+	return crc_soft_msb(initial, (const uint8_t *) data, length, (variant == CRC_VARIANT_STM32) ? pdTRUE : pdFALSE);
+}
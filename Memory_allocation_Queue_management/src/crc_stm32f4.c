@@ -0,0 +1,98 @@
+/**
+  ******************************************************************************
+  * @file    crc_stm32f4.c
+  * @brief   The CRC calculation unit of the STM32F4 for the CRC service
+  * 		 (crc_unit.h).  It takes whole 32 bit words only, most significant
+  * 		 bit first, so the CPU reverses the bytes or bits of each word for
+  * 		 the standard variants as it writes them.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "crc_unit.h"
+
+/**
+  * @brief  Enable or disable the clock of the unit
+  *
+  * @param  state -> ENABLE or DISABLE
+  *
+  * @retval None
+  */
+static void crc_stm32f4_enable(FunctionalState state)
+{
+	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_CRC, state);
+}
+
+/**
+  * @brief  Set the register of the unit to 0xFFFFFFFF
+  *
+  * @param  None
+  *
+  * @retval None
+  */
+static void crc_stm32f4_reset(void)
+{
+	CRC_ResetDR();
+}
+
+/**
+  * @brief  Write words to the unit.  The Cortex-M4 loads words from any
+  * 		address, and REV and RBIT take a cycle each
+  *
+  * @param  data -> the words, at any address
+  * @param  words -> number of words
+  * @param  input -> how each word is written
+  *
+  * @retval None
+  */
+static void crc_stm32f4_write(const uint8_t *data, uint32_t words, crc_input_t input)
+{
+	uint32_t word;
+
+	if (input == CRC_INPUT_WORDS)
+	{
+		for (; words > 0; words--, data += 4)
+		{
+			memcpy(&word, data, sizeof(word));
+			CRC->DR = word;
+		}
+	}
+	else if (input == CRC_INPUT_BYTES_MSB)
+	{
+		for (; words > 0; words--, data += 4)
+		{
+			memcpy(&word, data, sizeof(word));
+			CRC->DR = __REV(word);
+		}
+	}
+	else
+	{
+		for (; words > 0; words--, data += 4)
+		{
+			memcpy(&word, data, sizeof(word));
+			CRC->DR = __RBIT(word);
+		}
+	}
+}
+
+/**
+  * @brief  Read the register of the unit
+  *
+  * @param  None
+  *
+  * @retval The register
+  */
+static uint32_t crc_stm32f4_read(void)
+{
+	return CRC_GetCRC();
+}
+
+const crc_hw_t crc_stm32f4_hw =
+{
+	crc_stm32f4_enable,
+	crc_stm32f4_reset,
+	crc_stm32f4_write,
+	crc_stm32f4_read,
+	&CRC->DR
+};
@@ -0,0 +1,380 @@
+/**
+  ******************************************************************************
+  * @file    crc_unit.c
+  * @brief   RTOS CRC service on the CRC calculation unit (see crc_unit.h).
+  * 		 The unit is only reached through the crc_hw_t and the dma_hw_t of
+  * 		 the DMA stream manager, so the service also runs against a
+  * 		 simulated unit on the host.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "crc_unit.h"
+
+#define CRC_POLYNOMIAL				(0x04C11DB7UL)
+#define CRC_POLYNOMIAL_REFLECTED	(0xEDB88320UL)
+
+// The most a stream moves in one transfer: words, or bytes packed into words
+#define CRC_DMA_MAX_WORDS			(65535UL)
+#define CRC_DMA_MAX_PACKED_WORDS	(65532UL / 4)
+
+/**
+  * @brief  Reverse the bits of a word
+  *
+  * @param  value -> the word
+  *
+  * @retval The word with bit 0 and bit 31 swapped, and so on
+  */
+static uint32_t crc_reflect(uint32_t value)
+{
+	value = ((value >> 1) & 0x55555555UL) | ((value & 0x55555555UL) << 1);
+	value = ((value >> 2) & 0x33333333UL) | ((value & 0x33333333UL) << 2);
+	value = ((value >> 4) & 0x0F0F0F0FUL) | ((value & 0x0F0F0F0FUL) << 4);
+
+	return __builtin_bswap32(value);
+}
+
+/**
+  * @brief  Set the register of the unit to a value.  Each word written is
+  * 		XORed into the register, which is then shifted 32 times, and as
+  * 		the lowest bit of the polynomial is set the shifts can be undone to
+  * 		find the word that takes the register from 0xFFFFFFFF to the value
+  *
+  * @param  unit -> the unit, held by the caller
+  * @param  value -> the register
+  *
+  * @retval None
+  */
+static void crc_unit_load(crc_unit_t *unit, uint32_t value)
+{
+	uint32_t word = value;
+
+	unit->hw->reset();
+
+	if (value == 0xFFFFFFFF)
+	{
+		return;
+	}
+
+	for (uint32_t bit = 0; bit < 32; bit++)
+	{
+		word = ((word & 1) != 0) ? (((word ^ CRC_POLYNOMIAL) >> 1) | 0x80000000UL) : (word >> 1);
+	}
+
+	word ^= 0xFFFFFFFF;
+	unit->hw->write((const uint8_t *) &word, 1, CRC_INPUT_WORDS);
+}
+
+/**
+  * @brief  Add the bytes past the last whole word to a register, a bit at a
+  * 		time, most significant bit first
+  *
+  * @param  crc -> the register
+  * @param  data -> the bytes
+  * @param  length -> 0 to 3 bytes
+  *
+  * @retval The register
+  */
+static uint32_t crc_unit_tail_msb(uint32_t crc, const uint8_t *data, size_t length)
+{
+	for (size_t i = 0; i < length; i++)
+	{
+		crc ^= (uint32_t) data[i] << 24;
+
+		for (uint32_t bit = 0; bit < 8; bit++)
+		{
+			crc = ((crc & 0x80000000UL) != 0) ? ((crc << 1) ^ CRC_POLYNOMIAL) : (crc << 1);
+		}
+	}
+
+	return crc;
+}
+
+/**
+  * @brief  Add the bytes past the last whole word to a reflected register, a
+  * 		bit at a time, least significant bit first
+  *
+  * @param  crc -> the reflected register
+  * @param  data -> the bytes
+  * @param  length -> 0 to 3 bytes
+  *
+  * @retval The reflected register
+  */
+static uint32_t crc_unit_tail_lsb(uint32_t crc, const uint8_t *data, size_t length)
+{
+	for (size_t i = 0; i < length; i++)
+	{
+		crc ^= data[i];
+
+		for (uint32_t bit = 0; bit < 8; bit++)
+		{
+			crc = ((crc & 1) != 0) ? ((crc >> 1) ^ CRC_POLYNOMIAL_REFLECTED) : (crc >> 1);
+		}
+	}
+
+	return crc;
+}
+
+/**
+  * @brief  Handle the interrupts of the stream feeding the unit, waking the
+  * 		task it feeds for once the transfer has finished
+  *
+  * @param  stream -> the stream
+  * @param  flags -> DMA_STREAM_xxIF flags that were set
+  * @param  context -> the unit
+  * @param  woken -> set to pdTRUE if a task of higher priority was woken
+  *
+  * @retval None
+  */
+static void crc_unit_dma_handler(dma_stream_t *stream, uint32_t flags, void *context, BaseType_t *woken)
+{
+	crc_unit_t *unit = (crc_unit_t *) context;
+
+	(void) stream;
+
+	if ((flags & DMA_STREAM_TEIF) != 0)
+	{
+		unit->dma_error = pdTRUE;
+	}
+
+	// After a transfer error the controller has disabled the stream, so no
+	// transfer complete follows
+	if (((flags & (DMA_STREAM_TCIF | DMA_STREAM_TEIF)) != 0) && (unit->waiting != NULL))
+	{
+		xTaskNotifyFromISR(unit->waiting, CRC_DMA_NOTIFY_BIT, eSetBits, woken);
+	}
+}
+
+/**
+  * @brief  Feed whole words to the unit with the stream, which reads them
+  * 		through its peripheral port and writes them to the data register
+  * 		through its memory port, blocking the calling task until it is
+  * 		done.  Words at an unaligned address are read a byte at a time and
+  * 		packed into words by the stream's FIFO
+  *
+  * @param  unit -> the unit, held by the caller
+  * @param  data -> the words
+  * @param  words -> number of words
+  *
+  * @retval pdPASS, or pdFAIL after a transfer error
+  */
+static BaseType_t crc_unit_feed_dma(crc_unit_t *unit, const uint8_t *data, uint32_t words)
+{
+	DMA_Stream_TypeDef *regs = unit->dma.regs;
+	BaseType_t aligned = (((uintptr_t) data & 3) == 0) ? pdTRUE : pdFALSE;
+	uint32_t chunk;
+
+	unit->waiting = xTaskGetCurrentTaskHandle();
+	unit->dma_error = pdFALSE;
+
+	while ((words > 0) && (unit->dma_error == pdFALSE))
+	{
+		chunk = (aligned == pdTRUE) ? CRC_DMA_MAX_WORDS : CRC_DMA_MAX_PACKED_WORDS;
+		chunk = (words < chunk) ? words : chunk;
+
+		regs->CR = (regs->CR & ~DMA_SxCR_PSIZE) |
+				((aligned == pdTRUE) ? DMA_PeripheralDataSize_Word : DMA_PeripheralDataSize_Byte);
+		regs->PAR = (uint32_t) (uintptr_t) data;
+		DMA_SetCurrDataCounter(regs, (aligned == pdTRUE) ? chunk : (chunk * 4));
+		(void) dma_stream_clear_flags(&unit->dma);
+
+		DMA_Cmd(regs, ENABLE);
+
+		// A bit left set by an earlier transfer only wakes the loop once more
+		while (DMA_GetCmdStatus(regs) == ENABLE)
+		{
+			(void) xTaskNotifyWait(0, CRC_DMA_NOTIFY_BIT, NULL, portMAX_DELAY);
+		}
+
+		data += chunk * 4;
+		words -= chunk;
+	}
+
+	unit->waiting = NULL;
+
+	return (unit->dma_error == pdTRUE) ? pdFAIL : pdPASS;
+}
+
+/**
+  * @brief  Calculate a CRC with the unit.  CRC_VARIANT_STM32 buffers of at
+  * 		least dma_threshold bytes are fed by DMA while the task blocks, and
+  * 		the rest written by the CPU, as the stream cannot reorder the bits
+  * 		of the standard variants
+  *
+  * @param  unit -> an open unit
+  * @param  variant -> the variant
+  * @param  initial -> the CRC of the data before, or crc_initial(variant).
+  * 		For CRC_VARIANT_STM32 the data before must be whole words
+  * @param  data -> the bytes, at any address the stream can read
+  * @param  length -> number of bytes
+  * @param  crc -> set to the CRC
+  * @param  timeout -> ticks to wait for another task to finish with the unit
+  *
+  * @retval pdPASS, or pdFAIL if the unit was not free in time or a transfer
+  * 		failed
+  */
+BaseType_t crc_calculate(crc_unit_t *unit, crc_variant_t variant, uint32_t initial, const void *data,
+		size_t length, uint32_t *crc, TickType_t timeout)
+{
+	const uint8_t *bytes = (const uint8_t *) data;
+	uint32_t words = (uint32_t) (length / 4);
+	size_t whole = (size_t) words * 4;
+	BaseType_t result = pdPASS, waited = pdFALSE;
+	crc_input_t input;
+	uint32_t value;
+
+	if (xSemaphoreTake(unit->mutex, 0) == pdFAIL)
+	{
+		waited = pdTRUE;
+
+		if (xSemaphoreTake(unit->mutex, timeout) == pdFAIL)
+		{
+			return pdFAIL;
+		}
+	}
+
+	// The unit works most significant bit first, so the register of
+	// CRC_VARIANT_32 is the reflection of the unit's
+	value = (variant == CRC_VARIANT_32) ? crc_reflect(initial ^ 0xFFFFFFFF) : initial;
+	input = (variant == CRC_VARIANT_STM32) ? CRC_INPUT_WORDS :
+			((variant == CRC_VARIANT_MPEG2) ? CRC_INPUT_BYTES_MSB : CRC_INPUT_BYTES_LSB);
+
+	if (words > 0)
+	{
+		crc_unit_load(unit, value);
+
+		if ((variant == CRC_VARIANT_STM32) && (unit->config.dma_threshold > 0) && (length >= unit->config.dma_threshold))
+		{
+			result = crc_unit_feed_dma(unit, bytes, words);
+			unit->stats.dma_bytes += whole;
+			unit->stats.dma_errors += (result == pdFAIL) ? 1 : 0;
+		}
+		else
+		{
+			unit->hw->write(bytes, words, input);
+			unit->stats.cpu_bytes += whole;
+		}
+
+		value = unit->hw->read();
+	}
+
+	if (variant == CRC_VARIANT_32)
+	{
+		value = crc_unit_tail_lsb(crc_reflect(value), &bytes[whole], length - whole) ^ 0xFFFFFFFF;
+	}
+	else
+	{
+		value = crc_unit_tail_msb(value, &bytes[whole], length - whole);
+	}
+
+	unit->stats.calculations++;
+	unit->stats.bytes += length;
+	unit->stats.soft_bytes += length - whole;
+	unit->stats.waits += (waited == pdTRUE) ? 1 : 0;
+
+	xSemaphoreGive(unit->mutex);
+
+	if (result == pdPASS)
+	{
+		*crc = value;
+	}
+
+	return result;
+}
+
+/**
+  * @brief  Open the unit, claiming a DMA2 stream if buffers are to be fed
+  * 		by DMA
+  *
+  * @param  unit -> state of the unit, kept until crc_unit_close()
+  * @param  hw -> &crc_stm32f4_hw, or a simulated unit
+  * @param  config -> the stream and when to use it, copied by the call
+  *
+  * @retval pdPASS, or pdFAIL if the mutex could not be created or the stream
+  * 		is already claimed
+  */
+BaseType_t crc_unit_open(crc_unit_t *unit, const crc_hw_t *hw, const crc_unit_config_t *config)
+{
+	DMA_InitTypeDef dma_init;
+
+	memset(unit, 0, sizeof(crc_unit_t));
+	unit->config = *config;
+	unit->hw = hw;
+
+	unit->mutex = xSemaphoreCreateMutex();
+	if (unit->mutex == NULL)
+	{
+		return pdFAIL;
+	}
+
+	if (config->dma_threshold > 0)
+	{
+		// DMA1 has no path to memory through its peripheral port
+		configASSERT(config->dma_controller == 2);
+
+		if (dma_stream_claim(&unit->dma, config->dma_controller, config->dma_stream) == pdFAIL)
+		{
+			vSemaphoreDelete(unit->mutex);
+			return pdFAIL;
+		}
+
+		dma_stream_set_handler(&unit->dma, crc_unit_dma_handler, unit);
+
+		// Each transfer sets the source, its data size and the length.  Memory
+		// to memory transfers run through the FIFO, and the low priority
+		// leaves the peripherals' streams ahead of the unit.
+		DMA_StructInit(&dma_init);
+		dma_init.DMA_Channel = DMA_Channel_0;
+		dma_init.DMA_Memory0BaseAddr = (uint32_t) (uintptr_t) hw->data_register;
+		dma_init.DMA_DIR = DMA_DIR_MemoryToMemory;
+		dma_init.DMA_BufferSize = 1;
+		dma_init.DMA_PeripheralInc = DMA_PeripheralInc_Enable;
+		dma_init.DMA_MemoryInc = DMA_MemoryInc_Disable;
+		dma_init.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+		dma_init.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+		dma_init.DMA_Priority = DMA_Priority_Low;
+		dma_init.DMA_FIFOMode = DMA_FIFOMode_Enable;
+		dma_init.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+		DMA_Init(unit->dma.regs, &dma_init);
+		DMA_ITConfig(unit->dma.regs, DMA_IT_TC | DMA_IT_TE, ENABLE);
+	}
+
+	hw->enable(ENABLE);
+
+	return pdPASS;
+}
+
+/**
+  * @brief  Close the unit
+  *
+  * @param  unit -> an open unit that no task is using
+  *
+  * @retval None
+  */
+void crc_unit_close(crc_unit_t *unit)
+{
+	if (unit->config.dma_threshold > 0)
+	{
+		dma_stream_free(&unit->dma);
+	}
+
+	unit->hw->enable(DISABLE);
+	vSemaphoreDelete(unit->mutex);
+}
+
+/**
+  * @brief  Read the counters of the unit, waiting for any calculation
+  * 		running to finish
+  *
+  * @param  unit -> an open unit
+  * @param  stats -> set to the counters since the unit was opened
+  *
+  * @retval None
+  */
+void crc_unit_get_stats(crc_unit_t *unit, crc_unit_stats_t *stats)
+{
+	(void) xSemaphoreTake(unit->mutex, portMAX_DELAY);
+	*stats = unit->stats;
+	xSemaphoreGive(unit->mutex);
+}
@@ -0,0 +1,460 @@
+/**
+  ******************************************************************************
+  * @file    crypto_service.c
+  * @brief   RTOS crypto offload service (see crypto_service.h).  The queue is
+  * 		 shared with tasks and interrupts under a critical section, and
+  * 		 only the service task touches the engine.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "crypto_service.h"
+
+/**
+  * @brief  Add a job to the back of its priority's list
+  *
+  * @param  service -> the service
+  * @param  job -> the job
+  *
+  * @retval None
+  */
+static void crypto_append(crypto_service_t *service, crypto_job_t *job)
+{
+	uint32_t priority = job->priority;
+
+	job->next = NULL;
+
+	if (service->tail[priority] == NULL)
+	{
+		service->head[priority] = job;
+	}
+	else
+	{
+		service->tail[priority]->next = job;
+	}
+
+	service->tail[priority] = job;
+
+	service->queued++;
+	if (service->queued > service->stats.queued_max)
+	{
+		service->stats.queued_max = service->queued;
+	}
+}
+
+/**
+  * @brief  Take the first job of the highest priority waiting
+  *
+  * @param  service -> the service
+  *
+  * @retval The job, or NULL if none is waiting
+  */
+static crypto_job_t *crypto_take_next(crypto_service_t *service)
+{
+	crypto_job_t *job = NULL;
+
+	for (int32_t priority = CRYPTO_PRIORITIES - 1; (priority >= 0) && (job == NULL); priority--)
+	{
+		job = service->head[priority];
+
+		if (job != NULL)
+		{
+			service->head[priority] = job->next;
+			if (service->head[priority] == NULL)
+			{
+				service->tail[priority] = NULL;
+			}
+
+			service->queued--;
+		}
+	}
+
+	return job;
+}
+
+/**
+  * @brief  Give a finished job back to its owner
+  *
+  * @param  service -> the service
+  * @param  job -> the job
+  * @param  result -> pdPASS, or pdFAIL if the engine failed
+  *
+  * @retval None
+  */
+static void crypto_complete(crypto_service_t *service, crypto_job_t *job, BaseType_t result)
+{
+	// Taken before the job is given back, after which it may be reused
+	crypto_callback_t callback = job->callback;
+	TaskHandle_t notify_task = job->notify_task;
+	uint32_t notify_bits = job->notify_bits;
+	uint64_t now_us = ullTaskGetMonotonicTimeUs();
+
+	taskENTER_CRITICAL();
+	{
+		job->latency_us = (uint32_t) (now_us - job->queued_us);
+
+		service->stats.jobs++;
+		service->stats.bytes += job->done;
+		service->latency_total_us += job->latency_us;
+		if (job->latency_us > service->stats.latency_max_us)
+		{
+			service->stats.latency_max_us = job->latency_us;
+		}
+
+		if (result == pdFAIL)
+		{
+			service->stats.errors++;
+			job->status = CRYPTO_ERROR;
+		}
+		else
+		{
+			job->status = CRYPTO_DONE;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if (callback != NULL)
+	{
+		callback(job);
+	}
+
+	if (notify_task != NULL)
+	{
+		xTaskNotify(notify_task, notify_bits, eSetBits);
+	}
+}
+
+/**
+  * @brief  Run one slice of a job, moving the engine's state over from the
+  * 		job it last ran if that job is not finished
+  *
+  * @param  service -> the service
+  * @param  job -> the job, taken off the queue
+  *
+  * @retval None
+  */
+static void crypto_run_slice(crypto_service_t *service, crypto_job_t *job)
+{
+	const crypto_engine_t *engine = service->engine;
+	BaseType_t result = pdPASS, last, switched = pdFALSE;
+	uint64_t start_us, busy_us;
+	size_t length;
+
+	if (service->loaded != job)
+	{
+		if (service->loaded != NULL)
+		{
+			engine->save(service->loaded);
+			switched = pdTRUE;
+		}
+
+		service->loaded = job;
+
+		if (job->status == CRYPTO_ACTIVE)
+		{
+			result = engine->restore(job);
+		}
+		else
+		{
+			job->status = CRYPTO_ACTIVE;
+			result = engine->start(job);
+		}
+	}
+
+	length = job->length - job->done;
+	length = (length > service->config.slice_bytes) ? service->config.slice_bytes : length;
+	last = ((job->done + length) == job->length) ? pdTRUE : pdFALSE;
+
+	start_us = ullTaskGetMonotonicTimeUs();
+
+	if (result == pdPASS)
+	{
+		result = engine->process(job, &job->input[job->done],
+				CRYPTO_IS_HASH(job->algorithm) ? NULL : &job->output[job->done], length, last);
+	}
+
+	busy_us = ullTaskGetMonotonicTimeUs() - start_us;
+	job->done += length;
+	job->slices++;
+
+	taskENTER_CRITICAL();
+	{
+		service->stats.slices++;
+		service->stats.switches += (switched == pdTRUE) ? 1 : 0;
+		service->stats.busy_us += busy_us;
+
+		// A job with data left goes behind the others of its priority
+		if ((last == pdFALSE) && (result == pdPASS))
+		{
+			crypto_append(service, job);
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if ((last == pdTRUE) || (result == pdFAIL))
+	{
+		// Whatever the engine holds is of no further use
+		service->loaded = NULL;
+		crypto_complete(service, job, result);
+	}
+}
+
+/**
+  * @brief  The service task: runs a slice of the next job, or waits for one
+  * 		to be queued
+  *
+  * @param  params -> the service
+  *
+  * @retval None
+  */
+static void crypto_service_task(void *params)
+{
+	crypto_service_t *service = (crypto_service_t *) params;
+	crypto_job_t *job;
+
+	for (;;)
+	{
+		taskENTER_CRITICAL();
+		{
+			job = crypto_take_next(service);
+		}
+		taskEXIT_CRITICAL();
+
+		if (job == NULL)
+		{
+			(void) xTaskNotifyWait(0, CRYPTO_QUEUE_NOTIFY_BIT, NULL, portMAX_DELAY);
+		}
+		else
+		{
+			crypto_run_slice(service, job);
+		}
+	}
+}
+
+/**
+  * @brief  Check a job and queue it.  Called in a critical section
+  *
+  * @param  service -> the service
+  * @param  job -> the job
+  * @param  now_us -> the monotonic time
+  *
+  * @retval None
+  */
+static void crypto_enqueue(crypto_service_t *service, crypto_job_t *job, uint64_t now_us)
+{
+	configASSERT(job->priority < CRYPTO_PRIORITIES);
+	configASSERT(CRYPTO_IS_HASH(job->algorithm) || ((job->length % CRYPTO_AES_BLOCK) == 0));
+	configASSERT((job->status != CRYPTO_QUEUED) && (job->status != CRYPTO_ACTIVE));
+
+	job->status = CRYPTO_QUEUED;
+	job->done = 0;
+	job->slices = 0;
+	job->queued_us = now_us;
+
+	crypto_append(service, job);
+}
+
+/**
+  * @brief  Queue a job, which completes through its callback or notification
+  *
+  * @param  service -> an open service
+  * @param  job -> the job, owned by the service until it completes
+  *
+  * @retval None
+  */
+void crypto_submit(crypto_service_t *service, crypto_job_t *job)
+{
+	uint64_t now_us = ullTaskGetMonotonicTimeUs();
+
+	taskENTER_CRITICAL();
+	{
+		crypto_enqueue(service, job, now_us);
+	}
+	taskEXIT_CRITICAL();
+
+	xTaskNotify(service->task, CRYPTO_QUEUE_NOTIFY_BIT, eSetBits);
+}
+
+/**
+  * @brief  Queue a job from an interrupt
+  *
+  * @param  service -> an open service
+  * @param  job -> the job, owned by the service until it completes
+  *
+  * @retval None
+  */
+void crypto_submit_from_isr(crypto_service_t *service, crypto_job_t *job)
+{
+	uint64_t now_us = ullTaskGetMonotonicTimeUsFromISR();
+	UBaseType_t saved_status;
+	BaseType_t woken = pdFALSE;
+
+	saved_status = taskENTER_CRITICAL_FROM_ISR();
+	{
+		crypto_enqueue(service, job, now_us);
+	}
+	taskEXIT_CRITICAL_FROM_ISR(saved_status);
+
+	xTaskNotifyFromISR(service->task, CRYPTO_QUEUE_NOTIFY_BIT, eSetBits, &woken);
+	portYIELD_FROM_ISR(woken);
+}
+
+/**
+  * @brief  Take a job off the queue if it has not started
+  *
+  * @param  service -> an open service
+  * @param  job -> the job
+  *
+  * @retval pdPASS if it was removed, or pdFAIL if it has already started
+  */
+BaseType_t crypto_cancel(crypto_service_t *service, crypto_job_t *job)
+{
+	crypto_job_t **link, *previous = NULL;
+	BaseType_t result = pdFAIL;
+
+	taskENTER_CRITICAL();
+	{
+		if (job->status == CRYPTO_QUEUED)
+		{
+			link = &service->head[job->priority];
+			while (*link != job)
+			{
+				previous = *link;
+				link = &previous->next;
+			}
+
+			*link = job->next;
+			if (service->tail[job->priority] == job)
+			{
+				service->tail[job->priority] = previous;
+			}
+
+			service->queued--;
+			job->status = CRYPTO_CANCELLED;
+			result = pdPASS;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return result;
+}
+
+/**
+  * @brief  Run a job and wait for it to complete, through the
+  * 		CRYPTO_RUN_NOTIFY_BIT notification of the calling task.  Its
+  * 		notify_task and notify_bits are overwritten
+  *
+  * @param  service -> an open service
+  * @param  job -> the job
+  * @param  timeout -> ticks to wait for it to start.  Once started it is
+  * 		always waited for
+  *
+  * @retval pdPASS, or pdFAIL if it failed or did not start in time
+  */
+BaseType_t crypto_run(crypto_service_t *service, crypto_job_t *job, TickType_t timeout)
+{
+	TimeOut_t time_out;
+
+	job->notify_task = xTaskGetCurrentTaskHandle();
+	job->notify_bits = CRYPTO_RUN_NOTIFY_BIT;
+
+	vTaskSetTimeOutState(&time_out);
+	crypto_submit(service, job);
+
+	// Other notification bits of the task are left as they are, and the bit
+	// left set by an earlier job only wakes the loop once more
+	while ((job->status == CRYPTO_QUEUED) || (job->status == CRYPTO_ACTIVE))
+	{
+		if (xTaskCheckForTimeOut(&time_out, &timeout) == pdTRUE)
+		{
+			if (crypto_cancel(service, job) == pdPASS)
+			{
+				return pdFAIL;
+			}
+
+			timeout = portMAX_DELAY;
+		}
+
+		(void) xTaskNotifyWait(0, CRYPTO_RUN_NOTIFY_BIT, NULL, timeout);
+	}
+
+	return (job->status == CRYPTO_DONE) ? pdPASS : pdFAIL;
+}
+
+/**
+  * @brief  Open the service: open the engine and create the service task
+  *
+  * @param  service -> state of the service, kept until
+  * 		crypto_service_close()
+  * @param  engine -> &crypto_stm32f4_engine or &crypto_soft_engine
+  * @param  config -> the task and slice size, copied by the call
+  *
+  * @retval pdPASS, or pdFAIL if the engine could not be opened or the task
+  * 		created
+  */
+BaseType_t crypto_service_open(crypto_service_t *service, const crypto_engine_t *engine,
+		const crypto_service_config_t *config)
+{
+	configASSERT((config->slice_bytes > 0) && ((config->slice_bytes % CRYPTO_HASH_BLOCK) == 0));
+
+	memset(service, 0, sizeof(crypto_service_t));
+	service->config = *config;
+	service->engine = engine;
+
+	if (engine->open() == pdFAIL)
+	{
+		return pdFAIL;
+	}
+
+	service->open_us = ullTaskGetMonotonicTimeUs();
+
+	if (xTaskCreate(crypto_service_task, "Crypto", config->stack_depth, service, config->task_priority,
+			&service->task) != pdPASS)
+	{
+		engine->close();
+		return pdFAIL;
+	}
+
+	return pdPASS;
+}
+
+/**
+  * @brief  Close the service
+  *
+  * @param  service -> an open service with no job queued or running, called
+  * 		from another task
+  *
+  * @retval None
+  */
+void crypto_service_close(crypto_service_t *service)
+{
+	configASSERT((service->queued == 0) && (service->loaded == NULL));
+
+	vTaskDelete(service->task);
+	service->engine->close();
+}
+
+/**
+  * @brief  Read the counters of the service
+  *
+  * @param  service -> an open service
+  * @param  stats -> set to the counters since the service was opened
+  *
+  * @retval None
+  */
+void crypto_service_get_stats(crypto_service_t *service, crypto_service_stats_t *stats)
+{
+	uint64_t latency_total_us, elapsed_us;
+
+	taskENTER_CRITICAL();
+	{
+		*stats = service->stats;
+		latency_total_us = service->latency_total_us;
+	}
+	taskEXIT_CRITICAL();
+
+	elapsed_us = ullTaskGetMonotonicTimeUs() - service->open_us;
+	stats->utilisation = (elapsed_us > 0) ? (uint32_t) ((stats->busy_us * 1000ULL) / elapsed_us) : 0;
+	stats->latency_mean_us = (stats->jobs > 0) ? (uint32_t) (latency_total_us / stats->jobs) : 0;
+}
@@ -0,0 +1,759 @@
+/**
+  ******************************************************************************
+  * @file    crypto_soft.c
+  * @brief   MD5, SHA-1, SHA-256 and AES in ECB, CBC and CTR modes in
+  * 		 software, and crypto_soft_engine, which runs them for the crypto
+  * 		 service (crypto_service.h) on parts without the HASH and CRYP
+  * 		 processors, such as the STM32F446, and on the host.  The software
+  * 		 engine keeps the state of the job it is running as the processors
+  * 		 keep theirs in registers, and saves and restores it the same way.
+  * 		 AES works a byte at a time from the S-box, which is slower than
+  * 		 32-bit tables but needs 512 bytes of flash rather than 8KB.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "crypto_service.h"
+
+#define CRYPTO_ROTL(value, bits)		(((value) << (bits)) | ((value) >> (32 - (bits))))
+#define CRYPTO_ROTR(value, bits)		(((value) >> (bits)) | ((value) << (32 - (bits))))
+
+static const uint8_t crypto_sbox[256] =
+{
+	0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+	0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+	0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+	0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+	0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+	0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+	0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+	0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+	0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+	0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+	0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+	0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+	0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+	0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+	0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+	0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16
+};
+
+static const uint8_t crypto_inverse_sbox[256] =
+{
+	0x52, 0x09, 0x6A, 0xD5, 0x30, 0x36, 0xA5, 0x38, 0xBF, 0x40, 0xA3, 0x9E, 0x81, 0xF3, 0xD7, 0xFB,
+	0x7C, 0xE3, 0x39, 0x82, 0x9B, 0x2F, 0xFF, 0x87, 0x34, 0x8E, 0x43, 0x44, 0xC4, 0xDE, 0xE9, 0xCB,
+	0x54, 0x7B, 0x94, 0x32, 0xA6, 0xC2, 0x23, 0x3D, 0xEE, 0x4C, 0x95, 0x0B, 0x42, 0xFA, 0xC3, 0x4E,
+	0x08, 0x2E, 0xA1, 0x66, 0x28, 0xD9, 0x24, 0xB2, 0x76, 0x5B, 0xA2, 0x49, 0x6D, 0x8B, 0xD1, 0x25,
+	0x72, 0xF8, 0xF6, 0x64, 0x86, 0x68, 0x98, 0x16, 0xD4, 0xA4, 0x5C, 0xCC, 0x5D, 0x65, 0xB6, 0x92,
+	0x6C, 0x70, 0x48, 0x50, 0xFD, 0xED, 0xB9, 0xDA, 0x5E, 0x15, 0x46, 0x57, 0xA7, 0x8D, 0x9D, 0x84,
+	0x90, 0xD8, 0xAB, 0x00, 0x8C, 0xBC, 0xD3, 0x0A, 0xF7, 0xE4, 0x58, 0x05, 0xB8, 0xB3, 0x45, 0x06,
+	0xD0, 0x2C, 0x1E, 0x8F, 0xCA, 0x3F, 0x0F, 0x02, 0xC1, 0xAF, 0xBD, 0x03, 0x01, 0x13, 0x8A, 0x6B,
+	0x3A, 0x91, 0x11, 0x41, 0x4F, 0x67, 0xDC, 0xEA, 0x97, 0xF2, 0xCF, 0xCE, 0xF0, 0xB4, 0xE6, 0x73,
+	0x96, 0xAC, 0x74, 0x22, 0xE7, 0xAD, 0x35, 0x85, 0xE2, 0xF9, 0x37, 0xE8, 0x1C, 0x75, 0xDF, 0x6E,
+	0x47, 0xF1, 0x1A, 0x71, 0x1D, 0x29, 0xC5, 0x89, 0x6F, 0xB7, 0x62, 0x0E, 0xAA, 0x18, 0xBE, 0x1B,
+	0xFC, 0x56, 0x3E, 0x4B, 0xC6, 0xD2, 0x79, 0x20, 0x9A, 0xDB, 0xC0, 0xFE, 0x78, 0xCD, 0x5A, 0xF4,
+	0x1F, 0xDD, 0xA8, 0x33, 0x88, 0x07, 0xC7, 0x31, 0xB1, 0x12, 0x10, 0x59, 0x27, 0x80, 0xEC, 0x5F,
+	0x60, 0x51, 0x7F, 0xA9, 0x19, 0xB5, 0x4A, 0x0D, 0x2D, 0xE5, 0x7A, 0x9F, 0x93, 0xC9, 0x9C, 0xEF,
+	0xA0, 0xE0, 0x3B, 0x4D, 0xAE, 0x2A, 0xF5, 0xB0, 0xC8, 0xEB, 0xBB, 0x3C, 0x83, 0x53, 0x99, 0x61,
+	0x17, 0x2B, 0x04, 0x7E, 0xBA, 0x77, 0xD6, 0x26, 0xE1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0C, 0x7D
+};
+
+// The integer part of 2^32 times abs(sin(i + 1))
+static const uint32_t crypto_md5_k[64] =
+{
+	0xD76AA478UL, 0xE8C7B756UL, 0x242070DBUL, 0xC1BDCEEEUL, 0xF57C0FAFUL, 0x4787C62AUL,
+	0xA8304613UL, 0xFD469501UL, 0x698098D8UL, 0x8B44F7AFUL, 0xFFFF5BB1UL, 0x895CD7BEUL,
+	0x6B901122UL, 0xFD987193UL, 0xA679438EUL, 0x49B40821UL, 0xF61E2562UL, 0xC040B340UL,
+	0x265E5A51UL, 0xE9B6C7AAUL, 0xD62F105DUL, 0x02441453UL, 0xD8A1E681UL, 0xE7D3FBC8UL,
+	0x21E1CDE6UL, 0xC33707D6UL, 0xF4D50D87UL, 0x455A14EDUL, 0xA9E3E905UL, 0xFCEFA3F8UL,
+	0x676F02D9UL, 0x8D2A4C8AUL, 0xFFFA3942UL, 0x8771F681UL, 0x6D9D6122UL, 0xFDE5380CUL,
+	0xA4BEEA44UL, 0x4BDECFA9UL, 0xF6BB4B60UL, 0xBEBFBC70UL, 0x289B7EC6UL, 0xEAA127FAUL,
+	0xD4EF3085UL, 0x04881D05UL, 0xD9D4D039UL, 0xE6DB99E5UL, 0x1FA27CF8UL, 0xC4AC5665UL,
+	0xF4292244UL, 0x432AFF97UL, 0xAB9423A7UL, 0xFC93A039UL, 0x655B59C3UL, 0x8F0CCC92UL,
+	0xFFEFF47DUL, 0x85845DD1UL, 0x6FA87E4FUL, 0xFE2CE6E0UL, 0xA3014314UL, 0x4E0811A1UL,
+	0xF7537E82UL, 0xBD3AF235UL, 0x2AD7D2BBUL, 0xEB86D391UL
+};
+
+static const uint8_t crypto_md5_shift[16] = { 7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21 };
+
+// The first 32 bits of the fractional parts of the cube roots of the first
+// 64 primes
+static const uint32_t crypto_sha256_k[64] =
+{
+	0x428A2F98UL, 0x71374491UL, 0xB5C0FBCFUL, 0xE9B5DBA5UL, 0x3956C25BUL, 0x59F111F1UL,
+	0x923F82A4UL, 0xAB1C5ED5UL, 0xD807AA98UL, 0x12835B01UL, 0x243185BEUL, 0x550C7DC3UL,
+	0x72BE5D74UL, 0x80DEB1FEUL, 0x9BDC06A7UL, 0xC19BF174UL, 0xE49B69C1UL, 0xEFBE4786UL,
+	0x0FC19DC6UL, 0x240CA1CCUL, 0x2DE92C6FUL, 0x4A7484AAUL, 0x5CB0A9DCUL, 0x76F988DAUL,
+	0x983E5152UL, 0xA831C66DUL, 0xB00327C8UL, 0xBF597FC7UL, 0xC6E00BF3UL, 0xD5A79147UL,
+	0x06CA6351UL, 0x14292967UL, 0x27B70A85UL, 0x2E1B2138UL, 0x4D2C6DFCUL, 0x53380D13UL,
+	0x650A7354UL, 0x766A0ABBUL, 0x81C2C92EUL, 0x92722C85UL, 0xA2BFE8A1UL, 0xA81A664BUL,
+	0xC24B8B70UL, 0xC76C51A3UL, 0xD192E819UL, 0xD6990624UL, 0xF40E3585UL, 0x106AA070UL,
+	0x19A4C116UL, 0x1E376C08UL, 0x2748774CUL, 0x34B0BCB5UL, 0x391C0CB3UL, 0x4ED8AA4AUL,
+	0x5B9CCA4FUL, 0x682E6FF3UL, 0x748F82EEUL, 0x78A5636FUL, 0x84C87814UL, 0x8CC70208UL,
+	0x90BEFFFAUL, 0xA4506CEBUL, 0xBEF9A3F7UL, 0xC67178F2UL
+
+};
+
+static const uint32_t crypto_initial[3][8] =
+{
+	{ 0x67452301UL, 0xEFCDAB89UL, 0x98BADCFEUL, 0x10325476UL },
+	{ 0x67452301UL, 0xEFCDAB89UL, 0x98BADCFEUL, 0x10325476UL, 0xC3D2E1F0UL },
+	{ 0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL, 0xA54FF53AUL, 0x510E527FUL, 0x9B05688CUL, 0x1F83D9ABUL, 0x5BE0CD19UL }
+};
+
+// The state of the job crypto_soft_engine is running, as the processors'
+// registers are
+static crypto_context_t crypto_soft_unit;
+
+static uint32_t crypto_load_be(const uint8_t *data)
+{
+	return ((uint32_t) data[0] << 24) | ((uint32_t) data[1] << 16) | ((uint32_t) data[2] << 8) | data[3];
+}
+
+static uint32_t crypto_load_le(const uint8_t *data)
+{
+	return ((uint32_t) data[3] << 24) | ((uint32_t) data[2] << 16) | ((uint32_t) data[1] << 8) | data[0];
+}
+
+static void crypto_store_be(uint8_t *data, uint32_t value)
+{
+	data[0] = (uint8_t) (value >> 24);
+	data[1] = (uint8_t) (value >> 16);
+	data[2] = (uint8_t) (value >> 8);
+	data[3] = (uint8_t) value;
+}
+
+static void crypto_store_le(uint8_t *data, uint32_t value)
+{
+	data[0] = (uint8_t) value;
+	data[1] = (uint8_t) (value >> 8);
+	data[2] = (uint8_t) (value >> 16);
+	data[3] = (uint8_t) (value >> 24);
+}
+
+/**
+  * @brief  Add a 64 byte block to an MD5 state
+  *
+  * @param  state -> the four words of the state
+  * @param  block -> the block
+  *
+  * @retval None
+  */
+static void crypto_md5_block(uint32_t *state, const uint8_t *block)
+{
+	uint32_t m[16], a = state[0], b = state[1], c = state[2], d = state[3], f, g, t;
+
+	for (uint32_t i = 0; i < 16; i++)
+	{
+		m[i] = crypto_load_le(&block[i * 4]);
+	}
+
+	for (uint32_t i = 0; i < 64; i++)
+	{
+		if (i < 16)
+		{
+			f = (b & c) | (~b & d);
+			g = i;
+		}
+		else if (i < 32)
+		{
+			f = (d & b) | (~d & c);
+			g = ((5 * i) + 1) & 15;
+		}
+		else if (i < 48)
+		{
+			f = b ^ c ^ d;
+			g = ((3 * i) + 5) & 15;
+		}
+		else
+		{
+			f = c ^ (b | ~d);
+			g = (7 * i) & 15;
+		}
+
+		t = d;
+		d = c;
+		c = b;
+		f += a + crypto_md5_k[i] + m[g];
+		b += CRYPTO_ROTL(f, crypto_md5_shift[((i >> 4) * 4) + (i & 3)]);
+		a = t;
+	}
+
+	state[0] += a;
+	state[1] += b;
+	state[2] += c;
+	state[3] += d;
+}
+
+/**
+  * @brief  Add a 64 byte block to a SHA-1 state
+  *
+  * @param  state -> the five words of the state
+  * @param  block -> the block
+  *
+  * @retval None
+  */
+static void crypto_sha1_block(uint32_t *state, const uint8_t *block)
+{
+	uint32_t w[16], a = state[0], b = state[1], c = state[2], d = state[3], e = state[4], f, k, t;
+
+	for (uint32_t i = 0; i < 80; i++)
+	{
+		if (i < 16)
+		{
+			w[i] = crypto_load_be(&block[i * 4]);
+		}
+		else
+		{
+			t = w[(i - 3) & 15] ^ w[(i - 8) & 15] ^ w[(i - 14) & 15] ^ w[i & 15];
+			w[i & 15] = CRYPTO_ROTL(t, 1);
+		}
+
+		if (i < 20)
+		{
+			f = (b & c) | (~b & d);
+			k = 0x5A827999UL;
+		}
+		else if (i < 40)
+		{
+			f = b ^ c ^ d;
+			k = 0x6ED9EBA1UL;
+		}
+		else if (i < 60)
+		{
+			f = (b & c) | (b & d) | (c & d);
+			k = 0x8F1BBCDCUL;
+		}
+		else
+		{
+			f = b ^ c ^ d;
+			k = 0xCA62C1D6UL;
+		}
+
+		t = CRYPTO_ROTL(a, 5) + f + e + k + w[i & 15];
+		e = d;
+		d = c;
+		c = CRYPTO_ROTL(b, 30);
+		b = a;
+		a = t;
+	}
+
+	state[0] += a;
+	state[1] += b;
+	state[2] += c;
+	state[3] += d;
+	state[4] += e;
+}
+
+/**
+  * @brief  Add a 64 byte block to a SHA-256 state
+  *
+  * @param  state -> the eight words of the state
+  * @param  block -> the block
+  *
+  * @retval None
+  */
+static void crypto_sha256_block(uint32_t *state, const uint8_t *block)
+{
+	uint32_t w[16], v[8], s0, s1, t1, t2;
+
+	memcpy(v, state, sizeof(v));
+
+	for (uint32_t i = 0; i < 64; i++)
+	{
+		if (i < 16)
+		{
+			w[i] = crypto_load_be(&block[i * 4]);
+		}
+		else
+		{
+			s0 = CRYPTO_ROTR(w[(i - 15) & 15], 7) ^ CRYPTO_ROTR(w[(i - 15) & 15], 18) ^ (w[(i - 15) & 15] >> 3);
+			s1 = CRYPTO_ROTR(w[(i - 2) & 15], 17) ^ CRYPTO_ROTR(w[(i - 2) & 15], 19) ^ (w[(i - 2) & 15] >> 10);
+			w[i & 15] += s0 + w[(i - 7) & 15] + s1;
+		}
+
+		t1 = v[7] + (CRYPTO_ROTR(v[4], 6) ^ CRYPTO_ROTR(v[4], 11) ^ CRYPTO_ROTR(v[4], 25)) +
+				((v[4] & v[5]) ^ (~v[4] & v[6])) + crypto_sha256_k[i] + w[i & 15];
+		t2 = (CRYPTO_ROTR(v[0], 2) ^ CRYPTO_ROTR(v[0], 13) ^ CRYPTO_ROTR(v[0], 22)) +
+				((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+
+		memmove(&v[1], &v[0], 7 * sizeof(uint32_t));
+		v[4] += t1;
+		v[0] = t1 + t2;
+	}
+
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		state[i] += v[i];
+	}
+}
+
+static void crypto_hash_block(uint32_t *state, crypto_algorithm_t algorithm, const uint8_t *block)
+{
+	if (algorithm == CRYPTO_MD5)
+	{
+		crypto_md5_block(state, block);
+	}
+	else if (algorithm == CRYPTO_SHA1)
+	{
+		crypto_sha1_block(state, block);
+	}
+	else
+	{
+		crypto_sha256_block(state, block);
+	}
+}
+
+/**
+  * @brief  The length of an algorithm's digest
+  *
+  * @param  algorithm -> the algorithm
+  *
+  * @retval 16, 20 or 32 bytes for the hashes, 0 for AES
+  */
+size_t crypto_digest_length(crypto_algorithm_t algorithm)
+{
+	static const uint8_t length[3] = { 16, 20, 32 };
+
+	return CRYPTO_IS_HASH(algorithm) ? length[algorithm] : 0;
+}
+
+/**
+  * @brief  Start a hash
+  *
+  * @param  state -> the state
+  * @param  algorithm -> CRYPTO_MD5, CRYPTO_SHA1 or CRYPTO_SHA256
+  *
+  * @retval None
+  */
+void crypto_hash_init(crypto_hash_state_t *state, crypto_algorithm_t algorithm)
+{
+	memcpy(state->state, crypto_initial[algorithm], sizeof(state->state));
+	state->bytes = 0;
+}
+
+/**
+  * @brief  Add data to a hash
+  *
+  * @param  state -> the state
+  * @param  algorithm -> the algorithm it was started with
+  * @param  data -> the bytes
+  * @param  length -> number of bytes
+  *
+  * @retval None
+  */
+void crypto_hash_update(crypto_hash_state_t *state, crypto_algorithm_t algorithm, const uint8_t *data, size_t length)
+{
+	size_t used = (size_t) (state->bytes % CRYPTO_HASH_BLOCK), part;
+
+	state->bytes += length;
+
+	if (used > 0)
+	{
+		part = ((CRYPTO_HASH_BLOCK - used) < length) ? (CRYPTO_HASH_BLOCK - used) : length;
+		memcpy(&state->block[used], data, part);
+		data += part;
+		length -= part;
+
+		if ((used + part) < CRYPTO_HASH_BLOCK)
+		{
+			return;
+		}
+
+		crypto_hash_block(state->state, algorithm, state->block);
+	}
+
+	for (; length >= CRYPTO_HASH_BLOCK; data += CRYPTO_HASH_BLOCK, length -= CRYPTO_HASH_BLOCK)
+	{
+		crypto_hash_block(state->state, algorithm, data);
+	}
+
+	memcpy(state->block, data, length);
+}
+
+/**
+  * @brief  Pad a hash and give its digest
+  *
+  * @param  state -> the state, which must be started again to be used
+  * @param  algorithm -> the algorithm it was started with
+  * @param  digest -> set to crypto_digest_length(algorithm) bytes
+  *
+  * @retval None
+  */
+void crypto_hash_final(crypto_hash_state_t *state, crypto_algorithm_t algorithm, uint8_t *digest)
+{
+	size_t used = (size_t) (state->bytes % CRYPTO_HASH_BLOCK);
+	uint64_t bits = state->bytes * 8;
+
+	state->block[used++] = 0x80;
+
+	if (used > (CRYPTO_HASH_BLOCK - 8))
+	{
+		memset(&state->block[used], 0, CRYPTO_HASH_BLOCK - used);
+		crypto_hash_block(state->state, algorithm, state->block);
+		used = 0;
+	}
+
+	memset(&state->block[used], 0, CRYPTO_HASH_BLOCK - 8 - used);
+
+	// MD5 is little endian throughout, the SHAs big endian
+	if (algorithm == CRYPTO_MD5)
+	{
+		crypto_store_le(&state->block[56], (uint32_t) bits);
+		crypto_store_le(&state->block[60], (uint32_t) (bits >> 32));
+	}
+	else
+	{
+		crypto_store_be(&state->block[56], (uint32_t) (bits >> 32));
+		crypto_store_be(&state->block[60], (uint32_t) bits);
+	}
+
+	crypto_hash_block(state->state, algorithm, state->block);
+
+	for (size_t i = 0; i < (crypto_digest_length(algorithm) / 4); i++)
+	{
+		if (algorithm == CRYPTO_MD5)
+		{
+			crypto_store_le(&digest[i * 4], state->state[i]);
+		}
+		else
+		{
+			crypto_store_be(&digest[i * 4], state->state[i]);
+		}
+	}
+}
+
+static uint8_t crypto_xtime(uint8_t value)
+{
+	return (uint8_t) ((value << 1) ^ (((value >> 7) & 1) * 0x1B));
+}
+
+/**
+  * @brief  Mix the four columns of an AES state
+  *
+  * @param  s -> the 16 bytes of the state, a column at a time
+  *
+  * @retval None
+  */
+static void crypto_aes_mix_columns(uint8_t *s)
+{
+	uint8_t a0, a1, a2, a3, all;
+
+	for (uint32_t c = 0; c < 16; c += 4)
+	{
+		a0 = s[c];
+		a1 = s[c + 1];
+		a2 = s[c + 2];
+		a3 = s[c + 3];
+		all = a0 ^ a1 ^ a2 ^ a3;
+
+		s[c] ^= all ^ crypto_xtime(a0 ^ a1);
+		s[c + 1] ^= all ^ crypto_xtime(a1 ^ a2);
+		s[c + 2] ^= all ^ crypto_xtime(a2 ^ a3);
+		s[c + 3] ^= all ^ crypto_xtime(a3 ^ a0);
+	}
+}
+
+/**
+  * @brief  Undo the mixing of the columns of an AES state: multiplying each
+  * 		column by 4x^2 + 5 first leaves a mix to finish the inverse
+  *
+  * @param  s -> the 16 bytes of the state, a column at a time
+  *
+  * @retval None
+  */
+static void crypto_aes_inverse_mix_columns(uint8_t *s)
+{
+	uint8_t u, v;
+
+	for (uint32_t c = 0; c < 16; c += 4)
+	{
+		u = crypto_xtime(crypto_xtime(s[c] ^ s[c + 2]));
+		v = crypto_xtime(crypto_xtime(s[c + 1] ^ s[c + 3]));
+		s[c] ^= u;
+		s[c + 1] ^= v;
+		s[c + 2] ^= u;
+		s[c + 3] ^= v;
+	}
+
+	crypto_aes_mix_columns(s);
+}
+
+static void crypto_aes_add_round_key(uint8_t *s, const uint8_t *round_key)
+{
+	for (uint32_t i = 0; i < 16; i++)
+	{
+		s[i] ^= round_key[i];
+	}
+}
+
+/**
+  * @brief  Encrypt a block.  Row r of the state moves r columns left as
+  * 		each byte goes through the S-box
+  *
+  * @param  state -> the key schedule
+  * @param  s -> the block, encrypted in place
+  *
+  * @retval None
+  */
+static void crypto_aes_encrypt_block(const crypto_aes_state_t *state, uint8_t *s)
+{
+	uint8_t t[16];
+
+	crypto_aes_add_round_key(s, state->round_key);
+
+	for (uint32_t round = 1; round <= state->rounds; round++)
+	{
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			t[i] = crypto_sbox[s[(i + (4 * (i & 3))) & 15]];
+		}
+
+		if (round < state->rounds)
+		{
+			crypto_aes_mix_columns(t);
+		}
+
+		memcpy(s, t, 16);
+		crypto_aes_add_round_key(s, &state->round_key[round * 16]);
+	}
+}
+
+/**
+  * @brief  Decrypt a block, the rounds of crypto_aes_encrypt_block() undone
+  * 		in reverse
+  *
+  * @param  state -> the key schedule
+  * @param  s -> the block, decrypted in place
+  *
+  * @retval None
+  */
+static void crypto_aes_decrypt_block(const crypto_aes_state_t *state, uint8_t *s)
+{
+	uint8_t t[16];
+
+	for (uint32_t round = state->rounds; round >= 1; round--)
+	{
+		crypto_aes_add_round_key(s, &state->round_key[round * 16]);
+
+		if (round < state->rounds)
+		{
+			crypto_aes_inverse_mix_columns(s);
+		}
+
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			t[(i + (4 * (i & 3))) & 15] = crypto_inverse_sbox[s[i]];
+		}
+
+		memcpy(s, t, 16);
+	}
+
+	crypto_aes_add_round_key(s, state->round_key);
+}
+
+/**
+  * @brief  Expand an AES key and set the chaining block or counter
+  *
+  * @param  state -> the state
+  * @param  key -> the key
+  * @param  key_bits -> 128, 192 or 256
+  * @param  iv -> 16 bytes for CBC and CTR, NULL for ECB
+  * @param  decrypt -> pdTRUE to decrypt with ECB or CBC
+  *
+  * @retval None
+  */
+void crypto_aes_init(crypto_aes_state_t *state, const uint8_t *key, uint32_t key_bits, const uint8_t *iv,
+		BaseType_t decrypt)
+{
+	uint32_t key_words = key_bits / 32, words;
+	uint8_t *w = state->round_key, t[4], rcon = 1;
+
+	configASSERT((key_bits == 128) || (key_bits == 192) || (key_bits == 256));
+
+	state->rounds = key_words + 6;
+	state->decrypt = decrypt;
+	words = 4 * (state->rounds + 1);
+
+	memcpy(w, key, key_words * 4);
+
+	for (uint32_t i = key_words; i < words; i++)
+	{
+		memcpy(t, &w[(i - 1) * 4], 4);
+
+		if ((i % key_words) == 0)
+		{
+			uint8_t first = t[0];
+
+			t[0] = crypto_sbox[t[1]] ^ rcon;
+			t[1] = crypto_sbox[t[2]];
+			t[2] = crypto_sbox[t[3]];
+			t[3] = crypto_sbox[first];
+			rcon = crypto_xtime(rcon);
+		}
+		else if ((key_words > 6) && ((i % key_words) == 4))
+		{
+			for (uint32_t j = 0; j < 4; j++)
+			{
+				t[j] = crypto_sbox[t[j]];
+			}
+		}
+
+		for (uint32_t j = 0; j < 4; j++)
+		{
+			w[(i * 4) + j] = w[((i - key_words) * 4) + j] ^ t[j];
+		}
+	}
+
+	if (iv != NULL)
+	{
+		memcpy(state->iv, iv, CRYPTO_AES_BLOCK);
+	}
+	else
+	{
+		memset(state->iv, 0, CRYPTO_AES_BLOCK);
+	}
+}
+
+/**
+  * @brief  Encrypt or decrypt whole blocks, carrying the chaining block or
+  * 		counter on to the next call
+  *
+  * @param  state -> the state
+  * @param  algorithm -> CRYPTO_AES_ECB, CRYPTO_AES_CBC or CRYPTO_AES_CTR
+  * @param  input -> the blocks
+  * @param  output -> the result, which may be input
+  * @param  length -> a multiple of 16 bytes
+  *
+  * @retval None
+  */
+void crypto_aes_process(crypto_aes_state_t *state, crypto_algorithm_t algorithm, const uint8_t *input,
+		uint8_t *output, size_t length)
+{
+	uint8_t block[CRYPTO_AES_BLOCK], next_iv[CRYPTO_AES_BLOCK];
+	uint32_t counter;
+
+	configASSERT((length % CRYPTO_AES_BLOCK) == 0);
+
+	for (; length > 0; input += CRYPTO_AES_BLOCK, output += CRYPTO_AES_BLOCK, length -= CRYPTO_AES_BLOCK)
+	{
+		if (algorithm == CRYPTO_AES_CTR)
+		{
+			memcpy(block, state->iv, CRYPTO_AES_BLOCK);
+			crypto_aes_encrypt_block(state, block);
+
+			counter = crypto_load_be(&state->iv[12]) + 1;
+			crypto_store_be(&state->iv[12], counter);
+
+			for (uint32_t i = 0; i < CRYPTO_AES_BLOCK; i++)
+			{
+				output[i] = input[i] ^ block[i];
+			}
+		}
+		else if (state->decrypt == pdTRUE)
+		{
+			memcpy(block, input, CRYPTO_AES_BLOCK);
+			memcpy(next_iv, input, CRYPTO_AES_BLOCK);
+			crypto_aes_decrypt_block(state, block);
+
+			if (algorithm == CRYPTO_AES_CBC)
+			{
+				for (uint32_t i = 0; i < CRYPTO_AES_BLOCK; i++)
+				{
+					block[i] ^= state->iv[i];
+				}
+
+				memcpy(state->iv, next_iv, CRYPTO_AES_BLOCK);
+			}
+
+			memcpy(output, block, CRYPTO_AES_BLOCK);
+		}
+		else
+		{
+			memcpy(block, input, CRYPTO_AES_BLOCK);
+
+			if (algorithm == CRYPTO_AES_CBC)
+			{
+				for (uint32_t i = 0; i < CRYPTO_AES_BLOCK; i++)
+				{
+					block[i] ^= state->iv[i];
+				}
+			}
+
+			crypto_aes_encrypt_block(state, block);
+			memcpy(output, block, CRYPTO_AES_BLOCK);
+
+			if (algorithm == CRYPTO_AES_CBC)
+			{
+				memcpy(state->iv, block, CRYPTO_AES_BLOCK);
+			}
+		}
+	}
+}
+
+static BaseType_t crypto_soft_open(void)
+{
+	return pdPASS;
+}
+
+static void crypto_soft_close(void)
+{
+}
+
+static BaseType_t crypto_soft_start(crypto_job_t *job)
+{
+	if (CRYPTO_IS_HASH(job->algorithm))
+	{
+		crypto_hash_init(&crypto_soft_unit.hash, job->algorithm);
+	}
+	else
+	{
+		crypto_aes_init(&crypto_soft_unit.aes, job->key, job->key_bits,
+				(job->algorithm == CRYPTO_AES_ECB) ? NULL : job->iv, job->decrypt);
+	}
+
+	return pdPASS;
+}
+
+static BaseType_t crypto_soft_process(crypto_job_t *job, const uint8_t *input, uint8_t *output, size_t length,
+		BaseType_t last)
+{
+	if (CRYPTO_IS_HASH(job->algorithm))
+	{
+		crypto_hash_update(&crypto_soft_unit.hash, job->algorithm, input, length);
+
+		if (last == pdTRUE)
+		{
+			crypto_hash_final(&crypto_soft_unit.hash, job->algorithm, job->output);
+		}
+	}
+	else
+	{
+		crypto_aes_process(&crypto_soft_unit.aes, job->algorithm, input, output, length);
+	}
+
+	return pdPASS;
+}
+
+static void crypto_soft_save(crypto_job_t *job)
+{
+	job->saved = crypto_soft_unit;
+}
+
+static BaseType_t crypto_soft_restore(crypto_job_t *job)
+{
+	crypto_soft_unit = job->saved;
+
+	return pdPASS;
+}
+
+const crypto_engine_t crypto_soft_engine =
+{
+	crypto_soft_open,
+	crypto_soft_close,
+	crypto_soft_start,
+	crypto_soft_process,
+	crypto_soft_save,
+	crypto_soft_restore
+};
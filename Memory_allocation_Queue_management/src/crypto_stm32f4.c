@@ -0,0 +1,546 @@
+/**
+  ******************************************************************************
+  * @file    crypto_stm32f4.c
+  * @brief   The HASH and CRYP processors of the STM32F4 for the crypto service
+  * 		 (crypto_service.h).  DMA2 feeds them: stream 6 writes the CRYP
+  * 		 input FIFO and stream 5 reads its output FIFO, and stream 7 writes
+  * 		 the HASH input FIFO, all on channel 2.  Only the STM32F41x and
+  * 		 STM32F43x have the processors, and the engine needs the F43x HASH
+  * 		 for SHA-256 and for feeding a message by more than one transfer;
+  * 		 the STM32F446 uses crypto_soft_engine.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "crypto_service.h"
+
+#define CRYPTO_DMA_CONTROLLER		(2)
+#define CRYPTO_DMA_OUT_STREAM		(5)
+#define CRYPTO_DMA_IN_STREAM		(6)
+#define CRYPTO_DMA_HASH_STREAM		(7)
+
+// Most reads of a status flag before the engine is taken to have stopped
+#define CRYPTO_POLL_LIMIT			(100000UL)
+
+static dma_stream_t crypto_out_dma;
+static dma_stream_t crypto_in_dma;
+static dma_stream_t crypto_hash_dma;
+
+// The service task while it waits for a stream, and whether one failed
+static TaskHandle_t crypto_waiting;
+static volatile BaseType_t crypto_dma_error;
+
+/**
+  * @brief  DMA stream handler (called from the DMA interrupt)
+  *
+  * @param  stream -> the stream
+  * @param  flags -> DMA_STREAM_xxIF flags that were set
+  * @param  context -> unused
+  * @param  woken -> set to pdTRUE if a higher priority task was woken
+  *
+  * @retval None
+  */
+static void crypto_stm32f4_dma_handler(dma_stream_t *stream, uint32_t flags, void *context, BaseType_t *woken)
+{
+	(void) stream;
+	(void) context;
+
+	if ((flags & DMA_STREAM_TEIF) != 0)
+	{
+		crypto_dma_error = pdTRUE;
+	}
+
+	if (((flags & (DMA_STREAM_TCIF | DMA_STREAM_TEIF)) != 0) && (crypto_waiting != NULL))
+	{
+		xTaskNotifyFromISR(crypto_waiting, CRYPTO_DMA_NOTIFY_BIT, eSetBits, woken);
+	}
+}
+
+/**
+  * @brief  Set a stream up to move words between memory and a FIFO register
+  *
+  * @param  stream -> the stream, claimed
+  * @param  direction -> DMA_DIR_MemoryToPeripheral or DMA_DIR_PeripheralToMemory
+  * @param  fifo -> the FIFO register
+  *
+  * @retval None
+  */
+static void crypto_stm32f4_setup_stream(dma_stream_t *stream, uint32_t direction, volatile uint32_t *fifo)
+{
+	DMA_InitTypeDef dma_init;
+
+	dma_stream_set_handler(stream, crypto_stm32f4_dma_handler, NULL);
+
+	DMA_StructInit(&dma_init);
+	dma_init.DMA_Channel = DMA_Channel_2;
+	dma_init.DMA_PeripheralBaseAddr = (uint32_t) (uintptr_t) fifo;
+	dma_init.DMA_DIR = direction;
+	dma_init.DMA_BufferSize = 1;
+	dma_init.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	dma_init.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	dma_init.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+	dma_init.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+	dma_init.DMA_Priority = DMA_Priority_High;
+	dma_init.DMA_FIFOMode = DMA_FIFOMode_Enable;
+	dma_init.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+	DMA_Init(stream->regs, &dma_init);
+	DMA_ITConfig(stream->regs, DMA_IT_TC | DMA_IT_TE, ENABLE);
+}
+
+/**
+  * @brief  Start a stream.  Its FIFO packs or unpacks the bytes of a buffer
+  * 		that is not word aligned
+  *
+  * @param  stream -> the stream
+  * @param  memory -> the buffer
+  * @param  words -> number of words, at most 65535
+  *
+  * @retval None
+  */
+static void crypto_stm32f4_start_stream(dma_stream_t *stream, const void *memory, uint32_t words)
+{
+	DMA_Stream_TypeDef *regs = stream->regs;
+
+	regs->CR = (regs->CR & ~DMA_SxCR_MSIZE) |
+			((((uintptr_t) memory & 3) == 0) ? DMA_MemoryDataSize_Word : DMA_MemoryDataSize_Byte);
+	regs->M0AR = (uint32_t) (uintptr_t) memory;
+	DMA_SetCurrDataCounter(regs, words);
+	(void) dma_stream_clear_flags(stream);
+
+	DMA_Cmd(regs, ENABLE);
+}
+
+/**
+  * @brief  Wait for a stream to finish
+  *
+  * @param  stream -> the stream
+  *
+  * @retval pdPASS, or pdFAIL after a transfer error on any stream
+  */
+static BaseType_t crypto_stm32f4_wait_stream(dma_stream_t *stream)
+{
+	// A bit left set by an earlier transfer only wakes the loop once more
+	while ((DMA_GetCmdStatus(stream->regs) == ENABLE) && (crypto_dma_error == pdFALSE))
+	{
+		(void) xTaskNotifyWait(0, CRYPTO_DMA_NOTIFY_BIT, NULL, portMAX_DELAY);
+	}
+
+	return (crypto_dma_error == pdTRUE) ? pdFAIL : pdPASS;
+}
+
+/**
+  * @brief  Wait for a HASH status flag
+  *
+  * @param  flag -> HASH_FLAG_xxx
+  * @param  until -> the state to wait for
+  *
+  * @retval pdPASS, or pdFAIL if it does not get there
+  */
+static BaseType_t crypto_stm32f4_poll_hash(uint32_t flag, FlagStatus until)
+{
+	uint32_t count;
+
+	for (count = 0; count < CRYPTO_POLL_LIMIT; count++)
+	{
+		if (HASH_GetFlagStatus(flag) == until)
+		{
+			return pdPASS;
+		}
+	}
+
+	return pdFAIL;
+}
+
+/**
+  * @brief  Wait for the CRYP to finish what it is doing
+  *
+  * @param  None
+  *
+  * @retval pdPASS, or pdFAIL if it stays busy
+  */
+static BaseType_t crypto_stm32f4_poll_cryp(void)
+{
+	uint32_t count;
+
+	for (count = 0; count < CRYPTO_POLL_LIMIT; count++)
+	{
+		if (CRYP_GetFlagStatus(CRYP_FLAG_BUSY) == RESET)
+		{
+			return pdPASS;
+		}
+	}
+
+	return pdFAIL;
+}
+
+/**
+  * @brief  Turn the key in the CRYP into the decryption key ECB and CBC
+  * 		decryption start from.  The CRYP is left disabled and must be set
+  * 		up for the job again afterwards
+  *
+  * @param  key_size -> CRYP_KeySize_xxx
+  *
+  * @retval pdPASS, or pdFAIL if the CRYP stays busy
+  */
+static BaseType_t crypto_stm32f4_prepare_key(uint32_t key_size)
+{
+	CRYP_InitTypeDef cryp_init;
+	BaseType_t result;
+
+	cryp_init.CRYP_AlgoDir = CRYP_AlgoDir_Decrypt;
+	cryp_init.CRYP_AlgoMode = CRYP_AlgoMode_AES_Key;
+	cryp_init.CRYP_DataType = CRYP_DataType_32b;
+	cryp_init.CRYP_KeySize = key_size;
+	CRYP_Init(&cryp_init);
+
+	CRYP_Cmd(ENABLE);
+	result = crypto_stm32f4_poll_cryp();
+	CRYP_Cmd(DISABLE);
+
+	return result;
+}
+
+/**
+  * @brief  Whether a job needs its key prepared
+  *
+  * @param  job -> the job
+  *
+  * @retval pdTRUE for ECB and CBC decryption
+  */
+static BaseType_t crypto_stm32f4_decrypting(const crypto_job_t *job)
+{
+	return ((job->decrypt == pdTRUE) && (job->algorithm != CRYPTO_AES_CTR)) ? pdTRUE : pdFALSE;
+}
+
+/**
+  * @brief  Claim the streams and enable the processors' clocks
+  *
+  * @param  None
+  *
+  * @retval pdPASS, or pdFAIL if a stream is in use
+  */
+static BaseType_t crypto_stm32f4_open(void)
+{
+	if (dma_stream_claim(&crypto_out_dma, CRYPTO_DMA_CONTROLLER, CRYPTO_DMA_OUT_STREAM) == pdFAIL)
+	{
+		return pdFAIL;
+	}
+
+	if (dma_stream_claim(&crypto_in_dma, CRYPTO_DMA_CONTROLLER, CRYPTO_DMA_IN_STREAM) == pdFAIL)
+	{
+		dma_stream_free(&crypto_out_dma);
+		return pdFAIL;
+	}
+
+	if (dma_stream_claim(&crypto_hash_dma, CRYPTO_DMA_CONTROLLER, CRYPTO_DMA_HASH_STREAM) == pdFAIL)
+	{
+		dma_stream_free(&crypto_in_dma);
+		dma_stream_free(&crypto_out_dma);
+		return pdFAIL;
+	}
+
+	RCC_AHB2PeriphClockCmd(RCC_AHB2Periph_CRYP | RCC_AHB2Periph_HASH, ENABLE);
+
+	crypto_stm32f4_setup_stream(&crypto_out_dma, DMA_DIR_PeripheralToMemory, &CRYP->DOUT);
+	crypto_stm32f4_setup_stream(&crypto_in_dma, DMA_DIR_MemoryToPeripheral, &CRYP->DR);
+	crypto_stm32f4_setup_stream(&crypto_hash_dma, DMA_DIR_MemoryToPeripheral, &HASH->DIN);
+
+	return pdPASS;
+}
+
+/**
+  * @brief  Free the streams and stop the processors' clocks
+  *
+  * @param  None
+  *
+  * @retval None
+  */
+static void crypto_stm32f4_close(void)
+{
+	RCC_AHB2PeriphClockCmd(RCC_AHB2Periph_CRYP | RCC_AHB2Periph_HASH, DISABLE);
+
+	dma_stream_free(&crypto_hash_dma);
+	dma_stream_free(&crypto_in_dma);
+	dma_stream_free(&crypto_out_dma);
+}
+
+/**
+  * @brief  Set a processor up for a job's first slice.  The key goes into the
+  * 		job's saved context as well, as CRYP_SaveContext() takes it from
+  * 		there rather than from the write-only key registers
+  *
+  * @param  job -> the job
+  *
+  * @retval pdPASS, or pdFAIL if the key could not be prepared
+  */
+static BaseType_t crypto_stm32f4_start(crypto_job_t *job)
+{
+	HASH_InitTypeDef hash_init;
+	CRYP_InitTypeDef cryp_init;
+	CRYP_IVInitTypeDef iv_init;
+	CRYP_KeyInitTypeDef *key = &job->saved.cryp_unit.key;
+	uint32_t words[8];
+	uint32_t i, count;
+
+	if (CRYPTO_IS_HASH(job->algorithm))
+	{
+		HASH_StructInit(&hash_init);
+		hash_init.HASH_AlgoSelection = (job->algorithm == CRYPTO_MD5) ? HASH_AlgoSelection_MD5 :
+				(job->algorithm == CRYPTO_SHA1) ? HASH_AlgoSelection_SHA1 : HASH_AlgoSelection_SHA256;
+		hash_init.HASH_AlgoMode = HASH_AlgoMode_HASH;
+		hash_init.HASH_DataType = HASH_DataType_8b;
+		HASH_Init(&hash_init);
+
+		return pdPASS;
+	}
+
+	// The key registers hold the key big-endian and right aligned, K3R last
+	count = job->key_bits / 32;
+	memset(words, 0, sizeof(words));
+
+	for (i = 0; i < count; i++)
+	{
+		memcpy(&words[8 - count + i], &job->key[i * 4], 4);
+		words[8 - count + i] = __REV(words[8 - count + i]);
+	}
+
+	key->CRYP_Key0Left = words[0];
+	key->CRYP_Key0Right = words[1];
+	key->CRYP_Key1Left = words[2];
+	key->CRYP_Key1Right = words[3];
+	key->CRYP_Key2Left = words[4];
+	key->CRYP_Key2Right = words[5];
+	key->CRYP_Key3Left = words[6];
+	key->CRYP_Key3Right = words[7];
+
+	cryp_init.CRYP_KeySize = (job->key_bits == 128) ? CRYP_KeySize_128b :
+			(job->key_bits == 192) ? CRYP_KeySize_192b : CRYP_KeySize_256b;
+
+	CRYP_Cmd(DISABLE);
+	CRYP_FIFOFlush();
+	CRYP_KeyInit(key);
+
+	if ((crypto_stm32f4_decrypting(job) == pdTRUE) &&
+			(crypto_stm32f4_prepare_key(cryp_init.CRYP_KeySize) == pdFAIL))
+	{
+		return pdFAIL;
+	}
+
+	cryp_init.CRYP_AlgoDir = (crypto_stm32f4_decrypting(job) == pdTRUE) ? CRYP_AlgoDir_Decrypt : CRYP_AlgoDir_Encrypt;
+	cryp_init.CRYP_AlgoMode = (job->algorithm == CRYPTO_AES_ECB) ? CRYP_AlgoMode_AES_ECB :
+			(job->algorithm == CRYPTO_AES_CBC) ? CRYP_AlgoMode_AES_CBC : CRYP_AlgoMode_AES_CTR;
+	cryp_init.CRYP_DataType = CRYP_DataType_8b;
+	CRYP_Init(&cryp_init);
+
+	if (job->algorithm != CRYPTO_AES_ECB)
+	{
+		memcpy(words, job->iv, CRYPTO_AES_BLOCK);
+		iv_init.CRYP_IV0Left = __REV(words[0]);
+		iv_init.CRYP_IV0Right = __REV(words[1]);
+		iv_init.CRYP_IV1Left = __REV(words[2]);
+		iv_init.CRYP_IV1Right = __REV(words[3]);
+		CRYP_IVInit(&iv_init);
+	}
+
+	CRYP_FIFOFlush();
+	CRYP_Cmd(ENABLE);
+
+	return pdPASS;
+}
+
+/**
+  * @brief  Feed a slice of a hash, and read the digest after the last.  The
+  * 		stream writes the whole words with MDMAT set so that the HASH
+  * 		waits for more, and the CPU writes the bytes left over
+  *
+  * @param  job -> the job
+  * @param  input -> the slice
+  * @param  length -> its length, a multiple of 64 unless it is the last
+  * @param  last -> pdTRUE for the last slice
+  *
+  * @retval pdPASS, or pdFAIL after a transfer error or timeout
+  */
+static BaseType_t crypto_stm32f4_hash(crypto_job_t *job, const uint8_t *input, size_t length, BaseType_t last)
+{
+	HASH_MsgDigest digest;
+	uint32_t words = length / 4, tail = length % 4, word = 0, i;
+	BaseType_t result = pdPASS;
+
+	if (words > 0)
+	{
+		crypto_waiting = xTaskGetCurrentTaskHandle();
+		crypto_dma_error = pdFALSE;
+
+		HASH->CR |= HASH_CR_MDMAT;
+		crypto_stm32f4_start_stream(&crypto_hash_dma, input, words);
+		HASH_DMACmd(ENABLE);
+
+		result = crypto_stm32f4_wait_stream(&crypto_hash_dma);
+
+		HASH_DMACmd(DISABLE);
+		crypto_waiting = NULL;
+
+		if (result == pdFAIL)
+		{
+			dma_stream_stop(&crypto_hash_dma);
+			return pdFAIL;
+		}
+	}
+
+	if (crypto_stm32f4_poll_hash(HASH_FLAG_BUSY, RESET) == pdFAIL)
+	{
+		return pdFAIL;
+	}
+
+	if (last == pdFALSE)
+	{
+		return pdPASS;
+	}
+
+	HASH_SetLastWordValidBitsNbr(tail * 8);
+
+	if (tail > 0)
+	{
+		memcpy(&word, &input[words * 4], tail);
+		HASH_DataIn(word);
+	}
+
+	HASH_StartDigest();
+
+	if (crypto_stm32f4_poll_hash(HASH_FLAG_DCIS, SET) == pdFAIL)
+	{
+		return pdFAIL;
+	}
+
+	HASH_GetDigest(&digest);
+
+	for (i = 0; i < (crypto_digest_length(job->algorithm) / 4); i++)
+	{
+		word = __REV(digest.Data[i]);
+		memcpy(&job->output[i * 4], &word, 4);
+	}
+
+	return pdPASS;
+}
+
+/**
+  * @brief  Run a slice through the CRYP, one stream feeding its input FIFO
+  * 		and the other draining its output FIFO
+  *
+  * @param  input -> the slice
+  * @param  output -> where it goes, which may be input
+  * @param  length -> its length, a multiple of 16
+  *
+  * @retval pdPASS, or pdFAIL after a transfer error
+  */
+static BaseType_t crypto_stm32f4_cipher(const uint8_t *input, uint8_t *output, size_t length)
+{
+	BaseType_t result;
+
+	if (length == 0)
+	{
+		return pdPASS;
+	}
+
+	crypto_waiting = xTaskGetCurrentTaskHandle();
+	crypto_dma_error = pdFALSE;
+
+	// The output stream first, so that it is ready for the first block
+	crypto_stm32f4_start_stream(&crypto_out_dma, output, length / 4);
+	crypto_stm32f4_start_stream(&crypto_in_dma, input, length / 4);
+	CRYP_DMACmd(CRYP_DMAReq_DataIN | CRYP_DMAReq_DataOUT, ENABLE);
+
+	result = crypto_stm32f4_wait_stream(&crypto_out_dma);
+
+	CRYP_DMACmd(CRYP_DMAReq_DataIN | CRYP_DMAReq_DataOUT, DISABLE);
+	crypto_waiting = NULL;
+
+	if (result == pdFAIL)
+	{
+		dma_stream_stop(&crypto_in_dma);
+		dma_stream_stop(&crypto_out_dma);
+	}
+
+	return result;
+}
+
+static BaseType_t crypto_stm32f4_process(crypto_job_t *job, const uint8_t *input, uint8_t *output, size_t length,
+		BaseType_t last)
+{
+	if (CRYPTO_IS_HASH(job->algorithm))
+	{
+		return crypto_stm32f4_hash(job, input, length, last);
+	}
+
+	return crypto_stm32f4_cipher(input, output, length);
+}
+
+/**
+  * @brief  Save a processor's state with its job.  Slices end on a block, so
+  * 		the FIFOs are empty once the processor is idle
+  *
+  * @param  job -> the job whose state the processor holds
+  *
+  * @retval None
+  */
+static void crypto_stm32f4_save(crypto_job_t *job)
+{
+	if (CRYPTO_IS_HASH(job->algorithm))
+	{
+		(void) crypto_stm32f4_poll_hash(HASH_FLAG_BUSY, RESET);
+		HASH_SaveContext(&job->saved.hash_unit);
+	}
+	else
+	{
+		(void) CRYP_SaveContext(&job->saved.cryp_unit.regs, &job->saved.cryp_unit.key);
+	}
+}
+
+/**
+  * @brief  Give a processor back a job's state.  The saved key is the one the
+  * 		job started with, so ECB and CBC decryption prepare it again
+  *
+  * @param  job -> the job
+  *
+  * @retval pdPASS, or pdFAIL if the key could not be prepared
+  */
+static BaseType_t crypto_stm32f4_restore(crypto_job_t *job)
+{
+	uint32_t config;
+
+	if (CRYPTO_IS_HASH(job->algorithm))
+	{
+		HASH_RestoreContext(&job->saved.hash_unit);
+		return pdPASS;
+	}
+
+	CRYP_RestoreContext(&job->saved.cryp_unit.regs);
+
+	if (crypto_stm32f4_decrypting(job) == pdTRUE)
+	{
+		CRYP_Cmd(DISABLE);
+		config = CRYP->CR;
+
+		if (crypto_stm32f4_prepare_key(config & CRYP_CR_KEYSIZE) == pdFAIL)
+		{
+			return pdFAIL;
+		}
+
+		CRYP->CR = config;
+		CRYP_FIFOFlush();
+		CRYP_Cmd(ENABLE);
+	}
+
+	return pdPASS;
+}
+
+const crypto_engine_t crypto_stm32f4_engine =
+{
+	crypto_stm32f4_open,
+	crypto_stm32f4_close,
+	crypto_stm32f4_start,
+	crypto_stm32f4_process,
+	crypto_stm32f4_save,
+	crypto_stm32f4_restore
+};
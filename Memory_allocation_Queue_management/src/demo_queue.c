@@ -17,6 +17,9 @@ void queue_init(void)
 	demo_queue_handler = xQueueCreate(5, sizeof(Queue_st));
 
 	if (demo_queue_handler != NULL) {
+		// Name the queue in the trace
+		vQueueAddToRegistry(demo_queue_handler, "Demo Queue");
+
 		char *str = "Queue successfully created\r\n\n";
 		prvPrintMsg(str);
 	} else {
@@ -0,0 +1,467 @@
+/**
+  ******************************************************************************
+  * @file    dma_manager.c
+  * @brief   RTOS aware DMA stream manager (see dma_manager.h).  Registers are
+  * 		 only reached through the dma_hw_t given to dma_manager_init(),
+  * 		 so the manager also runs against simulated registers on the
+  * 		 host.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "dma_manager.h"
+
+// Interrupt flags of one stream in LISR/HISR, and where those of each of the
+// four streams in the register start
+#define DMA_STREAM_ALL_FLAGS	(DMA_STREAM_FEIF | DMA_STREAM_DMEIF | DMA_STREAM_TEIF | DMA_STREAM_HTIF | DMA_STREAM_TCIF)
+
+static const uint8_t dma_flag_shift[4] = { 0, 6, 16, 22 };
+
+static const dma_hw_t *dma_hw;
+static dma_stream_t *dma_owner[DMA_CONTROLLERS][DMA_STREAMS_PER_CONTROLLER];
+
+/**
+  * @brief  Read and clear the interrupt flags of a stream
+  *
+  * @param  controller -> 1 or 2
+  * @param  number -> stream number, 0 to 7
+  *
+  * @retval The flags, as DMA_STREAM_xxIF bits
+  */
+static uint32_t dma_take_flags(uint32_t controller, uint32_t number)
+{
+	DMA_TypeDef *regs = dma_hw->controller[controller - 1];
+	uint32_t shift = dma_flag_shift[number & 3];
+	uint32_t flags;
+
+	if (number < 4)
+	{
+		flags = (regs->LISR >> shift) & DMA_STREAM_ALL_FLAGS;
+	}
+	else
+	{
+		flags = (regs->HISR >> shift) & DMA_STREAM_ALL_FLAGS;
+	}
+
+	if (flags != 0)
+	{
+		dma_hw->clear_flags(regs, (number < 4) ? 0 : 1, flags << shift);
+	}
+
+	return flags;
+}
+
+/**
+  * @brief  Set the register blocks the manager uses.  Called once, before any
+  * 		stream is claimed
+  *
+  * @param  hw -> &dma_stm32f4_hw, or simulated registers
+  *
+  * @retval None
+  */
+void dma_manager_init(const dma_hw_t *hw)
+{
+	configASSERT(hw != NULL);
+
+	dma_hw = hw;
+	memset(dma_owner, 0, sizeof(dma_owner));
+}
+
+/**
+  * @brief  Claim a stream for the calling driver, and enable its interrupt
+  *
+  * @param  stream -> state of the stream, kept until dma_stream_free()
+  * @param  controller -> 1 or 2
+  * @param  number -> stream number, 0 to 7
+  *
+  * @retval pdPASS, or pdFAIL if the stream is already claimed
+  */
+BaseType_t dma_stream_claim(dma_stream_t *stream, uint32_t controller, uint32_t number)
+{
+	BaseType_t result = pdFAIL;
+
+	configASSERT(dma_hw != NULL);
+	configASSERT((controller >= 1) && (controller <= DMA_CONTROLLERS));
+	configASSERT(number < DMA_STREAMS_PER_CONTROLLER);
+
+	taskENTER_CRITICAL();
+	{
+		if (dma_owner[controller - 1][number] == NULL)
+		{
+			dma_owner[controller - 1][number] = stream;
+			result = pdPASS;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if (result == pdPASS)
+	{
+		memset(stream, 0, sizeof(dma_stream_t));
+		stream->controller = controller;
+		stream->number = number;
+		stream->regs = dma_hw->stream[controller - 1][number];
+		dma_hw->enable_stream(controller, number, ENABLE);
+	}
+
+	return result;
+}
+
+/**
+  * @brief  Stop a stream if it is running and give it up.  Buffers still in
+  * 		its queue are lost
+  *
+  * @param  stream -> a claimed stream
+  *
+  * @retval None
+  */
+void dma_stream_free(dma_stream_t *stream)
+{
+	dma_stream_stop(stream);
+	dma_hw->enable_stream(stream->controller, stream->number, DISABLE);
+
+	if (stream->filled != NULL)
+	{
+		vQueueDelete(stream->filled);
+		stream->filled = NULL;
+	}
+
+	taskENTER_CRITICAL();
+	{
+		dma_owner[stream->controller - 1][stream->number] = NULL;
+	}
+	taskEXIT_CRITICAL();
+}
+
+/**
+  * @brief  Hand the interrupts of a claimed stream to the driver, which then
+  * 		programs the stream itself through stream->regs instead of
+  * 		starting it with dma_stream_start()
+  *
+  * @param  stream -> a claimed stream that is not running
+  * @param  handler -> called from the stream's interrupt with its flags,
+  * 		which have already been cleared
+  * @param  context -> passed to the handler
+  *
+  * @retval None
+  */
+void dma_stream_set_handler(dma_stream_t *stream, dma_stream_handler_t handler, void *context)
+{
+	configASSERT(stream->running == pdFALSE);
+
+	taskENTER_CRITICAL();
+	{
+		stream->handler = handler;
+		stream->context = context;
+	}
+	taskEXIT_CRITICAL();
+}
+
+/**
+  * @brief  Clear the interrupt flags of a stream, which must be done before a
+  * 		driver that programs the stream itself enables it again
+  *
+  * @param  stream -> a claimed stream that is not enabled
+  *
+  * @retval The flags that were set, as DMA_STREAM_xxIF bits
+  */
+uint32_t dma_stream_clear_flags(dma_stream_t *stream)
+{
+	return dma_take_flags(stream->controller, stream->number);
+}
+
+/**
+  * @brief  Start a stream reading from a peripheral into a pool of buffers.
+  * 		The first two buffers are the memory 0 and memory 1 targets of the
+  * 		stream, and as each is filled the stream switches to the other
+  * 		while the interrupt hands the filled buffer to the task and puts
+  * 		a free buffer in its place.  The peripheral's own DMA requests
+  * 		are enabled by the caller afterwards
+  *
+  * @param  stream -> a claimed stream that is not running
+  * @param  config -> how to read the peripheral, copied by the call
+  *
+  * @retval pdPASS, or pdFAIL if the queue of filled buffers could not be
+  * 		created
+  */
+BaseType_t dma_stream_start(dma_stream_t *stream, const dma_stream_config_t *config)
+{
+	DMA_InitTypeDef dma_init;
+	uint32_t items = config->buffer_size / config->item_size;
+
+	configASSERT((stream->running == pdFALSE) && (stream->handler == NULL));
+	configASSERT((config->buffer_count >= 2) && (config->buffer_count <= DMA_STREAM_MAX_BUFFERS));
+	configASSERT((items > 0) && (items <= 0xFFFF) && ((items * config->item_size) == config->buffer_size));
+
+	stream->config = *config;
+	stream->target[0] = 0;
+	stream->target[1] = 1;
+	stream->free_count = 0;
+	for (uint32_t buffer = config->buffer_count - 1; buffer >= 2; buffer--)
+	{
+		stream->free_list[stream->free_count++] = (uint8_t) buffer;
+	}
+
+	// The queue can never be full, as it holds at most every buffer
+	if (stream->filled == NULL)
+	{
+		stream->filled = xQueueCreate(DMA_STREAM_MAX_BUFFERS, sizeof(dma_buffer_t));
+
+		if (stream->filled == NULL)
+		{
+			return pdFAIL;
+		}
+	}
+
+	xQueueReset(stream->filled);
+	stream->sequence = 0;
+	memset(&stream->stats, 0, sizeof(stream->stats));
+
+	// The stream may still be finishing a transfer it was stopped during
+	DMA_Cmd(stream->regs, DISABLE);
+	while (DMA_GetCmdStatus(stream->regs) == ENABLE);
+	(void) dma_take_flags(stream->controller, stream->number);
+
+	DMA_StructInit(&dma_init);
+	dma_init.DMA_Channel = config->channel;
+	dma_init.DMA_PeripheralBaseAddr = (uint32_t) (uintptr_t) config->peripheral;
+	dma_init.DMA_Memory0BaseAddr = (uint32_t) (uintptr_t) config->buffers[0];
+	dma_init.DMA_DIR = DMA_DIR_PeripheralToMemory;
+	dma_init.DMA_BufferSize = items;
+	dma_init.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	dma_init.DMA_Mode = DMA_Mode_Circular;
+	dma_init.DMA_Priority = config->priority;
+
+	switch (config->item_size)
+	{
+	case 1:
+		dma_init.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+		dma_init.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+		break;
+	case 2:
+		dma_init.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+		dma_init.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+		break;
+	default:
+		configASSERT(config->item_size == 4);
+		dma_init.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+		dma_init.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+		break;
+	}
+
+	DMA_Init(stream->regs, &dma_init);
+	DMA_DoubleBufferModeConfig(stream->regs, (uint32_t) (uintptr_t) config->buffers[1], DMA_Memory_0);
+	DMA_DoubleBufferModeCmd(stream->regs, ENABLE);
+	DMA_ITConfig(stream->regs, DMA_IT_TC | DMA_IT_TE | DMA_IT_DME, ENABLE);
+
+	stream->start_us = ullTaskGetMonotonicTimeUs();
+	stream->running = pdTRUE;
+
+	DMA_Cmd(stream->regs, ENABLE);
+
+	return pdPASS;
+}
+
+/**
+  * @brief  Stop a stream.  Filled buffers already in its queue can still be
+  * 		received, and must still be released
+  *
+  * @param  stream -> a claimed stream
+  *
+  * @retval None
+  */
+void dma_stream_stop(dma_stream_t *stream)
+{
+	DMA_ITConfig(stream->regs, DMA_IT_TC | DMA_IT_HT | DMA_IT_TE | DMA_IT_DME, DISABLE);
+	DMA_Cmd(stream->regs, DISABLE);
+	while (DMA_GetCmdStatus(stream->regs) == ENABLE);
+
+	taskENTER_CRITICAL();
+	{
+		stream->running = pdFALSE;
+	}
+	taskEXIT_CRITICAL();
+}
+
+/**
+  * @brief  Wait for the next filled buffer of a stream
+  *
+  * @param  stream -> a claimed stream
+  * @param  buffer -> set to the filled buffer, which must be released once
+  * 		the task has finished with it
+  * @param  timeout -> ticks to wait
+  *
+  * @retval pdPASS, or pdFAIL if no buffer was filled within the timeout
+  */
+BaseType_t dma_stream_receive(dma_stream_t *stream, dma_buffer_t *buffer, TickType_t timeout)
+{
+	return xQueueReceive(stream->filled, buffer, timeout);
+}
+
+/**
+  * @brief  Give a buffer received with dma_stream_receive() back to its
+  * 		stream to be filled again
+  *
+  * @param  stream -> the stream the buffer was received from
+  * @param  buffer -> the received buffer, which must not already have been
+  * 		released
+  *
+  * @retval None
+  */
+void dma_stream_release(dma_stream_t *stream, const dma_buffer_t *buffer)
+{
+	uint32_t index = 0;
+
+	while ((index < stream->config.buffer_count) && (stream->config.buffers[index] != buffer->data))
+	{
+		index++;
+	}
+
+	// Not a buffer of this stream, which is ignored if asserts are off
+	configASSERT(index < stream->config.buffer_count);
+	if (index == stream->config.buffer_count)
+	{
+		return;
+	}
+
+	taskENTER_CRITICAL();
+	{
+		// Two buffers are always memory targets, so the rest can all be free
+		// only if this one was released twice
+		configASSERT(stream->free_count < (stream->config.buffer_count - 2));
+
+		// A buffer the task holds is neither a target nor free
+		configASSERT((stream->target[0] != index) && (stream->target[1] != index));
+		for (uint32_t free = 0; free < stream->free_count; free++)
+		{
+			configASSERT(stream->free_list[free] != index);
+		}
+
+		stream->free_list[stream->free_count++] = (uint8_t) index;
+	}
+	taskEXIT_CRITICAL();
+}
+
+/**
+  * @brief  Read the counters of a stream
+  *
+  * @param  stream -> a claimed stream
+  * @param  stats -> set to the counters since the stream was started
+  *
+  * @retval None
+  */
+void dma_stream_get_stats(dma_stream_t *stream, dma_stream_stats_t *stats)
+{
+	uint64_t elapsed_us;
+
+	taskENTER_CRITICAL();
+	{
+		*stats = stream->stats;
+	}
+	taskEXIT_CRITICAL();
+
+	elapsed_us = ullTaskGetMonotonicTimeUs() - stream->start_us;
+	stats->bytes_per_second = (elapsed_us > 0) ? (uint32_t) ((stats->bytes * 1000000ULL) / elapsed_us) : 0;
+}
+
+/**
+  * @brief  Handle the transfer complete interrupt of a running stream.  The
+  * 		stream has switched to its other memory target, so the buffer in
+  * 		the target it left is full
+  *
+  * @param  stream -> the stream
+  * @param  woken -> set to pdTRUE if a task of higher priority was woken
+  *
+  * @retval None
+  */
+static void dma_stream_complete(dma_stream_t *stream, BaseType_t *woken)
+{
+	uint32_t done_target = (DMA_GetCurrentMemoryTarget(stream->regs) == 0) ? 1 : 0;
+	uint8_t done = stream->target[done_target];
+	BaseType_t deliver = pdFALSE, sent;
+	UBaseType_t saved_status;
+	dma_buffer_t buffer;
+
+	saved_status = taskENTER_CRITICAL_FROM_ISR();
+	{
+		if (stream->free_count > 0)
+		{
+			// Fill a free buffer next time instead, which the stream allows
+			// as this target is not the one in use
+			uint8_t next = stream->free_list[--stream->free_count];
+
+			stream->target[done_target] = next;
+			DMA_MemoryTargetConfig(stream->regs, (uint32_t) (uintptr_t) stream->config.buffers[next],
+					(done_target == 0) ? DMA_Memory_0 : DMA_Memory_1);
+
+			stream->stats.buffers++;
+			stream->stats.bytes += stream->config.buffer_size;
+			deliver = pdTRUE;
+		}
+		else
+		{
+			// The task holds every other buffer, so this one is filled again
+			stream->stats.overruns++;
+		}
+	}
+	taskEXIT_CRITICAL_FROM_ISR(saved_status);
+
+	if (deliver == pdTRUE)
+	{
+		buffer.data = stream->config.buffers[done];
+		buffer.length = stream->config.buffer_size;
+		buffer.sequence = stream->sequence;
+		buffer.time_us = ullTaskGetMonotonicTimeUsFromISR();
+
+		sent = xQueueSendFromISR(stream->filled, &buffer, woken);
+		configASSERT(sent == pdPASS);
+
+		if (stream->config.notify_task != NULL)
+		{
+			xTaskNotifyFromISR(stream->config.notify_task, stream->config.notify_bits, eSetBits, woken);
+		}
+	}
+
+	stream->sequence++;
+}
+
+/**
+  * @brief  Interrupt handler of every stream, called by the stream's IRQ
+  * 		handler
+  *
+  * @param  controller -> 1 or 2
+  * @param  number -> stream number, 0 to 7
+  *
+  * @retval pdTRUE if a context switch should be requested
+  */
+BaseType_t dma_manager_irq(uint32_t controller, uint32_t number)
+{
+	dma_stream_t *stream = dma_owner[controller - 1][number];
+	uint32_t flags = dma_take_flags(controller, number);
+	BaseType_t woken = pdFALSE;
+
+	if ((stream != NULL) && (stream->handler != NULL))
+	{
+		stream->handler(stream, flags, stream->context, &woken);
+	}
+	else if ((stream != NULL) && (stream->running == pdTRUE))
+	{
+		if ((flags & (DMA_STREAM_TEIF | DMA_STREAM_DMEIF)) != 0)
+		{
+			stream->stats.errors++;
+		}
+
+		if ((flags & DMA_STREAM_TEIF) != 0)
+		{
+			// The stream has been disabled by the controller
+			stream->running = pdFALSE;
+		}
+
+		if ((flags & DMA_STREAM_TCIF) != 0)
+		{
+			dma_stream_complete(stream, &woken);
+		}
+	}
+
+	return woken;
+}
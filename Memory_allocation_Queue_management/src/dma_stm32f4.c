@@ -0,0 +1,114 @@
+/**
+  ******************************************************************************
+  * @file    dma_stm32f4.c
+  * @brief   The DMA controllers of the STM32F4 for the DMA stream manager
+  * 		 (dma_manager.h), and the interrupt handlers of their streams.
+  ******************************************************************************
+*/
+
+#include "dma_manager.h"
+#include "trace_recorder.h"
+
+// Priority of the stream interrupts, which call FreeRTOS API functions so must
+// not be above configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY
+#define DMA_IRQ_PRIORITY		(6)
+
+static const IRQn_Type dma_irq[DMA_CONTROLLERS][DMA_STREAMS_PER_CONTROLLER] =
+{
+	{ DMA1_Stream0_IRQn, DMA1_Stream1_IRQn, DMA1_Stream2_IRQn, DMA1_Stream3_IRQn,
+	  DMA1_Stream4_IRQn, DMA1_Stream5_IRQn, DMA1_Stream6_IRQn, DMA1_Stream7_IRQn },
+	{ DMA2_Stream0_IRQn, DMA2_Stream1_IRQn, DMA2_Stream2_IRQn, DMA2_Stream3_IRQn,
+	  DMA2_Stream4_IRQn, DMA2_Stream5_IRQn, DMA2_Stream6_IRQn, DMA2_Stream7_IRQn }
+};
+
+/**
+  * @brief  Enable the clock of a stream's controller and the stream's
+  * 		interrupt, or disable the interrupt
+  *
+  * @param  controller -> 1 or 2
+  * @param  stream -> stream number, 0 to 7
+  * @param  state -> ENABLE or DISABLE
+  *
+  * @retval None
+  */
+static void dma_stm32f4_enable_stream(uint32_t controller, uint32_t stream, FunctionalState state)
+{
+	IRQn_Type irq = dma_irq[controller - 1][stream];
+
+	if (state == ENABLE)
+	{
+		// The clock is left on when the stream is freed, as other streams of
+		// the controller may be in use
+		RCC_AHB1PeriphClockCmd((controller == 1) ? RCC_AHB1Periph_DMA1 : RCC_AHB1Periph_DMA2, ENABLE);
+		NVIC_SetPriority(irq, DMA_IRQ_PRIORITY);
+		NVIC_EnableIRQ(irq);
+	}
+	else
+	{
+		NVIC_DisableIRQ(irq);
+	}
+}
+
+/**
+  * @brief  Clear interrupt flags of a controller
+  *
+  * @param  controller -> DMA1 or DMA2
+  * @param  high -> 0 for streams 0 to 3, 1 for streams 4 to 7
+  * @param  flags -> the flags, as they are in LISR or HISR
+  *
+  * @retval None
+  */
+static void dma_stm32f4_clear_flags(DMA_TypeDef *controller, uint32_t high, uint32_t flags)
+{
+	if (high == 0)
+	{
+		controller->LIFCR = flags;
+	}
+	else
+	{
+		controller->HIFCR = flags;
+	}
+}
+
+const dma_hw_t dma_stm32f4_hw =
+{
+	{ DMA1, DMA2 },
+	{
+		{ DMA1_Stream0, DMA1_Stream1, DMA1_Stream2, DMA1_Stream3,
+		  DMA1_Stream4, DMA1_Stream5, DMA1_Stream6, DMA1_Stream7 },
+		{ DMA2_Stream0, DMA2_Stream1, DMA2_Stream2, DMA2_Stream3,
+		  DMA2_Stream4, DMA2_Stream5, DMA2_Stream6, DMA2_Stream7 }
+	},
+	dma_stm32f4_enable_stream,
+	dma_stm32f4_clear_flags
+};
+
+// Each handler passes its stream to the manager
+#define DMA_IRQ_HANDLER(controller, stream)											\
+	void DMA##controller##_Stream##stream##_IRQHandler(void)						\
+	{																				\
+		BaseType_t woken;															\
+																					\
+		vTraceRecorderISRBegin(DMA##controller##_Stream##stream##_IRQn);			\
+		woken = dma_manager_irq(controller, stream);								\
+		vTraceRecorderISREnd(DMA##controller##_Stream##stream##_IRQn);				\
+																					\
+		portYIELD_FROM_ISR(woken);													\
+	}
+
+DMA_IRQ_HANDLER(1, 0)
+DMA_IRQ_HANDLER(1, 1)
+DMA_IRQ_HANDLER(1, 2)
+DMA_IRQ_HANDLER(1, 3)
+DMA_IRQ_HANDLER(1, 4)
+DMA_IRQ_HANDLER(1, 5)
+DMA_IRQ_HANDLER(1, 6)
+DMA_IRQ_HANDLER(1, 7)
+DMA_IRQ_HANDLER(2, 0)
+DMA_IRQ_HANDLER(2, 1)
+DMA_IRQ_HANDLER(2, 2)
+DMA_IRQ_HANDLER(2, 3)
+DMA_IRQ_HANDLER(2, 4)
+DMA_IRQ_HANDLER(2, 5)
+DMA_IRQ_HANDLER(2, 6)
+DMA_IRQ_HANDLER(2, 7)
@@ -0,0 +1,960 @@
+/**
+  ******************************************************************************
+  * @file    i2c_bus.c
+  * @brief   Non-blocking I2C master (see i2c_bus.h).  Each event interrupt
+  * 		 moves the running transaction one step on, so a task never polls
+  * 		 the I2C and clock stretching by a device costs nothing.  Registers
+  * 		 are only reached through the configuration, the i2c_hw_t and the
+  * 		 dma_hw_t of the DMA stream manager, so the bus also runs against
+  * 		 simulated registers on the host.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "i2c_bus.h"
+
+// Error flags of SR1, cleared by writing 0 to them
+#define I2C_ERROR_FLAGS			(I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_AF | I2C_SR1_OVR)
+
+static i2c_bus_t *i2c_bus[I2C_MAX_BUSES];
+
+/**
+  * @brief  Find the open bus of an I2C
+  *
+  * @param  regs -> the I2C
+  *
+  * @retval The bus, or NULL if it is not open
+  */
+static i2c_bus_t *i2c_find(I2C_TypeDef *regs)
+{
+	for (uint32_t index = 0; index < I2C_MAX_BUSES; index++)
+	{
+		if ((i2c_bus[index] != NULL) && (i2c_bus[index]->config.regs == regs))
+		{
+			return i2c_bus[index];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+  * @brief  Whether a transfer is long enough to be moved by DMA
+  *
+  * @param  bus -> the bus
+  * @param  length -> bytes to transfer
+  *
+  * @retval pdTRUE or pdFALSE
+  */
+static BaseType_t i2c_use_dma(const i2c_bus_t *bus, uint16_t length)
+{
+	return ((bus->config.dma_controller != 0) && (length >= I2C_DMA_MIN_LENGTH)) ? pdTRUE : pdFALSE;
+}
+
+/**
+  * @brief  Point a stream at a buffer and enable it, and let the I2C make
+  * 		requests of it
+  *
+  * @param  bus -> the bus
+  * @param  stream -> the receive or transmit stream, which is not enabled
+  * @param  buffer -> the buffer
+  * @param  length -> bytes to transfer
+  *
+  * @retval None
+  */
+static void i2c_start_stream(i2c_bus_t *bus, dma_stream_t *stream, const uint8_t *buffer, uint16_t length)
+{
+	DMA_MemoryTargetConfig(stream->regs, (uint32_t) (uintptr_t) buffer, DMA_Memory_0);
+	DMA_SetCurrDataCounter(stream->regs, length);
+	(void) dma_stream_clear_flags(stream);
+	DMA_Cmd(stream->regs, ENABLE);
+	I2C_DMACmd(bus->config.regs, ENABLE);
+}
+
+/**
+  * @brief  Stop the interrupts and DMA of the running transaction
+  *
+  * @param  bus -> the bus
+  *
+  * @retval None
+  */
+static void i2c_stop_transfer(i2c_bus_t *bus)
+{
+	I2C_ITConfig(bus->config.regs, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR, DISABLE);
+	I2C_DMACmd(bus->config.regs, DISABLE);
+	I2C_DMALastTransferCmd(bus->config.regs, DISABLE);
+
+	// Stopping a stream early sets its flags, which are cleared so they do not
+	// end the next transaction
+	if (bus->config.dma_controller != 0)
+	{
+		DMA_Cmd(bus->rx_dma.regs, DISABLE);
+		DMA_Cmd(bus->tx_dma.regs, DISABLE);
+		while ((DMA_GetCmdStatus(bus->rx_dma.regs) == ENABLE) || (DMA_GetCmdStatus(bus->tx_dma.regs) == ENABLE));
+		(void) dma_stream_clear_flags(&bus->rx_dma);
+		(void) dma_stream_clear_flags(&bus->tx_dma);
+	}
+}
+
+/**
+  * @brief  Start the first waiting transaction, if there is one and the bus
+  * 		does not need recovering.  Called from a critical section with the
+  * 		bus idle
+  *
+  * @param  bus -> the bus
+  * @param  now_us -> the monotonic time
+  *
+  * @retval None
+  */
+static void i2c_start_next(i2c_bus_t *bus, uint64_t now_us)
+{
+	i2c_transaction_t *transaction = bus->head;
+
+	if ((transaction == NULL) || (bus->recover == pdTRUE))
+	{
+		return;
+	}
+
+	bus->head = transaction->next;
+	if (bus->head == NULL)
+	{
+		bus->tail = NULL;
+	}
+
+	bus->queued--;
+	bus->active = transaction;
+	bus->start_us = now_us;
+	transaction->status = I2C_ACTIVE;
+
+	bus->reading = (transaction->tx_length == 0) ? pdTRUE : pdFALSE;
+	bus->index = 0;
+	bus->state = I2C_STATE_START;
+
+	I2C_ITConfig(bus->config.regs, I2C_IT_EVT | I2C_IT_ERR, ENABLE);
+	I2C_GenerateSTART(bus->config.regs, ENABLE);
+}
+
+/**
+  * @brief  Finish the running transaction, start the next, and then report
+  * 		the finished one.  Called from the bus interrupts, or from the
+  * 		timer task after a timeout
+  *
+  * @param  bus -> the bus
+  * @param  status -> how the transaction ended
+  * @param  woken -> set to pdTRUE if a task of higher priority was woken
+  *
+  * @retval None
+  */
+static void i2c_complete(i2c_bus_t *bus, i2c_status_t status, BaseType_t *woken)
+{
+	i2c_transaction_t *done = bus->active;
+	i2c_callback_t callback;
+	TaskHandle_t notify_task;
+	uint32_t notify_bits;
+	UBaseType_t saved_status;
+	uint64_t now_us;
+
+	if (done == NULL)
+	{
+		return;
+	}
+
+	i2c_stop_transfer(bus);
+
+	// Taken before the transaction is given back, after which it may be reused
+	callback = done->callback;
+	notify_task = done->notify_task;
+	notify_bits = done->notify_bits;
+
+	now_us = ullTaskGetMonotonicTimeUsFromISR();
+
+	saved_status = taskENTER_CRITICAL_FROM_ISR();
+	{
+		done->latency_us = (uint32_t) (now_us - done->queued_us);
+
+		bus->stats.transactions++;
+		bus->stats.busy_us += now_us - bus->start_us;
+		bus->latency_total_us += done->latency_us;
+		if (done->latency_us > bus->stats.latency_max_us)
+		{
+			bus->stats.latency_max_us = done->latency_us;
+		}
+
+		switch (status)
+		{
+		case I2C_DONE:
+			bus->stats.bytes += done->tx_length + done->rx_length;
+			break;
+
+		case I2C_NACK:
+			bus->stats.nacks++;
+			break;
+
+		case I2C_TIMEOUT:
+			bus->stats.timeouts++;
+			break;
+
+		default:
+			bus->stats.bus_errors++;
+			break;
+		}
+
+		done->status = status;
+		bus->state = I2C_STATE_IDLE;
+		bus->active = NULL;
+		i2c_start_next(bus, now_us);
+	}
+	taskEXIT_CRITICAL_FROM_ISR(saved_status);
+
+	if (callback != NULL)
+	{
+		callback(done, woken);
+	}
+
+	if (notify_task != NULL)
+	{
+		xTaskNotifyFromISR(notify_task, notify_bits, eSetBits, woken);
+	}
+}
+
+/**
+  * @brief  The device has acknowledged its address for writing.  Start
+  * 		writing, by DMA or by the buffer interrupt
+  *
+  * @param  bus -> the bus
+  * @param  transaction -> the running transaction
+  *
+  * @retval None
+  */
+static void i2c_address_write(i2c_bus_t *bus, const i2c_transaction_t *transaction)
+{
+	I2C_TypeDef *regs = bus->config.regs;
+
+	if (i2c_use_dma(bus, transaction->tx_length) == pdTRUE)
+	{
+		i2c_start_stream(bus, &bus->tx_dma, transaction->tx, transaction->tx_length);
+		bus->state = I2C_STATE_WRITE_DMA;
+	}
+	else
+	{
+		I2C_ITConfig(regs, I2C_IT_BUF, ENABLE);
+		bus->state = I2C_STATE_WRITE;
+	}
+
+	// Reading SR2 after SR1 clears ADDR and releases the clock
+	(void) regs->SR2;
+}
+
+/**
+  * @brief  The device has acknowledged its address for reading.  Start
+  * 		reading, by DMA or by the buffer interrupt, arranging for the last
+  * 		byte to be answered with a NACK and a stop
+  *
+  * @param  bus -> the bus
+  * @param  transaction -> the running transaction
+  *
+  * @retval None
+  */
+static void i2c_address_read(i2c_bus_t *bus, const i2c_transaction_t *transaction)
+{
+	I2C_TypeDef *regs = bus->config.regs;
+
+	if (transaction->rx_length == 1)
+	{
+		// The only byte is the last, so the NACK and stop are set up now
+		I2C_AcknowledgeConfig(regs, DISABLE);
+		(void) regs->SR2;
+		I2C_GenerateSTOP(regs, ENABLE);
+		I2C_ITConfig(regs, I2C_IT_BUF, ENABLE);
+		bus->state = I2C_STATE_READ;
+	}
+	else if (i2c_use_dma(bus, transaction->rx_length) == pdTRUE)
+	{
+		// With LAST set the I2C answers the byte after the stream's last but
+		// one with a NACK
+		I2C_AcknowledgeConfig(regs, ENABLE);
+		I2C_DMALastTransferCmd(regs, ENABLE);
+		i2c_start_stream(bus, &bus->rx_dma, transaction->rx, transaction->rx_length);
+		(void) regs->SR2;
+		bus->state = I2C_STATE_READ_DMA;
+	}
+	else
+	{
+		I2C_AcknowledgeConfig(regs, ENABLE);
+		I2C_ITConfig(regs, I2C_IT_BUF, ENABLE);
+		(void) regs->SR2;
+		bus->state = I2C_STATE_READ;
+	}
+}
+
+/**
+  * @brief  The last byte written has left the I2C.  Send a repeated start to
+  * 		read, or a stop
+  *
+  * @param  bus -> the bus
+  * @param  woken -> set to pdTRUE if a task of higher priority was woken
+  *
+  * @retval None
+  */
+static void i2c_write_end(i2c_bus_t *bus, BaseType_t *woken)
+{
+	if (bus->active->rx_length > 0)
+	{
+		bus->reading = pdTRUE;
+		bus->index = 0;
+		bus->state = I2C_STATE_START;
+		I2C_GenerateSTART(bus->config.regs, ENABLE);
+	}
+	else
+	{
+		I2C_GenerateSTOP(bus->config.regs, ENABLE);
+		i2c_complete(bus, I2C_DONE, woken);
+	}
+}
+
+/**
+  * @brief  Move the running transaction on from an event
+  *
+  * @param  bus -> the bus
+  * @param  woken -> set to pdTRUE if a task of higher priority was woken
+  *
+  * @retval None
+  */
+static void i2c_event(i2c_bus_t *bus, BaseType_t *woken)
+{
+	I2C_TypeDef *regs = bus->config.regs;
+	i2c_transaction_t *transaction = bus->active;
+	uint16_t status = regs->SR1;
+
+	if (transaction == NULL)
+	{
+		return;
+	}
+
+	switch (bus->state)
+	{
+	case I2C_STATE_START:
+		// Reading SR1 and then writing the address clears SB
+		if ((status & I2C_SR1_SB) != 0)
+		{
+			I2C_Send7bitAddress(regs, (uint8_t) (transaction->address << 1),
+					(bus->reading == pdTRUE) ? I2C_Direction_Receiver : I2C_Direction_Transmitter);
+			bus->state = I2C_STATE_ADDRESS;
+		}
+		break;
+
+	case I2C_STATE_ADDRESS:
+		if ((status & I2C_SR1_ADDR) != 0)
+		{
+			if (bus->reading == pdTRUE)
+			{
+				i2c_address_read(bus, transaction);
+			}
+			else
+			{
+				i2c_address_write(bus, transaction);
+			}
+		}
+		break;
+
+	case I2C_STATE_WRITE:
+		if ((status & I2C_SR1_TXE) != 0)
+		{
+			if (bus->index < transaction->tx_length)
+			{
+				I2C_SendData(regs, transaction->tx[bus->index++]);
+			}
+			else
+			{
+				// BTF follows once the last byte has left
+				I2C_ITConfig(regs, I2C_IT_BUF, DISABLE);
+				bus->state = I2C_STATE_WRITE_END;
+			}
+		}
+		break;
+
+	case I2C_STATE_WRITE_DMA:
+	case I2C_STATE_WRITE_END:
+		// BTF can come before the transmit stream's interrupt, and is not
+		// cleared until the write is ended
+		if ((status & I2C_SR1_BTF) != 0)
+		{
+			I2C_DMACmd(regs, DISABLE);
+			i2c_write_end(bus, woken);
+		}
+		break;
+
+	case I2C_STATE_READ:
+		if ((status & I2C_SR1_RXNE) != 0)
+		{
+			// Two bytes from the end the last has not been acknowledged yet,
+			// so it can still be answered with a NACK and a stop
+			if ((transaction->rx_length - bus->index) == 2)
+			{
+				I2C_AcknowledgeConfig(regs, DISABLE);
+				I2C_GenerateSTOP(regs, ENABLE);
+			}
+
+			transaction->rx[bus->index++] = I2C_ReceiveData(regs);
+
+			if (bus->index == transaction->rx_length)
+			{
+				i2c_complete(bus, I2C_DONE, woken);
+			}
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+/**
+  * @brief  Handle the interrupts of the receive stream, which ends a read
+  *
+  * @param  stream -> the receive stream
+  * @param  flags -> DMA_STREAM_xxIF flags that were set
+  * @param  context -> the bus
+  * @param  woken -> set to pdTRUE if a task of higher priority was woken
+  *
+  * @retval None
+  */
+static void i2c_rx_dma_handler(dma_stream_t *stream, uint32_t flags, void *context, BaseType_t *woken)
+{
+	i2c_bus_t *bus = (i2c_bus_t *) context;
+
+	(void) stream;
+
+	bus->stats.interrupts++;
+
+	if (bus->state != I2C_STATE_READ_DMA)
+	{
+		return;
+	}
+
+	if ((flags & DMA_STREAM_TEIF) != 0)
+	{
+		I2C_GenerateSTOP(bus->config.regs, ENABLE);
+		i2c_complete(bus, I2C_BUS_ERROR, woken);
+	}
+	else if ((flags & DMA_STREAM_TCIF) != 0)
+	{
+		I2C_GenerateSTOP(bus->config.regs, ENABLE);
+		i2c_complete(bus, I2C_DONE, woken);
+	}
+}
+
+/**
+  * @brief  Handle the interrupts of the transmit stream.  Once it has given
+  * 		the I2C the last byte, BTF marks the end of the write
+  *
+  * @param  stream -> the transmit stream
+  * @param  flags -> DMA_STREAM_xxIF flags that were set
+  * @param  context -> the bus
+  * @param  woken -> set to pdTRUE if a task of higher priority was woken
+  *
+  * @retval None
+  */
+static void i2c_tx_dma_handler(dma_stream_t *stream, uint32_t flags, void *context, BaseType_t *woken)
+{
+	i2c_bus_t *bus = (i2c_bus_t *) context;
+
+	(void) stream;
+
+	bus->stats.interrupts++;
+
+	if (bus->state != I2C_STATE_WRITE_DMA)
+	{
+		return;
+	}
+
+	if ((flags & DMA_STREAM_TEIF) != 0)
+	{
+		I2C_GenerateSTOP(bus->config.regs, ENABLE);
+		i2c_complete(bus, I2C_BUS_ERROR, woken);
+	}
+	else if ((flags & DMA_STREAM_TCIF) != 0)
+	{
+		I2C_DMACmd(bus->config.regs, DISABLE);
+		bus->state = I2C_STATE_WRITE_END;
+	}
+}
+
+/**
+  * @brief  Free the bus and set the I2C up again after a timeout or bus
+  * 		error, then start the next transaction.  Called from the timer
+  * 		task with no transaction running
+  *
+  * @param  bus -> the bus
+  *
+  * @retval None
+  */
+static void i2c_recover(i2c_bus_t *bus)
+{
+	BaseType_t released;
+
+	bus->stats.recoveries++;
+
+	I2C_Cmd(bus->config.regs, DISABLE);
+	released = bus->hw->recover(&bus->config);
+
+	// A software reset clears the BUSY flag a stuck bus leaves behind
+	I2C_SoftwareResetCmd(bus->config.regs, ENABLE);
+	I2C_SoftwareResetCmd(bus->config.regs, DISABLE);
+	bus->hw->enable(&bus->config, ENABLE);
+
+	// If a device still holds SDA low, try again next time
+	if (released == pdPASS)
+	{
+		taskENTER_CRITICAL();
+		{
+			bus->recover = pdFALSE;
+			i2c_start_next(bus, ullTaskGetMonotonicTimeUs());
+		}
+		taskEXIT_CRITICAL();
+	}
+}
+
+/**
+  * @brief  Time out the running transaction if it has taken too long, and
+  * 		recover the bus when needed.  Called by the timer every
+  * 		I2C_WATCHDOG_MS
+  *
+  * @param  timer -> the timer, whose ID is the bus
+  *
+  * @retval None
+  */
+static void i2c_watchdog(TimerHandle_t timer)
+{
+	i2c_bus_t *bus = (i2c_bus_t *) pvTimerGetTimerID(timer);
+	BaseType_t expired = pdFALSE, woken = pdFALSE;
+	uint64_t now_us = ullTaskGetMonotonicTimeUs();
+	uint32_t timeout_ms;
+
+	taskENTER_CRITICAL();
+	{
+		if (bus->active != NULL)
+		{
+			timeout_ms = (bus->active->timeout_ms != 0) ? bus->active->timeout_ms : I2C_DEFAULT_TIMEOUT_MS;
+
+			// Once the interrupts are off the transaction is the timer's to end
+			if ((now_us - bus->start_us) > (timeout_ms * 1000ULL))
+			{
+				I2C_ITConfig(bus->config.regs, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR, DISABLE);
+				bus->state = I2C_STATE_IDLE;
+				bus->recover = pdTRUE;
+				expired = pdTRUE;
+			}
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if (expired == pdTRUE)
+	{
+		i2c_complete(bus, I2C_TIMEOUT, &woken);
+	}
+
+	if (bus->recover == pdTRUE)
+	{
+		i2c_recover(bus);
+	}
+
+	if (woken == pdTRUE)
+	{
+		taskYIELD();
+	}
+}
+
+/**
+  * @brief  Handle the event interrupt of an I2C
+  *
+  * @param  regs -> the I2C
+  *
+  * @retval pdTRUE if a task of higher priority was woken
+  */
+BaseType_t i2c_event_irq(I2C_TypeDef *regs)
+{
+	BaseType_t woken = pdFALSE;
+	i2c_bus_t *bus = i2c_find(regs);
+
+	if (bus != NULL)
+	{
+		bus->stats.interrupts++;
+		i2c_event(bus, &woken);
+	}
+
+	return woken;
+}
+
+/**
+  * @brief  Handle the error interrupt of an I2C.  A NACK ends the
+  * 		transaction with a stop; a bus error or overrun also has the timer
+  * 		recover the bus; after lost arbitration the I2C has already let
+  * 		go of it
+  *
+  * @param  regs -> the I2C
+  *
+  * @retval pdTRUE if a task of higher priority was woken
+  */
+BaseType_t i2c_error_irq(I2C_TypeDef *regs)
+{
+	BaseType_t woken = pdFALSE;
+	i2c_bus_t *bus = i2c_find(regs);
+	uint16_t errors = regs->SR1 & I2C_ERROR_FLAGS;
+
+	regs->SR1 = (uint16_t) ~errors;
+
+	if ((bus == NULL) || (errors == 0))
+	{
+		return woken;
+	}
+
+	bus->stats.interrupts++;
+
+	if (bus->active == NULL)
+	{
+		return woken;
+	}
+
+	if ((errors & (I2C_SR1_BERR | I2C_SR1_OVR)) != 0)
+	{
+		bus->recover = pdTRUE;
+		i2c_complete(bus, I2C_BUS_ERROR, &woken);
+	}
+	else if ((errors & I2C_SR1_ARLO) != 0)
+	{
+		i2c_complete(bus, I2C_BUS_ERROR, &woken);
+	}
+	else
+	{
+		I2C_GenerateSTOP(regs, ENABLE);
+		i2c_complete(bus, I2C_NACK, &woken);
+	}
+
+	return woken;
+}
+
+/**
+  * @brief  Add a transaction to the end of the queue and start it if the bus
+  * 		is idle.  Called from a critical section
+  *
+  * @param  bus -> the bus
+  * @param  transaction -> the transaction
+  * @param  now_us -> the monotonic time
+  *
+  * @retval None
+  */
+static void i2c_enqueue(i2c_bus_t *bus, i2c_transaction_t *transaction, uint64_t now_us)
+{
+	configASSERT((transaction->tx_length > 0) || (transaction->rx_length > 0));
+	configASSERT((transaction->status != I2C_QUEUED) && (transaction->status != I2C_ACTIVE));
+
+	transaction->next = NULL;
+	transaction->status = I2C_QUEUED;
+	transaction->queued_us = now_us;
+
+	if (bus->tail == NULL)
+	{
+		bus->head = transaction;
+	}
+	else
+	{
+		bus->tail->next = transaction;
+	}
+
+	bus->tail = transaction;
+
+	bus->queued++;
+	if (bus->queued > bus->stats.queued_max)
+	{
+		bus->stats.queued_max = bus->queued;
+	}
+
+	if (bus->active == NULL)
+	{
+		i2c_start_next(bus, now_us);
+	}
+}
+
+/**
+  * @brief  Queue a transaction, which completes through its callback or
+  * 		notification
+  *
+  * @param  bus -> an open bus
+  * @param  transaction -> the transaction, owned by the bus until it
+  * 		completes
+  *
+  * @retval None
+  */
+void i2c_submit(i2c_bus_t *bus, i2c_transaction_t *transaction)
+{
+	uint64_t now_us = ullTaskGetMonotonicTimeUs();
+
+	taskENTER_CRITICAL();
+	{
+		i2c_enqueue(bus, transaction, now_us);
+	}
+	taskEXIT_CRITICAL();
+}
+
+/**
+  * @brief  Queue a transaction from an interrupt, such as the callback of
+  * 		another transaction
+  *
+  * @param  bus -> an open bus
+  * @param  transaction -> the transaction, owned by the bus until it
+  * 		completes
+  *
+  * @retval None
+  */
+void i2c_submit_from_isr(i2c_bus_t *bus, i2c_transaction_t *transaction)
+{
+	uint64_t now_us = ullTaskGetMonotonicTimeUsFromISR();
+	UBaseType_t saved_status;
+
+	saved_status = taskENTER_CRITICAL_FROM_ISR();
+	{
+		i2c_enqueue(bus, transaction, now_us);
+	}
+	taskEXIT_CRITICAL_FROM_ISR(saved_status);
+}
+
+/**
+  * @brief  Take a transaction off the queue if it has not started
+  *
+  * @param  bus -> an open bus
+  * @param  transaction -> the transaction
+  *
+  * @retval pdPASS if it was removed, or pdFAIL if it has already started
+  */
+BaseType_t i2c_cancel(i2c_bus_t *bus, i2c_transaction_t *transaction)
+{
+	i2c_transaction_t **link = &bus->head, *previous = NULL;
+	BaseType_t result = pdFAIL;
+
+	taskENTER_CRITICAL();
+	{
+		if (transaction->status == I2C_QUEUED)
+		{
+			while (*link != transaction)
+			{
+				previous = *link;
+				link = &previous->next;
+			}
+
+			*link = transaction->next;
+			if (bus->tail == transaction)
+			{
+				bus->tail = previous;
+			}
+
+			bus->queued--;
+			transaction->status = I2C_CANCELLED;
+			result = pdPASS;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return result;
+}
+
+/**
+  * @brief  Run a transaction and wait for it to complete, through the
+  * 		I2C_TRANSFER_NOTIFY_BIT notification of the calling task.  Its
+  * 		notify_task and notify_bits are overwritten
+  *
+  * @param  bus -> an open bus
+  * @param  transaction -> the transaction
+  * @param  timeout -> ticks to wait for it to start.  Once started it is
+  * 		waited for, which takes at most its own timeout and a period of
+  * 		the timer
+  *
+  * @retval I2C_DONE, I2C_NACK, I2C_BUS_ERROR, I2C_TIMEOUT, or
+  * 		I2C_CANCELLED if it did not start in time
+  */
+i2c_status_t i2c_transfer(i2c_bus_t *bus, i2c_transaction_t *transaction, TickType_t timeout)
+{
+	TimeOut_t time_out;
+
+	transaction->notify_task = xTaskGetCurrentTaskHandle();
+	transaction->notify_bits = I2C_TRANSFER_NOTIFY_BIT;
+
+	vTaskSetTimeOutState(&time_out);
+	i2c_submit(bus, transaction);
+
+	// Other notification bits of the task are left as they are, and the bit
+	// left set by an earlier transaction only wakes the loop once more
+	while ((transaction->status == I2C_QUEUED) || (transaction->status == I2C_ACTIVE))
+	{
+		if (xTaskCheckForTimeOut(&time_out, &timeout) == pdTRUE)
+		{
+			if (i2c_cancel(bus, transaction) == pdPASS)
+			{
+				break;
+			}
+
+			timeout = portMAX_DELAY;
+		}
+
+		(void) xTaskNotifyWait(0, I2C_TRANSFER_NOTIFY_BIT, NULL, timeout);
+	}
+
+	return transaction->status;
+}
+
+/**
+  * @brief  Open a bus, claiming its DMA streams if it has them and starting
+  * 		its timer.  The pins are configured by the caller
+  *
+  * @param  bus -> state of the bus, kept until i2c_bus_close()
+  * @param  hw -> &i2c_stm32f4_hw, or simulated registers
+  * @param  config -> the I2C, its pins and its streams, copied by the call
+  *
+  * @retval pdPASS, or pdFAIL if a stream is already claimed, the timer could
+  * 		not be created or I2C_MAX_BUSES are open
+  */
+BaseType_t i2c_bus_open(i2c_bus_t *bus, const i2c_hw_t *hw, const i2c_bus_config_t *config)
+{
+	DMA_InitTypeDef dma_init;
+	BaseType_t result = pdFAIL;
+
+	memset(bus, 0, sizeof(i2c_bus_t));
+	bus->config = *config;
+	bus->hw = hw;
+
+	bus->watchdog = xTimerCreate("I2C", pdMS_TO_TICKS(I2C_WATCHDOG_MS), pdTRUE, bus, i2c_watchdog);
+	if (bus->watchdog == NULL)
+	{
+		return pdFAIL;
+	}
+
+	if (config->dma_controller != 0)
+	{
+		if (dma_stream_claim(&bus->rx_dma, config->dma_controller, config->rx_stream) == pdFAIL)
+		{
+			(void) xTimerDelete(bus->watchdog, portMAX_DELAY);
+			return pdFAIL;
+		}
+
+		if (dma_stream_claim(&bus->tx_dma, config->dma_controller, config->tx_stream) == pdFAIL)
+		{
+			dma_stream_free(&bus->rx_dma);
+			(void) xTimerDelete(bus->watchdog, portMAX_DELAY);
+			return pdFAIL;
+		}
+	}
+
+	taskENTER_CRITICAL();
+	{
+		for (uint32_t index = 0; (index < I2C_MAX_BUSES) && (result == pdFAIL); index++)
+		{
+			if (i2c_bus[index] == NULL)
+			{
+				i2c_bus[index] = bus;
+				result = pdPASS;
+			}
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if (result == pdFAIL)
+	{
+		if (config->dma_controller != 0)
+		{
+			dma_stream_free(&bus->rx_dma);
+			dma_stream_free(&bus->tx_dma);
+		}
+
+		(void) xTimerDelete(bus->watchdog, portMAX_DELAY);
+		return pdFAIL;
+	}
+
+	hw->enable(config, ENABLE);
+
+	// Each transfer sets the memory address and length
+	if (config->dma_controller != 0)
+	{
+		dma_stream_set_handler(&bus->rx_dma, i2c_rx_dma_handler, bus);
+		dma_stream_set_handler(&bus->tx_dma, i2c_tx_dma_handler, bus);
+
+		DMA_StructInit(&dma_init);
+		dma_init.DMA_Channel = config->rx_channel;
+		dma_init.DMA_PeripheralBaseAddr = (uint32_t) (uintptr_t) &config->regs->DR;
+		dma_init.DMA_DIR = DMA_DIR_PeripheralToMemory;
+		dma_init.DMA_BufferSize = 1;
+		dma_init.DMA_MemoryInc = DMA_MemoryInc_Enable;
+		dma_init.DMA_Priority = DMA_Priority_High;
+		DMA_Init(bus->rx_dma.regs, &dma_init);
+		DMA_ITConfig(bus->rx_dma.regs, DMA_IT_TC | DMA_IT_TE, ENABLE);
+
+		dma_init.DMA_Channel = config->tx_channel;
+		dma_init.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+		DMA_Init(bus->tx_dma.regs, &dma_init);
+		DMA_ITConfig(bus->tx_dma.regs, DMA_IT_TC | DMA_IT_TE, ENABLE);
+	}
+
+	bus->open_us = ullTaskGetMonotonicTimeUs();
+	(void) xTimerStart(bus->watchdog, portMAX_DELAY);
+
+	return pdPASS;
+}
+
+/**
+  * @brief  Close a bus
+  *
+  * @param  bus -> an open bus with no transaction queued or running
+  *
+  * @retval None
+  */
+void i2c_bus_close(i2c_bus_t *bus)
+{
+	configASSERT((bus->active == NULL) && (bus->queued == 0));
+
+	(void) xTimerDelete(bus->watchdog, portMAX_DELAY);
+
+	taskENTER_CRITICAL();
+	{
+		for (uint32_t index = 0; index < I2C_MAX_BUSES; index++)
+		{
+			if (i2c_bus[index] == bus)
+			{
+				i2c_bus[index] = NULL;
+			}
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	I2C_Cmd(bus->config.regs, DISABLE);
+	bus->hw->enable(&bus->config, DISABLE);
+
+	if (bus->config.dma_controller != 0)
+	{
+		dma_stream_free(&bus->rx_dma);
+		dma_stream_free(&bus->tx_dma);
+	}
+}
+
+/**
+  * @brief  Read the counters of a bus
+  *
+  * @param  bus -> an open bus
+  * @param  stats -> set to the counters since the bus was opened
+  *
+  * @retval None
+  */
+void i2c_bus_get_stats(i2c_bus_t *bus, i2c_bus_stats_t *stats)
+{
+	uint64_t latency_total_us, elapsed_us;
+
+	taskENTER_CRITICAL();
+	{
+		*stats = bus->stats;
+		latency_total_us = bus->latency_total_us;
+	}
+	taskEXIT_CRITICAL();
+
+	elapsed_us = ullTaskGetMonotonicTimeUs() - bus->open_us;
+	stats->utilisation = (elapsed_us > 0) ? (uint32_t) ((stats->busy_us * 1000ULL) / elapsed_us) : 0;
+	stats->latency_mean_us = (stats->transactions > 0) ? (uint32_t) (latency_total_us / stats->transactions) : 0;
+}
@@ -0,0 +1,183 @@
+/**
+  ******************************************************************************
+  * @file    i2c_stm32f4.c
+  * @brief   The I2Cs of the STM32F4 for the I2C master (i2c_bus.h), their
+  * 		 interrupt handlers, and bus recovery by driving the pins as GPIOs.
+  ******************************************************************************
+*/
+
+#include "i2c_bus.h"
+#include "trace_recorder.h"
+
+// Priority of the I2C interrupts, the same as the DMA stream interrupts so
+// the bus's handlers never preempt one another
+#define I2C_IRQ_PRIORITY		(6)
+
+// Clock pulses that free a device part way through sending a byte
+#define I2C_RECOVERY_CLOCKS		(9)
+
+typedef struct
+{
+	I2C_TypeDef *regs;
+	IRQn_Type event_irq;
+	IRQn_Type error_irq;
+	uint32_t clock;					// On APB1
+} i2c_stm32f4_port_t;
+
+static const i2c_stm32f4_port_t i2c_stm32f4_port[] =
+{
+	{ I2C1, I2C1_EV_IRQn, I2C1_ER_IRQn, RCC_APB1Periph_I2C1 },
+	{ I2C2, I2C2_EV_IRQn, I2C2_ER_IRQn, RCC_APB1Periph_I2C2 },
+	{ I2C3, I2C3_EV_IRQn, I2C3_ER_IRQn, RCC_APB1Periph_I2C3 }
+};
+
+/**
+  * @brief  Enable the clock and interrupts of an I2C and set it up as a
+  * 		master at the bus's clock speed, or disable its interrupts and
+  * 		clock
+  *
+  * @param  config -> the bus
+  * @param  state -> ENABLE or DISABLE
+  *
+  * @retval None
+  */
+static void i2c_stm32f4_enable(const i2c_bus_config_t *config, FunctionalState state)
+{
+	const i2c_stm32f4_port_t *port = NULL;
+	I2C_InitTypeDef i2c_init;
+
+	for (uint32_t i = 0; i < (sizeof(i2c_stm32f4_port) / sizeof(i2c_stm32f4_port[0])); i++)
+	{
+		if (i2c_stm32f4_port[i].regs == config->regs)
+		{
+			port = &i2c_stm32f4_port[i];
+		}
+	}
+
+	configASSERT(port != NULL);
+
+	if (state == DISABLE)
+	{
+		NVIC_DisableIRQ(port->event_irq);
+		NVIC_DisableIRQ(port->error_irq);
+	}
+
+	RCC_APB1PeriphClockCmd(port->clock, state);
+
+	if (state == ENABLE)
+	{
+		I2C_StructInit(&i2c_init);
+		i2c_init.I2C_ClockSpeed = config->clock_speed;
+		i2c_init.I2C_Ack = I2C_Ack_Enable;
+		I2C_Init(config->regs, &i2c_init);
+		I2C_Cmd(config->regs, ENABLE);
+
+		NVIC_SetPriority(port->event_irq, I2C_IRQ_PRIORITY);
+		NVIC_SetPriority(port->error_irq, I2C_IRQ_PRIORITY);
+		NVIC_EnableIRQ(port->event_irq);
+		NVIC_EnableIRQ(port->error_irq);
+	}
+}
+
+/**
+  * @brief  Wait half a clock period of the bus
+  *
+  * @param  config -> the bus
+  *
+  * @retval None
+  */
+static void i2c_stm32f4_half_clock(const i2c_bus_config_t *config)
+{
+	uint64_t until = ullTaskGetMonotonicTimeUs() + (500000UL / config->clock_speed) + 1;
+
+	while (ullTaskGetMonotonicTimeUs() < until);
+}
+
+/**
+  * @brief  Free a bus held by a device.  With the pins as open drain outputs,
+  * 		SCL is pulsed until the device lets SDA go, up to a byte and its
+  * 		acknowledge, then a stop is sent and the pins given back to the I2C
+  *
+  * @param  config -> the bus, whose I2C is disabled
+  *
+  * @retval pdPASS if SDA was released, or pdFAIL if it is still held low
+  */
+static BaseType_t i2c_stm32f4_recover(const i2c_bus_config_t *config)
+{
+	GPIO_InitTypeDef pin_init;
+	BaseType_t released;
+
+	GPIO_SetBits(config->scl_port, config->scl_pin);
+	GPIO_SetBits(config->sda_port, config->sda_pin);
+
+	GPIO_StructInit(&pin_init);
+	pin_init.GPIO_Mode = GPIO_Mode_OUT;
+	pin_init.GPIO_OType = GPIO_OType_OD;
+	pin_init.GPIO_Pin = config->scl_pin;
+	GPIO_Init(config->scl_port, &pin_init);
+	pin_init.GPIO_Pin = config->sda_pin;
+	GPIO_Init(config->sda_port, &pin_init);
+
+	for (uint32_t clock = 0; (clock < I2C_RECOVERY_CLOCKS) &&
+			(GPIO_ReadInputDataBit(config->sda_port, config->sda_pin) == Bit_RESET); clock++)
+	{
+		GPIO_ResetBits(config->scl_port, config->scl_pin);
+		i2c_stm32f4_half_clock(config);
+		GPIO_SetBits(config->scl_port, config->scl_pin);
+		i2c_stm32f4_half_clock(config);
+	}
+
+	// A stop is SDA rising while SCL is high
+	GPIO_ResetBits(config->scl_port, config->scl_pin);
+	i2c_stm32f4_half_clock(config);
+	GPIO_ResetBits(config->sda_port, config->sda_pin);
+	i2c_stm32f4_half_clock(config);
+	GPIO_SetBits(config->scl_port, config->scl_pin);
+	i2c_stm32f4_half_clock(config);
+	GPIO_SetBits(config->sda_port, config->sda_pin);
+	i2c_stm32f4_half_clock(config);
+
+	released = (GPIO_ReadInputDataBit(config->sda_port, config->sda_pin) == Bit_SET) ? pdPASS : pdFAIL;
+
+	pin_init.GPIO_Mode = GPIO_Mode_AF;
+	pin_init.GPIO_Pin = config->scl_pin;
+	GPIO_Init(config->scl_port, &pin_init);
+	pin_init.GPIO_Pin = config->sda_pin;
+	GPIO_Init(config->sda_port, &pin_init);
+
+	return released;
+}
+
+const i2c_hw_t i2c_stm32f4_hw =
+{
+	i2c_stm32f4_enable,
+	i2c_stm32f4_recover
+};
+
+// Each pair of handlers passes its I2C to the bus
+#define I2C_IRQ_HANDLERS(name)														\
+	void name##_EV_IRQHandler(void)													\
+	{																				\
+		BaseType_t woken;															\
+																					\
+		vTraceRecorderISRBegin(name##_EV_IRQn);										\
+		woken = i2c_event_irq(name);												\
+		vTraceRecorderISREnd(name##_EV_IRQn);										\
+																					\
+		portYIELD_FROM_ISR(woken);													\
+	}																				\
+																					\
+	void name##_ER_IRQHandler(void)													\
+	{																				\
+		BaseType_t woken;															\
+																					\
+		vTraceRecorderISRBegin(name##_ER_IRQn);										\
+		woken = i2c_error_irq(name);												\
+		vTraceRecorderISREnd(name##_ER_IRQn);										\
+																					\
+		portYIELD_FROM_ISR(woken);													\
+	}
+
+I2C_IRQ_HANDLERS(I2C1)
+I2C_IRQ_HANDLERS(I2C2)
+I2C_IRQ_HANDLERS(I2C3)
@@ -0,0 +1,80 @@
+/**
+  ******************************************************************************
+  * @file    kv_flash_stm32f4.c
+  * @brief   Sectors 6 and 7 of the STM32F446 flash, 128KB each at 0x08040000,
+  * 		 for the key-value store (kv_store.h).  The linker script keeps
+  * 		 the program out of them.  The F446 has one bank, so while a
+  * 		 sector is erased, about a second for 128KB, or a word programmed
+  * 		 every instruction fetch and read from flash stalls; the store's
+  * 		 worker erases when it has nothing else to do.
+  ******************************************************************************
+*/
+
+#include "kv_store.h"
+
+#define KV_FLASH_BASE				(0x08040000UL)
+#define KV_FLASH_SECTOR_SIZE		(128UL * 1024)
+
+#define KV_FLASH_ERRORS				(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | \
+									 FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR)
+
+static const uint16_t kv_flash_sectors[] = {FLASH_Sector_6, FLASH_Sector_7};
+
+/**
+  * @brief  Erase a sector, 32 bits at a time at 2.7 to 3.6V
+  *
+  * @param  sector -> the store's sector, 0 or 1
+  *
+  * @retval pdPASS, or pdFAIL if the flash reported an error
+  */
+static BaseType_t kv_flash_stm32f4_erase(uint32_t sector)
+{
+	FLASH_Status status;
+
+	FLASH_Unlock();
+	FLASH_ClearFlag(KV_FLASH_ERRORS);
+	status = FLASH_EraseSector(kv_flash_sectors[sector], VoltageRange_3);
+	FLASH_Lock();
+
+	// The data cache may still hold words of the sector from before
+	FLASH_DataCacheCmd(DISABLE);
+	FLASH_DataCacheReset();
+	FLASH_DataCacheCmd(ENABLE);
+
+	return (status == FLASH_COMPLETE) ? pdPASS : pdFAIL;
+}
+
+/**
+  * @brief  Program words
+  *
+  * @param  offset -> from the start of sector 6, word aligned
+  * @param  words -> the words
+  * @param  count -> number of words
+  *
+  * @retval pdPASS, or pdFAIL if the flash reported an error
+  */
+static BaseType_t kv_flash_stm32f4_program(uint32_t offset, const uint32_t *words, uint32_t count)
+{
+	FLASH_Status status = FLASH_COMPLETE;
+
+	FLASH_Unlock();
+	FLASH_ClearFlag(KV_FLASH_ERRORS);
+
+	for (uint32_t i = 0; (i < count) && (status == FLASH_COMPLETE); i++)
+	{
+		status = FLASH_ProgramWord(KV_FLASH_BASE + offset + (i * 4), words[i]);
+	}
+
+	FLASH_Lock();
+
+	return (status == FLASH_COMPLETE) ? pdPASS : pdFAIL;
+}
+
+const kv_flash_t kv_flash_stm32f4 =
+{
+	(const uint8_t *) KV_FLASH_BASE,
+	KV_FLASH_SECTOR_SIZE,
+	sizeof(kv_flash_sectors) / sizeof(kv_flash_sectors[0]),
+	kv_flash_stm32f4_erase,
+	kv_flash_stm32f4_program
+};
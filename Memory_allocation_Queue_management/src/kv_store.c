@@ -0,0 +1,963 @@
+/**
+  ******************************************************************************
+  * @file    kv_store.c
+  * @brief   Log-structured key-value store (see kv_store.h).
+  *
+  * 		 A sector starts with four words: a magic number, its erase count,
+  * 		 and the sequence number it was opened with and its inverse, both
+  * 		 left erased while the sector is free.  A record is a word of its
+  * 		 type and lengths, a CRC-32 of that word and the data, then the key
+  * 		 and value padded to a word with 0xFF.  The CRC is programmed last,
+  * 		 so a record cut short fails its check, and the sector it is in
+  * 		 takes no more records.  A compacted sector has its magic number
+  * 		 cleared before it is erased, so its records are never replayed
+  * 		 over the copies, even if the erase is cut short.  Records are only
+  * 		 written while some sector is not open, so a compaction cut short
+  * 		 is the one way to find them all open, and its copies are dropped.
+  *
+  * 		 Only the worker task writes the flash and the index.  It holds the
+  * 		 lock while it changes the index, and readers while they follow it.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "kv_store.h"
+#include "crc_unit.h"
+
+#define KV_MAGIC					(0x4B565331UL)
+#define KV_ERASED					(0xFFFFFFFFUL)
+#define KV_HEADER_BYTES				(16)
+#define KV_RECORD_HEADER_BYTES		(8)
+#define KV_RECORD_MAX_BYTES			(KV_RECORD_HEADER_BYTES + KV_KEY_MAX + KV_VALUE_MAX)
+
+// Words of the sector header
+#define KV_HEADER_MAGIC				(0)
+#define KV_HEADER_ERASES			(1)
+#define KV_HEADER_SEQUENCE			(2)
+#define KV_HEADER_CHECK				(3)
+
+// Record types, in the top byte of a record's first word, with the value
+// length in the middle two and the key length in the bottom one
+#define KV_RECORD_SET				(0x5AUL)
+#define KV_RECORD_DELETE			(0xA5UL)
+
+#define KV_RECORD_TYPE(first)		((first) >> 24)
+#define KV_RECORD_VALUE_LENGTH(first)	(((first) >> 8) & 0xFFFF)
+#define KV_RECORD_KEY_LENGTH(first)	((first) & 0xFF)
+
+typedef enum
+{
+	KV_SECTOR_DIRTY = 0,			// To be erased before use
+	KV_SECTOR_FREE,					// Erased, with its header
+	KV_SECTOR_OPEN					// Holding records
+} kv_sector_state_t;
+
+typedef enum
+{
+	KV_REQUEST_SET = 0,
+	KV_REQUEST_DELETE,
+	KV_REQUEST_FLUSH
+} kv_request_type_t;
+
+// What the callers queue for the worker
+typedef struct
+{
+	uint8_t type;
+	uint8_t key_length;
+	uint16_t value_length;
+	TaskHandle_t task;				// Flushes: who to notify, and where the
+	volatile BaseType_t *done;		// result goes
+	BaseType_t *result;
+	uint8_t data[KV_KEY_MAX + KV_VALUE_MAX];
+} kv_request_t;
+
+static uint32_t kv_word(const kv_store_t *store, uint32_t location)
+{
+	uint32_t word;
+
+	memcpy(&word, &store->flash->base[location], sizeof(word));
+	return word;
+}
+
+/**
+  * @brief  FNV-1a hash of a key
+  *
+  * @param  key -> the key
+  * @param  length -> its length
+  *
+  * @retval The hash
+  */
+static uint32_t kv_hash(const uint8_t *key, uint32_t length)
+{
+	uint32_t hash = 2166136261UL;
+
+	while (length-- > 0)
+	{
+		hash = (hash ^ *key++) * 16777619UL;
+	}
+
+	return hash;
+}
+
+static uint32_t kv_record_bytes(uint32_t first)
+{
+	return KV_RECORD_HEADER_BYTES + ((KV_RECORD_KEY_LENGTH(first) + KV_RECORD_VALUE_LENGTH(first) + 3) & ~3UL);
+}
+
+/**
+  * @brief  CRC of a record's first word and data
+  *
+  * @param  first -> the first word
+  * @param  data -> the key then the value
+  *
+  * @retval The CRC-32
+  */
+static uint32_t kv_record_crc(uint32_t first, const uint8_t *data)
+{
+	uint32_t crc;
+
+	crc = crc_soft_calculate(CRC_VARIANT_32, crc_initial(CRC_VARIANT_32), &first, sizeof(first));
+	return crc_soft_calculate(CRC_VARIANT_32, crc, data, KV_RECORD_KEY_LENGTH(first) + KV_RECORD_VALUE_LENGTH(first));
+}
+
+/**
+  * @brief  Check the record at a location
+  *
+  * @param  store -> the store
+  * @param  location -> where the record starts
+  * @param  limit -> the end of its sector
+  *
+  * @retval The record's size, or 0 if it is not a whole record
+  */
+static uint32_t kv_record_check(const kv_store_t *store, uint32_t location, uint32_t limit)
+{
+	uint32_t first = kv_word(store, location);
+	uint32_t type = KV_RECORD_TYPE(first), key_length = KV_RECORD_KEY_LENGTH(first);
+	uint32_t value_length = KV_RECORD_VALUE_LENGTH(first);
+
+	if (((type != KV_RECORD_SET) && (type != KV_RECORD_DELETE)) || (key_length == 0) ||
+			(key_length > KV_KEY_MAX) || (value_length > KV_VALUE_MAX) ||
+			((type == KV_RECORD_DELETE) && (value_length != 0)) ||
+			((location + kv_record_bytes(first)) > limit))
+	{
+		return 0;
+	}
+
+	if (kv_record_crc(first, &store->flash->base[location + KV_RECORD_HEADER_BYTES]) !=
+			kv_word(store, location + 4))
+	{
+		return 0;
+	}
+
+	return kv_record_bytes(first);
+}
+
+/**
+  * @brief  Find a key's slot in the index, by linear probing from its hash
+  *
+  * @param  store -> the store
+  * @param  key -> the key
+  * @param  length -> its length
+  * @param  hash -> its hash
+  *
+  * @retval The key's slot, or the empty slot it would go in
+  */
+static kv_index_entry_t *kv_find(const kv_store_t *store, const uint8_t *key, uint32_t length, uint32_t hash)
+{
+	kv_index_entry_t *index = store->config.index, *entry;
+	uint32_t mask = store->config.index_size - 1, slot = hash & mask;
+
+	for (;; slot = (slot + 1) & mask)
+	{
+		entry = &index[slot];
+
+		if (entry->location == 0)
+		{
+			return entry;
+		}
+
+		if ((entry->hash == hash) && (KV_RECORD_KEY_LENGTH(kv_word(store, entry->location)) == length) &&
+				(memcmp(&store->flash->base[entry->location + KV_RECORD_HEADER_BYTES], key, length) == 0))
+		{
+			return entry;
+		}
+	}
+}
+
+/**
+  * @brief  Empty a slot, moving later slots of the same run back so that
+  * 		every key is still found from its hash
+  *
+  * @param  store -> the store
+  * @param  entry -> the slot
+  *
+  * @retval None
+  */
+static void kv_index_remove(kv_store_t *store, kv_index_entry_t *entry)
+{
+	kv_index_entry_t *index = store->config.index;
+	uint32_t mask = store->config.index_size - 1, hole = entry - index, slot = hole, home;
+
+	for (;;)
+	{
+		slot = (slot + 1) & mask;
+
+		if (index[slot].location == 0)
+		{
+			break;
+		}
+
+		// A key can fill the hole if the hole is no nearer its home slot
+		home = index[slot].hash & mask;
+		if (((slot - home) & mask) >= ((slot - hole) & mask))
+		{
+			index[hole] = index[slot];
+			hole = slot;
+		}
+	}
+
+	index[hole].location = 0;
+}
+
+/**
+  * @brief  Point the index at a record, or drop its key for a delete.  Called
+  * 		with the lock held once the worker has started
+  *
+  * @param  store -> the store
+  * @param  location -> the record, checked
+  *
+  * @retval pdPASS, or pdFAIL if the index is full
+  */
+static BaseType_t kv_index_apply(kv_store_t *store, uint32_t location)
+{
+	uint32_t first = kv_word(store, location), length = KV_RECORD_KEY_LENGTH(first);
+	const uint8_t *key = &store->flash->base[location + KV_RECORD_HEADER_BYTES];
+	uint32_t hash = kv_hash(key, length);
+	kv_index_entry_t *entry = kv_find(store, key, length, hash);
+
+	if (entry->location != 0)
+	{
+		store->stats.live_bytes -= kv_record_bytes(kv_word(store, entry->location));
+	}
+
+	if (KV_RECORD_TYPE(first) == KV_RECORD_DELETE)
+	{
+		if (entry->location != 0)
+		{
+			kv_index_remove(store, entry);
+			store->stats.keys--;
+		}
+
+		return pdPASS;
+	}
+
+	if (entry->location == 0)
+	{
+		if (store->stats.keys >= ((store->config.index_size / 4) * 3))
+		{
+			return pdFAIL;
+		}
+
+		entry->hash = hash;
+		store->stats.keys++;
+	}
+
+	entry->location = location;
+	store->stats.live_bytes += kv_record_bytes(first);
+
+	return pdPASS;
+}
+
+/**
+  * @brief  Program a record into the head, the CRC last
+  *
+  * @param  store -> the store
+  * @param  words -> the record, with room in the head
+  *
+  * @retval The record's location, or 0 if the flash failed
+  */
+static uint32_t kv_program_record(kv_store_t *store, const uint32_t *words)
+{
+	const kv_flash_t *flash = store->flash;
+	uint32_t size = kv_record_bytes(words[0]);
+	uint32_t location = (store->head * flash->sector_size) + store->end[store->head];
+
+	// A failure spoils the rest of the head, which will take no more
+	store->end[store->head] += size;
+
+	if ((flash->program(location, &words[0], 1) == pdFAIL) ||
+			(flash->program(location + KV_RECORD_HEADER_BYTES, &words[2],
+					(size - KV_RECORD_HEADER_BYTES) / 4) == pdFAIL) ||
+			(flash->program(location + 4, &words[1], 1) == pdFAIL))
+	{
+		store->end[store->head] = flash->sector_size;
+		return 0;
+	}
+
+	(void) xSemaphoreTake(store->lock, portMAX_DELAY);
+	store->stats.programmed_bytes += size;
+	xSemaphoreGive(store->lock);
+
+	return location;
+}
+
+/**
+  * @brief  Erase a sector and write its header, ready to be opened.  The
+  * 		count goes first, so a header with its magic number has it
+  *
+  * @param  store -> the store
+  * @param  sector -> the sector
+  *
+  * @retval pdPASS, or pdFAIL if the flash failed
+  */
+static BaseType_t kv_erase(kv_store_t *store, uint32_t sector)
+{
+	const kv_flash_t *flash = store->flash;
+	uint32_t start = sector * flash->sector_size, magic = KV_MAGIC, elapsed_us;
+	uint64_t start_us;
+	BaseType_t result;
+
+	store->state[sector] = KV_SECTOR_DIRTY;
+
+	start_us = ullTaskGetMonotonicTimeUs();
+	result = flash->erase(sector);
+	elapsed_us = (uint32_t) (ullTaskGetMonotonicTimeUs() - start_us);
+
+	store->erase_count[sector]++;
+
+	if ((result == pdPASS) &&
+			((flash->program(start + (KV_HEADER_ERASES * 4), &store->erase_count[sector], 1) == pdFAIL) ||
+			(flash->program(start + (KV_HEADER_MAGIC * 4), &magic, 1) == pdFAIL)))
+	{
+		result = pdFAIL;
+	}
+
+	(void) xSemaphoreTake(store->lock, portMAX_DELAY);
+	store->stats.erases++;
+	store->stats.erase_max_us = (elapsed_us > store->stats.erase_max_us) ? elapsed_us : store->stats.erase_max_us;
+	xSemaphoreGive(store->lock);
+
+	if (result == pdPASS)
+	{
+		store->state[sector] = KV_SECTOR_FREE;
+		store->end[sector] = KV_HEADER_BYTES;
+	}
+
+	return result;
+}
+
+static uint32_t kv_count(const kv_store_t *store, kv_sector_state_t state)
+{
+	uint32_t count = 0;
+
+	for (uint32_t sector = 0; sector < store->flash->sectors; sector++)
+	{
+		count += (store->state[sector] == state) ? 1 : 0;
+	}
+
+	return count;
+}
+
+/**
+  * @brief  Copy the live records of the oldest sector to the head, and clear
+  * 		its magic number.  The worker erases it later
+  *
+  * @param  store -> the store, with a head that has just been opened
+  *
+  * @retval pdPASS, or pdFAIL if the flash failed or the records did not fit
+  */
+static BaseType_t kv_compact(kv_store_t *store)
+{
+	const kv_flash_t *flash = store->flash;
+	uint32_t words[KV_RECORD_MAX_BYTES / 4];
+	uint32_t oldest = store->head, start, offset, location, copy, first, size, zero = 0;
+	kv_index_entry_t *entry;
+
+	for (uint32_t sector = 0; sector < flash->sectors; sector++)
+	{
+		if ((store->state[sector] == KV_SECTOR_OPEN) && (sector != store->head) &&
+				((oldest == store->head) || (store->sector_sequence[sector] < store->sector_sequence[oldest])))
+		{
+			oldest = sector;
+		}
+	}
+
+	if (oldest == store->head)
+	{
+		return pdFAIL;
+	}
+
+	start = oldest * flash->sector_size;
+
+	for (offset = KV_HEADER_BYTES; offset < store->end[oldest]; offset += size)
+	{
+		location = start + offset;
+		first = kv_word(store, location);
+		size = kv_record_bytes(first);
+
+		// Only the worker changes the index, so it reads it without the lock
+		entry = kv_find(store, &flash->base[location + KV_RECORD_HEADER_BYTES], KV_RECORD_KEY_LENGTH(first),
+				kv_hash(&flash->base[location + KV_RECORD_HEADER_BYTES], KV_RECORD_KEY_LENGTH(first)));
+		if (entry->location != location)
+		{
+			continue;
+		}
+
+		if ((store->end[store->head] + size) > flash->sector_size)
+		{
+			return pdFAIL;
+		}
+
+		memcpy(words, &flash->base[location], size);
+		copy = kv_program_record(store, words);
+		if (copy == 0)
+		{
+			return pdFAIL;
+		}
+
+		(void) xSemaphoreTake(store->lock, portMAX_DELAY);
+		entry->location = copy;
+		store->stats.copied++;
+		xSemaphoreGive(store->lock);
+	}
+
+	store->state[oldest] = KV_SECTOR_DIRTY;
+
+	(void) xSemaphoreTake(store->lock, portMAX_DELAY);
+	store->stats.compactions++;
+	xSemaphoreGive(store->lock);
+
+	return flash->program(start + (KV_HEADER_MAGIC * 4), &zero, 1);
+}
+
+/**
+  * @brief  Make the next sector round the ring that is not open the head,
+  * 		erasing it first if the worker has not yet, then compact the
+  * 		oldest sector if no other is left to open next time
+  *
+  * @param  store -> the store
+  *
+  * @retval pdPASS, or pdFAIL if the flash failed or every sector is open
+  */
+static BaseType_t kv_rotate(kv_store_t *store)
+{
+	const kv_flash_t *flash = store->flash;
+	uint32_t words[2], next = store->head, i;
+
+	for (i = 0; i < flash->sectors; i++)
+	{
+		next = (next + 1) % flash->sectors;
+		if (store->state[next] != KV_SECTOR_OPEN)
+		{
+			break;
+		}
+	}
+
+	if (i == flash->sectors)
+	{
+		return pdFAIL;
+	}
+
+	if ((store->state[next] == KV_SECTOR_DIRTY) && (kv_erase(store, next) == pdFAIL))
+	{
+		return pdFAIL;
+	}
+
+	words[0] = store->sequence + 1;
+	words[1] = ~words[0];
+	if (flash->program((next * flash->sector_size) + (KV_HEADER_SEQUENCE * 4), words, 2) == pdFAIL)
+	{
+		store->state[next] = KV_SECTOR_DIRTY;
+		return pdFAIL;
+	}
+
+	store->sequence++;
+	store->sector_sequence[next] = store->sequence;
+	store->state[next] = KV_SECTOR_OPEN;
+	store->head = next;
+
+	if ((kv_count(store, KV_SECTOR_FREE) + kv_count(store, KV_SECTOR_DIRTY)) == 0)
+	{
+		return kv_compact(store);
+	}
+
+	return pdPASS;
+}
+
+/**
+  * @brief  Write a set or delete record, unless it would change nothing
+  *
+  * @param  store -> the store
+  * @param  request -> the set or delete
+  *
+  * @retval pdPASS, or pdFAIL if the flash failed or the store or index is
+  * 		full
+  */
+static BaseType_t kv_write(kv_store_t *store, const kv_request_t *request)
+{
+	uint32_t words[KV_RECORD_MAX_BYTES / 4];
+	uint32_t hash = kv_hash(request->data, request->key_length), location, size, rotations;
+	uint32_t type = (request->type == KV_REQUEST_SET) ? KV_RECORD_SET : KV_RECORD_DELETE;
+	kv_index_entry_t *entry = kv_find(store, request->data, request->key_length, hash);
+	BaseType_t result;
+
+	if ((type == KV_RECORD_DELETE) && (entry->location == 0))
+	{
+		return pdPASS;
+	}
+
+	if ((type == KV_RECORD_SET) && (entry->location != 0) &&
+			(KV_RECORD_VALUE_LENGTH(kv_word(store, entry->location)) == request->value_length) &&
+			(memcmp(&store->flash->base[entry->location + KV_RECORD_HEADER_BYTES + request->key_length],
+					&request->data[request->key_length], request->value_length) == 0))
+	{
+		(void) xSemaphoreTake(store->lock, portMAX_DELAY);
+		store->stats.unchanged++;
+		xSemaphoreGive(store->lock);
+		return pdPASS;
+	}
+
+	if ((type == KV_RECORD_SET) && (entry->location == 0) &&
+			(store->stats.keys >= ((store->config.index_size / 4) * 3)))
+	{
+		return pdFAIL;
+	}
+
+	words[0] = (type << 24) | ((uint32_t) request->value_length << 8) | request->key_length;
+	size = kv_record_bytes(words[0]);
+	memset(&words[2], 0xFF, size - KV_RECORD_HEADER_BYTES);
+	memcpy(&words[2], request->data, request->key_length + request->value_length);
+	words[1] = kv_record_crc(words[0], (const uint8_t *) &words[2]);
+
+	for (rotations = 0; (store->sequence == 0) || ((store->end[store->head] + size) > store->flash->sector_size);
+			rotations++)
+	{
+		if ((rotations == store->flash->sectors) || (kv_rotate(store) == pdFAIL))
+		{
+			return pdFAIL;
+		}
+	}
+
+	// A compaction that failed left no sector to open next.  Records are
+	// only written with one, so that every sector open means one cut short
+	if (((kv_count(store, KV_SECTOR_FREE) + kv_count(store, KV_SECTOR_DIRTY)) == 0) &&
+			((kv_compact(store) == pdFAIL) || ((store->end[store->head] + size) > store->flash->sector_size)))
+	{
+		return pdFAIL;
+	}
+
+	location = kv_program_record(store, words);
+	if (location == 0)
+	{
+		return pdFAIL;
+	}
+
+	(void) xSemaphoreTake(store->lock, portMAX_DELAY);
+	{
+		result = kv_index_apply(store, location);
+		store->stats.sets += (type == KV_RECORD_SET) ? 1 : 0;
+		store->stats.deletes += (type == KV_RECORD_DELETE) ? 1 : 0;
+		store->stats.user_bytes += request->key_length + request->value_length;
+	}
+	xSemaphoreGive(store->lock);
+
+	return result;
+}
+
+/**
+  * @brief  Replay the records of an open sector into the index, stopping at
+  * 		the first that is not whole
+  *
+  * @param  store -> the store
+  * @param  sector -> the sector
+  *
+  * @retval The offset after its last record, or the sector size if a record
+  * 		was cut short
+  */
+static uint32_t kv_replay(kv_store_t *store, uint32_t sector)
+{
+	uint32_t start = sector * store->flash->sector_size, limit = start + store->flash->sector_size;
+	uint32_t offset, size;
+
+	for (offset = KV_HEADER_BYTES; (offset + KV_RECORD_HEADER_BYTES) <= store->flash->sector_size; offset += size)
+	{
+		if (kv_word(store, start + offset) == KV_ERASED)
+		{
+			break;
+		}
+
+		size = kv_record_check(store, start + offset, limit);
+		if (size == 0)
+		{
+			store->stats.torn++;
+			return store->flash->sector_size;
+		}
+
+		(void) kv_index_apply(store, start + offset);
+	}
+
+	return offset;
+}
+
+/**
+  * @brief  Read the sector headers, and replay the open sectors oldest first
+  * 		to rebuild the index
+  *
+  * @param  store -> the store
+  *
+  * @retval None
+  */
+static void kv_recover(kv_store_t *store)
+{
+	const kv_flash_t *flash = store->flash;
+	uint32_t order[KV_SECTORS_MAX], opened = 0, start, sequence, erases, known = 0, i, j;
+
+	for (uint32_t sector = 0; sector < flash->sectors; sector++)
+	{
+		start = sector * flash->sector_size;
+		sequence = kv_word(store, start + (KV_HEADER_SEQUENCE * 4));
+		erases = kv_word(store, start + (KV_HEADER_ERASES * 4));
+
+		store->erase_count[sector] = (erases != KV_ERASED) ? erases : 0;
+		known = ((erases != KV_ERASED) && (erases > known)) ? erases : known;
+		store->end[sector] = KV_HEADER_BYTES;
+
+		if (kv_word(store, start + (KV_HEADER_MAGIC * 4)) != KV_MAGIC)
+		{
+			store->state[sector] = KV_SECTOR_DIRTY;
+		}
+		else if ((sequence == KV_ERASED) && (kv_word(store, start + (KV_HEADER_CHECK * 4)) == KV_ERASED))
+		{
+			store->state[sector] = KV_SECTOR_FREE;
+		}
+		else if ((sequence != 0) && (kv_word(store, start + (KV_HEADER_CHECK * 4)) == ~sequence))
+		{
+			store->state[sector] = KV_SECTOR_OPEN;
+			store->sector_sequence[sector] = sequence;
+
+			for (i = opened++; (i > 0) && (store->sector_sequence[order[i - 1]] > sequence); i--)
+			{
+				order[i] = order[i - 1];
+			}
+			order[i] = sector;
+		}
+		else
+		{
+			// Cut short while being opened, before it took a record
+			store->state[sector] = KV_SECTOR_DIRTY;
+		}
+	}
+
+	// A sector whose count was lost is taken to have been erased as often as
+	// the most worn
+	for (i = 0; i < flash->sectors; i++)
+	{
+		if (kv_word(store, (i * flash->sector_size) + (KV_HEADER_ERASES * 4)) == KV_ERASED)
+		{
+			store->erase_count[i] = known;
+		}
+	}
+
+	store->sequence = (opened > 0) ? store->sector_sequence[order[opened - 1]] : 0;
+
+	// Only a compaction leaves every sector open, cut short before the oldest
+	// was retired.  The newest holds nothing but copies, so it is dropped and
+	// the compaction done again
+	if (opened == flash->sectors)
+	{
+		store->state[order[--opened]] = KV_SECTOR_DIRTY;
+	}
+
+	for (j = 0; j < opened; j++)
+	{
+		store->end[order[j]] = kv_replay(store, order[j]);
+	}
+
+	// With nothing open the first sector opened is sector 0
+	store->head = (opened > 0) ? order[opened - 1] : (flash->sectors - 1);
+}
+
+/**
+  * @brief  The worker task: writes the queued records, and erases retired
+  * 		sectors when nothing is queued
+  *
+  * @param  params -> the store
+  *
+  * @retval None
+  */
+static void kv_worker(void *params)
+{
+	kv_store_t *store = (kv_store_t *) params;
+	kv_request_t request;
+	BaseType_t erase = pdTRUE;
+	uint32_t sector;
+
+	for (;;)
+	{
+		if (xQueueReceive(store->requests, &request,
+				((erase == pdTRUE) && (kv_count(store, KV_SECTOR_DIRTY) > 0)) ? 0 : portMAX_DELAY) == pdPASS)
+		{
+			// After a failed erase, try again once there is something to do
+			erase = pdTRUE;
+
+			if (request.type == KV_REQUEST_FLUSH)
+			{
+				*request.result = (store->stats.write_errors == store->flushed_errors) ? pdPASS : pdFAIL;
+				store->flushed_errors = store->stats.write_errors;
+
+				*request.done = pdTRUE;
+				xTaskNotify(request.task, KV_FLUSH_NOTIFY_BIT, eSetBits);
+			}
+			else if (kv_write(store, &request) == pdFAIL)
+			{
+				(void) xSemaphoreTake(store->lock, portMAX_DELAY);
+				store->stats.write_errors++;
+				xSemaphoreGive(store->lock);
+			}
+		}
+		else
+		{
+			for (sector = 0; store->state[sector] != KV_SECTOR_DIRTY; sector++)
+			{
+			}
+
+			erase = kv_erase(store, sector);
+		}
+	}
+}
+
+/**
+  * @brief  Open the store: rebuild the index from the flash and start the
+  * 		worker.  Sectors that are not the store's are erased by the
+  * 		worker, so blank flash is formatted
+  *
+  * @param  store -> state of the store, kept until kv_store_close()
+  * @param  flash -> &kv_flash_stm32f4, or a simulated flash
+  * @param  config -> the worker, queue and index, copied by the call
+  *
+  * @retval pdPASS, or pdFAIL if the queue, lock or task could not be created
+  */
+BaseType_t kv_store_open(kv_store_t *store, const kv_flash_t *flash, const kv_store_config_t *config)
+{
+	configASSERT((flash->sectors >= 2) && (flash->sectors <= KV_SECTORS_MAX));
+	configASSERT((config->index_size >= 4) && ((config->index_size & (config->index_size - 1)) == 0));
+
+	memset(store, 0, sizeof(kv_store_t));
+	store->config = *config;
+	store->flash = flash;
+	memset(config->index, 0, config->index_size * sizeof(kv_index_entry_t));
+
+	kv_recover(store);
+
+	store->lock = xSemaphoreCreateMutex();
+	if (store->lock == NULL)
+	{
+		return pdFAIL;
+	}
+
+	store->requests = xQueueCreate(config->queue_length, sizeof(kv_request_t));
+	if (store->requests == NULL)
+	{
+		vSemaphoreDelete(store->lock);
+		return pdFAIL;
+	}
+
+	if (xTaskCreate(kv_worker, "KV", config->stack_depth, store, config->task_priority, &store->task) != pdPASS)
+	{
+		vQueueDelete(store->requests);
+		vSemaphoreDelete(store->lock);
+		return pdFAIL;
+	}
+
+	return pdPASS;
+}
+
+/**
+  * @brief  Close the store.  Writes still queued are dropped, so callers
+  * 		that need them call kv_flush() first
+  *
+  * @param  store -> an open store that no other task is using
+  *
+  * @retval None
+  */
+void kv_store_close(kv_store_t *store)
+{
+	vTaskDelete(store->task);
+	vQueueDelete(store->requests);
+	vSemaphoreDelete(store->lock);
+}
+
+/**
+  * @brief  Queue a set or delete for the worker
+  *
+  * @param  store -> an open store
+  * @param  type -> KV_REQUEST_SET or KV_REQUEST_DELETE
+  * @param  key -> the key, a string of 1 to KV_KEY_MAX characters
+  * @param  value -> the value
+  * @param  length -> its length, at most KV_VALUE_MAX
+  * @param  timeout -> ticks to wait for room in the queue
+  *
+  * @retval pdPASS, or pdFAIL if the queue stayed full
+  */
+static BaseType_t kv_queue(kv_store_t *store, kv_request_type_t type, const char *key, const void *value,
+		size_t length, TickType_t timeout)
+{
+	kv_request_t request;
+	size_t key_length = strlen(key);
+
+	configASSERT((key_length > 0) && (key_length <= KV_KEY_MAX) && (length <= KV_VALUE_MAX));
+
+	request.type = (uint8_t) type;
+	request.key_length = (uint8_t) key_length;
+	request.value_length = (uint16_t) length;
+	memcpy(request.data, key, key_length);
+	if (length > 0)
+	{
+		memcpy(&request.data[key_length], value, length);
+	}
+
+	return (xQueueSend(store->requests, &request, timeout) == pdPASS) ? pdPASS : pdFAIL;
+}
+
+/**
+  * @brief  Queue a key's value to be written.  kv_get() returns it once the
+  * 		worker has written it
+  *
+  * @param  store -> an open store
+  * @param  key -> the key, a string of 1 to KV_KEY_MAX characters
+  * @param  value -> the value, copied by the call
+  * @param  length -> its length, at most KV_VALUE_MAX
+  * @param  timeout -> ticks to wait for room in the queue
+  *
+  * @retval pdPASS, or pdFAIL if the queue stayed full
+  */
+BaseType_t kv_set(kv_store_t *store, const char *key, const void *value, size_t length, TickType_t timeout)
+{
+	return kv_queue(store, KV_REQUEST_SET, key, value, length, timeout);
+}
+
+/**
+  * @brief  Queue a key to be deleted
+  *
+  * @param  store -> an open store
+  * @param  key -> the key
+  * @param  timeout -> ticks to wait for room in the queue
+  *
+  * @retval pdPASS, or pdFAIL if the queue stayed full
+  */
+BaseType_t kv_delete(kv_store_t *store, const char *key, TickType_t timeout)
+{
+	return kv_queue(store, KV_REQUEST_DELETE, key, NULL, 0, timeout);
+}
+
+/**
+  * @brief  Read a key's value from the flash, through the index
+  *
+  * @param  store -> an open store
+  * @param  key -> the key
+  * @param  value -> set to the value
+  * @param  size -> room at value
+  * @param  length -> set to the value's length if the key was found
+  *
+  * @retval pdPASS, or pdFAIL if the key was not found or the value did not
+  * 		fit
+  */
+BaseType_t kv_get(kv_store_t *store, const char *key, void *value, size_t size, size_t *length)
+{
+	size_t key_length = strlen(key);
+	kv_index_entry_t *entry;
+	BaseType_t result = pdFAIL;
+
+	if ((key_length == 0) || (key_length > KV_KEY_MAX))
+	{
+		return pdFAIL;
+	}
+
+	(void) xSemaphoreTake(store->lock, portMAX_DELAY);
+	{
+		entry = kv_find(store, (const uint8_t *) key, key_length, kv_hash((const uint8_t *) key, key_length));
+
+		if (entry->location != 0)
+		{
+			*length = KV_RECORD_VALUE_LENGTH(kv_word(store, entry->location));
+
+			if (*length <= size)
+			{
+				memcpy(value, &store->flash->base[entry->location + KV_RECORD_HEADER_BYTES + key_length], *length);
+				result = pdPASS;
+			}
+		}
+	}
+	xSemaphoreGive(store->lock);
+
+	return result;
+}
+
+/**
+  * @brief  Wait for the worker to write everything queued before the call
+  *
+  * @param  store -> an open store
+  * @param  timeout -> ticks to wait for room in the queue.  Once queued the
+  * 		flush is always waited for
+  *
+  * @retval pdPASS, or pdFAIL if the queue stayed full or a write failed
+  * 		since the last flush
+  */
+BaseType_t kv_flush(kv_store_t *store, TickType_t timeout)
+{
+	kv_request_t request;
+	volatile BaseType_t done = pdFALSE;
+	BaseType_t result = pdFAIL;
+
+	request.type = KV_REQUEST_FLUSH;
+	request.task = xTaskGetCurrentTaskHandle();
+	request.done = &done;
+	request.result = &result;
+
+	if (xQueueSend(store->requests, &request, timeout) != pdPASS)
+	{
+		return pdFAIL;
+	}
+
+	// The bit left set by an earlier flush only wakes the loop once more
+	while (done == pdFALSE)
+	{
+		(void) xTaskNotifyWait(0, KV_FLUSH_NOTIFY_BIT, NULL, portMAX_DELAY);
+	}
+
+	return result;
+}
+
+/**
+  * @brief  Read the counters of the store
+  *
+  * @param  store -> an open store
+  * @param  stats -> set to the counters since the store was opened, and its
+  * 		keys, space and wear now
+  *
+  * @retval None
+  */
+void kv_store_get_stats(kv_store_t *store, kv_store_stats_t *stats)
+{
+	const kv_flash_t *flash = store->flash;
+
+	(void) xSemaphoreTake(store->lock, portMAX_DELAY);
+	{
+		*stats = store->stats;
+		stats->erase_min = UINT32_MAX;
+		stats->erase_max = 0;
+		stats->free_bytes = (store->sequence != 0) ? (flash->sector_size - store->end[store->head]) : 0;
+
+		for (uint32_t sector = 0; sector < flash->sectors; sector++)
+		{
+			stats->erase_min = (store->erase_count[sector] < stats->erase_min) ?
+					store->erase_count[sector] : stats->erase_min;
+			stats->erase_max = (store->erase_count[sector] > stats->erase_max) ?
+					store->erase_count[sector] : stats->erase_max;
+			stats->free_bytes += (store->state[sector] != KV_SECTOR_OPEN) ?
+					(flash->sector_size - KV_HEADER_BYTES) : 0;
+		}
+	}
+	xSemaphoreGive(store->lock);
+}
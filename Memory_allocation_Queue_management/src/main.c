@@ -18,9 +18,14 @@ xTaskHandle producer_handle = NULL;
 xTaskHandle interrupt_handle = NULL;
 xTaskHandle consumer_handle = NULL;
 
+// Cycles taken to record one trace event, measured at start up
+uint32_t trace_overhead;
+
 // driver funtion
 int main(void)
 {
+	BaseType_t result;
+
 	// Resets the RCC clock configuration to the default reset state.
 	// Set the System clock = 16 MHz -> CPU_clock = 16MHz
 	RCC_DeInit();
@@ -31,6 +36,12 @@ int main(void)
 	// Setup Hardware
 	prvSetupHW();
 
+	// Start tracing before any kernel object is created so the names are
+	// recorded, then check recording an event stays within budget
+	vTraceRecorderStart();
+	result = xTraceRecorderMeasureOverhead(&trace_overhead);
+	configASSERT(result == pdPASS);
+
 	// Initialize the Demo Queue
 	queue_init();
 
@@ -39,6 +50,10 @@ int main(void)
 	xTaskCreate(interrupt_producer_handler, "Interrupt producer", 1000, NULL, 2, &interrupt_handle);
 	xTaskCreate(consumer_task, "Consumer", 500, NULL, 1, &consumer_handle);
 
+	// Sample the stack used by every task twice a second
+	result = xStackProfilerStart(pdMS_TO_TICKS(500));
+	configASSERT(result == pdPASS);
+
 	// Start Scheduler
 	vTaskStartScheduler();
 
@@ -2,6 +2,7 @@
 #include "demo.h"
 #include "demo_queue.h"
 #include "semphr.h"
+#include "task_arena.h"
 
 // Global variables
 uint32_t incr_val = 1;
@@ -103,25 +104,52 @@ void consumer_task(void *parameters)
 {
 	Queue_st *receiver_st;
 	uint32_t delay = pdMS_TO_TICKS(6000);
+	TaskArenaMark_t mark;
+	BaseType_t result;
+
+	// Memory for each message is taken from the task's own arena, so it
+	// does not fragment the heap shared with the producers
+	result = xTaskArenaCreate(160);
+	configASSERT(result == pdPASS);
+
+	// Report the cost of a context switch with the stack overflow checks
+	// configured, and of a yield that does not switch, once before the
+	// demo starts
+	char switch_msg[160];
+	sprintf(switch_msg, "Context switch: %lu cycles, yield without switch: %lu cycles, overflow check method %d, MPU guard %d, watchpoint %d\r\n\n",
+			(unsigned long) prvMeasureContextSwitch(), (unsigned long) prvMeasureYield(),
+			configCHECK_FOR_STACK_OVERFLOW, configSTACK_OVERFLOW_MPU_GUARD, configSTACK_OVERFLOW_WATCHPOINT);
+	prvPrintMsg(switch_msg);
 
 	while(1)
 	{
 		if(xQueueReceive(demo_queue_handler, &receiver_st, portMAX_DELAY) == pdPASS)
 		{
-			char *r_ptr = pvPortMalloc(100 * sizeof(char)); // Memory to print values
+			uint64_t now_us = ullTaskGetMonotonicTimeUs();
+
+			mark = xTaskArenaMark();
+			char *r_ptr = pvTaskArenaAlloc(128 * sizeof(char)); // Memory to print values
 
 			sprintf(r_ptr,
-					"Received from Queue: addr: %p Value: %ld String: %s\r\n\n",
+					"Received from Queue at %lu.%06lu s: addr: %p Value: %ld String: %s\r\n\n",
+					(unsigned long) (now_us / 1000000),
+					(unsigned long) (now_us % 1000000),
 					receiver_st,
 					receiver_st->value,
 					receiver_st->string);
 
 			prvPrintMsg(r_ptr);
 
-			vPortFree(r_ptr);
+			vTaskArenaRewind(mark);
 		}
 		vPortFree(receiver_st);
 
+		// Report how full each heap region is, how much stack each task
+		// has used, and which tasks have a floating point context
+		prvPrintHeapStats();
+		prvPrintStackReport();
+		prvPrintFPUStats();
+
 		vTaskDelay(delay);
 	}
 }
@@ -139,6 +167,8 @@ void EXTI15_10_IRQHandler(void)
 {
 	BaseType_t xHigherPriorityTaskWoken;
 
+	vTraceRecorderISRBegin(EXTI15_10_IRQn);
+
 	// Clear the int pending bit of EXT (13)
 	EXTI_ClearITPendingBit(EXTI_Line13);
 
@@ -148,6 +178,8 @@ void EXTI15_10_IRQHandler(void)
 	// Unblock the task by releasing the semaphore.
 	xSemaphoreGiveFromISR(xBiSemaphore, &xHigherPriorityTaskWoken);
 
+	vTraceRecorderISREnd(EXTI15_10_IRQn);
+
 	// Yeild if True
 	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
 }
@@ -0,0 +1,519 @@
+/**
+  ******************************************************************************
+  * @file    spi_bus.c
+  * @brief   RTOS SPI bus manager (see spi_bus.h).  Registers are only reached
+  * 		 through the configuration, the spi_hw_t and the dma_hw_t of the
+  * 		 DMA stream manager, so the bus also runs against simulated
+  * 		 registers on the host.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "spi_bus.h"
+
+/**
+  * @brief  Set the SPI up for a device, if it is not already
+  *
+  * @param  bus -> the bus, which is idle
+  * @param  device -> the device
+  *
+  * @retval None
+  */
+static void spi_setup_device(spi_bus_t *bus, const spi_device_t *device)
+{
+	SPI_InitTypeDef spi_init;
+
+	if (bus->device == device)
+	{
+		return;
+	}
+
+	SPI_StructInit(&spi_init);
+	spi_init.SPI_Mode = SPI_Mode_Master;
+	spi_init.SPI_NSS = SPI_NSS_Soft;
+	spi_init.SPI_CPOL = device->cpol;
+	spi_init.SPI_CPHA = device->cpha;
+	spi_init.SPI_BaudRatePrescaler = device->prescaler;
+
+	SPI_Cmd(bus->config.regs, DISABLE);
+	SPI_Init(bus->config.regs, &spi_init);
+	SPI_Cmd(bus->config.regs, ENABLE);
+
+	bus->device = device;
+}
+
+/**
+  * @brief  Point a stream at a buffer, or at a single byte if there is none
+  *
+  * @param  stream -> the receive or transmit stream, which is not enabled
+  * @param  buffer -> the buffer, or NULL
+  * @param  single -> the byte to use if there is no buffer
+  * @param  length -> bytes to transfer
+  *
+  * @retval None
+  */
+static void spi_setup_stream(dma_stream_t *stream, const uint8_t *buffer, uint8_t *single, uint16_t length)
+{
+	if (buffer != NULL)
+	{
+		DMA_MemoryTargetConfig(stream->regs, (uint32_t) (uintptr_t) buffer, DMA_Memory_0);
+		stream->regs->CR |= DMA_SxCR_MINC;
+	}
+	else
+	{
+		DMA_MemoryTargetConfig(stream->regs, (uint32_t) (uintptr_t) single, DMA_Memory_0);
+		stream->regs->CR &= ~DMA_SxCR_MINC;
+	}
+
+	DMA_SetCurrDataCounter(stream->regs, length);
+	(void) dma_stream_clear_flags(stream);
+}
+
+/**
+  * @brief  Start the highest priority waiting transaction, if there is one.
+  * 		Called from a critical section with the bus idle
+  *
+  * @param  bus -> the bus
+  * @param  now_us -> the monotonic time
+  *
+  * @retval None
+  */
+static void spi_start_next(spi_bus_t *bus, uint64_t now_us)
+{
+	spi_transaction_t *transaction = NULL;
+
+	for (int32_t priority = SPI_PRIORITIES - 1; (priority >= 0) && (transaction == NULL); priority--)
+	{
+		transaction = bus->head[priority];
+
+		if (transaction != NULL)
+		{
+			bus->head[priority] = transaction->next;
+			if (bus->head[priority] == NULL)
+			{
+				bus->tail[priority] = NULL;
+			}
+		}
+	}
+
+	if (transaction == NULL)
+	{
+		return;
+	}
+
+	bus->queued--;
+	bus->active = transaction;
+	bus->start_us = now_us;
+	transaction->status = SPI_ACTIVE;
+
+	spi_setup_device(bus, transaction->device);
+	bus->hw->chip_select(transaction->device, ENABLE);
+
+	// The receive stream is enabled first so it is ready for the first byte,
+	// which the transmit stream starts as soon as it is enabled
+	spi_setup_stream(&bus->rx_dma, transaction->rx, &bus->discard, transaction->length);
+	spi_setup_stream(&bus->tx_dma, transaction->tx, &bus->fill, transaction->length);
+	DMA_Cmd(bus->rx_dma.regs, ENABLE);
+	DMA_Cmd(bus->tx_dma.regs, ENABLE);
+}
+
+/**
+  * @brief  Finish the running transaction, start the next, and then report
+  * 		the finished one.  Called from the stream interrupts
+  *
+  * @param  bus -> the bus
+  * @param  error -> pdTRUE if either stream had a transfer error
+  * @param  woken -> set to pdTRUE if a task of higher priority was woken
+  *
+  * @retval None
+  */
+static void spi_complete(spi_bus_t *bus, BaseType_t error, BaseType_t *woken)
+{
+	spi_transaction_t *done = bus->active;
+	spi_callback_t callback;
+	TaskHandle_t notify_task;
+	uint32_t notify_bits;
+	UBaseType_t saved_status;
+	uint64_t now_us;
+
+	if (done == NULL)
+	{
+		return;
+	}
+
+	// After an error the other stream may still be running.  Stopping it sets
+	// its flags, which are cleared so they do not end the next transaction.
+	if (error == pdTRUE)
+	{
+		DMA_Cmd(bus->rx_dma.regs, DISABLE);
+		DMA_Cmd(bus->tx_dma.regs, DISABLE);
+		while ((DMA_GetCmdStatus(bus->rx_dma.regs) == ENABLE) || (DMA_GetCmdStatus(bus->tx_dma.regs) == ENABLE));
+		(void) dma_stream_clear_flags(&bus->rx_dma);
+		(void) dma_stream_clear_flags(&bus->tx_dma);
+	}
+
+	bus->hw->chip_select(done->device, DISABLE);
+
+	// Taken before the transaction is given back, after which it may be reused
+	callback = done->callback;
+	notify_task = done->notify_task;
+	notify_bits = done->notify_bits;
+
+	now_us = ullTaskGetMonotonicTimeUsFromISR();
+
+	saved_status = taskENTER_CRITICAL_FROM_ISR();
+	{
+		done->latency_us = (uint32_t) (now_us - done->queued_us);
+
+		bus->stats.transactions++;
+		bus->stats.bytes += done->length;
+		bus->stats.busy_us += now_us - bus->start_us;
+		bus->latency_total_us += done->latency_us;
+		if (done->latency_us > bus->stats.latency_max_us)
+		{
+			bus->stats.latency_max_us = done->latency_us;
+		}
+
+		if (error == pdTRUE)
+		{
+			bus->stats.errors++;
+			done->status = SPI_ERROR;
+		}
+		else
+		{
+			done->status = SPI_DONE;
+		}
+
+		bus->active = NULL;
+		spi_start_next(bus, now_us);
+	}
+	taskEXIT_CRITICAL_FROM_ISR(saved_status);
+
+	if (callback != NULL)
+	{
+		callback(done, woken);
+	}
+
+	if (notify_task != NULL)
+	{
+		xTaskNotifyFromISR(notify_task, notify_bits, eSetBits, woken);
+	}
+}
+
+/**
+  * @brief  Handle the interrupts of the receive stream.  Once the last byte
+  * 		has been received the transaction is complete
+  *
+  * @param  stream -> the receive stream
+  * @param  flags -> DMA_STREAM_xxIF flags that were set
+  * @param  context -> the bus
+  * @param  woken -> set to pdTRUE if a task of higher priority was woken
+  *
+  * @retval None
+  */
+static void spi_rx_dma_handler(dma_stream_t *stream, uint32_t flags, void *context, BaseType_t *woken)
+{
+	(void) stream;
+
+	if ((flags & DMA_STREAM_TEIF) != 0)
+	{
+		spi_complete((spi_bus_t *) context, pdTRUE, woken);
+	}
+	else if ((flags & DMA_STREAM_TCIF) != 0)
+	{
+		spi_complete((spi_bus_t *) context, pdFALSE, woken);
+	}
+}
+
+/**
+  * @brief  Handle the interrupts of the transmit stream, which are only
+  * 		errors, as the receive stream finishes each transaction
+  *
+  * @param  stream -> the transmit stream
+  * @param  flags -> DMA_STREAM_xxIF flags that were set
+  * @param  context -> the bus
+  * @param  woken -> set to pdTRUE if a task of higher priority was woken
+  *
+  * @retval None
+  */
+static void spi_tx_dma_handler(dma_stream_t *stream, uint32_t flags, void *context, BaseType_t *woken)
+{
+	(void) stream;
+
+	if ((flags & DMA_STREAM_TEIF) != 0)
+	{
+		spi_complete((spi_bus_t *) context, pdTRUE, woken);
+	}
+}
+
+/**
+  * @brief  Add a transaction to the end of the list for its priority and
+  * 		start it if the bus is idle.  Called from a critical section
+  *
+  * @param  bus -> the bus
+  * @param  transaction -> the transaction
+  * @param  now_us -> the monotonic time
+  *
+  * @retval None
+  */
+static void spi_enqueue(spi_bus_t *bus, spi_transaction_t *transaction, uint64_t now_us)
+{
+	uint32_t priority = transaction->priority;
+
+	configASSERT(priority < SPI_PRIORITIES);
+	configASSERT(transaction->length > 0);
+	configASSERT((transaction->status != SPI_QUEUED) && (transaction->status != SPI_ACTIVE));
+
+	transaction->next = NULL;
+	transaction->status = SPI_QUEUED;
+	transaction->queued_us = now_us;
+
+	if (bus->tail[priority] == NULL)
+	{
+		bus->head[priority] = transaction;
+	}
+	else
+	{
+		bus->tail[priority]->next = transaction;
+	}
+
+	bus->tail[priority] = transaction;
+
+	bus->queued++;
+	if (bus->queued > bus->stats.queued_max)
+	{
+		bus->stats.queued_max = bus->queued;
+	}
+
+	if (bus->active == NULL)
+	{
+		spi_start_next(bus, now_us);
+	}
+}
+
+/**
+  * @brief  Queue a transaction, which completes through its callback or
+  * 		notification
+  *
+  * @param  bus -> an open bus
+  * @param  transaction -> the transaction, owned by the bus until it
+  * 		completes
+  *
+  * @retval None
+  */
+void spi_submit(spi_bus_t *bus, spi_transaction_t *transaction)
+{
+	uint64_t now_us = ullTaskGetMonotonicTimeUs();
+
+	taskENTER_CRITICAL();
+	{
+		spi_enqueue(bus, transaction, now_us);
+	}
+	taskEXIT_CRITICAL();
+}
+
+/**
+  * @brief  Queue a transaction from an interrupt, such as the callback of
+  * 		another transaction
+  *
+  * @param  bus -> an open bus
+  * @param  transaction -> the transaction, owned by the bus until it
+  * 		completes
+  *
+  * @retval None
+  */
+void spi_submit_from_isr(spi_bus_t *bus, spi_transaction_t *transaction)
+{
+	uint64_t now_us = ullTaskGetMonotonicTimeUsFromISR();
+	UBaseType_t saved_status;
+
+	saved_status = taskENTER_CRITICAL_FROM_ISR();
+	{
+		spi_enqueue(bus, transaction, now_us);
+	}
+	taskEXIT_CRITICAL_FROM_ISR(saved_status);
+}
+
+/**
+  * @brief  Take a transaction off the queue if it has not started
+  *
+  * @param  bus -> an open bus
+  * @param  transaction -> the transaction
+  *
+  * @retval pdPASS if it was removed, or pdFAIL if it has already started
+  */
+BaseType_t spi_cancel(spi_bus_t *bus, spi_transaction_t *transaction)
+{
+	spi_transaction_t **link, *previous = NULL;
+	BaseType_t result = pdFAIL;
+
+	taskENTER_CRITICAL();
+	{
+		if (transaction->status == SPI_QUEUED)
+		{
+			link = &bus->head[transaction->priority];
+			while (*link != transaction)
+			{
+				previous = *link;
+				link = &previous->next;
+			}
+
+			*link = transaction->next;
+			if (bus->tail[transaction->priority] == transaction)
+			{
+				bus->tail[transaction->priority] = previous;
+			}
+
+			bus->queued--;
+			transaction->status = SPI_CANCELLED;
+			result = pdPASS;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return result;
+}
+
+/**
+  * @brief  Run a transaction and wait for it to complete, through the
+  * 		SPI_TRANSFER_NOTIFY_BIT notification of the calling task.  Its
+  * 		notify_task and notify_bits are overwritten
+  *
+  * @param  bus -> an open bus
+  * @param  transaction -> the transaction
+  * @param  timeout -> ticks to wait for it to start.  Once started it is
+  * 		always waited for, which takes the time of the transfer
+  *
+  * @retval pdPASS, or pdFAIL if it failed or did not start in time
+  */
+BaseType_t spi_transfer(spi_bus_t *bus, spi_transaction_t *transaction, TickType_t timeout)
+{
+	TimeOut_t time_out;
+
+	transaction->notify_task = xTaskGetCurrentTaskHandle();
+	transaction->notify_bits = SPI_TRANSFER_NOTIFY_BIT;
+
+	vTaskSetTimeOutState(&time_out);
+	spi_submit(bus, transaction);
+
+	// Other notification bits of the task are left as they are, and the bit
+	// left set by an earlier transaction only wakes the loop once more
+	while ((transaction->status == SPI_QUEUED) || (transaction->status == SPI_ACTIVE))
+	{
+		if (xTaskCheckForTimeOut(&time_out, &timeout) == pdTRUE)
+		{
+			if (spi_cancel(bus, transaction) == pdPASS)
+			{
+				return pdFAIL;
+			}
+
+			timeout = portMAX_DELAY;
+		}
+
+		(void) xTaskNotifyWait(0, SPI_TRANSFER_NOTIFY_BIT, NULL, timeout);
+	}
+
+	return (transaction->status == SPI_DONE) ? pdPASS : pdFAIL;
+}
+
+/**
+  * @brief  Open a bus, claiming its DMA streams.  The SPI's pins and the chip
+  * 		select pins are configured by the caller
+  *
+  * @param  bus -> state of the bus, kept until spi_bus_close()
+  * @param  hw -> &spi_stm32f4_hw, or simulated registers
+  * @param  config -> the SPI and its streams, copied by the call
+  *
+  * @retval pdPASS, or pdFAIL if a stream is already claimed
+  */
+BaseType_t spi_bus_open(spi_bus_t *bus, const spi_hw_t *hw, const spi_bus_config_t *config)
+{
+	DMA_InitTypeDef dma_init;
+
+	memset(bus, 0, sizeof(spi_bus_t));
+	bus->config = *config;
+	bus->hw = hw;
+	bus->fill = 0xFF;
+
+	if (dma_stream_claim(&bus->rx_dma, config->dma_controller, config->rx_stream) == pdFAIL)
+	{
+		return pdFAIL;
+	}
+
+	if (dma_stream_claim(&bus->tx_dma, config->dma_controller, config->tx_stream) == pdFAIL)
+	{
+		dma_stream_free(&bus->rx_dma);
+		return pdFAIL;
+	}
+
+	dma_stream_set_handler(&bus->rx_dma, spi_rx_dma_handler, bus);
+	dma_stream_set_handler(&bus->tx_dma, spi_tx_dma_handler, bus);
+	hw->enable(config->regs, ENABLE);
+
+	// Each transaction sets the memory address, increment and length.  The
+	// receive stream has the higher priority, so the SPI never overruns
+	DMA_StructInit(&dma_init);
+	dma_init.DMA_Channel = config->rx_channel;
+	dma_init.DMA_PeripheralBaseAddr = (uint32_t) (uintptr_t) &config->regs->DR;
+	dma_init.DMA_DIR = DMA_DIR_PeripheralToMemory;
+	dma_init.DMA_BufferSize = 1;
+	dma_init.DMA_Priority = DMA_Priority_VeryHigh;
+	DMA_Init(bus->rx_dma.regs, &dma_init);
+	DMA_ITConfig(bus->rx_dma.regs, DMA_IT_TC | DMA_IT_TE, ENABLE);
+
+	dma_init.DMA_Channel = config->tx_channel;
+	dma_init.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+	dma_init.DMA_Priority = DMA_Priority_High;
+	DMA_Init(bus->tx_dma.regs, &dma_init);
+	DMA_ITConfig(bus->tx_dma.regs, DMA_IT_TE, ENABLE);
+
+	SPI_I2S_DMACmd(config->regs, SPI_I2S_DMAReq_Rx | SPI_I2S_DMAReq_Tx, ENABLE);
+
+	bus->open_us = ullTaskGetMonotonicTimeUs();
+
+	return pdPASS;
+}
+
+/**
+  * @brief  Close a bus
+  *
+  * @param  bus -> an open bus with no transaction queued or running
+  *
+  * @retval None
+  */
+void spi_bus_close(spi_bus_t *bus)
+{
+	configASSERT((bus->active == NULL) && (bus->queued == 0));
+
+	SPI_I2S_DMACmd(bus->config.regs, SPI_I2S_DMAReq_Rx | SPI_I2S_DMAReq_Tx, DISABLE);
+	SPI_Cmd(bus->config.regs, DISABLE);
+	bus->hw->enable(bus->config.regs, DISABLE);
+
+	dma_stream_free(&bus->rx_dma);
+	dma_stream_free(&bus->tx_dma);
+}
+
+/**
+  * @brief  Read the counters of a bus
+  *
+  * @param  bus -> an open bus
+  * @param  stats -> set to the counters since the bus was opened
+  *
+  * @retval None
+  */
+void spi_bus_get_stats(spi_bus_t *bus, spi_bus_stats_t *stats)
+{
+	uint64_t latency_total_us, elapsed_us;
+
+	taskENTER_CRITICAL();
+	{
+		*stats = bus->stats;
+		latency_total_us = bus->latency_total_us;
+	}
+	taskEXIT_CRITICAL();
+
+	elapsed_us = ullTaskGetMonotonicTimeUs() - bus->open_us;
+	stats->utilisation = (elapsed_us > 0) ? (uint32_t) ((stats->busy_us * 1000ULL) / elapsed_us) : 0;
+	stats->latency_mean_us = (stats->transactions > 0) ? (uint32_t) (latency_total_us / stats->transactions) : 0;
+}
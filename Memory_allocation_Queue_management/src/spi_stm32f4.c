@@ -0,0 +1,83 @@
+/**
+  ******************************************************************************
+  * @file    spi_stm32f4.c
+  * @brief   The SPIs of the STM32F4 for the SPI bus manager (spi_bus.h).  The
+  * 		 bus only uses the interrupts of its DMA streams, so there are no
+  * 		 SPI interrupt handlers.
+  ******************************************************************************
+*/
+
+#include "spi_bus.h"
+
+typedef struct
+{
+	SPI_TypeDef *regs;
+	uint32_t apb2;					// 1 if the clock is on APB2, 0 for APB1
+	uint32_t clock;
+} spi_stm32f4_port_t;
+
+static const spi_stm32f4_port_t spi_stm32f4_port[] =
+{
+	{ SPI1, 1, RCC_APB2Periph_SPI1 },
+	{ SPI2, 0, RCC_APB1Periph_SPI2 },
+	{ SPI3, 0, RCC_APB1Periph_SPI3 },
+	{ SPI4, 1, RCC_APB2Periph_SPI4 }
+};
+
+/**
+  * @brief  Enable or disable the clock of an SPI
+  *
+  * @param  regs -> SPI1 to SPI4
+  * @param  state -> ENABLE or DISABLE
+  *
+  * @retval None
+  */
+static void spi_stm32f4_enable(SPI_TypeDef *regs, FunctionalState state)
+{
+	const spi_stm32f4_port_t *port = NULL;
+
+	for (uint32_t i = 0; i < (sizeof(spi_stm32f4_port) / sizeof(spi_stm32f4_port[0])); i++)
+	{
+		if (spi_stm32f4_port[i].regs == regs)
+		{
+			port = &spi_stm32f4_port[i];
+		}
+	}
+
+	configASSERT(port != NULL);
+
+	if (port->apb2 == 1)
+	{
+		RCC_APB2PeriphClockCmd(port->clock, state);
+	}
+	else
+	{
+		RCC_APB1PeriphClockCmd(port->clock, state);
+	}
+}
+
+/**
+  * @brief  Drive the chip select pin of a device, which is active low
+  *
+  * @param  device -> the device
+  * @param  active -> ENABLE to select the device
+  *
+  * @retval None
+  */
+static void spi_stm32f4_chip_select(const spi_device_t *device, FunctionalState active)
+{
+	if (active == ENABLE)
+	{
+		GPIO_ResetBits(device->cs_port, device->cs_pin);
+	}
+	else
+	{
+		GPIO_SetBits(device->cs_port, device->cs_pin);
+	}
+}
+
+const spi_hw_t spi_stm32f4_hw =
+{
+	spi_stm32f4_enable,
+	spi_stm32f4_chip_select
+};
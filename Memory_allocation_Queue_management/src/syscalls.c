@@ -59,6 +59,8 @@
 extern int errno;
 extern int __io_putchar(int ch) __attribute__((weak));
 extern int __io_getchar(void) __attribute__((weak));
+extern int __io_read(char *ptr, int len) __attribute__((weak));
+extern int __io_write(char *ptr, int len) __attribute__((weak));
 
 register char * stack_ptr asm("sp");
 
@@ -92,6 +94,10 @@ int _read (int file, char *ptr, int len)
 {
 	int DataIdx;
 
+	/* Blocks until some bytes have arrived, rather than polling for each */
+	if (__io_read)
+		return __io_read(ptr, len);
+
 	for (DataIdx = 0; DataIdx < len; DataIdx++)
 	{
 		*ptr++ = __io_getchar();
@@ -104,6 +110,9 @@ int _write(int file, char *ptr, int len)
 {
 	int DataIdx;
 
+	if (__io_write)
+		return __io_write(ptr, len);
+
 	for (DataIdx = 0; DataIdx < len; DataIdx++)
 	{
 		__io_putchar(*ptr++);
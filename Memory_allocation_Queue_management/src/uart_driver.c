@@ -0,0 +1,562 @@
+/**
+  ******************************************************************************
+  * @file    uart_driver.c
+  * @brief   Full duplex USART driver using the DMA stream manager (see
+  * 		 uart_driver.h).  Registers are only reached through the
+  * 		 configuration and the dma_hw_t of the manager, so the driver
+  * 		 also runs against simulated registers on the host.
+  ******************************************************************************
+*/
+
+#include <string.h>
+
+#include "uart_driver.h"
+
+// USART status flags that are cleared by reading the status register and then
+// the data register
+#define UART_RX_ERROR_FLAGS		(USART_FLAG_ORE | USART_FLAG_NE | USART_FLAG_FE)
+
+static uart_t *uart_port[UART_MAX_PORTS];
+
+/**
+  * @brief  Copy the bytes the receive stream has written since the last call
+  * 		into the stream buffer.  Called from the USART and receive stream
+  * 		interrupts, which have the same priority so never run at once
+  *
+  * @param  uart -> the USART
+  * @param  woken -> set to pdTRUE if the reader was woken
+  *
+  * @retval None
+  */
+static void uart_rx_drain(uart_t *uart, BaseType_t *woken)
+{
+	uint32_t size = uart->config.rx_ring_size;
+	uint32_t head = size - DMA_GetCurrDataCounter(uart->rx_dma.regs);
+	uint32_t end, count;
+	size_t sent;
+
+	// The counter reads 0 for a moment before the stream reloads it
+	if (head == size)
+	{
+		head = 0;
+	}
+
+	while (uart->rx_tail != head)
+	{
+		end = (head > uart->rx_tail) ? head : size;
+		count = end - uart->rx_tail;
+		sent = xStreamBufferSendFromISR(uart->rx, &uart->config.rx_ring[uart->rx_tail], count, woken);
+
+		uart->stats.rx_bytes += count;
+		uart->stats.rx_dropped += count - (uint32_t) sent;
+		uart->rx_tail = (end == size) ? 0 : end;
+	}
+}
+
+/**
+  * @brief  Handle the interrupts of the receive stream, at half and full ring
+  *
+  * @param  stream -> the receive stream
+  * @param  flags -> DMA_STREAM_xxIF flags that were set
+  * @param  context -> the USART
+  * @param  woken -> set to pdTRUE if the reader was woken
+  *
+  * @retval None
+  */
+static void uart_rx_dma_handler(dma_stream_t *stream, uint32_t flags, void *context, BaseType_t *woken)
+{
+	uart_t *uart = (uart_t *) context;
+
+	(void) stream;
+
+	uart->stats.interrupts++;
+
+	if ((flags & (DMA_STREAM_TEIF | DMA_STREAM_DMEIF)) != 0)
+	{
+		uart->stats.dma_errors++;
+	}
+
+	if ((flags & (DMA_STREAM_HTIF | DMA_STREAM_TCIF)) != 0)
+	{
+		uart_rx_drain(uart, woken);
+	}
+}
+
+/**
+  * @brief  Start sending the next contiguous run of the transmit ring, if the
+  * 		transmit stream is idle and there is one.  Called from a critical
+  * 		section or the transmit stream interrupt
+  *
+  * @param  uart -> the USART
+  *
+  * @retval None
+  */
+static void uart_tx_start(uart_t *uart)
+{
+	uint32_t mask = uart->config.tx_ring_size - 1;
+	uint32_t offset = uart->tx_tail & mask;
+	uint32_t length = uart->tx_head - uart->tx_tail;
+
+	if ((uart->tx_length != 0) || (length == 0))
+	{
+		return;
+	}
+
+	if (length > (uart->config.tx_ring_size - offset))
+	{
+		length = uart->config.tx_ring_size - offset;
+	}
+
+	uart->tx_length = length;
+
+	// Cleared first so uart_flush() waits for the last byte of this run
+	USART_ClearFlag(uart->config.regs, USART_FLAG_TC);
+
+	DMA_MemoryTargetConfig(uart->tx_dma.regs, (uint32_t) (uintptr_t) &uart->config.tx_ring[offset], DMA_Memory_0);
+	DMA_SetCurrDataCounter(uart->tx_dma.regs, (uint16_t) length);
+	DMA_Cmd(uart->tx_dma.regs, ENABLE);
+}
+
+/**
+  * @brief  Handle the interrupts of the transmit stream, as each run has been
+  * 		written to the USART
+  *
+  * @param  stream -> the transmit stream
+  * @param  flags -> DMA_STREAM_xxIF flags that were set
+  * @param  context -> the USART
+  * @param  woken -> set to pdTRUE if a writer was woken
+  *
+  * @retval None
+  */
+static void uart_tx_dma_handler(dma_stream_t *stream, uint32_t flags, void *context, BaseType_t *woken)
+{
+	uart_t *uart = (uart_t *) context;
+	UBaseType_t saved_status;
+
+	(void) stream;
+
+	uart->stats.interrupts++;
+
+	if ((flags & (DMA_STREAM_TEIF | DMA_STREAM_DMEIF)) != 0)
+	{
+		uart->stats.dma_errors++;
+	}
+
+	// On a transfer error the stream has stopped, and the run is dropped
+	if ((flags & (DMA_STREAM_TCIF | DMA_STREAM_TEIF)) != 0)
+	{
+		saved_status = taskENTER_CRITICAL_FROM_ISR();
+		{
+			if ((flags & DMA_STREAM_TCIF) != 0)
+			{
+				uart->stats.tx_bytes += uart->tx_length;
+				uart->stats.tx_transfers++;
+			}
+
+			uart->tx_tail += uart->tx_length;
+			uart->tx_length = 0;
+			uart_tx_start(uart);
+		}
+		taskEXIT_CRITICAL_FROM_ISR(saved_status);
+
+		xSemaphoreGiveFromISR(uart->tx_done, woken);
+	}
+}
+
+/**
+  * @brief  Interrupt handler of a USART, called by its IRQ handler.  The idle
+  * 		line ends a frame, so the bytes received so far are passed on
+  *
+  * @param  regs -> the USART's registers
+  *
+  * @retval pdTRUE if a context switch should be requested
+  */
+BaseType_t uart_irq(USART_TypeDef *regs)
+{
+	BaseType_t woken = pdFALSE;
+	uart_t *uart = NULL;
+	uint16_t status;
+
+	for (uint32_t port = 0; port < UART_MAX_PORTS; port++)
+	{
+		if ((uart_port[port] != NULL) && (uart_port[port]->config.regs == regs))
+		{
+			uart = uart_port[port];
+		}
+	}
+
+	// Reading the status and then the data register clears the flags
+	status = regs->SR;
+	if ((status & (USART_FLAG_IDLE | UART_RX_ERROR_FLAGS)) != 0)
+	{
+		(void) USART_ReceiveData(regs);
+	}
+
+	if (uart != NULL)
+	{
+		uart->stats.interrupts++;
+
+		if ((status & UART_RX_ERROR_FLAGS) != 0)
+		{
+			uart->stats.rx_errors++;
+		}
+
+		if ((status & USART_FLAG_IDLE) != 0)
+		{
+			uart->stats.rx_frames++;
+			uart_rx_drain(uart, &woken);
+		}
+	}
+
+	return woken;
+}
+
+/**
+  * @brief  Give up the streams, objects and slot of a USART that is being
+  * 		closed or failed to open
+  *
+  * @param  uart -> the USART
+  *
+  * @retval None
+  */
+static void uart_release(uart_t *uart)
+{
+	if (uart->rx_dma.regs != NULL)
+	{
+		dma_stream_free(&uart->rx_dma);
+	}
+
+	if (uart->tx_dma.regs != NULL)
+	{
+		dma_stream_free(&uart->tx_dma);
+	}
+
+	if (uart->rx != NULL)
+	{
+		vStreamBufferDelete(uart->rx);
+	}
+
+	if (uart->tx_lock != NULL)
+	{
+		vSemaphoreDelete(uart->tx_lock);
+	}
+
+	if (uart->tx_done != NULL)
+	{
+		vSemaphoreDelete(uart->tx_done);
+	}
+
+	taskENTER_CRITICAL();
+	{
+		for (uint32_t port = 0; port < UART_MAX_PORTS; port++)
+		{
+			if (uart_port[port] == uart)
+			{
+				uart_port[port] = NULL;
+			}
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+
+/**
+  * @brief  Open a USART, claiming its DMA streams and starting to receive.
+  * 		The USART's pins are configured by the caller
+  *
+  * @param  uart -> state of the USART, kept until uart_close()
+  * @param  hw -> &uart_stm32f4_hw, or simulated registers
+  * @param  config -> the USART, its streams and rings, copied by the call
+  *
+  * @retval pdPASS, or pdFAIL if no slot, stream or memory was free
+  */
+BaseType_t uart_open(uart_t *uart, const uart_hw_t *hw, const uart_config_t *config)
+{
+	DMA_InitTypeDef dma_init;
+	BaseType_t result = pdFAIL;
+
+	configASSERT((config->rx_ring_size >= 2) && (config->rx_ring_size <= 0xFFFE) && ((config->rx_ring_size & 1) == 0));
+	configASSERT((config->tx_ring_size >= 2) && (config->tx_ring_size <= 0x10000) &&
+			((config->tx_ring_size & (config->tx_ring_size - 1)) == 0));
+
+	memset(uart, 0, sizeof(uart_t));
+	uart->config = *config;
+	uart->hw = hw;
+
+	taskENTER_CRITICAL();
+	{
+		for (uint32_t port = 0; (port < UART_MAX_PORTS) && (result == pdFAIL); port++)
+		{
+			if (uart_port[port] == NULL)
+			{
+				uart_port[port] = uart;
+				result = pdPASS;
+			}
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if (result == pdPASS)
+	{
+		// The reader is woken by the first byte, so it sees a frame as soon
+		// as the line goes idle
+		uart->rx = xStreamBufferCreate(config->rx_buffer_size, 1);
+		uart->tx_lock = xSemaphoreCreateMutex();
+		uart->tx_done = xSemaphoreCreateBinary();
+
+		if ((uart->rx == NULL) || (uart->tx_lock == NULL) || (uart->tx_done == NULL) ||
+				(dma_stream_claim(&uart->rx_dma, config->dma_controller, config->rx_stream) == pdFAIL))
+		{
+			result = pdFAIL;
+		}
+		else if (dma_stream_claim(&uart->tx_dma, config->dma_controller, config->tx_stream) == pdFAIL)
+		{
+			result = pdFAIL;
+		}
+	}
+
+	if (result == pdFAIL)
+	{
+		uart_release(uart);
+		return pdFAIL;
+	}
+
+	dma_stream_set_handler(&uart->rx_dma, uart_rx_dma_handler, uart);
+	dma_stream_set_handler(&uart->tx_dma, uart_tx_dma_handler, uart);
+	hw->enable(config->regs, config->baud_rate, ENABLE);
+
+	// Receive into the ring without end
+	DMA_StructInit(&dma_init);
+	dma_init.DMA_Channel = config->rx_channel;
+	dma_init.DMA_PeripheralBaseAddr = (uint32_t) (uintptr_t) &config->regs->DR;
+	dma_init.DMA_Memory0BaseAddr = (uint32_t) (uintptr_t) config->rx_ring;
+	dma_init.DMA_DIR = DMA_DIR_PeripheralToMemory;
+	dma_init.DMA_BufferSize = config->rx_ring_size;
+	dma_init.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	dma_init.DMA_Mode = DMA_Mode_Circular;
+	dma_init.DMA_Priority = DMA_Priority_High;
+	DMA_Init(uart->rx_dma.regs, &dma_init);
+	DMA_ITConfig(uart->rx_dma.regs, DMA_IT_HT | DMA_IT_TC | DMA_IT_TE, ENABLE);
+
+	// Send one run of the transmit ring at a time
+	dma_init.DMA_Channel = config->tx_channel;
+	dma_init.DMA_Memory0BaseAddr = (uint32_t) (uintptr_t) config->tx_ring;
+	dma_init.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+	dma_init.DMA_BufferSize = 1;
+	dma_init.DMA_Mode = DMA_Mode_Normal;
+	dma_init.DMA_Priority = DMA_Priority_Medium;
+	DMA_Init(uart->tx_dma.regs, &dma_init);
+	DMA_ITConfig(uart->tx_dma.regs, DMA_IT_TC | DMA_IT_TE, ENABLE);
+
+	DMA_Cmd(uart->rx_dma.regs, ENABLE);
+	USART_DMACmd(config->regs, USART_DMAReq_Rx | USART_DMAReq_Tx, ENABLE);
+	USART_ITConfig(config->regs, USART_IT_IDLE, ENABLE);
+	USART_ITConfig(config->regs, USART_IT_ERR, ENABLE);
+	USART_Cmd(config->regs, ENABLE);
+
+	return pdPASS;
+}
+
+/**
+  * @brief  Close a USART.  Bytes not yet sent are lost, so call uart_flush()
+  * 		first to keep them
+  *
+  * @param  uart -> an open USART, with no task reading or writing
+  *
+  * @retval None
+  */
+void uart_close(uart_t *uart)
+{
+	USART_ITConfig(uart->config.regs, USART_IT_IDLE, DISABLE);
+	USART_ITConfig(uart->config.regs, USART_IT_ERR, DISABLE);
+	USART_DMACmd(uart->config.regs, USART_DMAReq_Rx | USART_DMAReq_Tx, DISABLE);
+	USART_Cmd(uart->config.regs, DISABLE);
+	uart->hw->enable(uart->config.regs, uart->config.baud_rate, DISABLE);
+
+	uart_release(uart);
+}
+
+/**
+  * @brief  Read received bytes, waiting for at least one
+  *
+  * @param  uart -> an open USART
+  * @param  data -> where to put the bytes
+  * @param  length -> the most bytes to read
+  * @param  timeout -> ticks to wait for the first byte
+  *
+  * @retval Bytes read, 0 if none arrived within the timeout.  Only one task
+  * 		may read a USART
+  */
+size_t uart_read(uart_t *uart, void *data, size_t length, TickType_t timeout)
+{
+	return xStreamBufferReceive(uart->rx, data, length, timeout);
+}
+
+/**
+  * @brief  Queue bytes to be sent, waiting while the transmit ring is full.
+  * 		The bytes are copied, so the caller's buffer can be reused at once
+  *
+  * @param  uart -> an open USART
+  * @param  data -> the bytes
+  * @param  length -> bytes to send
+  * @param  timeout -> ticks to wait for room, in total
+  *
+  * @retval Bytes queued, fewer than length if the timeout expired
+  */
+size_t uart_write(uart_t *uart, const void *data, size_t length, TickType_t timeout)
+{
+	uint32_t mask = uart->config.tx_ring_size - 1;
+	uint32_t offset, room;
+	size_t written = 0;
+	TimeOut_t time_out;
+
+	vTaskSetTimeOutState(&time_out);
+
+	if (xSemaphoreTake(uart->tx_lock, timeout) == pdFALSE)
+	{
+		return 0;
+	}
+
+	while (written < length)
+	{
+		taskENTER_CRITICAL();
+		{
+			room = uart->config.tx_ring_size - (uart->tx_head - uart->tx_tail);
+		}
+		taskEXIT_CRITICAL();
+
+		if (room == 0)
+		{
+			if ((xTaskCheckForTimeOut(&time_out, &timeout) == pdTRUE) ||
+					(xSemaphoreTake(uart->tx_done, timeout) == pdFALSE))
+			{
+				break;
+			}
+
+			continue;
+		}
+
+		// Only this task moves the head, so the room can only grow
+		offset = uart->tx_head & mask;
+		if (room > (uart->config.tx_ring_size - offset))
+		{
+			room = uart->config.tx_ring_size - offset;
+		}
+
+		if (room > (length - written))
+		{
+			room = length - written;
+		}
+
+		memcpy(&uart->config.tx_ring[offset], (const uint8_t *) data + written, room);
+		written += room;
+
+		taskENTER_CRITICAL();
+		{
+			uart->tx_head += room;
+			uart_tx_start(uart);
+		}
+		taskEXIT_CRITICAL();
+	}
+
+	xSemaphoreGive(uart->tx_lock);
+
+	return written;
+}
+
+/**
+  * @brief  Wait until every queued byte has left the USART.  Writes by other
+  * 		tasks wait until it returns
+  *
+  * @param  uart -> an open USART
+  * @param  timeout -> ticks to wait, in total
+  *
+  * @retval pdPASS, or pdFAIL if bytes were still being sent at the timeout
+  */
+BaseType_t uart_flush(uart_t *uart, TickType_t timeout)
+{
+	BaseType_t result = pdPASS;
+	TimeOut_t time_out;
+	uint32_t pending;
+
+	vTaskSetTimeOutState(&time_out);
+
+	// tx_done wakes a single task, so a writer waiting for room and this
+	// wait must not both be taking it
+	if (xSemaphoreTake(uart->tx_lock, timeout) == pdFALSE)
+	{
+		return pdFAIL;
+	}
+
+	for(;;)
+	{
+		taskENTER_CRITICAL();
+		{
+			pending = uart->tx_head - uart->tx_tail;
+		}
+		taskEXIT_CRITICAL();
+
+		if (pending == 0)
+		{
+			break;
+		}
+
+		if ((xTaskCheckForTimeOut(&time_out, &timeout) == pdTRUE) ||
+				(xSemaphoreTake(uart->tx_done, timeout) == pdFALSE))
+		{
+			result = pdFAIL;
+			break;
+		}
+	}
+
+	// The last byte may still be shifting out, which takes one character time
+	while ((result == pdPASS) && (USART_GetFlagStatus(uart->config.regs, USART_FLAG_TC) == RESET))
+	{
+		if (xTaskCheckForTimeOut(&time_out, &timeout) == pdTRUE)
+		{
+			result = pdFAIL;
+		}
+	}
+
+	xSemaphoreGive(uart->tx_lock);
+
+	return result;
+}
+
+/**
+  * @brief  Send bytes by polling, without the kernel.  For fault handlers,
+  * 		which may run with interrupts disabled.  A run the transmit stream
+  * 		has started is finished first; the rest of the ring is not sent
+  *
+  * @param  uart -> an open USART
+  * @param  data -> the bytes
+  * @param  length -> bytes to send
+  *
+  * @retval None
+  */
+void uart_write_polled(uart_t *uart, const void *data, size_t length)
+{
+	while (DMA_GetCmdStatus(uart->tx_dma.regs) == ENABLE);
+
+	for (size_t i = 0; i < length; i++)
+	{
+		while (USART_GetFlagStatus(uart->config.regs, USART_FLAG_TXE) == RESET);
+		USART_SendData(uart->config.regs, ((const uint8_t *) data)[i]);
+	}
+}
+
+/**
+  * @brief  Read the counters of a USART
+  *
+  * @param  uart -> an open USART
+  * @param  stats -> set to the counters since the USART was opened
+  *
+  * @retval None
+  */
+void uart_get_stats(uart_t *uart, uart_stats_t *stats)
+{
+	taskENTER_CRITICAL();
+	{
+		*stats = uart->stats;
+	}
+	taskEXIT_CRITICAL();
+}
@@ -0,0 +1,105 @@
+/**
+  ******************************************************************************
+  * @file    uart_stm32f4.c
+  * @brief   The USARTs of the STM32F4 for the USART driver (uart_driver.h),
+  * 		 and their interrupt handlers.
+  ******************************************************************************
+*/
+
+#include "uart_driver.h"
+#include "trace_recorder.h"
+
+// Priority of the USART interrupts, the same as the DMA stream interrupts so
+// the driver's handlers never preempt one another
+#define UART_IRQ_PRIORITY		(6)
+
+typedef struct
+{
+	USART_TypeDef *regs;
+	IRQn_Type irq;
+	uint32_t apb2;					// 1 if the clock is on APB2, 0 for APB1
+	uint32_t clock;
+} uart_stm32f4_port_t;
+
+static const uart_stm32f4_port_t uart_stm32f4_port[] =
+{
+	{ USART1, USART1_IRQn, 1, RCC_APB2Periph_USART1 },
+	{ USART2, USART2_IRQn, 0, RCC_APB1Periph_USART2 },
+	{ USART3, USART3_IRQn, 0, RCC_APB1Periph_USART3 },
+	{ USART6, USART6_IRQn, 1, RCC_APB2Periph_USART6 }
+};
+
+/**
+  * @brief  Enable the clock and interrupt of a USART and set it to the baud
+  * 		rate with 8 data bits, no parity and 1 stop bit, or disable its
+  * 		interrupt and clock
+  *
+  * @param  regs -> USART1, USART2, USART3 or USART6
+  * @param  baud_rate -> bits per second
+  * @param  state -> ENABLE or DISABLE
+  *
+  * @retval None
+  */
+static void uart_stm32f4_enable(USART_TypeDef *regs, uint32_t baud_rate, FunctionalState state)
+{
+	const uart_stm32f4_port_t *port = NULL;
+	USART_InitTypeDef uart_init;
+
+	for (uint32_t i = 0; i < (sizeof(uart_stm32f4_port) / sizeof(uart_stm32f4_port[0])); i++)
+	{
+		if (uart_stm32f4_port[i].regs == regs)
+		{
+			port = &uart_stm32f4_port[i];
+		}
+	}
+
+	configASSERT(port != NULL);
+
+	if (state == DISABLE)
+	{
+		NVIC_DisableIRQ(port->irq);
+	}
+
+	if (port->apb2 == 1)
+	{
+		RCC_APB2PeriphClockCmd(port->clock, state);
+	}
+	else
+	{
+		RCC_APB1PeriphClockCmd(port->clock, state);
+	}
+
+	if (state == ENABLE)
+	{
+		USART_StructInit(&uart_init);
+		uart_init.USART_BaudRate = baud_rate;
+		uart_init.USART_Mode = USART_Mode_Rx | USART_Mode_Tx;
+		USART_Init(regs, &uart_init);
+
+		NVIC_SetPriority(port->irq, UART_IRQ_PRIORITY);
+		NVIC_EnableIRQ(port->irq);
+	}
+}
+
+const uart_hw_t uart_stm32f4_hw =
+{
+	uart_stm32f4_enable
+};
+
+// Each handler passes its USART to the driver
+#define UART_IRQ_HANDLER(name)														\
+	void name##_IRQHandler(void)													\
+	{																				\
+		BaseType_t woken;															\
+																					\
+		vTraceRecorderISRBegin(name##_IRQn);										\
+		woken = uart_irq(name);														\
+		vTraceRecorderISREnd(name##_IRQn);											\
+																					\
+		portYIELD_FROM_ISR(woken);													\
+	}
+
+UART_IRQ_HANDLER(USART1)
+UART_IRQ_HANDLER(USART2)
+UART_IRQ_HANDLER(USART3)
+UART_IRQ_HANDLER(USART6)
@@ -1,5 +1,13 @@
 #include "demo.h"
 
+// Yields made by prvMeasureContextSwitch(), each causing two context switches
+#define SWITCH_BENCH_YIELDS		(1000)
+
+// Tasks reported by prvPrintFPUStats()
+#define FPU_STATS_MAX_TASKS		(8)
+
+static volatile BaseType_t switch_bench_running;
+
 /**
   * @brief  Utility to print data to USART
   *
@@ -9,9 +17,264 @@
   */
 void prvPrintMsg(const char *message)
 {
-	for (uint32_t i = 0; i < strlen(message); i++)
+	// Before the scheduler starts nothing can wait for the DMA to finish
+	if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+	{
+		uart_write(&console_uart, message, strlen(message), portMAX_DELAY);
+	}
+	else
+	{
+		uart_write_polled(&console_uart, message, strlen(message));
+	}
+}
+
+/**
+  * @brief  Read from the console for the C library, blocking the task until
+  * 		at least one byte arrives
+  *
+  * @param  ptr -> where to put the bytes
+  * @param  len -> the most bytes to read
+  *
+  * @retval Bytes read
+  */
+int __io_read(char *ptr, int len)
+{
+	return (int) uart_read(&console_uart, ptr, (size_t) len, portMAX_DELAY);
+}
+
+/**
+  * @brief  Write to the console for the C library
+  *
+  * @param  ptr -> the bytes
+  * @param  len -> bytes to write
+  *
+  * @retval Bytes written
+  */
+int __io_write(char *ptr, int len)
+{
+	return (int) uart_write(&console_uart, ptr, (size_t) len, portMAX_DELAY);
+}
+
+/**
+  * @brief  Utility to print the statistics of each heap region to USART
+  *
+  * @param  None
+  *
+  * @retval None
+  */
+void prvPrintHeapStats(void)
+{
+	HeapRegionStats_t region_stats;
+	char msg[160];
+
+	for (UBaseType_t region = 0; xPortGetHeapRegionStats(region, &region_stats) == pdPASS; region++)
+	{
+		sprintf(msg,
+				"Heap %s: free %lu of %lu bytes, min ever free %lu, largest block %lu, allocs %lu, frees %lu\r\n",
+				region_stats.pcName,
+				(unsigned long) region_stats.xStats.xAvailableHeapSpaceInBytes,
+				(unsigned long) region_stats.xTotalHeapSpaceInBytes,
+				(unsigned long) region_stats.xStats.xMinimumEverFreeBytesRemaining,
+				(unsigned long) region_stats.xStats.xSizeOfLargestFreeBlockInBytes,
+				(unsigned long) region_stats.xStats.xNumberOfSuccessfulAllocations,
+				(unsigned long) region_stats.xStats.xNumberOfSuccessfulFrees);
+		prvPrintMsg(msg);
+	}
+
+#if (configUSE_OBJECT_SLABS == 1)
+	static const char *slab_names[] = { "tasks", "small stacks", "large stacks", "queues", "timers" };
+	SlabStats_t slab_stats;
+
+	for (UBaseType_t slab = 0; slab < eSlabNumberOfSlabs; slab++)
+	{
+		vSlabGetStats((eSlab) slab, &slab_stats);
+		sprintf(msg, "Slab %s: %lu of %lu blocks in use, most %lu, heap fallbacks %lu\r\n",
+				slab_names[slab],
+				(unsigned long) slab_stats.uxBlocksInUse,
+				(unsigned long) slab_stats.uxNumberOfBlocks,
+				(unsigned long) slab_stats.uxMaximumBlocksInUse,
+				(unsigned long) slab_stats.uxHeapFallbacks);
+		prvPrintMsg(msg);
+	}
+#endif
+
+#if (configUSE_HEAP_TRACE == 1)
+	// Memory still held by tasks that have been deleted has leaked
+	size_t orphaned_bytes;
+	UBaseType_t orphans = uxHeapTraceGetOrphans(&orphaned_bytes);
+
+	sprintf(msg, "Heap leaked by deleted tasks: %lu allocations, %lu bytes\r\n",
+			(unsigned long) orphans, (unsigned long) orphaned_bytes);
+	prvPrintMsg(msg);
+#endif
+
+	prvPrintMsg("\r\n");
+}
+
+/**
+  * @brief  Utility to print the stack used by each task, and the depth the
+  * 		stack profiler recommends for it, to USART
+  *
+  * @param  None
+  *
+  * @retval None
+  */
+void prvPrintStackReport(void)
+{
+	static StackProfile_t report[configSTACK_PROFILER_MAX_TASKS];
+	char msg[120];
+
+	// Sample now, so the report includes the work done since the last sample
+	vStackProfilerSample();
+
+	UBaseType_t tasks = uxStackProfilerGetReport(report, configSTACK_PROFILER_MAX_TASKS);
+
+	for (UBaseType_t task = 0; task < tasks; task++)
+	{
+		sprintf(msg, "Stack %s: used %lu of %lu words, recommended %lu%s\r\n",
+				report[task].pcTaskName,
+				(unsigned long) report[task].uxMaximumUsed,
+				(unsigned long) report[task].uxStackDepth,
+				(unsigned long) report[task].uxRecommendedDepth,
+				(report[task].xDeleted != pdFALSE) ? " (deleted)" : "");
+		prvPrintMsg(msg);
+	}
+
+	prvPrintMsg("\r\n");
+}
+
+/**
+  * @brief  Utility to print how many context switches of each task saved the
+  * 		FPU registers to USART.  A task that never uses the FPU should
+  * 		show none, and can be made FPU free again with vTaskSetFPUFree()
+  *
+  * @param  None
+  *
+  * @retval None
+  */
+void prvPrintFPUStats(void)
+{
+	static TaskStatus_t status[FPU_STATS_MAX_TASKS];
+	uint32_t switches, fpu_saves;
+	char msg[100];
+
+	vTaskGetFPUContextStats(&switches, &fpu_saves);
+	sprintf(msg, "Context switches: %lu, with FPU registers: %lu\r\n",
+			(unsigned long) switches, (unsigned long) fpu_saves);
+	prvPrintMsg(msg);
+
+	UBaseType_t tasks = uxTaskGetSystemState(status, FPU_STATS_MAX_TASKS, NULL);
+
+	for (UBaseType_t task = 0; task < tasks; task++)
+	{
+		sprintf(msg, "FPU %s: %lu of %lu switches%s\r\n",
+				status[task].pcTaskName,
+				(unsigned long) status[task].ulFPUContextSaves,
+				(unsigned long) status[task].ulContextSwitches,
+				(status[task].xFPUFree != pdFALSE) ? ", FPU free" : "");
+		prvPrintMsg(msg);
+	}
+
+	prvPrintMsg("\r\n");
+}
+
+/**
+  * @brief  Called by the kernel when a task has overflowed its stack, either
+  * 		at a context switch or, through the DWT watchpoint, at the moment
+  * 		the task writes to the end of its stack
+  *
+  * @param  task -> handle of the task that overflowed
+  * @param  task_name -> name of the task that overflowed
+  *
+  * @retval None
+  */
+void vApplicationStackOverflowHook(TaskHandle_t task, char *task_name)
+{
+	(void) task;
+
+	taskDISABLE_INTERRUPTS();
+
+	// Polled, as the DMA interrupts are disabled
+	uart_write_polled(&console_uart, "Stack overflow in task ", 23);
+	uart_write_polled(&console_uart, task_name, strlen(task_name));
+	uart_write_polled(&console_uart, "\r\n", 2);
+
+	for(;;);
+}
+
+// Yields back to prvMeasureContextSwitch() until it has finished
+static void switch_partner_task(void *parameters)
+{
+	(void) parameters;
+
+	while (switch_bench_running == pdTRUE)
 	{
-		while(USART_GetFlagStatus(USART2, USART_FLAG_TXE) != SET);
-		USART_SendData(USART2, message[i]);
+		taskYIELD();
 	}
+
+	vTaskDelete(NULL);
+}
+
+/**
+  * @brief  Utility to measure the time of a context switch, by yielding to
+  * 		a task of the same priority that yields straight back.  Used to
+  * 		compare the stack overflow checks, which run on every switch
+  *
+  * @param  None
+  *
+  * @retval CPU cycles per context switch
+  */
+uint32_t prvMeasureContextSwitch(void)
+{
+	uint32_t start, cycles;
+	BaseType_t result;
+
+	switch_bench_running = pdTRUE;
+	result = xTaskCreate(switch_partner_task, "Switch", configMINIMAL_STACK_SIZE, NULL, uxTaskPriorityGet(NULL), NULL);
+	configASSERT(result == pdPASS);
+
+	// Let the partner start, so its first switch is not timed
+	taskYIELD();
+
+	// The cycle counter is enabled by the trace recorder
+	start = DWT->CYCCNT;
+	for (uint32_t i = 0; i < SWITCH_BENCH_YIELDS; i++)
+	{
+		taskYIELD();
+	}
+	cycles = DWT->CYCCNT - start;
+
+	switch_bench_running = pdFALSE;
+	taskYIELD();
+
+	return cycles / (2 * SWITCH_BENCH_YIELDS);
+}
+
+/**
+  * @brief  Utility to measure the time of a yield that selects the task that
+  * 		yielded, which the PendSV handler returns from without restoring
+  * 		the task's registers.  The priority of the calling task is raised
+  * 		above every other task for the measurement
+  *
+  * @param  None
+  *
+  * @retval CPU cycles per yield
+  */
+uint32_t prvMeasureYield(void)
+{
+	UBaseType_t priority = uxTaskPriorityGet(NULL);
+	uint32_t start, cycles;
+
+	vTaskPrioritySet(NULL, configMAX_PRIORITIES - 1);
+
+	start = DWT->CYCCNT;
+	for (uint32_t i = 0; i < SWITCH_BENCH_YIELDS; i++)
+	{
+		taskYIELD();
+	}
+	cycles = DWT->CYCCNT - start;
+
+	vTaskPrioritySet(NULL, priority);
+
+	return cycles / SWITCH_BENCH_YIELDS;
 }
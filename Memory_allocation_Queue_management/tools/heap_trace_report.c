@@ -0,0 +1,366 @@
+/**
+  ******************************************************************************
+  * @file    heap_trace_report.c
+  * @brief   Host tool decoding a heap trace image (heap_trace.h) written by
+  * 		 vHeapTraceDump().
+  *
+  * 		 Prints the heap usage with a suggested configTOTAL_HEAP_SIZE,
+  * 		 the allocations leaked by deleted tasks, the live allocations
+  * 		 grouped by caller, a histogram of free block sizes and the
+  * 		 largest free block over time.  Caller addresses can be turned
+  * 		 into source lines with addr2line -e <elf file> <address>.
+  *
+  * 		 Build: gcc -std=gnu99 -O2 tools/heap_trace_report.c -o heap_trace_report
+  * 		 Usage: heap_trace_report heap.bin
+  ******************************************************************************
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+// Image layout, which must match heap_trace.h
+#define HEAP_TRACE_MAGIC		(0x54485246UL)
+#define HEAP_TRACE_VERSION		(1)
+#define HEADER_SIZE				(48)
+#define RECORD_SIZE				(20)
+#define SAMPLE_SIZE				(16)
+#define HISTOGRAM_BUCKETS		(16)
+#define HISTOGRAM_SHIFT			(4)
+#define NAME_LENGTH				(16)
+#define NAME_SIZE				(4 + NAME_LENGTH)
+#define FLAG_ORPHANED			(0x80000000UL)
+
+// Headroom added to the peak usage for the suggested heap size, in percent
+#define HEADROOM_PERCENT		(25)
+#define HISTOGRAM_BAR_WIDTH		(40)
+
+typedef struct
+{
+	uint32_t address;
+	uint32_t size;
+	uint32_t caller;
+	uint32_t owner;
+	uint32_t timestamp;
+	int orphaned;
+} Record_st;
+
+typedef struct
+{
+	uint32_t caller;
+	uint32_t count;
+	uint32_t bytes;
+} Caller_st;
+
+static const uint8_t *names;
+static uint32_t name_count;
+
+static uint32_t read_u32(const uint8_t *p)
+{
+	return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static uint16_t read_u16(const uint8_t *p)
+{
+	return (uint16_t) (p[0] | (p[1] << 8));
+}
+
+// Returns the name of a task that owns live allocations, or NULL
+static const char *owner_name(uint32_t owner, char *buffer)
+{
+	uint32_t i;
+
+	for (i = 0; i < name_count; i++)
+	{
+		if (read_u32(names + (i * NAME_SIZE)) == owner)
+		{
+			memcpy(buffer, names + (i * NAME_SIZE) + 4, NAME_LENGTH);
+			buffer[NAME_LENGTH] = '\0';
+			return buffer;
+		}
+	}
+
+	return NULL;
+}
+
+static int by_bytes(const void *a, const void *b)
+{
+	const Caller_st *x = a, *y = b;
+
+	return (x->bytes < y->bytes) ? 1 : ((x->bytes > y->bytes) ? -1 : 0);
+}
+
+static void print_usage(const uint8_t *header)
+{
+	uint32_t total = read_u32(header + 24);
+	uint32_t free_now = read_u32(header + 28);
+	uint32_t min_free = read_u32(header + 32);
+	uint32_t peak = total - min_free;
+	uint32_t suggested = peak + ((peak * HEADROOM_PERCENT) / 100);
+
+	// Round the suggestion up to a whole KB, as the heap size usually is
+	suggested = (suggested + 1023) & ~1023UL;
+
+	printf("Heap usage\n");
+	printf("  heap size        %8lu bytes\n", (unsigned long) total);
+	printf("  in use now       %8lu bytes\n", (unsigned long) (total - free_now));
+	printf("  peak in use      %8lu bytes\n", (unsigned long) peak);
+	printf("  allocations      %8lu, frees %lu, not recorded %lu\n", (unsigned long) read_u32(header + 36),
+			(unsigned long) read_u32(header + 40), (unsigned long) read_u32(header + 44));
+	printf("  suggested configTOTAL_HEAP_SIZE: %lu (%luKB, peak + %d%%)\n\n", (unsigned long) suggested,
+			(unsigned long) (suggested / 1024), HEADROOM_PERCENT);
+}
+
+static void print_leaks(const Record_st *records, uint32_t count, uint32_t now, uint32_t hz)
+{
+	uint32_t i, leaks = 0, bytes = 0;
+
+	printf("Leaks (allocations still owned by deleted tasks)\n");
+
+	for (i = 0; i < count; i++)
+	{
+		if (records[i].orphaned)
+		{
+			printf("  0x%08lx %6lu bytes  caller 0x%08lx  task 0x%08lx  age %lu ms\n",
+					(unsigned long) records[i].address, (unsigned long) records[i].size,
+					(unsigned long) records[i].caller, (unsigned long) records[i].owner,
+					(unsigned long) (((uint64_t) (now - records[i].timestamp) * 1000) / hz));
+			leaks++;
+			bytes += records[i].size;
+		}
+	}
+
+	printf("  %lu leaked allocations, %lu bytes\n\n", (unsigned long) leaks, (unsigned long) bytes);
+}
+
+static void print_callers(const Record_st *records, uint32_t count)
+{
+	Caller_st *callers = calloc(count + 1, sizeof(Caller_st));
+	uint32_t i, j, caller_count = 0;
+	char buffer[NAME_LENGTH + 1];
+	const char *name;
+
+	for (i = 0; i < count; i++)
+	{
+		for (j = 0; (j < caller_count) && (callers[j].caller != records[i].caller); j++)
+		{
+		}
+
+		if (j == caller_count)
+		{
+			callers[caller_count++].caller = records[i].caller;
+		}
+
+		callers[j].count++;
+		callers[j].bytes += records[i].size;
+	}
+
+	qsort(callers, caller_count, sizeof(Caller_st), by_bytes);
+
+	printf("Live allocations by caller\n");
+	for (i = 0; i < caller_count; i++)
+	{
+		printf("  caller 0x%08lx %4lu allocations %8lu bytes  tasks:", (unsigned long) callers[i].caller,
+				(unsigned long) callers[i].count, (unsigned long) callers[i].bytes);
+
+		// List each owner once
+		for (j = 0; j < count; j++)
+		{
+			uint32_t k;
+
+			if (records[j].caller != callers[i].caller)
+			{
+				continue;
+			}
+
+			for (k = 0; (k < j) && ((records[k].caller != records[j].caller) || (records[k].owner != records[j].owner)
+					|| (records[k].orphaned != records[j].orphaned)); k++)
+			{
+			}
+
+			if (k < j)
+			{
+				continue;
+			}
+
+			name = owner_name(records[j].owner, buffer);
+			if (records[j].owner == 0)
+			{
+				printf(" (before scheduler)");
+			}
+			else if (records[j].orphaned || (name == NULL))
+			{
+				printf(" 0x%08lx (deleted)", (unsigned long) records[j].owner);
+			}
+			else
+			{
+				printf(" %s", name);
+			}
+		}
+		printf("\n");
+	}
+	printf("\n");
+
+	free(callers);
+}
+
+static void print_histogram(const uint8_t *histogram)
+{
+	uint32_t bucket, count, largest = 1, bar;
+
+	for (bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+	{
+		if (read_u32(histogram + (bucket * 4)) > largest)
+		{
+			largest = read_u32(histogram + (bucket * 4));
+		}
+	}
+
+	printf("Free blocks by size\n");
+	for (bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+	{
+		count = read_u32(histogram + (bucket * 4));
+
+		if (bucket == 0)
+		{
+			printf("  %8d - %-7lu", 0, (unsigned long) ((1UL << (HISTOGRAM_SHIFT + 1)) - 1));
+		}
+		else if (bucket == (HISTOGRAM_BUCKETS - 1))
+		{
+			printf("  %8lu - %-7s", (unsigned long) (1UL << (bucket + HISTOGRAM_SHIFT)), "");
+		}
+		else
+		{
+			printf("  %8lu - %-7lu", (unsigned long) (1UL << (bucket + HISTOGRAM_SHIFT)),
+					(unsigned long) ((1UL << (bucket + HISTOGRAM_SHIFT + 1)) - 1));
+		}
+
+		printf(" %5lu ", (unsigned long) count);
+		for (bar = 0; bar < ((count * HISTOGRAM_BAR_WIDTH) + largest - 1) / largest; bar++)
+		{
+			putchar('#');
+		}
+		printf("\n");
+	}
+	printf("\n");
+}
+
+static void print_samples(const uint8_t *samples, uint32_t count, uint32_t hz)
+{
+	uint32_t i, free_bytes, largest;
+	const uint8_t *sample;
+
+	printf("Free space over time (fragmentation is the free space outside the largest block)\n");
+	printf("  %10s %10s %10s %8s %14s\n", "time ms", "free", "largest", "blocks", "fragmentation");
+
+	for (i = 0; i < count; i++)
+	{
+		sample = samples + (i * SAMPLE_SIZE);
+		free_bytes = read_u32(sample + 4);
+		largest = read_u32(sample + 8);
+
+		printf("  %10lu %10lu %10lu %8lu %13.1f%%\n",
+				(unsigned long) (((uint64_t) read_u32(sample) * 1000) / hz),
+				(unsigned long) free_bytes, (unsigned long) largest, (unsigned long) read_u32(sample + 12),
+				(free_bytes == 0) ? 0.0 : (100.0 * (double) (free_bytes - largest)) / (double) free_bytes);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	FILE *file;
+	uint8_t *image;
+	long length;
+	uint32_t record_count, sample_count, hz, i, now;
+	const uint8_t *records, *samples, *histogram;
+	Record_st *decoded;
+
+	if (argc != 2)
+	{
+		fprintf(stderr, "usage: %s heap.bin\n", argv[0]);
+		return 1;
+	}
+
+	file = fopen(argv[1], "rb");
+	if (file == NULL)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+
+	fseek(file, 0, SEEK_END);
+	length = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	image = malloc((size_t) length);
+
+	if ((image == NULL) || (length < HEADER_SIZE) || (fread(image, 1, (size_t) length, file) != (size_t) length))
+	{
+		fprintf(stderr, "%s: cannot read the image\n", argv[1]);
+		return 1;
+	}
+
+	fclose(file);
+
+	if ((read_u32(image) != HEAP_TRACE_MAGIC) || (read_u16(image + 4) != HEAP_TRACE_VERSION)
+			|| (read_u16(image + 6) != RECORD_SIZE))
+	{
+		fprintf(stderr, "%s: not a version %d heap trace image\n", argv[1], HEAP_TRACE_VERSION);
+		return 1;
+	}
+
+	record_count = read_u32(image + 8);
+	sample_count = read_u32(image + 12);
+	name_count = read_u32(image + 16);
+	hz = (read_u32(image + 20) != 0) ? read_u32(image + 20) : 1;
+
+	records = image + HEADER_SIZE;
+	samples = records + (record_count * RECORD_SIZE);
+	histogram = samples + (sample_count * SAMPLE_SIZE);
+	names = histogram + (HISTOGRAM_BUCKETS * 4);
+
+	if ((long) ((names - image) + (name_count * NAME_SIZE)) > length)
+	{
+		fprintf(stderr, "%s: the image is truncated\n", argv[1]);
+		return 1;
+	}
+
+	// Decode the records, the newest allocation gives the time of the dump
+	decoded = calloc(record_count + 1, sizeof(Record_st));
+	now = 0;
+
+	for (i = 0; i < record_count; i++)
+	{
+		const uint8_t *record = records + (i * RECORD_SIZE);
+		uint32_t size = read_u32(record + 4);
+
+		decoded[i].address = read_u32(record);
+		decoded[i].size = size & ~FLAG_ORPHANED;
+		decoded[i].orphaned = ((size & FLAG_ORPHANED) != 0);
+		decoded[i].caller = read_u32(record + 8);
+		decoded[i].owner = read_u32(record + 12);
+		decoded[i].timestamp = read_u32(record + 16);
+
+		if ((int32_t) (decoded[i].timestamp - now) > 0)
+		{
+			now = decoded[i].timestamp;
+		}
+	}
+
+	// The dump takes a sample first, so the last sample is newer still
+	if (sample_count > 0)
+	{
+		now = read_u32(samples + ((sample_count - 1) * SAMPLE_SIZE));
+	}
+
+	print_usage(image);
+	print_leaks(decoded, record_count, now, hz);
+	print_callers(decoded, record_count);
+	print_histogram(histogram);
+	print_samples(samples, sample_count, hz);
+
+	free(decoded);
+	free(image);
+
+	return 0;
+}
@@ -0,0 +1,479 @@
+/**
+  ******************************************************************************
+  * @file    trace_to_json.c
+  * @brief   Host tool converting a trace recorder image (trace_recorder.h),
+  * 		 saved from a debugger or written by vTraceRecorderDump(), to
+  * 		 the Chrome trace event JSON format read by Perfetto
+  * 		 (ui.perfetto.dev) and chrome://tracing.
+  *
+  * 		 Each core is shown as a track of the tasks and interrupts it ran,
+  * 		 each task as a track of the time it ran with its kernel events,
+  * 		 and each queue as a counter of the items it holds.
+  *
+  * 		 Build: gcc -std=gnu99 -O2 tools/trace_to_json.c -o trace_to_json
+  * 		 Usage: trace_to_json trace.bin > trace.json
+  ******************************************************************************
+*/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+// Image layout, which must match trace_recorder.h
+#define RECORDER_MAGIC			(0x52545246UL)
+#define RECORDER_VERSION		(1)
+#define HEADER_SIZE				(40)
+#define NAME_LENGTH				(16)
+#define NAME_SIZE				(4 + NAME_LENGTH)
+#define EVENT_SIZE				(12)
+#define FLAG_STOP_WHEN_FULL		(1UL)
+#define NO_NAME_SLOT			(0xffff)
+
+// Event codes, which must match trace_recorder.h
+enum
+{
+	EVENT_NONE = 0,
+	EVENT_TASK_SWITCHED_IN = 1,
+	EVENT_TASK_CREATE = 3,
+	EVENT_TICK = 13,
+	EVENT_QUEUE_SEND = 18,
+	EVENT_QUEUE_SEND_FROM_ISR = 20,
+	EVENT_QUEUE_RECEIVE = 22,
+	EVENT_QUEUE_RECEIVE_FROM_ISR = 24,
+	EVENT_ISR_BEGIN = 88,
+	EVENT_ISR_END = 89,
+	EVENT_OBJECT_NAME = 91,
+	EVENT_CALIBRATION = 92
+};
+
+static const char *event_names[256] =
+{
+	[1] = "Switched in", [2] = "Ready", [3] = "Create task", [4] = "Delete task",
+	[5] = "Delay", [6] = "Delay until", [7] = "Suspend", [8] = "Resume",
+	[9] = "Resume from ISR", [10] = "Priority set", [11] = "Priority inherit",
+	[12] = "Priority disinherit", [13] = "Tick",
+	[16] = "Create queue", [17] = "Create mutex", [18] = "Queue send",
+	[19] = "Queue send failed", [20] = "Queue send from ISR",
+	[21] = "Queue send from ISR failed", [22] = "Queue receive",
+	[23] = "Queue receive failed", [24] = "Queue receive from ISR",
+	[25] = "Queue receive from ISR failed", [26] = "Queue peek",
+	[27] = "Block on queue send", [28] = "Block on queue receive",
+	[29] = "Block on queue peek", [30] = "Delete queue",
+	[31] = "Mutex give recursive", [32] = "Mutex take recursive",
+	[40] = "Notify", [41] = "Notify from ISR", [42] = "Notify give from ISR",
+	[43] = "Block on notify take", [44] = "Notify take",
+	[45] = "Block on notify wait", [46] = "Notify wait",
+	[48] = "Create event group", [49] = "Set bits", [50] = "Set bits from ISR",
+	[51] = "Clear bits", [52] = "Clear bits from ISR", [53] = "Block on wait bits",
+	[54] = "Wait bits end", [55] = "Block on sync", [56] = "Sync end",
+	[57] = "Delete event group",
+	[64] = "Create stream buffer", [65] = "Stream buffer send",
+	[66] = "Stream buffer send from ISR", [67] = "Stream buffer receive",
+	[68] = "Stream buffer receive from ISR", [69] = "Block on stream buffer send",
+	[70] = "Block on stream buffer receive", [71] = "Delete stream buffer",
+	[80] = "Timer expired", [88] = "ISR begin", [89] = "ISR end",
+	[90] = "User event", [91] = "Name"
+};
+
+#define MAX_CORES				(16)
+#define MAX_TASKS				(256)
+#define MAX_ISR_NESTING			(8)
+
+typedef struct
+{
+	uint32_t object;
+	char name[NAME_LENGTH + 1];
+	int current;				// Set once the event that recorded the name is reached
+} Name_st;
+
+typedef struct
+{
+	uint32_t tcb;				// 0 until the core runs its first task
+	double start_us;
+	uint32_t isr[MAX_ISR_NESTING];
+	double isr_start_us[MAX_ISR_NESTING];
+	int isr_depth;
+} Core_st;
+
+static Name_st *names;
+static uint32_t name_count;
+static uint32_t tasks[MAX_TASKS];
+static uint32_t task_count;
+static Core_st cores[MAX_CORES];
+static int first_event = 1;
+
+// Prints one JSON trace event, separated from the previous one
+static void emit(const char *format, ...) __attribute__((format(printf, 1, 2)));
+static void emit(const char *format, ...)
+{
+	va_list args;
+
+	printf("%s", first_event ? "" : ",\n");
+	first_event = 0;
+
+	va_start(args, format);
+	vprintf(format, args);
+	va_end(args);
+}
+
+static uint32_t read_u32(const uint8_t *p)
+{
+	return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static uint16_t read_u16(const uint8_t *p)
+{
+	return (uint16_t) (p[0] | (p[1] << 8));
+}
+
+// Returns the name recorded for an object by the most recent create or name
+// event, else the last name recorded for it, or NULL.  An address can be
+// reused by a later task or object.
+static const char *find_name(uint32_t object)
+{
+	uint32_t i;
+	const char *latest = NULL;
+
+	for (i = name_count; i > 0; i--)
+	{
+		if (names[i - 1].object == object)
+		{
+			if (names[i - 1].current)
+			{
+				return names[i - 1].name;
+			}
+
+			if (latest == NULL)
+			{
+				latest = names[i - 1].name;
+			}
+		}
+	}
+
+	return latest;
+}
+
+// Makes a name slot the current name of its object
+static void use_name(uint32_t object, uint16_t slot)
+{
+	uint32_t i;
+
+	if ((slot == NO_NAME_SLOT) || (slot >= name_count))
+	{
+		return;
+	}
+
+	for (i = 0; i < name_count; i++)
+	{
+		if (names[i].object == object)
+		{
+			names[i].current = (i == slot);
+		}
+	}
+}
+
+static const char *object_name(uint32_t object, const char *kind, char *buffer, size_t length)
+{
+	const char *name = find_name(object);
+
+	if (name == NULL)
+	{
+		snprintf(buffer, length, "%s 0x%08lx", kind, (unsigned long) object);
+		name = buffer;
+	}
+
+	return name;
+}
+
+// Returns the track number of a task, adding it the first time it is seen
+static uint32_t task_track(uint32_t tcb)
+{
+	uint32_t i;
+	char buffer[32];
+
+	for (i = 0; i < task_count; i++)
+	{
+		if (tasks[i] == tcb)
+		{
+			return i + 1;
+		}
+	}
+
+	if (task_count == MAX_TASKS)
+	{
+		return 0;
+	}
+
+	tasks[task_count++] = tcb;
+	emit("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":2,\"tid\":%lu,\"args\":{\"name\":\"%s\"}}",
+			(unsigned long) task_count, object_name(tcb, "Task", buffer, sizeof(buffer)));
+
+	return task_count;
+}
+
+// Ends the slice of the task running on a core, on the core and task tracks
+static void end_task_slice(uint32_t core, double now_us)
+{
+	char buffer[32];
+	Core_st *c = &cores[core];
+	const char *name;
+
+	if (c->tcb != 0)
+	{
+		name = object_name(c->tcb, "Task", buffer, sizeof(buffer));
+		emit("{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f}",
+				name, (unsigned long) core, c->start_us, now_us - c->start_us);
+		emit("{\"name\":\"Running\",\"ph\":\"X\",\"pid\":2,\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"core\":%lu}}",
+				(unsigned long) task_track(c->tcb), c->start_us, now_us - c->start_us, (unsigned long) core);
+	}
+}
+
+static void convert_event(const uint8_t *record, double now_us)
+{
+	uint32_t object = read_u32(record + 4);
+	uint16_t parameter = read_u16(record + 8);
+	uint32_t core = record[10];
+	uint8_t code = record[11];
+	Core_st *c;
+	char buffer[32];
+	const char *event_name;
+	int items;
+
+	if (core >= MAX_CORES)
+	{
+		return;
+	}
+
+	c = &cores[core];
+
+	switch (code)
+	{
+		case EVENT_TASK_SWITCHED_IN:
+			if (c->tcb != object)
+			{
+				end_task_slice(core, now_us);
+				c->tcb = object;
+				c->start_us = now_us;
+				(void) task_track(object);
+			}
+			return;
+
+		case EVENT_TASK_CREATE:
+			use_name(object, parameter);
+			break;
+
+		case EVENT_OBJECT_NAME:
+			use_name(object, parameter);
+			return;
+
+		case EVENT_TICK:
+		case EVENT_CALIBRATION:
+			return;
+
+		case EVENT_ISR_BEGIN:
+			if (c->isr_depth < MAX_ISR_NESTING)
+			{
+				c->isr[c->isr_depth] = object;
+				c->isr_start_us[c->isr_depth] = now_us;
+			}
+			c->isr_depth++;
+			return;
+
+		case EVENT_ISR_END:
+			if (c->isr_depth > 0)
+			{
+				c->isr_depth--;
+
+				if (c->isr_depth < MAX_ISR_NESTING)
+				{
+					emit("{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f}",
+							object_name(c->isr[c->isr_depth], "ISR", buffer, sizeof(buffer)), (unsigned long) core,
+							c->isr_start_us[c->isr_depth], now_us - c->isr_start_us[c->isr_depth]);
+				}
+			}
+			return;
+
+		case EVENT_QUEUE_SEND:
+		case EVENT_QUEUE_SEND_FROM_ISR:
+		case EVENT_QUEUE_RECEIVE:
+		case EVENT_QUEUE_RECEIVE_FROM_ISR:
+			// The parameter is the number of items before the operation
+			items = parameter + (((code == EVENT_QUEUE_SEND) || (code == EVENT_QUEUE_SEND_FROM_ISR)) ? 1 : -1);
+			emit("{\"name\":\"%s\",\"ph\":\"C\",\"pid\":3,\"ts\":%.3f,\"args\":{\"items\":%d}}",
+					object_name(object, "Queue", buffer, sizeof(buffer)), now_us, items);
+			break;
+
+		default:
+			break;
+	}
+
+	// Everything else is an instant event on the track of the running task,
+	// or of the core if no task has run yet
+	event_name = (event_names[code] != NULL) ? event_names[code] : "Unknown";
+
+	if ((c->tcb != 0) && (c->isr_depth == 0))
+	{
+		emit("{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":2,\"tid\":%lu,\"ts\":%.3f,\"args\":{\"object\":\"%s\",\"parameter\":%u}}",
+				event_name, (unsigned long) task_track(c->tcb), now_us,
+				object_name(object, "Object", buffer, sizeof(buffer)), parameter);
+	}
+	else
+	{
+		emit("{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%lu,\"ts\":%.3f,\"args\":{\"object\":\"%s\",\"parameter\":%u}}",
+				event_name, (unsigned long) core, now_us,
+				object_name(object, "Object", buffer, sizeof(buffer)), parameter);
+	}
+}
+
+// driver funtion
+int main(int argc, char **argv)
+{
+	FILE *file;
+	uint8_t *image;
+	long length;
+	uint32_t name_slots, event_slots, hz, overhead, budget, written, names_written, flags;
+	uint32_t first, count, i, used_names, core, dropped = 0, max_core = 0;
+	const uint8_t *record;
+	uint32_t last_timestamp = 0;
+	int64_t time = 0;
+	int started = 0;
+	double now_us = 0.0;
+
+	if (argc != 2)
+	{
+		fprintf(stderr, "usage: %s trace.bin > trace.json\n", argv[0]);
+		return 1;
+	}
+
+	file = fopen(argv[1], "rb");
+	if (file == NULL)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+
+	fseek(file, 0, SEEK_END);
+	length = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	image = malloc((size_t) length);
+
+	if ((image == NULL) || (length < HEADER_SIZE) || (fread(image, 1, (size_t) length, file) != (size_t) length))
+	{
+		fprintf(stderr, "%s: cannot read the image\n", argv[1]);
+		return 1;
+	}
+
+	fclose(file);
+
+	if ((read_u32(image) != RECORDER_MAGIC) || (read_u16(image + 4) != RECORDER_VERSION))
+	{
+		fprintf(stderr, "%s: not a version %d trace recorder image\n", argv[1], RECORDER_VERSION);
+		return 1;
+	}
+
+	name_slots = read_u16(image + 6);
+	event_slots = read_u32(image + 8);
+	hz = read_u32(image + 12);
+	overhead = read_u32(image + 16);
+	budget = read_u32(image + 20);
+	written = read_u32(image + 24);
+	names_written = read_u32(image + 28);
+	flags = read_u32(image + 36);
+
+	if ((hz == 0) || ((long) (HEADER_SIZE + (name_slots * NAME_SIZE) + (event_slots * EVENT_SIZE)) > length))
+	{
+		fprintf(stderr, "%s: the image is truncated or recording was never started\n", argv[1]);
+		return 1;
+	}
+
+	// Name table
+	used_names = (names_written < name_slots) ? names_written : name_slots;
+	names = calloc(used_names + 1, sizeof(Name_st));
+	for (i = 0; i < used_names; i++)
+	{
+		record = image + HEADER_SIZE + (i * NAME_SIZE);
+		names[i].object = read_u32(record);
+		memcpy(names[i].name, record + 4, NAME_LENGTH);
+	}
+	name_count = used_names;
+
+	// The oldest event is at index 0 until the ring wraps, after which it is
+	// the slot about to be overwritten, unless recording stopped when full
+	if (written <= event_slots)
+	{
+		first = 0;
+		count = written;
+	}
+	else if ((flags & FLAG_STOP_WHEN_FULL) != 0)
+	{
+		first = 0;
+		count = event_slots;
+		dropped = written - event_slots;
+	}
+	else
+	{
+		first = written - event_slots;
+		count = event_slots;
+		dropped = first;
+	}
+
+	printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+	emit("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Cores\"}}");
+	emit("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":2,\"args\":{\"name\":\"Tasks\"}}");
+	emit("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":3,\"args\":{\"name\":\"Queues\"}}");
+
+	for (i = 0; i < count; i++)
+	{
+		record = image + HEADER_SIZE + (name_slots * NAME_SIZE) + (((first + i) & (event_slots - 1)) * EVENT_SIZE);
+
+		// Skip records that were incomplete when the image was saved
+		if ((record[11] == EVENT_NONE) || (record[10] >= MAX_CORES))
+		{
+			continue;
+		}
+
+		// The timestamp counter wraps, so accumulate the difference from the
+		// previous event.  Events on different cores can be slightly out of
+		// order, hence the signed difference.
+		if (!started)
+		{
+			last_timestamp = read_u32(record);
+			started = 1;
+		}
+		time += (int32_t) (read_u32(record) - last_timestamp);
+		last_timestamp = read_u32(record);
+		now_us = ((double) time * 1000000.0) / (double) hz;
+
+		if (record[10] > max_core)
+		{
+			max_core = record[10];
+		}
+
+		convert_event(record, now_us);
+	}
+
+	for (core = 0; core <= max_core; core++)
+	{
+		end_task_slice(core, now_us);
+		emit("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%lu,\"args\":{\"name\":\"Core %lu\"}}",
+				(unsigned long) core, (unsigned long) core);
+	}
+
+	printf("\n]}\n");
+
+	fprintf(stderr, "%lu events converted, %lu lost, %lu tasks, %.3f ms\n", (unsigned long) count,
+			(unsigned long) dropped, (unsigned long) task_count, now_us / 1000.0);
+
+	if (overhead != 0)
+	{
+		fprintf(stderr, "recording overhead: %lu counts per event at %lu Hz, budget %lu: %s\n", (unsigned long) overhead,
+				(unsigned long) hz, (unsigned long) budget, (overhead <= budget) ? "pass" : "FAIL");
+	}
+
+	free(names);
+	free(image);
+
+	return 0;
+}